@@ -0,0 +1,27 @@
+-- 헤드리스 벤치마크(-bench=Lua) 전용 스크립트
+-- 매 Tick 위치 갱신 + 코루틴 대기로 스크립트 호출/바인딩/스케줄러 비용을 만듦
+
+local Phase = 0
+local Origin = nil
+local Direction = 1
+
+function BeginPlay()
+    Origin = Obj.Location
+    Phase = (Origin.X + Origin.Y) * 0.05
+    StartCoroutine(Flip)
+end
+
+function Flip()
+    while true do
+        coroutine.yield("wait_time", 0.5)
+        Direction = -Direction
+    end
+end
+
+function EndPlay()
+end
+
+function Tick(dt)
+    Phase = Phase + dt * Direction
+    Obj.Location = Origin + Vector(math.sin(Phase), math.cos(Phase), 0) * 0.5
+end
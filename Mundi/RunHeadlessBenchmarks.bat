@@ -0,0 +1,104 @@
+@echo off
+REM ============================================================
+REM Mundi Engine - Headless Benchmark Runner
+REM Runs every reference scene without a window/renderer and
+REM writes per-subsystem timings to Benchmarks\<Scene>.json
+REM Also compares direct vs batched Lua script ticking at
+REM 1k/5k scripted actors (Benchmarks\Lua_<N>_<Mode>.json)
+REM and tile vs clustered light culling (Benchmarks\LightCulling.json)
+REM and AoS vs SoA SIMD frustum culling (Benchmarks\FrustumCulling.json)
+REM and CPU occlusion culling on the Actors scene (Benchmarks\Occlusion.json)
+REM and JSON vs cooked level loading at 10k/100k actors (Benchmarks\LevelLoad.json)
+REM and async load handle/cancel stress test (Benchmarks\AsyncLoadStress.json)
+REM and cold/warm mesh cache loads, stream vs mapped (Benchmarks\MeshCache.json)
+REM
+REM Usage: RunHeadlessBenchmarks.bat [path\to\Mundi.exe] [frames]
+REM ============================================================
+
+REM Data\ paths are relative, so run from the project folder
+cd /d "%~dp0"
+
+set MUNDI_EXE=%~1
+if "%MUNDI_EXE%"=="" set MUNDI_EXE=..\Binaries\Release_StandAlone\Mundi.exe
+
+set FRAMES=%~2
+if "%FRAMES%"=="" set FRAMES=600
+
+if not exist "%MUNDI_EXE%" (
+    echo [ERROR] %MUNDI_EXE% not found. Build the Release_StandAlone configuration first.
+    exit /b 1
+)
+
+if not exist Benchmarks mkdir Benchmarks
+
+set FAILED=0
+for %%S in (Actors Physics Particles Skinned Lua) do (
+    echo [RUN] %%S
+    "%MUNDI_EXE%" -headless -bench=%%S -frames=%FRAMES% -out=Benchmarks\%%S.json
+    if errorlevel 1 (
+        echo [ERROR] %%S failed
+        set FAILED=1
+    )
+)
+
+REM The Lua reference scene has 2000 actors: -scale 0.5 = 1k, 2.5 = 5k
+call :RunLuaTick 1k 0.5
+call :RunLuaTick 5k 2.5
+
+echo [RUN] LightCulling (tile vs clustered, lights x resolution)
+"%MUNDI_EXE%" -headless -lightcullbench -out=Benchmarks\LightCulling.json
+if errorlevel 1 (
+    echo [ERROR] LightCulling failed
+    set FAILED=1
+)
+
+echo [RUN] FrustumCulling (AoS vs SoA SIMD, 100k primitives)
+"%MUNDI_EXE%" -headless -frustumbench -out=Benchmarks\FrustumCulling.json
+if errorlevel 1 (
+    echo [ERROR] FrustumCulling failed
+    set FAILED=1
+)
+
+echo [RUN] Occlusion (CPU occluder raster + HZB, views around the Actors scene)
+"%MUNDI_EXE%" -headless -bench=Actors -occlusionbench -out=Benchmarks\Occlusion.json
+if errorlevel 1 (
+    echo [ERROR] Occlusion failed
+    set FAILED=1
+)
+
+echo [RUN] LevelLoad (JSON vs cooked, 10k/100k actors)
+"%MUNDI_EXE%" -headless -levelloadbench -out=Benchmarks\LevelLoad.json
+if errorlevel 1 (
+    echo [ERROR] LevelLoad failed
+    set FAILED=1
+)
+
+echo [RUN] AsyncLoadStress (handle copy/move/cancel, failed and cancelled loads)
+"%MUNDI_EXE%" -headless -asyncloadstress -out=Benchmarks\AsyncLoadStress.json
+if errorlevel 1 (
+    echo [ERROR] AsyncLoadStress failed
+    set FAILED=1
+)
+
+echo [RUN] MeshCache (cold/warm .obj.bin/.fbx.bin loads, stream vs mapped)
+"%MUNDI_EXE%" -headless -meshcachebench -out=Benchmarks\MeshCache.json
+if errorlevel 1 (
+    echo [ERROR] MeshCache failed
+    set FAILED=1
+)
+
+exit /b %FAILED%
+
+:RunLuaTick
+echo [RUN] Lua %1 (direct / batched script tick)
+"%MUNDI_EXE%" -headless -bench=Lua -scale=%2 -frames=%FRAMES% -out=Benchmarks\Lua_%1_Direct.json
+if errorlevel 1 (
+    echo [ERROR] Lua %1 direct failed
+    set FAILED=1
+)
+"%MUNDI_EXE%" -headless -bench=Lua -scale=%2 -frames=%FRAMES% -luabatchtick -out=Benchmarks\Lua_%1_Batched.json
+if errorlevel 1 (
+    echo [ERROR] Lua %1 batched failed
+    set FAILED=1
+)
+exit /b 0
@@ -55,12 +55,25 @@ uint CalculateTileIndex(float4 screenPos, float viewportStartX, float viewportSt
     return tileY * TileCountX + tileX;
 }
 
-// 타일별 라이트 인덱스 데이터의 시작 오프셋 계산
-uint GetTileDataOffset(uint tileIndex)
+// 뷰 공간 깊이로부터 깊이 슬라이스 계산 (FClusteredLightCuller::ComputeDepthSlice와 같은 로그 분할)
+uint CalculateDepthSlice(float viewDepth)
 {
-    // MaxLightsPerTile = 256 (TileLightCuller.h와 일치)
-    const uint MaxLightsPerTile = 256;
-    return tileIndex * MaxLightsPerTile;
+    float slice = log(max(viewDepth, 1e-4f)) * DepthSliceScale + DepthSliceBias;
+    return min((uint) max(slice, 0.0f), NumDepthSlices - 1);
+}
+
+// 클러스터 인덱스 = (슬라이스 * TileCountY + 타일 Y) * TileCountX + 타일 X
+uint CalculateClusterIndex(float4 screenPos, float viewDepth)
+{
+    uint tileIndex = CalculateTileIndex(screenPos, ViewportStartX, ViewportStartY);
+    return CalculateDepthSlice(viewDepth) * TileCountX * TileCountY + tileIndex;
+}
+
+// 클러스터의 라이트 인덱스 목록 위치와 개수
+void GetClusterLightRange(uint clusterIndex, out uint lightOffset, out uint lightCount)
+{
+    lightOffset = g_ClusterLightData[clusterIndex * 2];
+    lightCount = g_ClusterLightData[clusterIndex * 2 + 1];
 }
 
 //================================================================================================
@@ -853,16 +866,15 @@ float3 CalculateAllLights(
         ShadowMap2D, ShadowSampler
     );
 
-    // Point + Spot with 타일 컬링
+    // Point + Spot with 클러스터 컬링
     if (bUseTileCulling)
     {
-        uint tileIndex = CalculateTileIndex(screenPos, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        uint lightOffset, lightCount;
+        GetClusterLightRange(CalculateClusterIndex(screenPos, viewPos.z), lightOffset, lightCount);
 
         for (uint i = 0; i < lightCount; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_ClusterLightData[lightOffset + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;
             uint lightIdx = packedIndex & 0xFFFF;
 
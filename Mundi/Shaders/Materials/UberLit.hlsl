@@ -440,18 +440,15 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     // 타일 기반 라이트 컬링 적용 (활성화된 경우)
     if (bUseTileCulling)
     {
-        // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
+        // 현재 픽셀이 속한 클러스터 (화면 타일 + 뷰 공간 깊이 슬라이스)의 라이트 목록
+        uint lightOffset, lightCount;
+        GetClusterLightRange(CalculateClusterIndex(Input.Position, ViewPos.z), lightOffset, lightCount);
 
-        // 타일에 영향을 주는 라이트 개수
-        uint lightCount = g_TileLightIndices[tileDataOffset];
-
-        // 타일 내 라이트만 순회
+        // 클러스터 내 라이트만 순회
         [loop]
         for (uint i = 0; i < lightCount; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_ClusterLightData[lightOffset + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;  // 상위 16비트: 타입
             uint lightIdx = packedIndex & 0xFFFF;           // 하위 16비트: 인덱스
 
@@ -552,18 +549,15 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     // 타일 기반 라이트 컬링 적용 (활성화된 경우)
     if (bUseTileCulling)
     {
-        // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
-
-        // 타일에 영향을 주는 라이트 개수
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        // 현재 픽셀이 속한 클러스터 (화면 타일 + 뷰 공간 깊이 슬라이스)의 라이트 목록
+        uint lightOffset, lightCount;
+        GetClusterLightRange(CalculateClusterIndex(Input.Position, ViewPos.z), lightOffset, lightCount);
 
-        // 타일 내 라이트만 순회
+        // 클러스터 내 라이트만 순회
         [loop]
         for (uint i = 0; i < lightCount; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_ClusterLightData[lightOffset + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;  // 상위 16비트: 타입
             uint lightIdx = packedIndex & 0xFFFF;           // 하위 16비트: 인덱스
 
@@ -6,6 +6,9 @@
 #include "ObjectIterator.h"
 #include "WindowsBinReader.h"
 #include "WindowsBinWriter.h"
+#include "MappedFileReader.h"
+#include "CacheFileHeader.h"
+#include "PlatformTime.h"
 #include "PathUtils.h"
 #include "AnimSequence.h"
 #include "AnimDataModel.h"
@@ -15,6 +18,11 @@
 
 IMPLEMENT_CLASS(UFbxLoader)
 
+// .fbx.bin 메시 캐시 직렬화 포맷이 바뀌면 올려서 이전 캐시를 무효화
+// 3: USE_QUANTIZED_VERTEX 기본값을 끄면서 이전에 압축 포맷으로 저장된 캐시를 다시 생성
+// 4: 캐시를 만든 실행도 압축 정점을 디코딩해 쓰도록 고친 뒤 USE_QUANTIZED_VERTEX를 다시 켬
+static constexpr uint32 FbxMeshCacheVersion = 4;
+
 // 노드가 스켈레톤 속성을 포함하는지 확인
 static bool NodeContainsSkeleton(FbxNode* InNode)
 {
@@ -268,6 +276,7 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 	if (!bShouldRegenerate)
 	{
 		UE_LOG("Attempting to load FBX '%s' from cache.", NormalizedPath.c_str());
+		const uint64 CacheLoadStartCycles = FPlatformTime::Cycles64();
 		try
 		{
 			MeshData = new FSkeletalMeshData();
@@ -277,11 +286,13 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 			std::filesystem::path p(UTF8ToWide(NormalizedPath));
 			MeshData->Skeleton.Name = WideToUTF8(p.stem().wstring());
 
-			FWindowsBinReader Reader(BinPathFileName);
+			// 메모리 매핑으로 읽고 헤더 버전/체크섬 검증
+			FMappedFileReader Reader(BinPathFileName);
 			if (!Reader.IsOpen())
 			{
 				throw std::runtime_error("Failed to open bin file for reading.");
 			}
+			CacheFile::ReadHeader(Reader, FbxMeshCacheVersion);
 			Reader << *MeshData;
 			Reader.Close();
 
@@ -312,7 +323,10 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 			MeshData->CacheFilePath = BinPathFileName;
 			bLoadedFromCache = true;
 
-			UE_LOG("Successfully loaded FBX '%s' from cache.", NormalizedPath.c_str());
+			UE_LOG("Successfully loaded FBX '%s' from cache. (%.2f ms)", NormalizedPath.c_str(),
+				FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - CacheLoadStartCycles));
+			VertexQuantization::LogMemoryReport(NormalizedPath, static_cast<uint32>(MeshData->Vertices.size()),
+				sizeof(FSkinnedVertex), sizeof(FQuantizedSkinnedVertex), MeshData->VertexStreamFormat);
 			return MeshData;
 		}
 		catch (const std::exception& e)
@@ -453,9 +467,7 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 	// 5. 캐시 저장
 	try
 	{
-		FWindowsBinWriter Writer(BinPathFileName);
-		Writer << *MeshData;
-		Writer.Close();
+		CacheFile::Save(BinPathFileName, FbxMeshCacheVersion, [&](FArchive& Ar) { Ar << *MeshData; });
 
 		for (FMaterialInfo& MaterialInfo : MaterialInfos)
 		{
@@ -469,6 +481,8 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 		MeshData->CacheFilePath = BinPathFileName;
 
 		UE_LOG("Cache regeneration complete for FBX '%s'.", NormalizedPath.c_str());
+		VertexQuantization::LogMemoryReport(NormalizedPath, static_cast<uint32>(MeshData->Vertices.size()),
+			sizeof(FSkinnedVertex), sizeof(FQuantizedSkinnedVertex), MeshData->VertexStreamFormat);
 	}
 	catch (const std::exception& e)
 	{
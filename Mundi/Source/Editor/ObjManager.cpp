@@ -7,6 +7,9 @@
 #include "Enums.h"
 #include "WindowsBinReader.h"
 #include "WindowsBinWriter.h"
+#include "MappedFileReader.h"
+#include "CacheFileHeader.h"
+#include "PlatformTime.h"
 #include <filesystem>
 #include <unordered_set>
 
@@ -14,6 +17,11 @@ namespace fs = std::filesystem;
 
 TMap<FString, FStaticMesh*> FObjManager::ObjStaticMeshMap;
 
+// .obj.bin 직렬화 포맷이 바뀌면 올려서 이전 캐시를 무효화
+// 3: USE_QUANTIZED_VERTEX 기본값을 끄면서 이전에 압축 포맷으로 저장된 캐시를 다시 생성
+// 4: 캐시를 만든 실행도 압축 정점을 디코딩해 쓰도록 고친 뒤 USE_QUANTIZED_VERTEX를 다시 켬
+static constexpr uint32 ObjMeshCacheVersion = 4;
+
 // 파일 유틸 함수
 namespace
 {
@@ -283,6 +291,20 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		return *It;
 	}
 
+	TArray<FMaterialInfo> MaterialInfos;
+	FStaticMesh* NewFStaticMesh = LoadObjStaticMeshData(NormalizedPathStr, MaterialInfos);
+	if (!NewFStaticMesh)
+	{
+		return nullptr;
+	}
+
+	return RegisterObjStaticMeshData(NormalizedPathStr, NewFStaticMesh, MaterialInfos);
+}
+
+FStaticMesh* FObjManager::LoadObjStaticMeshData(const FString& PathFileName, TArray<FMaterialInfo>& MaterialInfos)
+{
+	FString NormalizedPathStr = NormalizePath(PathFileName);
+
 	std::filesystem::path Path(UTF8ToWide(NormalizedPathStr));
 
 	// 2. 파일 경로 설정
@@ -312,7 +334,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 
 	// 3. 캐시 데이터 로드 시도 및 실패 시 재생성 로직
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
+	MaterialInfos.Empty();
 	bool bLoadedSuccessfully = false;
 
 	// 캐시가 오래되었는지 먼저 확인
@@ -321,15 +343,17 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	if (!bShouldRegenerate)
 	{
 		UE_LOG("Attempting to load '%s' from cache.", NormalizedPathStr.c_str());
+		const uint64 CacheLoadStartCycles = FPlatformTime::Cycles64();
 		try
 		{
-			// 캐시에서 FStaticMesh 데이터 로드
-			FWindowsBinReader Reader(BinPathFileName);
+			// 캐시에서 FStaticMesh 데이터 로드 (메모리 매핑, 헤더 버전/체크섬 검증)
+			FMappedFileReader Reader(BinPathFileName);
 			if (!Reader.IsOpen())
 			{
 				// Reader 생성자에서 예외를 던지지 않는 경우를 대비한 명시적 실패 처리
 				throw std::runtime_error("Failed to open bin file for reading.");
 			}
+			CacheFile::ReadHeader(Reader, ObjMeshCacheVersion);
 			Reader << *NewFStaticMesh;
 			Reader.Close();
 
@@ -346,7 +370,10 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 
 			// 모든 로드가 성공적으로 완료됨
 			bLoadedSuccessfully = true;
-			UE_LOG("Successfully loaded '%s' from cache.", NormalizedPathStr.c_str());
+			UE_LOG("Successfully loaded '%s' from cache. (%.2f ms)", NormalizedPathStr.c_str(),
+				FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - CacheLoadStartCycles));
+			VertexQuantization::LogMemoryReport(NormalizedPathStr, static_cast<uint32>(NewFStaticMesh->Vertices.size()),
+				sizeof(FNormalVertex), sizeof(FQuantizedNormalVertex), NewFStaticMesh->VertexStreamFormat);
 		}
 		catch (const std::exception& e)
 		{
@@ -366,7 +393,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	}
 #else
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
+	MaterialInfos.Empty();
 	bool bLoadedSuccessfully = false;
 #endif // USE_OBJ_CACHE
 
@@ -415,15 +442,15 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 
 #ifdef USE_OBJ_CACHE
 		// 새로운 캐시 파일(.bin) 저장 (이제 올바른 데이터가 저장됨)
-		FWindowsBinWriter Writer(BinPathFileName);
-		Writer << *NewFStaticMesh;
-		Writer.Close();
+		CacheFile::Save(BinPathFileName, ObjMeshCacheVersion, [&](FArchive& Ar) { Ar << *NewFStaticMesh; });
 
 		FWindowsBinWriter MatWriter(MatBinPathFileName);
 		Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
 		MatWriter.Close();
 
 		UE_LOG("Cache regeneration complete for '%s'.", NormalizedPathStr.c_str());
+		VertexQuantization::LogMemoryReport(NormalizedPathStr, static_cast<uint32>(NewFStaticMesh->Vertices.size()),
+			sizeof(FNormalVertex), sizeof(FQuantizedNormalVertex), NewFStaticMesh->VertexStreamFormat);
 #endif // USE_OBJ_CACHE
 	}
 	else
@@ -437,9 +464,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			UE_LOG("Updating outdated cache for '%s' with default material.", NormalizedPathStr.c_str());
 			try
 			{
-				FWindowsBinWriter Writer(BinPathFileName);
-				Writer << *NewFStaticMesh;
-				Writer.Close();
+				CacheFile::Save(BinPathFileName, ObjMeshCacheVersion, [&](FArchive& Ar) { Ar << *NewFStaticMesh; });
 				FWindowsBinWriter MatWriter(MatBinPathFileName);
 				Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
 				MatWriter.Close();
@@ -452,6 +477,23 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		}
 	}
 
+	return NewFStaticMesh;
+}
+
+FStaticMesh* FObjManager::RegisterObjStaticMeshData(const FString& PathFileName, FStaticMesh* NewFStaticMesh, TArray<FMaterialInfo>& MaterialInfos)
+{
+	FString NormalizedPathStr = NormalizePath(PathFileName);
+
+	// 비동기 로드 도중 동기 로드가 먼저 끝났다면 기존 에셋을 사용
+	if (FStaticMesh** It = ObjStaticMeshMap.Find(NormalizedPathStr))
+	{
+		if (*It != NewFStaticMesh)
+		{
+			delete NewFStaticMesh;
+		}
+		return *It;
+	}
+
 	// 4. 머티리얼 및 텍스처 경로 처리 (공통 로직)
 	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 경로 처리
 
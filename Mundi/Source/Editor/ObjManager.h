@@ -65,6 +65,10 @@ public:
 	static void Preload();
 	static void Clear();
 	static FStaticMesh* LoadObjStaticMeshAsset(const FString& PathFileName);
+
+	// 비동기 로드용 2단계 분리: 캐시/파싱(워커 스레드 가능, UObject 생성 없음) -> 머티리얼 생성 및 등록(메인 스레드)
+	static FStaticMesh* LoadObjStaticMeshData(const FString& PathFileName, TArray<FMaterialInfo>& OutMaterialInfos);
+	static FStaticMesh* RegisterObjStaticMeshData(const FString& PathFileName, FStaticMesh* InStaticMesh, TArray<FMaterialInfo>& InMaterialInfos);
 	static UStaticMesh* LoadObjStaticMesh(const FString& PathFileName);
 
 	// FBX 등 외부에서 생성된 FStaticMesh를 캐시에 등록
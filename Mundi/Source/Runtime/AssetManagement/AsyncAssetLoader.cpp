@@ -0,0 +1,288 @@
+#include "pch.h"
+#include "AsyncAssetLoader.h"
+#include "ResourceBase.h"
+#include "PlatformTime.h"
+#include <algorithm>
+
+DECLARE_CYCLE_STAT(AsyncLoadData, "Asset")
+
+namespace
+{
+    // std::push_heap/pop_heap용 비교자 (우선순위가 높은 요청이 힙의 front)
+    bool HeapLess(const std::shared_ptr<FAsyncLoadRequest>& A, const std::shared_ptr<FAsyncLoadRequest>& B)
+    {
+        return FAsyncAssetLoader::IsHigherPriority(B, A);
+    }
+}
+
+// ─────────────────────────────────────────────
+// FAsyncLoadHandle
+// ─────────────────────────────────────────────
+
+FAsyncLoadHandle::FAsyncLoadHandle(std::shared_ptr<FAsyncLoadRequest> InRequest)
+    : Request(std::move(InRequest))
+{
+    if (Request)
+    {
+        ++Request->HandleCount;
+    }
+}
+
+FAsyncLoadHandle::FAsyncLoadHandle(const FAsyncLoadHandle& Other)
+    : Request(Other.Request)
+    , bCancelled(Other.bCancelled)
+{
+    if (Request && !bCancelled)
+    {
+        ++Request->HandleCount;
+    }
+}
+
+FAsyncLoadHandle::FAsyncLoadHandle(FAsyncLoadHandle&& Other) noexcept
+    : Request(std::move(Other.Request))
+    , bCancelled(Other.bCancelled)
+{
+    Other.Request = nullptr;
+    Other.bCancelled = false;
+}
+
+FAsyncLoadHandle& FAsyncLoadHandle::operator=(const FAsyncLoadHandle& Other)
+{
+    if (this != &Other)
+    {
+        // 자기 자신과 같은 요청이어도 먼저 올려야 카운트가 0을 거치지 않음
+        if (Other.Request && !Other.bCancelled)
+        {
+            ++Other.Request->HandleCount;
+        }
+        Release();
+        Request = Other.Request;
+        bCancelled = Other.bCancelled;
+    }
+    return *this;
+}
+
+FAsyncLoadHandle& FAsyncLoadHandle::operator=(FAsyncLoadHandle&& Other) noexcept
+{
+    if (this != &Other)
+    {
+        Release();
+        Request = std::move(Other.Request);
+        bCancelled = Other.bCancelled;
+        Other.Request = nullptr;
+        Other.bCancelled = false;
+    }
+    return *this;
+}
+
+FAsyncLoadHandle::~FAsyncLoadHandle()
+{
+    Release();
+}
+
+void FAsyncLoadHandle::Release()
+{
+    if (Request && !bCancelled)
+    {
+        --Request->HandleCount;
+    }
+    Request = nullptr;
+    bCancelled = false;
+}
+
+bool FAsyncLoadHandle::IsLoading() const
+{
+    if (!Request)
+    {
+        return false;
+    }
+    const EAsyncLoadState State = Request->State.load();
+    return State == EAsyncLoadState::Queued || State == EAsyncLoadState::Loading || State == EAsyncLoadState::PendingFinalize;
+}
+
+bool FAsyncLoadHandle::IsCompleted() const
+{
+    return Request && !IsLoading();
+}
+
+EAsyncLoadState FAsyncLoadHandle::GetState() const
+{
+    return Request ? Request->State.load() : EAsyncLoadState::Failed;
+}
+
+UResourceBase* FAsyncLoadHandle::GetResource() const
+{
+    if (!Request || Request->State.load() != EAsyncLoadState::Completed)
+    {
+        return nullptr;
+    }
+    return Request->Resource;
+}
+
+void FAsyncLoadHandle::Cancel()
+{
+    if (!Request || bCancelled || !IsLoading())
+    {
+        return;
+    }
+
+    bCancelled = true;
+    if (--Request->HandleCount <= 0)
+    {
+        // 기다리는 핸들이 없으면 요청 자체를 취소 (정리는 ProcessAsyncLoads에서)
+        Request->bCancelled = true;
+    }
+}
+
+// ─────────────────────────────────────────────
+// FAsyncAssetLoader
+// ─────────────────────────────────────────────
+
+FAsyncAssetLoader::~FAsyncAssetLoader()
+{
+    Shutdown();
+}
+
+void FAsyncAssetLoader::Initialize(int32 InNumWorkers)
+{
+    if (!Workers.IsEmpty())
+    {
+        return;
+    }
+
+    if (InNumWorkers <= 0)
+    {
+        // 메인/렌더 스레드 몫을 남기고 최대 4개
+        const int32 HardwareThreads = static_cast<int32>(std::thread::hardware_concurrency());
+        InNumWorkers = std::clamp(HardwareThreads - 1, 1, 4);
+    }
+
+    bStopping = false;
+    for (int32 i = 0; i < InNumWorkers; ++i)
+    {
+        Workers.emplace_back(&FAsyncAssetLoader::WorkerLoop, this);
+    }
+}
+
+void FAsyncAssetLoader::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> Lock(QueueMutex);
+        bStopping = true;
+    }
+    QueueCondition.notify_all();
+
+    for (std::thread& Worker : Workers)
+    {
+        if (Worker.joinable())
+        {
+            Worker.join();
+        }
+    }
+    Workers.Empty();
+
+    // 처리되지 않은 요청은 완료 목록으로 넘겨 메인 스레드가 정리하게 함
+    std::lock_guard<std::mutex> QueueLock(QueueMutex);
+    std::lock_guard<std::mutex> CompletedLock(CompletedMutex);
+    for (std::shared_ptr<FAsyncLoadRequest>& Request : Queue)
+    {
+        Request->bCancelled = true;
+        Request->State = EAsyncLoadState::PendingFinalize;
+        Completed.Add(Request);
+    }
+    Queue.Empty();
+}
+
+void FAsyncAssetLoader::Enqueue(const std::shared_ptr<FAsyncLoadRequest>& InRequest)
+{
+    {
+        std::lock_guard<std::mutex> Lock(QueueMutex);
+        Queue.Add(InRequest);
+        std::push_heap(Queue.begin(), Queue.end(), HeapLess);
+    }
+    QueueCondition.notify_one();
+}
+
+void FAsyncAssetLoader::RaisePriority(const std::shared_ptr<FAsyncLoadRequest>& InRequest, EAsyncLoadPriority InPriority)
+{
+    std::lock_guard<std::mutex> Lock(QueueMutex);
+    if (InRequest->Priority >= InPriority)
+    {
+        return;
+    }
+
+    InRequest->Priority = InPriority;
+    if (InRequest->State.load() == EAsyncLoadState::Queued)
+    {
+        std::make_heap(Queue.begin(), Queue.end(), HeapLess);
+    }
+}
+
+void FAsyncAssetLoader::DrainCompleted(TArray<std::shared_ptr<FAsyncLoadRequest>>& OutCompleted)
+{
+    std::lock_guard<std::mutex> Lock(CompletedMutex);
+    for (std::shared_ptr<FAsyncLoadRequest>& Request : Completed)
+    {
+        OutCompleted.Add(std::move(Request));
+    }
+    Completed.Empty();
+}
+
+int32 FAsyncAssetLoader::GetNumQueued()
+{
+    std::lock_guard<std::mutex> Lock(QueueMutex);
+    return Queue.Num();
+}
+
+bool FAsyncAssetLoader::IsHigherPriority(const std::shared_ptr<FAsyncLoadRequest>& A, const std::shared_ptr<FAsyncLoadRequest>& B)
+{
+    if (A->Priority != B->Priority)
+    {
+        return A->Priority > B->Priority;
+    }
+    return A->Sequence < B->Sequence;
+}
+
+void FAsyncAssetLoader::WorkerLoop()
+{
+    // WIC(DDS 변환)를 워커에서 사용하므로 스레드마다 COM 초기화
+    const HRESULT ComResult = ::CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+    FProfiler::SetThreadName("AssetLoader");
+
+    while (true)
+    {
+        std::shared_ptr<FAsyncLoadRequest> Request;
+        {
+            std::unique_lock<std::mutex> Lock(QueueMutex);
+            QueueCondition.wait(Lock, [this]() { return bStopping || !Queue.IsEmpty(); });
+            if (bStopping)
+            {
+                break;
+            }
+
+            std::pop_heap(Queue.begin(), Queue.end(), HeapLess);
+            Request = std::move(Queue.back());
+            Queue.pop_back();
+            Request->State = EAsyncLoadState::Loading;
+        }
+
+        // 대기 중에 취소된 요청은 IO를 건너뜀
+        if (!Request->bCancelled.load() && Request->Resource)
+        {
+            SCOPE_CYCLE_COUNTER(AsyncLoadData)
+            FScopedMemoryTag MemTag(Request->MemoryTag);
+            Request->bWorkerSucceeded = Request->Resource->LoadAsyncData(Request->Path);
+        }
+
+        Request->State = EAsyncLoadState::PendingFinalize;
+        {
+            std::lock_guard<std::mutex> Lock(CompletedMutex);
+            Completed.Add(std::move(Request));
+        }
+    }
+
+    if (SUCCEEDED(ComResult))
+    {
+        ::CoUninitialize();
+    }
+}
@@ -0,0 +1,167 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "UEContainer.h"
+#include "Enums.h"
+#include "MemoryManager.h"
+
+class UResourceBase;
+
+enum class EAsyncLoadPriority : uint8
+{
+    Low,
+    Normal,
+    High,
+};
+
+enum class EAsyncLoadState : uint8
+{
+    Queued,         // 워커 대기열
+    Loading,        // 워커에서 IO/파싱 중
+    PendingFinalize,// 메인 스레드 마무리 대기
+    Completed,
+    Failed,
+    Cancelled,
+};
+
+/**
+ * @brief 비동기 로드 요청 하나. 같은 경로의 요청은 하나의 FAsyncLoadRequest를 공유함
+ */
+struct FAsyncLoadRequest
+{
+    FString Path;
+    EResourceType ResourceType = EResourceType::None;
+    EMemoryTag MemoryTag = EMemoryTag::Default;  // 워커의 LoadAsyncData 할당을 집계할 태그
+    UResourceBase* Resource = nullptr;          // 메인 스레드에서 생성, 워커는 LoadAsyncData만 호출
+    EAsyncLoadPriority Priority = EAsyncLoadPriority::Normal; // 대기열 락으로 보호
+    uint64 Sequence = 0;                        // 같은 우선순위 안에서는 먼저 요청된 순서
+
+    bool bMainThreadOnly = false;               // 워커에서 처리할 수 없는 리소스 (메인 스레드에서 동기 Load)
+    bool bWorkerSucceeded = false;
+    std::atomic<EAsyncLoadState> State{ EAsyncLoadState::Queued };
+    std::atomic<bool> bCancelled{ false };
+
+    // 아래는 메인 스레드 전용
+    int32 HandleCount = 0;
+    std::function<bool(UResourceBase*)> SyncLoad; // 실패 시 false (bMainThreadOnly 요청은 Failed로 끝남)
+    TArray<std::function<void(UResourceBase*)>> Callbacks;
+};
+
+/**
+ * @brief LoadAsync가 반환하는 핸들. 완료 여부 확인, 결과 조회, 취소에 사용 (메인 스레드 전용)
+ *
+ * 취소하지 않은 핸들 하나가 FAsyncLoadRequest::HandleCount 하나에 대응함.
+ * 복사하면 카운트가 늘고, 이동하면 그대로 넘어가며, 소멸하면 카운트만 돌려줌 (로드는 취소하지 않음).
+ */
+class FAsyncLoadHandle
+{
+public:
+    FAsyncLoadHandle() = default;
+    explicit FAsyncLoadHandle(std::shared_ptr<FAsyncLoadRequest> InRequest);
+    FAsyncLoadHandle(const FAsyncLoadHandle& Other);
+    FAsyncLoadHandle(FAsyncLoadHandle&& Other) noexcept;
+    FAsyncLoadHandle& operator=(const FAsyncLoadHandle& Other);
+    FAsyncLoadHandle& operator=(FAsyncLoadHandle&& Other) noexcept;
+    ~FAsyncLoadHandle();
+
+    bool IsValid() const { return Request != nullptr; }
+    bool IsLoading() const;
+    bool IsCompleted() const;
+    EAsyncLoadState GetState() const;
+    UResourceBase* GetResource() const;
+
+    // 요청을 기다리는 (취소하지 않은) 핸들 수 (FAsyncLoadStressTest 검증용)
+    int32 GetNumActiveHandles() const { return Request ? Request->HandleCount : 0; }
+
+    /**
+     * @brief 이 핸들의 요청을 취소. 같은 에셋을 요청한 다른 LoadAsync 호출이 남아있으면 로드는 계속됨
+     */
+    void Cancel();
+
+protected:
+    // 이 핸들이 잡고 있는 HandleCount를 돌려주고 요청을 놓음
+    void Release();
+
+    std::shared_ptr<FAsyncLoadRequest> Request;
+    bool bCancelled = false;
+};
+
+template<typename T>
+class TAsyncLoadHandle : public FAsyncLoadHandle
+{
+public:
+    TAsyncLoadHandle() = default;
+    explicit TAsyncLoadHandle(std::shared_ptr<FAsyncLoadRequest> InRequest) : FAsyncLoadHandle(std::move(InRequest)) {}
+
+    T* Get() const { return static_cast<T*>(GetResource()); }
+
+    /**
+     * @brief 로드가 끝나기 전에는 타입별 대체 리소스를 반환 (ResourceManager.h에 정의)
+     */
+    T* GetOrPlaceholder() const;
+};
+
+/**
+ * @brief 비동기 로드 통계 (프레임 단위 + 누적)
+ */
+struct FAsyncLoadStats
+{
+    int32 NumQueued = 0;
+    int32 NumInFlight = 0;
+    int32 NumFinalizedThisFrame = 0;
+    double FinalizeTimeMS = 0.0;
+    double PeakFinalizeTimeMS = 0.0;
+
+    uint32 TotalCompleted = 0;
+    uint32 TotalFailed = 0;
+    uint32 TotalCancelled = 0;
+};
+
+/**
+ * @brief 워커 스레드 풀. 우선순위 대기열에서 요청을 꺼내 LoadAsyncData를 실행하고 완료 목록에 넣는다
+ */
+class FAsyncAssetLoader
+{
+public:
+    FAsyncAssetLoader() = default;
+    ~FAsyncAssetLoader();
+
+    /**
+     * @param InNumWorkers 0이면 하드웨어 스레드 수에 맞춰 결정
+     */
+    void Initialize(int32 InNumWorkers = 0);
+    void Shutdown();
+
+    void Enqueue(const std::shared_ptr<FAsyncLoadRequest>& InRequest);
+
+    /**
+     * @brief 대기 중인 요청의 우선순위를 올림 (이미 워커가 가져간 요청은 무시)
+     */
+    void RaisePriority(const std::shared_ptr<FAsyncLoadRequest>& InRequest, EAsyncLoadPriority InPriority);
+
+    /**
+     * @brief 워커가 처리를 끝낸 요청을 가져감 (메인 스레드)
+     */
+    void DrainCompleted(TArray<std::shared_ptr<FAsyncLoadRequest>>& OutCompleted);
+
+    int32 GetNumQueued();
+
+    static bool IsHigherPriority(const std::shared_ptr<FAsyncLoadRequest>& A, const std::shared_ptr<FAsyncLoadRequest>& B);
+
+private:
+    void WorkerLoop();
+
+    TArray<std::thread> Workers;
+
+    std::mutex QueueMutex;
+    std::condition_variable QueueCondition;
+    TArray<std::shared_ptr<FAsyncLoadRequest>> Queue;   // 힙 (우선순위 높은 요청이 front)
+    bool bStopping = false;
+
+    std::mutex CompletedMutex;
+    TArray<std::shared_ptr<FAsyncLoadRequest>> Completed;
+};
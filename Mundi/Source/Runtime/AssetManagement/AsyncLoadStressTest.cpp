@@ -0,0 +1,362 @@
+#include "pch.h"
+#include "AsyncLoadStressTest.h"
+#include "ResourceManager.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+namespace
+{
+    constexpr int32 NumRounds = 24;
+    constexpr int32 MaxRequestsPerCase = 4;     // 같은 경로에 대한 LoadAsync 호출 수 (1~4, 요청 병합)
+    constexpr int32 HandleOpsPerCase = 24;
+    constexpr double PumpTimeoutMS = 30000.0;
+
+    const char* ExistingTextures[] = { "Boom.png", "FakeLight.png", "GreenLight.png", "bum.png", "crack1.png", "KraftonLogo.jpg" };
+    const char* ExistingSounds[] = { "CGC1.wav", "Die.wav" };
+
+    // 핸들 하나에 대한 모델 (FAsyncLoadHandle의 Request/bCancelled와 같은 의미)
+    enum class EHandleModel : uint8
+    {
+        Empty,
+        Active,
+        Cancelled,
+    };
+
+    struct FStressCase
+    {
+        FString Path;
+        bool bSound = false;
+        bool bExists = false;
+
+        TArray<FAsyncLoadHandle> Handles;       // [0]은 결과 확인용으로 항상 요청을 잡고 있음 (이동/버림 대상에서 제외)
+        TArray<EHandleModel> Model;
+        int32 ActiveCount = 0;                  // 모델상 HandleCount
+        int32 NumRequests = 0;
+        bool bImmediate = false;                // 이미 로드된 리소스 (요청이 완료 상태로 시작)
+        bool bExpectCancelled = false;
+    };
+
+    struct FStressResult
+    {
+        int32 NumRequests = 0;
+        int32 NumHandleOps = 0;
+        uint32 NumCompleted = 0;
+        uint32 NumFailed = 0;
+        uint32 NumCancelled = 0;
+        uint32 NumMismatches = 0;
+        double TotalMS = 0.0;
+    };
+
+    EAsyncLoadPriority RandomPriority(FBenchmarkRandom& Random)
+    {
+        return static_cast<EAsyncLoadPriority>(Random.Next() % 3);
+    }
+
+    void ReportMismatch(FStressResult& Result, const FStressCase& Case, const char* What, int32 Expected, int32 Actual)
+    {
+        // 같은 원인의 불일치가 쏟아지지 않도록 처음 몇 개만 기록
+        if (++Result.NumMismatches <= 8)
+        {
+            UE_LOG("[error] AsyncLoadStressTest: %s mismatch on %s (expected %d, got %d)", What, Case.Path.c_str(), Expected, Actual);
+        }
+    }
+
+    template<typename T>
+    FAsyncLoadHandle RequestLoad(FStressCase& Case, int32* FiredCount, FBenchmarkRandom& Random)
+    {
+        return UResourceManager::GetInstance().LoadAsync<T>(Case.Path, RandomPriority(Random), [FiredCount](T*) { ++*FiredCount; });
+    }
+
+    // 무작위 핸들 조작 한 번 (모델도 같이 갱신)
+    void ApplyRandomHandleOp(FStressCase& Case, FBenchmarkRandom& Random)
+    {
+        TArray<FAsyncLoadHandle>& Handles = Case.Handles;
+        TArray<EHandleModel>& Model = Case.Model;
+        const int32 Index = static_cast<int32>(Random.Next() % Handles.Num());
+
+        switch (Random.Next() % 5)
+        {
+        case 0: // 복사 생성
+        {
+            if (Model[Index] == EHandleModel::Empty)
+            {
+                break;
+            }
+            FAsyncLoadHandle Copy(Handles[Index]);
+            Handles.Emplace(std::move(Copy));
+            Model.Add(Model[Index]);
+            if (Model[Index] == EHandleModel::Active)
+            {
+                ++Case.ActiveCount;
+            }
+            break;
+        }
+        case 1: // 복사 대입 (같은 요청을 잡은 핸들끼리, 자기 대입 포함)
+        {
+            const int32 Source = static_cast<int32>(Random.Next() % Handles.Num());
+            if (Model[Source] == EHandleModel::Empty)
+            {
+                break;
+            }
+            if (Model[Index] == EHandleModel::Active)
+            {
+                --Case.ActiveCount;
+            }
+            if (Model[Source] == EHandleModel::Active)
+            {
+                ++Case.ActiveCount;
+            }
+            Handles[Index] = Handles[Source];
+            Model[Index] = Model[Source];
+            break;
+        }
+        case 2: // 이동 (원본은 빈 핸들)
+        {
+            if (Index == 0)
+            {
+                break;
+            }
+            FAsyncLoadHandle Moved(std::move(Handles[Index]));
+            Handles.Emplace(std::move(Moved));
+            Model.Add(Model[Index]);
+            Model[Index] = EHandleModel::Empty;
+            break;
+        }
+        case 3: // 취소 (로드 중일 때만 효과가 있음)
+        {
+            if (Model[Index] == EHandleModel::Active && Handles[Index].IsLoading())
+            {
+                Model[Index] = EHandleModel::Cancelled;
+                if (--Case.ActiveCount <= 0)
+                {
+                    Case.bExpectCancelled = true;
+                }
+            }
+            Handles[Index].Cancel();
+            break;
+        }
+        case 4: // 버림 (카운트만 돌려주고 로드는 취소하지 않음)
+        {
+            if (Index == 0)
+            {
+                break;
+            }
+            if (Model[Index] == EHandleModel::Active)
+            {
+                --Case.ActiveCount;
+            }
+            Handles.RemoveAt(Index);
+            Model.RemoveAt(Index);
+            break;
+        }
+        }
+    }
+
+    bool PumpUntilIdle()
+    {
+        UResourceManager& ResourceManager = UResourceManager::GetInstance();
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        while (true)
+        {
+            ResourceManager.ProcessAsyncLoads(1000.0);
+            if (ResourceManager.GetAsyncLoadStats().NumInFlight == 0)
+            {
+                return true;
+            }
+            if (FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) > PumpTimeoutMS)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    void RunRound(int32 Round, FBenchmarkRandom& Random, FStressResult& Result)
+    {
+        UResourceManager& ResourceManager = UResourceManager::GetInstance();
+
+        // 실제 에셋 6개 + 없는 경로 6개 (텍스처는 워커 실패, 사운드는 메인 스레드 동기 로드 실패)
+        TArray<FStressCase> Cases;
+        for (int32 i = 0; i < 4; ++i)
+        {
+            FStressCase& Case = Cases.emplace_back();
+            Case.Path = GDataDir + "/Textures/" + ExistingTextures[(Round + i) % std::size(ExistingTextures)];
+            Case.bExists = true;
+        }
+        for (const char* Sound : ExistingSounds)
+        {
+            FStressCase& Case = Cases.emplace_back();
+            Case.Path = GDataDir + "/Audio/" + Sound;
+            Case.bSound = true;
+            Case.bExists = true;
+        }
+        for (int32 i = 0; i < 3; ++i)
+        {
+            FStressCase& Texture = Cases.emplace_back();
+            Texture.Path = GDataDir + "/AsyncLoadStress/Missing_" + std::to_string(Round) + "_" + std::to_string(i) + ".png";
+
+            FStressCase& Sound = Cases.emplace_back();
+            Sound.Path = GDataDir + "/AsyncLoadStress/Missing_" + std::to_string(Round) + "_" + std::to_string(i) + ".wav";
+            Sound.bSound = true;
+        }
+
+        TArray<int32> FiredCounts;
+        FiredCounts.SetNum(Cases.Num());
+
+        const FAsyncLoadStats StatsBefore = ResourceManager.GetAsyncLoadStats();
+
+        for (int32 CaseIndex = 0; CaseIndex < Cases.Num(); ++CaseIndex)
+        {
+            FStressCase& Case = Cases[CaseIndex];
+            Case.NumRequests = 1 + static_cast<int32>(Random.Next() % MaxRequestsPerCase);
+            for (int32 i = 0; i < Case.NumRequests; ++i)
+            {
+                int32* FiredCount = &FiredCounts[CaseIndex];
+                Case.Handles.Emplace(Case.bSound ? RequestLoad<USound>(Case, FiredCount, Random) : RequestLoad<UTexture>(Case, FiredCount, Random));
+                Case.Model.Add(EHandleModel::Active);
+            }
+            Case.ActiveCount = Case.NumRequests;
+            Case.bImmediate = !Case.Handles[0].IsLoading();
+            Result.NumRequests += Case.NumRequests;
+        }
+
+        // 여러 경로의 핸들 조작을 섞어서 수행
+        for (int32 Op = 0; Op < HandleOpsPerCase * Cases.Num(); ++Op)
+        {
+            FStressCase& Case = Cases[Random.Next() % Cases.Num()];
+            ApplyRandomHandleOp(Case, Random);
+            ++Result.NumHandleOps;
+
+            const int32 Actual = Case.Handles[0].GetNumActiveHandles();
+            if (Actual != Case.ActiveCount)
+            {
+                ReportMismatch(Result, Case, "HandleCount", Case.ActiveCount, Actual);
+            }
+        }
+
+        if (!PumpUntilIdle())
+        {
+            UE_LOG("[error] AsyncLoadStressTest: round %d did not finish within %.0f ms", Round, PumpTimeoutMS);
+            ++Result.NumMismatches;
+            return;
+        }
+
+        uint32 ExpectedCompleted = 0;
+        uint32 ExpectedFailed = 0;
+        uint32 ExpectedCancelled = 0;
+        for (int32 CaseIndex = 0; CaseIndex < Cases.Num(); ++CaseIndex)
+        {
+            const FStressCase& Case = Cases[CaseIndex];
+            EAsyncLoadState ExpectedState = EAsyncLoadState::Completed;
+            if (Case.bExpectCancelled)
+            {
+                ExpectedState = EAsyncLoadState::Cancelled;
+            }
+            else if (!Case.bExists)
+            {
+                ExpectedState = EAsyncLoadState::Failed;
+            }
+
+            if (!Case.bImmediate)
+            {
+                ExpectedCompleted += ExpectedState == EAsyncLoadState::Completed ? 1 : 0;
+                ExpectedFailed += ExpectedState == EAsyncLoadState::Failed ? 1 : 0;
+                ExpectedCancelled += ExpectedState == EAsyncLoadState::Cancelled ? 1 : 0;
+            }
+
+            const FAsyncLoadHandle& Anchor = Case.Handles[0];
+            if (Anchor.GetState() != ExpectedState)
+            {
+                ReportMismatch(Result, Case, "State", static_cast<int32>(ExpectedState), static_cast<int32>(Anchor.GetState()));
+            }
+            if ((Anchor.GetResource() != nullptr) != (ExpectedState == EAsyncLoadState::Completed))
+            {
+                ReportMismatch(Result, Case, "Resource", ExpectedState == EAsyncLoadState::Completed, Anchor.GetResource() != nullptr);
+            }
+
+            // 취소된 요청의 콜백은 버려지고, 나머지는 LoadAsync 호출마다 한 번씩 불림
+            const int32 ExpectedFired = ExpectedState == EAsyncLoadState::Cancelled ? 0 : Case.NumRequests;
+            if (FiredCounts[CaseIndex] != ExpectedFired)
+            {
+                ReportMismatch(Result, Case, "Callbacks", ExpectedFired, FiredCounts[CaseIndex]);
+            }
+        }
+
+        const FAsyncLoadStats& StatsAfter = ResourceManager.GetAsyncLoadStats();
+        const uint32 Completed = StatsAfter.TotalCompleted - StatsBefore.TotalCompleted;
+        const uint32 Failed = StatsAfter.TotalFailed - StatsBefore.TotalFailed;
+        const uint32 Cancelled = StatsAfter.TotalCancelled - StatsBefore.TotalCancelled;
+        if (Completed != ExpectedCompleted || Failed != ExpectedFailed || Cancelled != ExpectedCancelled)
+        {
+            UE_LOG("[error] AsyncLoadStressTest: round %d stats completed/failed/cancelled %u/%u/%u (expected %u/%u/%u)",
+                Round, Completed, Failed, Cancelled, ExpectedCompleted, ExpectedFailed, ExpectedCancelled);
+            ++Result.NumMismatches;
+        }
+        Result.NumCompleted += Completed;
+        Result.NumFailed += Failed;
+        Result.NumCancelled += Cancelled;
+    }
+
+    void WriteReport(const FString& ReportPath, const FStressResult& Result)
+    {
+        if (ReportPath.empty())
+        {
+            return;
+        }
+
+        std::ofstream File(UTF8ToWide(ReportPath));
+        if (!File.is_open())
+        {
+            UE_LOG("[error] AsyncLoadStressTest: failed to open %s", ReportPath.c_str());
+            return;
+        }
+        File.setf(std::ios::fixed);
+        File.precision(4);
+
+        File << "{\n"
+            << "  \"rounds\": " << NumRounds << ",\n"
+            << "  \"requests\": " << Result.NumRequests << ",\n"
+            << "  \"handleOps\": " << Result.NumHandleOps << ",\n"
+            << "  \"completed\": " << Result.NumCompleted << ",\n"
+            << "  \"failed\": " << Result.NumFailed << ",\n"
+            << "  \"cancelled\": " << Result.NumCancelled << ",\n"
+            << "  \"mismatches\": " << Result.NumMismatches << ",\n"
+            << "  \"totalMS\": " << Result.TotalMS << "\n"
+            << "}\n";
+        UE_LOG("[AsyncLoadStressTest] report -> %s", ReportPath.c_str());
+    }
+}
+
+void FAsyncLoadStressTest::RunAndLog(const FString& ReportPath)
+{
+    // 이전에 걸려 있던 요청이 통계에 섞이지 않도록 먼저 비움
+    if (!PumpUntilIdle())
+    {
+        UE_LOG("[error] AsyncLoadStressTest: pending async loads did not finish");
+        return;
+    }
+
+    FBenchmarkRandom Random;
+    FStressResult Result;
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    for (int32 Round = 0; Round < NumRounds; ++Round)
+    {
+        RunRound(Round, Random, Result);
+    }
+    Result.TotalMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+    UE_LOG("[AsyncLoadStressTest] rounds %d, requests %d, handle ops %d, completed/failed/cancelled %u/%u/%u, %.2f ms -> %s",
+        NumRounds, Result.NumRequests, Result.NumHandleOps, Result.NumCompleted, Result.NumFailed, Result.NumCancelled,
+        Result.TotalMS, Result.NumMismatches == 0 ? "PASS" : "FAIL");
+
+    WriteReport(ReportPath, Result);
+}
+
+// 비동기 로드 스트레스 테스트는 리소스 매니저(텍스처 생성용 디바이스)만 필요
+static const bool bAsyncLoadStressTestRegistered = FBenchmarkRegistry::Register({
+    "ASYNCLOAD STRESS", "-asyncloadstress", "async load handle stress test", EBenchmarkStage::Device,
+    [](const FString& ReportPath) { FAsyncLoadStressTest::RunAndLog(ReportPath); } });
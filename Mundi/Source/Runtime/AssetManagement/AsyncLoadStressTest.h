@@ -0,0 +1,17 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 비동기 로드 핸들 스트레스 테스트 (콘솔 ASYNCLOAD STRESS 명령, 헤드리스 -asyncloadstress)
+ *
+ * 라운드마다 실제 텍스처/사운드와 존재하지 않는 경로를 섞어 LoadAsync를 여러 번 호출하고,
+ * 얻은 핸들을 무작위로 복사/대입/이동/취소/버리면서 핸들 모델과 FAsyncLoadRequest::HandleCount가 같은지 검사합니다.
+ * 로드가 모두 끝나면 요청 상태(Completed/Failed/Cancelled)와 콜백 호출 수가 모델과 일치하는지 확인합니다.
+ * 존재하지 않는 .wav는 메인 스레드 동기 로드 실패 경로, .png는 워커 로드 실패 경로를 검사합니다.
+ */
+class FAsyncLoadStressTest
+{
+public:
+    /** @param ReportPath 비어 있지 않으면 결과를 JSON으로도 저장 */
+    static void RunAndLog(const FString& ReportPath = "");
+};
@@ -0,0 +1,283 @@
+#include "pch.h"
+#include "MeshCacheBenchmark.h"
+#include "MappedFileReader.h"
+#include "CacheFileHeader.h"
+#include "WindowsBinReader.h"
+#include "VertexData.h"
+#include "PathUtils.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr int32 NumColdRuns = 3;
+    constexpr int32 NumWarmRuns = 5;
+
+    enum class EMeshCacheKind : uint8
+    {
+        Static,     // .obj.bin -> FStaticMesh
+        Skeletal,   // .fbx.bin -> FSkeletalMeshData
+    };
+
+    struct FCacheResult
+    {
+        FString Path;
+        EMeshCacheKind Kind = EMeshCacheKind::Static;
+        uint64 Bytes = 0;
+        uint32 NumVertices = 0;
+        double StreamColdMS = 0.0;
+        double MappedColdMS = 0.0;
+        double StreamWarmMS = 0.0;
+        double MappedWarmMS = 0.0;
+        bool bEvicted = true;       // 콜드 측정 전 OS 파일 캐시에서 내보내기에 성공했는지
+        bool bValid = true;         // 두 리더가 같은 정점 수를 읽었는지
+    };
+
+    /**
+     * @brief 파일의 페이지를 OS 파일 캐시에서 내보냄 (다음 읽기가 디스크에서 오도록)
+     */
+    bool EvictFromFileCache(const FString& Path)
+    {
+#ifdef _WIN32
+        // 버퍼링 없이 열면 캐시 관리자가 이 파일의 캐시된 페이지를 비움 (캐시를 쓰는 다른 핸들이 없을 때)
+        HANDLE File = ::CreateFileW(UTF8ToWide(Path).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+            OPEN_EXISTING, FILE_FLAG_NO_BUFFERING, nullptr);
+        if (File == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+        ::CloseHandle(File);
+        return true;
+#else
+        const int FileDescriptor = ::open(Path.c_str(), O_RDONLY);
+        if (FileDescriptor < 0)
+        {
+            return false;
+        }
+        const bool bEvicted = ::posix_fadvise(FileDescriptor, 0, 0, POSIX_FADV_DONTNEED) == 0;
+        ::close(FileDescriptor);
+        return bEvicted;
+#endif
+    }
+
+    // 캐시 매핑 도입 전 경로: 스트림 버퍼를 거쳐 모든 배열을 복사 (체크섬 검증 없음)
+    template<typename TMeshData>
+    uint32 LoadWithStream(const FString& Path)
+    {
+        FWindowsBinReader Reader(Path);
+        if (!Reader.IsOpen())
+        {
+            return 0;
+        }
+        FCacheFileHeader Header;
+        Reader << Header;
+
+        TMeshData MeshData;
+        Reader << MeshData;
+        return static_cast<uint32>(MeshData.Vertices.size());
+    }
+
+    // 현재 로더 경로: 메모리 매핑 + 헤더 버전/크기/체크섬 검증 + 매핑에서 바로 배열 복사
+    template<typename TMeshData>
+    uint32 LoadWithMapping(const FString& Path)
+    {
+        FMappedFileReader Reader(Path);
+        if (!Reader.IsOpen())
+        {
+            return 0;
+        }
+
+        // 캐시 종류별 버전은 로더 내부 상수이므로 파일에 기록된 버전으로 검증
+        FCacheFileHeader Header;
+        Reader << Header;
+        Reader.Seek(0);
+        CacheFile::ReadHeader(Reader, Header.Version);
+
+        TMeshData MeshData;
+        Reader << MeshData;
+        return static_cast<uint32>(MeshData.Vertices.size());
+    }
+
+    template<typename TMeshData>
+    void MeasureCache(FCacheResult& Result)
+    {
+        uint32 StreamVertices = 0;
+        uint32 MappedVertices = 0;
+
+        // 콜드: 매 실행 전에 파일 캐시에서 내보냄 (두 리더를 번갈아 측정)
+        for (int32 Run = 0; Run < NumColdRuns; ++Run)
+        {
+            Result.bEvicted &= EvictFromFileCache(Result.Path);
+            Result.StreamColdMS += MeasureMS([&]() { StreamVertices = LoadWithStream<TMeshData>(Result.Path); });
+
+            Result.bEvicted &= EvictFromFileCache(Result.Path);
+            Result.MappedColdMS += MeasureMS([&]() { MappedVertices = LoadWithMapping<TMeshData>(Result.Path); });
+        }
+
+        // 웜: 한 번 읽어 파일 캐시에 올린 뒤 측정
+        LoadWithMapping<TMeshData>(Result.Path);
+        for (int32 Run = 0; Run < NumWarmRuns; ++Run)
+        {
+            Result.StreamWarmMS += MeasureMS([&]() { StreamVertices = LoadWithStream<TMeshData>(Result.Path); });
+            Result.MappedWarmMS += MeasureMS([&]() { MappedVertices = LoadWithMapping<TMeshData>(Result.Path); });
+        }
+
+        Result.StreamColdMS /= NumColdRuns;
+        Result.MappedColdMS /= NumColdRuns;
+        Result.StreamWarmMS /= NumWarmRuns;
+        Result.MappedWarmMS /= NumWarmRuns;
+        Result.NumVertices = MappedVertices;
+        Result.bValid = StreamVertices == MappedVertices;
+    }
+
+    bool EndsWithNoCase(const FString& Str, const char* Suffix)
+    {
+        const size_t SuffixLength = strlen(Suffix);
+        return Str.length() >= SuffixLength && _stricmp(Str.c_str() + Str.length() - SuffixLength, Suffix) == 0;
+    }
+
+    void CollectCacheFiles(TArray<FCacheResult>& OutResults)
+    {
+        const fs::path CacheDir(UTF8ToWide(GCacheDir));
+        if (!fs::exists(CacheDir) || !fs::is_directory(CacheDir))
+        {
+            return;
+        }
+
+        for (const auto& Entry : fs::recursive_directory_iterator(CacheDir))
+        {
+            if (!Entry.is_regular_file())
+            {
+                continue;
+            }
+
+            const FString Path = NormalizePath(WideToUTF8(Entry.path().wstring()));
+            FCacheResult Result;
+            if (EndsWithNoCase(Path, ".obj.bin"))
+            {
+                Result.Kind = EMeshCacheKind::Static;
+            }
+            else if (EndsWithNoCase(Path, ".fbx.bin"))
+            {
+                Result.Kind = EMeshCacheKind::Skeletal;
+            }
+            else
+            {
+                continue;   // .mat.bin, 텍스처 캐시 등
+            }
+            Result.Path = Path;
+            Result.Bytes = static_cast<uint64>(Entry.file_size());
+            OutResults.Add(Result);
+        }
+    }
+
+    double Ratio(double Baseline, double Value)
+    {
+        return Value > 0.0 ? Baseline / Value : 0.0;
+    }
+
+    void WriteReport(const FString& ReportPath, const TArray<FCacheResult>& Results)
+    {
+        std::ofstream File(UTF8ToWide(ReportPath));
+        if (!File.is_open())
+        {
+            UE_LOG("[error] MeshCacheBenchmark: failed to open %s", ReportPath.c_str());
+            return;
+        }
+        File.setf(std::ios::fixed);
+        File.precision(4);
+
+        File << "{\n  \"coldRuns\": " << NumColdRuns << ",\n  \"warmRuns\": " << NumWarmRuns << ",\n  \"caches\": [";
+        for (int32 Index = 0; Index < Results.Num(); ++Index)
+        {
+            const FCacheResult& Result = Results[Index];
+            File << (Index == 0 ? "\n" : ",\n")
+                << "    { \"path\": \"" << Result.Path << "\""
+                << ", \"kind\": \"" << (Result.Kind == EMeshCacheKind::Static ? "static" : "skeletal") << "\""
+                << ", \"bytes\": " << Result.Bytes
+                << ", \"vertices\": " << Result.NumVertices
+                << ", \"streamColdMS\": " << Result.StreamColdMS
+                << ", \"mappedColdMS\": " << Result.MappedColdMS
+                << ", \"streamWarmMS\": " << Result.StreamWarmMS
+                << ", \"mappedWarmMS\": " << Result.MappedWarmMS
+                << ", \"evicted\": " << (Result.bEvicted ? "true" : "false")
+                << ", \"valid\": " << (Result.bValid ? "true" : "false") << " }";
+        }
+        File << "\n  ]\n}\n";
+        UE_LOG("[MeshCacheBenchmark] report -> %s", ReportPath.c_str());
+    }
+}
+
+void FMeshCacheBenchmark::RunAndLog(const FString& ReportPath)
+{
+    TArray<FCacheResult> Results;
+    CollectCacheFiles(Results);
+    if (Results.IsEmpty())
+    {
+        UE_LOG("[MeshCacheBenchmark] no .obj.bin/.fbx.bin caches under %s (load Data/ meshes first)", GCacheDir.c_str());
+        return;
+    }
+
+    UE_LOG("[MeshCacheBenchmark] %d caches, cold x%d / warm x%d (ms, average)", Results.Num(), NumColdRuns, NumWarmRuns);
+    UE_LOG("[MeshCacheBenchmark] %10s %10s %10s %10s %10s %s", "KB", "stream(c)", "mapped(c)", "stream(w)", "mapped(w)", "Cache");
+
+    FCacheResult Total;
+    uint32 NumFailed = 0;
+    for (FCacheResult& Result : Results)
+    {
+        try
+        {
+            if (Result.Kind == EMeshCacheKind::Static)
+            {
+                MeasureCache<FStaticMesh>(Result);
+            }
+            else
+            {
+                MeasureCache<FSkeletalMeshData>(Result);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            // 오래되었거나 손상된 캐시 (로더라면 삭제 후 재생성)
+            UE_LOG("[MeshCacheBenchmark] skip %s: %s", Result.Path.c_str(), e.what());
+            Result.bValid = false;
+            ++NumFailed;
+            continue;
+        }
+
+        UE_LOG("[MeshCacheBenchmark] %10.1f %10.3f %10.3f %10.3f %10.3f %s%s%s", Result.Bytes / 1024.0,
+            Result.StreamColdMS, Result.MappedColdMS, Result.StreamWarmMS, Result.MappedWarmMS, Result.Path.c_str(),
+            Result.bEvicted ? "" : " (not evicted)", Result.bValid ? "" : " (vertex count mismatch)");
+
+        Total.Bytes += Result.Bytes;
+        Total.StreamColdMS += Result.StreamColdMS;
+        Total.MappedColdMS += Result.MappedColdMS;
+        Total.StreamWarmMS += Result.StreamWarmMS;
+        Total.MappedWarmMS += Result.MappedWarmMS;
+        Total.bEvicted &= Result.bEvicted;
+        NumFailed += Result.bValid ? 0 : 1;
+    }
+
+    UE_LOG("[MeshCacheBenchmark] total %.1f KB: cold stream %.3f / mapped %.3f ms (%.2fx), warm stream %.3f / mapped %.3f ms (%.2fx)%s -> %s",
+        Total.Bytes / 1024.0,
+        Total.StreamColdMS, Total.MappedColdMS, Ratio(Total.StreamColdMS, Total.MappedColdMS),
+        Total.StreamWarmMS, Total.MappedWarmMS, Ratio(Total.StreamWarmMS, Total.MappedWarmMS),
+        Total.bEvicted ? "" : " (some caches could not be evicted, cold numbers may be warm)",
+        NumFailed == 0 ? "PASS" : "FAIL");
+
+    if (!ReportPath.empty())
+    {
+        WriteReport(ReportPath, Results);
+    }
+}
+
+// 메시 캐시 벤치마크는 프리로드가 만든 .bin 캐시만 사용
+static const bool bMeshCacheBenchmarkRegistered = FBenchmarkRegistry::Register({
+    "MESHCACHE BENCH", "-meshcachebench", "mesh cache load benchmark (stream vs mapped, cold/warm)", EBenchmarkStage::Preload,
+    [](const FString& ReportPath) { FMeshCacheBenchmark::RunAndLog(ReportPath); } });
@@ -0,0 +1,17 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 메시 캐시 로드 벤치마크 (콘솔 MESHCACHE BENCH 명령, 헤드리스 -meshcachebench)
+ *
+ * DerivedDataCache의 .obj.bin(FStaticMesh)/.fbx.bin(FSkeletalMeshData) 캐시를
+ * 스트림 리더(FWindowsBinReader)와 메모리 매핑 리더(FMappedFileReader + 헤더 체크섬 검증)로 각각 읽어
+ * 콜드(OS 파일 캐시에서 내보낸 직후)/웜(직전에 읽은 상태) 로드 시간을 비교합니다.
+ * 캐시는 Data/ 메시를 한 번 로드해야 생기므로 FObjManager::Preload 이후에 실행합니다.
+ */
+class FMeshCacheBenchmark
+{
+public:
+    /** @param ReportPath 비어 있지 않으면 파일별 결과를 JSON으로도 저장 */
+    static void RunAndLog(const FString& ReportPath = "");
+};
@@ -18,6 +18,16 @@ public:
 	std::filesystem::file_time_type GetLastModifiedTime() const { return LastModifiedTime; }
 	void SetLastModifiedTime(std::filesystem::file_time_type InTime) { LastModifiedTime = InTime; }
 
+	// Async Load Support (UResourceManager::LoadAsync)
+	// 워커 스레드에서 IO/파싱을 수행할 수 있는 리소스인지 (false면 메인 스레드에서 동기 Load)
+	virtual bool SupportsAsyncLoad(const FString& InFilePath) const { return false; }
+	// 워커 스레드: 디바이스 객체/UObject 생성 없이 CPU 데이터만 준비
+	virtual bool LoadAsyncData(const FString& InFilePath) { return false; }
+	// 메인 스레드: 준비된 데이터로 GPU 리소스 생성
+	virtual void FinalizeAsyncLoad(ID3D11Device* InDevice) {}
+	// 취소/실패 시 워커가 준비한 데이터 해제
+	virtual void DiscardAsyncLoad() {}
+
 protected:
 	FString FilePath;	// 원본 파일의 경로이자, UResourceManager에 등록된 Key 
 	std::filesystem::file_time_type LastModifiedTime;
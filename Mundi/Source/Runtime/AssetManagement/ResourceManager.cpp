@@ -7,6 +7,7 @@
 #include "Quad.h"
 #include "MeshBVH.h"
 #include "Enums.h"
+#include "PlatformTime.h"
 
 #include <filesystem>
 #include <cwctype>
@@ -49,11 +50,15 @@ void UResourceManager::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* I
     CreateTextBillboardTexture();
     CreateDefaultShader();
     CreateDefaultMaterial();
+
+    AsyncLoader.Initialize();
 }
 
 // 전체 해제
 void UResourceManager::Clear()
 {
+    ShutdownAsyncLoads();
+
     {////////////// Deprecated //////////////
         for (auto& [Key, Data] : ResourceMap)
         {
@@ -123,6 +128,182 @@ void UResourceManager::Clear()
     // Instance lifetime is managed by ObjectFactory
 }
 
+FString UResourceManager::MakeAsyncRequestKey(EResourceType InType, const FString& InNormalizedPath)
+{
+    return std::to_string(static_cast<uint8>(InType)) + ":" + InNormalizedPath;
+}
+
+EMemoryTag UResourceManager::GetMemoryTag(EResourceType InType)
+{
+    switch (InType)
+    {
+    case EResourceType::StaticMesh:
+    case EResourceType::SkeletalMesh:
+    case EResourceType::Quad:
+    case EResourceType::DynamicMesh:
+        return EMemoryTag::Mesh;
+    case EResourceType::Shader:
+        return EMemoryTag::Shader;
+    case EResourceType::Texture:
+        return EMemoryTag::Texture;
+    case EResourceType::Material:
+        return EMemoryTag::Material;
+    case EResourceType::Sound:
+        return EMemoryTag::Audio;
+    case EResourceType::Animation:
+        return EMemoryTag::Animation;
+    case EResourceType::ParticleSystem:
+        return EMemoryTag::Particles;
+    default:
+        return EMemoryTag::Default;
+    }
+}
+
+void UResourceManager::ProcessAsyncLoads(double InTimeBudgetMS)
+{
+    AsyncLoadStats.NumFinalizedThisFrame = 0;
+    AsyncLoadStats.FinalizeTimeMS = 0.0;
+
+    AsyncLoader.DrainCompleted(PendingFinalizeRequests);
+
+    if (!PendingFinalizeRequests.IsEmpty())
+    {
+        std::stable_sort(PendingFinalizeRequests.begin(), PendingFinalizeRequests.end(), &FAsyncAssetLoader::IsHigherPriority);
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        int32 NumProcessed = 0;
+        for (; NumProcessed < PendingFinalizeRequests.Num(); ++NumProcessed)
+        {
+            // 한 프레임에 최소 한 개는 처리하고, 이후로는 시간 예산 안에서만 마무리 (프레임 스파이크 방지)
+            if (NumProcessed > 0 && FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) >= InTimeBudgetMS)
+            {
+                break;
+            }
+            FinalizeAsyncRequest(PendingFinalizeRequests[NumProcessed]);
+        }
+        PendingFinalizeRequests.erase(PendingFinalizeRequests.begin(), PendingFinalizeRequests.begin() + NumProcessed);
+
+        AsyncLoadStats.NumFinalizedThisFrame = NumProcessed;
+        AsyncLoadStats.FinalizeTimeMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+        AsyncLoadStats.PeakFinalizeTimeMS = std::max(AsyncLoadStats.PeakFinalizeTimeMS, AsyncLoadStats.FinalizeTimeMS);
+        AsyncBatchPeakMS = std::max(AsyncBatchPeakMS, AsyncLoadStats.FinalizeTimeMS);
+    }
+
+    AsyncLoadStats.NumQueued = AsyncLoader.GetNumQueued();
+    AsyncLoadStats.NumInFlight = AsyncLoadRequests.Num();
+
+    // 대기열이 모두 비면 이번 묶음의 결과를 기록 (대량 스트리밍 시 프레임당 최대 마무리 시간 확인용)
+    if (AsyncBatchCount > 0 && AsyncLoadRequests.IsEmpty())
+    {
+        UE_LOG("[AsyncLoad] Streamed %u assets (peak finalize %.2f ms/frame)", AsyncBatchCount, AsyncBatchPeakMS);
+        AsyncBatchCount = 0;
+        AsyncBatchPeakMS = 0.0;
+    }
+}
+
+void UResourceManager::FinalizeAsyncRequest(const std::shared_ptr<FAsyncLoadRequest>& InRequest)
+{
+    const FString RequestKey = MakeAsyncRequestKey(InRequest->ResourceType, InRequest->Path);
+    if (std::shared_ptr<FAsyncLoadRequest>* Found = AsyncLoadRequests.Find(RequestKey))
+    {
+        // 취소 후 같은 경로로 새 요청이 들어왔을 수 있으므로 같은 요청일 때만 제거
+        if (*Found == InRequest)
+        {
+            AsyncLoadRequests.Remove(RequestKey);
+        }
+    }
+
+    UResourceBase* Resource = InRequest->Resource;
+    auto DiscardResource = [&]()
+    {
+        if (Resource)
+        {
+            Resource->DiscardAsyncLoad();
+            DeleteObject(Resource);
+        }
+        InRequest->Resource = nullptr;
+    };
+
+    if (InRequest->bCancelled.load())
+    {
+        DiscardResource();
+        InRequest->State = EAsyncLoadState::Cancelled;
+        InRequest->Callbacks.Empty();
+        ++AsyncLoadStats.TotalCancelled;
+        return;
+    }
+
+    const uint8 typeIndex = static_cast<uint8>(InRequest->ResourceType);
+    auto iter = Resources[typeIndex].find(InRequest->Path);
+    if (iter != Resources[typeIndex].end())
+    {
+        // 로드 도중 동기 Load가 같은 리소스를 먼저 만들었으면 그쪽을 사용
+        DiscardResource();
+        InRequest->Resource = iter->second;
+    }
+    else
+    {
+        bool bLoaded = InRequest->bWorkerSucceeded;
+        if (InRequest->bMainThreadOnly || bLoaded)
+        {
+            FScopedMemoryTag MemTag(GetMemoryTag(InRequest->ResourceType));
+            Resource->SetFilePath(InRequest->Path);
+            if (InRequest->bMainThreadOnly)
+            {
+                bLoaded = InRequest->SyncLoad(Resource);
+            }
+            else
+            {
+                Resource->FinalizeAsyncLoad(Device);
+            }
+        }
+
+        if (bLoaded)
+        {
+            Resources[typeIndex][InRequest->Path] = Resource;
+        }
+        else
+        {
+            UE_LOG("[error] AsyncLoad: Failed to load %s", InRequest->Path.c_str());
+            DiscardResource();
+            InRequest->State = EAsyncLoadState::Failed;
+            ++AsyncLoadStats.TotalFailed;
+        }
+    }
+
+    if (InRequest->State.load() != EAsyncLoadState::Failed)
+    {
+        InRequest->State = EAsyncLoadState::Completed;
+        ++AsyncLoadStats.TotalCompleted;
+    }
+
+    for (const std::function<void(UResourceBase*)>& Callback : InRequest->Callbacks)
+    {
+        Callback(InRequest->Resource);
+    }
+    InRequest->Callbacks.Empty();
+}
+
+void UResourceManager::ShutdownAsyncLoads()
+{
+    // 워커를 먼저 멈춰야 로드 중인 리소스를 안전하게 삭제할 수 있음
+    AsyncLoader.Shutdown();
+    AsyncLoader.DrainCompleted(PendingFinalizeRequests);
+
+    for (auto& Pair : AsyncLoadRequests)
+    {
+        Pair.second->bCancelled = true;
+    }
+    for (const std::shared_ptr<FAsyncLoadRequest>& Request : PendingFinalizeRequests)
+    {
+        Request->bCancelled = true;
+        FinalizeAsyncRequest(Request);
+    }
+    PendingFinalizeRequests.Empty();
+    AsyncLoadRequests.Empty();
+    AsyncBatchCount = 0;
+}
+
 FMeshBVH* UResourceManager::GetMeshBVH(const FString& ObjPath)
 {
     if (auto* Found = MeshBVHCache.Find(ObjPath))
@@ -713,6 +894,7 @@ FTextureData* UResourceManager::CreateOrGetTextureData(const FWideString& FilePa
         return it->second;
     }
 
+    FScopedMemoryTag MemTag(EMemoryTag::Texture);
     FTextureData* Data = new FTextureData();
 
     // 확장자 판별 (안전)
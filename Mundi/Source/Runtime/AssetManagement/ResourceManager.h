@@ -13,6 +13,7 @@
 #include "SkeletalMesh.h"
 #include "AnimSequence.h"
 #include "../Engine/Particles/ParticleSystem.h"
+#include "AsyncAssetLoader.h"
 // ... 기타 include ...
 
 // --- 전방 선언 ---
@@ -43,6 +44,27 @@ public:
 	template<typename T, typename... Args>
 	T* Load(const FString& InFilePath, Args&&... InArgs);
 
+	/**
+	 * @brief 리소스를 비동기로 로드. IO/파싱은 워커 스레드, GPU 리소스 생성은 ProcessAsyncLoads에서 수행
+	 * @param InPriority 대기열 우선순위 (같은 경로의 진행 중인 요청과 합쳐지면 높은 쪽으로 갱신)
+	 * @param OnLoaded 메인 스레드에서 완료 시 호출 (실패하면 nullptr)
+	 */
+	template<typename T>
+	TAsyncLoadHandle<T> LoadAsync(const FString& InFilePath, EAsyncLoadPriority InPriority = EAsyncLoadPriority::Normal, std::function<void(T*)> OnLoaded = nullptr);
+
+	/**
+	 * @brief 워커가 끝낸 요청을 시간 예산 안에서 마무리 (메인 스레드, 매 프레임)
+	 */
+	void ProcessAsyncLoads(double InTimeBudgetMS = 2.0);
+	void ShutdownAsyncLoads();
+	const FAsyncLoadStats& GetAsyncLoadStats() const { return AsyncLoadStats; }
+
+	// 로드가 끝나기 전 TAsyncLoadHandle::GetOrPlaceholder가 반환할 리소스
+	template<typename T>
+	void SetAsyncPlaceholder(T* InPlaceholder);
+	template<typename T>
+	T* GetAsyncPlaceholder();
+
 	template<typename T>
 	bool Add(const FString& InFilePath, UObject* InObject);
 
@@ -62,6 +84,9 @@ public:
 	template<typename T>
 	EResourceType GetResourceType();
 
+	// 리소스 종류별 메모리 통계 태그 (FMemoryManager)
+	static EMemoryTag GetMemoryTag(EResourceType InType);
+
 	// --- 헬퍼 및 유틸리티 ---
 	ID3D11Device* GetDevice() { return Device; }
 	ID3D11DeviceContext* GetDeviceContext() { return Context; }
@@ -141,6 +166,19 @@ private:
 	// Shader Hot Reload
 	float ShaderCheckTimer = 0.0f;
 	const float ShaderCheckInterval = 0.5f; // Check every 0.5 seconds
+
+	// Async Load
+	static FString MakeAsyncRequestKey(EResourceType InType, const FString& InNormalizedPath);
+	void FinalizeAsyncRequest(const std::shared_ptr<FAsyncLoadRequest>& InRequest);
+
+	FAsyncAssetLoader AsyncLoader;
+	TMap<FString, std::shared_ptr<FAsyncLoadRequest>> AsyncLoadRequests;	// 진행 중인 요청 (중복 요청 병합)
+	TArray<std::shared_ptr<FAsyncLoadRequest>> PendingFinalizeRequests;
+	TMap<EResourceType, UResourceBase*> AsyncPlaceholders;
+	FAsyncLoadStats AsyncLoadStats;
+	uint64 AsyncLoadSequence = 0;
+	uint32 AsyncBatchCount = 0;		// 대기열이 빌 때까지 처리된 요청 수 (완료 로그용)
+	double AsyncBatchPeakMS = 0.0;
 };
 
 //-----definition
@@ -218,6 +256,7 @@ inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 	}
 	else//없으면 해당 리소스의 Load실행
 	{
+		FScopedMemoryTag MemTag(GetMemoryTag(GetResourceType<T>()));
 		T* Resource = NewObject<T>();
 		Resource->Load(NormalizedPath, Device, std::forward<Args>(InArgs)...);
 		Resource->SetFilePath(NormalizedPath);
@@ -226,6 +265,145 @@ inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 	}
 }
 
+template<typename T>
+TAsyncLoadHandle<T> UResourceManager::LoadAsync(const FString& InFilePath, EAsyncLoadPriority InPriority, std::function<void(T*)> OnLoaded)
+{
+	if (InFilePath.empty())
+	{
+		return TAsyncLoadHandle<T>();
+	}
+
+	// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
+	FString NormalizedPath = NormalizePath(InFilePath);
+	const EResourceType Type = GetResourceType<T>();
+	const uint8 typeIndex = static_cast<uint8>(Type);
+
+	std::function<void(UResourceBase*)> Callback;
+	if (OnLoaded)
+	{
+		Callback = [OnLoaded](UResourceBase* InResource) { OnLoaded(static_cast<T*>(InResource)); };
+	}
+
+	// 1. 이미 로드된 리소스는 완료된 핸들로 즉시 반환
+	auto iter = Resources[typeIndex].find(NormalizedPath);
+	if (iter != Resources[typeIndex].end())
+	{
+		std::shared_ptr<FAsyncLoadRequest> Request = std::make_shared<FAsyncLoadRequest>();
+		Request->Path = NormalizedPath;
+		Request->ResourceType = Type;
+		Request->Resource = iter->second;
+		Request->State = EAsyncLoadState::Completed;
+		if (Callback)
+		{
+			Callback(iter->second);
+		}
+		return TAsyncLoadHandle<T>(Request);
+	}
+
+	// 2. 같은 경로로 진행 중인 요청이 있으면 합침
+	const FString RequestKey = MakeAsyncRequestKey(Type, NormalizedPath);
+	if (std::shared_ptr<FAsyncLoadRequest>* InFlight = AsyncLoadRequests.Find(RequestKey))
+	{
+		std::shared_ptr<FAsyncLoadRequest> Request = *InFlight;
+		if (!Request->bCancelled.load())
+		{
+			if (Callback)
+			{
+				Request->Callbacks.Add(Callback);
+			}
+			if (!Request->bMainThreadOnly)
+			{
+				AsyncLoader.RaisePriority(Request, InPriority);
+			}
+			else if (Request->Priority < InPriority)
+			{
+				Request->Priority = InPriority;
+			}
+			return TAsyncLoadHandle<T>(Request);
+		}
+		// 취소된 요청은 ProcessAsyncLoads에서 정리되고, 새 요청이 맵을 대신 차지함
+	}
+
+	// 3. 새 요청 (FilePath는 마무리 시점에 설정: 로드 중인 객체가 경로 검색에 걸리지 않도록)
+	FScopedMemoryTag MemTag(GetMemoryTag(Type));
+	T* Resource = NewObject<T>();
+
+	std::shared_ptr<FAsyncLoadRequest> Request = std::make_shared<FAsyncLoadRequest>();
+	Request->Path = NormalizedPath;
+	Request->ResourceType = Type;
+	Request->MemoryTag = GetMemoryTag(Type);
+	Request->Resource = Resource;
+	Request->Priority = InPriority;
+	Request->Sequence = ++AsyncLoadSequence;
+	Request->bMainThreadOnly = !Resource->SupportsAsyncLoad(NormalizedPath);
+	Request->SyncLoad = [this](UResourceBase* InResource) -> bool
+	{
+		T* Typed = static_cast<T*>(InResource);
+		if constexpr (std::is_same_v<decltype(Typed->Load(InResource->GetFilePath(), Device)), bool>)
+		{
+			return Typed->Load(InResource->GetFilePath(), Device);
+		}
+		else
+		{
+			Typed->Load(InResource->GetFilePath(), Device);
+			return true;
+		}
+	};
+	if (Callback)
+	{
+		Request->Callbacks.Add(Callback);
+	}
+
+	AsyncLoadRequests[RequestKey] = Request;
+	++AsyncBatchCount;
+
+	if (Request->bMainThreadOnly)
+	{
+		Request->State = EAsyncLoadState::PendingFinalize;
+		PendingFinalizeRequests.Add(Request);
+	}
+	else
+	{
+		AsyncLoader.Enqueue(Request);
+	}
+
+	return TAsyncLoadHandle<T>(Request);
+}
+
+template<typename T>
+void UResourceManager::SetAsyncPlaceholder(T* InPlaceholder)
+{
+	AsyncPlaceholders[GetResourceType<T>()] = InPlaceholder;
+}
+
+template<typename T>
+T* UResourceManager::GetAsyncPlaceholder()
+{
+	if (UResourceBase** Found = AsyncPlaceholders.Find(GetResourceType<T>()))
+	{
+		return static_cast<T*>(*Found);
+	}
+
+	// 스태틱 메시는 컴포넌트 기본 메시를 대체 리소스로 사용
+	if constexpr (std::is_same_v<T, UStaticMesh>)
+	{
+		UStaticMesh* DefaultMesh = Load<UStaticMesh>(GDataDir + "/cube-tex.obj");
+		SetAsyncPlaceholder<UStaticMesh>(DefaultMesh);
+		return DefaultMesh;
+	}
+	return nullptr;
+}
+
+template<typename T>
+T* TAsyncLoadHandle<T>::GetOrPlaceholder() const
+{
+	if (T* Loaded = Get())
+	{
+		return Loaded;
+	}
+	return UResourceManager::GetInstance().GetAsyncPlaceholder<T>();
+}
+
 template<>
 inline UShader* UResourceManager::Load(const FString& InFilePath, TArray<FShaderMacro>& InMacros)
 {
@@ -246,6 +424,7 @@ inline UShader* UResourceManager::Load(const FString& InFilePath, TArray<FShader
 	else
 	{
 		// 3. 캐시에 없으면 새로 생성하여 로드
+		FScopedMemoryTag MemTag(EMemoryTag::Shader);
 		UShader* Resource = NewObject<UShader>();
 		// UShader::Load는 이제 매크로 인자를 받도록 수정되어야 함
 		Resource->Load(NormalizedPath, Device, InMacros);
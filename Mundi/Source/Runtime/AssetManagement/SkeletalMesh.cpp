@@ -35,6 +35,16 @@ void USkeletalMesh::Load(const FString& InFilePath, ID3D11Device* InDevice)
         return;
     }
 
+#ifdef USE_QUANTIZED_VERTEX
+    // CPU 스키닝용 압축 정점 스트림 (압축 캐시에서 로드했다면 이미 채워져 있음)
+    if (Data->QuantizedVertices.empty() && VertexQuantization::CanQuantize(Data->Vertices))
+    {
+        VertexQuantization::Quantize(Data->Vertices, Data->QuantizedVertices);
+    }
+#else
+    Data->QuantizedVertices.Empty();
+#endif
+
     // GPU 버퍼 생성
     CreateIndexBuffer(Data, InDevice);
     VertexCount = static_cast<uint32>(Data->Vertices.size());
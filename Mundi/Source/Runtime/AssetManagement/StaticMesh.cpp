@@ -45,6 +45,7 @@ namespace
 UStaticMesh::~UStaticMesh()
 {
     ReleaseResources();
+    DiscardAsyncLoad();
 }
 
 void UStaticMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, EVertexLayoutType InVertexType)
@@ -83,6 +84,48 @@ void UStaticMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, EVerte
         StaticMeshAsset = FObjManager::LoadObjStaticMeshAsset(InFilePath);
     }
 
+    CreateResourcesFromAsset(InDevice, InVertexType);
+}
+
+bool UStaticMesh::SupportsAsyncLoad(const FString& InFilePath) const
+{
+    // FBX 로더는 로드 도중 머티리얼 UObject를 생성하므로 OBJ만 워커 스레드에서 처리
+    std::filesystem::path FilePath(UTF8ToWide(InFilePath));
+    FString Extension = WideToUTF8(FilePath.extension().wstring());
+    std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+    return Extension == ".obj";
+}
+
+bool UStaticMesh::LoadAsyncData(const FString& InFilePath)
+{
+    PendingStaticMeshAsset = FObjManager::LoadObjStaticMeshData(InFilePath, PendingMaterialInfos);
+    return PendingStaticMeshAsset != nullptr;
+}
+
+void UStaticMesh::FinalizeAsyncLoad(ID3D11Device* InDevice)
+{
+    assert(InDevice);
+
+    if (PendingStaticMeshAsset)
+    {
+        StaticMeshAsset = FObjManager::RegisterObjStaticMeshData(FilePath, PendingStaticMeshAsset, PendingMaterialInfos);
+        PendingStaticMeshAsset = nullptr;
+    }
+    PendingMaterialInfos.Empty();
+
+    SetVertexType(VertexType);
+    CreateResourcesFromAsset(InDevice, VertexType);
+}
+
+void UStaticMesh::DiscardAsyncLoad()
+{
+    delete PendingStaticMeshAsset;
+    PendingStaticMeshAsset = nullptr;
+    PendingMaterialInfos.Empty();
+}
+
+void UStaticMesh::CreateResourcesFromAsset(ID3D11Device* InDevice, EVertexLayoutType InVertexType)
+{
     // 빈 버텍스, 인덱스로 버퍼 생성 방지
     if (StaticMeshAsset && 0 < StaticMeshAsset->Vertices.size() && 0 < StaticMeshAsset->Indices.size())
     {
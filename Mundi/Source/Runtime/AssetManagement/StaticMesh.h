@@ -16,6 +16,12 @@ public:
     void Load(const FString& InFilePath, ID3D11Device* InDevice, EVertexLayoutType InVertexType = EVertexLayoutType::PositionColorTexturNormal);
     void Load(FMeshData* InData, ID3D11Device* InDevice, EVertexLayoutType InVertexType = EVertexLayoutType::PositionColorTexturNormal);
 
+    // 비동기 로드 (UResourceManager::LoadAsync)
+    bool SupportsAsyncLoad(const FString& InFilePath) const override;
+    bool LoadAsyncData(const FString& InFilePath) override;
+    void FinalizeAsyncLoad(ID3D11Device* InDevice) override;
+    void DiscardAsyncLoad() override;
+
     ID3D11Buffer* GetVertexBuffer() const { return VertexBuffer; }
     ID3D11Buffer* GetIndexBuffer() const { return IndexBuffer; }
     uint32 GetVertexCount() const { return VertexCount; }
@@ -45,6 +51,7 @@ private:
 	void CreateIndexBuffer(FStaticMesh* InStaticMesh, ID3D11Device* InDevice);
     void CreateLocalBound(const FMeshData* InMeshData);
     void CreateLocalBound(const FStaticMesh* InStaticMesh);
+    void CreateResourcesFromAsset(ID3D11Device* InDevice, EVertexLayoutType InVertexType);
     void ReleaseResources();
 
     FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube.obj.bin)
@@ -60,6 +67,10 @@ private:
 	// CPU 리소스
     FStaticMesh* StaticMeshAsset = nullptr;
 
+    // 비동기 로드 중 워커 스레드가 채운 데이터 (FinalizeAsyncLoad에서 등록)
+    FStaticMesh* PendingStaticMeshAsset = nullptr;
+    TArray<FMaterialInfo> PendingMaterialInfos;
+
     // 메시 단위 BVH (ResourceManager에서 캐싱, 소유)
     // 초기화되지 않는 멤버변수 (참조도 ResourceManager에서만 이루어짐) 
     // FMeshBVH* MeshBVH = nullptr;
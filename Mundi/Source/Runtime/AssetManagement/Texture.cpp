@@ -24,54 +24,7 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	assert(InDevice);
 
 	// 실제로 로드할 파일 경로 결정
-	FString ActualLoadPath = InFilePath;
-
-#ifdef USE_DDS_CACHE
-	// DDS 캐싱 활성화 시: DDS 변환 및 캐시 사용
-	{
-		// 확장자 판별
-		std::filesystem::path SourcePath(UTF8ToWide(InFilePath));
-		std::string Extension = WideToUTF8(SourcePath.extension().wstring());
-		std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
-
-		// DDS가 아닌 경우 → DDS 캐시 확인 및 생성
-		if (Extension != ".dds")
-		{
-			FString DDSCachePath = FTextureConverter::GetDDSCachePath(InFilePath);
-
-			// 캐시 유효성 검사
-			if (FTextureConverter::ShouldRegenerateDDS(InFilePath, DDSCachePath))
-			{
-				UE_LOG("[UTexture] Converting texture to DDS: %s", InFilePath.c_str());
-
-					// DDS 변환 시도 (bSRGB 파라미터 전달)
-				DXGI_FORMAT TargetFormat = FTextureConverter::GetRecommendedFormat(true, bSRGB); // 알파는 일단 true로 가정
-				if (FTextureConverter::ConvertToDDS(InFilePath, DDSCachePath, TargetFormat))
-				{
-					ActualLoadPath = DDSCachePath; // DDS 캐시 사용
-				}
-				else
-				{
-					UE_LOG("[UTexture] DDS conversion failed, loading original format: %s", InFilePath.c_str());
-					// 변환 실패 시 원본 포맷으로 로드 (fallback)
-				}
-			}
-			else
-			{
-				// 기존 DDS 캐시 사용
-				ActualLoadPath = DDSCachePath;
-				UE_LOG("[UTexture] Using cached DDS: %s", DDSCachePath.c_str());
-			}
-
-			// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
-			FString NormalizedCachePath = NormalizePath(DDSCachePath);
-			CacheFilePath = NormalizedCachePath;   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 정규화됨)
-		}
-	}
-#else
-	// DDS 캐싱 비활성화 시: 원본 파일만 로드
-	UE_LOG("[UTexture] Loading original texture (DDS cache disabled): %s", InFilePath.c_str());
-#endif
+	FString ActualLoadPath = ResolveLoadPath(InFilePath, bSRGB);
 
 	// UTF-8 -> UTF-16 (Windows) 안전 변환: 한글/비ASCII 경로 대응
 	int needed = ::MultiByteToWideChar(CP_UTF8, 0, ActualLoadPath.c_str(), -1, nullptr, 0);
@@ -91,13 +44,8 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 		}
 	}
 
-	// 최종 로드할 파일의 확장자 재확인
-	std::filesystem::path LoadPath(UTF8ToWide(ActualLoadPath));
-	std::wstring ext = LoadPath.has_extension() ? LoadPath.extension().wstring() : L"";
-	for (auto& ch : ext) ch = static_cast<wchar_t>(::towlower(ch));
-
 	HRESULT hr = E_FAIL;
-	if (ext == L".dds")
+	if (IsDDSPath(ActualLoadPath))
 	{
 		// DDS 로딩: Ex 버전 사용하여 sRGB 지정
 		hr = DirectX::CreateDDSTextureFromFileEx(
@@ -130,7 +78,141 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 		);
 	}
 
-	if (SUCCEEDED(hr))
+	OnTextureCreated(hr, ActualLoadPath);
+}
+
+bool UTexture::SupportsAsyncLoad(const FString& InFilePath) const
+{
+	return true;
+}
+
+bool UTexture::LoadAsyncData(const FString& InFilePath)
+{
+	// DDS 변환(캐시 생성)과 파일 읽기를 워커 스레드에서 수행 (비동기 로드는 sRGB 기본값 사용)
+	PendingLoadPath = ResolveLoadPath(InFilePath, true);
+
+	std::ifstream File(UTF8ToWide(PendingLoadPath), std::ios::binary | std::ios::ate);
+	if (!File.is_open())
+	{
+		UE_LOG("[UTexture] Failed to open texture for async load: %s", PendingLoadPath.c_str());
+		return false;
+	}
+
+	PendingFileData.resize(static_cast<size_t>(File.tellg()));
+	File.seekg(0);
+	File.read(reinterpret_cast<char*>(PendingFileData.data()), static_cast<std::streamsize>(PendingFileData.size()));
+	return File.good() && !PendingFileData.IsEmpty();
+}
+
+void UTexture::FinalizeAsyncLoad(ID3D11Device* InDevice)
+{
+	assert(InDevice);
+
+	HRESULT hr = E_FAIL;
+	if (IsDDSPath(PendingLoadPath))
+	{
+		hr = DirectX::CreateDDSTextureFromMemoryEx(
+			InDevice,
+			PendingFileData.data(),
+			PendingFileData.size(),
+			0,
+			D3D11_USAGE_DEFAULT,
+			D3D11_BIND_SHADER_RESOURCE,
+			0,
+			0,
+			DirectX::DDS_LOADER_FORCE_SRGB,
+			reinterpret_cast<ID3D11Resource**>(&Texture2D),
+			&ShaderResourceView
+		);
+	}
+	else
+	{
+		hr = DirectX::CreateWICTextureFromMemoryEx(
+			InDevice,
+			PendingFileData.data(),
+			PendingFileData.size(),
+			0,
+			D3D11_USAGE_DEFAULT,
+			D3D11_BIND_SHADER_RESOURCE,
+			0,
+			0,
+			DirectX::WIC_LOADER_FORCE_SRGB,
+			reinterpret_cast<ID3D11Resource**>(&Texture2D),
+			&ShaderResourceView
+		);
+	}
+
+	OnTextureCreated(hr, PendingLoadPath);
+	DiscardAsyncLoad();
+}
+
+void UTexture::DiscardAsyncLoad()
+{
+	PendingFileData.Empty();
+	PendingFileData.Shrink();
+	PendingLoadPath.clear();
+}
+
+FString UTexture::ResolveLoadPath(const FString& InFilePath, bool bSRGB)
+{
+	FString ActualLoadPath = InFilePath;
+
+#ifdef USE_DDS_CACHE
+	// DDS 캐싱 활성화 시: DDS 변환 및 캐시 사용
+	{
+		// DDS가 아닌 경우 → DDS 캐시 확인 및 생성
+		if (!IsDDSPath(InFilePath))
+		{
+			FString DDSCachePath = FTextureConverter::GetDDSCachePath(InFilePath);
+
+			// 캐시 유효성 검사
+			if (FTextureConverter::ShouldRegenerateDDS(InFilePath, DDSCachePath))
+			{
+				UE_LOG("[UTexture] Converting texture to DDS: %s", InFilePath.c_str());
+
+					// DDS 변환 시도 (bSRGB 파라미터 전달)
+				DXGI_FORMAT TargetFormat = FTextureConverter::GetRecommendedFormat(true, bSRGB); // 알파는 일단 true로 가정
+				if (FTextureConverter::ConvertToDDS(InFilePath, DDSCachePath, TargetFormat))
+				{
+					ActualLoadPath = DDSCachePath; // DDS 캐시 사용
+				}
+				else
+				{
+					UE_LOG("[UTexture] DDS conversion failed, loading original format: %s", InFilePath.c_str());
+					// 변환 실패 시 원본 포맷으로 로드 (fallback)
+				}
+			}
+			else
+			{
+				// 기존 DDS 캐시 사용
+				ActualLoadPath = DDSCachePath;
+				UE_LOG("[UTexture] Using cached DDS: %s", DDSCachePath.c_str());
+			}
+
+			// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
+			FString NormalizedCachePath = NormalizePath(DDSCachePath);
+			CacheFilePath = NormalizedCachePath;   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 정규화됨)
+		}
+	}
+#else
+	// DDS 캐싱 비활성화 시: 원본 파일만 로드
+	UE_LOG("[UTexture] Loading original texture (DDS cache disabled): %s", InFilePath.c_str());
+#endif
+
+	return ActualLoadPath;
+}
+
+bool UTexture::IsDDSPath(const FString& InFilePath)
+{
+	std::filesystem::path LoadPath(UTF8ToWide(InFilePath));
+	std::wstring ext = LoadPath.has_extension() ? LoadPath.extension().wstring() : L"";
+	for (auto& ch : ext) ch = static_cast<wchar_t>(::towlower(ch));
+	return ext == L".dds";
+}
+
+void UTexture::OnTextureCreated(HRESULT InResult, const FString& InLoadedPath)
+{
+	if (SUCCEEDED(InResult))
 	{
 		if (Texture2D)
 		{
@@ -143,7 +225,7 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	}
 	else
 	{
-		UE_LOG("[UTexture] Failed to load texture: %s (HRESULT: 0x%08X)", ActualLoadPath.c_str(), hr);
+		UE_LOG("[UTexture] Failed to load texture: %s (HRESULT: 0x%08X)", InLoadedPath.c_str(), InResult);
 	}
 }
 
@@ -14,6 +14,12 @@ public:
 	// bSRGB: true = sRGB 포맷 사용 (Diffuse/Albedo 텍스처), false = Linear 포맷 (Normal/Data 텍스처)
 	void Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRGB = true);
 
+	// 비동기 로드 (UResourceManager::LoadAsync): 파일 IO/DDS 변환은 워커, 텍스처 생성은 메인 스레드
+	bool SupportsAsyncLoad(const FString& InFilePath) const override;
+	bool LoadAsyncData(const FString& InFilePath) override;
+	void FinalizeAsyncLoad(ID3D11Device* InDevice) override;
+	void DiscardAsyncLoad() override;
+
 	ID3D11ShaderResourceView* GetShaderResourceView() const { return ShaderResourceView; }
 	ID3D11Texture2D* GetTexture2D() const { return Texture2D; }
 
@@ -27,6 +33,11 @@ public:
 	void ReleaseResources();
 
 private:
+	// DDS 캐시를 확인/생성하고 실제로 읽어야 할 파일 경로를 반환
+	FString ResolveLoadPath(const FString& InFilePath, bool bSRGB);
+	static bool IsDDSPath(const FString& InFilePath);
+	void OnTextureCreated(HRESULT InResult, const FString& InLoadedPath);
+
 	FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube_texture.png.dds)
 
 	ID3D11Texture2D* Texture2D;
@@ -35,4 +46,8 @@ private:
 	uint32 Width = 0;
 	uint32 Height = 0;
 	DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
+
+	// 비동기 로드 중 워커 스레드가 읽어둔 파일 데이터 (Texture 태그로 집계)
+	FString PendingLoadPath;
+	TTaggedArray<uint8> PendingFileData;
 };
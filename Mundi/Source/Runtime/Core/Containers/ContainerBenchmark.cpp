@@ -0,0 +1,330 @@
+#include "pch.h"
+#include "ContainerBenchmark.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+
+namespace
+{
+	void LogScenario(const char* KeyName, const char* Scenario, uint64 Operations, double StdMS, double TMapMS)
+	{
+		char Name[64];
+		snprintf(Name, sizeof(Name), "%s %s", KeyName, Scenario);
+		const double Speedup = TMapMS > 0.0 ? StdMS / TMapMS : 0.0;
+		UE_LOG("[ContainerBenchmark] %-32s %10.2f %10.2f %7.2fx  (%.1f Mops/s)",
+			Name, StdMS, TMapMS, Speedup, TMapMS > 0.0 ? Operations / (TMapMS * 1000.0) : 0.0);
+	}
+
+	/** 맵 하나에 대한 시나리오 묶음. 결과는 Sink에 모아 최적화로 사라지지 않게 함 */
+	template<typename MapType, typename KeyType>
+	struct TMapScenarios
+	{
+		const TArray<KeyType>& Keys;
+		const TArray<KeyType>& MissingKeys;
+		uint32 NumLookups;
+		uint64 Sink = 0;
+
+		double Insert(uint32 Rounds)
+		{
+			return MeasureMS([&]()
+			{
+				for (uint32 Round = 0; Round < Rounds; ++Round)
+				{
+					MapType Map;
+					for (int32 i = 0; i < Keys.Num(); ++i)
+					{
+						Map[Keys[i]] = static_cast<uint32>(i);
+					}
+					Sink += Map.size();
+				}
+			});
+		}
+
+		double Lookup(const MapType& Map, const TArray<KeyType>& Queries)
+		{
+			return MeasureMS([&]()
+			{
+				FBenchmarkRandom Random(0xC0FFEEu);
+				for (uint32 i = 0; i < NumLookups; ++i)
+				{
+					auto It = Map.find(Queries[Random.Next() % Queries.Num()]);
+					Sink += (It != Map.end()) ? It->second : 1;
+				}
+			});
+		}
+
+		double Churn(MapType& Map, uint32 NumOperations)
+		{
+			return MeasureMS([&]()
+			{
+				FBenchmarkRandom Random(0xBEEFu);
+				for (uint32 i = 0; i < NumOperations; ++i)
+				{
+					const KeyType& Key = Keys[Random.Next() % Keys.Num()];
+					if (Map.erase(Key) == 0)
+					{
+						Map[Key] = i;
+					}
+				}
+				Sink += Map.size();
+			});
+		}
+
+		double Iterate(const MapType& Map, uint32 Rounds)
+		{
+			return MeasureMS([&]()
+			{
+				for (uint32 Round = 0; Round < Rounds; ++Round)
+				{
+					for (const auto& Pair : Map)
+					{
+						Sink += Pair.second;
+					}
+				}
+			});
+		}
+	};
+
+	template<typename KeyType>
+	void RunKeyType(const char* KeyName, const TArray<KeyType>& Keys, const TArray<KeyType>& MissingKeys)
+	{
+		using FStdMap = std::unordered_map<KeyType, uint32>;
+		using FTMap = TMap<KeyType, uint32>;
+
+		constexpr uint32 InsertRounds = 20;
+		constexpr uint32 NumLookups = 2000000;
+		constexpr uint32 IterateRounds = 200;
+		const uint32 ChurnOps = 1000000;
+
+		TMapScenarios<FStdMap, KeyType> Std{ Keys, MissingKeys, NumLookups };
+		TMapScenarios<FTMap, KeyType> Open{ Keys, MissingKeys, NumLookups };
+
+		FStdMap StdMap;
+		FTMap OpenMap;
+		for (int32 i = 0; i < Keys.Num(); ++i)
+		{
+			StdMap[Keys[i]] = static_cast<uint32>(i);
+			OpenMap[Keys[i]] = static_cast<uint32>(i);
+		}
+
+		const uint64 NumKeys = Keys.Num();
+		LogScenario(KeyName, "Insert", NumKeys * InsertRounds, Std.Insert(InsertRounds), Open.Insert(InsertRounds));
+		LogScenario(KeyName, "Lookup Hit", NumLookups, Std.Lookup(StdMap, Keys), Open.Lookup(OpenMap, Keys));
+		LogScenario(KeyName, "Lookup Miss", NumLookups, Std.Lookup(StdMap, MissingKeys), Open.Lookup(OpenMap, MissingKeys));
+		LogScenario(KeyName, "Iterate", NumKeys * IterateRounds, Std.Iterate(StdMap, IterateRounds), Open.Iterate(OpenMap, IterateRounds));
+		LogScenario(KeyName, "Erase/Insert Churn", ChurnOps, Std.Churn(StdMap, ChurnOps), Open.Churn(OpenMap, ChurnOps));
+
+		volatile uint64 Keep = Std.Sink + Open.Sink;
+		(void)Keep;
+	}
+
+	// 리소스 경로처럼 생긴 문자열 ("Data/Model/Prop_00042.obj")
+	FString MakeAssetPath(uint32 Index, const char* Folder)
+	{
+		char Buffer[64];
+		snprintf(Buffer, sizeof(Buffer), "Data/%s/Prop_%05u.obj", Folder, Index);
+		return Buffer;
+	}
+
+	/** const char* 경로로 조회: 이전에는 매번 임시 FString을 만들어야 했음 */
+	void RunStringLiteralLookup(const TArray<FString>& Keys)
+	{
+		constexpr uint32 NumLookups = 2000000;
+
+		std::unordered_map<FString, uint32> StdMap;
+		TMap<FString, uint32> OpenMap;
+		for (int32 i = 0; i < Keys.Num(); ++i)
+		{
+			StdMap[Keys[i]] = static_cast<uint32>(i);
+			OpenMap[Keys[i]] = static_cast<uint32>(i);
+		}
+
+		uint64 Sink = 0;
+		const double StdMS = MeasureMS([&]()
+		{
+			FBenchmarkRandom Random(0xC0FFEEu);
+			for (uint32 i = 0; i < NumLookups; ++i)
+			{
+				const char* Path = Keys[Random.Next() % Keys.Num()].c_str();
+				auto It = StdMap.find(FString(Path));
+				Sink += (It != StdMap.end()) ? It->second : 1;
+			}
+		});
+		const double OpenMS = MeasureMS([&]()
+		{
+			FBenchmarkRandom Random(0xC0FFEEu);
+			for (uint32 i = 0; i < NumLookups; ++i)
+			{
+				const char* Path = Keys[Random.Next() % Keys.Num()].c_str();
+				const uint32* Found = OpenMap.Find(Path);
+				Sink += Found ? *Found : 1;
+			}
+		});
+		LogScenario("FString", "Lookup by const char*", NumLookups, StdMS, OpenMS);
+
+		volatile uint64 Keep = Sink;
+		(void)Keep;
+	}
+
+	/** 매 프레임 비우고 다시 채우는 셋 (UWorld::FrameOverlapPairs, WorldPartition 더티 셋 패턴) */
+	void RunFrameSet()
+	{
+		constexpr uint32 NumFrames = 2000;
+		constexpr uint32 PairsPerFrame = 512;
+
+		uint64 Sink = 0;
+		auto RunFrames = [&](auto& Set)
+		{
+			FBenchmarkRandom Random(0x1234u);
+			for (uint32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				Set.clear();
+				for (uint32 i = 0; i < PairsPerFrame; ++i)
+				{
+					const uint64 Pair = (static_cast<uint64>(Random.Next() % 2048) << 32) | (Random.Next() % 2048);
+					Sink += Set.insert(Pair).second ? 1 : 0;
+				}
+			}
+		};
+
+		std::unordered_set<uint64> StdSet;
+		TSet<uint64> OpenSet;
+		const double StdMS = MeasureMS([&]() { RunFrames(StdSet); });
+		const double OpenMS = MeasureMS([&]() { RunFrames(OpenSet); });
+		LogScenario("TSet<uint64>", "Per-frame Clear/Insert", static_cast<uint64>(NumFrames) * PairsPerFrame, StdMS, OpenMS);
+
+		volatile uint64 Keep = Sink;
+		(void)Keep;
+	}
+
+	/**
+	 * 순회 중 다른 원소 삭제 회귀 검사: 삭제된 원소를 방문하지 않고, 남은 원소는 빠짐없이 한 번씩 방문해야 함
+	 * (반복자가 비트맵 워드를 캐시하면 같은 64칸 워드 안에서 삭제된 원소를 읽음)
+	 */
+	bool RunIterationEraseCheck()
+	{
+		// 재현 사례: 10개 중 키 1을 방문할 때 키 5 삭제
+		{
+			TMap<int32, FString> Map;
+			for (int32 Key = 0; Key < 10; ++Key)
+			{
+				Map.Add(Key, FString(40, static_cast<char>('a' + Key)));
+			}
+			for (auto It = Map.begin(); It != Map.end(); ++It)
+			{
+				if (It->first == 5)
+				{
+					return false;
+				}
+				if (It->first == 1)
+				{
+					Map.Remove(5);
+				}
+			}
+		}
+
+		FBenchmarkRandom Random(0xE5A5Eu);
+		for (int32 Round = 0; Round < 200; ++Round)
+		{
+			const int32 NumKeys = 1 + static_cast<int32>(Random.Next() % 300);
+			TMap<int32, FString> Map;
+			TArray<uint8> States;   // 0 = 남아 있음, 1 = 방문함, 2 = 삭제됨
+			States.SetNum(NumKeys);
+			for (int32 Key = 0; Key < NumKeys; ++Key)
+			{
+				Map.Add(Key, FString(32, 'x'));
+			}
+
+			for (auto It = Map.begin(); It != Map.end(); ++It)
+			{
+				const int32 Key = It->first;
+				if (States[Key] != 0)
+				{
+					return false;
+				}
+				States[Key] = 1;
+
+				for (int32 Erase = 0; Erase < 3; ++Erase)
+				{
+					const int32 Victim = static_cast<int32>(Random.Next() % NumKeys);
+					if (Victim != Key && States[Victim] != 2)
+					{
+						States[Victim] = 2;
+						Map.Remove(Victim);
+					}
+				}
+			}
+
+			for (uint8 State : States)
+			{
+				if (State == 0)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+}
+
+void FContainerBenchmark::RunAndLog()
+{
+	constexpr uint32 NumKeys = 50000;
+
+	UE_LOG("[ContainerBenchmark] Erase during iteration: %s", RunIterationEraseCheck() ? "PASS" : "FAIL");
+	UE_LOG("[ContainerBenchmark] %-32s %10s %10s %8s", "Scenario", "Std(ms)", "TMap(ms)", "Speedup");
+
+	{
+		TArray<uint64> Keys;
+		TArray<uint64> Missing;
+		FBenchmarkRandom Random(0x5EEDu);
+		for (uint32 i = 0; i < NumKeys; ++i)
+		{
+			// 셰이더 variant 키처럼 상위 비트까지 고르게 퍼진 값
+			Keys.Add((static_cast<uint64>(Random.Next()) << 32) | Random.Next());
+			Missing.Add((static_cast<uint64>(Random.Next()) << 32) | Random.Next() | 1ull << 63);
+		}
+		RunKeyType("uint64", Keys, Missing);
+	}
+
+	{
+		// 포인터 키: 실제 힙 객체 주소 (16바이트 정렬이라 하위 비트가 항상 0)
+		TArray<std::unique_ptr<uint8[]>> Objects;
+		TArray<const void*> Keys;
+		TArray<const void*> Missing;
+		for (uint32 i = 0; i < NumKeys * 2; ++i)
+		{
+			Objects.Emplace(std::make_unique<uint8[]>(48));
+			(i % 2 ? Missing : Keys).Add(Objects.back().get());
+		}
+		RunKeyType("Pointer", Keys, Missing);
+	}
+
+	{
+		TArray<FString> Keys;
+		TArray<FString> Missing;
+		for (uint32 i = 0; i < NumKeys; ++i)
+		{
+			Keys.Add(MakeAssetPath(i, "Model"));
+			Missing.Add(MakeAssetPath(i, "Missing"));
+		}
+		RunKeyType("FString", Keys, Missing);
+		RunStringLiteralLookup(Keys);
+	}
+
+	{
+		TArray<FName> Keys;
+		TArray<FName> Missing;
+		for (uint32 i = 0; i < NumKeys; ++i)
+		{
+			Keys.Add(FName(MakeAssetPath(i, "BenchName")));
+			Missing.Add(FName(MakeAssetPath(i, "BenchNameMissing")));
+		}
+		RunKeyType("FName", Keys, Missing);
+	}
+
+	RunFrameSet();
+}
+
+static const bool bContainerBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"CONTAINER BENCH", "-containerbench", "hash container benchmark (std::unordered_* vs TMap/TSet)", EBenchmarkStage::None,
+	[](const FString&) { FContainerBenchmark::RunAndLog(); } });
@@ -0,0 +1,18 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 해시 컨테이너 벤치마크 (콘솔 CONTAINER BENCH 명령)
+ *
+ * 같은 작업을 이전 구현(std::unordered_map/set 래퍼)과 현재 TMap/TSet으로 각각 수행합니다.
+ * 엔진에서 실제로 쓰는 키 타입 기준:
+ * - uint64 (셰이더 variant 키, 오버랩 쌍), 포인터 (컴포넌트 더티 셋/바운드 캐시),
+ *   FString (리소스 경로), FName (프로퍼티 메타데이터)
+ * - Insert / Lookup Hit / Lookup Miss / Erase+Insert Churn / Iterate
+ * 측정 전에 순회 중 다른 원소를 삭제하는 경우의 반복자 동작을 검사해 PASS/FAIL을 출력합니다.
+ */
+class FContainerBenchmark
+{
+public:
+	static void RunAndLog();
+};
@@ -0,0 +1,758 @@
+#pragma once
+#include <bit>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+/**
+ * @brief 해시 컨테이너 키 특성 (해시 함수 / 비교 / 이종 키 조회 허용 여부)
+ *
+ * 기본은 std::hash + operator==. 이종 조회는 특수화에서만 허용합니다.
+ */
+template<typename KeyType>
+struct THashKeyTraits
+{
+    template<typename LookupType>
+    static constexpr bool bHeterogeneous = false;
+
+    static size_t Hash(const KeyType& Key) { return std::hash<KeyType>()(Key); }
+    static bool Matches(const KeyType& A, const KeyType& B) { return A == B; }
+};
+
+/** FString 키는 const char* / std::string_view로 임시 문자열 없이 조회 가능 */
+template<>
+struct THashKeyTraits<std::string>
+{
+    template<typename LookupType>
+    static constexpr bool bHeterogeneous = !std::is_same_v<std::remove_cvref_t<LookupType>, std::string>
+        && std::is_convertible_v<const LookupType&, std::string_view>;
+
+    static size_t Hash(std::string_view Key) { return std::hash<std::string_view>()(Key); }
+    static bool Matches(const std::string& A, std::string_view B) { return A == B; }
+};
+
+template<>
+struct THashKeyTraits<std::wstring>
+{
+    template<typename LookupType>
+    static constexpr bool bHeterogeneous = !std::is_same_v<std::remove_cvref_t<LookupType>, std::wstring>
+        && std::is_convertible_v<const LookupType&, std::wstring_view>;
+
+    static size_t Hash(std::wstring_view Key) { return std::hash<std::wstring_view>()(Key); }
+    static bool Matches(const std::wstring& A, std::wstring_view B) { return A == B; }
+};
+
+/** TSet 원소에서 키 추출 */
+struct FHashSetKeyOf
+{
+    template<typename ElementType>
+    static const ElementType& Get(const ElementType& Element) { return Element; }
+};
+
+/** TMap 원소(std::pair<const K, V>)에서 키 추출 */
+struct FHashMapKeyOf
+{
+    template<typename PairType>
+    static const typename PairType::first_type& Get(const PairType& Element) { return Element.first; }
+};
+
+/**
+ * @brief TMap/TSet 공용 오픈 어드레싱 해시 테이블
+ *
+ * - 인덱스 테이블: {32비트 해시, 원소 인덱스} 8바이트 슬롯 배열, Robin Hood 선형 탐사 + 후방 이동 삭제 (툼스톤 없음)
+ *   조회 시 해시가 같은 슬롯만 키를 비교하고, 탐사 거리가 역전되면 즉시 실패로 끝냅니다.
+ * - 원소 저장소: 8, 16, 32... 크기로 커지는 청크. 한 번 만든 청크는 옮기지 않으므로
+ *   원소 주소/참조는 삽입·재해시 후에도 유지됩니다 (std::unordered_map과 동일한 보장).
+ *   삭제된 칸은 프리 리스트로 재사용하고, 순회는 점유 비트맵을 따라 갑니다.
+ *
+ * 반복자는 해당 원소가 삭제되기 전까지 유효하며, erase(It)는 다음 원소를 돌려줍니다.
+ * 순회 중 다른 원소를 삭제해도 됩니다 (++는 매번 점유 비트맵을 다시 읽으므로 삭제된 칸은 건너뜀).
+ */
+template<typename ElementType, typename KeyType, typename KeyOf, bool bConstElements>
+class THashTable
+{
+public:
+    using key_type = KeyType;
+    using value_type = ElementType;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = ElementType&;
+    using const_reference = const ElementType&;
+    using KeyTraits = THashKeyTraits<KeyType>;
+
+    template<bool bConst>
+    class TIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ElementType;
+        using difference_type = ptrdiff_t;
+        using pointer = std::conditional_t<bConst, const ElementType*, ElementType*>;
+        using reference = std::conditional_t<bConst, const ElementType&, ElementType&>;
+
+        TIterator() = default;
+
+        template<bool bOtherConst> requires (bConst && !bOtherConst)
+        TIterator(const TIterator<bOtherConst>& Other)
+            : Table(Other.Table), Element(Other.Element), Index(Other.Index), ChunkEnd(Other.ChunkEnd) {}
+
+        reference operator*() const { return *Element; }
+        pointer operator->() const { return Element; }
+
+        TIterator& operator++()
+        {
+            // 비트맵은 캐시하지 않고 매번 읽음: 순회 중 같은 워드의 다른 원소가 삭제될 수 있음
+            const uint32 OldIndex = Index;
+            Index = Table->NextOccupied(Index + 1);
+
+            // 같은 청크 안이면 포인터만 전진
+            if (Index < ChunkEnd)
+            {
+                Element += Index - OldIndex;
+            }
+            else
+            {
+                Locate();
+            }
+            return *this;
+        }
+
+        TIterator operator++(int)
+        {
+            TIterator Old = *this;
+            ++(*this);
+            return Old;
+        }
+
+        friend bool operator==(const TIterator& A, const TIterator& B) { return A.Index == B.Index; }
+
+    private:
+        friend class THashTable;
+        template<bool> friend class TIterator;
+
+        using TablePointer = std::conditional_t<bConst, const THashTable*, THashTable*>;
+
+        TIterator(TablePointer InTable, uint32 InIndex)
+            : Table(InTable), Index(InIndex)
+        {
+            Locate();
+        }
+
+        void Locate()
+        {
+            if (Index < Table->HighWater)
+            {
+                Element = &Table->GetEntry(Index);
+                ChunkEnd = ChunkStart(ChunkOf(Index) + 1);
+            }
+            else
+            {
+                Element = nullptr;
+                ChunkEnd = Index;
+            }
+        }
+
+        TablePointer Table = nullptr;
+        pointer Element = nullptr;
+        uint32 Index = 0;
+        uint32 ChunkEnd = 0;      // Element가 속한 청크의 끝 인덱스
+    };
+
+    using iterator = TIterator<bConstElements>;
+    using const_iterator = TIterator<true>;
+
+    THashTable() = default;
+
+    THashTable(std::initializer_list<ElementType> InitList)
+    {
+        insert(InitList.begin(), InitList.end());
+    }
+
+    template<typename InputIterator>
+    THashTable(InputIterator First, InputIterator Last)
+    {
+        insert(First, Last);
+    }
+
+    THashTable(const THashTable& Other)
+    {
+        CopyFrom(Other);
+    }
+
+    THashTable(THashTable&& Other) noexcept
+    {
+        MoveFrom(Other);
+    }
+
+    THashTable& operator=(const THashTable& Other)
+    {
+        if (this != &Other)
+        {
+            ReleaseStorage();
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+
+    THashTable& operator=(THashTable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            ReleaseStorage();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    THashTable& operator=(std::initializer_list<ElementType> InitList)
+    {
+        clear();
+        insert(InitList.begin(), InitList.end());
+        return *this;
+    }
+
+    ~THashTable()
+    {
+        ReleaseStorage();
+    }
+
+    /** 반복자 */
+    iterator begin() { return iterator(this, NextOccupied(0)); }
+    iterator end() { return iterator(this, HighWater); }
+    const_iterator begin() const { return const_iterator(this, NextOccupied(0)); }
+    const_iterator end() const { return const_iterator(this, HighWater); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    /** 크기 */
+    size_type size() const { return NumEntries; }
+    bool empty() const { return NumEntries == 0; }
+
+    /** 원소를 모두 파괴하되 인덱스 테이블과 청크는 재사용을 위해 유지 */
+    void clear()
+    {
+        DestroyEntries();
+        if (Slots)
+        {
+            std::fill(Slots, Slots + SlotCount, FIndexSlot{});
+        }
+    }
+
+    /** 검색 */
+    iterator find(const KeyType& Key) { return iterator(this, FindEntry(Key)); }
+    const_iterator find(const KeyType& Key) const { return const_iterator(this, FindEntry(Key)); }
+
+    template<typename LookupType> requires KeyTraits::template bHeterogeneous<LookupType>
+    iterator find(const LookupType& Key) { return iterator(this, FindEntry(Key)); }
+
+    template<typename LookupType> requires KeyTraits::template bHeterogeneous<LookupType>
+    const_iterator find(const LookupType& Key) const { return const_iterator(this, FindEntry(Key)); }
+
+    size_type count(const KeyType& Key) const { return FindEntry(Key) != HighWater ? 1 : 0; }
+
+    template<typename LookupType> requires KeyTraits::template bHeterogeneous<LookupType>
+    size_type count(const LookupType& Key) const { return FindEntry(Key) != HighWater ? 1 : 0; }
+
+    bool contains(const KeyType& Key) const { return FindEntry(Key) != HighWater; }
+
+    template<typename LookupType> requires KeyTraits::template bHeterogeneous<LookupType>
+    bool contains(const LookupType& Key) const { return FindEntry(Key) != HighWater; }
+
+    /** 삽입 (원소를 먼저 만든 뒤 키가 이미 있으면 버림 - std::unordered_*::emplace와 동일한 의미) */
+    template<typename... ArgTypes>
+    std::pair<iterator, bool> emplace(ArgTypes&&... Args)
+    {
+        const uint32 Index = ConstructEntry(std::forward<ArgTypes>(Args)...);
+        const KeyType& Key = KeyOf::Get(GetEntry(Index));
+        const uint32 Hash = HashKey(Key);
+
+        const uint32 SlotIndex = FindSlot(Key, Hash);
+        if (SlotIndex != InvalidIndex)
+        {
+            ReleaseEntry(Index);
+            return { iterator(this, Slots[SlotIndex].EntryIndex), false };
+        }
+
+        CommitEntry(Index, Hash);
+        return { iterator(this, Index), true };
+    }
+
+    std::pair<iterator, bool> insert(const ElementType& Element)
+    {
+        return InsertUnique(KeyOf::Get(Element), Element);
+    }
+
+    std::pair<iterator, bool> insert(ElementType&& Element)
+    {
+        return InsertUnique(KeyOf::Get(Element), std::move(Element));
+    }
+
+    template<typename InputIterator>
+    void insert(InputIterator First, InputIterator Last)
+    {
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>)
+        {
+            reserve(NumEntries + static_cast<size_type>(std::distance(First, Last)));
+        }
+        for (; First != Last; ++First)
+        {
+            emplace(*First);
+        }
+    }
+
+    void insert(std::initializer_list<ElementType> InitList)
+    {
+        insert(InitList.begin(), InitList.end());
+    }
+
+    /** 삭제 */
+    iterator erase(const_iterator Position)
+    {
+        const uint32 Index = Position.Index;
+        RemoveSlot(Index, HashKey(KeyOf::Get(GetEntry(Index))));
+        ReleaseEntry(Index);
+        --NumEntries;
+        return iterator(this, NextOccupied(Index + 1));
+    }
+
+    iterator erase(const_iterator First, const_iterator Last)
+    {
+        while (First != Last)
+        {
+            First = erase(First);
+        }
+        return iterator(this, Last.Index);
+    }
+
+    size_type erase(const KeyType& Key) { return EraseKey(Key); }
+
+    template<typename LookupType> requires KeyTraits::template bHeterogeneous<LookupType>
+    size_type erase(const LookupType& Key) { return EraseKey(Key); }
+
+    /** 최소 NumElements개를 재할당 없이 담을 수 있도록 인덱스 테이블과 청크 확보 */
+    void reserve(size_type NumElements)
+    {
+        const uint32 Target = static_cast<uint32>(NumElements);
+        if (Target > MaxLoad(SlotCount))
+        {
+            Rehash(SlotCountFor(Target));
+        }
+        while (EntryCapacity < Target)
+        {
+            AddChunk();
+        }
+    }
+
+    void rehash(size_type NumElements)
+    {
+        Rehash(SlotCountFor(std::max(static_cast<uint32>(NumElements), NumEntries)));
+    }
+
+    /**
+     * @brief 현재 원소 수에 맞게 인덱스 테이블을 줄이고, 뒤쪽의 빈 청크를 반환
+     *
+     * 원소를 옮기지 않으므로 중간에 남은 빈 칸은 다음 삽입 때 재사용됩니다.
+     */
+    void shrink_to_fit()
+    {
+        if (NumEntries == 0)
+        {
+            ReleaseStorage();
+            return;
+        }
+
+        while (HighWater > 0 && !IsOccupied(HighWater - 1))
+        {
+            --HighWater;
+        }
+        std::erase_if(FreeIndices, [this](uint32 Index) { return Index >= HighWater; });
+
+        while (!Chunks.empty() && ChunkStart(static_cast<uint32>(Chunks.size()) - 1) >= HighWater)
+        {
+            ::operator delete(Chunks.back(), std::align_val_t(alignof(ElementType)));
+            Chunks.pop_back();
+            EntryCapacity = ChunkStart(static_cast<uint32>(Chunks.size()));
+        }
+        OccupiedBits.resize((EntryCapacity + 63) / 64);
+
+        const uint32 NewSlotCount = SlotCountFor(NumEntries);
+        if (NewSlotCount < SlotCount)
+        {
+            Rehash(NewSlotCount);
+        }
+    }
+
+    void swap(THashTable& Other) noexcept
+    {
+        std::swap(Slots, Other.Slots);
+        std::swap(SlotCount, Other.SlotCount);
+        std::swap(NumEntries, Other.NumEntries);
+        std::swap(HighWater, Other.HighWater);
+        std::swap(EntryCapacity, Other.EntryCapacity);
+        Chunks.swap(Other.Chunks);
+        OccupiedBits.swap(Other.OccupiedBits);
+        FreeIndices.swap(Other.FreeIndices);
+    }
+
+    /** UE 스타일 크기 관리 */
+    int32 Num() const { return static_cast<int32>(NumEntries); }
+    bool IsEmpty() const { return NumEntries == 0; }
+
+    /** 원소와 메모리를 모두 해제 (ExpectedNumElements > 0이면 그만큼 다시 확보) */
+    void Empty(int32 ExpectedNumElements = 0)
+    {
+        ReleaseStorage();
+        if (ExpectedNumElements > 0)
+        {
+            reserve(ExpectedNumElements);
+        }
+    }
+
+    /** 원소만 비우고 메모리는 유지 (매 프레임 다시 채우는 컨테이너용) */
+    void Reset() { clear(); }
+
+    void Reserve(int32 Number) { reserve(Number > 0 ? Number : 0); }
+    void Shrink() { shrink_to_fit(); }
+
+    /** 디버그/통계용 */
+    size_t GetAllocatedSize() const
+    {
+        return SlotCount * sizeof(FIndexSlot) + EntryCapacity * sizeof(ElementType)
+            + OccupiedBits.capacity() * sizeof(uint64) + FreeIndices.capacity() * sizeof(uint32);
+    }
+
+protected:
+    static constexpr uint32 InvalidIndex = UINT32_MAX;
+    static constexpr uint32 MinSlotCount = 8;
+    static constexpr uint32 FirstChunkBits = 3; // 첫 청크 8개, 이후 두 배씩
+
+    /** 인덱스 테이블 슬롯 (EntryIndex == InvalidIndex면 빈 칸) */
+    struct FIndexSlot
+    {
+        uint32 Hash = 0;
+        uint32 EntryIndex = InvalidIndex;
+    };
+
+    template<typename LookupType>
+    static uint32 HashKey(const LookupType& Key)
+    {
+        // std::hash는 정수/포인터에 항등 함수인 구현이 있으므로 곱셈으로 상위 비트까지 섞음
+        const uint64 Mixed = static_cast<uint64>(KeyTraits::Hash(Key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<uint32>(Mixed >> 32) ^ static_cast<uint32>(Mixed);
+    }
+
+    static uint32 ChunkOf(uint32 Index) { return static_cast<uint32>(std::bit_width(Index + (1u << FirstChunkBits))) - 1 - FirstChunkBits; }
+    static constexpr uint32 ChunkStart(uint32 Chunk) { return ((1u << Chunk) - 1) << FirstChunkBits; }
+
+    ElementType& GetEntry(uint32 Index) const
+    {
+        const uint32 Chunk = ChunkOf(Index);
+        return Chunks[Chunk][Index - ChunkStart(Chunk)];
+    }
+
+    /** 키를 찾으면 원소 인덱스, 없으면 HighWater (= end()) */
+    template<typename LookupType>
+    uint32 FindEntry(const LookupType& Key) const
+    {
+        if (NumEntries == 0)
+        {
+            return HighWater;
+        }
+        const uint32 SlotIndex = FindSlot(Key, HashKey(Key));
+        return SlotIndex != InvalidIndex ? Slots[SlotIndex].EntryIndex : HighWater;
+    }
+
+    template<typename LookupType>
+    ElementType* FindElement(const LookupType& Key) const
+    {
+        const uint32 SlotIndex = FindSlot(Key, HashKey(Key));
+        return SlotIndex != InvalidIndex ? &GetEntry(Slots[SlotIndex].EntryIndex) : nullptr;
+    }
+
+    template<typename LookupType>
+    uint32 FindSlot(const LookupType& Key, uint32 Hash) const
+    {
+        if (NumEntries == 0)
+        {
+            return InvalidIndex;
+        }
+
+        const uint32 Mask = SlotCount - 1;
+        uint32 Position = Hash & Mask;
+        for (uint32 Distance = 0;; ++Distance)
+        {
+            const FIndexSlot& Slot = Slots[Position];
+            if (Slot.EntryIndex == InvalidIndex || ((Position - Slot.Hash) & Mask) < Distance)
+            {
+                return InvalidIndex;
+            }
+            if (Slot.Hash == Hash && KeyTraits::Matches(KeyOf::Get(GetEntry(Slot.EntryIndex)), Key))
+            {
+                return Position;
+            }
+            Position = (Position + 1) & Mask;
+        }
+    }
+
+    /** 키 조회 후 없을 때만 원소 생성 (TMap::try_emplace, insert가 사용) */
+    template<typename LookupType, typename... ArgTypes>
+    std::pair<iterator, bool> InsertUnique(const LookupType& Key, ArgTypes&&... Args)
+    {
+        const uint32 Hash = HashKey(Key);
+        const uint32 SlotIndex = FindSlot(Key, Hash);
+        if (SlotIndex != InvalidIndex)
+        {
+            return { iterator(this, Slots[SlotIndex].EntryIndex), false };
+        }
+
+        const uint32 Index = ConstructEntry(std::forward<ArgTypes>(Args)...);
+        CommitEntry(Index, Hash);
+        return { iterator(this, Index), true };
+    }
+
+    template<typename LookupType>
+    size_type EraseKey(const LookupType& Key)
+    {
+        const uint32 Hash = HashKey(Key);
+        const uint32 SlotIndex = FindSlot(Key, Hash);
+        if (SlotIndex == InvalidIndex)
+        {
+            return 0;
+        }
+
+        const uint32 Index = Slots[SlotIndex].EntryIndex;
+        RemoveSlotAt(SlotIndex);
+        ReleaseEntry(Index);
+        --NumEntries;
+        return 1;
+    }
+
+private:
+    static constexpr uint32 MaxLoad(uint32 InSlotCount) { return InSlotCount - InSlotCount / 4; } // 최대 75%
+
+    static uint32 SlotCountFor(uint32 NumElements)
+    {
+        uint32 Count = MinSlotCount;
+        while (MaxLoad(Count) < NumElements)
+        {
+            Count <<= 1;
+        }
+        return Count;
+    }
+
+    bool IsOccupied(uint32 Index) const { return (OccupiedBits[Index >> 6] >> (Index & 63)) & 1; }
+
+    uint32 NextOccupied(uint32 Index) const
+    {
+        if (Index >= HighWater)
+        {
+            return HighWater;
+        }
+
+        uint32 Word = Index >> 6;
+        uint64 Bits = OccupiedBits[Word] & (~0ull << (Index & 63));
+        const uint32 LastWord = (HighWater - 1) >> 6;
+        while (Bits == 0)
+        {
+            if (++Word > LastWord)
+            {
+                return HighWater;
+            }
+            Bits = OccupiedBits[Word];
+        }
+        return (Word << 6) + static_cast<uint32>(std::countr_zero(Bits));
+    }
+
+    void AddChunk()
+    {
+        const uint32 ChunkSize = 1u << (static_cast<uint32>(Chunks.size()) + FirstChunkBits);
+        Chunks.push_back(static_cast<ElementType*>(::operator new(sizeof(ElementType) * ChunkSize, std::align_val_t(alignof(ElementType)))));
+        EntryCapacity += ChunkSize;
+        OccupiedBits.resize((EntryCapacity + 63) / 64, 0);
+    }
+
+    /** 빈 칸에 원소 생성 (아직 인덱스 테이블/순회 대상 아님) */
+    template<typename... ArgTypes>
+    uint32 ConstructEntry(ArgTypes&&... Args)
+    {
+        uint32 Index;
+        if (!FreeIndices.empty())
+        {
+            Index = FreeIndices.back();
+            FreeIndices.pop_back();
+        }
+        else
+        {
+            if (HighWater == EntryCapacity)
+            {
+                AddChunk();
+            }
+            Index = HighWater++;
+        }
+        ::new (static_cast<void*>(&GetEntry(Index))) ElementType(std::forward<ArgTypes>(Args)...);
+        return Index;
+    }
+
+    /** 생성된 원소를 인덱스 테이블에 올리고 순회 대상으로 표시 */
+    void CommitEntry(uint32 Index, uint32 Hash)
+    {
+        if (NumEntries + 1 > MaxLoad(SlotCount))
+        {
+            Rehash(SlotCountFor(NumEntries + 1));
+        }
+        InsertSlot(Hash, Index);
+        OccupiedBits[Index >> 6] |= (1ull << (Index & 63));
+        ++NumEntries;
+    }
+
+    void ReleaseEntry(uint32 Index)
+    {
+        GetEntry(Index).~ElementType();
+        OccupiedBits[Index >> 6] &= ~(1ull << (Index & 63));
+        FreeIndices.push_back(Index);
+    }
+
+    void InsertSlot(uint32 Hash, uint32 EntryIndex)
+    {
+        const uint32 Mask = SlotCount - 1;
+        FIndexSlot Incoming{ Hash, EntryIndex };
+        uint32 Position = Hash & Mask;
+        for (uint32 Distance = 0;; ++Distance)
+        {
+            FIndexSlot& Slot = Slots[Position];
+            if (Slot.EntryIndex == InvalidIndex)
+            {
+                Slot = Incoming;
+                return;
+            }
+
+            // 기존 슬롯이 자기 자리에 더 가까우면 자리를 뺏고 그 슬롯을 계속 밀어냄
+            const uint32 ResidentDistance = (Position - Slot.Hash) & Mask;
+            if (ResidentDistance < Distance)
+            {
+                std::swap(Slot, Incoming);
+                Distance = ResidentDistance;
+            }
+            Position = (Position + 1) & Mask;
+        }
+    }
+
+    void RemoveSlot(uint32 EntryIndex, uint32 Hash)
+    {
+        const uint32 Mask = SlotCount - 1;
+        uint32 Position = Hash & Mask;
+        while (Slots[Position].EntryIndex != EntryIndex)
+        {
+            Position = (Position + 1) & Mask;
+        }
+        RemoveSlotAt(Position);
+    }
+
+    /** 후방 이동 삭제: 뒤따르는 슬롯 중 제자리가 아닌 것들을 한 칸씩 당김 */
+    void RemoveSlotAt(uint32 Position)
+    {
+        const uint32 Mask = SlotCount - 1;
+        uint32 Next = (Position + 1) & Mask;
+        while (Slots[Next].EntryIndex != InvalidIndex && ((Next - Slots[Next].Hash) & Mask) != 0)
+        {
+            Slots[Position] = Slots[Next];
+            Position = Next;
+            Next = (Next + 1) & Mask;
+        }
+        Slots[Position] = FIndexSlot{};
+    }
+
+    void Rehash(uint32 NewSlotCount)
+    {
+        FIndexSlot* OldSlots = Slots;
+        const uint32 OldSlotCount = SlotCount;
+
+        Slots = new FIndexSlot[NewSlotCount];
+        SlotCount = NewSlotCount;
+        for (uint32 i = 0; i < OldSlotCount; ++i)
+        {
+            if (OldSlots[i].EntryIndex != InvalidIndex)
+            {
+                InsertSlot(OldSlots[i].Hash, OldSlots[i].EntryIndex);
+            }
+        }
+        delete[] OldSlots;
+    }
+
+    void DestroyEntries()
+    {
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+            for (uint32 Index = NextOccupied(0); Index < HighWater; Index = NextOccupied(Index + 1))
+            {
+                GetEntry(Index).~ElementType();
+            }
+        }
+        std::fill(OccupiedBits.begin(), OccupiedBits.end(), 0);
+        FreeIndices.clear();
+        HighWater = 0;
+        NumEntries = 0;
+    }
+
+    void ReleaseStorage()
+    {
+        DestroyEntries();
+        for (ElementType* Chunk : Chunks)
+        {
+            ::operator delete(Chunk, std::align_val_t(alignof(ElementType)));
+        }
+        delete[] Slots;
+
+        Slots = nullptr;
+        SlotCount = 0;
+        EntryCapacity = 0;
+        Chunks = {};
+        OccupiedBits = {};
+        FreeIndices = {};
+    }
+
+    void CopyFrom(const THashTable& Other)
+    {
+        if (Other.NumEntries == 0)
+        {
+            return;
+        }
+
+        // 키가 이미 유일하므로 조회 없이 원본 슬롯의 해시를 그대로 사용
+        reserve(Other.NumEntries);
+        for (uint32 i = 0; i < Other.SlotCount; ++i)
+        {
+            const FIndexSlot& Slot = Other.Slots[i];
+            if (Slot.EntryIndex != InvalidIndex)
+            {
+                CommitEntry(ConstructEntry(Other.GetEntry(Slot.EntryIndex)), Slot.Hash);
+            }
+        }
+    }
+
+    void MoveFrom(THashTable& Other)
+    {
+        Slots = std::exchange(Other.Slots, nullptr);
+        SlotCount = std::exchange(Other.SlotCount, 0);
+        NumEntries = std::exchange(Other.NumEntries, 0);
+        HighWater = std::exchange(Other.HighWater, 0);
+        EntryCapacity = std::exchange(Other.EntryCapacity, 0);
+        Chunks = std::move(Other.Chunks);
+        OccupiedBits = std::move(Other.OccupiedBits);
+        FreeIndices = std::move(Other.FreeIndices);
+        Other.Chunks.clear();
+        Other.OccupiedBits.clear();
+        Other.FreeIndices.clear();
+    }
+
+    FIndexSlot* Slots = nullptr;
+    uint32 SlotCount = 0;       // 0 또는 2의 거듭제곱
+    uint32 NumEntries = 0;
+    uint32 HighWater = 0;       // 한 번이라도 사용된 원소 인덱스 상한 (순회 끝)
+    uint32 EntryCapacity = 0;   // 청크 전체 칸 수
+    std::vector<ElementType*> Chunks;
+    std::vector<uint64> OccupiedBits;
+    std::vector<uint32> FreeIndices;
+};
@@ -19,44 +19,6 @@ typedef wchar_t WIDECHAR;
 typedef std::string FString;
 typedef std::wstring FWideString;
 
-// Lightweight weak object pointer compatible with engine UObject lifetime
-// - Stores a raw pointer (non-owning)
-// - Provides IsValid(), Get(), operators for containers
-// - Hash specialization provided below for unordered_map/set
-template<typename T>
-class TWeakObjectPtr
-{
-public:
-    using ElementType = T;
-
-    TWeakObjectPtr() : Ptr(nullptr) {}
-    TWeakObjectPtr(std::nullptr_t) : Ptr(nullptr) {}
-    explicit TWeakObjectPtr(T* InPtr) : Ptr(InPtr) {}
-
-    bool IsValid() const { return Ptr != nullptr; }
-    T* Get() const { return Ptr; }
-
-    T& operator*() const { return *Ptr; }
-    T* operator->() const { return Ptr; }
-
-    bool operator==(const TWeakObjectPtr& Other) const { return Ptr == Other.Ptr; }
-    bool operator!=(const TWeakObjectPtr& Other) const { return Ptr != Other.Ptr; }
-
-private:
-    T* Ptr;
-};
-
-namespace std {
-    template <typename T>
-    struct hash<TWeakObjectPtr<T>>
-    {
-        size_t operator()(const TWeakObjectPtr<T>& Key) const noexcept
-        {
-            return hash<const void*>()(static_cast<const void*>(Key.Get()));
-        }
-    };
-}
-
 template<typename T>
 using TUniqueObjectPtr = std::unique_ptr<T>;
 
@@ -71,12 +33,12 @@ using TPair = std::pair<T1, T2>;
 template<typename T, SIZE_T N>
 using TStaticArray = std::array<T, N>;
 
-/** TArray 구현 */
-template<typename T>
-class TArray : public std::vector<T>
+/** TArray 구현 (AllocatorType: 태그별 메모리 집계가 필요하면 TMemoryTagAllocator, MemoryManager.h의 TTaggedArray 참고) */
+template<typename T, typename AllocatorType = std::allocator<T>>
+class TArray : public std::vector<T, AllocatorType>
 {
 public:
-    using std::vector<T>::vector; /** 생성자 상속 */
+    using std::vector<T, AllocatorType>::vector; /** 생성자 상속 */
 
     /** 요소 추가 */
     int32 Add(const T& Item)
@@ -104,7 +66,7 @@ public:
     }
 
     /** 배열 병합 */
-    void Append(const TArray<T>& Other)
+    void Append(const TArray& Other)
     {
         this->insert(this->end(), Other.begin(), Other.end());
     }
@@ -276,12 +238,21 @@ public:
     }
 };
 
-/** TSet - 해시 기반 집합 */
+#include "HashTable.h"
+
+/**
+ * @brief TSet - 해시 기반 집합 (오픈 어드레싱, HashTable.h)
+ *
+ * std::unordered_set과 같은 인터페이스/참조 안정성을 유지합니다.
+ * FString 원소는 const char* / std::string_view로 바로 조회할 수 있습니다.
+ */
 template<typename T>
-class TSet : public std::unordered_set<T>
+class TSet : public THashTable<T, T, FHashSetKeyOf, true>
 {
+    using Super = THashTable<T, T, FHashSetKeyOf, true>;
+
 public:
-    using std::unordered_set<T>::unordered_set;
+    using Super::Super;
 
     /** 요소 추가 */
     void Add(const T& Item)
@@ -289,38 +260,40 @@ public:
         this->insert(Item);
     }
 
-    /** 제거 */
-    bool Remove(const T& Item)
+    void Add(T&& Item)
     {
-        return this->erase(Item) > 0;
+        this->insert(std::move(Item));
     }
 
-    /** 크기 관련 */
-    int32 Num() const
+    /** 제거 */
+    bool Remove(const T& Item)
     {
-        return static_cast<int32>(this->size());
+        return this->erase(Item) > 0;
     }
 
-    bool IsEmpty() const
+    template<typename LookupType> requires THashKeyTraits<T>::template bHeterogeneous<LookupType>
+    bool Remove(const LookupType& Item)
     {
-        return this->empty();
+        return this->erase(Item) > 0;
     }
 
-    void Empty()
+    /** 검색 */
+    bool Contains(const T& Item) const
     {
-        this->clear();
+        return this->contains(Item);
     }
 
-    /** 검색 */
-    bool Contains(const T& Item) const
+    template<typename LookupType> requires THashKeyTraits<T>::template bHeterogeneous<LookupType>
+    bool Contains(const LookupType& Item) const
     {
-        return this->find(Item) != this->end();
+        return this->contains(Item);
     }
 
     /** 집합 연산 */
     TSet<T> Union(const TSet<T>& Other) const
     {
         TSet<T> Result = *this;
+        Result.reserve(this->size() + Other.size());
         for (const auto& Item : Other)
         {
             Result.Add(Item);
@@ -365,25 +338,138 @@ public:
         }
         return Result;
     }
+
+    bool operator==(const TSet<T>& Other) const
+    {
+        if (this->size() != Other.size())
+        {
+            return false;
+        }
+        for (const auto& Item : *this)
+        {
+            if (!Other.Contains(Item))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
 };
 
-/** TMap - 해시 기반 연관 컨테이너 */
+/**
+ * @brief TMap - 해시 기반 연관 컨테이너 (오픈 어드레싱, HashTable.h)
+ *
+ * 원소는 std::pair<const KeyType, ValueType>이고 std::unordered_map과 같은 인터페이스/참조 안정성을 유지합니다.
+ * FString 키는 const char* / std::string_view로 바로 조회할 수 있습니다.
+ */
 template<typename KeyType, typename ValueType>
-class TMap : public std::unordered_map<KeyType, ValueType>
+class TMap : public THashTable<std::pair<const KeyType, ValueType>, KeyType, FHashMapKeyOf, false>
 {
+    using Super = THashTable<std::pair<const KeyType, ValueType>, KeyType, FHashMapKeyOf, false>;
+    using KeyTraits = THashKeyTraits<KeyType>;
+
 public:
-    using std::unordered_map<KeyType, ValueType>::unordered_map;
+    using mapped_type = ValueType;
+    using typename Super::iterator;
+    using typename Super::const_iterator;
+
+    using Super::Super;
+    using Super::emplace;
+
+    /** std::unordered_map 인터페이스 */
+    template<typename... ArgTypes>
+    std::pair<iterator, bool> try_emplace(const KeyType& Key, ArgTypes&&... Args)
+    {
+        return this->InsertUnique(Key, std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple(std::forward<ArgTypes>(Args)...));
+    }
+
+    template<typename... ArgTypes>
+    std::pair<iterator, bool> try_emplace(KeyType&& Key, ArgTypes&&... Args)
+    {
+        return this->InsertUnique(Key, std::piecewise_construct, std::forward_as_tuple(std::move(Key)), std::forward_as_tuple(std::forward<ArgTypes>(Args)...));
+    }
+
+    /** 키 타입이 정확히 같으면 조회 후 생성 (이미 있으면 값을 만들지 않음) */
+    template<typename InKeyType, typename InValueType> requires std::is_same_v<std::remove_cvref_t<InKeyType>, KeyType>
+    std::pair<iterator, bool> emplace(InKeyType&& Key, InValueType&& Value)
+    {
+        return try_emplace(std::forward<InKeyType>(Key), std::forward<InValueType>(Value));
+    }
+
+    template<typename InValueType>
+    std::pair<iterator, bool> insert_or_assign(const KeyType& Key, InValueType&& Value)
+    {
+        auto Result = try_emplace(Key, std::forward<InValueType>(Value));
+        if (!Result.second)
+        {
+            Result.first->second = std::forward<InValueType>(Value);
+        }
+        return Result;
+    }
+
+    using Super::insert;
+
+    template<typename PairType> requires std::is_constructible_v<std::pair<const KeyType, ValueType>, PairType&&>
+    std::pair<iterator, bool> insert(PairType&& Pair)
+    {
+        return this->emplace(std::forward<PairType>(Pair));
+    }
+
+    ValueType& operator[](const KeyType& Key)
+    {
+        return try_emplace(Key).first->second;
+    }
+
+    ValueType& operator[](KeyType&& Key)
+    {
+        return try_emplace(std::move(Key)).first->second;
+    }
+
+    ValueType& at(const KeyType& Key)
+    {
+        ValueType* Value = Find(Key);
+        if (!Value)
+        {
+            throw std::out_of_range("TMap::at - key not found");
+        }
+        return *Value;
+    }
+
+    const ValueType& at(const KeyType& Key) const
+    {
+        const ValueType* Value = Find(Key);
+        if (!Value)
+        {
+            throw std::out_of_range("TMap::at - key not found");
+        }
+        return *Value;
+    }
 
     /** 요소 추가/수정 */
-    void Add(const KeyType& Key, const ValueType& Value)
+    ValueType& Add(const KeyType& Key, const ValueType& Value)
     {
-        (*this)[Key] = Value;
+        return insert_or_assign(Key, Value).first->second;
+    }
+
+    ValueType& Add(KeyType&& Key, ValueType&& Value)
+    {
+        auto Result = try_emplace(std::move(Key), std::move(Value));
+        if (!Result.second)
+        {
+            Result.first->second = std::move(Value);
+        }
+        return Result.first->second;
     }
 
     template<typename... Args>
     void Emplace(const KeyType& Key, Args&&... args)
     {
-        this->emplace(Key, ValueType(std::forward<Args>(args)...));
+        try_emplace(Key, std::forward<Args>(args)...);
+    }
+
+    ValueType& FindOrAdd(const KeyType& Key)
+    {
+        return (*this)[Key];
     }
 
     /** 제거 */
@@ -392,45 +478,55 @@ public:
         return this->erase(Key) > 0;
     }
 
-    /** 크기 관련 */
-    int32 Num() const
+    template<typename LookupType> requires KeyTraits::template bHeterogeneous<LookupType>
+    bool Remove(const LookupType& Key)
     {
-        return static_cast<int32>(this->size());
+        return this->erase(Key) > 0;
     }
 
-    bool IsEmpty() const
+    /** 검색 */
+    bool Contains(const KeyType& Key) const
     {
-        return this->empty();
+        return this->contains(Key);
     }
 
-    void Empty()
+    template<typename LookupType> requires KeyTraits::template bHeterogeneous<LookupType>
+    bool Contains(const LookupType& Key) const
     {
-        this->clear();
+        return this->contains(Key);
     }
 
-    /** 검색 */
-    bool Contains(const KeyType& Key) const
+    ValueType* Find(const KeyType& Key)
     {
-        return this->find(Key) != this->end();
+        auto* Pair = this->FindElement(Key);
+        return Pair ? &Pair->second : nullptr;
     }
 
-    ValueType* Find(const KeyType& Key)
+    const ValueType* Find(const KeyType& Key) const
     {
-        auto it = this->find(Key);
-        return (it != this->end()) ? &it->second : nullptr;
+        const auto* Pair = this->FindElement(Key);
+        return Pair ? &Pair->second : nullptr;
     }
 
-    const ValueType* Find(const KeyType& Key) const
+    template<typename LookupType> requires KeyTraits::template bHeterogeneous<LookupType>
+    ValueType* Find(const LookupType& Key)
     {
-        auto it = this->find(Key);
-        return (it != this->end()) ? &it->second : nullptr;
+        auto* Pair = this->FindElement(Key);
+        return Pair ? &Pair->second : nullptr;
+    }
+
+    template<typename LookupType> requires KeyTraits::template bHeterogeneous<LookupType>
+    const ValueType* Find(const LookupType& Key) const
+    {
+        const auto* Pair = this->FindElement(Key);
+        return Pair ? &Pair->second : nullptr;
     }
 
     /** 찾거나 기본값 반환 */
     ValueType FindRef(const KeyType& Key) const
     {
-        auto it = this->find(Key);
-        return (it != this->end()) ? it->second : ValueType{};
+        const ValueType* Value = Find(Key);
+        return Value ? *Value : ValueType{};
     }
 
     /** 키/값 배열 반환 */
@@ -455,6 +551,23 @@ public:
         }
         return Values;
     }
+
+    bool operator==(const TMap& Other) const
+    {
+        if (this->size() != Other.size())
+        {
+            return false;
+        }
+        for (const auto& Pair : *this)
+        {
+            const ValueType* OtherValue = Other.Find(Pair.first);
+            if (!OtherValue || !(*OtherValue == Pair.second))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
 };
 
 /** TOrderedMap - 키(Key) 기준 정렬 맵 (std::map 래퍼) */
@@ -0,0 +1,143 @@
+#include "pch.h"
+#include "MathBatch.h"
+
+static_assert(sizeof(FVector) == sizeof(float) * 3, "FMathBatch assumes tightly packed FVector arrays");
+
+namespace
+{
+	// (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3) → X/Y/Z 레인
+	inline void LoadPoints4(const float* Src, __m128& OutX, __m128& OutY, __m128& OutZ)
+	{
+		const __m128 A = _mm_loadu_ps(Src);
+		const __m128 B = _mm_loadu_ps(Src + 4);
+		const __m128 C = _mm_loadu_ps(Src + 8);
+
+		OutX = _mm_shuffle_ps(A, _mm_shuffle_ps(B, C, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		OutY = _mm_shuffle_ps(_mm_shuffle_ps(A, B, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(B, C, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		OutZ = _mm_shuffle_ps(_mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 1, 2, 2)), C, _MM_SHUFFLE(3, 0, 2, 0));
+	}
+
+	inline void StorePoints4(float* Dst, const __m128& X, const __m128& Y, const __m128& Z)
+	{
+		const __m128 A = _mm_shuffle_ps(_mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(Z, X, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 B = _mm_shuffle_ps(_mm_shuffle_ps(Y, Z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(X, Y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 C = _mm_shuffle_ps(_mm_shuffle_ps(Z, X, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(Y, Z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		_mm_storeu_ps(Dst, A);
+		_mm_storeu_ps(Dst + 4, B);
+		_mm_storeu_ps(Dst + 8, C);
+	}
+
+	template<bool bWithTranslation>
+	void TransformPoints(const FMatrix& M, const FVector* In, FVector* Out, int32 Count)
+	{
+		const __m128 M00 = _mm_set1_ps(M.M[0][0]), M01 = _mm_set1_ps(M.M[0][1]), M02 = _mm_set1_ps(M.M[0][2]);
+		const __m128 M10 = _mm_set1_ps(M.M[1][0]), M11 = _mm_set1_ps(M.M[1][1]), M12 = _mm_set1_ps(M.M[1][2]);
+		const __m128 M20 = _mm_set1_ps(M.M[2][0]), M21 = _mm_set1_ps(M.M[2][1]), M22 = _mm_set1_ps(M.M[2][2]);
+		const __m128 M30 = _mm_set1_ps(bWithTranslation ? M.M[3][0] : 0.0f);
+		const __m128 M31 = _mm_set1_ps(bWithTranslation ? M.M[3][1] : 0.0f);
+		const __m128 M32 = _mm_set1_ps(bWithTranslation ? M.M[3][2] : 0.0f);
+
+		int32 Index = 0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			__m128 X, Y, Z;
+			LoadPoints4(&In[Index].X, X, Y, Z);
+
+			const __m128 OutX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M00), _mm_mul_ps(Y, M10)), _mm_add_ps(_mm_mul_ps(Z, M20), M30));
+			const __m128 OutY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M01), _mm_mul_ps(Y, M11)), _mm_add_ps(_mm_mul_ps(Z, M21), M31));
+			const __m128 OutZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M02), _mm_mul_ps(Y, M12)), _mm_add_ps(_mm_mul_ps(Z, M22), M32));
+
+			StorePoints4(&Out[Index].X, OutX, OutY, OutZ);
+		}
+
+		// 나머지 (스칼라)
+		for (; Index < Count; ++Index)
+		{
+			Out[Index] = bWithTranslation ? M.TransformPosition(In[Index]) : M.TransformVector(In[Index]);
+		}
+	}
+
+	// Row * B (row-vector 규약)
+	inline __m128 MultiplyRow(const __m128& Row, const FMatrix& B)
+	{
+		__m128 Result = _mm_mul_ps(FSimd::Splat<0>(Row), B.Rows[0]);
+		Result = _mm_add_ps(Result, _mm_mul_ps(FSimd::Splat<1>(Row), B.Rows[1]));
+		Result = _mm_add_ps(Result, _mm_mul_ps(FSimd::Splat<2>(Row), B.Rows[2]));
+		Result = _mm_add_ps(Result, _mm_mul_ps(FSimd::Splat<3>(Row), B.Rows[3]));
+		return Result;
+	}
+
+	inline void MultiplyMatrix(const FMatrix& A, const FMatrix& B, FMatrix& Out)
+	{
+#if defined(__AVX__)
+		// 두 행을 256비트 한 레지스터로 (B 행은 양쪽 128비트 레인에 복제)
+		const __m256 B0 = _mm256_broadcast_ps(&B.Rows[0]);
+		const __m256 B1 = _mm256_broadcast_ps(&B.Rows[1]);
+		const __m256 B2 = _mm256_broadcast_ps(&B.Rows[2]);
+		const __m256 B3 = _mm256_broadcast_ps(&B.Rows[3]);
+		for (int32 Half = 0; Half < 2; ++Half)
+		{
+			const __m256 Rows = _mm256_loadu_ps(&A.M[Half * 2][0]);
+			__m256 Result = _mm256_mul_ps(_mm256_permute_ps(Rows, 0x00), B0);
+			Result = _mm256_add_ps(Result, _mm256_mul_ps(_mm256_permute_ps(Rows, 0x55), B1));
+			Result = _mm256_add_ps(Result, _mm256_mul_ps(_mm256_permute_ps(Rows, 0xAA), B2));
+			Result = _mm256_add_ps(Result, _mm256_mul_ps(_mm256_permute_ps(Rows, 0xFF), B3));
+			_mm256_storeu_ps(&Out.M[Half * 2][0], Result);
+		}
+#else
+		// A와 Out이 같은 행렬이어도 되도록 결과를 모은 뒤 저장
+		const __m128 R0 = MultiplyRow(A.Rows[0], B);
+		const __m128 R1 = MultiplyRow(A.Rows[1], B);
+		const __m128 R2 = MultiplyRow(A.Rows[2], B);
+		const __m128 R3 = MultiplyRow(A.Rows[3], B);
+		Out.Rows[0] = R0;
+		Out.Rows[1] = R1;
+		Out.Rows[2] = R2;
+		Out.Rows[3] = R3;
+#endif
+	}
+}
+
+void FMathBatch::TransformPositions(const FMatrix& M, const FVector* In, FVector* Out, int32 Count)
+{
+	TransformPoints<true>(M, In, Out, Count);
+}
+
+void FMathBatch::TransformVectors(const FMatrix& M, const FVector* In, FVector* Out, int32 Count)
+{
+	TransformPoints<false>(M, In, Out, Count);
+}
+
+void FMathBatch::MultiplyMatrices(const FMatrix* A, const FMatrix* B, FMatrix* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		MultiplyMatrix(A[Index], B[Index], Out[Index]);
+	}
+}
+
+void FMathBatch::MultiplyMatrices(const FMatrix* A, const FMatrix& B, FMatrix* Out, int32 Count)
+{
+	// Out이 B를 덮어쓸 수 있으므로 복사본 사용
+	const FMatrix SharedB = B;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		MultiplyMatrix(A[Index], SharedB, Out[Index]);
+	}
+}
+
+void FMathBatch::ComposeTransforms(const FTransform* Parents, const FTransform* Children, FTransform* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Out[Index] = Parents[Index].GetWorldTransform(Children[Index]);
+	}
+}
+
+void FMathBatch::TransformsToMatrices(const FTransform* In, FMatrix* Out, int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Out[Index] = In[Index].ToMatrix();
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include "Vector.h"
+
+/**
+ * @brief FVector/FMatrix/FTransform 배열 단위 연산
+ *
+ * 단일 연산자를 반복 호출하는 것과 결과가 같으며(부동소수 오차 범위), 루프 안에서
+ * 행렬 행/스플랫을 한 번만 로드하고 네 점씩 SoA로 전치해 처리합니다.
+ * - SSE 경로가 기본, /arch:AVX 이상으로 빌드하면 행렬 곱은 두 행씩 256비트로 처리
+ * - 4개 단위로 나누어 떨어지지 않는 나머지는 단일 연산으로 처리
+ * - Out은 In과 같은 배열이어도 됨 (제자리 변환)
+ */
+struct FMathBatch
+{
+	/**
+	 * @brief Out[i] = FMatrix::TransformPosition(In[i]) (아핀, W 나눗셈 없음)
+	 */
+	static void TransformPositions(const FMatrix& M, const FVector* In, FVector* Out, int32 Count);
+
+	/**
+	 * @brief Out[i] = FMatrix::TransformVector(In[i]) (이동 성분 제외)
+	 */
+	static void TransformVectors(const FMatrix& M, const FVector* In, FVector* Out, int32 Count);
+
+	/**
+	 * @brief Out[i] = A[i] * B[i]
+	 */
+	static void MultiplyMatrices(const FMatrix* A, const FMatrix* B, FMatrix* Out, int32 Count);
+
+	/**
+	 * @brief Out[i] = A[i] * B (B 공통)
+	 */
+	static void MultiplyMatrices(const FMatrix* A, const FMatrix& B, FMatrix* Out, int32 Count);
+
+	/**
+	 * @brief Out[i] = Parents[i].GetWorldTransform(Children[i])
+	 */
+	static void ComposeTransforms(const FTransform* Parents, const FTransform* Children, FTransform* Out, int32 Count);
+
+	/**
+	 * @brief Out[i] = In[i].ToMatrix()
+	 */
+	static void TransformsToMatrices(const FTransform* In, FMatrix* Out, int32 Count);
+};
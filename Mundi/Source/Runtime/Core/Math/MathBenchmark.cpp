@@ -0,0 +1,483 @@
+#include "pch.h"
+#include "MathBenchmark.h"
+#include "MathBatch.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+
+namespace
+{
+	FVector RandomVector(FBenchmarkRandom& Random, float Extent)
+	{
+		return FVector(Random.Range(-Extent, Extent), Random.Range(-Extent, Extent), Random.Range(-Extent, Extent));
+	}
+
+	FQuat RandomQuat(FBenchmarkRandom& Random)
+	{
+		FQuat Q(Random.Range(-1.0f, 1.0f), Random.Range(-1.0f, 1.0f), Random.Range(-1.0f, 1.0f), Random.Range(-1.0f, 1.0f));
+		Q.Normalize();
+		return Q;
+	}
+
+	FTransform RandomTransform(FBenchmarkRandom& Random)
+	{
+		return FTransform(RandomVector(Random, 100.0f), RandomQuat(Random), FVector(Random.Range(0.5f, 2.0f), Random.Range(0.5f, 2.0f), Random.Range(0.5f, 2.0f)));
+	}
+
+	// ── 이전 스칼라 구현 (기준값) ──
+
+	FQuat LegacyQuatMultiply(const FQuat& A, const FQuat& Q)
+	{
+		return FQuat(
+			A.W * Q.X + A.X * Q.W + A.Y * Q.Z - A.Z * Q.Y,
+			A.W * Q.Y - A.X * Q.Z + A.Y * Q.W + A.Z * Q.X,
+			A.W * Q.Z + A.X * Q.Y - A.Y * Q.X + A.Z * Q.W,
+			A.W * Q.W - A.X * Q.X - A.Y * Q.Y - A.Z * Q.Z);
+	}
+
+	FQuat LegacyQuatNormalize(const FQuat& Q)
+	{
+		const float S = std::sqrt(Q.X * Q.X + Q.Y * Q.Y + Q.Z * Q.Z + Q.W * Q.W);
+		if (S <= KINDA_SMALL_NUMBER) return FQuat::Identity();
+		return FQuat(Q.X / S, Q.Y / S, Q.Z / S, Q.W / S);
+	}
+
+	FQuat LegacySlerp(const FQuat& A, const FQuat& B, float T)
+	{
+		float CosTheta = FQuat::Dot(A, B);
+		FQuat End = B;
+		if (CosTheta < 0.0f) { End = FQuat(-B.X, -B.Y, -B.Z, -B.W); CosTheta = -CosTheta; }
+		if (CosTheta > 1.0f - 1e-3f)
+		{
+			return LegacyQuatNormalize(FQuat(A.X + (End.X - A.X) * T, A.Y + (End.Y - A.Y) * T, A.Z + (End.Z - A.Z) * T, A.W + (End.W - A.W) * T));
+		}
+		const float Theta = std::acos(CosTheta);
+		const float SinTheta = std::sin(Theta);
+		const float W1 = std::sin((1.0f - T) * Theta) / SinTheta;
+		const float W2 = std::sin(T * Theta) / SinTheta;
+		return LegacyQuatNormalize(FQuat(A.X * W1 + End.X * W2, A.Y * W1 + End.Y * W2, A.Z * W1 + End.Z * W2, A.W * W1 + End.W * W2));
+	}
+
+	FQuat LegacyNlerp(const FQuat& A, const FQuat& B, float T)
+	{
+		const FQuat End = (FQuat::Dot(A, B) < 0.0f) ? FQuat(-B.X, -B.Y, -B.Z, -B.W) : B;
+		return LegacyQuatNormalize(FQuat(A.X + (End.X - A.X) * T, A.Y + (End.Y - A.Y) * T, A.Z + (End.Z - A.Z) * T, A.W + (End.W - A.W) * T));
+	}
+
+	FVector LegacyRotateVector(const FQuat& Q, const FVector& V)
+	{
+		const float N = Q.X * Q.X + Q.Y * Q.Y + Q.Z * Q.Z + Q.W * Q.W;
+		if (N <= KINDA_SMALL_NUMBER) return V;
+		const FVector T(2.0f * (Q.Y * V.Z - Q.Z * V.Y), 2.0f * (Q.Z * V.X - Q.X * V.Z), 2.0f * (Q.X * V.Y - Q.Y * V.X));
+		return FVector(
+			V.X + Q.W * T.X + (Q.Y * T.Z - Q.Z * T.Y),
+			V.Y + Q.W * T.Y + (Q.Z * T.X - Q.X * T.Z),
+			V.Z + Q.W * T.Z + (Q.X * T.Y - Q.Y * T.X));
+	}
+
+	FTransform LegacyCompose(const FTransform& Parent, const FTransform& Child)
+	{
+		FTransform Result;
+		Result.Rotation = LegacyQuatNormalize(LegacyQuatMultiply(Parent.Rotation, Child.Rotation));
+		Result.Scale3D = FVector(Parent.Scale3D.X * Child.Scale3D.X, Parent.Scale3D.Y * Child.Scale3D.Y, Parent.Scale3D.Z * Child.Scale3D.Z);
+		const FVector Scaled(Child.Translation.X * Parent.Scale3D.X, Child.Translation.Y * Parent.Scale3D.Y, Child.Translation.Z * Parent.Scale3D.Z);
+		Result.Translation = Parent.Translation + LegacyRotateVector(Parent.Rotation, Scaled);
+		return Result;
+	}
+
+	FMatrix LegacyInverse(const FMatrix& Src)
+	{
+		const float m00 = Src.M[0][0], m01 = Src.M[0][1], m02 = Src.M[0][2], m03 = Src.M[0][3];
+		const float m10 = Src.M[1][0], m11 = Src.M[1][1], m12 = Src.M[1][2], m13 = Src.M[1][3];
+		const float m20 = Src.M[2][0], m21 = Src.M[2][1], m22 = Src.M[2][2], m23 = Src.M[2][3];
+		const float m30 = Src.M[3][0], m31 = Src.M[3][1], m32 = Src.M[3][2], m33 = Src.M[3][3];
+
+		const float t0 = m22 * m33 - m23 * m32, t1 = m21 * m33 - m23 * m31, t2 = m21 * m32 - m22 * m31;
+		const float t3 = m20 * m33 - m23 * m30, t4 = m20 * m32 - m22 * m30, t5 = m20 * m31 - m21 * m30;
+
+		FMatrix Adj;
+		Adj.M[0][0] = (m11 * t0 - m12 * t1 + m13 * t2);
+		Adj.M[0][1] = -(m10 * t0 - m12 * t3 + m13 * t4);
+		Adj.M[0][2] = (m10 * t1 - m11 * t3 + m13 * t5);
+		Adj.M[0][3] = -(m10 * t2 - m11 * t4 + m12 * t5);
+
+		const float Det = m00 * Adj.M[0][0] + m01 * Adj.M[0][1] + m02 * Adj.M[0][2] + m03 * Adj.M[0][3];
+		if (std::fabs(Det) < KINDA_SMALL_NUMBER) return FMatrix::Identity();
+		const float InvDet = 1.0f / Det;
+
+		const float t12 = m02 * m13 - m03 * m12, t13 = m01 * m13 - m03 * m11, t14 = m01 * m12 - m02 * m11;
+		const float t15 = m00 * m13 - m03 * m10, t16 = m00 * m12 - m02 * m10, t17 = m00 * m11 - m01 * m10;
+
+		Adj.M[1][0] = -(m01 * t0 - m02 * t1 + m03 * t2);
+		Adj.M[1][1] = (m00 * t0 - m02 * t3 + m03 * t4);
+		Adj.M[1][2] = -(m00 * t1 - m01 * t3 + m03 * t5);
+		Adj.M[1][3] = (m00 * t2 - m01 * t4 + m02 * t5);
+		Adj.M[2][0] = (m31 * t12 - m32 * t13 + m33 * t14);
+		Adj.M[2][1] = -(m30 * t12 - m32 * t15 + m33 * t16);
+		Adj.M[2][2] = (m30 * t13 - m31 * t15 + m33 * t17);
+		Adj.M[2][3] = -(m30 * t14 - m31 * t16 + m32 * t17);
+		Adj.M[3][0] = -(m21 * t12 - m22 * t13 + m23 * t14);
+		Adj.M[3][1] = (m20 * t12 - m22 * t15 + m23 * t16);
+		Adj.M[3][2] = -(m20 * t13 - m21 * t15 + m23 * t17);
+		Adj.M[3][3] = (m20 * t14 - m21 * t16 + m22 * t17);
+
+		FMatrix Out;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Col = 0; Col < 4; ++Col)
+			{
+				Out.M[Row][Col] = Adj.M[Col][Row] * InvDet;
+			}
+		}
+		return Out;
+	}
+
+	FMatrix LegacyInverseAffine(const FMatrix& Src)
+	{
+		const float A00 = Src.M[0][0], A01 = Src.M[0][1], A02 = Src.M[0][2];
+		const float A10 = Src.M[1][0], A11 = Src.M[1][1], A12 = Src.M[1][2];
+		const float A20 = Src.M[2][0], A21 = Src.M[2][1], A22 = Src.M[2][2];
+
+		const float Det = A00 * (A11 * A22 - A12 * A21) - A01 * (A10 * A22 - A12 * A20) + A02 * (A10 * A21 - A11 * A20);
+		if (std::fabs(Det) < KINDA_SMALL_NUMBER) return FMatrix::Identity();
+		const float InvDet = 1.0f / Det;
+
+		FMatrix Out = FMatrix::Identity();
+		Out.M[0][0] = (A11 * A22 - A12 * A21) * InvDet;
+		Out.M[0][1] = -(A01 * A22 - A02 * A21) * InvDet;
+		Out.M[0][2] = (A01 * A12 - A02 * A11) * InvDet;
+		Out.M[1][0] = -(A10 * A22 - A12 * A20) * InvDet;
+		Out.M[1][1] = (A00 * A22 - A02 * A20) * InvDet;
+		Out.M[1][2] = -(A00 * A12 - A02 * A10) * InvDet;
+		Out.M[2][0] = (A10 * A21 - A11 * A20) * InvDet;
+		Out.M[2][1] = -(A00 * A21 - A01 * A20) * InvDet;
+		Out.M[2][2] = (A00 * A11 - A01 * A10) * InvDet;
+
+		const FVector T(Src.M[3][0], Src.M[3][1], Src.M[3][2]);
+		for (int32 Col = 0; Col < 3; ++Col)
+		{
+			Out.M[3][Col] = -(T.X * Out.M[0][Col] + T.Y * Out.M[1][Col] + T.Z * Out.M[2][Col]);
+		}
+		return Out;
+	}
+
+	FMatrix LegacyToMatrix(const FTransform& Transform)
+	{
+		const FQuat& Q = Transform.Rotation;
+		const float XX = Q.X * Q.X, YY = Q.Y * Q.Y, ZZ = Q.Z * Q.Z;
+		const float XY = Q.X * Q.Y, XZ = Q.X * Q.Z, YZ = Q.Y * Q.Z;
+		const float WX = Q.W * Q.X, WY = Q.W * Q.Y, WZ = Q.W * Q.Z;
+
+		// 이전 구현은 열 기준으로 만든 뒤 Transpose
+		FMatrix R = FMatrix(
+			1.0f - 2.0f * (YY + ZZ), 2.0f * (XY - WZ), 2.0f * (XZ + WY), 0.0f,
+			2.0f * (XY + WZ), 1.0f - 2.0f * (XX + ZZ), 2.0f * (YZ - WX), 0.0f,
+			2.0f * (XZ - WY), 2.0f * (YZ + WX), 1.0f - 2.0f * (XX + YY), 0.0f,
+			0.0f, 0.0f, 0.0f, 1.0f).Transpose();
+		for (int32 Col = 0; Col < 3; ++Col)
+		{
+			R.M[0][Col] *= Transform.Scale3D.X;
+			R.M[1][Col] *= Transform.Scale3D.Y;
+			R.M[2][Col] *= Transform.Scale3D.Z;
+		}
+		R.M[3][0] = Transform.Translation.X;
+		R.M[3][1] = Transform.Translation.Y;
+		R.M[3][2] = Transform.Translation.Z;
+		return R;
+	}
+
+	// ── 오차 측정 ──
+
+	float MaxError(const FQuat& A, const FQuat& B)
+	{
+		// q와 -q는 같은 회전
+		const float Sign = FQuat::Dot(A, B) < 0.0f ? -1.0f : 1.0f;
+		return FMath::Max(std::fabs(A.X - B.X * Sign), std::fabs(A.Y - B.Y * Sign), std::fabs(A.Z - B.Z * Sign), std::fabs(A.W - B.W * Sign));
+	}
+
+	float MaxError(const FVector& A, const FVector& B)
+	{
+		return FMath::Max(std::fabs(A.X - B.X), std::fabs(A.Y - B.Y), std::fabs(A.Z - B.Z));
+	}
+
+	// 행렬은 성분 크기에 대한 상대 오차
+	float MaxError(const FMatrix& A, const FMatrix& B)
+	{
+		float Error = 0.0f;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Col = 0; Col < 4; ++Col)
+			{
+				Error = FMath::Max(Error, std::fabs(A.M[Row][Col] - B.M[Row][Col]) / FMath::Max(1.0f, std::fabs(B.M[Row][Col])));
+			}
+		}
+		return Error;
+	}
+
+	float MaxError(const FTransform& A, const FTransform& B)
+	{
+		return FMath::Max(MaxError(A.Translation, B.Translation) / FMath::Max(1.0f, B.Translation.Size()),
+			MaxError(A.Rotation, B.Rotation), MaxError(A.Scale3D, B.Scale3D));
+	}
+
+	void LogValidation(const char* Name, float Error, float Tolerance)
+	{
+		UE_LOG("[MathBenchmark] Validate %-28s max err %.2e  %s", Name, Error, Error <= Tolerance ? "PASS" : "FAIL");
+	}
+
+	void LogScenario(const char* Name, uint64 Operations, double LegacyMS, double NewMS)
+	{
+		const double Speedup = NewMS > 0.0 ? LegacyMS / NewMS : 0.0;
+		const double Mops = NewMS > 0.0 ? static_cast<double>(Operations) / (NewMS * 1000.0) : 0.0;
+		UE_LOG("[MathBenchmark] %-28s %10.2f %10.2f %7.2fx %9.1f", Name, LegacyMS, NewMS, Speedup, Mops);
+	}
+
+	volatile float GBenchmarkSink = 0.0f;
+}
+
+void FMathBenchmark::RunAndLog()
+{
+	constexpr int32 NumItems = 4096;
+	constexpr int32 NumRounds = 64;
+	constexpr uint64 NumOps = static_cast<uint64>(NumItems) * NumRounds;
+
+	FBenchmarkRandom Random(0x1234567u);
+	TArray<FQuat> QuatsA, QuatsB;
+	TArray<FTransform> Parents, Children, Composed;
+	TArray<FMatrix> Matrices, AffineMatrices, Results;
+	TArray<FVector> Points, PointResults;
+	TArray<float> Alphas;
+	QuatsA.reserve(NumItems); QuatsB.reserve(NumItems);
+	Parents.reserve(NumItems); Children.reserve(NumItems);
+	Matrices.reserve(NumItems); AffineMatrices.reserve(NumItems);
+	Points.reserve(NumItems); Alphas.reserve(NumItems);
+
+	for (int32 Index = 0; Index < NumItems; ++Index)
+	{
+		QuatsA.Add(RandomQuat(Random));
+		// 일부는 Slerp 근접(Nlerp) 분기를 타도록 거의 같은 회전
+		QuatsB.Add((Index % 8 == 0) ? QuatsA[Index] * FQuat::FromAxisAngle(FVector(0, 0, 1), 1e-3f) : RandomQuat(Random));
+		Parents.Add(RandomTransform(Random));
+		Children.Add(RandomTransform(Random));
+		AffineMatrices.Add(Parents[Index].ToMatrix());
+
+		FMatrix General;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Col = 0; Col < 4; ++Col)
+			{
+				General.M[Row][Col] = Random.Range(-2.0f, 2.0f) + (Row == Col ? 4.0f : 0.0f);
+			}
+		}
+		Matrices.Add(General);
+		Points.Add(RandomVector(Random, 100.0f));
+		Alphas.Add(Random.Range(0.0f, 1.0f));
+	}
+	Composed.SetNum(NumItems);
+	Results.SetNum(NumItems);
+	PointResults.SetNum(NumItems);
+
+	// ── 검증 ──
+	{
+		float QuatMulError = 0.0f, SlerpError = 0.0f, NlerpError = 0.0f, InverseError = 0.0f, AffineError = 0.0f;
+		float ComposeError = 0.0f, ToMatrixError = 0.0f, RotateError = 0.0f;
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			QuatMulError = FMath::Max(QuatMulError, MaxError(QuatsA[Index] * QuatsB[Index], LegacyQuatMultiply(QuatsA[Index], QuatsB[Index])));
+			SlerpError = FMath::Max(SlerpError, MaxError(FQuat::Slerp(QuatsA[Index], QuatsB[Index], Alphas[Index]), LegacySlerp(QuatsA[Index], QuatsB[Index], Alphas[Index])));
+			NlerpError = FMath::Max(NlerpError, MaxError(FQuat::Nlerp(QuatsA[Index], QuatsB[Index], Alphas[Index]), LegacyNlerp(QuatsA[Index], QuatsB[Index], Alphas[Index])));
+			RotateError = FMath::Max(RotateError, MaxError(QuatsA[Index].RotateVector(Points[Index]), LegacyRotateVector(QuatsA[Index], Points[Index])) / 100.0f);
+			InverseError = FMath::Max(InverseError, MaxError(Matrices[Index].Inverse(), LegacyInverse(Matrices[Index])));
+			AffineError = FMath::Max(AffineError, MaxError(AffineMatrices[Index].InverseAffine(), LegacyInverseAffine(AffineMatrices[Index])));
+			ComposeError = FMath::Max(ComposeError, MaxError(Parents[Index].GetWorldTransform(Children[Index]), LegacyCompose(Parents[Index], Children[Index])));
+			ToMatrixError = FMath::Max(ToMatrixError, MaxError(Parents[Index].ToMatrix(), LegacyToMatrix(Parents[Index])));
+		}
+
+		FMathBatch::TransformPositions(AffineMatrices[0], Points.GetData(), PointResults.GetData(), NumItems - 1);
+		float BatchPointError = 0.0f;
+		for (int32 Index = 0; Index < NumItems - 1; ++Index)
+		{
+			BatchPointError = FMath::Max(BatchPointError, MaxError(PointResults[Index], AffineMatrices[0].TransformPosition(Points[Index])) / 100.0f);
+		}
+
+		FMathBatch::MultiplyMatrices(Matrices.GetData(), AffineMatrices.GetData(), Results.GetData(), NumItems);
+		float BatchMatrixError = 0.0f;
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			BatchMatrixError = FMath::Max(BatchMatrixError, MaxError(Results[Index], Matrices[Index] * AffineMatrices[Index]));
+		}
+
+		FMathBatch::ComposeTransforms(Parents.GetData(), Children.GetData(), Composed.GetData(), NumItems);
+		float BatchComposeError = 0.0f;
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			BatchComposeError = FMath::Max(BatchComposeError, MaxError(Composed[Index], LegacyCompose(Parents[Index], Children[Index])));
+		}
+
+		constexpr float Tolerance = 1e-4f;
+		LogValidation("FQuat operator*", QuatMulError, Tolerance);
+		LogValidation("FQuat::Slerp", SlerpError, Tolerance);
+		LogValidation("FQuat::Nlerp", NlerpError, Tolerance);
+		LogValidation("FQuat::RotateVector", RotateError, Tolerance);
+		LogValidation("FMatrix::Inverse", InverseError, Tolerance);
+		LogValidation("FMatrix::InverseAffine", AffineError, Tolerance);
+		LogValidation("FTransform::GetWorldTransform", ComposeError, Tolerance);
+		LogValidation("FTransform::ToMatrix", ToMatrixError, Tolerance);
+		LogValidation("FMathBatch::TransformPositions", BatchPointError, Tolerance);
+		LogValidation("FMathBatch::MultiplyMatrices", BatchMatrixError, Tolerance);
+		LogValidation("FMathBatch::ComposeTransforms", BatchComposeError, Tolerance);
+	}
+
+	// ── 처리량 ──
+	UE_LOG("[MathBenchmark] %-28s %10s %10s %8s %9s", "Scenario", "old(ms)", "new(ms)", "Speedup", "Mops/s");
+
+	{
+		float Sink = 0.0f;
+		const double LegacyMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					Sink += LegacyQuatMultiply(QuatsA[Index], QuatsB[Index]).W;
+		});
+		const double NewMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					Sink += (QuatsA[Index] * QuatsB[Index]).W;
+		});
+		GBenchmarkSink = Sink;
+		LogScenario("Quat multiply", NumOps, LegacyMS, NewMS);
+	}
+
+	{
+		float Sink = 0.0f;
+		const double LegacyMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					Sink += LegacySlerp(QuatsA[Index], QuatsB[Index], Alphas[Index]).W;
+		});
+		const double NewMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					Sink += FQuat::Slerp(QuatsA[Index], QuatsB[Index], Alphas[Index]).W;
+		});
+		GBenchmarkSink = Sink;
+		LogScenario("Quat slerp", NumOps, LegacyMS, NewMS);
+	}
+
+	{
+		float Sink = 0.0f;
+		const double LegacyMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					Sink += LegacyNlerp(QuatsA[Index], QuatsB[Index], Alphas[Index]).W;
+		});
+		const double NewMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					Sink += FQuat::Nlerp(QuatsA[Index], QuatsB[Index], Alphas[Index]).W;
+		});
+		GBenchmarkSink = Sink;
+		LogScenario("Quat nlerp", NumOps, LegacyMS, NewMS);
+	}
+
+	{
+		const double LegacyMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					Results[Index] = LegacyInverse(Matrices[Index]);
+		});
+		const double NewMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					Results[Index] = Matrices[Index].Inverse();
+		});
+		LogScenario("Matrix inverse", NumOps, LegacyMS, NewMS);
+	}
+
+	{
+		const double LegacyMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					Results[Index] = LegacyInverseAffine(AffineMatrices[Index]);
+		});
+		const double NewMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					Results[Index] = AffineMatrices[Index].InverseAffine();
+		});
+		LogScenario("Matrix inverse affine", NumOps, LegacyMS, NewMS);
+	}
+
+	{
+		const double LegacyMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					Composed[Index] = LegacyCompose(Parents[Index], Children[Index]);
+		});
+		const double NewMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				FMathBatch::ComposeTransforms(Parents.GetData(), Children.GetData(), Composed.GetData(), NumItems);
+		});
+		LogScenario("Transform compose (batch)", NumOps, LegacyMS, NewMS);
+	}
+
+	{
+		const double LegacyMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					Results[Index] = LegacyToMatrix(Parents[Index]);
+		});
+		const double NewMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				FMathBatch::TransformsToMatrices(Parents.GetData(), Results.GetData(), NumItems);
+		});
+		LogScenario("Transform to matrix (batch)", NumOps, LegacyMS, NewMS);
+	}
+
+	{
+		const FMatrix& Shared = AffineMatrices[0];
+		const double LegacyMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					PointResults[Index] = Shared.TransformPosition(Points[Index]);
+		});
+		const double NewMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				FMathBatch::TransformPositions(Shared, Points.GetData(), PointResults.GetData(), NumItems);
+		});
+		LogScenario("Transform points (batch)", NumOps, LegacyMS, NewMS);
+	}
+
+	{
+		const double LegacyMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (int32 Index = 0; Index < NumItems; ++Index)
+					Results[Index] = Matrices[Index] * AffineMatrices[Index];
+		});
+		const double NewMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				FMathBatch::MultiplyMatrices(Matrices.GetData(), AffineMatrices.GetData(), Results.GetData(), NumItems);
+		});
+		LogScenario("Matrix multiply (batch)", NumOps, LegacyMS, NewMS);
+	}
+}
+
+static const bool bMathBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"MATH BENCH", "-mathbench", "SIMD math validation and benchmark (scalar vs SSE)", EBenchmarkStage::None,
+	[](const FString&) { FMathBenchmark::RunAndLog(); } });
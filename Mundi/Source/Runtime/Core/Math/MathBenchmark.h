@@ -0,0 +1,14 @@
+#pragma once
+
+/**
+ * @brief SIMD 수학 검증 + 벤치마크 (콘솔 MATH BENCH 명령)
+ *
+ * 이전 스칼라 구현(쿼터니언 곱/Slerp/Nlerp, 수반행렬 역행렬, 아핀 역행렬, FTransform 합성)을
+ * 기준으로 삼아 무작위 입력에서 현재 SIMD 구현과의 최대 오차를 먼저 검사하고(PASS/FAIL),
+ * 이어서 같은 입력으로 처리량을 비교합니다. FMathBatch 배열 연산은 단일 연산 루프와 비교합니다.
+ */
+class FMathBenchmark
+{
+public:
+	static void RunAndLog();
+};
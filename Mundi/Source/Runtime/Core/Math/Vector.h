@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <string>
 #include <limits>
+#include <immintrin.h>
 
 #include "UEContainer.h"
 #include "Archive.h"
@@ -438,6 +439,101 @@ struct alignas(16) FVector4
 
 };
 
+// ─────────────────────────────
+// FSimd (FQuat/FMatrix/FTransform 내부 SSE 보조 함수)
+// 쿼터니언은 (X, Y, Z, W), 벡터는 (X, Y, Z, 0) 레인 순서
+// ─────────────────────────────
+namespace FSimd
+{
+	inline __m128 LoadVector3(const FVector& V) { return _mm_set_ps(0.0f, V.Z, V.Y, V.X); }
+
+	inline FVector StoreVector3(const __m128& V)
+	{
+		alignas(16) float Out[4];
+		_mm_store_ps(Out, V);
+		return FVector(Out[0], Out[1], Out[2]);
+	}
+
+	template<int Lane>
+	inline __m128 Splat(const __m128& V) { return _mm_shuffle_ps(V, V, _MM_SHUFFLE(Lane, Lane, Lane, Lane)); }
+
+	inline __m128 Negate(const __m128& V) { return _mm_xor_ps(V, _mm_set1_ps(-0.0f)); }
+
+	// 네 성분 내적 (모든 레인에 같은 값)
+	inline __m128 Dot4(const __m128& A, const __m128& B)
+	{
+		const __m128 Mul = _mm_mul_ps(A, B);
+		const __m128 Sum = _mm_add_ps(Mul, _mm_shuffle_ps(Mul, Mul, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(Sum, _mm_shuffle_ps(Sum, Sum, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	// XYZ 외적 (결과 W = 0)
+	inline __m128 Cross3(const __m128& A, const __m128& B)
+	{
+		const __m128 AYZX = _mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 BYZX = _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 C = _mm_sub_ps(_mm_mul_ps(A, BYZX), _mm_mul_ps(AYZX, B));
+		return _mm_shuffle_ps(C, C, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	// 해밀턴 곱 A * B (FQuat::operator*와 같은 규약)
+	inline __m128 QuatMultiply(const __m128& A, const __m128& B)
+	{
+		const __m128 SignXZ = _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f);
+		const __m128 SignZW = _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f);
+		const __m128 SignXW = _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f);
+
+		__m128 Result = _mm_mul_ps(Splat<3>(A), B);
+		Result = _mm_add_ps(Result, _mm_xor_ps(_mm_mul_ps(Splat<0>(A), _mm_shuffle_ps(B, B, _MM_SHUFFLE(0, 1, 2, 3))), SignXZ));
+		Result = _mm_add_ps(Result, _mm_xor_ps(_mm_mul_ps(Splat<1>(A), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 0, 3, 2))), SignZW));
+		Result = _mm_add_ps(Result, _mm_xor_ps(_mm_mul_ps(Splat<2>(A), _mm_shuffle_ps(B, B, _MM_SHUFFLE(2, 3, 0, 1))), SignXW));
+		return Result;
+	}
+
+	// v' = v + W * t + cross(q.xyz, t),  t = 2 * cross(q.xyz, v)
+	inline __m128 QuatRotateVector(const __m128& Q, const __m128& V)
+	{
+		const __m128 T = Cross3(Q, V);
+		const __m128 T2 = _mm_add_ps(T, T);
+		return _mm_add_ps(_mm_add_ps(V, _mm_mul_ps(Splat<3>(Q), T2)), Cross3(Q, T2));
+	}
+
+	// 크기가 KINDA_SMALL_NUMBER 이하이면 단위 쿼터니언 (FQuat::Normalize와 같은 규칙)
+	inline __m128 QuatNormalize(const __m128& Q)
+	{
+		const float Size = std::sqrt(_mm_cvtss_f32(Dot4(Q, Q)));
+		if (Size <= KINDA_SMALL_NUMBER)
+		{
+			return _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+		}
+		return _mm_div_ps(Q, _mm_set1_ps(Size));
+	}
+
+	// 2x2 행렬 (m00, m01, m10, m11) 연산 - FMatrix::Inverse의 블록 분할용
+	inline __m128 Mat2Mul(const __m128& A, const __m128& B)
+	{
+		return _mm_add_ps(
+			_mm_mul_ps(A, _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 3, 0))),
+			_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2))));
+	}
+
+	// adj(A) * B
+	inline __m128 Mat2AdjMul(const __m128& A, const __m128& B)
+	{
+		return _mm_sub_ps(
+			_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(0, 0, 3, 3)), B),
+			_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 0, 3, 2))));
+	}
+
+	// A * adj(B)
+	inline __m128 Mat2MulAdj(const __m128& A, const __m128& B)
+	{
+		return _mm_sub_ps(
+			_mm_mul_ps(A, _mm_shuffle_ps(B, B, _MM_SHUFFLE(0, 3, 0, 3))),
+			_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2))));
+	}
+}
+
 // Quaternion 정규화(+w 기준 캐논화)
 inline void NormalizeQuat(float& x, float& y, float& z, float& w)
 {
@@ -461,15 +557,18 @@ struct FQuat
 
 	static FQuat Identity() { return FQuat(0, 0, 0, 1); }
 
+	__m128 ToSimd() const { return _mm_loadu_ps(&X); }
+	static FQuat FromSimd(const __m128& V)
+	{
+		FQuat Quat;
+		_mm_storeu_ps(&Quat.X, V);
+		return Quat;
+	}
+
 	// 곱 (회전 누적)
 	FQuat operator*(const FQuat& Q) const
 	{
-		return FQuat(
-			W * Q.X + X * Q.W + Y * Q.Z - Z * Q.Y,
-			W * Q.Y - X * Q.Z + Y * Q.W + Z * Q.X,
-			W * Q.Z + X * Q.Y - Y * Q.X + Z * Q.W,
-			W * Q.W - X * Q.X - Y * Q.Y - Z * Q.Z
-		);
+		return FromSimd(FSimd::QuatMultiply(ToSimd(), Q.ToSimd()));
 	}
 
 	static float Dot(const FQuat& A, const FQuat& B)
@@ -626,24 +725,18 @@ struct FQuat
 	// Slerp
 	static FQuat Slerp(const FQuat& A, const FQuat& B, float T)
 	{
-		float CosTheta = Dot(A, B);
-		FQuat End = B;
+		const __m128 QA = A.ToSimd();
+		__m128 End = B.ToSimd();
+		float CosTheta = _mm_cvtss_f32(FSimd::Dot4(QA, End));
 
 		// 가장 짧은 호
-		if (CosTheta < 0.0f) { End = FQuat(-B.X, -B.Y, -B.Z, -B.W); CosTheta = -CosTheta; }
+		if (CosTheta < 0.0f) { End = FSimd::Negate(End); CosTheta = -CosTheta; }
 
 		// 근접하면 Nlerp
 		const float SLERP_EPS = 1e-3f;
 		if (CosTheta > 1.0f - SLERP_EPS)
 		{
-			FQuat r = FQuat(
-				A.X + (End.X - A.X) * T,
-				A.Y + (End.Y - A.Y) * T,
-				A.Z + (End.Z - A.Z) * T,
-				A.W + (End.W - A.W) * T
-			);
-			r.Normalize();
-			return r;
+			return FromSimd(FSimd::QuatNormalize(_mm_add_ps(QA, _mm_mul_ps(_mm_sub_ps(End, QA), _mm_set1_ps(T)))));
 		}
 
 		float Theta = std::acos(CosTheta);
@@ -651,21 +744,16 @@ struct FQuat
 		float W1 = std::sin((1.0f - T) * Theta) / SinTheta;
 		float W2 = std::sin(T * Theta) / SinTheta;
 
-		FQuat Quat = A * W1 + End * W2;
-		Quat.Normalize();
-		return Quat;
+		return FromSimd(FSimd::QuatNormalize(_mm_add_ps(_mm_mul_ps(QA, _mm_set1_ps(W1)), _mm_mul_ps(End, _mm_set1_ps(W2)))));
 	}
 
 	// 보조: 선형 보간 후 정규화
 	static FQuat Nlerp(const FQuat& A, const FQuat& B, float T)
 	{
-		FQuat End = (Dot(A, B) < 0.0f) ? FQuat(-B.X, -B.Y, -B.Z, -B.W) : B;
-		FQuat Quat(A.X + (End.X - A.X) * T,
-			A.Y + (End.Y - A.Y) * T,
-			A.Z + (End.Z - A.Z) * T,
-			A.W + (End.W - A.W) * T);
-		Quat.Normalize();
-		return Quat;
+		const __m128 QA = A.ToSimd();
+		__m128 End = B.ToSimd();
+		if (_mm_cvtss_f32(FSimd::Dot4(QA, End)) < 0.0f) { End = FSimd::Negate(End); }
+		return FromSimd(FSimd::QuatNormalize(_mm_add_ps(QA, _mm_mul_ps(_mm_sub_ps(End, QA), _mm_set1_ps(T)))));
 	}
 
 	// 비교 연산자
@@ -794,46 +882,27 @@ struct alignas(16) FMatrix
 	// Affine 역행렬 (마지막 행 = [0,0,0,1] 가정)
 	FMatrix InverseAffine() const
 	{
-		// 상단 3x3 역행렬
-		float A00 = M[0][0], A01 = M[0][1], A02 = M[0][2];
-		float A10 = M[1][0], A11 = M[1][1], A12 = M[1][2];
-		float A20 = M[2][0], A21 = M[2][1], A22 = M[2][2];
+		// 상단 3x3의 역행렬 열 = 행끼리의 외적 / Det
+		const __m128 C0 = FSimd::Cross3(Rows[1], Rows[2]);
+		const __m128 C1 = FSimd::Cross3(Rows[2], Rows[0]);
+		const __m128 C2 = FSimd::Cross3(Rows[0], Rows[1]);
 
-		float Det = A00 * (A11 * A22 - A12 * A21) - A01 * (A10 * A22 - A12 * A20) + A02 * (A10 * A21 - A11 * A20);
+		const __m128 Row0XYZ = _mm_and_ps(Rows[0], _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0)));
+		const float Det = _mm_cvtss_f32(FSimd::Dot4(Row0XYZ, C0));
 		if (std::fabs(Det) < KINDA_SMALL_NUMBER) return Identity();
-		float InvDet = 1.0f / Det;
-
-		// Rinv = R^{-1}
-		FMatrix InvMat = Identity();
-		InvMat.M[0][0] = (A11 * A22 - A12 * A21) * InvDet;
-		InvMat.M[0][1] = -(A01 * A22 - A02 * A21) * InvDet;
-		InvMat.M[0][2] = (A01 * A12 - A02 * A11) * InvDet;
+		const __m128 InvDet = _mm_set1_ps(1.0f / Det);
 
-		InvMat.M[1][0] = -(A10 * A22 - A12 * A20) * InvDet;
-		InvMat.M[1][1] = (A00 * A22 - A02 * A20) * InvDet;
-		InvMat.M[1][2] = -(A00 * A12 - A02 * A10) * InvDet;
-
-		InvMat.M[2][0] = (A10 * A21 - A11 * A20) * InvDet;
-		InvMat.M[2][1] = -(A00 * A21 - A01 * A20) * InvDet;
-		InvMat.M[2][2] = (A00 * A11 - A01 * A10) * InvDet;
-
-		// t: last row
-		const FVector T(M[3][0], M[3][1], M[3][2]);
+		// Rinv = [C0 C1 C2]^T / Det
+		FMatrix Out(_mm_mul_ps(C0, InvDet), _mm_mul_ps(C1, InvDet), _mm_mul_ps(C2, InvDet), _mm_setzero_ps());
+		_MM_TRANSPOSE4_PS(Out.Rows[0], Out.Rows[1], Out.Rows[2], Out.Rows[3]);
 
 		// invT = -t * Rinv  (t treated as row-vector)
-		FVector invT(
-			-(T.X * InvMat.M[0][0] + T.Y * InvMat.M[1][0] + T.Z * InvMat.M[2][0]),
-			-(T.X * InvMat.M[0][1] + T.Y * InvMat.M[1][1] + T.Z * InvMat.M[2][1]),
-			-(T.X * InvMat.M[0][2] + T.Y * InvMat.M[1][2] + T.Z * InvMat.M[2][2])
-		);
-
-		FMatrix Out = Identity();
-		// place Rinv in upper-left
-		Out.M[0][0] = InvMat.M[0][0]; Out.M[0][1] = InvMat.M[0][1]; Out.M[0][2] = InvMat.M[0][2];
-		Out.M[1][0] = InvMat.M[1][0]; Out.M[1][1] = InvMat.M[1][1]; Out.M[1][2] = InvMat.M[1][2];
-		Out.M[2][0] = InvMat.M[2][0]; Out.M[2][1] = InvMat.M[2][1]; Out.M[2][2] = InvMat.M[2][2];
-		// translation in last row
-		Out.M[3][0] = invT.X; Out.M[3][1] = invT.Y; Out.M[3][2] = invT.Z; Out.M[3][3] = 1.0f;
+		const __m128 T = Rows[3];
+		__m128 InvT = _mm_mul_ps(FSimd::Splat<0>(T), Out.Rows[0]);
+		InvT = _mm_add_ps(InvT, _mm_mul_ps(FSimd::Splat<1>(T), Out.Rows[1]));
+		InvT = _mm_add_ps(InvT, _mm_mul_ps(FSimd::Splat<2>(T), Out.Rows[2]));
+		// W 레인은 0 - 0 에 1을 더해 [.., 1]
+		Out.Rows[3] = _mm_add_ps(FSimd::Negate(InvT), _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
 		return Out;
 	}
 	// 회전행렬 
@@ -860,21 +929,19 @@ struct alignas(16) FMatrix
 			std::fabs(dot(A00, A01, A02, A20, A21, A22)) < e &&
 			std::fabs(dot(A10, A11, A12, A20, A21, A22)) < e;
 
-		FMatrix Out = Identity();
-		const FVector t(M[3][0], M[3][1], M[3][2]);
-
 		if (ortho)
 		{
 			// R^T
-			Out.M[0][0] = A00; Out.M[0][1] = A10; Out.M[0][2] = A20;
-			Out.M[1][0] = A01; Out.M[1][1] = A11; Out.M[1][2] = A21;
-			Out.M[2][0] = A02; Out.M[2][1] = A12; Out.M[2][2] = A22;
+			const __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+			FMatrix Out(_mm_and_ps(Rows[0], XYZMask), _mm_and_ps(Rows[1], XYZMask), _mm_and_ps(Rows[2], XYZMask), _mm_setzero_ps());
+			_MM_TRANSPOSE4_PS(Out.Rows[0], Out.Rows[1], Out.Rows[2], Out.Rows[3]);
 
 			// invT = -t * R^T  (행벡터 기준)
-			Out.M[3][0] = -(t.X * Out.M[0][0] + t.Y * Out.M[1][0] + t.Z * Out.M[2][0]);
-			Out.M[3][1] = -(t.X * Out.M[0][1] + t.Y * Out.M[1][1] + t.Z * Out.M[2][1]);
-			Out.M[3][2] = -(t.X * Out.M[0][2] + t.Y * Out.M[1][2] + t.Z * Out.M[2][2]);
-			Out.M[3][3] = 1.f;
+			const __m128 T = Rows[3];
+			__m128 InvT = _mm_mul_ps(FSimd::Splat<0>(T), Out.Rows[0]);
+			InvT = _mm_add_ps(InvT, _mm_mul_ps(FSimd::Splat<1>(T), Out.Rows[1]));
+			InvT = _mm_add_ps(InvT, _mm_mul_ps(FSimd::Splat<2>(T), Out.Rows[2]));
+			Out.Rows[3] = _mm_add_ps(FSimd::Negate(InvT), _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
 			return Out;
 		}
 
@@ -886,119 +953,61 @@ struct alignas(16) FMatrix
 	{
 		FMatrix rot = R.ToMatrix();
 		// scale 적용
-		rot.M[0][0] *= S.X; rot.M[0][1] *= S.X; rot.M[0][2] *= S.X;
-		rot.M[1][0] *= S.Y; rot.M[1][1] *= S.Y; rot.M[1][2] *= S.Y;
-		rot.M[2][0] *= S.Z; rot.M[2][1] *= S.Z; rot.M[2][2] *= S.Z;
+		rot.Rows[0] = _mm_mul_ps(rot.Rows[0], _mm_set1_ps(S.X));
+		rot.Rows[1] = _mm_mul_ps(rot.Rows[1], _mm_set1_ps(S.Y));
+		rot.Rows[2] = _mm_mul_ps(rot.Rows[2], _mm_set1_ps(S.Z));
 		// translation
-		rot.M[3][0] = T.X;
-		rot.M[3][1] = T.Y;
-		rot.M[3][2] = T.Z;
-		rot.M[3][3] = 1;
+		rot.Rows[3] = _mm_set_ps(1.0f, T.Z, T.Y, T.X);
 		return rot;
 	}
 
 	FMatrix Inverse() const
 	{
-		FMatrix InverseMatrix;
-		// 원본 행렬(VP_Matrix)의 요소를 로컬 변수로 복사
-		float m00 = this->M[0][0], m01 = this->M[0][1], m02 = this->M[0][2], m03 = this->M[0][3];
-		float m10 = this->M[1][0], m11 = this->M[1][1], m12 = this->M[1][2], m13 = this->M[1][3];
-		float m20 = this->M[2][0], m21 = this->M[2][1], m22 = this->M[2][2], m23 = this->M[2][3];
-		float m30 = this->M[3][0], m31 = this->M[3][1], m32 = this->M[3][2], m33 = this->M[3][3];
-
-		// --- 수반 행렬(Adjugate Matrix)의 첫 번째 행 계산 ---
-		FMatrix Adj;
-
-		// 2x2 부분 행렬식(sub-determinant) 계산
-		float t0 = m22 * m33 - m23 * m32;
-		float t1 = m21 * m33 - m23 * m31;
-		float t2 = m21 * m32 - m22 * m31;
-		float t3 = m20 * m33 - m23 * m30;
-		float t4 = m20 * m32 - m22 * m30;
-		float t5 = m20 * m31 - m21 * m30;
-
-		Adj.M[0][0] = (m11 * t0 - m12 * t1 + m13 * t2);
-		Adj.M[0][1] = -(m10 * t0 - m12 * t3 + m13 * t4);
-		Adj.M[0][2] = (m10 * t1 - m11 * t3 + m13 * t5);
-		Adj.M[0][3] = -(m10 * t2 - m11 * t4 + m12 * t5);
-
-		// --- 행렬식(Determinant) 계산 ---
-		float Det = m00 * Adj.M[0][0] + m01 * Adj.M[0][1] + m02 * Adj.M[0][2] + m03 * Adj.M[0][3];
+		// 2x2 블록 분할 [A B; C D] 역행렬. 각 블록은 (m00, m01, m10, m11) 레인 순서
+		const __m128 A = _mm_movelh_ps(Rows[0], Rows[1]);
+		const __m128 B = _mm_movehl_ps(Rows[1], Rows[0]);
+		const __m128 C = _mm_movelh_ps(Rows[2], Rows[3]);
+		const __m128 D = _mm_movehl_ps(Rows[3], Rows[2]);
+
+		// 블록별 행렬식 (|A|, |B|, |C|, |D|)
+		const __m128 DetSub = _mm_sub_ps(
+			_mm_mul_ps(_mm_shuffle_ps(Rows[0], Rows[2], _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(Rows[1], Rows[3], _MM_SHUFFLE(3, 1, 3, 1))),
+			_mm_mul_ps(_mm_shuffle_ps(Rows[0], Rows[2], _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(Rows[1], Rows[3], _MM_SHUFFLE(2, 0, 2, 0))));
+		const __m128 DetA = FSimd::Splat<0>(DetSub);
+		const __m128 DetB = FSimd::Splat<1>(DetSub);
+		const __m128 DetC = FSimd::Splat<2>(DetSub);
+		const __m128 DetD = FSimd::Splat<3>(DetSub);
+
+		const __m128 D_C = FSimd::Mat2AdjMul(D, C);
+		const __m128 A_B = FSimd::Mat2AdjMul(A, B);
+		__m128 X = _mm_sub_ps(_mm_mul_ps(DetD, A), FSimd::Mat2Mul(B, D_C));
+		__m128 W = _mm_sub_ps(_mm_mul_ps(DetA, D), FSimd::Mat2Mul(C, A_B));
+		__m128 Y = _mm_sub_ps(_mm_mul_ps(DetB, C), FSimd::Mat2MulAdj(D, A_B));
+		__m128 Z = _mm_sub_ps(_mm_mul_ps(DetC, B), FSimd::Mat2MulAdj(A, D_C));
+
+		// |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+		const __m128 Tr = _mm_mul_ps(A_B, _mm_shuffle_ps(D_C, D_C, _MM_SHUFFLE(3, 1, 2, 0)));
+		const float Det = _mm_cvtss_f32(DetA) * _mm_cvtss_f32(DetD) + _mm_cvtss_f32(DetB) * _mm_cvtss_f32(DetC)
+			- _mm_cvtss_f32(FSimd::Dot4(Tr, _mm_set1_ps(1.0f)));
 
 		// 행렬식이 0에 가까우면 (특이 행렬), 역행렬이 존재하지 않음
 		if (std::fabs(Det) < KINDA_SMALL_NUMBER)
 		{
 			return Identity(); // 단위 행렬 할당
 		}
-		else
-		{
-			// 행렬식의 역수 (1.0f / Det)
-			float InvDet = 1.0f / Det;
-
-			// --- 수반 행렬의 나머지 3개 행 계산 ---
-
-			// 2x2 부분 행렬식 (Row 1)
-			float t6 = m02 * m33 - m03 * m32;
-			float t7 = m01 * m33 - m03 * m31;
-			float t8 = m01 * m32 - m02 * m31;
-			float t9 = m00 * m33 - m03 * m30;
-			float t10 = m00 * m32 - m02 * m30;
-			float t11 = m00 * m31 - m01 * m30;
-
-			Adj.M[1][0] = -(m01 * t0 - m02 * t1 + m03 * t2); // C[0][1]
-			Adj.M[1][1] = (m00 * t0 - m02 * t3 + m03 * t4); // C[1][1]
-			Adj.M[1][2] = -(m00 * t1 - m01 * t3 + m03 * t5); // C[2][1]
-			Adj.M[1][3] = (m00 * t2 - m01 * t4 + m02 * t5); // C[3][1]
-
-			// 2x2 부분 행렬식 (Row 2)
-			float t12 = m02 * m13 - m03 * m12;
-			float t13 = m01 * m13 - m03 * m11;
-			float t14 = m01 * m12 - m02 * m11;
-			float t15 = m00 * m13 - m03 * m10;
-			float t16 = m00 * m12 - m02 * m10;
-			float t17 = m00 * m11 - m01 * m10;
-
-			Adj.M[2][0] = (m31 * t12 - m32 * t13 + m33 * t14); // C[0][2]
-			Adj.M[2][1] = -(m30 * t12 - m32 * t15 + m33 * t16); // C[1][2]
-			Adj.M[2][2] = (m30 * t13 - m31 * t15 + m33 * t17); // C[2][2]
-			Adj.M[2][3] = -(m30 * t14 - m31 * t16 + m32 * t17); // C[3][2]
-
-			// 2x2 부분 행렬식 (Row 3)
-			float t18 = m02 * m23 - m03 * m22;
-			float t19 = m01 * m23 - m03 * m21;
-			float t20 = m01 * m22 - m02 * m21;
-			float t21 = m00 * m23 - m03 * m20;
-			float t22 = m00 * m22 - m02 * m20;
-			float t23 = m00 * m21 - m01 * m20;
-
-			Adj.M[3][0] = -(m21 * t12 - m22 * t13 + m23 * t14); // C[0][3]
-			Adj.M[3][1] = (m20 * t12 - m22 * t15 + m23 * t16); // C[1][3]
-			Adj.M[3][2] = -(m20 * t13 - m21 * t15 + m23 * t17); // C[2][3]
-			Adj.M[3][3] = (m20 * t14 - m21 * t16 + m22 * t17); // C[3][3]
-
-			// --- 최종 역행렬 계산 ---
-			InverseMatrix.M[0][0] = Adj.M[0][0] * InvDet;
-			InverseMatrix.M[0][1] = Adj.M[1][0] * InvDet; // [0][1] <- [1][0]
-			InverseMatrix.M[0][2] = Adj.M[2][0] * InvDet; // [0][2] <- [2][0]
-			InverseMatrix.M[0][3] = Adj.M[3][0] * InvDet; // [0][3] <- [3][0]
-
-			InverseMatrix.M[1][0] = Adj.M[0][1] * InvDet; // [1][0] <- [0][1]
-			InverseMatrix.M[1][1] = Adj.M[1][1] * InvDet;
-			InverseMatrix.M[1][2] = Adj.M[2][1] * InvDet; // [1][2] <- [2][1]
-			InverseMatrix.M[1][3] = Adj.M[3][1] * InvDet; // [1][3] <- [3][1]
-
-			InverseMatrix.M[2][0] = Adj.M[0][2] * InvDet; // [2][0] <- [0][2]
-			InverseMatrix.M[2][1] = Adj.M[1][2] * InvDet; // [2][1] <- [1][2]
-			InverseMatrix.M[2][2] = Adj.M[2][2] * InvDet;
-			InverseMatrix.M[2][3] = Adj.M[3][2] * InvDet; // [2][3] <- [3][2]
-
-			InverseMatrix.M[3][0] = Adj.M[0][3] * InvDet; // [3][0] <- [0][3]
-			InverseMatrix.M[3][1] = Adj.M[1][3] * InvDet; // [3][1] <- [1][3]
-			InverseMatrix.M[3][2] = Adj.M[2][3] * InvDet; // [3][2] <- [2][3]
-			InverseMatrix.M[3][3] = Adj.M[3][3] * InvDet;
-		}
 
-		return InverseMatrix;
+		// 수반 행렬 부호 (+ - - +) 와 1 / Det
+		const __m128 RcpDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), _mm_set1_ps(Det));
+		X = _mm_mul_ps(X, RcpDet);
+		Y = _mm_mul_ps(Y, RcpDet);
+		Z = _mm_mul_ps(Z, RcpDet);
+		W = _mm_mul_ps(W, RcpDet);
+
+		return FMatrix(
+			_mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)),
+			_mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2)),
+			_mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)),
+			_mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2)));
 	}
 
 	FVector GetUnitAxisX() const
@@ -1262,25 +1271,21 @@ struct FTransform
 
 		// 회전 결합
 		// Child 회전 후 부모 회전해야 로컬회전하므로 자식 먼저 곱해져야함
-		Result.Rotation = Rotation * ChildTransform.Rotation;
-		Result.Rotation.Normalize();
+		const __m128 ParentRotation = Rotation.ToSimd();
+		Result.Rotation = FQuat::FromSimd(FSimd::QuatNormalize(FSimd::QuatMultiply(ParentRotation, ChildTransform.Rotation.ToSimd())));
 
 		// 스케일 결합 (component-wise)
-		Result.Scale3D = FVector(
-			Scale3D.X * ChildTransform.Scale3D.X,
-			Scale3D.Y * ChildTransform.Scale3D.Y,
-			Scale3D.Z * ChildTransform.Scale3D.Z
-		);
+		const __m128 ParentScale = FSimd::LoadVector3(Scale3D);
+		Result.Scale3D = FSimd::StoreVector3(_mm_mul_ps(ParentScale, FSimd::LoadVector3(ChildTransform.Scale3D)));
 
 		//
 		// 부모 로컬 To World -> SRT, 자식 로컬 To 부모 -> Other.SRT
 		// 자식 로컬 To World -> Other.SRT * SRT 
 		// 자식 로컬 To World Translation -> Other.T * SRT = Translation(Rotation(Scale(Other.T)))
-		FVector Scaled(ChildTransform.Translation.X * Scale3D.X,
-			ChildTransform.Translation.Y * Scale3D.Y,
-			ChildTransform.Translation.Z * Scale3D.Z);
-		FVector Rotated = Rotation.RotateVector(Scaled);
-		Result.Translation = Translation + Rotated;
+		const __m128 Scaled = _mm_mul_ps(FSimd::LoadVector3(ChildTransform.Translation), ParentScale);
+		const __m128 Rotated = _mm_cvtss_f32(FSimd::Dot4(ParentRotation, ParentRotation)) <= KINDA_SMALL_NUMBER
+			? Scaled : FSimd::QuatRotateVector(ParentRotation, Scaled);
+		Result.Translation = FSimd::StoreVector3(_mm_add_ps(FSimd::LoadVector3(Translation), Rotated));
 
 		return Result;
 	}
@@ -1363,23 +1368,13 @@ struct FTransform
 // v' = v + 2 * cross(q.xyz, cross(q.xyz, v) + q.w * v)
 inline FVector FQuat::RotateVector(const FVector& V) const
 {
-	float n = X * X + Y * Y + Z * Z + W * W;
-	if (n <= KINDA_SMALL_NUMBER) return V;
-
-	const FVector U(X, Y, Z);
-	const FVector T(
-		2.0f * (U.Y * V.Z - U.Z * V.Y),
-		2.0f * (U.Z * V.X - U.X * V.Z),
-		2.0f * (U.X * V.Y - U.Y * V.X)
-	);
-	return FVector(
-		V.X + W * T.X + (U.Y * T.Z - U.Z * T.Y),
-		V.Y + W * T.Y + (U.Z * T.X - U.X * T.Z),
-		V.Z + W * T.Z + (U.X * T.Y - U.Y * T.X)
-	);
+	const __m128 Q = ToSimd();
+	if (_mm_cvtss_f32(FSimd::Dot4(Q, Q)) <= KINDA_SMALL_NUMBER) return V;
+
+	return FSimd::StoreVector3(FSimd::QuatRotateVector(Q, FSimd::LoadVector3(V)));
 }
 
-// FQuat → Matrix
+// FQuat → Matrix (행 = 회전된 기저 축)
 inline FMatrix FQuat::ToMatrix() const
 {
 	float XX = X * X, YY = Y * Y, ZZ = Z * Z;
@@ -1387,11 +1382,11 @@ inline FMatrix FQuat::ToMatrix() const
 	float WX = W * X, WY = W * Y, WZ = W * Z;
 
 	return FMatrix(
-		1.0f - 2.0f * (YY + ZZ), 2.0f * (XY - WZ), 2.0f * (XZ + WY), 0.0f,
-		2.0f * (XY + WZ), 1.0f - 2.0f * (XX + ZZ), 2.0f * (YZ - WX), 0.0f,
-		2.0f * (XZ - WY), 2.0f * (YZ + WX), 1.0f - 2.0f * (XX + YY), 0.0f,
+		1.0f - 2.0f * (YY + ZZ), 2.0f * (XY + WZ), 2.0f * (XZ - WY), 0.0f,
+		2.0f * (XY - WZ), 1.0f - 2.0f * (XX + ZZ), 2.0f * (YZ + WX), 0.0f,
+		2.0f * (XZ + WY), 2.0f * (YZ - WX), 1.0f - 2.0f * (XX + YY), 0.0f,
 		0.0f, 0.0f, 0.0f, 1.0f
-	).Transpose();
+	);
 }
 
 // Row-major + 행벡터(p' = p * M), Left-Handed: X=Forward, Y=Right, Z=Up
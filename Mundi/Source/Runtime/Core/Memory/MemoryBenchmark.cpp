@@ -0,0 +1,178 @@
+#include "pch.h"
+#include "MemoryBenchmark.h"
+#include "PooledAllocator.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+#include <malloc.h>
+#include <thread>
+
+namespace
+{
+	constexpr SIZE_T BenchmarkAlignment = 16;
+
+	// 풀 도입 전 FMemoryManager와 같은 방식 (크기 헤더 + _aligned_malloc)
+	struct FSystemAllocPolicy
+	{
+		static void* Allocate(SIZE_T Size)
+		{
+			void* Raw = _aligned_malloc(Size + BenchmarkAlignment, BenchmarkAlignment);
+			if (!Raw)
+			{
+				return nullptr;
+			}
+			*static_cast<SIZE_T*>(Raw) = Size;
+			return static_cast<uint8*>(Raw) + BenchmarkAlignment;
+		}
+		static void Free(void* Ptr)
+		{
+			_aligned_free(static_cast<uint8*>(Ptr) - BenchmarkAlignment);
+		}
+	};
+
+	struct FPooledAllocPolicy
+	{
+		static void* Allocate(SIZE_T Size) { return FPooledAllocator::Get().Allocate(Size, BenchmarkAlignment); }
+		static void Free(void* Ptr) { FPooledAllocator::Get().Free(Ptr); }
+	};
+
+	// 엔진 객체 크기 분포를 흉내 (작은 컴포넌트/파티클 위주 + 가끔 큰 버퍼)
+	SIZE_T PickMixedSize(FBenchmarkRandom& Random)
+	{
+		const uint32 Roll = Random.Next() % 100;
+		if (Roll < 60)
+		{
+			return 16 + Random.Next() % 240;    // 16 ~ 255
+		}
+		if (Roll < 90)
+		{
+			return 256 + Random.Next() % 1792;  // 256 ~ 2047
+		}
+		if (Roll < 99)
+		{
+			return 2048 + Random.Next() % 2048; // 2048 ~ 4095
+		}
+		return 8192 + Random.Next() % 57344;    // 큰 할당 (OS 경로)
+	}
+
+	template<typename PolicyType>
+	uint64 RunChurn(uint32 NumObjects, uint32 NumRounds, SIZE_T ObjectSize)
+	{
+		TArray<void*> Objects;
+		Objects.resize(NumObjects);
+
+		for (uint32 Round = 0; Round < NumRounds; ++Round)
+		{
+			for (uint32 i = 0; i < NumObjects; ++i)
+			{
+				Objects[i] = PolicyType::Allocate(ObjectSize);
+			}
+			for (uint32 i = 0; i < NumObjects; ++i)
+			{
+				PolicyType::Free(Objects[i]);
+			}
+		}
+		return static_cast<uint64>(NumObjects) * NumRounds * 2;
+	}
+
+	template<typename PolicyType>
+	uint64 RunMixed(uint32 LiveSetSize, uint32 NumOperations, uint32 Seed)
+	{
+		FBenchmarkRandom Random(Seed);
+
+		TArray<void*> LiveSet;
+		LiveSet.resize(LiveSetSize);
+		for (uint32 i = 0; i < LiveSetSize; ++i)
+		{
+			LiveSet[i] = PolicyType::Allocate(PickMixedSize(Random));
+		}
+
+		// 살아있는 객체 중 무작위로 하나를 해제하고 다른 크기로 다시 할당
+		for (uint32 Op = 0; Op < NumOperations; ++Op)
+		{
+			const uint32 Slot = Random.Next() % LiveSetSize;
+			PolicyType::Free(LiveSet[Slot]);
+			LiveSet[Slot] = PolicyType::Allocate(PickMixedSize(Random));
+		}
+
+		for (uint32 i = 0; i < LiveSetSize; ++i)
+		{
+			PolicyType::Free(LiveSet[i]);
+		}
+		return static_cast<uint64>(LiveSetSize) * 2 + static_cast<uint64>(NumOperations) * 2;
+	}
+
+	template<typename PolicyType>
+	uint64 RunMultiThreaded(uint32 NumThreads, uint32 LiveSetSize, uint32 NumOperations)
+	{
+		TArray<std::thread> Threads;
+		for (uint32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+		{
+			Threads.emplace_back([=]()
+			{
+				RunMixed<PolicyType>(LiveSetSize, NumOperations, 0x1234u + ThreadIndex * 7919u);
+				if constexpr (std::is_same_v<PolicyType, FPooledAllocPolicy>)
+				{
+					FPooledAllocator::Get().FlushThreadCache();
+				}
+			});
+		}
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+		return (static_cast<uint64>(LiveSetSize) * 2 + static_cast<uint64>(NumOperations) * 2) * NumThreads;
+	}
+
+	template<typename SystemFuncType, typename PooledFuncType>
+	void AddScenario(TArray<FMemoryBenchmarkResult>& OutResults, const char* Name, SystemFuncType&& SystemFunc, PooledFuncType&& PooledFunc)
+	{
+		FMemoryBenchmarkResult Result;
+		Result.Name = Name;
+		Result.SystemMS = MeasureMS([&]() { Result.Operations = SystemFunc(); });
+		Result.PooledMS = MeasureMS([&]() { Result.Operations = PooledFunc(); });
+		OutResults.Add(Result);
+	}
+}
+
+void FMemoryBenchmark::Run(TArray<FMemoryBenchmarkResult>& OutResults)
+{
+	OutResults.Empty();
+
+	const uint32 NumThreads = std::clamp(std::thread::hardware_concurrency(), 2u, 8u);
+
+	AddScenario(OutResults, "Churn 256B x 100k x 10",
+		[]() { return RunChurn<FSystemAllocPolicy>(100000, 10, 256); },
+		[]() { return RunChurn<FPooledAllocPolicy>(100000, 10, 256); });
+
+	AddScenario(OutResults, "Churn 1KB x 20k x 10",
+		[]() { return RunChurn<FSystemAllocPolicy>(20000, 10, 1024); },
+		[]() { return RunChurn<FPooledAllocPolicy>(20000, 10, 1024); });
+
+	AddScenario(OutResults, "Mixed 20k live / 1M ops",
+		[]() { return RunMixed<FSystemAllocPolicy>(20000, 1000000, 0xC0FFEEu); },
+		[]() { return RunMixed<FPooledAllocPolicy>(20000, 1000000, 0xC0FFEEu); });
+
+	AddScenario(OutResults, "MultiThread Mixed 5k live / 250k ops",
+		[NumThreads]() { return RunMultiThreaded<FSystemAllocPolicy>(NumThreads, 5000, 250000); },
+		[NumThreads]() { return RunMultiThreaded<FPooledAllocPolicy>(NumThreads, 5000, 250000); });
+}
+
+void FMemoryBenchmark::RunAndLog()
+{
+	TArray<FMemoryBenchmarkResult> Results;
+	Run(Results);
+
+	UE_LOG("[MemoryBenchmark] %-40s %12s %12s %8s", "Scenario", "System(ms)", "Pooled(ms)", "Speedup");
+	for (const FMemoryBenchmarkResult& Result : Results)
+	{
+		const double Speedup = Result.PooledMS > 0.0 ? Result.SystemMS / Result.PooledMS : 0.0;
+		UE_LOG("[MemoryBenchmark] %-40s %12.2f %12.2f %7.2fx  (%llu ops)",
+			Result.Name.c_str(), Result.SystemMS, Result.PooledMS, Speedup, Result.Operations);
+	}
+
+	FPooledAllocator::Get().DumpStats();
+}
+
+static const bool bMemoryBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"MEMORY BENCH", "-memorybench", "allocator benchmark (system heap vs pooled)", EBenchmarkStage::None,
+	[](const FString&) { FMemoryBenchmark::RunAndLog(); } });
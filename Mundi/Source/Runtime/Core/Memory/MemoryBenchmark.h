@@ -0,0 +1,31 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 시나리오 하나의 측정 결과 (같은 작업을 기존 OS 힙 경로와 풀 할당기로 각각 수행)
+ */
+struct FMemoryBenchmarkResult
+{
+	FString Name;
+	uint64 Operations = 0;  // 할당 + 해제 횟수
+	double SystemMS = 0.0;  // _aligned_malloc/_aligned_free (풀 도입 전 FMemoryManager 경로)
+	double PooledMS = 0.0;  // FPooledAllocator
+};
+
+/**
+ * @brief 할당기 벤치마크 (콘솔 MEMORY BENCH 명령)
+ *
+ * - Churn: 같은 크기 객체 대량 생성/파괴 반복 (액터/컴포넌트 스폰)
+ * - Mixed: 여러 크기를 섞어 무작위 순서로 할당/해제 (장시간 세션의 단편화 패턴)
+ * - MultiThread: 여러 스레드가 동시에 Mixed 패턴 수행
+ */
+class FMemoryBenchmark
+{
+public:
+	static void Run(TArray<FMemoryBenchmarkResult>& OutResults);
+
+	/**
+	 * @brief Run 후 결과와 풀 통계를 로그로 출력
+	 */
+	static void RunAndLog();
+};
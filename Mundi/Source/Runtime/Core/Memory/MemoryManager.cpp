@@ -1,30 +1,106 @@
 ﻿#include "pch.h"
 #include "MemoryManager.h"
-#include <cstddef>
-#include <malloc.h>
+#include "PooledAllocator.h"
 #include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+
+namespace
+{
+	const char* GMemoryTagNames[] =
+	{
+		"Default",
+		"World",
+		"Mesh",
+		"Texture",
+		"Material",
+		"Shader",
+		"Particles",
+		"Animation",
+		"Physics",
+		"Audio",
+		"Lua",
+		"Editor",
+	};
+	static_assert(sizeof(GMemoryTagNames) / sizeof(GMemoryTagNames[0]) == static_cast<size_t>(EMemoryTag::Count), "GMemoryTagNames must match EMemoryTag.");
+
+	constexpr uint32 NumTags = static_cast<uint32>(EMemoryTag::Count);
+	constexpr uint32 MaxTagStackDepth = 32;
+
+	// 태그마다 캐시 라인을 따로 써서 서로 다른 스레드/태그 간 false sharing 방지
+	struct alignas(64) FTagCounters
+	{
+		std::atomic<uint64> CurrentBytes{ 0 };
+		std::atomic<uint64> CurrentCount{ 0 };
+		std::atomic<uint64> PeakBytes{ 0 };
+		std::atomic<uint64> TotalAllocations{ 0 };
+		std::atomic<uint64> TotalBytes{ 0 };
+
+		// 진행 중인 프레임 (BeginFrame에서 0으로 교체)
+		std::atomic<uint64> FrameAllocations{ 0 };
+		std::atomic<uint64> FrameBytes{ 0 };
+		std::atomic<uint64> FrameFrees{ 0 };
+
+		// 확정된 지난 프레임
+		std::atomic<uint64> LastFrameAllocations{ 0 };
+		std::atomic<uint64> LastFrameBytes{ 0 };
+		std::atomic<uint64> PeakFrameAllocations{ 0 };
+	};
+
+	FTagCounters GTagCounters[NumTags];
+
+	std::atomic<uint64> GTotalBytes{ 0 };
+	std::atomic<uint64> GTotalCount{ 0 };
+	std::atomic<uint64> GPeakBytes{ 0 };
+	std::atomic<uint64> GLastFrameAllocations{ 0 };
 
-uint32 FMemoryManager::TotalAllocationBytes = 0;
-uint32 FMemoryManager::TotalAllocationCount = 0;
+	// 프레임 이력 (BeginFrame과 내보내기에서만 접근)
+	std::mutex GHistoryMutex;
+	FMemoryFrameRecord GFrameHistory[FMemoryManager::FrameHistorySize];
+	uint32 GFrameHistoryHead = 0;
+	uint32 GFrameHistoryCount = 0;
+	uint64 GFrameNumber = 0;
+
+	// 스레드별 태그 스택 (비어 있으면 Default)
+	thread_local uint8 GTagStack[MaxTagStackDepth];
+	thread_local uint32 GTagStackDepth = 0;
+
+	void UpdatePeak(std::atomic<uint64>& Peak, uint64 Value)
+	{
+		uint64 Current = Peak.load(std::memory_order_relaxed);
+		while (Value > Current && !Peak.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	double ToMB(uint64 Bytes)
+	{
+		return static_cast<double>(Bytes) / (1024.0 * 1024.0);
+	}
+}
 
 void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
 {
-	SIZE_T TotalSize = Size + sizeof(SIZE_T);
-	SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+	const EMemoryTag Tag = GetCurrentTag();
 
-#if defined(_MSC_VER) && defined(_DEBUG)
-	void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
-#else
-	void* Raw = _aligned_malloc(TotalSize, FinalAlignment);
-#endif
-	if (!Raw)
+	// 작은 할당은 크기 클래스 풀에서, 큰 할당/큰 정렬은 풀 내부에서 OS 힙으로 넘어감
+	void* Ptr = FPooledAllocator::Get().Allocate(Size, Alignment, static_cast<uint8>(Tag));
+	if (!Ptr)
 		return nullptr;
 
-	*reinterpret_cast<SIZE_T*>(Raw) = Size;
-	TotalAllocationBytes += static_cast<uint32>(Size);
-	TotalAllocationCount++;
+	FTagCounters& Counters = GTagCounters[static_cast<uint32>(Tag)];
+	UpdatePeak(Counters.PeakBytes, Counters.CurrentBytes.fetch_add(Size, std::memory_order_relaxed) + Size);
+	Counters.CurrentCount.fetch_add(1, std::memory_order_relaxed);
+	Counters.TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+	Counters.TotalBytes.fetch_add(Size, std::memory_order_relaxed);
+	Counters.FrameAllocations.fetch_add(1, std::memory_order_relaxed);
+	Counters.FrameBytes.fetch_add(Size, std::memory_order_relaxed);
 
-	return static_cast<void*>(static_cast<unsigned char*>(Raw) + sizeof(SIZE_T));
+	UpdatePeak(GPeakBytes, GTotalBytes.fetch_add(Size, std::memory_order_relaxed) + Size);
+	GTotalCount.fetch_add(1, std::memory_order_relaxed);
+
+	return Ptr;
 }
 
 void FMemoryManager::Deallocate(void* Ptr)
@@ -32,16 +108,229 @@ void FMemoryManager::Deallocate(void* Ptr)
 	if (!Ptr)
 		return;
 
-	unsigned char* UserPtr = static_cast<unsigned char*>(Ptr);
-	unsigned char* Raw = UserPtr - sizeof(SIZE_T);
-	SIZE_T Size = *reinterpret_cast<SIZE_T*>(Raw);
+	// 해제는 할당 당시 태그로 되돌림 (해제하는 쪽의 태그 스택과 무관)
+	const SIZE_T Size = FPooledAllocator::GetAllocationSize(Ptr);
+	const uint32 TagIndex = FPooledAllocator::GetAllocationTag(Ptr);
+
+	FTagCounters& Counters = GTagCounters[TagIndex < NumTags ? TagIndex : 0];
+	Counters.CurrentBytes.fetch_sub(Size, std::memory_order_relaxed);
+	Counters.CurrentCount.fetch_sub(1, std::memory_order_relaxed);
+	Counters.FrameFrees.fetch_add(1, std::memory_order_relaxed);
+
+	GTotalBytes.fetch_sub(Size, std::memory_order_relaxed);
+	GTotalCount.fetch_sub(1, std::memory_order_relaxed);
+
+	FPooledAllocator::Get().Free(Ptr);
+}
+
+void FMemoryManager::BeginFrame()
+{
+	FMemoryFrameRecord Record;
+	uint64 TopAllocatedBytes = 0;
+
+	for (uint32 TagIndex = 0; TagIndex < NumTags; ++TagIndex)
+	{
+		FTagCounters& Counters = GTagCounters[TagIndex];
+		const uint64 Allocations = Counters.FrameAllocations.exchange(0, std::memory_order_relaxed);
+		const uint64 Bytes = Counters.FrameBytes.exchange(0, std::memory_order_relaxed);
+		const uint64 Frees = Counters.FrameFrees.exchange(0, std::memory_order_relaxed);
+
+		Counters.LastFrameAllocations.store(Allocations, std::memory_order_relaxed);
+		Counters.LastFrameBytes.store(Bytes, std::memory_order_relaxed);
+		UpdatePeak(Counters.PeakFrameAllocations, Allocations);
 
-	TotalAllocationBytes -= static_cast<uint32>(Size);
-	TotalAllocationCount--;
+		Record.Allocations += Allocations;
+		Record.Frees += Frees;
+		Record.AllocatedBytes += Bytes;
+		if (Bytes > TopAllocatedBytes)
+		{
+			TopAllocatedBytes = Bytes;
+			Record.TopTag = static_cast<EMemoryTag>(TagIndex);
+		}
+	}
 
-#if defined(_MSC_VER) && defined(_DEBUG)
-	_aligned_free_dbg(Raw);
-#else
-	_aligned_free(Raw);
-#endif
-}
\ No newline at end of file
+	Record.CurrentBytes = GTotalBytes.load(std::memory_order_relaxed);
+	GLastFrameAllocations.store(Record.Allocations, std::memory_order_relaxed);
+
+	std::lock_guard<std::mutex> Lock(GHistoryMutex);
+	Record.FrameNumber = GFrameNumber++;
+	GFrameHistory[GFrameHistoryHead] = Record;
+	GFrameHistoryHead = (GFrameHistoryHead + 1) % FrameHistorySize;
+	GFrameHistoryCount = std::min(GFrameHistoryCount + 1, FrameHistorySize);
+}
+
+uint64 FMemoryManager::GetTotalAllocationBytes()
+{
+	return GTotalBytes.load(std::memory_order_relaxed);
+}
+
+uint64 FMemoryManager::GetTotalAllocationCount()
+{
+	return GTotalCount.load(std::memory_order_relaxed);
+}
+
+uint64 FMemoryManager::GetPeakAllocationBytes()
+{
+	return GPeakBytes.load(std::memory_order_relaxed);
+}
+
+uint64 FMemoryManager::GetLastFrameAllocationCount()
+{
+	return GLastFrameAllocations.load(std::memory_order_relaxed);
+}
+
+EMemoryTag FMemoryManager::GetCurrentTag()
+{
+	// 넘친 뒤에는 스택에 기록된 마지막 태그를 사용
+	const uint32 Depth = std::min(GTagStackDepth, MaxTagStackDepth);
+	return Depth > 0 ? static_cast<EMemoryTag>(GTagStack[Depth - 1]) : EMemoryTag::Default;
+}
+
+const char* FMemoryManager::GetTagName(EMemoryTag Tag)
+{
+	const uint32 TagIndex = static_cast<uint32>(Tag);
+	return TagIndex < NumTags ? GMemoryTagNames[TagIndex] : "Unknown";
+}
+
+void FMemoryManager::PushTag(EMemoryTag Tag)
+{
+	// 스택이 넘치면 태그는 버리고 깊이만 셈 (Pop과 짝이 맞고, 바깥 범위의 태그를 덮어쓰지 않도록)
+	assert(GTagStackDepth < MaxTagStackDepth && "FMemoryManager::PushTag: tag stack overflow");
+	if (GTagStackDepth < MaxTagStackDepth)
+	{
+		GTagStack[GTagStackDepth] = static_cast<uint8>(Tag);
+	}
+	++GTagStackDepth;
+}
+
+void FMemoryManager::PopTag()
+{
+	assert(GTagStackDepth > 0 && "FMemoryManager::PopTag without matching PushTag");
+	if (GTagStackDepth > 0)
+	{
+		--GTagStackDepth;
+	}
+}
+
+void FMemoryManager::GetTagStats(TArray<FMemoryTagStats>& OutStats)
+{
+	OutStats.Empty();
+	OutStats.reserve(NumTags);
+
+	for (uint32 TagIndex = 0; TagIndex < NumTags; ++TagIndex)
+	{
+		const FTagCounters& Counters = GTagCounters[TagIndex];
+
+		FMemoryTagStats Stats;
+		Stats.Tag = static_cast<EMemoryTag>(TagIndex);
+		Stats.CurrentBytes = Counters.CurrentBytes.load(std::memory_order_relaxed);
+		Stats.CurrentCount = Counters.CurrentCount.load(std::memory_order_relaxed);
+		Stats.PeakBytes = Counters.PeakBytes.load(std::memory_order_relaxed);
+		Stats.TotalAllocations = Counters.TotalAllocations.load(std::memory_order_relaxed);
+		Stats.TotalBytes = Counters.TotalBytes.load(std::memory_order_relaxed);
+		Stats.LastFrameAllocations = Counters.LastFrameAllocations.load(std::memory_order_relaxed);
+		Stats.LastFrameBytes = Counters.LastFrameBytes.load(std::memory_order_relaxed);
+		Stats.PeakFrameAllocations = Counters.PeakFrameAllocations.load(std::memory_order_relaxed);
+		OutStats.Add(Stats);
+	}
+}
+
+void FMemoryManager::GetFrameHistory(TArray<FMemoryFrameRecord>& OutHistory)
+{
+	std::lock_guard<std::mutex> Lock(GHistoryMutex);
+
+	OutHistory.Empty();
+	OutHistory.reserve(GFrameHistoryCount);
+
+	// 오래된 프레임부터
+	const uint32 Start = (GFrameHistoryHead + FrameHistorySize - GFrameHistoryCount) % FrameHistorySize;
+	for (uint32 i = 0; i < GFrameHistoryCount; ++i)
+	{
+		OutHistory.Add(GFrameHistory[(Start + i) % FrameHistorySize]);
+	}
+}
+
+void FMemoryManager::DumpTagStats()
+{
+	TArray<FMemoryTagStats> Stats;
+	GetTagStats(Stats);
+
+	UE_LOG("[Memory] Total %.2f MB (%llu allocs), Peak %.2f MB, Last frame %llu allocs",
+		ToMB(GetTotalAllocationBytes()), GetTotalAllocationCount(), ToMB(GetPeakAllocationBytes()), GetLastFrameAllocationCount());
+	UE_LOG("[Memory] %-10s %10s %10s %10s %12s %10s %10s", "Tag", "Cur(MB)", "Count", "Peak(MB)", "TotalAllocs", "Frame", "PeakFrame");
+
+	for (const FMemoryTagStats& Tag : Stats)
+	{
+		if (Tag.TotalAllocations == 0)
+		{
+			continue;
+		}
+		UE_LOG("[Memory] %-10s %10.2f %10llu %10.2f %12llu %10llu %10llu",
+			GetTagName(Tag.Tag), ToMB(Tag.CurrentBytes), Tag.CurrentCount, ToMB(Tag.PeakBytes),
+			Tag.TotalAllocations, Tag.LastFrameAllocations, Tag.PeakFrameAllocations);
+	}
+}
+
+bool FMemoryManager::ExportCSV(const FString& Path)
+{
+	TArray<FMemoryTagStats> Stats;
+	GetTagStats(Stats);
+
+	std::ofstream SummaryFile(Path);
+	if (!SummaryFile.is_open())
+	{
+		UE_LOG("[Memory] Failed to open %s", Path.c_str());
+		return false;
+	}
+
+	SummaryFile << "Tag,CurrentBytes,CurrentCount,PeakBytes,TotalAllocations,TotalBytes,LastFrameAllocations,LastFrameBytes,PeakFrameAllocations\n";
+	for (const FMemoryTagStats& Tag : Stats)
+	{
+		SummaryFile << GetTagName(Tag.Tag) << ','
+			<< Tag.CurrentBytes << ','
+			<< Tag.CurrentCount << ','
+			<< Tag.PeakBytes << ','
+			<< Tag.TotalAllocations << ','
+			<< Tag.TotalBytes << ','
+			<< Tag.LastFrameAllocations << ','
+			<< Tag.LastFrameBytes << ','
+			<< Tag.PeakFrameAllocations << '\n';
+	}
+	SummaryFile << "Total," << GetTotalAllocationBytes() << ',' << GetTotalAllocationCount() << ',' << GetPeakAllocationBytes() << ",,,,,\n";
+
+	// 요약 파일 이름 뒤에 _frames를 붙여 프레임 이력 기록
+	FString FramesPath = Path;
+	const size_t ExtPos = FramesPath.rfind('.');
+	if (ExtPos != FString::npos && FramesPath.find_first_of("/\\", ExtPos) == FString::npos)
+	{
+		FramesPath.insert(ExtPos, "_frames");
+	}
+	else
+	{
+		FramesPath += "_frames.csv";
+	}
+
+	TArray<FMemoryFrameRecord> History;
+	GetFrameHistory(History);
+
+	std::ofstream FramesFile(FramesPath);
+	if (!FramesFile.is_open())
+	{
+		UE_LOG("[Memory] Failed to open %s", FramesPath.c_str());
+		return false;
+	}
+
+	FramesFile << "Frame,CurrentBytes,Allocations,Frees,AllocatedBytes,TopTag\n";
+	for (const FMemoryFrameRecord& Record : History)
+	{
+		FramesFile << Record.FrameNumber << ','
+			<< Record.CurrentBytes << ','
+			<< Record.Allocations << ','
+			<< Record.Frees << ','
+			<< Record.AllocatedBytes << ','
+			<< (Record.Allocations > 0 ? GetTagName(Record.TopTag) : "") << '\n';
+	}
+
+	UE_LOG("[Memory] Exported %s, %s (%d frames)", Path.c_str(), FramesPath.c_str(), History.Num());
+	return true;
+}
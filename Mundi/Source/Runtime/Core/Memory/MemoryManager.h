@@ -1,15 +1,170 @@
 ﻿#pragma once
 #include <cstddef>
+#include <atomic>
+#include <limits>
+#include <new>
 #include "UEContainer.h"
 
+/**
+ * @brief 할당 태그 (어느 서브시스템이 메모리를 잡고 있는지 구분)
+ *
+ * 태그는 FScopedMemoryTag로 스레드별 스택에 쌓고, 그 범위 안의 할당은 스택 맨 위 태그로 집계됩니다.
+ * 새 태그를 추가하면 MemoryManager.cpp의 GMemoryTagNames도 함께 갱신해야 합니다.
+ */
+enum class EMemoryTag : uint8
+{
+	Default,
+	World,
+	Mesh,
+	Texture,
+	Material,
+	Shader,
+	Particles,
+	Animation,
+	Physics,
+	Audio,
+	Lua,
+	Editor,
+
+	Count
+};
+
+/**
+ * @brief 태그 하나의 통계 스냅샷
+ */
+struct FMemoryTagStats
+{
+	EMemoryTag Tag = EMemoryTag::Default;
+	uint64 CurrentBytes = 0;
+	uint64 CurrentCount = 0;
+	uint64 PeakBytes = 0;          // 세션 중 최고치 (high-water mark)
+	uint64 TotalAllocations = 0;   // 누적 할당 횟수
+	uint64 TotalBytes = 0;         // 누적 할당 바이트
+	uint64 LastFrameAllocations = 0;
+	uint64 LastFrameBytes = 0;
+	uint64 PeakFrameAllocations = 0;
+};
+
+/**
+ * @brief 프레임 하나의 할당 기록 (CSV의 프레임 이력)
+ */
+struct FMemoryFrameRecord
+{
+	uint64 FrameNumber = 0;
+	uint64 CurrentBytes = 0;
+	uint64 Allocations = 0;
+	uint64 Frees = 0;
+	uint64 AllocatedBytes = 0;
+	EMemoryTag TopTag = EMemoryTag::Default;  // 이 프레임에 가장 많이 할당한 태그
+};
+
 class FMemoryManager
 {
 public:
+	static constexpr uint32 FrameHistorySize = 600;
+
 	// 인자 변수를 PascalCase로 변경
 	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
 	static void  Deallocate(void* Ptr);
 
+	/**
+	 * @brief 프레임 경계 (엔진 Tick 시작에서 호출). 지난 프레임 집계를 확정하고 이력에 기록
+	 */
+	static void BeginFrame();
+
+	static uint64 GetTotalAllocationBytes();
+	static uint64 GetTotalAllocationCount();
+	static uint64 GetPeakAllocationBytes();
+	static uint64 GetLastFrameAllocationCount();
+
+	static EMemoryTag GetCurrentTag();
+	static const char* GetTagName(EMemoryTag Tag);
+
+	static void GetTagStats(TArray<FMemoryTagStats>& OutStats);
+	static void GetFrameHistory(TArray<FMemoryFrameRecord>& OutHistory);
+
+	/**
+	 * @brief 태그별 통계를 로그로 출력 (할당이 있었던 태그만)
+	 */
+	static void DumpTagStats();
+
+	/**
+	 * @brief 태그별 요약을 Path에, 프레임 이력을 Path_frames.csv에 기록
+	 */
+	static bool ExportCSV(const FString& Path);
+
+private:
+	friend class FScopedMemoryTag;
+
+	static void PushTag(EMemoryTag Tag);
+	static void PopTag();
+};
+
+/**
+ * @brief 범위 안의 할당을 Tag로 집계
+ *
+ *   FScopedMemoryTag MemTag(EMemoryTag::Mesh);
+ */
+class FScopedMemoryTag
+{
+public:
+	explicit FScopedMemoryTag(EMemoryTag Tag) { FMemoryManager::PushTag(Tag); }
+	~FScopedMemoryTag() { FMemoryManager::PopTag(); }
+
+	FScopedMemoryTag(const FScopedMemoryTag&) = delete;
+	FScopedMemoryTag& operator=(const FScopedMemoryTag&) = delete;
+};
+
+/**
+ * @brief FMemoryManager를 거치는 STL 할당기. 할당 시점의 태그로 집계됨 (해제는 할당 당시 태그로 되돌림)
+ *
+ *   TTaggedArray<uint8> FileData;   // FScopedMemoryTag 범위 안에서 resize하면 그 태그로 집계
+ */
+template<typename T>
+class TMemoryTagAllocator
+{
 public:
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+	using value_type = T;
+
+	TMemoryTagAllocator() noexcept = default;
+	template<typename U>
+	TMemoryTagAllocator(const TMemoryTagAllocator<U>&) noexcept {}
+
+	T* allocate(size_t Count)
+	{
+		if (Count > std::numeric_limits<size_t>::max() / sizeof(T))
+		{
+			throw std::bad_array_new_length();
+		}
+		constexpr size_t Alignment = alignof(T) > alignof(std::max_align_t) ? alignof(T) : alignof(std::max_align_t);
+		void* Ptr = FMemoryManager::Allocate(Count * sizeof(T), Alignment);
+		if (!Ptr)
+		{
+			throw std::bad_alloc();
+		}
+		return static_cast<T*>(Ptr);
+	}
+
+	void deallocate(T* Ptr, size_t) noexcept
+	{
+		FMemoryManager::Deallocate(Ptr);
+	}
+
+	template<typename U>
+	bool operator==(const TMemoryTagAllocator<U>&) const noexcept { return true; }
+	template<typename U>
+	bool operator!=(const TMemoryTagAllocator<U>&) const noexcept { return false; }
+};
+
+/** 태그별로 집계되는 TArray (리소스 데이터처럼 다른 TArray 시그니처로 넘기지 않는 버퍼용) */
+template<typename T>
+using TTaggedArray = TArray<T, TMemoryTagAllocator<T>>;
+
+/**
+ * @brief 구조체의 new/delete를 FMemoryManager로 보냄 (UObject와 같은 방식, 현재 태그로 집계)
+ */
+#define DECLARE_MEMORY_TAGGED_NEW() \
+	static void* operator new(SIZE_T Size) { return FMemoryManager::Allocate(Size, alignof(std::max_align_t)); } \
+	static void* operator new(SIZE_T Size, std::align_val_t Alignment) { return FMemoryManager::Allocate(Size, static_cast<size_t>(Alignment)); } \
+	static void operator delete(void* Ptr) noexcept { FMemoryManager::Deallocate(Ptr); } \
+	static void operator delete(void* Ptr, std::align_val_t) noexcept { FMemoryManager::Deallocate(Ptr); }
@@ -0,0 +1,413 @@
+#include "pch.h"
+#include "PooledAllocator.h"
+#include <malloc.h>
+#include <algorithm>
+#include <new>
+
+namespace
+{
+	// 크기 클래스별 블록 크기 (16바이트 배수 - 헤더 뒤 사용자 포인터가 16바이트 정렬을 유지)
+	constexpr uint32 SizeClassBlockSizes[FPooledAllocator::NumSizeClasses] =
+	{
+		16, 32, 48, 64, 80, 96, 112, 128,
+		160, 192, 224, 256,
+		320, 384, 448, 512,
+		640, 768, 896, 1024,
+		1280, 1536, 1792, 2048,
+		2560, 3072, 3584, 4096,
+	};
+
+	// 스레드 캐시와 전역 풀이 한 번에 주고받는 양 (대략 16KB 분량)
+	constexpr uint32 BatchBytes = 16 * 1024;
+
+	/**
+	 * @brief 모든 블록 앞에 붙는 헤더 (HeaderSize 바이트)
+	 */
+	struct FBlockHeader
+	{
+		uint64 RequestedSize;
+		uint16 SizeClass;   // LargeSizeClass면 OS 힙 할당
+		uint8 Tag;          // 호출자가 붙인 할당 태그 (FMemoryManager의 EMemoryTag)
+		uint8 Reserved;
+		uint32 RawOffset;   // 사용자 포인터 - 원본 포인터 (큰 할당 해제용)
+	};
+	static_assert(sizeof(FBlockHeader) == FPooledAllocator::HeaderSize, "FBlockHeader must match HeaderSize.");
+
+	FBlockHeader* GetHeader(const void* Ptr)
+	{
+		return reinterpret_cast<FBlockHeader*>(const_cast<uint8*>(static_cast<const uint8*>(Ptr)) - FPooledAllocator::HeaderSize);
+	}
+
+	// 스레드 캐시가 소멸된 뒤(스레드 종료 중 다른 thread_local/정적 소멸자)의 할당/해제는 전역 풀로 직접 보냄
+	thread_local bool GThreadCacheDestroyed = false;
+}
+
+struct FPooledAllocator::FThreadCache
+{
+	FFreeBlock* Heads[NumSizeClasses] = {};
+	uint32 Counts[NumSizeClasses] = {};
+
+	~FThreadCache()
+	{
+		GThreadCacheDestroyed = true;
+		FPooledAllocator::Get().FlushCache(*this);
+	}
+};
+
+FPooledAllocator& FPooledAllocator::Get()
+{
+	// 정적 소멸 순서와 무관하게 프로세스 종료 시점의 해제까지 받을 수 있도록 소멸시키지 않음
+	alignas(FPooledAllocator) static unsigned char Storage[sizeof(FPooledAllocator)];
+	static FPooledAllocator* Instance = new (Storage) FPooledAllocator();
+	return *Instance;
+}
+
+FPooledAllocator::FPooledAllocator()
+{
+	for (uint32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+	{
+		FSizeClassPool& Pool = Pools[SizeClass];
+		Pool.BlockSize = SizeClassBlockSizes[SizeClass];
+		Pool.Stride = Pool.BlockSize + HeaderSize;
+		Pool.BatchCount = std::clamp(BatchBytes / Pool.Stride, 4u, 64u);
+	}
+
+	// 16바이트 단위 크기 -> 크기 클래스 조회 테이블
+	uint32 SizeClass = 0;
+	for (uint32 Slot = 0; Slot <= MaxSmallSize / 16; ++Slot)
+	{
+		while (SizeClassBlockSizes[SizeClass] < Slot * 16)
+		{
+			++SizeClass;
+		}
+		SizeToClassTable[Slot] = static_cast<uint8>(SizeClass);
+	}
+}
+
+FPooledAllocator::FThreadCache& FPooledAllocator::GetThreadCache()
+{
+	thread_local FThreadCache Cache;
+	return Cache;
+}
+
+void* FPooledAllocator::Allocate(SIZE_T Size, SIZE_T Alignment, uint8 Tag)
+{
+	if (Size == 0)
+	{
+		Size = 1;
+	}
+	if (Size > MaxSmallSize || Alignment > HeaderSize)
+	{
+		return AllocateLarge(Size, Alignment, Tag);
+	}
+
+	const uint32 SizeClass = SizeToClass(Size);
+	FSizeClassPool& Pool = Pools[SizeClass];
+
+	FFreeBlock* Block = nullptr;
+	if (!GThreadCacheDestroyed)
+	{
+		FThreadCache& Cache = GetThreadCache();
+		if (!Cache.Heads[SizeClass])
+		{
+			RefillCache(SizeClass, Pool.BatchCount, Cache.Heads[SizeClass], Cache.Counts[SizeClass]);
+		}
+
+		Block = Cache.Heads[SizeClass];
+		if (Block)
+		{
+			Cache.Heads[SizeClass] = Block->Next;
+			--Cache.Counts[SizeClass];
+		}
+	}
+	else
+	{
+		uint32 Count = 0;
+		RefillCache(SizeClass, 1, Block, Count);
+	}
+
+	if (!Block)
+	{
+		return nullptr;
+	}
+
+	FBlockHeader* Header = reinterpret_cast<FBlockHeader*>(Block);
+	Header->RequestedSize = Size;
+	Header->SizeClass = static_cast<uint16>(SizeClass);
+	Header->Tag = Tag;
+	Header->Reserved = 0;
+	Header->RawOffset = HeaderSize;
+
+	const uint64 Active = Pool.ActiveBlocks.fetch_add(1, std::memory_order_relaxed) + 1;
+	uint64 Peak = Pool.PeakActiveBlocks.load(std::memory_order_relaxed);
+	while (Active > Peak && !Pool.PeakActiveBlocks.compare_exchange_weak(Peak, Active, std::memory_order_relaxed))
+	{
+	}
+	Pool.TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+	Pool.RequestedBytes.fetch_add(Size, std::memory_order_relaxed);
+
+	return reinterpret_cast<uint8*>(Block) + HeaderSize;
+}
+
+void FPooledAllocator::Free(void* Ptr)
+{
+	if (!Ptr)
+	{
+		return;
+	}
+
+	FBlockHeader* Header = GetHeader(Ptr);
+	const uint32 SizeClass = Header->SizeClass;
+	if (SizeClass == LargeSizeClass)
+	{
+		FreeLarge(Ptr);
+		return;
+	}
+
+	FSizeClassPool& Pool = Pools[SizeClass];
+	Pool.ActiveBlocks.fetch_sub(1, std::memory_order_relaxed);
+	Pool.RequestedBytes.fetch_sub(Header->RequestedSize, std::memory_order_relaxed);
+
+	FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Header);
+	if (GThreadCacheDestroyed)
+	{
+		Block->Next = nullptr;
+		ReleaseToPool(SizeClass, Block, Block, 1);
+		return;
+	}
+
+	FThreadCache& Cache = GetThreadCache();
+	Block->Next = Cache.Heads[SizeClass];
+	Cache.Heads[SizeClass] = Block;
+	++Cache.Counts[SizeClass];
+
+	// 캐시가 두 배치를 넘으면 한 배치를 전역 풀로 돌려보냄 (다른 스레드가 해제만 하는 경우 대비)
+	if (Cache.Counts[SizeClass] > Pool.BatchCount * 2)
+	{
+		FFreeBlock* Head = Cache.Heads[SizeClass];
+		FFreeBlock* Tail = Head;
+		for (uint32 i = 1; i < Pool.BatchCount; ++i)
+		{
+			Tail = Tail->Next;
+		}
+
+		Cache.Heads[SizeClass] = Tail->Next;
+		Cache.Counts[SizeClass] -= Pool.BatchCount;
+		Tail->Next = nullptr;
+		ReleaseToPool(SizeClass, Head, Tail, Pool.BatchCount);
+	}
+}
+
+SIZE_T FPooledAllocator::GetAllocationSize(const void* Ptr)
+{
+	return Ptr ? static_cast<SIZE_T>(GetHeader(Ptr)->RequestedSize) : 0;
+}
+
+uint8 FPooledAllocator::GetAllocationTag(const void* Ptr)
+{
+	return Ptr ? GetHeader(Ptr)->Tag : 0;
+}
+
+void FPooledAllocator::FlushThreadCache()
+{
+	if (!GThreadCacheDestroyed)
+	{
+		FlushCache(GetThreadCache());
+	}
+}
+
+void FPooledAllocator::FlushCache(FThreadCache& Cache)
+{
+	for (uint32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+	{
+		FFreeBlock* Head = Cache.Heads[SizeClass];
+		if (!Head)
+		{
+			continue;
+		}
+
+		FFreeBlock* Tail = Head;
+		while (Tail->Next)
+		{
+			Tail = Tail->Next;
+		}
+
+		ReleaseToPool(SizeClass, Head, Tail, Cache.Counts[SizeClass]);
+		Cache.Heads[SizeClass] = nullptr;
+		Cache.Counts[SizeClass] = 0;
+	}
+}
+
+void FPooledAllocator::RefillCache(uint32 SizeClass, uint32 MaxCount, FFreeBlock*& OutHead, uint32& OutCount)
+{
+	FSizeClassPool& Pool = Pools[SizeClass];
+	std::lock_guard<std::mutex> Lock(Pool.Mutex);
+
+	if (Pool.FreeCount < MaxCount)
+	{
+		AllocateSlab(Pool);
+	}
+
+	FFreeBlock* Head = Pool.FreeList;
+	FFreeBlock* Tail = nullptr;
+	uint32 Count = 0;
+	for (FFreeBlock* It = Head; It && Count < MaxCount; It = It->Next)
+	{
+		Tail = It;
+		++Count;
+	}
+
+	if (Count == 0)
+	{
+		OutHead = nullptr;
+		OutCount = 0;
+		return;
+	}
+
+	Pool.FreeList = Tail->Next;
+	Pool.FreeCount -= Count;
+	Tail->Next = nullptr;
+
+	OutHead = Head;
+	OutCount = Count;
+}
+
+void FPooledAllocator::ReleaseToPool(uint32 SizeClass, FFreeBlock* Head, FFreeBlock* Tail, uint32 Count)
+{
+	FSizeClassPool& Pool = Pools[SizeClass];
+	std::lock_guard<std::mutex> Lock(Pool.Mutex);
+
+	Tail->Next = Pool.FreeList;
+	Pool.FreeList = Head;
+	Pool.FreeCount += Count;
+}
+
+void FPooledAllocator::AllocateSlab(FSizeClassPool& Pool)
+{
+	// VirtualAlloc은 64KB 단위로 정렬된 메모리를 돌려주므로 블록 정렬이 보장됨
+	uint8* Slab = static_cast<uint8*>(::VirtualAlloc(nullptr, SlabSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+	if (!Slab)
+	{
+		return;
+	}
+	Pool.Slabs.Add(Slab);
+
+	// 주소 순서대로 꺼내지도록 뒤에서부터 연결
+	const uint32 NumBlocks = SlabSize / Pool.Stride;
+	for (uint32 i = NumBlocks; i > 0; --i)
+	{
+		FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Slab + static_cast<SIZE_T>(i - 1) * Pool.Stride);
+		Block->Next = Pool.FreeList;
+		Pool.FreeList = Block;
+	}
+	Pool.FreeCount += NumBlocks;
+}
+
+void* FPooledAllocator::AllocateLarge(SIZE_T Size, SIZE_T Alignment, uint8 Tag)
+{
+	// 헤더 공간을 정렬 크기만큼 잡아 사용자 포인터의 정렬을 유지
+	const SIZE_T FinalAlignment = std::max<SIZE_T>(Alignment, HeaderSize);
+	const SIZE_T Offset = FinalAlignment;
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+	void* Raw = _aligned_malloc_dbg(Size + Offset, FinalAlignment, nullptr, 0);
+#else
+	void* Raw = _aligned_malloc(Size + Offset, FinalAlignment);
+#endif
+	if (!Raw)
+	{
+		return nullptr;
+	}
+
+	uint8* UserPtr = static_cast<uint8*>(Raw) + Offset;
+	FBlockHeader* Header = GetHeader(UserPtr);
+	Header->RequestedSize = Size;
+	Header->SizeClass = LargeSizeClass;
+	Header->Tag = Tag;
+	Header->Reserved = 0;
+	Header->RawOffset = static_cast<uint32>(Offset);
+
+	LargeAllocations.fetch_add(1, std::memory_order_relaxed);
+	LargeBytes.fetch_add(Size, std::memory_order_relaxed);
+
+	return UserPtr;
+}
+
+void FPooledAllocator::FreeLarge(void* Ptr)
+{
+	const FBlockHeader* Header = GetHeader(Ptr);
+	LargeAllocations.fetch_sub(1, std::memory_order_relaxed);
+	LargeBytes.fetch_sub(Header->RequestedSize, std::memory_order_relaxed);
+
+	void* Raw = static_cast<uint8*>(Ptr) - Header->RawOffset;
+#if defined(_MSC_VER) && defined(_DEBUG)
+	_aligned_free_dbg(Raw);
+#else
+	_aligned_free(Raw);
+#endif
+}
+
+void FPooledAllocator::GetSizeClassStats(TArray<FSizeClassStats>& OutStats) const
+{
+	OutStats.SetNum(NumSizeClasses);
+	for (uint32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+	{
+		const FSizeClassPool& Pool = Pools[SizeClass];
+		FSizeClassStats& Stats = OutStats[SizeClass];
+
+		Stats.BlockSize = Pool.BlockSize;
+		Stats.ActiveBlocks = Pool.ActiveBlocks.load(std::memory_order_relaxed);
+		Stats.PeakActiveBlocks = Pool.PeakActiveBlocks.load(std::memory_order_relaxed);
+		Stats.TotalAllocations = Pool.TotalAllocations.load(std::memory_order_relaxed);
+		Stats.RequestedBytes = Pool.RequestedBytes.load(std::memory_order_relaxed);
+
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		Stats.SlabCount = static_cast<uint32>(Pool.Slabs.Num());
+		Stats.ReservedBytes = static_cast<uint64>(Stats.SlabCount) * SlabSize;
+	}
+}
+
+uint64 FPooledAllocator::GetTotalReservedBytes() const
+{
+	TArray<FSizeClassStats> Stats;
+	GetSizeClassStats(Stats);
+
+	uint64 Total = 0;
+	for (const FSizeClassStats& ClassStats : Stats)
+	{
+		Total += ClassStats.ReservedBytes;
+	}
+	return Total;
+}
+
+void FPooledAllocator::DumpStats() const
+{
+	TArray<FSizeClassStats> Stats;
+	GetSizeClassStats(Stats);
+
+	UE_LOG("[PooledAllocator] %-6s %10s %10s %12s %8s %10s %6s", "Size", "Active", "Peak", "TotalAllocs", "Slabs", "Reserved", "Waste");
+	uint64 TotalReserved = 0;
+	uint64 TotalUsed = 0;
+	for (const FSizeClassStats& ClassStats : Stats)
+	{
+		if (ClassStats.TotalAllocations == 0)
+		{
+			continue;
+		}
+
+		// 내부 단편화: 블록 크기 대비 실제 요청 크기의 차이
+		const uint64 BlockBytes = ClassStats.ActiveBlocks * ClassStats.BlockSize;
+		const double WastePercent = BlockBytes > 0 ? 100.0 * (BlockBytes - ClassStats.RequestedBytes) / BlockBytes : 0.0;
+
+		UE_LOG("[PooledAllocator] %-6u %10llu %10llu %12llu %8u %8.1fKB %5.1f%%",
+			ClassStats.BlockSize, ClassStats.ActiveBlocks, ClassStats.PeakActiveBlocks, ClassStats.TotalAllocations,
+			ClassStats.SlabCount, ClassStats.ReservedBytes / 1024.0, WastePercent);
+
+		TotalReserved += ClassStats.ReservedBytes;
+		TotalUsed += ClassStats.RequestedBytes;
+	}
+
+	UE_LOG("[PooledAllocator] Small: %.2f MB used / %.2f MB reserved, Large: %llu allocs (%.2f MB)",
+		TotalUsed / (1024.0 * 1024.0), TotalReserved / (1024.0 * 1024.0),
+		GetLargeAllocationCount(), GetLargeAllocationBytes() / (1024.0 * 1024.0));
+}
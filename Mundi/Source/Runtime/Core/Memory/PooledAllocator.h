@@ -0,0 +1,118 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include "UEContainer.h"
+
+/**
+ * @brief 크기 클래스 하나의 통계 스냅샷
+ */
+struct FSizeClassStats
+{
+	uint32 BlockSize = 0;        // 사용자에게 돌려주는 블록 크기
+	uint64 ActiveBlocks = 0;     // 현재 사용 중인 블록 수
+	uint64 PeakActiveBlocks = 0;
+	uint64 TotalAllocations = 0; // 누적 할당 횟수
+	uint64 RequestedBytes = 0;   // 사용 중인 블록에 실제 요청된 바이트 (내부 단편화 계산용)
+	uint32 SlabCount = 0;
+	uint64 ReservedBytes = 0;    // 슬랩으로 OS에서 받아온 바이트
+};
+
+/**
+ * @brief 크기 클래스 풀 할당기 (FMemoryManager 내부 구현)
+ *
+ * - MaxSmallSize 이하 + 16바이트 이하 정렬 요청은 크기 클래스별 슬랩(64KB)에서 블록 단위로 할당
+ * - 스레드마다 크기 클래스별 프리 리스트 캐시를 두고, 비거나 넘치면 배치 단위로 전역 풀과 교환
+ * - 그 외(큰 할당, 큰 정렬)는 OS 힙으로 바로 넘김
+ *
+ * 모든 블록 앞에 16바이트 헤더를 두어 Free에서 크기 없이도 출처를 판별합니다.
+ * 슬랩은 OS에 반환하지 않습니다 (재사용 전용).
+ */
+class FPooledAllocator
+{
+public:
+	static constexpr uint32 NumSizeClasses = 28;
+	static constexpr uint32 MaxSmallSize = 4096;
+	static constexpr uint32 SlabSize = 64 * 1024;
+	static constexpr uint32 HeaderSize = 16;
+	static constexpr uint32 LargeSizeClass = 0xFFFF;
+
+	static FPooledAllocator& Get();
+
+	/**
+	 * @brief Tag는 블록 헤더에 그대로 기록만 함 (해제 시 GetAllocationTag로 되찾기 위함)
+	 */
+	void* Allocate(SIZE_T Size, SIZE_T Alignment, uint8 Tag = 0);
+	void Free(void* Ptr);
+
+	/**
+	 * @brief Allocate로 받은 포인터의 요청 크기
+	 */
+	static SIZE_T GetAllocationSize(const void* Ptr);
+
+	/**
+	 * @brief Allocate 시 넘긴 태그
+	 */
+	static uint8 GetAllocationTag(const void* Ptr);
+
+	/**
+	 * @brief 현재 스레드 캐시를 전역 풀로 돌려보냄 (스레드 종료 시 자동 호출)
+	 */
+	void FlushThreadCache();
+
+	void GetSizeClassStats(TArray<FSizeClassStats>& OutStats) const;
+	uint64 GetLargeAllocationCount() const { return LargeAllocations.load(std::memory_order_relaxed); }
+	uint64 GetLargeAllocationBytes() const { return LargeBytes.load(std::memory_order_relaxed); }
+	uint64 GetTotalReservedBytes() const;
+
+	/**
+	 * @brief 크기 클래스 통계를 로그로 출력 (사용 중인 클래스만)
+	 */
+	void DumpStats() const;
+
+private:
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	struct alignas(64) FSizeClassPool
+	{
+		uint32 BlockSize = 0;
+		uint32 Stride = 0;       // 헤더 포함 블록 간격
+		uint32 BatchCount = 0;   // 스레드 캐시와 주고받는 블록 수
+
+		mutable std::mutex Mutex;
+		FFreeBlock* FreeList = nullptr;
+		uint32 FreeCount = 0;
+		TArray<void*> Slabs;
+
+		std::atomic<uint64> ActiveBlocks{ 0 };
+		std::atomic<uint64> PeakActiveBlocks{ 0 };
+		std::atomic<uint64> TotalAllocations{ 0 };
+		std::atomic<uint64> RequestedBytes{ 0 };
+	};
+
+	struct FThreadCache;
+
+	FPooledAllocator();
+
+	uint32 SizeToClass(SIZE_T Size) const { return SizeToClassTable[(Size + 15) >> 4]; }
+	static FThreadCache& GetThreadCache();
+	void FlushCache(FThreadCache& Cache);
+
+	void* AllocateLarge(SIZE_T Size, SIZE_T Alignment, uint8 Tag);
+	void FreeLarge(void* Ptr);
+
+	/**
+	 * @brief 전역 풀에서 최대 MaxCount개를 꺼내 스레드 캐시로 (부족하면 슬랩 추가)
+	 */
+	void RefillCache(uint32 SizeClass, uint32 MaxCount, FFreeBlock*& OutHead, uint32& OutCount);
+	void ReleaseToPool(uint32 SizeClass, FFreeBlock* Head, FFreeBlock* Tail, uint32 Count);
+	void AllocateSlab(FSizeClassPool& Pool);
+
+	FSizeClassPool Pools[NumSizeClasses];
+	uint8 SizeToClassTable[MaxSmallSize / 16 + 1];
+
+	std::atomic<uint64> LargeAllocations{ 0 };
+	std::atomic<uint64> LargeBytes{ 0 };
+};
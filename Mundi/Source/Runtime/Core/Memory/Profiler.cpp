@@ -0,0 +1,535 @@
+#include "pch.h"
+#include "Profiler.h"
+#include <mutex>
+
+namespace
+{
+	/** 스코프 하나의 타임라인 기록 (스코프가 끝날 때 기록되므로 자식이 부모보다 먼저 들어감) */
+	struct FProfilerEvent
+	{
+		uint64 StartCycles;
+		uint32 DurationCycles;
+		uint16 StatIndex;
+		uint16 Depth;
+	};
+	static_assert(sizeof(FProfilerEvent) == 16, "FProfilerEvent should stay 16 bytes");
+	static_assert(FProfiler::MaxStats <= 0xFFFF, "StatIndex is stored in 16 bits");
+
+	/**
+	 * @brief 스레드 하나의 기록 상태
+	 *
+	 * 소유 스레드만 쓰고, MarkFrame/내보내기가 다른 스레드에서 읽음.
+	 * 누적값은 단조 증가만 하므로(리셋 없음) 읽는 쪽은 직전 값과의 차이로 프레임 값을 구함.
+	 */
+	struct FProfilerThreadState
+	{
+		uint32 ThreadId = 0;
+		FString Name;
+
+		std::unique_ptr<FProfilerEvent[]> Events = std::make_unique<FProfilerEvent[]>(FProfiler::EventRingCapacity);
+		std::atomic<uint64> WriteCount{ 0 };
+
+		// 스코프 스택 (자기 시간 계산용)
+		uint32 Depth = 0;
+		uint64 ChildCycles[FProfiler::MaxScopeDepth] = {};
+
+		std::atomic<uint64> InclusiveCycles[FProfiler::MaxStats] = {};
+		std::atomic<uint64> ExclusiveCycles[FProfiler::MaxStats] = {};
+		std::atomic<uint64> CallCounts[FProfiler::MaxStats] = {};
+		std::atomic<int64> CounterValues[FProfiler::MaxStats] = {};
+	};
+
+	// 소유 스레드 전용 증가 (경합이 없으므로 lock 접두 명령 없이 저장)
+	template<typename T>
+	void AddOwned(std::atomic<T>& Value, T Amount)
+	{
+		Value.store(Value.load(std::memory_order_relaxed) + Amount, std::memory_order_relaxed);
+	}
+
+	struct FStatTotals
+	{
+		uint64 InclusiveCycles = 0;
+		uint64 ExclusiveCycles = 0;
+		uint64 CallCount = 0;
+		int64 CounterValue = 0;
+	};
+
+	struct FFrameMarker
+	{
+		uint64 FrameNumber = 0;
+		uint64 Cycles = 0;
+	};
+
+	struct FCounterSample
+	{
+		uint64 Cycles;
+		uint32 StatIndex;
+		int64 Value;
+	};
+
+	struct FProfilerState
+	{
+		std::mutex StatMutex;
+		FStatDescriptor Stats[FProfiler::MaxStats];
+		std::atomic<uint32> NumStats{ 1 };   // 0번은 '없음'
+
+		std::mutex ThreadMutex;
+		TArray<FProfilerThreadState*> Threads;   // 살아 있는 스레드만 (끝난 스레드는 RetiredTotals로 합친 뒤 해제)
+		FStatTotals RetiredTotals[FProfiler::MaxStats];   // 끝난 스레드들의 누적값 (프레임 차이가 음수가 되지 않도록 유지)
+
+		// 아래는 MarkFrame(메인 스레드) 전용
+		std::atomic<uint64> FrameNumber{ 0 };
+		FFrameMarker FrameMarkers[FProfiler::FrameMarkerCapacity];
+		FStatTotals PrevTotals[FProfiler::MaxStats];
+		FStatFrameData LastFrameData[FProfiler::MaxStats];
+		TArray<FCounterSample> CounterSamples;   // 최근 프레임들의 카운터 값 (링)
+		uint32 CounterSampleHead = 0;
+
+		uint64 CaptureFirstFrame = 0;
+		uint64 CaptureLastFrame = 0;
+		FString CapturePath;
+	};
+
+	constexpr uint32 MaxCounterSamples = 1u << 14;
+
+	FProfilerState& GetState()
+	{
+		static FProfilerState* State = new FProfilerState();   // 종료 순서와 무관하게 유지
+		return *State;
+	}
+
+	thread_local FProfilerThreadState* GThreadState = nullptr;
+
+	/**
+	 * @brief 스레드 종료 시 현재 스레드의 기록 상태를 목록에서 빼고 해제
+	 * 누적값은 RetiredTotals로 옮겨 합계가 줄지 않게 하고, 링 버퍼의 이벤트는 함께 버림 (이후 내보내기에서 빠짐)
+	 */
+	void RetireThreadState()
+	{
+		FProfilerThreadState* Thread = GThreadState;
+		if (!Thread)
+		{
+			return;
+		}
+
+		FProfilerState& State = GetState();
+		{
+			std::lock_guard<std::mutex> Lock(State.ThreadMutex);
+			const uint32 NumStats = State.NumStats.load(std::memory_order_acquire);
+			for (uint32 Index = 1; Index < NumStats; ++Index)
+			{
+				FStatTotals& Retired = State.RetiredTotals[Index];
+				Retired.InclusiveCycles += Thread->InclusiveCycles[Index].load(std::memory_order_relaxed);
+				Retired.ExclusiveCycles += Thread->ExclusiveCycles[Index].load(std::memory_order_relaxed);
+				Retired.CallCount += Thread->CallCounts[Index].load(std::memory_order_relaxed);
+				Retired.CounterValue += Thread->CounterValues[Index].load(std::memory_order_relaxed);
+			}
+			State.Threads.Remove(Thread);
+		}
+		GThreadState = nullptr;
+		delete Thread;
+	}
+
+	struct FThreadStateRetirer
+	{
+		~FThreadStateRetirer() { RetireThreadState(); }
+	};
+
+	FProfilerThreadState& GetThreadState()
+	{
+		if (!GThreadState)
+		{
+			FProfilerThreadState* NewState = new FProfilerThreadState();
+			NewState->ThreadId = static_cast<uint32>(::GetCurrentThreadId());
+			NewState->Name = "Thread " + std::to_string(NewState->ThreadId);
+
+			FProfilerState& State = GetState();
+			{
+				std::lock_guard<std::mutex> Lock(State.ThreadMutex);
+				State.Threads.Add(NewState);
+			}
+			GThreadState = NewState;
+
+			// 스레드가 끝날 때 소멸자가 상태를 해제 (스레드당 한 번만 생성됨)
+			thread_local FThreadStateRetirer Retirer;
+		}
+		return *GThreadState;
+	}
+
+	uint64 MillisecondsToCycles(double Milliseconds)
+	{
+		return static_cast<uint64>(Milliseconds / (FPlatformTime::GetSecondsPerCycle() * 1000.0));
+	}
+
+	const FFrameMarker* FindFrameMarker(const FProfilerState& State, uint64 FrameNumber)
+	{
+		const FFrameMarker& Marker = State.FrameMarkers[FrameNumber % FProfiler::FrameMarkerCapacity];
+		return (FrameNumber != 0 && Marker.FrameNumber == FrameNumber) ? &Marker : nullptr;
+	}
+
+	void WriteJsonString(std::ofstream& File, const char* Text)
+	{
+		File << '"';
+		for (const char* It = Text ? Text : ""; *It; ++It)
+		{
+			if (*It == '"' || *It == '\\')
+			{
+				File << '\\';
+			}
+			File << *It;
+		}
+		File << '"';
+	}
+}
+
+TStatId FProfiler::RegisterStat(const char* Name, const char* Group, EStatType Type)
+{
+	FProfilerState& State = GetState();
+	std::lock_guard<std::mutex> Lock(State.StatMutex);
+
+	const uint32 NumStats = State.NumStats.load(std::memory_order_relaxed);
+	for (uint32 Index = 1; Index < NumStats; ++Index)
+	{
+		if (std::strcmp(State.Stats[Index].Name, Name) == 0)
+		{
+			return TStatId{ Index };
+		}
+	}
+
+	if (NumStats >= MaxStats)
+	{
+		return TStatId{};
+	}
+
+	State.Stats[NumStats] = FStatDescriptor{ Name, Group ? Group : "Default", Type };
+	State.NumStats.store(NumStats + 1, std::memory_order_release);
+	return TStatId{ NumStats };
+}
+
+const FStatDescriptor& FProfiler::GetStatDescriptor(TStatId Stat)
+{
+	return GetState().Stats[Stat.Index < MaxStats ? Stat.Index : 0];
+}
+
+uint32 FProfiler::GetNumStats()
+{
+	return GetState().NumStats.load(std::memory_order_acquire);
+}
+
+void FProfiler::BeginScope()
+{
+	FProfilerThreadState& Thread = GetThreadState();
+	if (Thread.Depth < MaxScopeDepth)
+	{
+		Thread.ChildCycles[Thread.Depth] = 0;
+	}
+	++Thread.Depth;
+}
+
+void FProfiler::EndScope(TStatId Stat, uint64 StartCycles, uint64 EndCycles)
+{
+	FProfilerThreadState& Thread = GetThreadState();
+	if (Thread.Depth == 0)
+	{
+		return;
+	}
+	const uint32 Depth = --Thread.Depth;
+
+	const uint64 Duration = EndCycles - StartCycles;
+	const uint64 ChildCycles = Depth < MaxScopeDepth ? Thread.ChildCycles[Depth] : 0;
+	if (Depth > 0 && Depth - 1 < MaxScopeDepth)
+	{
+		Thread.ChildCycles[Depth - 1] += Duration;
+	}
+
+	AddOwned(Thread.InclusiveCycles[Stat.Index], Duration);
+	AddOwned(Thread.ExclusiveCycles[Stat.Index], Duration > ChildCycles ? Duration - ChildCycles : 0);
+	AddOwned(Thread.CallCounts[Stat.Index], uint64(1));
+
+	const uint64 WriteCount = Thread.WriteCount.load(std::memory_order_relaxed);
+	FProfilerEvent& Event = Thread.Events[WriteCount & (EventRingCapacity - 1)];
+	Event.StartCycles = StartCycles;
+	Event.DurationCycles = static_cast<uint32>(std::min<uint64>(Duration, UINT32_MAX));
+	Event.StatIndex = static_cast<uint16>(Stat.Index);
+	Event.Depth = static_cast<uint16>(std::min<uint32>(Depth, 0xFFFF));
+	Thread.WriteCount.store(WriteCount + 1, std::memory_order_release);
+}
+
+void FProfiler::AddTime(TStatId Stat, double Milliseconds)
+{
+	if (!Stat.IsValid() || Milliseconds < 0.0)
+	{
+		return;
+	}
+
+	FProfilerThreadState& Thread = GetThreadState();
+	const uint64 Cycles = MillisecondsToCycles(Milliseconds);
+	AddOwned(Thread.InclusiveCycles[Stat.Index], Cycles);
+	AddOwned(Thread.ExclusiveCycles[Stat.Index], Cycles);
+	AddOwned(Thread.CallCounts[Stat.Index], uint64(1));
+}
+
+void FProfiler::IncCounter(TStatId Stat, int64 Amount)
+{
+	if (Stat.IsValid())
+	{
+		AddOwned(GetThreadState().CounterValues[Stat.Index], Amount);
+	}
+}
+
+void FProfiler::SetThreadName(const char* Name)
+{
+	FProfilerThreadState& Thread = GetThreadState();
+	std::lock_guard<std::mutex> Lock(GetState().ThreadMutex);
+	Thread.Name = Name ? Name : "";
+}
+
+void FProfiler::MarkFrame()
+{
+	FProfilerState& State = GetState();
+	const uint64 Now = FPlatformTime::Cycles64();
+	const uint64 FrameNumber = State.FrameNumber.load(std::memory_order_relaxed) + 1;
+	State.FrameNumber.store(FrameNumber, std::memory_order_relaxed);
+	State.FrameMarkers[FrameNumber % FrameMarkerCapacity] = FFrameMarker{ FrameNumber, Now };
+
+	// MarkFrame을 부르는 스레드를 메인 스레드로 표시
+	FProfilerThreadState& MainThread = GetThreadState();
+	if (FrameNumber == 1 && MainThread.Name.rfind("Thread ", 0) == 0)
+	{
+		SetThreadName("Main");
+	}
+
+	if (State.CounterSamples.IsEmpty())
+	{
+		State.CounterSamples.resize(MaxCounterSamples);
+	}
+
+	const uint32 NumStats = GetNumStats();
+	const double MSPerCycle = FPlatformTime::GetSecondsPerCycle() * 1000.0;
+	{
+		std::lock_guard<std::mutex> Lock(State.ThreadMutex);
+		for (uint32 Index = 1; Index < NumStats; ++Index)
+		{
+			FStatTotals Totals = State.RetiredTotals[Index];
+			for (const FProfilerThreadState* Thread : State.Threads)
+			{
+				Totals.InclusiveCycles += Thread->InclusiveCycles[Index].load(std::memory_order_relaxed);
+				Totals.ExclusiveCycles += Thread->ExclusiveCycles[Index].load(std::memory_order_relaxed);
+				Totals.CallCount += Thread->CallCounts[Index].load(std::memory_order_relaxed);
+				Totals.CounterValue += Thread->CounterValues[Index].load(std::memory_order_relaxed);
+			}
+
+			const FStatTotals& Prev = State.PrevTotals[Index];
+			FStatFrameData& Frame = State.LastFrameData[Index];
+			Frame.InclusiveMS = static_cast<double>(Totals.InclusiveCycles - Prev.InclusiveCycles) * MSPerCycle;
+			Frame.ExclusiveMS = static_cast<double>(Totals.ExclusiveCycles - Prev.ExclusiveCycles) * MSPerCycle;
+			Frame.CallCount = static_cast<uint32>(Totals.CallCount - Prev.CallCount);
+			Frame.CounterValue = Totals.CounterValue - Prev.CounterValue;
+			State.PrevTotals[Index] = Totals;
+
+			if (State.Stats[Index].Type == EStatType::Counter)
+			{
+				State.CounterSamples[State.CounterSampleHead++ & (MaxCounterSamples - 1)] = FCounterSample{ Now, Index, Frame.CounterValue };
+			}
+		}
+	}
+
+	// 캡처 범위의 마지막 프레임이 끝났으면 저장
+	if (State.CaptureLastFrame != 0 && FrameNumber > State.CaptureLastFrame)
+	{
+		const uint64 FirstFrame = State.CaptureFirstFrame;
+		const uint64 LastFrame = State.CaptureLastFrame;
+		State.CaptureFirstFrame = State.CaptureLastFrame = 0;
+		if (ExportChromeTrace(State.CapturePath, FirstFrame, LastFrame))
+		{
+			UE_LOG("[Profiler] Captured frames %llu-%llu to %s", FirstFrame, LastFrame, State.CapturePath.c_str());
+		}
+	}
+}
+
+uint64 FProfiler::GetFrameNumber()
+{
+	return GetState().FrameNumber.load(std::memory_order_relaxed);
+}
+
+const FStatFrameData& FProfiler::GetLastFrameData(TStatId Stat)
+{
+	return GetState().LastFrameData[Stat.Index < MaxStats ? Stat.Index : 0];
+}
+
+void FProfiler::BeginCapture(uint32 NumFrames, const FString& FilePath)
+{
+	FProfilerState& State = GetState();
+	if (NumFrames == 0)
+	{
+		return;
+	}
+	// 프레임 N은 N번째 MarkFrame부터 N+1번째 MarkFrame까지
+	State.CaptureFirstFrame = GetFrameNumber() + 1;
+	State.CaptureLastFrame = State.CaptureFirstFrame + NumFrames - 1;
+	State.CapturePath = FilePath;
+	UE_LOG("[Profiler] Capturing %u frames (%llu-%llu)", NumFrames, State.CaptureFirstFrame, State.CaptureLastFrame);
+}
+
+bool FProfiler::IsCapturing()
+{
+	return GetState().CaptureLastFrame != 0;
+}
+
+bool FProfiler::ExportChromeTrace(const FString& FilePath, uint64 FirstFrame, uint64 LastFrame)
+{
+	FProfilerState& State = GetState();
+	const FFrameMarker* FirstMarker = FindFrameMarker(State, FirstFrame);
+	if (!FirstMarker || LastFrame < FirstFrame)
+	{
+		UE_LOG("[Profiler] Frame %llu is no longer available for export", FirstFrame);
+		return false;
+	}
+	const FFrameMarker* EndMarker = FindFrameMarker(State, LastFrame + 1);
+	const uint64 RangeStart = FirstMarker->Cycles;
+	const uint64 RangeEnd = EndMarker ? EndMarker->Cycles : FPlatformTime::Cycles64();
+	const double USPerCycle = FPlatformTime::GetSecondsPerCycle() * 1000000.0;
+	auto ToMicroseconds = [&](uint64 Cycles) { return static_cast<double>(Cycles - RangeStart) * USPerCycle; };
+
+	std::ofstream File(FilePath);
+	if (!File.is_open())
+	{
+		UE_LOG("[Profiler] Failed to open %s", FilePath.c_str());
+		return false;
+	}
+	File.setf(std::ios::fixed);
+	File.precision(3);
+
+	File << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	File << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Mundi\"}}";
+
+	uint32 MainThreadId = 0;
+	uint64 DroppedThreads = 0;
+	{
+		std::lock_guard<std::mutex> Lock(State.ThreadMutex);
+		TArray<FProfilerEvent> Events;
+		for (const FProfilerThreadState* Thread : State.Threads)
+		{
+			if (Thread->Name == "Main")
+			{
+				MainThreadId = Thread->ThreadId;
+			}
+			File << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << Thread->ThreadId << ",\"args\":{\"name\":";
+			WriteJsonString(File, Thread->Name.c_str());
+			File << "}}";
+
+			// 복사 도중 덮어쓰인 칸은 버림 (복사 후 WriteCount를 다시 읽어 확인)
+			const uint64 CountBefore = Thread->WriteCount.load(std::memory_order_acquire);
+			const uint64 Oldest = CountBefore > EventRingCapacity ? CountBefore - EventRingCapacity : 0;
+			Events.clear();
+			for (uint64 Index = Oldest; Index < CountBefore; ++Index)
+			{
+				Events.Add(Thread->Events[Index & (EventRingCapacity - 1)]);
+			}
+			// (쓰는 중인 다음 칸까지 포함해 보수적으로 판단)
+			const uint64 CountAfter = Thread->WriteCount.load(std::memory_order_acquire) + 1;
+			const uint64 SafeStart = CountAfter > EventRingCapacity ? CountAfter - EventRingCapacity : 0;
+			if (SafeStart > Oldest)
+			{
+				const uint64 NumOverwritten = std::min<uint64>(SafeStart - Oldest, Events.size());
+				Events.erase(Events.begin(), Events.begin() + static_cast<ptrdiff_t>(NumOverwritten));
+			}
+
+			// 범위 시작 전 이벤트가 링에 하나도 없다면 앞부분이 잘렸을 수 있음
+			if (Oldest > 0 && !Events.IsEmpty() && Events.front().StartCycles > RangeStart)
+			{
+				++DroppedThreads;
+			}
+
+			// 시작 순, 같은 시작이면 바깥 스코프 먼저
+			std::sort(Events.begin(), Events.end(), [](const FProfilerEvent& A, const FProfilerEvent& B)
+			{
+				return A.StartCycles != B.StartCycles ? A.StartCycles < B.StartCycles : A.Depth < B.Depth;
+			});
+
+			for (const FProfilerEvent& Event : Events)
+			{
+				if (Event.StartCycles < RangeStart || Event.StartCycles >= RangeEnd)
+				{
+					continue;
+				}
+				const FStatDescriptor& Desc = State.Stats[Event.StatIndex];
+				File << ",\n{\"name\":";
+				WriteJsonString(File, Desc.Name);
+				File << ",\"cat\":";
+				WriteJsonString(File, Desc.Group);
+				File << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << Thread->ThreadId
+					<< ",\"ts\":" << ToMicroseconds(Event.StartCycles)
+					<< ",\"dur\":" << static_cast<double>(Event.DurationCycles) * USPerCycle << "}";
+			}
+		}
+	}
+
+	// 프레임 마커
+	for (uint64 Frame = FirstFrame; Frame <= LastFrame; ++Frame)
+	{
+		if (const FFrameMarker* Marker = FindFrameMarker(State, Frame))
+		{
+			File << ",\n{\"name\":\"Frame " << Frame << "\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":" << MainThreadId
+				<< ",\"ts\":" << ToMicroseconds(Marker->Cycles) << "}";
+		}
+	}
+
+	// 카운터 (프레임 끝 시점 값)
+	const uint32 NumSamples = std::min(State.CounterSampleHead, MaxCounterSamples);
+	for (uint32 i = 0; i < NumSamples; ++i)
+	{
+		const FCounterSample& Sample = State.CounterSamples[(State.CounterSampleHead - NumSamples + i) & (MaxCounterSamples - 1)];
+		if (Sample.Cycles <= RangeStart || Sample.Cycles > RangeEnd)
+		{
+			continue;
+		}
+		File << ",\n{\"name\":";
+		WriteJsonString(File, State.Stats[Sample.StatIndex].Name);
+		File << ",\"ph\":\"C\",\"pid\":1,\"ts\":" << ToMicroseconds(Sample.Cycles) << ",\"args\":{\"value\":" << Sample.Value << "}}";
+	}
+
+	File << "\n]}\n";
+
+	if (DroppedThreads > 0)
+	{
+		UE_LOG("[Profiler] %llu thread(s) overflowed the event ring; the start of the capture is truncated", DroppedThreads);
+	}
+	return true;
+}
+
+void FProfiler::LogLastFrame()
+{
+	FProfilerState& State = GetState();
+	const uint32 NumStats = GetNumStats();
+
+	TArray<uint32> Order;
+	for (uint32 Index = 1; Index < NumStats; ++Index)
+	{
+		const FStatFrameData& Data = State.LastFrameData[Index];
+		if (Data.CallCount > 0 || Data.CounterValue != 0)
+		{
+			Order.Add(Index);
+		}
+	}
+	std::sort(Order.begin(), Order.end(), [&](uint32 A, uint32 B)
+	{
+		return State.LastFrameData[A].InclusiveMS > State.LastFrameData[B].InclusiveMS;
+	});
+
+	UE_LOG("[Profiler] Frame %llu", GetFrameNumber() > 0 ? GetFrameNumber() - 1 : 0);
+	UE_LOG("[Profiler] %-28s %-12s %10s %10s %7s", "Stat", "Group", "Incl(ms)", "Excl(ms)", "Calls");
+	for (uint32 Index : Order)
+	{
+		const FStatDescriptor& Desc = State.Stats[Index];
+		const FStatFrameData& Data = State.LastFrameData[Index];
+		if (Desc.Type == EStatType::Counter)
+		{
+			UE_LOG("[Profiler] %-28s %-12s %10s %10s %7lld", Desc.Name, Desc.Group, "-", "-", Data.CounterValue);
+		}
+		else
+		{
+			UE_LOG("[Profiler] %-28s %-12s %10.3f %10.3f %7u", Desc.Name, Desc.Group, Data.InclusiveMS, Data.ExclusiveMS, Data.CallCount);
+		}
+	}
+}
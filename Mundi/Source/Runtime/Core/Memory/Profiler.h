@@ -0,0 +1,162 @@
+#pragma once
+#include <atomic>
+#include "UEContainer.h"
+#include "PlatformTime.h"
+
+/**
+ * @brief 계층형 스코프 프로파일러
+ *
+ * - 스탯은 DECLARE_CYCLE_STAT / DECLARE_COUNTER_STAT으로 선언 시점(정적 초기화)에 한 번 등록되고,
+ *   이후에는 정수 ID(TStatId)로만 다뤄 샘플마다 문자열을 만들지 않음
+ * - 스코프 이벤트는 스레드별 링 버퍼에 (시작, 길이, 깊이)로 기록 → 중첩/스레드별 타임라인 복원 가능
+ * - 프레임 마커(MarkFrame)마다 스레드별 누적값을 합산해 직전 프레임의 포함/자기 시간, 호출 수, 카운터를 계산
+ * - 캡처한 프레임 범위를 Chrome trace / Perfetto JSON으로 내보냄 (렌더러 없이도 사용 가능)
+ *
+ * 사용 예:
+ *   DECLARE_CYCLE_STAT(WorldTick, "World");                 // 파일 범위
+ *   void UWorld::Tick(float) { SCOPE_CYCLE_COUNTER(WorldTick); ... }
+ */
+
+enum class EStatType : uint8
+{
+	Cycle,      // 스코프 시간
+	Counter,    // 프레임마다 누적되는 정수 값
+};
+
+/** 등록된 스탯의 번호 (0은 '없음') */
+struct TStatId
+{
+	uint32 Index = 0;
+
+	bool IsValid() const { return Index != 0; }
+	bool operator==(const TStatId& Other) const { return Index == Other.Index; }
+};
+
+struct FStatDescriptor
+{
+	const char* Name = nullptr;
+	const char* Group = nullptr;
+	EStatType Type = EStatType::Cycle;
+};
+
+/** 직전 프레임(마지막 두 MarkFrame 사이)의 스탯 값 */
+struct FStatFrameData
+{
+	double InclusiveMS = 0.0;   // 자식 스코프 포함
+	double ExclusiveMS = 0.0;   // 자식 스코프 제외
+	uint32 CallCount = 0;
+	int64 CounterValue = 0;
+};
+
+class FProfiler
+{
+public:
+	static constexpr uint32 MaxStats = 1024;
+	static constexpr uint32 MaxScopeDepth = 64;
+	static constexpr uint32 EventRingCapacity = 1u << 16;   // 스레드당 이벤트 수 (2의 거듭제곱)
+	static constexpr uint32 FrameMarkerCapacity = 4096;
+
+	/** 같은 이름은 같은 ID를 반환 (여러 번역 단위에서 같은 스탯을 선언해도 됨) */
+	static TStatId RegisterStat(const char* Name, const char* Group, EStatType Type = EStatType::Cycle);
+	static const FStatDescriptor& GetStatDescriptor(TStatId Stat);
+	static uint32 GetNumStats();
+
+	// FScopeCycleCounter가 호출 (현재 스레드)
+	static void BeginScope();
+	static void EndScope(TStatId Stat, uint64 StartCycles, uint64 EndCycles);
+
+	/** 외부에서 측정한 시간(GPU 쿼리 등)을 현재 프레임 값에 누적 (타임라인 이벤트는 남기지 않음) */
+	static void AddTime(TStatId Stat, double Milliseconds);
+	static void IncCounter(TStatId Stat, int64 Amount = 1);
+
+	/** 현재 스레드의 타임라인 이름 */
+	static void SetThreadName(const char* Name);
+
+	/** 프레임 경계. 메인 스레드에서 프레임마다 한 번 호출 (엔진 Tick 시작) */
+	static void MarkFrame();
+	static uint64 GetFrameNumber();
+	static const FStatFrameData& GetLastFrameData(TStatId Stat);
+
+	/**
+	 * @brief 다음 NumFrames 프레임을 캡처하고 끝나면 FilePath로 내보냄
+	 * 캡처는 링 버퍼에 남아 있는 이벤트를 프레임 범위로 잘라내는 방식이라 기록 비용이 추가되지 않음
+	 */
+	static void BeginCapture(uint32 NumFrames, const FString& FilePath);
+	static bool IsCapturing();
+
+	/** [FirstFrame, LastFrame] 범위를 Chrome trace JSON으로 저장 (링 버퍼에서 밀려난 이벤트는 빠짐) */
+	static bool ExportChromeTrace(const FString& FilePath, uint64 FirstFrame, uint64 LastFrame);
+
+	/** 직전 프레임 스탯을 포함 시간 순으로 로그 출력 */
+	static void LogLastFrame();
+};
+
+/**
+ * @brief 스코프 시간 측정. 스탯 없이 만들면 Finish()로 경과 시간만 얻음
+ */
+class FScopeCycleCounter
+{
+public:
+	explicit FScopeCycleCounter(TStatId InStatId)
+		: StartCycles(FPlatformTime::Cycles64())
+		, StatId(InStatId)
+	{
+		if (StatId.IsValid())
+		{
+			FProfiler::BeginScope();
+		}
+	}
+
+	FScopeCycleCounter() : StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FScopeCycleCounter()
+	{
+		Finish();
+	}
+
+	FScopeCycleCounter(const FScopeCycleCounter&) = delete;
+	FScopeCycleCounter& operator=(const FScopeCycleCounter&) = delete;
+
+	double Finish()
+	{
+		if (bIsFinish)
+		{
+			return 0;
+		}
+		bIsFinish = true;
+
+		const uint64 EndCycles = FPlatformTime::Cycles64();
+		if (StatId.IsValid())
+		{
+			FProfiler::EndScope(StatId, StartCycles, EndCycles);
+		}
+		return FPlatformTime::ToMilliseconds(EndCycles - StartCycles);
+	}
+
+private:
+	bool bIsFinish = false;
+	uint64 StartCycles;
+	TStatId StatId;
+};
+
+#define DECLARE_CYCLE_STAT(StatName, GroupName) \
+	static const TStatId STAT_##StatName = FProfiler::RegisterStat(#StatName, GroupName, EStatType::Cycle);
+
+#define DECLARE_COUNTER_STAT(StatName, GroupName) \
+	static const TStatId STAT_##StatName = FProfiler::RegisterStat(#StatName, GroupName, EStatType::Counter);
+
+#define SCOPE_CYCLE_COUNTER(StatName) \
+	FScopeCycleCounter StatName##ScopeCounter(STAT_##StatName);
+
+#define INC_COUNTER_STAT(StatName, Amount) \
+	FProfiler::IncCounter(STAT_##StatName, Amount);
+
+// 선언 없이 바로 쓰는 스코프 측정 (호출 지점마다 한 번만 등록됨)
+#define TIME_PROFILE(Key) \
+	static const TStatId Key##StatId = FProfiler::RegisterStat(#Key, "Default", EStatType::Cycle); \
+	FScopeCycleCounter Key##Counter(Key##StatId);
+
+#define TIME_PROFILE_END(Key) \
+	Key##Counter.Finish();
@@ -11,10 +11,16 @@ public:
     virtual ~FArchive() {}
 
     virtual void Serialize(void* Data, int64 Length) = 0;
-    /*virtual void Seek(size_t Position) = 0;
-    virtual size_t Tell() const = 0;*/
+    virtual void Seek(int64 Position) = 0;
+    virtual int64 Tell() = 0;
     virtual bool Close() = 0;
 
+    /**
+     * @brief 다음 Length 바이트를 복사 없이 가리키는 포인터를 반환하고 위치를 그만큼 이동
+     * @return 메모리 기반 아카이브가 아니면 nullptr (이 경우 Serialize로 읽어야 함)
+     */
+    virtual const uint8* MapView(int64 Length) { return nullptr; }
+
     // 상태 확인 함수
     bool IsLoading() const { return bIsLoading; }
     bool IsSaving() const { return bIsSaving; }
@@ -79,6 +85,25 @@ namespace Serialization
             Ar.Serialize((void*)Arr.data(), sizeof(T) * Count);
     }
 
+    /**
+     * @brief WriteArray로 저장된 배열을 복사 없이 읽음 (메모리 매핑 아카이브 전용)
+     * @return 뷰를 얻지 못하면 false (아카이브 위치는 배열 개수 뒤로 이동한 상태)
+     */
+    template<typename T>
+    inline bool ReadArrayView(FArchive& Ar, const T*& OutData, uint32& OutCount)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "ReadArrayView requires trivially copyable elements.");
+
+        Ar << OutCount;
+        if (OutCount > MAX_REASONABLE_ARRAY_SIZE)
+        {
+            throw std::runtime_error("Cache corrupt: Generic array size is unreasonable.");
+        }
+
+        OutData = reinterpret_cast<const T*>(Ar.MapView(static_cast<int64>(sizeof(T)) * OutCount));
+        return OutData != nullptr || OutCount == 0;
+    }
+
     template<typename T>
     inline void ReadArray(FArchive& Ar, TArray<T>& Arr)
     {
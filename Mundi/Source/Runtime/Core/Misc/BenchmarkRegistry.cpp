@@ -0,0 +1,52 @@
+#include "pch.h"
+#include "BenchmarkRegistry.h"
+
+namespace
+{
+	// 다른 번역 단위의 정적 초기화에서 호출되므로 함수 안 정적 변수로 둠
+	TArray<FBenchmarkEntry>& GetMutableEntries()
+	{
+		static TArray<FBenchmarkEntry> Entries;
+		return Entries;
+	}
+}
+
+bool FBenchmarkRegistry::Register(const FBenchmarkEntry& Entry)
+{
+	TArray<FBenchmarkEntry>& Entries = GetMutableEntries();
+
+	// 정적 초기화 순서는 번역 단위마다 다르므로 도움말 순서가 바뀌지 않도록 이름순으로 삽입
+	auto It = std::lower_bound(Entries.begin(), Entries.end(), Entry,
+		[](const FBenchmarkEntry& A, const FBenchmarkEntry& B) { return _stricmp(A.Command, B.Command) < 0; });
+	Entries.insert(It, Entry);
+	return true;
+}
+
+const TArray<FBenchmarkEntry>& FBenchmarkRegistry::GetEntries()
+{
+	return GetMutableEntries();
+}
+
+const FBenchmarkEntry* FBenchmarkRegistry::FindByCommand(const char* Command)
+{
+	for (const FBenchmarkEntry& Entry : GetMutableEntries())
+	{
+		if (_stricmp(Entry.Command, Command) == 0)
+		{
+			return &Entry;
+		}
+	}
+	return nullptr;
+}
+
+const FBenchmarkEntry* FBenchmarkRegistry::FindByHeadlessFlag(const char* Flag)
+{
+	for (const FBenchmarkEntry& Entry : GetMutableEntries())
+	{
+		if (_stricmp(Entry.HeadlessFlag, Flag) == 0)
+		{
+			return &Entry;
+		}
+	}
+	return nullptr;
+}
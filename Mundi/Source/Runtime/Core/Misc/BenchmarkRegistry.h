@@ -0,0 +1,49 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 헤드리스 실행에서 벤치마크를 시작하기 전에 준비해야 하는 단계 (UGameEngine::RunHeadless 순서)
+ */
+enum class EBenchmarkStage : uint8
+{
+	None,           // 디바이스/월드 없이 실행
+	Device,         // 리소스 생성용 RHI 디바이스
+	Preload,        // FObjManager::Preload 이후 (메시 캐시)
+	World,          // 빈 GWorld 초기화 이후
+	PlayingWorld,   // 씬 로드와 BeginPlay 이후 (GWorld의 배치를 그대로 사용)
+};
+
+/**
+ * @brief 콘솔 명령과 헤드리스 플래그 하나로 실행하는 벤치마크
+ */
+struct FBenchmarkEntry
+{
+	const char* Command;        // 콘솔 명령 ("MEMORY BENCH")
+	const char* HeadlessFlag;   // 헤드리스 플래그 ("-memorybench")
+	const char* Description;    // 실행 시 "Running <Description>..." 로그
+	EBenchmarkStage Stage;
+	void (*Run)(const FString& ReportPath);    // ReportPath가 비어 있으면 로그만 출력 (콘솔)
+};
+
+/**
+ * @brief 벤치마크 등록 테이블. 콘솔(UConsoleWidget)과 헤드리스(-headless)가 같은 목록을 사용
+ *
+ * 각 벤치마크 .cpp에서 정적 초기화로 등록합니다.
+ *
+ *   static const bool bRegistered = FBenchmarkRegistry::Register({
+ *       "MEMORY BENCH", "-memorybench", "allocator benchmark", EBenchmarkStage::None,
+ *       [](const FString&) { FMemoryBenchmark::RunAndLog(); } });
+ */
+class FBenchmarkRegistry
+{
+public:
+	/** @return 항상 true (정적 변수 초기화용) */
+	static bool Register(const FBenchmarkEntry& Entry);
+
+	/** 콘솔 명령 이름순 */
+	static const TArray<FBenchmarkEntry>& GetEntries();
+
+	/** 대소문자 무시 @return 없으면 nullptr */
+	static const FBenchmarkEntry* FindByCommand(const char* Command);
+	static const FBenchmarkEntry* FindByHeadlessFlag(const char* Flag);
+};
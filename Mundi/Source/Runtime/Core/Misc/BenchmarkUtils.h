@@ -0,0 +1,107 @@
+#pragma once
+#include "UEContainer.h"
+#include "PlatformTime.h"
+#include <algorithm>
+#include <ostream>
+
+/**
+ * @brief 벤치마크용 결정적 난수 (xorshift32). 같은 시드면 실행마다 같은 입력을 만듦
+ */
+struct FBenchmarkRandom
+{
+	uint32 State;
+
+	explicit FBenchmarkRandom(uint32 Seed = 0x2545F491u) : State(Seed ? Seed : 0x9E3779B9u) {}
+
+	uint32 Next()
+	{
+		State ^= State << 13;
+		State ^= State >> 17;
+		State ^= State << 5;
+		return State;
+	}
+
+	/** [0, 1) */
+	float NextFloat()
+	{
+		return static_cast<float>(Next() >> 8) / static_cast<float>(1u << 24);
+	}
+
+	/** [Min, Max) */
+	float Range(float Min, float Max)
+	{
+		return Min + (Max - Min) * NextFloat();
+	}
+};
+
+/**
+ * @brief Func 한 번 실행에 걸린 시간 (ms)
+ */
+template<typename FuncType>
+double MeasureMS(FuncType&& Func)
+{
+	const uint64 Start = FPlatformTime::Cycles64();
+	Func();
+	return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+}
+
+/**
+ * @brief Func를 Iterations번 실행한 평균 시간 (ms)
+ */
+template<typename FuncType>
+double MeasureMS(int32 Iterations, FuncType&& Func)
+{
+	const uint64 Start = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < Iterations; ++i)
+	{
+		Func();
+	}
+	return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) / static_cast<double>(Iterations);
+}
+
+/**
+ * @brief 샘플의 백분위 값 (Fraction 0.5 = 중앙값, 1.0 = 최댓값). 복사본을 부분 정렬하므로 원본 순서는 유지됨
+ */
+inline float Percentile(TArray<float> Samples, float Fraction)
+{
+	if (Samples.IsEmpty())
+	{
+		return 0.0f;
+	}
+	const size_t Index = std::min(Samples.size() - 1, static_cast<size_t>(Fraction * static_cast<float>(Samples.size() - 1) + 0.5f));
+	std::nth_element(Samples.begin(), Samples.begin() + Index, Samples.end());
+	return Samples[Index];
+}
+
+/**
+ * @brief Text를 큰따옴표로 감싼 JSON 문자열로 출력 (따옴표, 역슬래시, 제어 문자 이스케이프)
+ */
+inline void WriteJsonString(std::ostream& Out, const FString& Text)
+{
+	static const char HexDigits[] = "0123456789abcdef";
+
+	Out << '"';
+	for (char Character : Text)
+	{
+		const uint8 Code = static_cast<uint8>(Character);
+		switch (Character)
+		{
+		case '"':  Out << "\\\""; break;
+		case '\\': Out << "\\\\"; break;
+		case '\n': Out << "\\n"; break;
+		case '\r': Out << "\\r"; break;
+		case '\t': Out << "\\t"; break;
+		default:
+			if (Code < 0x20)
+			{
+				Out << "\\u00" << HexDigits[Code >> 4] << HexDigits[Code & 0xF];
+			}
+			else
+			{
+				Out << Character;
+			}
+			break;
+		}
+	}
+	Out << '"';
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include "MemoryArchive.h"
+#include "WindowsBinWriter.h"
+#include <cstring>
+
+/**
+ * @brief 파생 데이터 캐시(.bin) 파일 앞에 붙는 헤더
+ *
+ * Version은 캐시 종류별로 관리하며, 직렬화 포맷이 바뀌면 올려서 이전 캐시를 무효화합니다.
+ * Checksum은 헤더 뒤 페이로드 전체에 대한 값으로, 잘린 파일이나 손상된 캐시를 걸러냅니다.
+ */
+struct FCacheFileHeader
+{
+    static constexpr uint32 CacheMagic = 0x4344444D; // 'MDDC'
+
+    uint32 Magic = CacheMagic;
+    uint32 Version = 0;
+    uint64 PayloadSize = 0;
+    uint64 Checksum = 0;
+};
+
+namespace CacheFile
+{
+    /**
+     * @brief 페이로드 체크섬 (8바이트 단위 FNV-1a 변형)
+     */
+    inline uint64 ComputeChecksum(const uint8* Data, uint64 Size)
+    {
+        constexpr uint64 Prime = 0x100000001b3ULL;
+        uint64 Hash = 0xcbf29ce484222325ULL;
+
+        uint64 Offset = 0;
+        for (; Offset + sizeof(uint64) <= Size; Offset += sizeof(uint64))
+        {
+            uint64 Word;
+            memcpy(&Word, Data + Offset, sizeof(uint64));
+            Hash = (Hash ^ Word) * Prime;
+        }
+        for (; Offset < Size; ++Offset)
+        {
+            Hash = (Hash ^ Data[Offset]) * Prime;
+        }
+        return Hash ^ Size;
+    }
+
+    /**
+     * @brief 헤더 + 페이로드로 캐시 파일 저장
+     * @param WritePayload void(FArchive&) - 페이로드 직렬화 함수 (메모리에 먼저 기록해 체크섬 계산)
+     */
+    template<typename FuncType>
+    inline void Save(const FString& Path, uint32 Version, FuncType&& WritePayload)
+    {
+        TArray<uint8> Payload;
+        FMemoryWriter PayloadWriter(Payload);
+        WritePayload(static_cast<FArchive&>(PayloadWriter));
+
+        FCacheFileHeader Header;
+        Header.Version = Version;
+        Header.PayloadSize = static_cast<uint64>(Payload.size());
+        Header.Checksum = ComputeChecksum(Payload.data(), Header.PayloadSize);
+
+        FWindowsBinWriter Writer(Path);
+        Writer << Header;
+        if (!Payload.empty())
+        {
+            Writer.Serialize(Payload.data(), static_cast<int64>(Payload.size()));
+        }
+        Writer.Close();
+    }
+
+    /**
+     * @brief 헤더를 읽고 버전/크기/체크섬을 검증. Reader는 페이로드 시작 위치로 이동함
+     * 검증 실패 시 std::runtime_error (호출부에서 캐시 삭제 후 재생성)
+     */
+    inline void ReadHeader(FMemoryReader& Reader, uint32 ExpectedVersion)
+    {
+        FCacheFileHeader Header;
+        Reader << Header;
+
+        if (Header.Magic != FCacheFileHeader::CacheMagic)
+        {
+            throw std::runtime_error("Cache corrupt: invalid header (old cache format?).");
+        }
+        if (Header.Version != ExpectedVersion)
+        {
+            throw std::runtime_error("Cache outdated: version mismatch.");
+        }
+
+        const int64 PayloadOffset = Reader.Tell();
+        if (Header.PayloadSize != static_cast<uint64>(Reader.TotalSize() - PayloadOffset))
+        {
+            throw std::runtime_error("Cache corrupt: payload size mismatch.");
+        }
+        if (ComputeChecksum(Reader.GetData() + PayloadOffset, Header.PayloadSize) != Header.Checksum)
+        {
+            throw std::runtime_error("Cache corrupt: checksum mismatch.");
+        }
+    }
+}
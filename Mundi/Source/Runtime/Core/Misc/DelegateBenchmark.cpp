@@ -0,0 +1,181 @@
+#include "pch.h"
+#include "DelegateBenchmark.h"
+#include "Delegates.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+
+namespace
+{
+	// FHitResult 크기의 페이로드 (const& 로 전달)
+	struct FBenchHitPayload
+	{
+		float Data[16] = {};
+	};
+
+	using FBenchDelegate = TDelegate<void*, void*, void*, int32, bool, const FBenchHitPayload&>;
+
+	// 이전 TDelegate와 같은 구현 (std::function 벡터, 멤버 호출은 캡처 람다로 감쌈)
+	template<typename... Args>
+	class TLegacyDelegate
+	{
+	public:
+		template<typename TObj, typename TClass>
+		FDelegateHandle AddDynamic(TObj* Instance, void(TClass::* Func)(Args...))
+		{
+			FDelegateHandle Handle = NextHandle++;
+			Handlers.push_back({ Handle, [=](Args... args) { (Instance->*Func)(args...); } });
+			return Handle;
+		}
+
+		void Broadcast(Args... args)
+		{
+			for (auto& Entry : Handlers)
+			{
+				if (Entry.Handler)
+				{
+					Entry.Handler(args...);
+				}
+			}
+		}
+
+		// 핸들러가 도중에 Remove/Add 해도 안전하도록 목록을 복사한 뒤 호출
+		void BroadcastCopy(Args... args)
+		{
+			const std::vector<FEntry> Snapshot = Handlers;
+			for (auto& Entry : Snapshot)
+			{
+				Entry.Handler(args...);
+			}
+		}
+
+		void Remove(FDelegateHandle Handle)
+		{
+			Handlers.erase(std::remove_if(Handlers.begin(), Handlers.end(),
+				[&](const FEntry& Entry) { return Entry.Handle == Handle; }), Handlers.end());
+		}
+
+	private:
+		struct FEntry
+		{
+			FDelegateHandle Handle;
+			std::function<void(Args...)> Handler;
+		};
+
+		std::vector<FEntry> Handlers;
+		FDelegateHandle NextHandle = 1;
+	};
+
+	using FLegacyBenchDelegate = TLegacyDelegate<void*, void*, void*, int32, bool, const FBenchHitPayload&>;
+
+	template<typename DelegateType>
+	struct TBenchListener
+	{
+		DelegateType* Delegate = nullptr;
+		FDelegateHandle Handle = 0;
+		uint64 Counter = 0;
+		bool bRebindOnCall = false;
+
+		void OnEvent(void* A, void* B, void* C, int32 Index, bool bFlag, const FBenchHitPayload& Payload)
+		{
+			Counter += reinterpret_cast<uintptr_t>(C) + Index + (bFlag ? 1 : 0) + static_cast<uint64>(Payload.Data[0]);
+			if (bRebindOnCall)
+			{
+				// 호출 도중 자신을 제거하고 다시 등록
+				Delegate->Remove(Handle);
+				Handle = Delegate->AddDynamic(this, &TBenchListener::OnEvent);
+			}
+		}
+	};
+
+	void LogScenario(const char* Name, uint64 Operations, double LegacyMS, double NewMS)
+	{
+		const double Speedup = NewMS > 0.0 ? LegacyMS / NewMS : 0.0;
+		UE_LOG("[DelegateBenchmark] %-32s %12.2f %12.2f %7.2fx  (%.1f ns/op)",
+			Name, LegacyMS, NewMS, Speedup, Operations > 0 ? NewMS * 1000000.0 / Operations : 0.0);
+	}
+
+	template<typename DelegateType>
+	double RunBindUnbind(uint32 NumRounds, uint32 NumListeners)
+	{
+		DelegateType Delegate;
+		TArray<TBenchListener<DelegateType>> Listeners;
+		Listeners.resize(NumListeners);
+		return MeasureMS([&]()
+		{
+			for (uint32 Round = 0; Round < NumRounds; ++Round)
+			{
+				for (auto& Listener : Listeners)
+				{
+					Listener.Handle = Delegate.AddDynamic(&Listener, &TBenchListener<DelegateType>::OnEvent);
+				}
+				for (auto& Listener : Listeners)
+				{
+					Delegate.Remove(Listener.Handle);
+				}
+			}
+		});
+	}
+
+	template<typename DelegateType, typename BroadcastFuncType>
+	double RunBroadcast(uint32 NumBroadcasts, uint32 NumListeners, bool bRebind, BroadcastFuncType&& BroadcastFunc)
+	{
+		DelegateType Delegate;
+		TArray<TBenchListener<DelegateType>> Listeners;
+		Listeners.resize(NumListeners);
+		for (auto& Listener : Listeners)
+		{
+			Listener.Delegate = &Delegate;
+			Listener.bRebindOnCall = bRebind;
+			Listener.Handle = Delegate.AddDynamic(&Listener, &TBenchListener<DelegateType>::OnEvent);
+		}
+
+		FBenchHitPayload Payload;
+		Payload.Data[0] = 1.0f;
+		const double Elapsed = MeasureMS([&]()
+		{
+			for (uint32 i = 0; i < NumBroadcasts; ++i)
+			{
+				BroadcastFunc(Delegate, &Delegate, &Payload, reinterpret_cast<void*>(static_cast<uintptr_t>(i)), static_cast<int32>(i), (i & 1) != 0, Payload);
+			}
+		});
+
+		uint64 Sink = 0;
+		for (auto& Listener : Listeners)
+		{
+			Sink += Listener.Counter;
+		}
+		volatile uint64 Keep = Sink;
+		(void)Keep;
+		return Elapsed;
+	}
+}
+
+void FDelegateBenchmark::RunAndLog()
+{
+	constexpr uint32 NumListeners = 8;
+	constexpr uint32 NumBroadcasts = 1000000;
+	constexpr uint32 NumRebindBroadcasts = 200000;
+	constexpr uint32 BindRounds = 20000;
+
+	auto LegacyBroadcast = [](FLegacyBenchDelegate& D, auto... InArgs) { D.Broadcast(InArgs...); };
+	auto LegacyBroadcastCopy = [](FLegacyBenchDelegate& D, auto... InArgs) { D.BroadcastCopy(InArgs...); };
+	auto NewBroadcast = [](FBenchDelegate& D, auto... InArgs) { D.Broadcast(InArgs...); };
+
+	UE_LOG("[DelegateBenchmark] %-32s %12s %12s %8s", "Scenario", "Legacy(ms)", "New(ms)", "Speedup");
+
+	LogScenario("Bind/Unbind 8 x 20k", static_cast<uint64>(BindRounds) * NumListeners * 2,
+		RunBindUnbind<FLegacyBenchDelegate>(BindRounds, NumListeners),
+		RunBindUnbind<FBenchDelegate>(BindRounds, NumListeners));
+
+	LogScenario("Broadcast 8 handlers x 1M", static_cast<uint64>(NumBroadcasts) * NumListeners,
+		RunBroadcast<FLegacyBenchDelegate>(NumBroadcasts, NumListeners, false, LegacyBroadcast),
+		RunBroadcast<FBenchDelegate>(NumBroadcasts, NumListeners, false, NewBroadcast));
+
+	LogScenario("Broadcast + Remove/Add x 200k", static_cast<uint64>(NumRebindBroadcasts) * NumListeners,
+		RunBroadcast<FLegacyBenchDelegate>(NumRebindBroadcasts, NumListeners, true, LegacyBroadcastCopy),
+		RunBroadcast<FBenchDelegate>(NumRebindBroadcasts, NumListeners, true, NewBroadcast));
+}
+
+static const bool bDelegateBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"DELEGATE BENCH", "-delegatebench", "delegate benchmark (std::function list vs inline TDelegate)", EBenchmarkStage::None,
+	[](const FString&) { FDelegateBenchmark::RunAndLog(); } });
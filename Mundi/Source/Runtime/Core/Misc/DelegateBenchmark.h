@@ -0,0 +1,16 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 델리게이트 벤치마크 (콘솔 DELEGATE BENCH 명령)
+ *
+ * 같은 작업을 이전 방식(std::function 벡터 + 캡처 람다로 감싼 멤버 호출)과 현재 TDelegate로 각각 수행합니다.
+ * - Bind/Unbind: 멤버 함수 바인딩 추가/제거 반복 (컴포넌트 BeginPlay/EndPlay)
+ * - Broadcast: 오버랩 이벤트와 같은 시그니처로 핸들러 8개 호출 반복
+ * - Broadcast + Remove: 핸들러가 호출 도중 자신을 제거하고 다시 등록 (이전 방식은 안전하려면 목록 복사 필요)
+ */
+class FDelegateBenchmark
+{
+public:
+	static void RunAndLog();
+};
@@ -4,71 +4,405 @@
 #include <functional>
 #include <algorithm>
 #include <memory>
+#include <cstring>
+#include <new>
+#include "ObjectFactory.h"
 
 using FDelegateHandle = size_t;
 
+/**
+ * @brief 멀티캐스트 델리게이트
+ *
+ * - 바인딩마다 인라인 버퍼(InlineSize)에 호출 대상을 직접 저장. 멤버 함수 바인딩과 작은 람다는 힙 할당 없음
+ *   (버퍼보다 큰 호출 대상만 힙으로 넘어감)
+ * - 호출은 std::function 대신 바인딩별 함수 포인터 한 번
+ * - UObject 멤버 바인딩은 GUObjectArray 슬롯/세대를 기록해 두고, 객체가 삭제되었으면 호출하지 않고 자동 해제
+ * - Broadcast 도중 Remove/Clear는 표시만 하고 가장 바깥 Broadcast가 끝날 때 정리
+ *   (핸들러 목록을 복사하지 않음). 도중에 Add된 핸들러는 다음 Broadcast부터 호출
+ */
 template<typename... Args>
 class TDelegate
 {
 public:
 	using HandlerType = std::function<void(Args...)>;
 
+	static constexpr size_t InlineSize = 32;
+
 	TDelegate() : NextHandle(1) {}
 
-	FDelegateHandle Add(const HandlerType& Handler)
+	TDelegate(const TDelegate& Other)
+		: Bindings(Other.Bindings)
+		, NextHandle(Other.NextHandle)
 	{
-		FDelegateHandle Handle = NextHandle++;
-		Handlers.push_back({ Handle, Handler });
-		return Handle;
+		Bindings.insert(Bindings.end(), Other.PendingBindings.begin(), Other.PendingBindings.end());
+		RemoveDeadBindings();
+	}
+
+	TDelegate& operator=(const TDelegate& Other)
+	{
+		if (this != &Other)
+		{
+			TDelegate Copy(Other);
+			Bindings = std::move(Copy.Bindings);
+			PendingBindings.clear();
+			NextHandle = Copy.NextHandle;
+		}
+		return *this;
+	}
+
+	/** 람다, 함수 포인터, std::function 등 호출 가능한 모든 대상 */
+	template<typename FuncType>
+	FDelegateHandle Add(FuncType&& Func)
+	{
+		static_assert(std::is_copy_constructible_v<std::decay_t<FuncType>>, "Delegate handlers must be copyable (components are duplicated by copy)");
+
+		FBinding Binding;
+		Binding.template Emplace<std::decay_t<FuncType>>(std::forward<FuncType>(Func));
+		return AddBinding(std::move(Binding));
 	}
 
-	// original: template<typename T>
+	/** 멤버 함수 직접 바인딩 (UObject면 객체 삭제 시 자동 해제) */
 	template<typename TObj, typename TClass>
 	FDelegateHandle AddDynamic(TObj* Instance, void(TClass::* Func)(Args...))
 	{
-		FDelegateHandle Handle = NextHandle++;
-		Handlers.push_back({
-			Handle,
-			[=](Args... args) {
-			(Instance->*Func)(args...); }
-		});
-		return Handle;
+		return AddMember<TObj>(Instance, Func);
+	}
+
+	template<typename TObj, typename TClass>
+	FDelegateHandle AddDynamic(TObj* Instance, void(TClass::* Func)(Args...) const)
+	{
+		return AddMember<TObj>(Instance, Func);
 	}
 
-	void Broadcast(Args... args) 
+	void Broadcast(Args... args)
 	{
-		for (auto& Entry : Handlers) {
-			if (Entry.Handler)
+		++BroadcastDepth;
+
+		// 도중 추가는 PendingBindings로 가므로 Bindings는 재할당되지 않음
+		const size_t Count = Bindings.size();
+		for (size_t i = 0; i < Count; ++i)
+		{
+			FBinding& Binding = Bindings[i];
+			if (Binding.Handle == 0)
+			{
+				continue;
+			}
+			if (!Binding.IsObjectAlive())
 			{
-				Entry.Handler(args...);
+				Binding.Handle = 0;
+				bHasDeadBindings = true;
+				continue;
 			}
+			Binding.Invoke(Binding.Storage, args...);
+		}
+
+		if (--BroadcastDepth == 0)
+		{
+			FlushPending();
 		}
 	}
 
-	void Remove(FDelegateHandle Handle)
+	bool Remove(FDelegateHandle Handle)
 	{
-		auto it = std::remove_if(Handlers.begin(), Handlers.end(),
-		[&](const Entry& e)
+		if (Handle == 0)
 		{
-			return e.Handle == Handle;
-		});
-		Handlers.erase(it, Handlers.end());
+			return false;
+		}
+		for (std::vector<FBinding>* List : { &Bindings, &PendingBindings })
+		{
+			for (FBinding& Binding : *List)
+			{
+				if (Binding.Handle == Handle)
+				{
+					Binding.Handle = 0;
+					bHasDeadBindings = true;
+					FlushPending();
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	/** Instance에 바인딩된 멤버 함수 핸들러를 모두 제거 */
+	void RemoveAll(const void* Instance)
+	{
+		for (std::vector<FBinding>* List : { &Bindings, &PendingBindings })
+		{
+			for (FBinding& Binding : *List)
+			{
+				if (Binding.Handle != 0 && Binding.Object == Instance)
+				{
+					Binding.Handle = 0;
+					bHasDeadBindings = true;
+				}
+			}
+		}
+		FlushPending();
 	}
 
 	void Clear()
 	{
-		Handlers.clear();
+		for (FBinding& Binding : Bindings)
+		{
+			Binding.Handle = 0;
+		}
+		PendingBindings.clear();
+		bHasDeadBindings = !Bindings.empty();
+		FlushPending();
+	}
+
+	bool IsBound() const
+	{
+		for (const FBinding& Binding : Bindings)
+		{
+			if (Binding.Handle != 0 && Binding.IsObjectAlive())
+			{
+				return true;
+			}
+		}
+		return !PendingBindings.empty();
+	}
+
+	int32 Num() const
+	{
+		int32 Count = static_cast<int32>(PendingBindings.size());
+		for (const FBinding& Binding : Bindings)
+		{
+			Count += Binding.Handle != 0 ? 1 : 0;
+		}
+		return Count;
 	}
 
 private:
-	struct Entry
+	using FInvokeFunc = void(*)(void*, std::add_lvalue_reference_t<Args>...);
+
+	enum class EManageOp : uint8 { Copy, Move, Destroy };
+	using FManageFunc = void(*)(EManageOp, void* Dst, void* Src);
+
+	struct FBinding
+	{
+		FDelegateHandle Handle = 0;
+		FInvokeFunc Invoke = nullptr;
+		FManageFunc Manage = nullptr;    // nullptr면 trivially copyable (memcpy로 이동/복사, 파괴 불필요)
+		const void* Object = nullptr;    // RemoveAll용 (멤버 바인딩만)
+		uint32 ObjectIndex = UINT32_MAX; // UObject 바인딩 생존 확인용 슬롯/세대
+		uint32 ObjectGeneration = 0;
+		alignas(16) unsigned char Storage[InlineSize];
+
+		FBinding() = default;
+
+		FBinding(const FBinding& Other) { CopyFrom(Other, EManageOp::Copy); }
+		FBinding(FBinding&& Other) noexcept { CopyFrom(Other, EManageOp::Move); }
+
+		FBinding& operator=(const FBinding& Other)
+		{
+			if (this != &Other)
+			{
+				Reset();
+				CopyFrom(Other, EManageOp::Copy);
+			}
+			return *this;
+		}
+
+		FBinding& operator=(FBinding&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Reset();
+				CopyFrom(Other, EManageOp::Move);
+			}
+			return *this;
+		}
+
+		~FBinding() { Reset(); }
+
+		template<typename FuncType, typename... CtorArgs>
+		void Emplace(CtorArgs&&... InArgs)
+		{
+			if constexpr (sizeof(FuncType) <= InlineSize && alignof(FuncType) <= 16 && std::is_nothrow_move_constructible_v<FuncType>)
+			{
+				::new (static_cast<void*>(Storage)) FuncType(std::forward<CtorArgs>(InArgs)...);
+				Invoke = [](void* InStorage, std::add_lvalue_reference_t<Args>... CallArgs)
+				{
+					(*std::launder(static_cast<FuncType*>(InStorage)))(CallArgs...);
+				};
+				if constexpr (!std::is_trivially_copyable_v<FuncType>)
+				{
+					Manage = [](EManageOp Op, void* Dst, void* Src)
+					{
+						FuncType* Source = std::launder(static_cast<FuncType*>(Src));
+						switch (Op)
+						{
+						case EManageOp::Copy:
+							::new (Dst) FuncType(*Source);
+							break;
+						case EManageOp::Move:
+							::new (Dst) FuncType(std::move(*Source));
+							Source->~FuncType();
+							break;
+						case EManageOp::Destroy:
+							Source->~FuncType();
+							break;
+						}
+					};
+				}
+			}
+			else
+			{
+				// 인라인 버퍼에 들어가지 않는 큰 호출 대상만 힙에 둠
+				FuncType* HeapFunc = new FuncType(std::forward<CtorArgs>(InArgs)...);
+				std::memcpy(Storage, &HeapFunc, sizeof(HeapFunc));
+				Invoke = [](void* InStorage, std::add_lvalue_reference_t<Args>... CallArgs)
+				{
+					(**static_cast<FuncType**>(InStorage))(CallArgs...);
+				};
+				Manage = [](EManageOp Op, void* Dst, void* Src)
+				{
+					FuncType* Source = *static_cast<FuncType**>(Src);
+					switch (Op)
+					{
+					case EManageOp::Copy:
+					{
+						FuncType* Copied = new FuncType(*Source);
+						std::memcpy(Dst, &Copied, sizeof(Copied));
+						break;
+					}
+					case EManageOp::Move:
+						std::memcpy(Dst, &Source, sizeof(Source));
+						break;
+					case EManageOp::Destroy:
+						delete Source;
+						break;
+					}
+				};
+			}
+		}
+
+		bool IsObjectAlive() const
+		{
+			return ObjectIndex == UINT32_MAX || ObjectFactory::ResolveObjectHandle(ObjectIndex, ObjectGeneration) != nullptr;
+		}
+
+		void Reset()
+		{
+			if (Invoke && Manage)
+			{
+				Manage(EManageOp::Destroy, nullptr, Storage);
+			}
+			Invoke = nullptr;
+			Manage = nullptr;
+		}
+
+	private:
+		void CopyFrom(const FBinding& Other, EManageOp Op)
+		{
+			Handle = Other.Handle;
+			Invoke = Other.Invoke;
+			Manage = Other.Manage;
+			Object = Other.Object;
+			ObjectIndex = Other.ObjectIndex;
+			ObjectGeneration = Other.ObjectGeneration;
+			if (!Other.Invoke)
+			{
+				return;
+			}
+			if (Manage)
+			{
+				Manage(Op, Storage, const_cast<unsigned char*>(Other.Storage));
+			}
+			else
+			{
+				std::memcpy(Storage, Other.Storage, InlineSize);
+			}
+			if (Op == EManageOp::Move)
+			{
+				// 이동된 원본은 빈 바인딩 (소멸자에서 다시 파괴하지 않도록)
+				FBinding& Source = const_cast<FBinding&>(Other);
+				Source.Invoke = nullptr;
+				Source.Manage = nullptr;
+				Source.Handle = 0;
+			}
+		}
+	};
+
+	/** 객체 포인터 + 멤버 함수 포인터 (trivially copyable이므로 인라인 저장, 관리 함수 없음) */
+	template<typename TObj, typename MemberFuncType>
+	struct TMemberCall
 	{
-		FDelegateHandle Handle;
-		HandlerType Handler;
+		TObj* Instance;
+		MemberFuncType Func;
+
+		void operator()(std::add_lvalue_reference_t<Args>... InArgs) const
+		{
+			(Instance->*Func)(InArgs...);
+		}
 	};
 
-	std::vector<Entry> Handlers;
+	template<typename TObj, typename MemberFuncType>
+	FDelegateHandle AddMember(TObj* Instance, MemberFuncType Func)
+	{
+		using FCall = TMemberCall<TObj, MemberFuncType>;
+		static_assert(sizeof(FCall) <= InlineSize, "Member function binding does not fit the inline buffer");
+
+		FBinding Binding;
+		Binding.template Emplace<FCall>(FCall{ Instance, Func });
+		Binding.Object = Instance;
+		if constexpr (std::is_base_of_v<UObject, TObj>)
+		{
+			if (Instance && Instance->InternalIndex < static_cast<uint32>(GUObjectGenerations.Num()))
+			{
+				Binding.ObjectIndex = Instance->InternalIndex;
+				Binding.ObjectGeneration = GUObjectGenerations[Instance->InternalIndex];
+			}
+		}
+		return AddBinding(std::move(Binding));
+	}
+
+	FDelegateHandle AddBinding(FBinding&& Binding)
+	{
+		Binding.Handle = NextHandle++;
+		const FDelegateHandle Handle = Binding.Handle;
+		(BroadcastDepth > 0 ? PendingBindings : Bindings).push_back(std::move(Binding));
+		return Handle;
+	}
+
+	/** Broadcast 중이 아니면 제거 표시된 바인딩을 정리하고, 대기 중인 추가분을 합침 */
+	void FlushPending()
+	{
+		if (BroadcastDepth > 0)
+		{
+			return;
+		}
+		if (bHasDeadBindings)
+		{
+			RemoveDeadBindings();
+		}
+		if (!PendingBindings.empty())
+		{
+			for (FBinding& Binding : PendingBindings)
+			{
+				if (Binding.Handle != 0)
+				{
+					Bindings.push_back(std::move(Binding));
+				}
+			}
+			PendingBindings.clear();
+		}
+	}
+
+	void RemoveDeadBindings()
+	{
+		Bindings.erase(std::remove_if(Bindings.begin(), Bindings.end(),
+			[](const FBinding& Binding) { return Binding.Handle == 0; }), Bindings.end());
+		bHasDeadBindings = false;
+	}
+
+	std::vector<FBinding> Bindings;
+	std::vector<FBinding> PendingBindings; // Broadcast 도중 추가된 바인딩
 	FDelegateHandle NextHandle;
+	uint32 BroadcastDepth = 0;
+	bool bHasDeadBindings = false;
 };
 
 // 델리게이트 인스턴스 생성용 매크로 (실제 멤버 변수 선언)
@@ -81,4 +415,4 @@ private:
 #define DECLARE_DELEGATE_TYPE(Name, ...)          using Name = TDelegate<__VA_ARGS__>;
 #define DECLARE_DELEGATE_TYPE_OneParam(Name, T1)  using Name = TDelegate<T1>;
 #define DECLARE_DELEGATE_TYPE_TwoParam(Name, T1, T2) using Name = TDelegate<T1, T2>;
-#define DECLARE_DYNAMIC_DELEGATE_TYPE(Name, ...)  using Name = std::shared_ptr<TDelegate<__VA_ARGS__>>;
\ No newline at end of file
+#define DECLARE_DYNAMIC_DELEGATE_TYPE(Name, ...)  using Name = std::shared_ptr<TDelegate<__VA_ARGS__>>;
@@ -155,7 +155,7 @@ enum class EEngineShowFlags : uint64
 
     SF_OctreeDebug = 1ull << 7,  // Show/hide octree debug bounds
     SF_BVHDebug = 1ull << 8,  // Show/hide BVH debug bounds
-    SF_Culling = 1ull << 9,          // Show/hide world grid
+    SF_Culling = 1ull << 9,          // Enable/disable view frustum culling
 
     SF_Decals = 1ull << 10,
     SF_Fog = 1ull << 11,
@@ -177,9 +177,12 @@ enum class EEngineShowFlags : uint64
     SF_Collision = 1ull << 21,    // Show/hide collision component debug shapes
     SF_CollisionBVH = 1ull << 22, // Show/hide collision BVH debug visualization
 
+    SF_OcclusionCulling = 1ull << 23, // Enable/disable CPU software occlusion culling
+
     // Default enabled flags
     SF_DefaultEnabled = SF_Primitives | SF_StaticMeshes | SF_SkeletalMeshes | SF_Grid | SF_Lighting | SF_Decals |
-        SF_Fog | SF_FXAA | SF_Billboard | SF_EditorIcon | SF_Shadows | SF_ShadowAntiAliasing | SF_GPUSkinning | SF_Particles,
+        SF_Fog | SF_FXAA | SF_Billboard | SF_EditorIcon | SF_Shadows | SF_ShadowAntiAliasing | SF_GPUSkinning | SF_Particles |
+        SF_Culling | SF_OcclusionCulling,
 
     // All flags (for initialization/reset)
     SF_All = 0xFFFFFFFFFFFFFFFFull
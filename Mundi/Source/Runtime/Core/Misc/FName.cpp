@@ -1,62 +1,312 @@
 ﻿#include "pch.h"
 #include "Name.h"
+#include <atomic>
+#include <mutex>
 
 namespace
 {
-    // NameMap을 안전하게 가져오는 getter
-    static TMap<FString, uint32>& GetNameMap()
+    // ASCII 소문자 변환 (로케일 무관, 할당 없음)
+    inline char ToLowerAscii(char c)
     {
-        // 함수 내의 static 변수는 처음 호출될 때 스레드에 안전하게
-        // 단 한 번만 초기화됩니다.
-        static TMap<FString, uint32> GNameMap;
-        return GNameMap;
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
     }
 
-    // Entries를 안전하게 가져오는 getter
-    static TArray<FNameEntry>& GetEntries()
+    // 각 바이트가 'A'~'Z'이면 해당 바이트의 최상위 비트(0x80)를 세운 마스크 (UTF-8 바이트는 그대로)
+    inline uint64 UpperCaseMask(uint64 Word)
     {
-        static TArray<FNameEntry> GEntries;
-        return GEntries;
+        constexpr uint64 Low7 = 0x7F7F7F7F7F7F7F7Full;
+        const uint64 Low = Word & Low7;
+        const uint64 AtLeastA = Low + 0x3F3F3F3F3F3F3F3Full;   // >= 'A'
+        const uint64 AboveZ = Low + 0x2525252525252525ull;     // > 'Z'
+        return AtLeastA & ~AboveZ & ~Word & 0x8080808080808080ull;
     }
 
-    // FString을 소문자로 변환하는 헬퍼 함수
-    static FString ToLower(const FString& InStr)
+    // 상위 비트는 샤드 선택, 하위 비트는 슬롯 위치에 쓰이므로 전체 비트를 고루 섞음
+    inline uint32 MixHash(uint32 Hash)
     {
-        FString Result = InStr;
-        std::transform(Result.begin(), Result.end(), Result.begin(),
-            [](unsigned char c) { return std::tolower(c); });
-        return Result;
+        Hash ^= Hash >> 16;
+        Hash *= 0x7feb352du;
+        Hash ^= Hash >> 15;
+        Hash *= 0x846ca68bu;
+        Hash ^= Hash >> 16;
+        return Hash;
     }
+
+    /**
+     * @brief 샤드 하나의 해시 테이블 (오픈 어드레싱, 선형 탐사)
+     *
+     * 슬롯 값 = (해시 << 32) | (엔트리 인덱스 + 1), 0이면 빈 슬롯.
+     * 읽기는 락 없이 acquire 로드, 쓰기는 샤드 뮤텍스 안에서 release 저장.
+     * 테이블이 커지면 새 배열을 만들어 포인터를 교체하고, 옛 배열은 읽는 중인 스레드를 위해 해제하지 않음.
+     */
+    struct FNameSlotTable
+    {
+        uint32 Capacity = 0;  // 2의 거듭제곱
+        std::unique_ptr<std::atomic<uint64>[]> Slots;
+
+        explicit FNameSlotTable(uint32 InCapacity)
+            : Capacity(InCapacity)
+            , Slots(new std::atomic<uint64>[InCapacity])
+        {
+            for (uint32 i = 0; i < Capacity; ++i)
+            {
+                Slots[i].store(0, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    constexpr uint32 InitialSlotCapacity = 256;
+
+    struct FNameShard
+    {
+        std::mutex Mutex;
+        std::atomic<FNameSlotTable*> DisplayTable{ nullptr };     // 원문 엔트리 (원문 비교)
+        std::atomic<FNameSlotTable*> ComparisonTable{ nullptr };  // 대표 엔트리 (대소문자 무시 비교)
+        uint32 DisplayCount = 0;
+        uint32 ComparisonCount = 0;
+        TArray<std::unique_ptr<FNameSlotTable>> OwnedTables;     // 교체된 테이블도 보관 (읽는 중인 스레드 보호)
+    };
+
+    struct FNamePoolData
+    {
+        FNameShard Shards[FNamePool::NumShards];
+        std::atomic<FNameEntry*> Blocks[FNamePool::MaxBlocks] = {};
+        std::atomic<uint32> NumEntries{ 0 };
+
+        FNamePoolData()
+        {
+            for (FNameShard& Shard : Shards)
+            {
+                Shard.OwnedTables.emplace_back(std::make_unique<FNameSlotTable>(InitialSlotCapacity));
+                Shard.DisplayTable.store(Shard.OwnedTables.back().get(), std::memory_order_relaxed);
+                Shard.OwnedTables.emplace_back(std::make_unique<FNameSlotTable>(InitialSlotCapacity));
+                Shard.ComparisonTable.store(Shard.OwnedTables.back().get(), std::memory_order_relaxed);
+            }
+        }
+    };
+
+    // 정적 초기화/소멸 중에도 FName이 쓰이므로 처음 호출될 때 만들고 해제하지 않음
+    FNamePoolData& GetPoolData()
+    {
+        static FNamePoolData* PoolData = new FNamePoolData();
+        return *PoolData;
+    }
+
+    FNameShard& GetShard(FNamePoolData& Data, uint32 Hash)
+    {
+        // 슬롯 위치는 하위 비트를 쓰므로 샤드는 상위 비트로 선택 (대소문자만 다른 이름은 같은 샤드)
+        return Data.Shards[Hash >> 28];
+    }
+
+    const FNameEntry& GetEntryUnchecked(FNamePoolData& Data, uint32 Index)
+    {
+        FNameEntry* Block = Data.Blocks[Index >> FNamePool::EntriesPerBlockBits].load(std::memory_order_acquire);
+        return Block[Index & (FNamePool::EntriesPerBlock - 1)];
+    }
+
+    template<typename MatchFuncType>
+    uint32 FindInTable(const FNameSlotTable& Table, uint32 Hash, MatchFuncType&& Match)
+    {
+        const uint32 Mask = Table.Capacity - 1;
+        for (uint32 Probe = Hash & Mask; ; Probe = (Probe + 1) & Mask)
+        {
+            const uint64 Slot = Table.Slots[Probe].load(std::memory_order_acquire);
+            if (Slot == 0)
+            {
+                return UINT32_MAX;
+            }
+            if (static_cast<uint32>(Slot >> 32) == Hash)
+            {
+                const uint32 Index = static_cast<uint32>(Slot) - 1;
+                if (Match(Index))
+                {
+                    return Index;
+                }
+            }
+        }
+    }
+
+    void InsertIntoTable(FNameSlotTable& Table, uint32 Hash, uint32 Index)
+    {
+        const uint32 Mask = Table.Capacity - 1;
+        uint32 Probe = Hash & Mask;
+        while (Table.Slots[Probe].load(std::memory_order_relaxed) != 0)
+        {
+            Probe = (Probe + 1) & Mask;
+        }
+        Table.Slots[Probe].store((static_cast<uint64>(Hash) << 32) | (static_cast<uint64>(Index) + 1), std::memory_order_release);
+    }
+
+    // 샤드 뮤텍스 안에서 호출: 사용률 50%를 넘기 전에 두 배로 키워 교체
+    void InsertWithGrow(FNameShard& Shard, std::atomic<FNameSlotTable*>& TablePtr, uint32& Count, uint32 Hash, uint32 Index)
+    {
+        FNameSlotTable* Table = TablePtr.load(std::memory_order_relaxed);
+        if ((Count + 1) * 2 > Table->Capacity)
+        {
+            std::unique_ptr<FNameSlotTable> NewTable = std::make_unique<FNameSlotTable>(Table->Capacity * 2);
+            for (uint32 i = 0; i < Table->Capacity; ++i)
+            {
+                const uint64 Slot = Table->Slots[i].load(std::memory_order_relaxed);
+                if (Slot != 0)
+                {
+                    InsertIntoTable(*NewTable, static_cast<uint32>(Slot >> 32), static_cast<uint32>(Slot) - 1);
+                }
+            }
+            Table = NewTable.get();
+            Shard.OwnedTables.emplace_back(std::move(NewTable));
+            TablePtr.store(Table, std::memory_order_release);
+        }
+
+        InsertIntoTable(*Table, Hash, Index);
+        ++Count;
+    }
+
+    uint32 FindDisplayIndex(FNamePoolData& Data, FNameShard& Shard, std::string_view InStr, uint32 Hash)
+    {
+        const FNameSlotTable* Table = Shard.DisplayTable.load(std::memory_order_acquire);
+        return FindInTable(*Table, Hash, [&Data, InStr](uint32 Index)
+        {
+            return std::string_view(GetEntryUnchecked(Data, Index).Display) == InStr;
+        });
+    }
+
+    uint32 FindComparisonIndex(FNamePoolData& Data, FNameShard& Shard, std::string_view InStr, uint32 Hash)
+    {
+        const FNameSlotTable* Table = Shard.ComparisonTable.load(std::memory_order_acquire);
+        return FindInTable(*Table, Hash, [&Data, InStr](uint32 Index)
+        {
+            return FNamePool::EqualsIgnoreCase(GetEntryUnchecked(Data, Index).Display, InStr);
+        });
+    }
+
+    uint32 AllocateEntry(FNamePoolData& Data)
+    {
+        const uint32 Index = Data.NumEntries.fetch_add(1, std::memory_order_relaxed);
+        const uint32 BlockIndex = Index >> FNamePool::EntriesPerBlockBits;
+        assert(BlockIndex < FNamePool::MaxBlocks && "FNamePool is full");
+
+        // 블록은 처음 필요한 스레드가 만들고, 경쟁에서 진 쪽은 버림 (다른 샤드가 동시에 추가할 수 있음)
+        if (!Data.Blocks[BlockIndex].load(std::memory_order_acquire))
+        {
+            FNameEntry* NewBlock = new FNameEntry[FNamePool::EntriesPerBlock];
+            FNameEntry* Expected = nullptr;
+            if (!Data.Blocks[BlockIndex].compare_exchange_strong(Expected, NewBlock, std::memory_order_acq_rel))
+            {
+                delete[] NewBlock;
+            }
+        }
+        return Index;
+    }
+}
+
+uint32 FNamePool::ComputeHash(std::string_view InStr)
+{
+    // 8바이트씩 읽어 SWAR로 ASCII 대문자만 소문자로 바꾼 뒤 곱셈 해시 (바이트 단위 FNV보다 몇 배 빠름)
+    constexpr uint64 Multiplier = 0x9E3779B97F4A7C15ull;
+    uint64 Hash = 0xCBF29CE484222325ull ^ (InStr.size() * Multiplier);
+
+    const char* Data = InStr.data();
+    size_t Remaining = InStr.size();
+    while (Remaining > 0)
+    {
+        uint64 Word = 0;
+        const size_t Count = Remaining < 8 ? Remaining : 8;
+        memcpy(&Word, Data, Count);
+        Data += Count;
+        Remaining -= Count;
+
+        Word |= UpperCaseMask(Word) >> 2;  // 'A'~'Z' 바이트에 0x20
+        Hash = (Hash ^ Word) * Multiplier;
+        Hash ^= Hash >> 32;
+    }
+    return MixHash(static_cast<uint32>(Hash) ^ static_cast<uint32>(Hash >> 29));
+}
+
+bool FNamePool::EqualsIgnoreCase(std::string_view A, std::string_view B)
+{
+    if (A.size() != B.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < A.size(); ++i)
+    {
+        if (ToLowerAscii(A[i]) != ToLowerAscii(B[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32 FNamePool::Add(std::string_view InStr)
+{
+    const uint32 Hash = ComputeHash(InStr);
+
+    FNamePoolData& Data = GetPoolData();
+    FNameShard& Shard = GetShard(Data, Hash);
+
+    // 1. 락 없는 조회 (대부분 여기서 끝남)
+    uint32 Index = FindDisplayIndex(Data, Shard, InStr, Hash);
+    if (Index != UINT32_MAX)
+    {
+        return Index;
+    }
+
+    // 2. 샤드 락 후 다시 확인하고 추가
+    std::lock_guard<std::mutex> Lock(Shard.Mutex);
+    Index = FindDisplayIndex(Data, Shard, InStr, Hash);
+    if (Index != UINT32_MAX)
+    {
+        return Index;
+    }
+
+    const uint32 Comparison = FindComparisonIndex(Data, Shard, InStr, Hash);
+
+    Index = AllocateEntry(Data);
+    FNameEntry& Entry = const_cast<FNameEntry&>(GetEntryUnchecked(Data, Index));
+    Entry.Display.assign(InStr.data(), InStr.size());
+    Entry.ComparisonIndex = (Comparison != UINT32_MAX) ? Comparison : Index;
+    Entry.Hash = Hash;
+
+    // 엔트리를 다 채운 뒤 슬롯을 공개 (release)
+    if (Comparison == UINT32_MAX)
+    {
+        InsertWithGrow(Shard, Shard.ComparisonTable, Shard.ComparisonCount, Hash, Index);
+    }
+    InsertWithGrow(Shard, Shard.DisplayTable, Shard.DisplayCount, Hash, Index);
+    return Index;
 }
 
-uint32 FNamePool::Add(const FString& InStr)
+uint32 FNamePool::Find(std::string_view InStr)
 {
-    FString Lower = ToLower(InStr);
+    const uint32 Hash = ComputeHash(InStr);
 
-    // 전역 변수 대신 getter를 통해 접근
-    TMap<FString, uint32>& NameMap = GetNameMap();
-    TArray<FNameEntry>& Entries = GetEntries();
+    FNamePoolData& Data = GetPoolData();
+    return FindDisplayIndex(Data, GetShard(Data, Hash), InStr, Hash);
+}
 
-    auto it = NameMap.find(Lower);
-    if (it != NameMap.end())
-        return it->second;
+uint32 FNamePool::FindComparison(std::string_view InStr)
+{
+    const uint32 Hash = ComputeHash(InStr);
 
-    uint32 NewIndex = (uint32)Entries.size();
-    Entries.push_back({ InStr, Lower });
-    NameMap[Lower] = NewIndex;
-    return NewIndex;
+    FNamePoolData& Data = GetPoolData();
+    return FindComparisonIndex(Data, GetShard(Data, Hash), InStr, Hash);
 }
 
 const FNameEntry& FNamePool::Get(uint32 Index)
 {
-    // 전역 변수 대신 getter를 통해 접근
-    TArray<FNameEntry>& Entries = GetEntries();
+    FNamePoolData& Data = GetPoolData();
 
     // (안전성 강화) 경계 검사 추가
-    if (Index >= Entries.size())
+    if (Index >= Data.NumEntries.load(std::memory_order_acquire))
     {
-        static FNameEntry InvalidEntry = { "Invalid", "invalid" };
+        static FNameEntry InvalidEntry = { "Invalid", UINT32_MAX, 0 };
         return InvalidEntry;
     }
-    return Entries[Index];
-}
\ No newline at end of file
+    return GetEntryUnchecked(Data, Index);
+}
+
+uint32 FNamePool::Num()
+{
+    return GetPoolData().NumEntries.load(std::memory_order_acquire);
+}
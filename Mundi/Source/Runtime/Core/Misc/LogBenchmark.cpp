@@ -0,0 +1,169 @@
+#include "pch.h"
+#include "LogBenchmark.h"
+#include "LogSystem.h"
+#include "PlatformTime.h"
+#include "BenchmarkRegistry.h"
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	const char* const BenchFormat = "[Bench] actor %d moved to (%.2f, %.2f, %.2f) owner %s";
+	const char* const BenchNames[] = { "PlayerPawn", "Enemy_Grunt_017", "StaticMeshActor_204", "PointLight" };
+
+	// 이전 UGlobalConsole::LogV의 워커 스레드 경로
+	struct FLegacyLogBuffer
+	{
+		std::mutex Mutex;
+		TArray<FString> PendingLogs;
+
+		void Log(const char* Format, ...)
+		{
+			char Buffer[1024];
+			va_list Args;
+			va_start(Args, Format);
+			vsnprintf_s(Buffer, _countof(Buffer), _TRUNCATE, Format, Args);
+			va_end(Args);
+
+			std::lock_guard<std::mutex> Lock(Mutex);
+			PendingLogs.Add(Buffer);
+		}
+	};
+
+	// 큐가 가득 차면 버리지 않고 다시 시도 (컨슈머 처리 속도까지 포함해 측정)
+	void PushBench(FLogQueue& Queue, const char* Format, ...)
+	{
+		va_list Args;
+		va_start(Args, Format);
+		while (true)
+		{
+			va_list Attempt;
+			va_copy(Attempt, Args);
+			const bool bPushed = Queue.Push(&LogTemp, ELogVerbosity::Log, Format, Attempt);
+			va_end(Attempt);
+			if (bPushed)
+			{
+				break;
+			}
+			std::this_thread::yield();
+		}
+		va_end(Args);
+	}
+
+	/** 포맷된 글자 수만 세는 싱크 */
+	class FCountingSink : public FLogSink
+	{
+	public:
+		void Write(const FLogRecord& Record) override
+		{
+			NumCharacters += Record.Length;
+			++NumRecords;
+		}
+
+		uint64 NumCharacters = 0;
+		uint64 NumRecords = 0;
+	};
+
+	template<typename FuncType>
+	double MeasureParallelMS(int32 NumThreads, FuncType&& Func)
+	{
+		TArray<std::thread> Threads;
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+		{
+			Threads.emplace_back(Func, ThreadIndex);
+		}
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+
+	void LogScenario(const char* Name, uint64 Operations, double LegacyMS, double NewMS)
+	{
+		const double Speedup = NewMS > 0.0 ? LegacyMS / NewMS : 0.0;
+		const double Mops = NewMS > 0.0 ? static_cast<double>(Operations) / (NewMS * 1000.0) : 0.0;
+		UE_LOG("[LogBenchmark] %-26s %10.2f %10.2f %7.2fx %9.2f", Name, LegacyMS, NewMS, Speedup, Mops);
+	}
+
+	/**
+	 * @param QueueCapacity 메시지 전체가 들어가면 호출 스레드 비용만, 작으면 컨슈머 처리 속도에 묶인 지속 처리량을 측정
+	 */
+	void RunScenario(const char* Label, int32 NumThreads, int32 MessagesPerThread, uint32 QueueCapacity)
+	{
+		auto Producer = [MessagesPerThread](auto&& LogFunc, int32 ThreadIndex)
+		{
+			for (int32 Index = 0; Index < MessagesPerThread; ++Index)
+			{
+				const float Value = static_cast<float>(Index) * 0.25f;
+				LogFunc(BenchFormat, ThreadIndex * MessagesPerThread + Index, Value, Value * 2.0f, -Value, BenchNames[Index & 3]);
+			}
+		};
+
+		FLegacyLogBuffer Legacy;
+		const double LegacyMS = MeasureParallelMS(NumThreads, [&](int32 ThreadIndex)
+		{
+			Producer([&](auto&&... Args) { Legacy.Log(Args...); }, ThreadIndex);
+		});
+
+		FLogQueue Queue(QueueCapacity);
+		FCountingSink Sink;
+		std::atomic<bool> bProducing{ true };
+		std::thread Consumer([&]()
+		{
+			while (bProducing.load() || !Queue.IsEmpty())
+			{
+				if (Queue.Drain(Sink, 1024) == 0)
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		const double NewMS = MeasureParallelMS(NumThreads, [&](int32 ThreadIndex)
+		{
+			Producer([&](auto&&... Args) { PushBench(Queue, Args...); }, ThreadIndex);
+		});
+		const uint64 DrainStart = FPlatformTime::Cycles64();
+		bProducing.store(false);
+		Consumer.join();
+		const double DrainTailMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - DrainStart);
+
+		const uint64 NumMessages = static_cast<uint64>(NumThreads) * MessagesPerThread;
+		char Name[64];
+		snprintf(Name, sizeof(Name), "%s %d threads x %dk", Label, NumThreads, MessagesPerThread / 1000);
+		LogScenario(Name, NumMessages, LegacyMS, NewMS);
+
+		uint64 LegacyCharacters = 0;
+		for (const FString& Message : Legacy.PendingLogs)
+		{
+			LegacyCharacters += Message.size();
+		}
+		if (Sink.NumRecords != NumMessages || Sink.NumCharacters != LegacyCharacters)
+		{
+			UE_LOG("[LogBenchmark] output mismatch: %llu/%llu records, %llu vs %llu chars",
+				Sink.NumRecords, NumMessages, Sink.NumCharacters, LegacyCharacters);
+		}
+		UE_LOG("[LogBenchmark]   consumer finished %.2f ms after producers", DrainTailMS);
+	}
+}
+
+void FLogBenchmark::RunAndLog()
+{
+	UE_LOG("[LogBenchmark] %-26s %10s %10s %8s %9s", "Scenario", "old(ms)", "new(ms)", "Speedup", "Mops/s");
+
+	const int32 MessagesPerThread = 10000;
+	const int32 ThreadCounts[] = { 1, 2, 4, 8 };
+	for (int32 NumThreads : ThreadCounts)
+	{
+		// 한 프레임에 몰린 로그: 큐가 전부 담으므로 게임 스레드가 실제로 쓰는 시간
+		RunScenario("burst", NumThreads, MessagesPerThread, static_cast<uint32>(NumThreads * MessagesPerThread));
+		// 계속 쏟아지는 로그: 엔진과 같은 크기의 큐 (컨슈머 속도에 묶임)
+		RunScenario("sustained", NumThreads, MessagesPerThread, 1u << 13);
+	}
+}
+
+static const bool bLogBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"LOG BENCH", "-logbench", "log backend benchmark (1-8 producer threads)", EBenchmarkStage::None,
+	[](const FString&) { FLogBenchmark::RunAndLog(); } });
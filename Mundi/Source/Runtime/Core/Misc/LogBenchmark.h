@@ -0,0 +1,17 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 로그 백엔드 처리량 벤치마크 (콘솔 LOG BENCH 명령)
+ *
+ * 여러 스레드가 동시에 같은 형식의 로그를 남길 때 호출 스레드가 쓰는 시간을 비교합니다.
+ * - old: 이전 워커 스레드 경로 (vsnprintf로 완성 → 뮤텍스 → FString을 배열에 추가)
+ * - new: FLogQueue::Push (인자만 슬롯에 복사), 컨슈머 스레드가 동시에 포맷
+ *   burst는 큐가 전체 메시지를 담는 경우, sustained는 엔진과 같은 크기의 큐에서 가득 차면 다시 시도하는 경우
+ * 실제 싱크 대신 글자 수만 세는 싱크를 쓰므로 콘솔/파일에는 결과 표만 남습니다.
+ */
+class FLogBenchmark
+{
+public:
+	static void RunAndLog();
+};
@@ -0,0 +1,1165 @@
+#include "pch.h"
+#include "LogSystem.h"
+#include "PlatformTime.h"
+#include <charconv>
+#include <condition_variable>
+#include <cstdio>
+#include <cwchar>
+#include <mutex>
+#include <thread>
+
+DEFINE_LOG_CATEGORY(LogTemp)
+
+/** 링 버퍼 한 칸 (헤더 40바이트 + 인자 페이로드) */
+struct alignas(64) FLogSlot
+{
+	std::atomic<uint64> Sequence;
+	uint64 Cycles;
+	const char* Format;             // 읽기 전용 리터럴이면 포인터, 아니면 nullptr (페이로드 앞에 복사본)
+	const FLogCategory* Category;
+	uint32 ThreadId;
+	uint16 PayloadSize;
+	ELogVerbosity Verbosity;
+	uint8 Flags;
+	uint8 Payload[FLogQueue::SlotSize - 40];
+};
+static_assert(sizeof(FLogSlot) == FLogQueue::SlotSize, "FLogSlot must fill exactly one slot.");
+
+namespace
+{
+	enum ELogSlotFlags : uint8
+	{
+		LogSlot_CopiedFormat = 1 << 0,  // 페이로드 = 포맷 문자열 + 인자
+		LogSlot_Preformatted = 1 << 1,  // 페이로드 = 완성된 문자열 (인자를 묶을 수 없거나 슬롯에 안 들어갈 때)
+	};
+
+	constexpr uint16 NullStringLength = 0xFFFF;
+
+	// ──────────────────────────────────────────────
+	// printf 형식 지정자 해석
+	// ──────────────────────────────────────────────
+
+	enum class ELogArgType : uint8
+	{
+		Int32,
+		Int64,
+		Double,
+		Pointer,
+		String,
+		WideString,
+	};
+
+	struct FFormatSpec
+	{
+		const char* Begin = nullptr;    // '%'
+		const char* End = nullptr;      // 변환 문자 다음
+		ELogArgType Type = ELogArgType::Int32;
+		bool bStarWidth = false;
+		bool bStarPrecision = false;
+		int32 Precision = -1;
+	};
+
+	/** Percent는 '%'를 가리킴. 지원하지 않는 형식(%n, long double 등)이면 false */
+	bool ParseFormatSpec(const char* Percent, FFormatSpec& Spec)
+	{
+		const char* P = Percent + 1;
+		Spec = FFormatSpec();
+		Spec.Begin = Percent;
+
+		while (*P == '-' || *P == '+' || *P == ' ' || *P == '#' || *P == '0')
+		{
+			++P;
+		}
+
+		if (*P == '*')
+		{
+			Spec.bStarWidth = true;
+			++P;
+		}
+		else
+		{
+			while (*P >= '0' && *P <= '9')
+			{
+				++P;
+			}
+		}
+
+		if (*P == '.')
+		{
+			++P;
+			if (*P == '*')
+			{
+				Spec.bStarPrecision = true;
+				++P;
+			}
+			else
+			{
+				Spec.Precision = 0;
+				while (*P >= '0' && *P <= '9')
+				{
+					Spec.Precision = Spec.Precision * 10 + (*P - '0');
+					++P;
+				}
+			}
+		}
+
+		// 길이 지정자 (MSVC의 I, I32, I64, w 포함)
+		bool bLong = false;
+		bool bLongLong = false;
+		bool bSizeT = false;
+		bool bLongDouble = false;
+		bool bWide = false;
+		switch (*P)
+		{
+		case 'h':
+			P += (P[1] == 'h') ? 2 : 1;
+			break;
+		case 'l':
+			if (P[1] == 'l') { bLongLong = true; P += 2; }
+			else { bLong = true; ++P; }
+			break;
+		case 'j':
+			bLongLong = true;
+			++P;
+			break;
+		case 'z':
+		case 't':
+			bSizeT = true;
+			++P;
+			break;
+		case 'L':
+			bLongDouble = true;
+			++P;
+			break;
+		case 'w':
+			bWide = true;
+			++P;
+			break;
+		case 'I':
+			if (P[1] == '6' && P[2] == '4') { bLongLong = true; P += 3; }
+			else if (P[1] == '3' && P[2] == '2') { P += 3; }
+			else { bSizeT = true; ++P; }
+			break;
+		default:
+			break;
+		}
+
+		switch (*P)
+		{
+		case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+			if (bLongLong)
+			{
+				Spec.Type = ELogArgType::Int64;
+			}
+			else if (bSizeT)
+			{
+				Spec.Type = sizeof(size_t) == 8 ? ELogArgType::Int64 : ELogArgType::Int32;
+			}
+			else if (bLong)
+			{
+				Spec.Type = sizeof(long) == 8 ? ELogArgType::Int64 : ELogArgType::Int32;
+			}
+			else
+			{
+				Spec.Type = ELogArgType::Int32;
+			}
+			break;
+		case 'c': case 'C':
+			Spec.Type = ELogArgType::Int32;
+			break;
+		case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+			if (bLongDouble && sizeof(long double) != sizeof(double))
+			{
+				return false;
+			}
+			Spec.Type = ELogArgType::Double;
+			break;
+		case 'p':
+			Spec.Type = ELogArgType::Pointer;
+			break;
+		case 's':
+			Spec.Type = (bLong || bWide) ? ELogArgType::WideString : ELogArgType::String;
+			break;
+		case 'S':
+			Spec.Type = ELogArgType::WideString;
+			break;
+		default:
+			return false;
+		}
+
+		Spec.End = P + 1;
+		return true;
+	}
+
+	// ──────────────────────────────────────────────
+	// 페이로드 직렬화
+	// ──────────────────────────────────────────────
+
+	struct FPayloadWriter
+	{
+		uint8* Data;
+		uint32 Capacity;
+		uint32 Size = 0;
+		bool bOverflow = false;
+
+		FPayloadWriter(uint8* InData, uint32 InCapacity) : Data(InData), Capacity(InCapacity) {}
+
+		void WriteBytes(const void* Source, uint32 NumBytes)
+		{
+			if (bOverflow || Size + NumBytes > Capacity)
+			{
+				bOverflow = true;
+				return;
+			}
+			memcpy(Data + Size, Source, NumBytes);
+			Size += NumBytes;
+		}
+
+		template<typename T>
+		void Write(const T& Value)
+		{
+			WriteBytes(&Value, sizeof(T));
+		}
+
+		template<typename CharType>
+		void WriteString(const CharType* String, size_t Length)
+		{
+			if (!String)
+			{
+				Write<uint16>(NullStringLength);
+				return;
+			}
+			if (Length >= NullStringLength)
+			{
+				bOverflow = true;
+				return;
+			}
+			const CharType Terminator = 0;
+			Write<uint16>(static_cast<uint16>(Length));
+			WriteBytes(String, static_cast<uint32>(Length * sizeof(CharType)));
+			WriteBytes(&Terminator, sizeof(CharType));
+		}
+	};
+
+	struct FPayloadReader
+	{
+		const uint8* Data;
+		uint32 Size;
+		uint32 Offset = 0;
+
+		template<typename T>
+		T Read()
+		{
+			T Value{};
+			if (Offset + sizeof(T) <= Size)
+			{
+				memcpy(&Value, Data + Offset, sizeof(T));
+				Offset += sizeof(T);
+			}
+			return Value;
+		}
+
+		template<typename CharType>
+		const CharType* ReadString()
+		{
+			const uint16 Length = Read<uint16>();
+			if (Length == NullStringLength)
+			{
+				return nullptr;
+			}
+			const CharType* String = reinterpret_cast<const CharType*>(Data + Offset);
+			Offset += (Length + 1) * sizeof(CharType);
+			return String;
+		}
+	};
+
+	size_t BoundedLength(const char* String, int32 Precision)
+	{
+		return Precision >= 0 ? strnlen(String, static_cast<size_t>(Precision)) : strlen(String);
+	}
+
+	size_t BoundedLength(const wchar_t* String, int32 Precision)
+	{
+		return Precision >= 0 ? wcsnlen(String, static_cast<size_t>(Precision)) : wcslen(String);
+	}
+
+	/** 형식 지정자 순서대로 인자 값을 묶음. 문자열은 정밀도만큼만 복사 */
+	bool PackArguments(const char* Format, va_list Args, FPayloadWriter& Writer)
+	{
+		for (const char* P = Format; *P; ++P)
+		{
+			if (*P != '%')
+			{
+				continue;
+			}
+			if (P[1] == '%')
+			{
+				++P;
+				continue;
+			}
+
+			FFormatSpec Spec;
+			if (!ParseFormatSpec(P, Spec))
+			{
+				return false;
+			}
+
+			if (Spec.bStarWidth)
+			{
+				Writer.Write<int32>(va_arg(Args, int));
+			}
+			int32 Precision = Spec.Precision;
+			if (Spec.bStarPrecision)
+			{
+				Precision = va_arg(Args, int);
+				Writer.Write<int32>(Precision);
+			}
+
+			switch (Spec.Type)
+			{
+			case ELogArgType::Int32:
+				Writer.Write<int32>(va_arg(Args, int));
+				break;
+			case ELogArgType::Int64:
+				Writer.Write<int64>(va_arg(Args, long long));
+				break;
+			case ELogArgType::Double:
+				Writer.Write<double>(va_arg(Args, double));
+				break;
+			case ELogArgType::Pointer:
+				Writer.Write<const void*>(va_arg(Args, const void*));
+				break;
+			case ELogArgType::String:
+			{
+				const char* String = va_arg(Args, const char*);
+				Writer.WriteString(String, String ? BoundedLength(String, Precision) : 0);
+				break;
+			}
+			case ELogArgType::WideString:
+			{
+				const wchar_t* String = va_arg(Args, const wchar_t*);
+				Writer.WriteString(String, String ? BoundedLength(String, Precision) : 0);
+				break;
+			}
+			}
+
+			if (Writer.bOverflow)
+			{
+				return false;
+			}
+			P = Spec.End - 1;
+		}
+		return !Writer.bOverflow;
+	}
+
+	template<typename T>
+	int FormatOneArgument(char* Out, size_t Capacity, const char* SpecText, const FFormatSpec& Spec, int32 Width, int32 Precision, T Value)
+	{
+		if (Spec.bStarWidth && Spec.bStarPrecision)
+		{
+			return snprintf(Out, Capacity, SpecText, Width, Precision, Value);
+		}
+		if (Spec.bStarWidth)
+		{
+			return snprintf(Out, Capacity, SpecText, Width, Value);
+		}
+		if (Spec.bStarPrecision)
+		{
+			return snprintf(Out, Capacity, SpecText, Precision, Value);
+		}
+		return snprintf(Out, Capacity, SpecText, Value);
+	}
+
+	/** 묶어 둔 인자로 포맷 문자열을 완성. 형식 지정자 하나씩 snprintf로 처리 */
+	int32 FormatPayload(const char* Format, FPayloadReader& Reader, char* Out, int32 Capacity)
+	{
+		int32 Length = 0;
+		auto Append = [&](int Written)
+		{
+			if (Written > 0)
+			{
+				Length = std::min(Length + Written, Capacity - 1);
+			}
+		};
+
+		for (const char* P = Format; *P && Length < Capacity - 1; )
+		{
+			if (*P != '%')
+			{
+				Out[Length++] = *P++;
+				continue;
+			}
+			if (P[1] == '%')
+			{
+				Out[Length++] = '%';
+				P += 2;
+				continue;
+			}
+
+			FFormatSpec Spec;
+			if (!ParseFormatSpec(P, Spec))
+			{
+				break;
+			}
+
+			// 플래그/폭/정밀도 없는 %s, %d, %u는 snprintf를 거치지 않음
+			if (Spec.End - Spec.Begin == 2 && !Spec.bStarWidth && !Spec.bStarPrecision)
+			{
+				const char Conversion = Spec.Begin[1];
+				if (Conversion == 's')
+				{
+					const char* String = Reader.ReadString<char>();
+					const char* Source = String ? String : "(null)";
+					const int32 Copy = std::min<int32>(static_cast<int32>(strlen(Source)), Capacity - 1 - Length);
+					memcpy(Out + Length, Source, Copy);
+					Length += Copy;
+					P = Spec.End;
+					continue;
+				}
+				if (Conversion == 'd' || Conversion == 'i' || Conversion == 'u')
+				{
+					const int32 Value = Reader.Read<int32>();
+					const std::to_chars_result Result = (Conversion == 'u')
+						? std::to_chars(Out + Length, Out + Capacity - 1, static_cast<uint32>(Value))
+						: std::to_chars(Out + Length, Out + Capacity - 1, Value);
+					if (Result.ec == std::errc())
+					{
+						Length = static_cast<int32>(Result.ptr - Out);
+					}
+					P = Spec.End;
+					continue;
+				}
+			}
+
+			char SpecText[32];
+			const size_t SpecLength = std::min<size_t>(Spec.End - Spec.Begin, sizeof(SpecText) - 1);
+			memcpy(SpecText, Spec.Begin, SpecLength);
+			SpecText[SpecLength] = '\0';
+
+			const int32 Width = Spec.bStarWidth ? Reader.Read<int32>() : 0;
+			const int32 Precision = Spec.bStarPrecision ? Reader.Read<int32>() : 0;
+			char* Target = Out + Length;
+			const size_t Remaining = static_cast<size_t>(Capacity - Length);
+
+			switch (Spec.Type)
+			{
+			case ELogArgType::Int32:
+				Append(FormatOneArgument(Target, Remaining, SpecText, Spec, Width, Precision, Reader.Read<int32>()));
+				break;
+			case ELogArgType::Int64:
+				Append(FormatOneArgument(Target, Remaining, SpecText, Spec, Width, Precision, Reader.Read<int64>()));
+				break;
+			case ELogArgType::Double:
+				Append(FormatOneArgument(Target, Remaining, SpecText, Spec, Width, Precision, Reader.Read<double>()));
+				break;
+			case ELogArgType::Pointer:
+				Append(FormatOneArgument(Target, Remaining, SpecText, Spec, Width, Precision, Reader.Read<const void*>()));
+				break;
+			case ELogArgType::String:
+				Append(FormatOneArgument(Target, Remaining, SpecText, Spec, Width, Precision, Reader.ReadString<char>()));
+				break;
+			case ELogArgType::WideString:
+				Append(FormatOneArgument(Target, Remaining, SpecText, Spec, Width, Precision, Reader.ReadString<wchar_t>()));
+				break;
+			}
+			P = Spec.End;
+		}
+
+		Out[Length] = '\0';
+		return Length;
+	}
+
+	// ──────────────────────────────────────────────
+	// 문자열 리터럴 판별 (실행 파일의 읽기 전용 섹션)
+	// ──────────────────────────────────────────────
+
+	struct FReadOnlyImage
+	{
+		static constexpr int32 MaxRanges = 16;
+		uintptr_t Begin[MaxRanges] = {};
+		uintptr_t End[MaxRanges] = {};
+		int32 NumRanges = 0;
+	};
+
+	const FReadOnlyImage& GetReadOnlyImage()
+	{
+		static const FReadOnlyImage Image = []()
+		{
+			FReadOnlyImage Result;
+			const uint8* Module = reinterpret_cast<const uint8*>(::GetModuleHandleW(nullptr));
+			if (!Module)
+			{
+				return Result;
+			}
+
+			const IMAGE_DOS_HEADER* DosHeader = reinterpret_cast<const IMAGE_DOS_HEADER*>(Module);
+			const IMAGE_NT_HEADERS* NtHeaders = reinterpret_cast<const IMAGE_NT_HEADERS*>(Module + DosHeader->e_lfanew);
+			const IMAGE_SECTION_HEADER* Section = IMAGE_FIRST_SECTION(NtHeaders);
+			for (WORD Index = 0; Index < NtHeaders->FileHeader.NumberOfSections && Result.NumRanges < FReadOnlyImage::MaxRanges; ++Index, ++Section)
+			{
+				const DWORD Characteristics = Section->Characteristics;
+				if ((Characteristics & IMAGE_SCN_MEM_READ) && !(Characteristics & IMAGE_SCN_MEM_WRITE))
+				{
+					Result.Begin[Result.NumRanges] = reinterpret_cast<uintptr_t>(Module + Section->VirtualAddress);
+					Result.End[Result.NumRanges] = Result.Begin[Result.NumRanges] + Section->Misc.VirtualSize;
+					++Result.NumRanges;
+				}
+			}
+			return Result;
+		}();
+		return Image;
+	}
+
+	/** 프로그램이 끝날 때까지 내용이 바뀌지 않는 문자열인지 (포인터만 보관해도 되는지) */
+	bool IsReadOnlyImageString(const char* String)
+	{
+		const FReadOnlyImage& Image = GetReadOnlyImage();
+		const uintptr_t Address = reinterpret_cast<uintptr_t>(String);
+		for (int32 Index = 0; Index < Image.NumRanges; ++Index)
+		{
+			if (Address >= Image.Begin[Index] && Address < Image.End[Index])
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	uint32 GetLogThreadId()
+	{
+		thread_local const uint32 ThreadId = static_cast<uint32>(::GetCurrentThreadId());
+		return ThreadId;
+	}
+
+	FLogCategory*& GetCategoryListHead()
+	{
+		static FLogCategory* Head = nullptr;
+		return Head;
+	}
+}
+
+// ──────────────────────────────────────────────
+// 카테고리 / 심각도
+// ──────────────────────────────────────────────
+
+FLogCategory::FLogCategory(const char* InName, ELogVerbosity InMinVerbosity)
+	: Name(InName), MinVerbosity(InMinVerbosity)
+{
+	FLogCategory*& Head = GetCategoryListHead();
+	Next = Head;
+	Head = this;
+}
+
+FLogCategory* FLogCategory::Find(const char* InName)
+{
+	if (!InName)
+	{
+		return nullptr;
+	}
+
+	for (FLogCategory* Category = GetCategoryListHead(); Category; Category = Category->Next)
+	{
+		if (_stricmp(Category->Name, InName) == 0
+			|| (_strnicmp(Category->Name, "Log", 3) == 0 && _stricmp(Category->Name + 3, InName) == 0))
+		{
+			return Category;
+		}
+	}
+	return nullptr;
+}
+
+const char* GetLogVerbosityName(ELogVerbosity Verbosity)
+{
+	switch (Verbosity)
+	{
+	case ELogVerbosity::Verbose: return "Verbose";
+	case ELogVerbosity::Log: return "Log";
+	case ELogVerbosity::Display: return "Display";
+	case ELogVerbosity::Warning: return "Warning";
+	case ELogVerbosity::Error: return "Error";
+	}
+	return "Unknown";
+}
+
+bool ParseLogVerbosity(const char* Name, ELogVerbosity& OutVerbosity)
+{
+	const ELogVerbosity AllVerbosities[] = { ELogVerbosity::Verbose, ELogVerbosity::Log, ELogVerbosity::Display, ELogVerbosity::Warning, ELogVerbosity::Error };
+	for (ELogVerbosity Verbosity : AllVerbosities)
+	{
+		if (Name && _stricmp(Name, GetLogVerbosityName(Verbosity)) == 0)
+		{
+			OutVerbosity = Verbosity;
+			return true;
+		}
+	}
+	return false;
+}
+
+// ──────────────────────────────────────────────
+// FLogQueue
+// ──────────────────────────────────────────────
+
+FLogQueue::FLogQueue(uint32 InCapacity)
+{
+	uint32 Capacity = 2;
+	while (Capacity < InCapacity)
+	{
+		Capacity <<= 1;
+	}
+
+	Mask = Capacity - 1;
+	Slots = new FLogSlot[Capacity];
+	for (uint32 Index = 0; Index < Capacity; ++Index)
+	{
+		Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+	}
+}
+
+FLogQueue::~FLogQueue()
+{
+	delete[] Slots;
+}
+
+bool FLogQueue::Push(const FLogCategory* Category, ELogVerbosity Verbosity, const char* Format, va_list Args)
+{
+	uint64 Pos = EnqueuePos.load(std::memory_order_relaxed);
+	FLogSlot* Slot = nullptr;
+	while (true)
+	{
+		Slot = &Slots[Pos & Mask];
+		const uint64 Sequence = Slot->Sequence.load(std::memory_order_acquire);
+		const int64 Diff = static_cast<int64>(Sequence) - static_cast<int64>(Pos);
+		if (Diff == 0)
+		{
+			if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (Diff < 0)
+		{
+			// 컨슈머가 한 바퀴 뒤처짐 → 게임 스레드를 막지 않고 버림
+			NumDropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		else
+		{
+			Pos = EnqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	Slot->Cycles = FPlatformTime::Cycles64();
+	Slot->Category = Category;
+	Slot->ThreadId = GetLogThreadId();
+	Slot->Verbosity = Verbosity;
+	Slot->Flags = 0;
+
+	FPayloadWriter Writer(Slot->Payload, sizeof(Slot->Payload));
+	if (IsReadOnlyImageString(Format))
+	{
+		Slot->Format = Format;
+	}
+	else
+	{
+		Slot->Format = nullptr;
+		Slot->Flags |= LogSlot_CopiedFormat;
+		Writer.WriteString(Format, strlen(Format));
+	}
+
+	va_list PackArgs;
+	va_copy(PackArgs, Args);
+	const bool bPacked = PackArguments(Format, PackArgs, Writer);
+	va_end(PackArgs);
+
+	if (bPacked)
+	{
+		Slot->PayloadSize = static_cast<uint16>(Writer.Size);
+	}
+	else
+	{
+		// 슬롯에 안 들어가는 긴 인자나 해석할 수 없는 형식 → 여기서 포맷 (슬롯 크기로 잘림)
+		Slot->Format = nullptr;
+		Slot->Flags = LogSlot_Preformatted;
+		char* Text = reinterpret_cast<char*>(Slot->Payload);
+		const int Written = vsnprintf(Text, sizeof(Slot->Payload), Format, Args);
+		Slot->PayloadSize = static_cast<uint16>(std::clamp<int>(Written, 0, sizeof(Slot->Payload) - 1));
+		Text[Slot->PayloadSize] = '\0';
+	}
+
+	Slot->Sequence.store(Pos + 1, std::memory_order_release);
+	return true;
+}
+
+uint32 FLogQueue::Drain(FLogSink& Sink, uint32 MaxRecords)
+{
+	char Buffer[MaxMessageLength];
+	uint32 NumRecords = 0;
+
+	while (NumRecords < MaxRecords)
+	{
+		FLogSlot& Slot = Slots[DequeuePos & Mask];
+		if (Slot.Sequence.load(std::memory_order_acquire) != DequeuePos + 1)
+		{
+			break;
+		}
+
+		FLogRecord Record;
+		Record.Cycles = Slot.Cycles;
+		Record.ThreadId = Slot.ThreadId;
+		Record.Category = Slot.Category;
+		Record.Verbosity = Slot.Verbosity;
+
+		if (Slot.Flags & LogSlot_Preformatted)
+		{
+			Record.Message = reinterpret_cast<const char*>(Slot.Payload);
+			Record.Length = Slot.PayloadSize;
+		}
+		else
+		{
+			FPayloadReader Reader{ Slot.Payload, Slot.PayloadSize };
+			const char* Format = (Slot.Flags & LogSlot_CopiedFormat) ? Reader.ReadString<char>() : Slot.Format;
+			Record.Length = FormatPayload(Format ? Format : "", Reader, Buffer, MaxMessageLength);
+			Record.Message = Buffer;
+		}
+
+		Sink.Write(Record);
+
+		// 슬롯 반납 (다음 바퀴의 생산자가 사용할 수 있도록)
+		Slot.Sequence.store(DequeuePos + Mask + 1, std::memory_order_release);
+		++DequeuePos;
+		++NumRecords;
+	}
+
+	if (NumRecords > 0)
+	{
+		Sink.Flush();
+	}
+	return NumRecords;
+}
+
+bool FLogQueue::IsEmpty() const
+{
+	return Slots[DequeuePos & Mask].Sequence.load(std::memory_order_acquire) != DequeuePos + 1;
+}
+
+// ──────────────────────────────────────────────
+// FLogSystem
+// ──────────────────────────────────────────────
+
+namespace
+{
+	/** 파일 싱크: "[  12.345][Thread][Category][Verbosity] Message" */
+	class FFileLogSink : public FLogSink
+	{
+	public:
+		FFileLogSink(const FString& FilePath, uint64 InStartCycles)
+			: Stream(FilePath, std::ios::out | std::ios::trunc), StartCycles(InStartCycles)
+		{
+		}
+
+		bool IsOpen() const { return Stream.is_open(); }
+
+		void Write(const FLogRecord& Record) override
+		{
+			const double Seconds = Record.Cycles > StartCycles ? FPlatformTime::ToMilliseconds(Record.Cycles - StartCycles) / 1000.0 : 0.0;
+
+			char Header[128];
+			const int HeaderLength = snprintf(Header, sizeof(Header), "[%9.3f][%5u][%s][%s] ",
+				Seconds, Record.ThreadId, Record.Category ? Record.Category->Name : "LogTemp", GetLogVerbosityName(Record.Verbosity));
+			Stream.write(Header, std::clamp<int>(HeaderLength, 0, sizeof(Header) - 1));
+
+			// 호출자가 붙인 끝 개행은 한 줄로 정리
+			int32 Length = Record.Length;
+			while (Length > 0 && (Record.Message[Length - 1] == '\n' || Record.Message[Length - 1] == '\r'))
+			{
+				--Length;
+			}
+			Stream.write(Record.Message, Length);
+			Stream.put('\n');
+		}
+
+		void Flush() override
+		{
+			Stream.flush();
+		}
+
+	private:
+		std::ofstream Stream;
+		uint64 StartCycles;
+	};
+
+	/** 디버거가 붙어 있을 때만 OutputDebugString으로 전달 */
+	class FDebugOutputLogSink : public FLogSink
+	{
+	public:
+		void Write(const FLogRecord& Record) override
+		{
+			if (!::IsDebuggerPresent())
+			{
+				return;
+			}
+			::OutputDebugStringA(Record.Message);
+			if (Record.Length == 0 || Record.Message[Record.Length - 1] != '\n')
+			{
+				::OutputDebugStringA("\n");
+			}
+		}
+	};
+
+	/**
+	 * 호출 지점별 1초 창 빈도 제한. 키는 카테고리 + 포맷 문자열 내용의 해시
+	 * (주소로 묶으면 링커가 합친 같은 리터럴은 한 버킷이 되고, 힙에 만든 포맷은 호출마다 새 버킷을 차지함)
+	 */
+	struct FRateLimitSite
+	{
+		std::atomic<uint64> Key{ 0 };     // 0 = 빈 칸
+		std::atomic<uint64> WindowStart{ 0 };
+		std::atomic<uint32> Count{ 0 };
+		std::atomic<uint32> Suppressed{ 0 };
+	};
+
+	constexpr uint32 NumRateLimitSites = 512;   // 2의 거듭제곱
+	constexpr uint32 MaxRateLimitProbes = 8;
+	constexpr uint32 LogQueueCapacity = 1u << 13;
+	constexpr uint32 MaxRecordsPerDrain = 4096;
+
+	/** 레코드를 등록된 싱크들로 나눠 주는 싱크 (ConsumerMutex 안에서만 사용) */
+	class FLogDispatchSink : public FLogSink
+	{
+	public:
+		void Write(const FLogRecord& Record) override
+		{
+			for (FLogSink* Sink : Sinks)
+			{
+				Sink->Write(Record);
+			}
+			++NumWritten;
+		}
+
+		void Flush() override
+		{
+			for (FLogSink* Sink : Sinks)
+			{
+				Sink->Flush();
+			}
+		}
+
+		TArray<FLogSink*> Sinks;
+		uint64 NumWritten = 0;
+	};
+
+	struct FLogSystemState
+	{
+		FLogQueue Queue{ LogQueueCapacity };
+		uint64 StartCycles = FPlatformTime::Cycles64();
+
+		// Drain과 싱크 목록 변경을 직렬화 (평소에는 컨슈머만 잡으므로 경쟁 없음)
+		std::mutex ConsumerMutex;
+		FLogDispatchSink Dispatcher;
+		FFileLogSink* FileSink = nullptr;
+		FDebugOutputLogSink DebugSink;
+		uint64 NumReportedDropped = 0;
+
+		std::thread ConsumerThread;
+		std::mutex WakeMutex;
+		std::condition_variable WakeCondition;
+		std::atomic<bool> bConsumerWaiting{ false };
+		std::atomic<bool> bStopping{ false };
+		bool bInitialized = false;
+
+		std::atomic<uint32> RateLimit{ 300 };
+		std::atomic<uint64> NumSuppressed{ 0 };
+		FRateLimitSite RateLimitSites[NumRateLimitSites];
+	};
+
+	// 종료 중(정적 소멸 이후)에 남기는 로그도 안전하도록 해제하지 않음
+	FLogSystemState& GetLogState()
+	{
+		static FLogSystemState* State = new FLogSystemState();
+		return *State;
+	}
+
+	/** ConsumerMutex를 잡은 상태에서 호출 */
+	uint32 DrainLocked(FLogSystemState& State)
+	{
+		const uint32 NumRecords = State.Queue.Drain(State.Dispatcher, MaxRecordsPerDrain);
+
+		const uint64 NumDropped = State.Queue.GetNumDropped();
+		if (NumDropped != State.NumReportedDropped)
+		{
+			char Message[96];
+			FLogRecord Record;
+			Record.Cycles = FPlatformTime::Cycles64();
+			Record.ThreadId = GetLogThreadId();
+			Record.Category = &LogTemp;
+			Record.Verbosity = ELogVerbosity::Warning;
+			Record.Message = Message;
+			Record.Length = snprintf(Message, sizeof(Message), "[Log] %llu messages dropped (log queue full)",
+				static_cast<unsigned long long>(NumDropped - State.NumReportedDropped));
+			State.NumReportedDropped = NumDropped;
+			State.Dispatcher.Write(Record);
+			State.Dispatcher.Flush();
+		}
+		return NumRecords;
+	}
+
+	void ConsumerLoop(FLogSystemState& State)
+	{
+		FProfiler::SetThreadName("LogConsumer");
+
+		while (true)
+		{
+			uint32 NumRecords = 0;
+			{
+				std::lock_guard<std::mutex> Lock(State.ConsumerMutex);
+				NumRecords = DrainLocked(State);
+			}
+			if (NumRecords > 0)
+			{
+				continue;
+			}
+			if (State.bStopping.load())
+			{
+				break;
+			}
+
+			// 생산자는 대기 중일 때만 깨움. 알림을 놓치더라도 제한 시간 뒤에 다시 확인
+			std::unique_lock<std::mutex> Lock(State.WakeMutex);
+			State.bConsumerWaiting.store(true);
+			State.WakeCondition.wait_for(Lock, std::chrono::milliseconds(20));
+			State.bConsumerWaiting.store(false);
+		}
+	}
+
+	/** 카테고리 + 포맷 문자열 내용의 FNV-1a 해시 (0은 빈 칸 표시로 쓰므로 피함) */
+	uint64 GetRateLimitKey(const FLogCategory& Category, const char* Format)
+	{
+		uint64 Hash = 0xCBF29CE484222325ull ^ (static_cast<uint64>(reinterpret_cast<uintptr_t>(&Category)) * 0x9E3779B97F4A7C15ull);
+		for (const char* Character = Format; *Character; ++Character)
+		{
+			Hash = (Hash ^ static_cast<uint8>(*Character)) * 0x100000001B3ull;
+		}
+		return Hash ? Hash : 1;
+	}
+
+	/** @return false면 이번 로그는 버림. OutSuppressed는 직전 창에서 버린 수 (창이 바뀐 호출에서만) */
+	bool PassRateLimit(FLogSystemState& State, const FLogCategory& Category, const char* Format, uint32& OutSuppressed)
+	{
+		const uint32 Limit = State.RateLimit.load(std::memory_order_relaxed);
+		if (Limit == 0)
+		{
+			return true;
+		}
+
+		const uint64 Key = GetRateLimitKey(Category, Format);
+		const uint64 Hash = Key * 0x9E3779B97F4A7C15ull >> 32;
+		FRateLimitSite* Site = nullptr;
+		for (uint32 Probe = 0; Probe < MaxRateLimitProbes && !Site; ++Probe)
+		{
+			FRateLimitSite& Candidate = State.RateLimitSites[(Hash + Probe) & (NumRateLimitSites - 1)];
+			uint64 Current = Candidate.Key.load(std::memory_order_relaxed);
+			if (Current == 0 && Candidate.Key.compare_exchange_strong(Current, Key, std::memory_order_relaxed))
+			{
+				Current = Key;
+			}
+			if (Current == Key)
+			{
+				Site = &Candidate;
+			}
+		}
+		if (!Site)
+		{
+			return true;   // 테이블이 가득 찬 호출 지점은 제한하지 않음
+		}
+
+		const uint64 Now = FPlatformTime::Cycles64();
+		uint64 WindowStart = Site->WindowStart.load(std::memory_order_relaxed);
+		if (FPlatformTime::ToMilliseconds(Now - WindowStart) >= 1000.0
+			&& Site->WindowStart.compare_exchange_strong(WindowStart, Now, std::memory_order_relaxed))
+		{
+			Site->Count.store(0, std::memory_order_relaxed);
+			OutSuppressed = Site->Suppressed.exchange(0, std::memory_order_relaxed);
+		}
+
+		if (Site->Count.fetch_add(1, std::memory_order_relaxed) < Limit)
+		{
+			return true;
+		}
+
+		Site->Suppressed.fetch_add(1, std::memory_order_relaxed);
+		State.NumSuppressed.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	void PushRecord(FLogSystemState& State, const FLogCategory& Category, ELogVerbosity Verbosity, const char* Format, va_list Args)
+	{
+		State.Queue.Push(&Category, Verbosity, Format, Args);
+
+		if (State.bConsumerWaiting.load(std::memory_order_relaxed) && State.bConsumerWaiting.exchange(false))
+		{
+			State.WakeCondition.notify_one();
+		}
+	}
+
+	void PushRecord(FLogSystemState& State, const FLogCategory& Category, ELogVerbosity Verbosity, const char* Format, ...)
+	{
+		va_list Args;
+		va_start(Args, Format);
+		PushRecord(State, Category, Verbosity, Format, Args);
+		va_end(Args);
+	}
+}
+
+void FLogSystem::Initialize(const FString& LogFilePath)
+{
+	FLogSystemState& State = GetLogState();
+	if (State.bInitialized)
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(State.ConsumerMutex);
+		State.FileSink = new FFileLogSink(LogFilePath, State.StartCycles);
+		if (State.FileSink->IsOpen())
+		{
+			State.Dispatcher.Sinks.Add(State.FileSink);
+		}
+		State.Dispatcher.Sinks.Add(&State.DebugSink);
+	}
+
+	State.bStopping.store(false);
+	State.ConsumerThread = std::thread(ConsumerLoop, std::ref(State));
+	State.bInitialized = true;
+}
+
+void FLogSystem::Shutdown()
+{
+	FLogSystemState& State = GetLogState();
+	if (!State.bInitialized)
+	{
+		return;
+	}
+
+	State.bStopping.store(true);
+	State.WakeCondition.notify_one();
+	if (State.ConsumerThread.joinable())
+	{
+		State.ConsumerThread.join();
+	}
+
+	std::lock_guard<std::mutex> Lock(State.ConsumerMutex);
+	while (DrainLocked(State) > 0)
+	{
+	}
+
+	State.Dispatcher.Sinks.Empty();
+	delete State.FileSink;
+	State.FileSink = nullptr;
+	State.bInitialized = false;
+}
+
+void FLogSystem::Log(const FLogCategory& Category, ELogVerbosity Verbosity, const char* Format, ...)
+{
+	va_list Args;
+	va_start(Args, Format);
+	LogV(Category, Verbosity, Format, Args);
+	va_end(Args);
+}
+
+void FLogSystem::LogV(const FLogCategory& Category, ELogVerbosity Verbosity, const char* Format, va_list Args)
+{
+	if (!Format)
+	{
+		return;
+	}
+
+	FLogSystemState& State = GetLogState();
+	uint32 NumSuppressed = 0;
+	const bool bPass = PassRateLimit(State, Category, Format, NumSuppressed);
+	if (NumSuppressed > 0)
+	{
+		PushRecord(State, Category, ELogVerbosity::Warning, "[Log] %u messages suppressed by rate limit: %.80s", NumSuppressed, Format);
+	}
+	if (bPass)
+	{
+		PushRecord(State, Category, Verbosity, Format, Args);
+	}
+}
+
+void FLogSystem::AddSink(FLogSink* Sink)
+{
+	FLogSystemState& State = GetLogState();
+	std::lock_guard<std::mutex> Lock(State.ConsumerMutex);
+	if (Sink && !State.Dispatcher.Sinks.Contains(Sink))
+	{
+		State.Dispatcher.Sinks.Add(Sink);
+	}
+}
+
+void FLogSystem::RemoveSink(FLogSink* Sink)
+{
+	FLogSystemState& State = GetLogState();
+	std::lock_guard<std::mutex> Lock(State.ConsumerMutex);
+	State.Dispatcher.Sinks.Remove(Sink);
+}
+
+void FLogSystem::Flush()
+{
+	FLogSystemState& State = GetLogState();
+	std::lock_guard<std::mutex> Lock(State.ConsumerMutex);
+	while (DrainLocked(State) > 0)
+	{
+	}
+}
+
+void FLogSystem::SetRateLimit(uint32 MaxPerSecondPerSite)
+{
+	GetLogState().RateLimit.store(MaxPerSecondPerSite, std::memory_order_relaxed);
+}
+
+uint32 FLogSystem::GetRateLimit()
+{
+	return GetLogState().RateLimit.load(std::memory_order_relaxed);
+}
+
+FLogStats FLogSystem::GetStats()
+{
+	FLogSystemState& State = GetLogState();
+	FLogStats Stats;
+	{
+		std::lock_guard<std::mutex> Lock(State.ConsumerMutex);
+		Stats.NumWritten = State.Dispatcher.NumWritten;
+	}
+	Stats.NumDropped = State.Queue.GetNumDropped();
+	Stats.NumSuppressed = State.NumSuppressed.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+ELogVerbosity FLogSystem::ClassifyLegacyTag(const char* Message)
+{
+	// 앞쪽 대괄호 태그 두 개까지만 확인 ("[error] ...", "[Lua][warning] ...")
+	const char* P = Message;
+	for (int32 TagIndex = 0; P && *P == '[' && TagIndex < 2; ++TagIndex)
+	{
+		if (_strnicmp(P, "[error]", 7) == 0)
+		{
+			return ELogVerbosity::Error;
+		}
+		if (_strnicmp(P, "[warning]", 9) == 0)
+		{
+			return ELogVerbosity::Warning;
+		}
+		if (_strnicmp(P, "[info]", 6) == 0)
+		{
+			return ELogVerbosity::Display;
+		}
+
+		P = strchr(P, ']');
+		if (P)
+		{
+			++P;
+		}
+	}
+	return ELogVerbosity::Log;
+}
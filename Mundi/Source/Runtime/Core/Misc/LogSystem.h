@@ -0,0 +1,169 @@
+#pragma once
+#include <atomic>
+#include <cstdarg>
+#include "UEContainer.h"
+
+/**
+ * @brief 비동기 로그 백엔드
+ *
+ * - 호출 스레드는 포맷 문자열 포인터와 인자 값만 고정 크기 슬롯에 복사하고 바로 반환 (락 없음)
+ * - 백그라운드 컨슈머 스레드가 문자열을 완성해 등록된 싱크(파일, 디버그 출력, 콘솔)로 전달
+ * - 심각도/카테고리는 메시지 문자열이 아니라 레코드 필드로 전달됨
+ * - 같은 호출 지점(카테고리 + 포맷 문자열 내용)에서 초당 허용량을 넘는 로그는 버리고 개수만 알림
+ *
+ * 사용 예:
+ *   DEFINE_LOG_CATEGORY(LogLua)                              // .cpp 한 곳
+ *   UE_LOG_CATEGORY(LogLua, Warning, "script %s failed", Name);
+ */
+
+enum class ELogVerbosity : uint8
+{
+	Verbose,
+	Log,
+	Display,    // 기존 "[info]" 태그
+	Warning,
+	Error,
+};
+
+const char* GetLogVerbosityName(ELogVerbosity Verbosity);
+/** @return 이름이 맞으면 true (대소문자 무시) */
+bool ParseLogVerbosity(const char* Name, ELogVerbosity& OutVerbosity);
+
+/** 로그 카테고리. 카테고리별 최소 출력 수준은 런타임에 바꿀 수 있음 */
+struct FLogCategory
+{
+	// 카테고리는 전역 객체로만 정의하므로 정적 초기화 중에 목록에 등록됨
+	explicit FLogCategory(const char* InName, ELogVerbosity InMinVerbosity = ELogVerbosity::Log);
+
+	/** 이름으로 카테고리 검색 (대소문자 무시, "Log" 접두어 생략 가능) */
+	static FLogCategory* Find(const char* InName);
+
+	bool IsEnabled(ELogVerbosity Verbosity) const
+	{
+		return Verbosity >= MinVerbosity.load(std::memory_order_relaxed);
+	}
+
+	const char* Name;
+	std::atomic<ELogVerbosity> MinVerbosity;
+	FLogCategory* Next = nullptr;
+};
+
+#define DECLARE_LOG_CATEGORY(CategoryName) extern FLogCategory CategoryName;
+#define DEFINE_LOG_CATEGORY(CategoryName) FLogCategory CategoryName(#CategoryName);
+
+/** 카테고리 없이 남기는 UE_LOG의 기본 카테고리 */
+DECLARE_LOG_CATEGORY(LogTemp)
+
+/** 컨슈머가 완성한 로그 한 줄 */
+struct FLogRecord
+{
+	uint64 Cycles = 0;              // FPlatformTime::Cycles64() 기준 기록 시각
+	uint32 ThreadId = 0;
+	const FLogCategory* Category = nullptr;
+	ELogVerbosity Verbosity = ELogVerbosity::Log;
+	const char* Message = nullptr;  // NUL 종료 (끝 개행은 호출자가 넣은 그대로)
+	int32 Length = 0;
+};
+
+/** 로그 출력 대상. Write/Flush는 컨슈머 스레드(또는 FLogSystem::Flush 호출 스레드)에서만 호출됨 */
+class FLogSink
+{
+public:
+	virtual ~FLogSink() = default;
+
+	virtual void Write(const FLogRecord& Record) = 0;
+	/** 한 번에 꺼낸 레코드 묶음을 모두 쓴 뒤 호출 */
+	virtual void Flush() {}
+};
+
+struct FLogSlot;
+
+/**
+ * @brief 다중 생산자 / 단일 소비자 고정 크기 링 버퍼
+ *
+ * 슬롯마다 시퀀스 번호를 두는 방식(bounded MPMC queue)으로 생산자끼리만 CAS로 경쟁합니다.
+ * 인자는 포맷 문자열을 해석해 값으로 묶어 두고(문자열 인자는 내용 복사), 포맷은 컨슈머가 수행합니다.
+ * 포맷 문자열이 실행 파일의 읽기 전용 영역(문자열 리터럴)에 있으면 포인터만, 아니면 내용을 복사합니다.
+ * 큐가 가득 차면 기다리지 않고 버린 뒤 개수만 셉니다.
+ */
+class FLogQueue
+{
+public:
+	static constexpr uint32 SlotSize = 512;
+	static constexpr int32 MaxMessageLength = 2048;
+
+	/** @param InCapacity 슬롯 수 (2의 거듭제곱) */
+	explicit FLogQueue(uint32 InCapacity);
+	~FLogQueue();
+
+	FLogQueue(const FLogQueue&) = delete;
+	FLogQueue& operator=(const FLogQueue&) = delete;
+
+	/** @return 큐가 가득 차 버렸으면 false */
+	bool Push(const FLogCategory* Category, ELogVerbosity Verbosity, const char* Format, va_list Args);
+
+	/**
+	 * @brief 쌓인 레코드를 포맷해 Sink에 전달 (한 번에 한 스레드만 호출해야 함)
+	 * @return 처리한 레코드 수
+	 */
+	uint32 Drain(FLogSink& Sink, uint32 MaxRecords = UINT32_MAX);
+
+	/** 컨슈머(Drain 호출 스레드) 전용 */
+	bool IsEmpty() const;
+	uint64 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+private:
+	FLogSlot* Slots = nullptr;
+	uint32 Mask = 0;
+
+	alignas(64) std::atomic<uint64> EnqueuePos{ 0 };
+	alignas(64) uint64 DequeuePos = 0;
+	alignas(64) std::atomic<uint64> NumDropped{ 0 };
+};
+
+struct FLogStats
+{
+	uint64 NumWritten = 0;      // 싱크까지 전달된 수
+	uint64 NumDropped = 0;      // 큐가 가득 차 버린 수
+	uint64 NumSuppressed = 0;   // 호출 지점별 빈도 제한으로 버린 수
+};
+
+class FLogSystem
+{
+public:
+	/** 컨슈머 스레드 시작과 파일 싱크 생성. 그 전에 남긴 로그는 큐에 보관됨 */
+	static void Initialize(const FString& LogFilePath = "Mundi.log");
+	/** 남은 로그를 모두 내보내고 컨슈머 종료 */
+	static void Shutdown();
+
+	static void Log(const FLogCategory& Category, ELogVerbosity Verbosity, const char* Format, ...);
+	static void LogV(const FLogCategory& Category, ELogVerbosity Verbosity, const char* Format, va_list Args);
+
+	/** 싱크 등록/해제 (소유권은 호출자에게 있음, 해제 후에는 더 이상 호출되지 않음) */
+	static void AddSink(FLogSink* Sink);
+	static void RemoveSink(FLogSink* Sink);
+
+	/** 지금까지 남긴 로그를 호출 스레드에서 즉시 싱크까지 전달 (결과를 바로 확인해야 하는 테스트/벤치마크용) */
+	static void Flush();
+
+	/** 호출 지점(카테고리 + 포맷 문자열 내용)별 초당 최대 로그 수. 0이면 제한 없음 */
+	static void SetRateLimit(uint32 MaxPerSecondPerSite);
+	static uint32 GetRateLimit();
+
+	static FLogStats GetStats();
+
+	/** 기존 문자열 태그("[error]", "[Lua][warning]" 등 앞쪽 대괄호 태그)로 표시된 메시지의 심각도 */
+	static ELogVerbosity ClassifyLegacyTag(const char* Message);
+};
+
+#define UE_LOG_CATEGORY(CategoryName, Verbosity, fmt, ...) \
+	do \
+	{ \
+		if (CategoryName.IsEnabled(ELogVerbosity::Verbosity)) \
+		{ \
+			FLogSystem::Log(CategoryName, ELogVerbosity::Verbosity, fmt, ##__VA_ARGS__); \
+		} \
+	} while (0)
+
+#define UE_LOG_WARNING(fmt, ...) UE_LOG_CATEGORY(LogTemp, Warning, fmt, ##__VA_ARGS__)
+#define UE_LOG_ERROR(fmt, ...) UE_LOG_CATEGORY(LogTemp, Error, fmt, ##__VA_ARGS__)
@@ -0,0 +1,146 @@
+#include "pch.h"
+#include "MappedFileReader.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+FMappedFileReader::FMappedFileReader(const FString& Filename)
+{
+    const FWideString WideFilename = UTF8ToWide(Filename);
+    HANDLE File = ::CreateFileW(WideFilename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+    FileHandle = File;
+
+    LARGE_INTEGER FileSize{};
+    if (!::GetFileSizeEx(File, &FileSize))
+    {
+        Close();
+        return;
+    }
+
+    // 빈 파일은 매핑할 수 없으므로 크기 0의 열린 아카이브로 취급
+    if (FileSize.QuadPart == 0)
+    {
+        bOpen = true;
+        return;
+    }
+
+    HANDLE Mapping = ::CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!Mapping)
+    {
+        Close();
+        return;
+    }
+    MappingHandle = Mapping;
+
+    const void* View = ::MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!View)
+    {
+        Close();
+        return;
+    }
+
+    Data = static_cast<const uint8*>(View);
+    Size = static_cast<int64>(FileSize.QuadPart);
+    bOpen = true;
+}
+
+bool FMappedFileReader::Close()
+{
+    const bool bWasOpen = bOpen;
+
+    if (Data)
+    {
+        ::UnmapViewOfFile(Data);
+    }
+    if (MappingHandle)
+    {
+        ::CloseHandle(static_cast<HANDLE>(MappingHandle));
+    }
+    if (FileHandle)
+    {
+        ::CloseHandle(static_cast<HANDLE>(FileHandle));
+    }
+
+    MappingHandle = nullptr;
+    FileHandle = nullptr;
+    Data = nullptr;
+    Size = 0;
+    Offset = 0;
+    bOpen = false;
+    return bWasOpen;
+}
+
+#else // POSIX
+
+FMappedFileReader::FMappedFileReader(const FString& Filename)
+{
+    FileDescriptor = ::open(Filename.c_str(), O_RDONLY);
+    if (FileDescriptor < 0)
+    {
+        return;
+    }
+
+    struct stat FileStat {};
+    if (::fstat(FileDescriptor, &FileStat) != 0)
+    {
+        Close();
+        return;
+    }
+
+    if (FileStat.st_size == 0)
+    {
+        bOpen = true;
+        return;
+    }
+
+    void* View = ::mmap(nullptr, static_cast<size_t>(FileStat.st_size), PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+    if (View == MAP_FAILED)
+    {
+        Close();
+        return;
+    }
+    ::madvise(View, static_cast<size_t>(FileStat.st_size), MADV_SEQUENTIAL);
+
+    Data = static_cast<const uint8*>(View);
+    Size = static_cast<int64>(FileStat.st_size);
+    bOpen = true;
+}
+
+bool FMappedFileReader::Close()
+{
+    const bool bWasOpen = bOpen;
+
+    if (Data)
+    {
+        ::munmap(const_cast<uint8*>(Data), static_cast<size_t>(Size));
+    }
+    if (FileDescriptor >= 0)
+    {
+        ::close(FileDescriptor);
+    }
+
+    FileDescriptor = -1;
+    Data = nullptr;
+    Size = 0;
+    Offset = 0;
+    bOpen = false;
+    return bWasOpen;
+}
+
+#endif
+
+FMappedFileReader::~FMappedFileReader()
+{
+    Close();
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "MemoryArchive.h"
+
+/**
+ * @brief 파일을 읽기 전용으로 메모리 매핑하여 읽는 아카이브
+ *
+ * 스트림 버퍼를 거치지 않고 매핑된 페이지에서 바로 읽으며,
+ * MapView / Serialization::ReadArrayView로 대용량 배열을 복사 없이 참조할 수 있습니다.
+ * 반환된 뷰는 Close() 또는 소멸 전까지만 유효합니다.
+ *
+ * 백엔드: Windows(CreateFileMapping/MapViewOfFile), POSIX(mmap)
+ */
+class FMappedFileReader : public FMemoryReader
+{
+public:
+    FMappedFileReader(const FString& Filename);
+    ~FMappedFileReader() override;
+
+    FMappedFileReader(const FMappedFileReader&) = delete;
+    FMappedFileReader& operator=(const FMappedFileReader&) = delete;
+
+    bool IsOpen() const { return bOpen; }
+    bool Close() override;
+
+private:
+    bool bOpen = false;
+
+#ifdef _WIN32
+    void* FileHandle = nullptr;
+    void* MappingHandle = nullptr;
+#else
+    int FileDescriptor = -1;
+#endif
+};
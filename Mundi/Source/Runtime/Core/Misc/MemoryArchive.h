@@ -0,0 +1,95 @@
+#pragma once
+#include "Archive.h"
+#include "UEContainer.h"
+#include <cstring>
+#include <stdexcept>
+
+/**
+ * @brief TArray<uint8> 버퍼에 기록하는 아카이브 (파일에 쓰기 전 체크섬 계산 등에 사용)
+ */
+class FMemoryWriter : public FArchive
+{
+public:
+    FMemoryWriter(TArray<uint8>& InBuffer)
+        : FArchive(false, true) // Saving 모드
+        , Buffer(InBuffer)
+    {
+    }
+
+    void Serialize(void* Data, int64 Length) override
+    {
+        if (Length <= 0)
+        {
+            return;
+        }
+
+        const uint64 End = Offset + static_cast<uint64>(Length);
+        if (End > Buffer.size())
+        {
+            Buffer.resize(static_cast<size_t>(End));
+        }
+        memcpy(Buffer.data() + Offset, Data, static_cast<size_t>(Length));
+        Offset = End;
+    }
+    void Seek(int64 Position) override { Offset = static_cast<uint64>(Position); }
+    int64 Tell() override { return static_cast<int64>(Offset); }
+    bool Close() override { return true; }
+
+private:
+    TArray<uint8>& Buffer;
+    uint64 Offset = 0;
+};
+
+/**
+ * @brief 메모리 블록을 읽는 아카이브. 범위를 벗어난 읽기는 손상된 데이터로 간주하여 예외를 던짐
+ */
+class FMemoryReader : public FArchive
+{
+public:
+    FMemoryReader(const uint8* InData, int64 InSize)
+        : FArchive(true, false) // Loading 모드
+        , Data(InData)
+        , Size(InSize)
+    {
+    }
+    FMemoryReader(const TArray<uint8>& InBuffer)
+        : FMemoryReader(InBuffer.data(), static_cast<int64>(InBuffer.size()))
+    {
+    }
+
+    void Serialize(void* OutData, int64 Length) override
+    {
+        memcpy(OutData, MapView(Length), static_cast<size_t>(Length));
+    }
+    void Seek(int64 Position) override
+    {
+        if (Position < 0 || Position > Size)
+        {
+            throw std::runtime_error("Archive corrupt: seek out of range.");
+        }
+        Offset = Position;
+    }
+    int64 Tell() override { return Offset; }
+    bool Close() override { return true; }
+
+    const uint8* MapView(int64 Length) override
+    {
+        if (Length < 0 || Length > Size - Offset)
+        {
+            throw std::runtime_error("Archive corrupt: read past end of data.");
+        }
+        const uint8* View = Data + Offset;
+        Offset += Length;
+        return View;
+    }
+
+    const uint8* GetData() const { return Data; }
+    int64 TotalSize() const { return Size; }
+
+protected:
+    FMemoryReader() : FArchive(true, false) {}
+
+    const uint8* Data = nullptr;
+    int64 Size = 0;
+    int64 Offset = 0;
+};
@@ -1,7 +1,7 @@
 ﻿#pragma once
 // Name.h
-#pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
@@ -11,15 +11,49 @@
 // ──────────────────────────────
 struct FNameEntry
 {
-    FString Display;    // 원문
-    FString Comparison; // lower-case
+    FString Display;              // 원문 (대소문자 유지)
+    uint32 ComparisonIndex = 0;   // 대소문자만 다른 이름들이 공유하는 대표 엔트리 인덱스
+    uint32 Hash = 0;              // 대소문자 무시 해시 (대소문자만 다른 이름끼리 같음)
 };
 
+/**
+ * @brief 이름 테이블
+ *
+ * - 엔트리는 고정 크기 블록에 저장되어 추가 중에도 주소가 바뀌지 않음 (Get은 락 없음)
+ * - 대소문자 무시 해시 하나로 샤드를 고르고, 샤드마다 원문 테이블 / 비교 테이블(오픈 어드레싱)을 둠
+ * - 조회는 락 없이 해시 슬롯을 읽고, 추가만 해당 샤드 뮤텍스를 잡음
+ * - "Foo"와 "foo"는 서로 다른 원문(Display) 엔트리지만 같은 ComparisonIndex를 가짐
+ */
 class FNamePool
 {
 public:
-    static uint32 Add(const FString& InStr);
+    static constexpr uint32 NumShards = 16;
+    static constexpr uint32 EntriesPerBlockBits = 12;  // 블록당 4096개
+    static constexpr uint32 EntriesPerBlock = 1u << EntriesPerBlockBits;
+    static constexpr uint32 MaxBlocks = 1024;          // 최대 약 400만 개 이름
+
+    /**
+     * @brief 원문 엔트리 인덱스 반환 (없으면 추가)
+     */
+    static uint32 Add(std::string_view InStr);
+    static uint32 Add(const FString& InStr) { return Add(std::string_view(InStr)); }
+
+    /**
+     * @brief 추가하지 않고 원문 엔트리를 찾음 (없으면 UINT32_MAX)
+     */
+    static uint32 Find(std::string_view InStr);
+
+    /**
+     * @brief 대소문자 무시로 대표 엔트리를 찾음 (없으면 UINT32_MAX)
+     */
+    static uint32 FindComparison(std::string_view InStr);
+
     static const FNameEntry& Get(uint32 Index);
+    static uint32 Num();
+
+    // 할당 없는 ASCII 대소문자 무시 비교
+    static bool EqualsIgnoreCase(std::string_view A, std::string_view B);
+    static uint32 ComputeHash(std::string_view InStr);
 };
 
 // ──────────────────────────────
@@ -31,18 +65,48 @@ struct FName
     uint32 ComparisonIndex = -1;
 
     FName() = default;
-    FName(const char* InStr) { Init(FString(InStr)); }
-    FName(const FString& InStr) { Init(InStr); }
+    FName(const char* InStr) { Init(std::string_view(InStr ? InStr : "")); }
+    FName(const FString& InStr) { Init(std::string_view(InStr)); }
+    explicit FName(std::string_view InStr) { Init(InStr); }
+
+    void Init(std::string_view InStr)
+    {
+        DisplayIndex = FNamePool::Add(InStr);
+        ComparisonIndex = FNamePool::Get(DisplayIndex).ComparisonIndex;
+    }
 
-    void Init(const FString& InStr)
+    /**
+     * @brief 테이블에 추가하지 않고 찾음 (조회 전용 경로용, 없으면 None)
+     */
+    static FName Find(std::string_view InStr)
     {
-        int32_t Index = FNamePool::Add(InStr);
-        DisplayIndex = Index;
-        ComparisonIndex = Index; // 필요시 다른 규칙 적용 가능
+        FName Result;
+        const uint32 Index = FNamePool::Find(InStr);
+        if (Index != UINT32_MAX)
+        {
+            Result.DisplayIndex = Index;
+            Result.ComparisonIndex = FNamePool::Get(Index).ComparisonIndex;
+        }
+        else
+        {
+            // 원문은 없어도 대소문자만 다른 이름이 있으면 비교는 가능
+            const uint32 Comparison = FNamePool::FindComparison(InStr);
+            Result.DisplayIndex = Comparison;
+            Result.ComparisonIndex = Comparison;
+        }
+        return Result;
     }
 
+    bool IsNone() const { return ComparisonIndex == UINT32_MAX; }
+
     bool operator==(const FName& Other) const { return ComparisonIndex == Other.ComparisonIndex; }
+    bool operator!=(const FName& Other) const { return ComparisonIndex != Other.ComparisonIndex; }
+
+    // 원문까지 같은지 (대소문자 구분)
+    bool IsEqualCaseSensitive(const FName& Other) const { return DisplayIndex == Other.DisplayIndex; }
+
     FString ToString() const { return FNamePool::Get(DisplayIndex).Display; }
+    const FString& GetDisplayString() const { return FNamePool::Get(DisplayIndex).Display; }
 
     friend FName operator+(const FName& A, const FName& B)
     {
@@ -60,6 +124,10 @@ struct FName
     }
 };
 
+// 문자열 리터럴 FName을 호출 지점마다 한 번만 해석 (프레임마다 도는 경로용)
+//   Macro.Name = FNAME_LITERAL("GPU_SKINNING");
+#define FNAME_LITERAL(Str) ([]() -> const FName& { static const FName LiteralName(Str); return LiteralName; }())
+
 // --- FName을 위한 std::hash 특수화 ---
 namespace std
 {
@@ -72,4 +140,4 @@ namespace std
             return hash<uint32>{}(Name.ComparisonIndex);
         }
     };
-}
\ No newline at end of file
+}
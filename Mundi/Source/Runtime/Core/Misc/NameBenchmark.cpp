@@ -0,0 +1,156 @@
+#include "pch.h"
+#include "NameBenchmark.h"
+#include "PlatformTime.h"
+#include "BenchmarkRegistry.h"
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	// 이전 FNamePool과 같은 방식 (스레드 안전을 위해 전역 뮤텍스만 추가)
+	struct FLegacyNamePool
+	{
+		std::mutex Mutex;
+		TMap<FString, uint32> NameMap;
+		TArray<FString> Entries;
+
+		uint32 Add(const FString& InStr)
+		{
+			FString Lower = InStr;
+			std::transform(Lower.begin(), Lower.end(), Lower.begin(),
+				[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+			std::lock_guard<std::mutex> Lock(Mutex);
+			auto It = NameMap.find(Lower);
+			if (It != NameMap.end())
+			{
+				return It->second;
+			}
+			const uint32 NewIndex = static_cast<uint32>(Entries.size());
+			Entries.push_back(InStr);
+			NameMap[Lower] = NewIndex;
+			return NewIndex;
+		}
+	};
+
+	struct FLegacyPolicy
+	{
+		FLegacyNamePool& Pool;
+		uint32 Make(const FString& InStr) const { return Pool.Add(InStr); }
+	};
+
+	struct FNamePoolPolicy
+	{
+		uint32 Make(const FString& InStr) const { return FName(InStr).ComparisonIndex; }
+	};
+
+	// 실제 본 이름과 비슷한 길이의 이름 (mixamorig:LeftHandIndex3 등)
+	FString MakeBoneName(uint32 Index, const char* Prefix)
+	{
+		char Buffer[64];
+		snprintf(Buffer, sizeof(Buffer), "%s:Mixamorig_Bone_%05u", Prefix, Index);
+		return Buffer;
+	}
+
+	template<typename PolicyType>
+	void RunWorker(const PolicyType& Policy, const TArray<FString>& Existing, const char* UniquePrefix, uint32 NumOperations, uint32 ThreadIndex, uint32 AddPercent)
+	{
+		uint32 Random = 0x9E3779B9u ^ (ThreadIndex * 7919u);
+		uint32 Sink = 0;
+		for (uint32 Op = 0; Op < NumOperations; ++Op)
+		{
+			Random ^= Random << 13;
+			Random ^= Random >> 17;
+			Random ^= Random << 5;
+
+			if (Random % 100 < AddPercent)
+			{
+				char Buffer[64];
+				snprintf(Buffer, sizeof(Buffer), "%s_T%u_%u", UniquePrefix, ThreadIndex, Op);
+				Sink += Policy.Make(Buffer);
+			}
+			else
+			{
+				Sink += Policy.Make(Existing[Random % Existing.Num()]);
+			}
+		}
+		volatile uint32 Keep = Sink;
+		(void)Keep;
+	}
+
+	template<typename PolicyType>
+	double Measure(const PolicyType& Policy, const TArray<FString>& Existing, const char* UniquePrefix, uint32 NumThreads, uint32 NumOperations, uint32 AddPercent)
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		if (NumThreads <= 1)
+		{
+			RunWorker(Policy, Existing, UniquePrefix, NumOperations, 0, AddPercent);
+		}
+		else
+		{
+			TArray<std::thread> Threads;
+			for (uint32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+			{
+				Threads.emplace_back([&, ThreadIndex]() { RunWorker(Policy, Existing, UniquePrefix, NumOperations, ThreadIndex, AddPercent); });
+			}
+			for (std::thread& Thread : Threads)
+			{
+				Thread.join();
+			}
+		}
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+
+	void LogScenario(const char* Name, uint64 Operations, double LegacyMS, double PoolMS)
+	{
+		const double Speedup = PoolMS > 0.0 ? LegacyMS / PoolMS : 0.0;
+		UE_LOG("[NameBenchmark] %-28s %12.2f %12.2f %7.2fx  (%.1f Mops/s)",
+			Name, LegacyMS, PoolMS, Speedup, PoolMS > 0.0 ? Operations / (PoolMS * 1000.0) : 0.0);
+	}
+}
+
+void FNameBenchmark::RunAndLog()
+{
+	// 실행할 때마다 새 이름이 되도록 접두어를 바꿈 (다시 실행해도 Add 시나리오가 조회로 바뀌지 않게)
+	static uint32 RunCounter = 0;
+	char Prefix[32];
+	snprintf(Prefix, sizeof(Prefix), "Run%u", ++RunCounter);
+
+	FLegacyNamePool LegacyPool;
+	const FLegacyPolicy Legacy{ LegacyPool };
+	const FNamePoolPolicy Pool;
+
+	TArray<FString> Existing;
+	for (uint32 i = 0; i < 4096; ++i)
+	{
+		Existing.Add(MakeBoneName(i, Prefix));
+		Legacy.Make(Existing.back());
+		Pool.Make(Existing.back());
+	}
+
+	const uint32 NumThreads = std::clamp(std::thread::hardware_concurrency(), 2u, 8u);
+	const uint32 SingleOps = 1000000;
+	const uint32 ThreadOps = 250000;
+
+	UE_LOG("[NameBenchmark] %-28s %12s %12s %8s", "Scenario", "Legacy(ms)", "Pool(ms)", "Speedup");
+	char AddPrefix[48];
+	char MixedPrefix[48];
+	snprintf(AddPrefix, sizeof(AddPrefix), "%s_Add", Prefix);
+	snprintf(MixedPrefix, sizeof(MixedPrefix), "%s_Mixed", Prefix);
+
+	LogScenario("Lookup 1M", SingleOps,
+		Measure(Legacy, Existing, Prefix, 1, SingleOps, 0), Measure(Pool, Existing, Prefix, 1, SingleOps, 0));
+	LogScenario("Add 100k", 100000,
+		Measure(Legacy, Existing, AddPrefix, 1, 100000, 100), Measure(Pool, Existing, AddPrefix, 1, 100000, 100));
+
+	char Name[64];
+	snprintf(Name, sizeof(Name), "Mixed %u threads x 250k", NumThreads);
+	LogScenario(Name, static_cast<uint64>(ThreadOps) * NumThreads,
+		Measure(Legacy, Existing, MixedPrefix, NumThreads, ThreadOps, 10), Measure(Pool, Existing, MixedPrefix, NumThreads, ThreadOps, 10));
+
+	UE_LOG("[NameBenchmark] FNamePool entries: %u", FNamePool::Num());
+}
+
+static const bool bNameBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"NAME BENCH", "-namebench", "FName table benchmark (legacy map vs sharded pool)", EBenchmarkStage::None,
+	[](const FString&) { FNameBenchmark::RunAndLog(); } });
@@ -0,0 +1,16 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief FName 테이블 벤치마크 (콘솔 NAME BENCH 명령)
+ *
+ * 같은 작업을 이전 방식(소문자 FString 생성 + TMap, 전역 뮤텍스)과 현재 FNamePool로 각각 수행합니다.
+ * - Lookup: 이미 등록된 이름을 반복 생성 (본/소켓/스탯 이름 조회 패턴)
+ * - Add: 매번 새 이름 생성
+ * - Mixed (MT): 여러 스레드가 동시에 조회 90% + 추가 10%
+ */
+class FNameBenchmark
+{
+public:
+	static void RunAndLog();
+};
@@ -2,11 +2,20 @@
 
 #include "ObjectFactory.h"
 
+/**
+ * @brief TObject(자식 클래스 포함) 인스턴스만 순회
+ *
+ * GUObjectArray 전체가 아니라 GUObjectClassLists 중 해당 클래스 계열 목록만 방문합니다.
+ * 각 목록은 뒤에서부터 순회하므로 현재 객체를 삭제해도 건너뛰는 객체가 없습니다.
+ * (순회 중 생성된 객체는 방문하지 않을 수 있음)
+ * 클래스 목록 인덱스는 복사하지 않고 ObjectFactory의 캐시를 참조합니다.
+ */
 template<typename TObject>
 class TObjectIterator
 {
 public:
 	TObjectIterator()
+		: ListIndices(&ObjectFactory::GetClassListIndices(TObject::StaticClass()))
 	{
 		++(*this); // 첫 번째 유효 객체로 이동
 	}
@@ -14,7 +23,6 @@ public:
 	// 다음 객체로 이동
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
 		AdvanceToNextValidObject();
 		return *this;
 	}
@@ -22,8 +30,8 @@ public:
 	// 현재 객체에 접근
 	TObject* operator*() const
 	{
-		// 이 시점의 CurrentIndex는 유효한 TObject를 가리키고 있어야 함
-		return static_cast<TObject*>(GUObjectArray[CurrentIndex]);
+		// 이 시점의 CurrentObject는 유효한 TObject를 가리키고 있어야 함
+		return static_cast<TObject*>(CurrentObject);
 	}
 
 	// 현재 객체에 접근 (포인터 연산자)
@@ -35,34 +43,40 @@ public:
 	// 비교 연산자
 	bool operator!=(const TObjectIterator& Other) const
 	{
-		return CurrentIndex != Other.CurrentIndex;
+		return CurrentObject != Other.CurrentObject;
 	}
 
 	// bool 변환 연산자
 	explicit operator bool() const
 	{
-		// CurrentIndex가 배열 범위 내에 있는지 확인
-		return CurrentIndex < GUObjectArray.Num();
+		return CurrentObject != nullptr;
 	}
 
 private:
-	// 현재 인덱스부터 시작하여 다음 유효 객체를 찾는 헬퍼 함수
+	// 현재 목록의 이전 위치로 이동하고, 목록이 끝나면 다음 클래스 목록으로 넘어가는 헬퍼 함수
 	void AdvanceToNextValidObject()
 	{
-		while (CurrentIndex < GUObjectArray.Num())
+		CurrentObject = nullptr;
+		while (ListCursor < ListIndices->Num())
 		{
-			UObject* Object = GUObjectArray[CurrentIndex];
-			// 현재 객체가 유효하고, TObject 타입이면 검색 종료
-			if (Object && Object->IsA<TObject>())
+			const TArray<UObject*>& Objects = GUObjectClassLists[(*ListIndices)[ListCursor]].Objects;
+
+			// 순회 중 삭제로 목록이 줄었으면 끝으로 당김
+			ObjectCursor = std::min(ObjectCursor, Objects.Num()) - 1;
+			if (ObjectCursor >= 0)
 			{
-				break;
+				CurrentObject = Objects[ObjectCursor];
+				return;
 			}
 
-			// 다음 인덱스로 이동
-			++CurrentIndex;
+			++ListCursor;
+			ObjectCursor = INT32_MAX;
 		}
 	}
 
 private:
-	int32 CurrentIndex = -1;
+	const TArray<int32>* ListIndices;
+	int32 ListCursor = 0;
+	int32 ObjectCursor = INT32_MAX;
+	UObject* CurrentObject = nullptr;
 };
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Archive.h"
+#include "MemoryManager.h"
 #include <d3d11.h>
 
 struct FMaterialInfo
@@ -112,6 +113,8 @@ struct FResourceData
 
 struct FTextureData
 {
+    DECLARE_MEMORY_TAGGED_NEW()
+
     ID3D11Resource* Texture = nullptr;
     ID3D11ShaderResourceView* TextureSRV = nullptr;
     ID3D11BlendState* BlendState = nullptr;
@@ -74,3 +74,253 @@ void FBillboardVertexInfo_GPU::FillFrom(const FNormalVertex& src)
     UVRect[2] = src.color.Z;
     UVRect[3] = src.color.W;
 }
+
+void FQuantizedNormalVertex::FillFrom(const FNormalVertex& Src)
+{
+    Position = Src.pos;
+    Normal = VertexQuantization::PackSNorm1010102(Src.normal.X, Src.normal.Y, Src.normal.Z);
+    Tangent = VertexQuantization::PackSNorm1010102(Src.Tangent.X, Src.Tangent.Y, Src.Tangent.Z, Src.Tangent.W);
+    UV[0] = VertexQuantization::FloatToHalf(Src.tex.X);
+    UV[1] = VertexQuantization::FloatToHalf(Src.tex.Y);
+    Color = VertexQuantization::PackRGBA8(Src.color);
+}
+
+void FQuantizedNormalVertex::DecodeTo(FNormalVertex& Dst) const
+{
+    Dst.pos = Position;
+    Dst.normal = VertexQuantization::UnpackSNorm1010102(Normal);
+
+    const FVector TangentDir = VertexQuantization::UnpackSNorm1010102(Tangent);
+    Dst.Tangent = FVector4(TangentDir.X, TangentDir.Y, TangentDir.Z, VertexQuantization::UnpackSNorm1010102W(Tangent));
+
+    Dst.tex = FVector2D(VertexQuantization::HalfToFloat(UV[0]), VertexQuantization::HalfToFloat(UV[1]));
+    Dst.color = VertexQuantization::UnpackRGBA8(Color);
+}
+
+void FQuantizedSkinnedVertex::FillFrom(const FSkinnedVertex& Src)
+{
+    Position = Src.Position;
+    Normal = VertexQuantization::PackSNorm1010102(Src.Normal.X, Src.Normal.Y, Src.Normal.Z);
+    Tangent = VertexQuantization::PackSNorm1010102(Src.Tangent.X, Src.Tangent.Y, Src.Tangent.Z, Src.Tangent.W);
+    UV[0] = VertexQuantization::FloatToHalf(Src.UV.X);
+    UV[1] = VertexQuantization::FloatToHalf(Src.UV.Y);
+    Color = VertexQuantization::PackRGBA8(Src.Color);
+
+    for (int32 i = 0; i < 4; ++i)
+    {
+        BoneIndices[i] = static_cast<uint8>(Src.BoneIndices[i]);
+    }
+    VertexQuantization::PackBoneWeights(Src.BoneWeights, BoneWeights);
+}
+
+void FQuantizedSkinnedVertex::DecodeTo(FSkinnedVertex& Dst) const
+{
+    Dst.Position = Position;
+    Dst.Normal = VertexQuantization::UnpackSNorm1010102(Normal);
+
+    const FVector TangentDir = VertexQuantization::UnpackSNorm1010102(Tangent);
+    Dst.Tangent = FVector4(TangentDir.X, TangentDir.Y, TangentDir.Z, VertexQuantization::UnpackSNorm1010102W(Tangent));
+
+    Dst.UV = FVector2D(VertexQuantization::HalfToFloat(UV[0]), VertexQuantization::HalfToFloat(UV[1]));
+    Dst.Color = VertexQuantization::UnpackRGBA8(Color);
+
+    for (int32 i = 0; i < 4; ++i)
+    {
+        Dst.BoneIndices[i] = BoneIndices[i];
+        Dst.BoneWeights[i] = VertexQuantization::UnpackUNorm8(BoneWeights[i]);
+    }
+}
+
+namespace VertexQuantization
+{
+    namespace
+    {
+        bool IsUVQuantizable(const FVector2D& UV)
+        {
+            return std::fabs(UV.X) <= MaxQuantizedUV && std::fabs(UV.Y) <= MaxQuantizedUV;
+        }
+
+        /**
+         * @brief 압축 정점 배열을 기록한 뒤 메모리의 Full 배열도 압축값에서 다시 디코딩
+         * 캐시를 막 만든 실행과 캐시에서 다시 읽은 실행이 같은 정점(GPU 버퍼/CPU 스키닝 모두)을 쓰도록 함
+         */
+        template<typename QuantizedType, typename FullType>
+        void WriteQuantizedArray(FArchive& Ar, TArray<FullType>& InOutVertices, TArray<QuantizedType>* OutQuantized)
+        {
+            TArray<QuantizedType> Quantized;
+            Quantized.resize(InOutVertices.size());
+            for (size_t Idx = 0; Idx < InOutVertices.size(); ++Idx)
+            {
+                Quantized[Idx].FillFrom(InOutVertices[Idx]);
+                Quantized[Idx].DecodeTo(InOutVertices[Idx]);
+            }
+            Serialization::WriteArray(Ar, Quantized);
+
+            if (OutQuantized)
+            {
+                *OutQuantized = std::move(Quantized);
+            }
+        }
+
+        /**
+         * @brief 압축 정점 배열을 읽어 Full 배열로 복원. 메모리 매핑 아카이브면 복사 없이 뷰에서 바로 디코딩
+         */
+        template<typename QuantizedType, typename FullType>
+        void ReadQuantizedArray(FArchive& Ar, TArray<FullType>& OutVertices, TArray<QuantizedType>* OutQuantized)
+        {
+            const QuantizedType* View = nullptr;
+            uint32 Count = 0;
+
+            TArray<QuantizedType> Fallback;
+            if (!Serialization::ReadArrayView(Ar, View, Count))
+            {
+                Fallback.resize(Count);
+                Ar.Serialize(Fallback.data(), static_cast<int64>(sizeof(QuantizedType)) * Count);
+                View = Fallback.data();
+            }
+
+            OutVertices.resize(Count);
+            for (uint32 Idx = 0; Idx < Count; ++Idx)
+            {
+                View[Idx].DecodeTo(OutVertices[Idx]);
+            }
+
+            if (OutQuantized)
+            {
+                OutQuantized->assign(View, View + Count);
+            }
+        }
+
+        EVertexStreamFormat ReadFormat(FArchive& Ar)
+        {
+            uint8 FormatByte = 0;
+            Ar << FormatByte;
+            if (FormatByte > static_cast<uint8>(EVertexStreamFormat::Quantized))
+            {
+                throw std::runtime_error("Cache corrupt: unknown vertex stream format.");
+            }
+            return static_cast<EVertexStreamFormat>(FormatByte);
+        }
+
+        void WriteFormat(FArchive& Ar, EVertexStreamFormat Format)
+        {
+            uint8 FormatByte = static_cast<uint8>(Format);
+            Ar << FormatByte;
+        }
+    }
+
+    bool CanQuantize(const TArray<FNormalVertex>& Vertices)
+    {
+        for (const FNormalVertex& Vertex : Vertices)
+        {
+            if (!IsUVQuantizable(Vertex.tex))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool CanQuantize(const TArray<FSkinnedVertex>& Vertices)
+    {
+        for (const FSkinnedVertex& Vertex : Vertices)
+        {
+            if (!IsUVQuantizable(Vertex.UV))
+            {
+                return false;
+            }
+            for (int32 i = 0; i < 4; ++i)
+            {
+                if (Vertex.BoneIndices[i] > 0xFF)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    void Quantize(TArray<FSkinnedVertex>& InOutVertices, TArray<FQuantizedSkinnedVertex>& OutQuantized)
+    {
+        OutQuantized.resize(InOutVertices.size());
+        for (size_t Idx = 0; Idx < InOutVertices.size(); ++Idx)
+        {
+            OutQuantized[Idx].FillFrom(InOutVertices[Idx]);
+            OutQuantized[Idx].DecodeTo(InOutVertices[Idx]);
+        }
+    }
+
+    EVertexStreamFormat WriteVertices(FArchive& Ar, TArray<FNormalVertex>& Vertices)
+    {
+#ifdef USE_QUANTIZED_VERTEX
+        if (CanQuantize(Vertices))
+        {
+            WriteFormat(Ar, EVertexStreamFormat::Quantized);
+            WriteQuantizedArray<FQuantizedNormalVertex>(Ar, Vertices, nullptr);
+            return EVertexStreamFormat::Quantized;
+        }
+#endif
+        WriteFormat(Ar, EVertexStreamFormat::Full);
+        Serialization::WriteArray(Ar, Vertices);
+        return EVertexStreamFormat::Full;
+    }
+
+    EVertexStreamFormat WriteVertices(FArchive& Ar, TArray<FSkinnedVertex>& Vertices, TArray<FQuantizedSkinnedVertex>* OutQuantized)
+    {
+#ifdef USE_QUANTIZED_VERTEX
+        if (CanQuantize(Vertices))
+        {
+            WriteFormat(Ar, EVertexStreamFormat::Quantized);
+            WriteQuantizedArray<FQuantizedSkinnedVertex>(Ar, Vertices, OutQuantized);
+            return EVertexStreamFormat::Quantized;
+        }
+#endif
+        WriteFormat(Ar, EVertexStreamFormat::Full);
+        Serialization::WriteArray(Ar, Vertices);
+        return EVertexStreamFormat::Full;
+    }
+
+    EVertexStreamFormat ReadVertices(FArchive& Ar, TArray<FNormalVertex>& OutVertices)
+    {
+        const EVertexStreamFormat Format = ReadFormat(Ar);
+        if (Format == EVertexStreamFormat::Quantized)
+        {
+            ReadQuantizedArray<FQuantizedNormalVertex>(Ar, OutVertices, nullptr);
+        }
+        else
+        {
+            Serialization::ReadArray(Ar, OutVertices);
+        }
+        return Format;
+    }
+
+    EVertexStreamFormat ReadVertices(FArchive& Ar, TArray<FSkinnedVertex>& OutVertices, TArray<FQuantizedSkinnedVertex>* OutQuantized)
+    {
+        const EVertexStreamFormat Format = ReadFormat(Ar);
+        if (Format == EVertexStreamFormat::Quantized)
+        {
+            ReadQuantizedArray<FQuantizedSkinnedVertex>(Ar, OutVertices, OutQuantized);
+        }
+        else
+        {
+            Serialization::ReadArray(Ar, OutVertices);
+        }
+        return Format;
+    }
+
+    void LogMemoryReport(const FString& MeshPath, uint32 NumVertices, uint32 FullStride, uint32 QuantizedStride, EVertexStreamFormat Format)
+    {
+        const double FullKB = static_cast<double>(FullStride) * NumVertices / 1024.0;
+        if (Format != EVertexStreamFormat::Quantized)
+        {
+            UE_LOG("[VertexQuantization] %s: %u verts, full format %.1f KB (%u B/vert, not quantizable)",
+                MeshPath.c_str(), NumVertices, FullKB, FullStride);
+            return;
+        }
+
+        const double QuantizedKB = static_cast<double>(QuantizedStride) * NumVertices / 1024.0;
+        UE_LOG("[VertexQuantization] %s: %u verts, %.1f KB -> %.1f KB (%u -> %u B/vert, %.0f%% of full bandwidth)",
+            MeshPath.c_str(), NumVertices, FullKB, QuantizedKB, FullStride, QuantizedStride,
+            100.0 * QuantizedStride / FullStride);
+    }
+}
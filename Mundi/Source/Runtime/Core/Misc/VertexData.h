@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include "Archive.h"
 #include "Vector.h"
+#include "MemoryManager.h"
+#include "VertexQuantization.h"
 
 // 직렬화 포맷 (FVertexDynamic와 역할이 달라서 분리됨)
 struct FNormalVertex
@@ -146,6 +148,85 @@ namespace std
     };
 }
 
+/**
+ * @brief FNormalVertex의 압축 포맷 (64 -> 28 bytes)
+ * 위치는 float3 그대로, 법선/탄젠트는 snorm 10:10:10:2, UV는 half2, 컬러는 RGBA8
+ */
+struct FQuantizedNormalVertex
+{
+    FVector Position;
+    uint32 Normal = 0;  // 10:10:10:2 (w 미사용)
+    uint32 Tangent = 0; // 10:10:10:2 (w = binormal 부호)
+    uint16 UV[2]{};     // half
+    uint32 Color = 0;   // RGBA8
+
+    void FillFrom(const FNormalVertex& Src);
+    void DecodeTo(FNormalVertex& Dst) const;
+};
+static_assert(sizeof(FQuantizedNormalVertex) == 28, "FQuantizedNormalVertex layout changed; bump mesh cache versions.");
+
+/**
+ * @brief FSkinnedVertex의 압축 포맷 (96 -> 36 bytes). CPU 스키닝의 원본 정점 스트림으로 사용
+ * 본 인덱스는 uint8 (본 256개 이하 메시만), 가중치는 unorm8 (합 255)
+ */
+struct FQuantizedSkinnedVertex
+{
+    FVector Position;
+    uint32 Normal = 0;
+    uint32 Tangent = 0;
+    uint16 UV[2]{};
+    uint32 Color = 0;
+    uint8 BoneIndices[4]{};
+    uint8 BoneWeights[4]{};
+
+    void FillFrom(const FSkinnedVertex& Src);
+    void DecodeTo(FSkinnedVertex& Dst) const;
+};
+static_assert(sizeof(FQuantizedSkinnedVertex) == 36, "FQuantizedSkinnedVertex layout changed; bump mesh cache versions.");
+
+/**
+ * @brief 캐시에 기록된 정점 배열의 포맷
+ */
+enum class EVertexStreamFormat : uint8
+{
+    Full,       // FNormalVertex / FSkinnedVertex 그대로
+    Quantized,  // FQuantizedNormalVertex / FQuantizedSkinnedVertex
+};
+
+namespace VertexQuantization
+{
+    /**
+     * @brief 압축해도 되는 메시인지 검사
+     * half UV 정밀도가 유지되는 범위(|UV| <= MaxQuantizedUV)를 벗어나거나, 본 인덱스가 255를 넘으면 Full 포맷 유지
+     */
+    constexpr float MaxQuantizedUV = 4.0f;
+    bool CanQuantize(const TArray<FNormalVertex>& Vertices);
+    bool CanQuantize(const TArray<FSkinnedVertex>& Vertices);
+
+    /** 압축 정점을 만들고, GPU/CPU 스키닝 결과가 같도록 InOutVertices도 디코딩한 값으로 바꿈 */
+    void Quantize(TArray<FSkinnedVertex>& InOutVertices, TArray<FQuantizedSkinnedVertex>& OutQuantized);
+
+    /**
+     * @brief 포맷 바이트 + 정점 배열 기록. USE_QUANTIZED_VERTEX가 켜져 있고 CanQuantize를 통과하면 압축 포맷으로 기록
+     * 압축 포맷으로 기록했으면 Vertices를 압축값에서 디코딩한 값으로 바꿈 (이후 ReadVertices 결과와 동일)
+     * @param OutQuantized 압축 포맷이면 기록한 압축 정점으로 채움 (nullptr이면 무시)
+     */
+    EVertexStreamFormat WriteVertices(FArchive& Ar, TArray<FNormalVertex>& Vertices);
+    EVertexStreamFormat WriteVertices(FArchive& Ar, TArray<FSkinnedVertex>& Vertices, TArray<FQuantizedSkinnedVertex>* OutQuantized);
+
+    /**
+     * @brief WriteVertices로 기록된 배열을 읽음 (포맷에 상관없이 Full 배열로 복원)
+     * @param OutQuantized 압축 포맷이면 파일의 압축 정점을 그대로 채움 (nullptr이면 무시)
+     */
+    EVertexStreamFormat ReadVertices(FArchive& Ar, TArray<FNormalVertex>& OutVertices);
+    EVertexStreamFormat ReadVertices(FArchive& Ar, TArray<FSkinnedVertex>& OutVertices, TArray<FQuantizedSkinnedVertex>* OutQuantized);
+
+    /**
+     * @brief 메시 하나의 정점 메모리/대역폭 리포트를 로그로 출력
+     */
+    void LogMemoryReport(const FString& MeshPath, uint32 NumVertices, uint32 FullStride, uint32 QuantizedStride, EVertexStreamFormat Format);
+}
+
 struct FBillboardVertexInfo {
     FVector WorldPosition;
     FVector2D CharSize;//char scale
@@ -194,6 +275,8 @@ struct FGroupInfo
 
 struct FStaticMesh
 {
+    DECLARE_MEMORY_TAGGED_NEW()
+
     FString PathFileName;
     FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube.obj.bin)
 
@@ -203,12 +286,14 @@ struct FStaticMesh
 
     bool bHasMaterial;
 
+    EVertexStreamFormat VertexStreamFormat = EVertexStreamFormat::Full; // 캐시에 기록된 정점 포맷 (직렬화 시 갱신)
+
     friend FArchive& operator<<(FArchive& Ar, FStaticMesh& Mesh)
     {
         if (Ar.IsSaving())
         {
             Serialization::WriteString(Ar, Mesh.PathFileName);
-            Serialization::WriteArray(Ar, Mesh.Vertices);
+            Mesh.VertexStreamFormat = VertexQuantization::WriteVertices(Ar, Mesh.Vertices);
             Serialization::WriteArray(Ar, Mesh.Indices);
 
             uint32_t gCount = (uint32_t)Mesh.GroupInfos.size();
@@ -220,7 +305,7 @@ struct FStaticMesh
         else if (Ar.IsLoading())
         {
             Serialization::ReadString(Ar, Mesh.PathFileName);
-            Serialization::ReadArray(Ar, Mesh.Vertices);
+            Mesh.VertexStreamFormat = VertexQuantization::ReadVertices(Ar, Mesh.Vertices);
             Serialization::ReadArray(Ar, Mesh.Indices);
 
             uint32_t gCount;
@@ -366,21 +451,26 @@ struct FVertexWeight
 
 struct FSkeletalMeshData
 {
+    DECLARE_MEMORY_TAGGED_NEW()
+
     FString PathFileName;
     FString CacheFilePath;
     
     TArray<FSkinnedVertex> Vertices; // 정점 배열
+    TArray<FQuantizedSkinnedVertex> QuantizedVertices; // CPU 스키닝용 압축 정점 (USE_QUANTIZED_VERTEX, 직렬화하지 않음)
     TArray<uint32> Indices; // 인덱스 배열
     FSkeleton Skeleton; // 스켈레톤 정보
     TArray<FGroupInfo> GroupInfos; // 머티리얼 그룹 (기존 시스템 재사용)
     bool bHasMaterial = false;
 
+    EVertexStreamFormat VertexStreamFormat = EVertexStreamFormat::Full; // 캐시에 기록된 정점 포맷 (직렬화 시 갱신)
+
     friend FArchive& operator<<(FArchive& Ar, FSkeletalMeshData& Data)
     {
         if (Ar.IsSaving())
         {
-            // 1. Vertices 저장
-            Serialization::WriteArray(Ar, Data.Vertices);
+            // 1. Vertices 저장 (압축 포맷이면 메모리 정점과 CPU 스키닝용 압축 정점도 캐시 내용과 같게 맞춤)
+            Data.VertexStreamFormat = VertexQuantization::WriteVertices(Ar, Data.Vertices, &Data.QuantizedVertices);
 
             // 2. Indices 저장
             Serialization::WriteArray(Ar, Data.Indices);
@@ -404,8 +494,8 @@ struct FSkeletalMeshData
         }
         else if (Ar.IsLoading())
         {
-            // 1. Vertices 로드
-            Serialization::ReadArray(Ar, Data.Vertices);
+            // 1. Vertices 로드 (압축 포맷이면 CPU 스키닝용 압축 정점도 함께 채움)
+            Data.VertexStreamFormat = VertexQuantization::ReadVertices(Ar, Data.Vertices, &Data.QuantizedVertices);
 
             // 2. Indices 로드
             Serialization::ReadArray(Ar, Data.Indices);
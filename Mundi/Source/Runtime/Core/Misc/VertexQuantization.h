@@ -0,0 +1,158 @@
+#pragma once
+#include "Vector.h"
+#include <cstring>
+
+/**
+ * @brief 정점 속성 압축/복원 함수 모음 (캐시 저장 포맷 및 CPU 측 압축 정점 스트림용)
+ *
+ * - Half: IEEE 754 binary16 (UV)
+ * - SNorm1010102: 부호 있는 10:10:10:2 (법선/탄젠트, w 2비트는 -1/0/+1 부호)
+ * - RGBA8: 채널당 unorm 8비트 (정점 컬러, 본 가중치)
+ */
+namespace VertexQuantization
+{
+    inline uint16 FloatToHalf(float Value)
+    {
+        uint32 Bits;
+        memcpy(&Bits, &Value, sizeof(Bits));
+
+        const uint32 Sign = (Bits >> 16) & 0x8000;
+        const uint32 Abs = Bits & 0x7FFFFFFF;
+
+        // 65536 이상 / Inf / NaN
+        if (Abs >= 0x47800000)
+        {
+            return static_cast<uint16>(Sign | (Abs > 0x7F800000 ? 0x7E00 : 0x7C00));
+        }
+
+        // half 정규화 최소값(2^-14)보다 작으면 비정규 수: 0.5f를 더해 가수를 2^-24 단위로 정렬
+        if (Abs < 0x38800000)
+        {
+            float Shifted;
+            memcpy(&Shifted, &Abs, sizeof(Shifted));
+            Shifted += 0.5f;
+
+            uint32 ShiftedBits;
+            memcpy(&ShiftedBits, &Shifted, sizeof(ShiftedBits));
+            return static_cast<uint16>(Sign | (ShiftedBits - 0x3F000000));
+        }
+
+        // 지수 재조정(-112) + 최근접 짝수 반올림
+        const uint32 MantissaOdd = (Abs >> 13) & 1;
+        const uint32 Rounded = Abs + 0xC8000FFF + MantissaOdd;
+        return static_cast<uint16>(Sign | (Rounded >> 13));
+    }
+
+    inline float HalfToFloat(uint16 Half)
+    {
+        const uint32 Sign = static_cast<uint32>(Half & 0x8000) << 16;
+        const uint32 Exponent = (Half >> 10) & 0x1F;
+        const uint32 Mantissa = Half & 0x3FF;
+
+        if (Exponent == 0)
+        {
+            const float Value = static_cast<float>(Mantissa) * (1.0f / 16777216.0f); // 2^-24
+            return Sign ? -Value : Value;
+        }
+
+        uint32 Bits;
+        if (Exponent == 31)
+        {
+            Bits = Sign | 0x7F800000 | (Mantissa << 13);
+        }
+        else
+        {
+            Bits = Sign | ((Exponent + 112) << 23) | (Mantissa << 13);
+        }
+
+        float Value;
+        memcpy(&Value, &Bits, sizeof(Value));
+        return Value;
+    }
+
+    inline uint32 PackSNorm10(float Value)
+    {
+        const float Clamped = Value < -1.0f ? -1.0f : (Value > 1.0f ? 1.0f : Value);
+        const int32 Quantized = static_cast<int32>(std::lround(Clamped * 511.0f));
+        return static_cast<uint32>(Quantized) & 0x3FF;
+    }
+
+    inline float UnpackSNorm10(uint32 Bits)
+    {
+        // 10비트 부호 확장
+        const int32 Signed = static_cast<int32>(Bits << 22) >> 22;
+        const float Value = static_cast<float>(Signed) * (1.0f / 511.0f);
+        return Value < -1.0f ? -1.0f : Value;
+    }
+
+    inline uint32 PackSNorm1010102(float X, float Y, float Z, float W = 0.0f)
+    {
+        // w는 탄젠트의 binormal 부호만 담음 (-1, 0, +1)
+        const int32 SignW = W > 0.5f ? 1 : (W < -0.5f ? -1 : 0);
+        return PackSNorm10(X) | (PackSNorm10(Y) << 10) | (PackSNorm10(Z) << 20) | ((static_cast<uint32>(SignW) & 0x3) << 30);
+    }
+
+    inline FVector UnpackSNorm1010102(uint32 Packed)
+    {
+        return FVector(UnpackSNorm10(Packed & 0x3FF), UnpackSNorm10((Packed >> 10) & 0x3FF), UnpackSNorm10((Packed >> 20) & 0x3FF));
+    }
+
+    inline float UnpackSNorm1010102W(uint32 Packed)
+    {
+        return static_cast<float>(static_cast<int32>(Packed) >> 30);
+    }
+
+    inline uint8 PackUNorm8(float Value)
+    {
+        const float Clamped = Value < 0.0f ? 0.0f : (Value > 1.0f ? 1.0f : Value);
+        return static_cast<uint8>(std::lround(Clamped * 255.0f));
+    }
+
+    inline float UnpackUNorm8(uint8 Value)
+    {
+        return static_cast<float>(Value) * (1.0f / 255.0f);
+    }
+
+    inline uint32 PackRGBA8(const FVector4& Color)
+    {
+        return static_cast<uint32>(PackUNorm8(Color.X))
+            | (static_cast<uint32>(PackUNorm8(Color.Y)) << 8)
+            | (static_cast<uint32>(PackUNorm8(Color.Z)) << 16)
+            | (static_cast<uint32>(PackUNorm8(Color.W)) << 24);
+    }
+
+    inline FVector4 UnpackRGBA8(uint32 Packed)
+    {
+        return FVector4(
+            UnpackUNorm8(static_cast<uint8>(Packed & 0xFF)),
+            UnpackUNorm8(static_cast<uint8>((Packed >> 8) & 0xFF)),
+            UnpackUNorm8(static_cast<uint8>((Packed >> 16) & 0xFF)),
+            UnpackUNorm8(static_cast<uint8>(Packed >> 24)));
+    }
+
+    /**
+     * @brief 본 가중치 4개를 unorm8로 압축. 반올림 오차는 가장 큰 가중치에 몰아 합이 정확히 255가 되게 함
+     */
+    inline void PackBoneWeights(const float InWeights[4], uint8 OutWeights[4])
+    {
+        const float Sum = InWeights[0] + InWeights[1] + InWeights[2] + InWeights[3];
+        const float Scale = Sum > 0.0f ? 1.0f / Sum : 0.0f;
+
+        int32 Total = 0;
+        int32 MaxIndex = 0;
+        for (int32 i = 0; i < 4; ++i)
+        {
+            OutWeights[i] = PackUNorm8(InWeights[i] * Scale);
+            Total += OutWeights[i];
+            if (OutWeights[i] > OutWeights[MaxIndex])
+            {
+                MaxIndex = i;
+            }
+        }
+
+        if (Total > 0 && Total != 255)
+        {
+            OutWeights[MaxIndex] = static_cast<uint8>(OutWeights[MaxIndex] + (255 - Total));
+        }
+    }
+}
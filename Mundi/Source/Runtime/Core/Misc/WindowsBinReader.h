@@ -24,8 +24,8 @@ public:
     {
         File.read(reinterpret_cast<char*>(Data), Length);
     }
-    /*void Seek(size_t Position) override { File.seekg(Position); }
-    size_t Tell() const override { return (size_t)File.tellg(); }*/
+    void Seek(int64 Position) override { File.seekg(Position); }
+    int64 Tell() override { return static_cast<int64>(File.tellg()); }
     bool Close() override
     {
         if (File.is_open()) { File.close(); return true; }
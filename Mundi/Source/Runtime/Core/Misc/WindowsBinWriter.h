@@ -14,12 +14,17 @@ public:
     }
     ~FWindowsBinWriter() { Close(); }
 
+    bool IsOpen() const
+    {
+        return File.is_open();
+    }
+
     void Serialize(void* Data, int64 Length) override
     {
         File.write(reinterpret_cast<char*>(Data), Length);
     }
-    /*void Seek(size_t Position) override { File.seekp(Position); }
-    size_t Tell() const override { return (size_t)File.tellp(); }*/
+    void Seek(int64 Position) override { File.seekp(Position); }
+    int64 Tell() override { return static_cast<int64>(File.tellp()); }
     bool Close() override
     {
         if (File.is_open()) { File.close(); return true; }
@@ -11,6 +11,7 @@
 #include "World.h"
 #include "PrimitiveComponent.h"
 #include "GameObject.h"
+#include "ActorQueryIndex.h"
 
 	/*BEGIN_PROPERTIES(AActor)
 	ADD_PROPERTY(FName, ObjectName, "[액터]", true, "액터의 이름입니다")
@@ -115,6 +116,26 @@ void AActor::Destroy()
 	World->AddPendingKillActor(this);
 }
 
+void AActor::SetTag(const FString& InTag)
+{
+	Tag = InTag;
+	RefreshQueryIndex();
+}
+
+void AActor::SetName(const FName& InName)
+{
+	ObjectName = InName;
+	RefreshQueryIndex();
+}
+
+void AActor::RefreshQueryIndex()
+{
+	if (FActorQueryIndex* QueryIndex = FActorQueryIndex::Get(this))
+	{
+		QueryIndex->RefreshActor(this);
+	}
+}
+
 void AActor::SetRootComponent(USceneComponent* InRoot)
 {
 	if (RootComponent == InRoot)
@@ -202,6 +223,10 @@ void AActor::AddOwnedComponent(UActorComponent* Component)
 
 	OwnedComponents.insert(Component);
 	Component->SetOwner(this);
+	if (FActorQueryIndex* QueryIndex = FActorQueryIndex::Get(this))
+	{
+		QueryIndex->AddComponent(this, Component);
+	}
 	if (USceneComponent* SC = Cast<USceneComponent>(Component))
 	{
 		SceneComponents.AddUnique(SC);
@@ -674,6 +699,12 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
 
+	if (bInIsLoading && IsLoadingCooked())
+	{
+		// 쿠킹 레벨: 컴포넌트 생성/부착은 FLevelCooker::SpawnCookedActor가 이미 수행함
+		return;
+	}
+
 	if (bInIsLoading)
 	{
 		// 액터 생성자에서 만들어진 컴포넌트를 무시하고 저장된 컴포넌트만 다시 붙인다
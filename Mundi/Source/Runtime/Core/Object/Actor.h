@@ -45,8 +45,12 @@ public:
     virtual void Destroy();
     virtual void HandleAnimNotify(const FAnimNotifyEvent& NotifyEvent) {}
 
-    void SetTag(const FString& InTag) { Tag = InTag; }
+    // 레벨에 배치된 액터의 이름/태그는 반드시 아래 함수로 변경 (월드 검색 인덱스 갱신)
+    void SetTag(const FString& InTag);
     const FString& GetTag() const { return Tag; }
+    void SetName(const FName& InName);
+    // ObjectName/Tag/컴포넌트를 리플렉션 등으로 직접 수정한 뒤 호출
+    void RefreshQueryIndex();
 
     // 월드/표시
     void SetWorld(UWorld* InWorld) { World = InWorld; }
@@ -3,6 +3,7 @@
 #include "Actor.h"
 #include "World.h"
 #include "SelectionManager.h"
+#include "ActorQueryIndex.h"
 
 //BEGIN_PROPERTIES(UActorComponent)
 //    ADD_PROPERTY(FName, ObjectName, "[컴포넌트]", true, "컴포넌트의 이름입니다")
@@ -36,6 +37,12 @@ void UActorComponent::DestroyComponent()
     // 스스로 등록 해제
     UnregisterComponent();
 
+    // 월드 검색 인덱스에서 제거 (삭제 후 뷰가 댕글링 포인터를 보지 않도록)
+    if (FActorQueryIndex* QueryIndex = FActorQueryIndex::Get(Owner))
+    {
+        QueryIndex->RemoveComponent(this);
+    }
+
     // UObject 메모리 해제
     DeleteObject(this);
 }
@@ -0,0 +1,202 @@
+#include "pch.h"
+#include "ClassBenchmark.h"
+#include "Actor.h"
+#include "SceneComponent.h"
+#include "PrimitiveComponent.h"
+#include "StaticMeshComponent.h"
+#include "LightComponent.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+
+namespace
+{
+	// 이전 IsChildOf (Super 체인 순회)
+	bool LegacyIsChildOf(const UClass* Class, const UClass* Base)
+	{
+		if (!Base) return false;
+		for (const UClass* It = Class; It; It = It->Super)
+			if (It == Base) return true;
+		return false;
+	}
+
+	// 이전 FindClass (등록 목록 선형 strcmp)
+	UClass* LegacyFindClass(const char* InClassName)
+	{
+		for (UClass* Class : UClass::GetAllClasses())
+		{
+			if (Class && Class->Name && strcmp(Class->Name, InClassName) == 0)
+			{
+				return Class;
+			}
+		}
+		return nullptr;
+	}
+
+	void LogScenario(const char* Name, uint64 Operations, double LegacyMS, double NewMS)
+	{
+		const double Speedup = NewMS > 0.0 ? LegacyMS / NewMS : 0.0;
+		const double Mops = NewMS > 0.0 ? static_cast<double>(Operations) / (NewMS * 1000.0) : 0.0;
+		UE_LOG("[ClassBenchmark] %-26s %10.2f %10.2f %7.2fx %9.1f", Name, LegacyMS, NewMS, Speedup, Mops);
+	}
+}
+
+void FClassBenchmark::RunAndLog()
+{
+	const TArray<UClass*>& AllClasses = UClass::GetAllClasses();
+	if (AllClasses.IsEmpty())
+	{
+		UE_LOG("[ClassBenchmark] No registered classes");
+		return;
+	}
+
+	const UClass* Bases[] = {
+		UObject::StaticClass(), AActor::StaticClass(), UActorComponent::StaticClass(), USceneComponent::StaticClass(),
+		UPrimitiveComponent::StaticClass(), UStaticMeshComponent::StaticClass(), ULightComponent::StaticClass()
+	};
+	constexpr int32 NumBases = sizeof(Bases) / sizeof(Bases[0]);
+
+	int32 MaxDepth = 0;
+	for (const UClass* Class : AllClasses)
+	{
+		MaxDepth = FMath::Max(MaxDepth, Class->ClassDepth);
+	}
+	UE_LOG("[ClassBenchmark] %d classes, max depth %d", AllClasses.Num(), MaxDepth);
+
+	// 결과 검증: 모든 클래스 쌍에서 이전 방식과 같은지
+	int32 Mismatches = 0;
+	for (const UClass* Class : AllClasses)
+	{
+		for (const UClass* Base : AllClasses)
+		{
+			Mismatches += (Class->IsChildOf(Base) != LegacyIsChildOf(Class, Base)) ? 1 : 0;
+		}
+	}
+	UE_LOG("[ClassBenchmark] IsChildOf validation: %d mismatches over %d pairs", Mismatches, AllClasses.Num() * AllClasses.Num());
+
+	UE_LOG("[ClassBenchmark] %-26s %10s %10s %8s %9s", "Scenario", "old(ms)", "new(ms)", "Speedup", "Mops/s");
+
+	// IsChildOf: 무작위 클래스 x 기반 클래스
+	{
+		constexpr int32 NumSamples = 1 << 18;
+		FBenchmarkRandom Random;
+		TArray<const UClass*> Samples;
+		Samples.reserve(NumSamples);
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			Samples.Add(AllClasses[Random.Next() % AllClasses.Num()]);
+		}
+
+		uint32 LegacyHits = 0, NewHits = 0;
+		const double LegacyMS = MeasureMS([&]()
+		{
+			for (const UClass* Base : Bases)
+				for (const UClass* Class : Samples)
+					LegacyHits += LegacyIsChildOf(Class, Base) ? 1 : 0;
+		});
+		const double NewMS = MeasureMS([&]()
+		{
+			for (const UClass* Base : Bases)
+				for (const UClass* Class : Samples)
+					NewHits += Class->IsChildOf(Base) ? 1 : 0;
+		});
+		LogScenario("IsChildOf", static_cast<uint64>(NumSamples) * NumBases, LegacyMS, NewMS);
+		if (LegacyHits != NewHits)
+		{
+			UE_LOG("[ClassBenchmark] IsChildOf hit count differs: %u vs %u", LegacyHits, NewHits);
+		}
+	}
+
+	// Cast: 살아있는 객체 집합 (10만 개가 될 때까지 반복)
+	{
+		TArray<UObject*> Objects;
+		for (UObject* Object : GUObjectArray)
+		{
+			if (Object)
+			{
+				Objects.Add(Object);
+			}
+		}
+		if (Objects.IsEmpty())
+		{
+			UE_LOG("[ClassBenchmark] Cast: no live objects");
+		}
+		else
+		{
+			const int32 NumLive = Objects.Num();
+			while (Objects.Num() < 100000)
+			{
+				Objects.Add(Objects[Objects.Num() % NumLive]);
+			}
+
+			uint32 LegacyHits = 0, NewHits = 0;
+			const double LegacyMS = MeasureMS([&]()
+			{
+				for (UObject* Object : Objects)
+				{
+					LegacyHits += LegacyIsChildOf(Object->GetClass(), AActor::StaticClass()) ? 1 : 0;
+					LegacyHits += LegacyIsChildOf(Object->GetClass(), UPrimitiveComponent::StaticClass()) ? 1 : 0;
+					LegacyHits += LegacyIsChildOf(Object->GetClass(), UStaticMeshComponent::StaticClass()) ? 1 : 0;
+					LegacyHits += LegacyIsChildOf(Object->GetClass(), ULightComponent::StaticClass()) ? 1 : 0;
+				}
+			});
+			const double NewMS = MeasureMS([&]()
+			{
+				for (UObject* Object : Objects)
+				{
+					NewHits += Cast<AActor>(Object) ? 1 : 0;
+					NewHits += Cast<UPrimitiveComponent>(Object) ? 1 : 0;
+					NewHits += Cast<UStaticMeshComponent>(Object) ? 1 : 0;
+					NewHits += Cast<ULightComponent>(Object) ? 1 : 0;
+				}
+			});
+			UE_LOG("[ClassBenchmark] Cast set: %d live objects, %d samples", NumLive, Objects.Num());
+			LogScenario("Cast (4 bases)", static_cast<uint64>(Objects.Num()) * 4, LegacyMS, NewMS);
+			if (LegacyHits != NewHits)
+			{
+				UE_LOG("[ClassBenchmark] Cast hit count differs: %u vs %u", LegacyHits, NewHits);
+			}
+		}
+	}
+
+	// FindClass: 등록된 모든 이름을 반복 조회
+	{
+		constexpr int32 NumRounds = 200;
+		TArray<FString> Names;
+		TArray<FName> FNames;
+		for (const UClass* Class : AllClasses)
+		{
+			Names.Add(Class->Name);
+			FNames.Add(Class->ClassFName);
+		}
+		const uint64 NumLookups = static_cast<uint64>(Names.Num()) * NumRounds;
+
+		uintptr_t Sink = 0;
+		const double LegacyMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (const FString& Name : Names)
+					Sink += reinterpret_cast<uintptr_t>(LegacyFindClass(Name.c_str()));
+		});
+		const double StringMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (const FString& Name : Names)
+					Sink += reinterpret_cast<uintptr_t>(UClass::FindClass(Name));
+		});
+		const double FNameMS = MeasureMS([&]()
+		{
+			for (int32 Round = 0; Round < NumRounds; ++Round)
+				for (const FName& Name : FNames)
+					Sink += reinterpret_cast<uintptr_t>(UClass::FindClass(Name));
+		});
+		LogScenario("FindClass (string hash)", NumLookups, LegacyMS, StringMS);
+		LogScenario("FindClass (FName)", NumLookups, LegacyMS, FNameMS);
+
+		volatile uintptr_t Keep = Sink;
+		(void)Keep;
+	}
+}
+
+static const bool bClassBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"CLASS BENCH", "-classbench", "class lookup / Cast benchmark (Super chain vs ancestor table)", EBenchmarkStage::None,
+	[](const FString&) { FClassBenchmark::RunAndLog(); } });
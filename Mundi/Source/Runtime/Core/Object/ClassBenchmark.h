@@ -0,0 +1,15 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief UClass 조회/상속 판정 벤치마크 (콘솔 CLASS BENCH 명령)
+ *
+ * - IsChildOf: 등록된 모든 클래스 쌍에 대해 Super 체인 순회(이전 방식)와 조상 배열 판정 비교
+ * - Cast: 현재 GUObjectArray의 객체들(부족하면 반복)을 여러 기반 클래스로 Cast
+ * - FindClass: 선형 strcmp(이전 방식) / 문자열 해시 / FName 인덱스 조회 비교
+ */
+class FClassBenchmark
+{
+public:
+	static void RunAndLog();
+};
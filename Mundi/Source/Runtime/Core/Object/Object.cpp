@@ -14,9 +14,16 @@ FString UObject::GetComparisonName()
 void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	const TArray<FProperty>& Properties = this->GetClass()->GetAllProperties();
+	const bool bSkipFixedLayout = bInIsLoading && IsLoadingCooked();
 
 	for (const FProperty& Prop : Properties)
 	{
+		// 쿠킹 레벨 로드: 고정 크기 프로퍼티는 FLevelCooker가 레코드에서 직접 기록함
+		if (bSkipFixedLayout && IsFixedLayoutPropertyType(Prop.Type))
+		{
+			continue;
+		}
+
 		switch (Prop.Type)
 		{
 		case EPropertyType::Bool:
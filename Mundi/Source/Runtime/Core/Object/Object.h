@@ -28,15 +28,43 @@ struct UClass
     const char* Description = nullptr;         // 툴팁 설명
     mutable TArray<FProperty> CachedAllProperties;  // GetAllProperties() 캐시 (성능 최적화)
     mutable bool bAllPropertiesCached = false;      // 캐시 유효성 플래그
+    int32 ObjectListIndex = -1;                     // GUObjectClassLists 인덱스 (첫 인스턴스 생성 시 배정)
+    FName ClassFName;                               // SignUpClass 시 등록 (FindClass(FName) 키)
+
+    // 상속 깊이 + 조상 배열 (IsChildOf O(1) 판정용)
+    // Super::StaticClass()가 항상 먼저 생성되므로 생성자에서 부모 배열을 복사해 채움
+    static constexpr int32 MaxInlineDepth = 16;
+    int32 ClassDepth = 0;                           // UObject = 0
+    const UClass* AncestorChain[MaxInlineDepth] = {}; // [d] = 깊이 d의 조상 (자기 자신 포함)
 
     constexpr UClass() = default;
     constexpr UClass(const char* n, const UClass* s, SIZE_T z)
         :Name(n), Super(s), Size(z)
     {
+        if (s)
+        {
+            ClassDepth = s->ClassDepth + 1;
+            for (int32 Depth = 0; Depth < MaxInlineDepth && Depth < ClassDepth; ++Depth)
+            {
+                AncestorChain[Depth] = s->AncestorChain[Depth];
+            }
+        }
+        if (ClassDepth < MaxInlineDepth)
+        {
+            AncestorChain[ClassDepth] = this;
+        }
     }
+    UClass(const UClass&) = delete;
+    UClass& operator=(const UClass&) = delete;
+
     bool IsChildOf(const UClass* Base) const noexcept
     {
         if (!Base) return false;
+        if (Base->ClassDepth < MaxInlineDepth)
+        {
+            return Base->ClassDepth <= ClassDepth && AncestorChain[Base->ClassDepth] == Base;
+        }
+        // MaxInlineDepth보다 깊은 계층만 Super 체인을 따라감
         for (auto c = this; c; c = c->Super)
             if (c == Base) return true;
         return false;
@@ -48,31 +76,62 @@ struct UClass
         return AllClasses;
     }
 
+    // 이름 -> UClass 해시 테이블 (Name은 정적 문자열 리터럴이므로 string_view 키가 안전)
+    static TMap<std::string_view, UClass*>& GetClassNameMap()
+    {
+        static TMap<std::string_view, UClass*> ClassNameMap;
+        return ClassNameMap;
+    }
+
+    // FName 원문 인덱스 -> UClass (대소문자 구분, 문자열 변환/해싱 없이 정수 키로 조회)
+    static TMap<uint32, UClass*>& GetClassFNameMap()
+    {
+        static TMap<uint32, UClass*> ClassFNameMap;
+        return ClassFNameMap;
+    }
+
     static void SignUpClass(UClass* InClass)
     {
         if (InClass)
         {
             GetAllClasses().emplace_back(InClass);
+            if (InClass->Name)
+            {
+                GetClassNameMap().emplace(std::string_view(InClass->Name), InClass);
+                InClass->ClassFName = FName(InClass->Name);
+                GetClassFNameMap().emplace(InClass->ClassFName.DisplayIndex, InClass);
+            }
         }
     }
     // const char* 버전 (기본)
     static UClass* FindClass(const char* InClassName)
     {
-        for (UClass* Class : GetAllClasses())
+        if (!InClassName)
         {
-            if (Class && Class->Name && strcmp(Class->Name, InClassName) == 0)
-            {
-                return Class;
-            }
+            return nullptr;
         }
+        return FindClass(std::string_view(InClassName));
+    }
 
-        return nullptr;
+    static UClass* FindClass(std::string_view InClassName)
+    {
+        const TMap<std::string_view, UClass*>& ClassNameMap = GetClassNameMap();
+        auto It = ClassNameMap.find(InClassName);
+        return It != ClassNameMap.end() ? It->second : nullptr;
     }
 
-    // FName 버전 (호환성 유지)
+    // FString 버전 (임시 FName 생성 없이 바로 조회)
+    static UClass* FindClass(const FString& InClassName)
+    {
+        return FindClass(std::string_view(InClassName));
+    }
+
+    // FName 버전 (원문 인덱스로 바로 조회)
     static UClass* FindClass(const FName& InClassName)
     {
-        return FindClass(InClassName.ToString().c_str());
+        const TMap<uint32, UClass*>& ClassFNameMap = GetClassFNameMap();
+        auto It = ClassFNameMap.find(InClassName.DisplayIndex);
+        return It != ClassFNameMap.end() ? It->second : nullptr;
     }
 
     // 리플렉션 시스템 메서드
@@ -326,6 +385,11 @@ public:
     // UUID 발급기: 현재 카운터를 반환하고 1 증가
     static uint32 GenerateUUID() { return GUUIDCounter++; }
 
+    // 쿠킹 레벨 로드 중이면 true: 고정 크기 프로퍼티와 컴포넌트 구성은 쿠킹 레코드에서 이미 채워졌으므로
+    // Serialize(true, ...)는 나머지(가변 길이 프로퍼티, 클래스별 후처리)만 수행 (FCookedLoadScope가 설정)
+    static bool IsLoadingCooked() { return bLoadingCooked; }
+    static void SetLoadingCooked(bool bInLoadingCooked) { bLoadingCooked = bInLoadingCooked; }
+
     // ───── 복사 관련 ────────────────────────────
     virtual void DuplicateSubObjects(); // Super::DuplicateSubObjects() 호출 -> 얕은 복사한 멤버들에 대해 메뉴얼하게 깊은 복사 수행(특히, Uobject 계열 멤버들에 대해서는 Duplicate() 호출)
     virtual UObject* Duplicate() const; // 자기 자신 깊은 복사(+모든 멤버들 얕은 복사) -> DuplicateSubObjects 호출
@@ -334,6 +398,8 @@ public:
 private:
     // 전역 UUID 카운터(초기값 1)
     inline static uint32 GUUIDCounter = 1;
+
+    inline static bool bLoadingCooked = false;
 };
 
 // ── Cast 헬퍼 (UE Cast<> 와 동일 UX) ────────────────────────────
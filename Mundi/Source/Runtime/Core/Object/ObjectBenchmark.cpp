@@ -0,0 +1,139 @@
+#include "pch.h"
+#include "ObjectBenchmark.h"
+#include "ObjectIterator.h"
+#include "BodySetup.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+
+namespace
+{
+	// 생성자에 부수 효과가 없는 가벼운 UObject
+	using FBenchmarkObject = UBodySetup;
+
+	double ElapsedMS(uint64 StartCycles)
+	{
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	void RunChurn(uint32 NumObjects, uint32 NumRounds)
+	{
+		const int32 StartSlots = GUObjectArray.Num();
+		TArray<UObject*> Objects;
+		Objects.resize(NumObjects);
+
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (uint32 Round = 0; Round < NumRounds; ++Round)
+		{
+			for (uint32 i = 0; i < NumObjects; ++i)
+			{
+				Objects[i] = NewObject<FBenchmarkObject>();
+			}
+			for (uint32 i = 0; i < NumObjects; ++i)
+			{
+				DeleteObject(Objects[i]);
+			}
+		}
+		const double MS = ElapsedMS(Start);
+
+		UE_LOG("[ObjectBenchmark] Churn %u x %u: %.2f ms (%.1f ns/op), slots %d -> %d, free %d",
+			NumObjects, NumRounds, MS, MS * 1.0e6 / (static_cast<double>(NumObjects) * NumRounds * 2),
+			StartSlots, GUObjectArray.Num(), ObjectFactory::GetFreeSlotCount());
+	}
+
+	void RunInterleaved(uint32 LiveSetSize, uint32 NumOperations)
+	{
+		FBenchmarkRandom Random(0xC0FFEEu);
+
+		TArray<UObject*> LiveSet;
+		LiveSet.resize(LiveSetSize);
+		for (uint32 i = 0; i < LiveSetSize; ++i)
+		{
+			LiveSet[i] = NewObject<FBenchmarkObject>();
+		}
+		const int32 SlotsAfterSpawn = GUObjectArray.Num();
+
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (uint32 Op = 0; Op < NumOperations; ++Op)
+		{
+			const uint32 Slot = Random.Next() % LiveSetSize;
+			DeleteObject(LiveSet[Slot]);
+			LiveSet[Slot] = NewObject<FBenchmarkObject>();
+		}
+		const double MS = ElapsedMS(Start);
+
+		UE_LOG("[ObjectBenchmark] Interleaved %u live / %u ops: %.2f ms (%.1f ns/op), slots %d -> %d",
+			LiveSetSize, NumOperations, MS, MS * 1.0e6 / (static_cast<double>(NumOperations) * 2),
+			SlotsAfterSpawn, GUObjectArray.Num());
+
+		// 이터레이터: 벤치마크 객체만 모아둔 목록 vs 전체 배열 스캔 (도입 전 방식)
+		uint32 Visited = 0;
+		const uint64 IterStart = FPlatformTime::Cycles64();
+		for (TObjectIterator<FBenchmarkObject> It; It; ++It)
+		{
+			++Visited;
+		}
+		const double IterMS = ElapsedMS(IterStart);
+
+		uint32 Scanned = 0;
+		const uint64 ScanStart = FPlatformTime::Cycles64();
+		for (UObject* Object : GUObjectArray)
+		{
+			if (Object && Object->IsA<FBenchmarkObject>())
+			{
+				++Scanned;
+			}
+		}
+		const double ScanMS = ElapsedMS(ScanStart);
+
+		UE_LOG("[ObjectBenchmark] Iterate %u objects: class list %.3f ms, full scan %.3f ms (%d slots, %u found)",
+			Visited, IterMS, ScanMS, GUObjectArray.Num(), Scanned);
+
+		// 약참조: 절반을 삭제한 뒤 전부 검증
+		TArray<TWeakObjectPtr<UObject>> WeakRefs;
+		WeakRefs.reserve(LiveSetSize);
+		for (UObject* Object : LiveSet)
+		{
+			WeakRefs.Add(TWeakObjectPtr<UObject>(Object));
+		}
+		for (uint32 i = 0; i < LiveSetSize; i += 2)
+		{
+			DeleteObject(LiveSet[i]);
+			LiveSet[i] = nullptr;
+		}
+		// 비워진 슬롯을 새 객체가 다시 차지해도 옛 약참조는 무효여야 함
+		for (uint32 i = 0; i < LiveSetSize; i += 2)
+		{
+			LiveSet[i] = NewObject<FBenchmarkObject>();
+		}
+
+		uint32 ValidCount = 0;
+		const uint64 WeakStart = FPlatformTime::Cycles64();
+		for (const TWeakObjectPtr<UObject>& Weak : WeakRefs)
+		{
+			if (Weak.IsValid())
+			{
+				++ValidCount;
+			}
+		}
+		const double WeakMS = ElapsedMS(WeakStart);
+
+		UE_LOG("[ObjectBenchmark] Weak %u refs: %.3f ms, %u valid (expected %u)",
+			LiveSetSize, WeakMS, ValidCount, LiveSetSize / 2);
+
+		for (UObject* Object : LiveSet)
+		{
+			DeleteObject(Object);
+		}
+	}
+}
+
+void FObjectBenchmark::RunAndLog()
+{
+	RunChurn(10000, 20);
+	RunInterleaved(20000, 200000);
+	UE_LOG("[ObjectBenchmark] Done: slots %d, free %d", GUObjectArray.Num(), ObjectFactory::GetFreeSlotCount());
+}
+
+static const bool bObjectBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"OBJECT BENCH", "-objectbench", "object array benchmark (spawn/destroy churn)", EBenchmarkStage::None,
+	[](const FString&) { FObjectBenchmark::RunAndLog(); } });
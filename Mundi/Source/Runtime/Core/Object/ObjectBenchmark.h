@@ -0,0 +1,16 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 오브젝트 배열 벤치마크 (콘솔 OBJECT BENCH 명령)
+ *
+ * - Churn: 같은 수의 객체를 반복 생성/삭제 (GUObjectArray가 자라지 않고 슬롯을 재사용하는지 확인)
+ * - Interleaved: 살아있는 집합에서 무작위로 삭제/생성 (장시간 플레이의 스폰 패턴)
+ * - Iterate: TObjectIterator(클래스별 목록)와 GUObjectArray 전체 스캔 비교
+ * - Weak: TWeakObjectPtr 검증 비용과 삭제 감지
+ */
+class FObjectBenchmark
+{
+public:
+	static void RunAndLog();
+};
@@ -2,6 +2,115 @@
 #include "ObjectFactory.h"
 // 전역 오브젝트 배열 정의 (한 번만!)
 TArray<UObject*> GUObjectArray;
+TArray<uint32> GUObjectGenerations;
+TArray<FUObjectClassList> GUObjectClassLists;
+
+namespace
+{
+    // 재사용 대기 중인 빈 슬롯 (LIFO: 최근에 비워진 슬롯이 캐시에 남아 있을 확률이 높음)
+    TArray<int32> GFreeSlots;
+
+    // 슬롯별로 GUObjectClassLists[Class->ObjectListIndex].Objects 안의 위치 (O(1) 제거용)
+    TArray<int32> GClassListPositions;
+
+    // 관리 중인 객체 집합: DeleteObject가 포인터를 역참조하기 전에 소유 여부를 확인
+    TSet<const UObject*> GLiveObjects;
+
+    // GetClassListIndices 캐시. 클래스 목록은 뒤에 추가만 되므로 새로 생긴 목록만 검사해 덧붙임
+    struct FClassListCache
+    {
+        int32 NumScannedLists = 0;
+        TArray<int32> ListIndices;
+    };
+
+    int32 AcquireSlot(UObject* Obj)
+    {
+        int32 Index;
+        if (!GFreeSlots.IsEmpty())
+        {
+            Index = GFreeSlots.back();
+            GFreeSlots.pop_back();
+            GUObjectArray[Index] = Obj;
+        }
+        else
+        {
+            Index = GUObjectArray.Add(Obj);
+            if (Index >= GUObjectGenerations.Num())
+            {
+                // 새 슬롯은 세대 1부터 (기본 생성된 약참조의 세대 0과 구분)
+                GUObjectGenerations.Add(1);
+            }
+            GClassListPositions.Add(-1);
+        }
+        return Index;
+    }
+
+    void ReleaseSlot(int32 Index)
+    {
+        GUObjectArray[Index] = nullptr;
+        GClassListPositions[Index] = -1;
+        ++GUObjectGenerations[Index];
+
+        // 0번 슬롯은 피킹 ID에서 '없음'으로 쓰이므로 재사용하지 않음
+        if (Index != 0)
+        {
+            GFreeSlots.Add(Index);
+        }
+    }
+
+    void AddToClassList(UObject* Obj)
+    {
+        UClass* Class = Obj->GetClass();
+        if (Class->ObjectListIndex < 0)
+        {
+            Class->ObjectListIndex = GUObjectClassLists.Emplace();
+            GUObjectClassLists[Class->ObjectListIndex].Class = Class;
+        }
+
+        TArray<UObject*>& Objects = GUObjectClassLists[Class->ObjectListIndex].Objects;
+        GClassListPositions[Obj->InternalIndex] = Objects.Add(Obj);
+    }
+
+    void RemoveFromClassList(UObject* Obj)
+    {
+        const int32 Position = GClassListPositions[Obj->InternalIndex];
+        const int32 ListIndex = Obj->GetClass()->ObjectListIndex;
+        if (Position < 0 || ListIndex < 0)
+        {
+            return;
+        }
+
+        // 마지막 원소를 빈 자리로 옮겨 O(1) 제거
+        TArray<UObject*>& Objects = GUObjectClassLists[ListIndex].Objects;
+        UObject* Last = Objects.back();
+        Objects[Position] = Last;
+        GClassListPositions[Last->InternalIndex] = Position;
+        Objects.pop_back();
+    }
+
+    void RegisterObject(UObject* Obj)
+    {
+        Obj->InternalIndex = static_cast<uint32>(AcquireSlot(Obj));
+        AddToClassList(Obj);
+        GLiveObjects.insert(Obj);
+    }
+
+    // 클래스별 이름 번호 ("Class_N")
+    void AssignUniqueName(UObject* Obj, UClass* Class)
+    {
+        static TMap<UClass*, int> NameCounters;
+        int Count = ++NameCounters[Class];
+
+        const std::string base = Class->Name; // FName -> string
+        std::string unique;
+        unique.reserve(base.size() + 1 + 12);            // "_" + 최대 10~12자리 여유
+        unique.append(base);
+        unique.push_back('_');
+        unique.append(std::to_string(Count));
+
+        Obj->ObjectName = FName(unique);
+    }
+}
 
 namespace ObjectFactory
 {
@@ -29,25 +138,42 @@ namespace ObjectFactory
         UObject* Obj = ConstructObject(Class);
         if (!Obj) return nullptr;
 
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
+        // 배열에 등록: 빈 슬롯 재사용
+        RegisterObject(Obj);
+        AssignUniqueName(Obj, Class);
 
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        return Obj;
+    }
 
-        static TMap<UClass*, int> NameCounters;
-        int Count = ++NameCounters[Class];
+    void NewObjects(UClass* Class, int32 Count, TArray<UObject*>& OutObjects)
+    {
+        auto& reg = GetRegistry();
+        auto it = reg.find(Class);
+        if (it == reg.end() || Count <= 0) return;
+        const ConstructFunc& Construct = it->second;
 
-        const std::string base = Class->Name; // FName -> string
-        std::string unique;
-        unique.reserve(base.size() + 1 + 12);            // "_" + 최대 10~12자리 여유
-        unique.append(base);
-        unique.push_back('_');
-        unique.append(std::to_string(Count));
+        // 빈 슬롯으로 채울 수 없는 만큼만 전역 배열 확장
+        const int32 NewSlots = std::max(0, Count - GFreeSlots.Num());
+        GUObjectArray.Reserve(GUObjectArray.Num() + NewSlots);
+        GUObjectGenerations.Reserve(GUObjectGenerations.Num() + NewSlots);
+        GClassListPositions.Reserve(GClassListPositions.Num() + NewSlots);
+        GLiveObjects.reserve(GLiveObjects.size() + Count);
+        if (Class->ObjectListIndex >= 0)
+        {
+            TArray<UObject*>& ClassObjects = GUObjectClassLists[Class->ObjectListIndex].Objects;
+            ClassObjects.Reserve(ClassObjects.Num() + Count);
+        }
+        OutObjects.Reserve(OutObjects.Num() + Count);
 
-        Obj->ObjectName = FName(unique);
+        for (int32 i = 0; i < Count; ++i)
+        {
+            UObject* Obj = Construct();
+            if (!Obj) continue;
 
-        return Obj;
+            RegisterObject(Obj);
+            AssignUniqueName(Obj, Class);
+            OutObjects.Add(Obj);
+        }
     }
 
     UObject* AddToGUObjectArray(UClass* Class, UObject* Obj)
@@ -55,11 +181,7 @@ namespace ObjectFactory
         if (!Obj) return nullptr;
 
         // 배열에 등록: 빈 슬롯 재사용
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-        //}
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        RegisterObject(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -81,24 +203,18 @@ namespace ObjectFactory
     {
         if (!Obj) return;
 
-        // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
-        int32 foundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
-        {
-            if (GUObjectArray[i] == Obj)
-            {
-                foundIndex = i;
-                break;
-            }
-        }
-        if (foundIndex < 0)
+        // Important: DO NOT dereference Obj fields before verifying it is still managed.
+        auto It = GLiveObjects.find(Obj);
+        if (It == GLiveObjects.end())
         {
             // Not managed or already deleted.
             return;
         }
+        GLiveObjects.erase(It);
 
-        GUObjectArray[foundIndex] = nullptr;
-        // Safe to delete now; Obj still valid since we found it in GUObjectArray
+        // Safe to dereference now; Obj is still alive since it was in the live set
+        RemoveFromClassList(Obj);
+        ReleaseSlot(static_cast<int32>(Obj->InternalIndex));
         Obj->DestroyInternal();
     }
 
@@ -114,26 +230,60 @@ namespace ObjectFactory
         }
         GUObjectArray.Empty();
         GUObjectArray.Shrink();
+        GClassListPositions.Empty();
+        GFreeSlots.Empty();
+        // 세대 번호는 유지: 남아 있는 약참조가 다시 채워진 슬롯을 가리키지 않도록
     }
 
-    // (선택) null 슬롯 압축
     void CompactNullSlots()
     {
-        int32 write = 0;
-        for (int32 read = 0; read < GUObjectArray.Num(); ++read)
+        // 객체를 옮기면 InternalIndex(피킹 ID, 약참조)가 깨지므로 끝쪽 빈 슬롯만 잘라냄
+        int32 NewNum = GUObjectArray.Num();
+        while (NewNum > 0 && GUObjectArray[NewNum - 1] == nullptr)
+        {
+            --NewNum;
+        }
+        if (NewNum == GUObjectArray.Num())
+        {
+            return;
+        }
+
+        GUObjectArray.SetNum(NewNum);
+        GClassListPositions.SetNum(NewNum);
+        GFreeSlots.erase(
+            std::remove_if(GFreeSlots.begin(), GFreeSlots.end(), [NewNum](int32 Index) { return Index >= NewNum; }),
+            GFreeSlots.end());
+    }
+
+    int32 GetFreeSlotCount()
+    {
+        return GFreeSlots.Num();
+    }
+
+    bool IsLiveObject(const UObject* Obj)
+    {
+        return Obj && GLiveObjects.find(Obj) != GLiveObjects.end();
+    }
+
+    const TArray<int32>& GetClassListIndices(const UClass* Base)
+    {
+        // 반환한 참조가 다른 클래스의 캐시 추가(테이블 재해시)에도 유효하도록 항목은 개별 할당하고 해제하지 않음
+        static TMap<const UClass*, FClassListCache*> Cache;
+
+        FClassListCache*& Entry = Cache[Base];
+        if (!Entry)
+        {
+            Entry = new FClassListCache();
+        }
+
+        // 기존 항목은 건드리지 않고 덧붙이기만 하므로 순회 중인 반복자가 보는 앞부분은 그대로 유지됨
+        for (; Entry->NumScannedLists < GUObjectClassLists.Num(); ++Entry->NumScannedLists)
         {
-            if (UObject* Obj = GUObjectArray[read])
+            if (GUObjectClassLists[Entry->NumScannedLists].Class->IsChildOf(Base))
             {
-                if (write != read)
-                {
-                    GUObjectArray[write] = Obj;
-                    Obj->InternalIndex = static_cast<uint32>(write);
-                    GUObjectArray[read] = nullptr;
-                }
-                ++write;
+                Entry->ListIndices.Add(Entry->NumScannedLists);
             }
         }
-        // 크기(Num) 축소 + 불필요한 capacity도 반환
-        GUObjectArray.SetNum(write);
+        return Entry->ListIndices;
     }
 }
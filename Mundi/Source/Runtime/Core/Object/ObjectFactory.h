@@ -5,8 +5,21 @@
 // ── 외부 심볼 ─────────────────────────────────────────────
 class UObject;
 struct UClass;
+
+// 전역 오브젝트 배열: 삭제된 슬롯은 nullptr로 비워지고 프리 리스트로 재사용됨
 extern TArray<UObject*> GUObjectArray;
 
+// 슬롯별 세대 번호: 슬롯이 비워질 때마다 증가 (GUObjectArray보다 길 수 있음)
+extern TArray<uint32> GUObjectGenerations;
+
+// 정확히 같은 클래스의 인스턴스 목록 (TObjectIterator가 해당 클래스 계열만 순회)
+struct FUObjectClassList
+{
+    UClass* Class = nullptr;
+    TArray<UObject*> Objects;
+};
+extern TArray<FUObjectClassList> GUObjectClassLists;
+
 // ── ObjectFactory 네임스페이스 ─────────────────────────────
 namespace ObjectFactory
 {
@@ -34,6 +47,9 @@ namespace ObjectFactory
     // 4) GUObjectArray 자동 등록
     UObject* AddToGUObjectArray(UClass* Class, UObject* Obj);
 
+    // 생성 + 등록을 Count개 일괄 수행 (레지스트리 조회/배열 확장은 한 번만, 레벨 로드용)
+    void NewObjects(UClass* Class, int32 Count, TArray<UObject*>& OutObjects);
+
     // 5) 복사생성자 호출 + GUObjectArray 자동 등록
     template<class T>
     inline T* DuplicateObject(const UObject* Source)
@@ -46,10 +62,32 @@ namespace ObjectFactory
     void DeleteObject(UObject* Obj);
     // 종료시 일괄 정리
     void DeleteAll(bool bCallBeginDestroy = true);
-    // Null 슬롯 압축하여 배열 크기 축소
+    // 배열 끝의 빈 슬롯만 잘라내 크기 축소 (살아있는 객체의 인덱스는 바뀌지 않음)
     void CompactNullSlots();
+
+    // 재사용 대기 중인 빈 슬롯 수
+    int32 GetFreeSlotCount();
+
+    // 관리 중인(삭제되지 않은) 객체인지 검사 (Obj를 역참조하지 않음)
+    bool IsLiveObject(const UObject* Obj);
+
+    // 인덱스 + 세대로 객체 조회: 슬롯이 비워졌거나 재사용되었으면 nullptr (O(1))
+    inline UObject* ResolveObjectHandle(uint32 Index, uint32 Generation)
+    {
+        if (Index >= static_cast<uint32>(GUObjectArray.Num()) || GUObjectGenerations[Index] != Generation)
+        {
+            return nullptr;
+        }
+        return GUObjectArray[Index];
+    }
+
+    // Base 클래스(자식 포함)에 해당하는 GUObjectClassLists 인덱스 목록
+    // 프로그램 종료까지 유효한 캐시 참조. 클래스 목록이 늘면 뒤에 덧붙기만 함 (다음 호출 때 갱신)
+    const TArray<int32>& GetClassListIndices(const UClass* Base);
 }
 
+#include "WeakObjectPtr.h"
+
 // ── 등록 매크로 ─────────────────────────────────────────────
 #define IMPLEMENT_CLASS(ThisClass)                                            \
     namespace {                                                               \
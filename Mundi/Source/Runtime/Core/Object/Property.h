@@ -34,6 +34,33 @@ enum class EPropertyType : uint8
 	Count			// 요소 개수, 항상 마지막!
 };
 
+// 쿠킹 레벨 레코드에 고정 크기로 기록되는 프로퍼티 타입
+// (가변 길이인 Array/Map/Struct 등은 쿠킹 후에도 UObject::Serialize의 JSON 경로로 로드)
+inline bool IsFixedLayoutPropertyType(EPropertyType Type)
+{
+	switch (Type)
+	{
+	case EPropertyType::Bool:
+	case EPropertyType::Int32:
+	case EPropertyType::Enum:
+	case EPropertyType::Float:
+	case EPropertyType::FVector:
+	case EPropertyType::FLinearColor:
+	case EPropertyType::Curve:
+	case EPropertyType::FString:
+	case EPropertyType::ScriptFile:
+	case EPropertyType::FName:
+	case EPropertyType::Texture:
+	case EPropertyType::StaticMesh:
+	case EPropertyType::SkeletalMesh:
+	case EPropertyType::Material:
+	case EPropertyType::ParticleSystem:
+		return true;
+	default:
+		return false;
+	}
+}
+
 // 프로퍼티 소유자 종류
 enum class EOwnerKind : uint8
 {
@@ -0,0 +1,61 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief GUObjectArray 슬롯 인덱스 + 세대 번호로 객체를 가리키는 약참조
+ *
+ * - 객체가 삭제되면 슬롯 세대가 증가하므로 Get()이 nullptr을 반환 (O(1) 검증)
+ * - 같은 슬롯/주소가 새 객체에 재사용되어도 세대가 달라 옛 참조로는 접근 불가
+ * - GUObjectArray에 등록되지 않은 객체(InternalIndex 없음)는 처음부터 무효
+ *
+ * ObjectFactory.h 끝에서 포함됩니다 (GUObjectArray 선언 이후).
+ */
+template<typename T>
+class TWeakObjectPtr
+{
+public:
+    using ElementType = T;
+
+    TWeakObjectPtr() = default;
+    TWeakObjectPtr(std::nullptr_t) {}
+    explicit TWeakObjectPtr(T* InPtr) { Reset(InPtr); }
+
+    void Reset(T* InPtr = nullptr)
+    {
+        ObjectIndex = UINT32_MAX;
+        ObjectGeneration = 0;
+        if (InPtr && InPtr->InternalIndex < static_cast<uint32>(GUObjectGenerations.Num()))
+        {
+            ObjectIndex = InPtr->InternalIndex;
+            ObjectGeneration = GUObjectGenerations[ObjectIndex];
+        }
+    }
+
+    bool IsValid() const { return Get() != nullptr; }
+    T* Get() const { return static_cast<T*>(ObjectFactory::ResolveObjectHandle(ObjectIndex, ObjectGeneration)); }
+
+    T& operator*() const { return *Get(); }
+    T* operator->() const { return Get(); }
+
+    uint32 GetObjectIndex() const { return ObjectIndex; }
+    uint32 GetObjectGeneration() const { return ObjectGeneration; }
+
+    // 같은 객체를 가리켰던 참조끼리는 객체가 삭제된 뒤에도 같음 (맵 키로 사용 가능)
+    bool operator==(const TWeakObjectPtr& Other) const { return ObjectIndex == Other.ObjectIndex && ObjectGeneration == Other.ObjectGeneration; }
+    bool operator!=(const TWeakObjectPtr& Other) const { return !(*this == Other); }
+
+private:
+    uint32 ObjectIndex = UINT32_MAX;
+    uint32 ObjectGeneration = 0;
+};
+
+namespace std {
+    template <typename T>
+    struct hash<TWeakObjectPtr<T>>
+    {
+        size_t operator()(const TWeakObjectPtr<T>& Key) const noexcept
+        {
+            return hash<uint64>()((static_cast<uint64>(Key.GetObjectGeneration()) << 32) | Key.GetObjectIndex());
+        }
+    };
+}
@@ -68,15 +68,45 @@ void UAnimSingleNodeInstance::NativeUpdateAnimation(float DeltaTime)
 
     // Notify Trigger Logic
     const float CurrentTime = GetPosition();
-    float PrevTime = PreviousPosition;
+    const float PrevTime = PreviousPosition;
 
-    if (CurrentTime < PrevTime)
-    {
-        PrevTime = 0.f;
-    }
     if (bPlaying)
     {
-        TriggerAnimNotifies(PrevTime, CurrentTime);
+        UAnimSequenceBase* Seq = Player.GetSequence();
+        const float Length = Seq ? Seq->GetPlayLength() : 0.f;
+        const FAnimExtractContext& ExtractCtx = Player.GetExtractContext();
+        const float Move = DeltaTime * ExtractCtx.PlayRate;
+
+        // 루프 경계를 넘은 횟수. 업데이트 빈도 최적화로 건너뛴 프레임의 DeltaTime이 한 번에 들어오면
+        // 시퀀스 길이보다 길어져 여러 번 넘을 수 있음
+        // 누적 시간을 한 루프로 자르지 않고 통째로 지나간 루프마다 모든 노티파이를 한 번씩 발생시켜
+        // 매 프레임 갱신한 컴포넌트와 같은 횟수가 되도록 함 (발자국/사운드 카운트가 빈도에 따라 달라지지 않음)
+        int32 NumWraps = 0;
+        if (ExtractCtx.bLooping && Length > 0.f && Move > 0.f)
+        {
+            NumWraps = static_cast<int32>(std::floor((PrevTime + Move) / Length));
+            if (NumWraps == 0 && CurrentTime < PrevTime)
+            {
+                // SetPosition 등으로 이전 위치가 재생 위치와 어긋난 경우에도 한 번 넘은 것으로 처리
+                NumWraps = 1;
+            }
+        }
+
+        if (NumWraps <= 0)
+        {
+            // 루프 없음, 역재생, 경계를 넘지 않은 경우는 (PrevTime, CurrentTime] 구간만
+            TriggerAnimNotifies(PrevTime, CurrentTime);
+        }
+        else
+        {
+            // (PrevTime, Length] + 중간의 전체 루프 (NumWraps - 1)번 + [0, CurrentTime]
+            TriggerAnimNotifies(PrevTime, Length);
+            for (int32 Wrap = 1; Wrap < NumWraps; ++Wrap)
+            {
+                TriggerAnimNotifies(-1.f, Length);
+            }
+            TriggerAnimNotifies(-1.f, CurrentTime);
+        }
     }
     PreviousPosition = CurrentTime;
 }
@@ -0,0 +1,63 @@
+#include "pch.h"
+#include "AnimUpdateRate.h"
+
+FAnimUpdateRateParameters::FAnimUpdateRateParameters()
+{
+    // 기본 LOD 테이블 (거리 오름차순)
+    LODs.Add({ 0.f,   1, -1 });
+    LODs.Add({ 15.f,  2, -1 });
+    LODs.Add({ 40.f,  4, 6 });
+    LODs.Add({ 80.f,  8, 4 });
+}
+
+void FAnimUpdateRateParameters::Tick(float DeltaTime, float ViewDistance, int32 FramesSinceLastRender)
+{
+    AccumulatedDeltaTime += DeltaTime;
+    ++FramesSinceEvaluate;
+
+    // 1) 가시성: 오래 렌더링되지 않았으면 포즈 평가를 멈춤
+    bFrozen = FramesSinceLastRender >= InvisibleFreezeFrames;
+
+    // 2) 거리 기반 LOD 선택
+    CurrentLODIndex = 0;
+    for (int32 i = LODs.Num() - 1; i > 0; --i)
+    {
+        if (ViewDistance >= LODs[i].MinDistance)
+        {
+            CurrentLODIndex = i;
+            break;
+        }
+    }
+
+    const FAnimUpdateRateLOD& LOD = LODs.IsEmpty() ? FAnimUpdateRateLOD() : LODs[CurrentLODIndex];
+    CurrentUpdateRate = std::max(1, LOD.UpdateRate);
+    CurrentMaxBoneDepth = LOD.MaxBoneDepth;
+
+    // 3) 화면 밖이면 더 느린 빈도로 강등
+    if (bFrozen)
+    {
+        CurrentUpdateRate = std::max(CurrentUpdateRate, FrozenTickRate);
+    }
+    else if (FramesSinceLastRender > 1)
+    {
+        CurrentUpdateRate = std::max(CurrentUpdateRate, OffscreenUpdateRate);
+    }
+
+    bShouldEvaluate = FramesSinceEvaluate >= CurrentUpdateRate;
+}
+
+void FAnimUpdateRateParameters::OnEvaluated()
+{
+    AccumulatedDeltaTime = 0.f;
+    FramesSinceEvaluate = 0;
+}
+
+float FAnimUpdateRateParameters::GetInterpolationAlpha() const
+{
+    if (CurrentUpdateRate <= 1)
+    {
+        return 1.f;
+    }
+    // 평가 직후 프레임이 1/N, 다음 평가 직전 프레임이 1이 되도록 한 구간만큼 뒤따라감
+    return std::clamp(static_cast<float>(FramesSinceEvaluate + 1) / static_cast<float>(CurrentUpdateRate), 0.f, 1.f);
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+/**
+ * 거리 기반 애니메이션 LOD 한 단계의 설정
+ * - MinDistance 이상 떨어진 경우 이 단계가 적용됨
+ * - UpdateRate: N 프레임마다 한 번 포즈를 평가 (1 = 매 프레임)
+ * - MaxBoneDepth: 루트로부터의 깊이가 이 값을 넘는 본은 부모를 따라 강체로 움직임 (-1 = 제한 없음)
+ */
+struct FAnimUpdateRateLOD
+{
+    float MinDistance = 0.f;
+    int32 UpdateRate = 1;
+    int32 MaxBoneDepth = -1;
+};
+
+/**
+ * 스켈레탈 메시 컴포넌트별 애니메이션 업데이트 빈도 제어기
+ *
+ * 매 Tick마다 뷰 거리/가시성으로 LOD를 고르고, 이번 프레임에 포즈를 평가할지 결정한다.
+ * 건너뛴 프레임의 DeltaTime은 누적되었다가 다음 평가 시 한 번에 전달되므로
+ * 애니메이션 시간과 노티파이 구간이 유실되지 않는다.
+ */
+struct FAnimUpdateRateParameters
+{
+    FAnimUpdateRateParameters();
+
+    /**
+     * @brief 이번 프레임의 LOD와 평가 여부를 결정
+     * @param DeltaTime 이번 프레임의 DeltaTime (누적됨)
+     * @param ViewDistance 마지막 렌더링 시점의 뷰-컴포넌트 거리
+     * @param FramesSinceLastRender 마지막으로 렌더링된 이후 지난 프레임 수
+     */
+    void Tick(float DeltaTime, float ViewDistance, int32 FramesSinceLastRender);
+
+    /** 포즈를 평가한 뒤 호출: 누적 시간을 비우고 보간 구간을 새로 시작 */
+    void OnEvaluated();
+
+    bool ShouldEvaluate() const { return bShouldEvaluate; }
+    bool IsFrozen() const { return bFrozen; }
+    bool ShouldInterpolate() const { return bInterpolateSkippedFrames && CurrentUpdateRate > 1 && !bFrozen; }
+
+    /** 이전 표시 포즈 -> 최신 평가 포즈 보간 비율 (0, 1] */
+    float GetInterpolationAlpha() const;
+
+    float GetAccumulatedDeltaTime() const { return AccumulatedDeltaTime; }
+    int32 GetLODIndex() const { return CurrentLODIndex; }
+    int32 GetUpdateRate() const { return CurrentUpdateRate; }
+    int32 GetMaxBoneDepth() const { return CurrentMaxBoneDepth; }
+
+    /** 거리 오름차순 LOD 테이블. LODs[0]은 항상 전체 빈도여야 한다. */
+    TArray<FAnimUpdateRateLOD> LODs;
+
+    /** 이 프레임 수 이상 렌더링되지 않으면 포즈 평가를 완전히 멈춤 (시간/노티파이는 계속 진행) */
+    int32 InvisibleFreezeFrames = 30;
+
+    /** 화면 밖이지만 아직 얼지 않은 경우 적용할 업데이트 빈도 */
+    int32 OffscreenUpdateRate = 8;
+
+    /** 얼어 있는 동안 시간/노티파이를 진행시킬 빈도 */
+    int32 FrozenTickRate = 16;
+
+    bool bInterpolateSkippedFrames = true;
+
+private:
+    float AccumulatedDeltaTime = 0.f;
+    int32 FramesSinceEvaluate = 0;
+    int32 CurrentLODIndex = 0;
+    int32 CurrentUpdateRate = 1;
+    int32 CurrentMaxBoneDepth = -1;
+    bool bShouldEvaluate = true;
+    bool bFrozen = false;
+};
+
+/**
+ * 애니메이션 업데이트 빈도 최적화 통계 (프레임 단위)
+ */
+struct FAnimUpdateRateStats
+{
+    uint32 TickedComponents = 0;    // 애니메이션이 있는 컴포넌트 수
+    uint32 EvaluatedComponents = 0; // 이번 프레임에 포즈를 평가한 수
+    uint32 InterpolatedComponents = 0; // 보간만 수행한 수
+    uint32 FrozenComponents = 0;    // 평가를 멈춘 수
+    uint32 MaskedBones = 0;         // 본 마스크로 건너뛴 본 수
+
+    void Reset() { *this = FAnimUpdateRateStats(); }
+};
+
+class FAnimUpdateRateStatManager
+{
+public:
+    static FAnimUpdateRateStatManager& GetInstance()
+    {
+        static FAnimUpdateRateStatManager Instance;
+        return Instance;
+    }
+
+    void ResetFrameStats() { CurrentStats.Reset(); }
+    const FAnimUpdateRateStats& GetStats() const { return CurrentStats; }
+    FAnimUpdateRateStats& GetMutableStats() { return CurrentStats; }
+
+private:
+    FAnimUpdateRateStatManager() = default;
+    FAnimUpdateRateStatManager(const FAnimUpdateRateStatManager&) = delete;
+    FAnimUpdateRateStatManager& operator=(const FAnimUpdateRateStatManager&) = delete;
+
+    FAnimUpdateRateStats CurrentStats;
+};
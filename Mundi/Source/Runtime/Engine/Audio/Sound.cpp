@@ -39,7 +39,7 @@ bool USound::LoadWavFromFile(const FWideString& FilePath)
 
     bool haveFmt = false;
     bool haveData = false;
-    std::vector<uint8> dataChunk;
+    TTaggedArray<uint8> dataChunk;
 
     while (fs && (!haveFmt || !haveData))
     {
@@ -28,7 +28,7 @@ public:
 
 private:
     WAVEFORMATEX  WaveFormat{};      // format description (PCM only in MVP)
-    std::vector<uint8> PCMData;      // interleaved PCM16 samples
+    TTaggedArray<uint8> PCMData;     // interleaved PCM16 samples (Audio 태그로 집계)
     float         DurationSec = 0.0f;
     FWideString   SourcePath;
 };
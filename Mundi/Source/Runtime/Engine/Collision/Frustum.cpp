@@ -152,6 +152,44 @@ FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideA
     return Result;
 }
 
+// ------------------------------------------------------------
+// 뷰 * 투영 행렬에서 평면 추출 (Gribb/Hartmann)
+//  - 행벡터 규약이므로 Clip = (P, 1) * M, 클립 성분 k는 M의 k번째 열과의 내적
+//  - -w <= x <= w, -w <= y <= w, 0 <= z <= w 각각이 (a, b, c, d)·(P, 1) >= 0 형태의 평면
+//  - 평면 식 dot(N, X) - D 규약에 맞추기 위해 D = -d, 길이로 나눠 정규화
+// ------------------------------------------------------------
+namespace
+{
+    FPlane MakePlaneFromClipColumns(const FMatrix& M, int ColumnA, float SignA, int ColumnB, float SignB)
+    {
+        float Plane[4];
+        for (int Row = 0; Row < 4; ++Row)
+        {
+            Plane[Row] = M.M[Row][ColumnA] * SignA + (ColumnB >= 0 ? M.M[Row][ColumnB] * SignB : 0.0f);
+        }
+
+        const float Length = std::sqrt(Plane[0] * Plane[0] + Plane[1] * Plane[1] + Plane[2] * Plane[2]);
+        const float InvLength = Length > 0.0f ? 1.0f / Length : 0.0f;
+        return FPlane
+        {
+            FVector4(Plane[0] * InvLength, Plane[1] * InvLength, Plane[2] * InvLength, 0.0f),
+            -Plane[3] * InvLength
+        };
+    }
+}
+
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection)
+{
+    FFrustum Result;
+    Result.LeftFace = MakePlaneFromClipColumns(ViewProjection, 3, 1.0f, 0, 1.0f);     // w + x >= 0
+    Result.RightFace = MakePlaneFromClipColumns(ViewProjection, 3, 1.0f, 0, -1.0f);   // w - x >= 0
+    Result.BottomFace = MakePlaneFromClipColumns(ViewProjection, 3, 1.0f, 1, 1.0f);   // w + y >= 0
+    Result.TopFace = MakePlaneFromClipColumns(ViewProjection, 3, 1.0f, 1, -1.0f);     // w - y >= 0
+    Result.NearFace = MakePlaneFromClipColumns(ViewProjection, 2, 1.0f, -1, 0.0f);    // z >= 0
+    Result.FarFace = MakePlaneFromClipColumns(ViewProjection, 3, 1.0f, 2, -1.0f);     // w - z >= 0
+    return Result;
+}
+
 // ------------------------------------------------------------
 // AABB vs 프러스텀 판정
 //  - 각 평면에 대해: 중심의 부호 + 박스의 "프로젝션 반경"으로 배제 테스트
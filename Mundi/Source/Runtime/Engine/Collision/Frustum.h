@@ -26,6 +26,8 @@ struct FFrustum
 };
 
 FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideAspect = -1.0f);
+// 뷰 * 투영 행렬(행벡터 규약, D3D 클립 공간 0 <= z <= w)에서 6평면 추출. 원근/직교 모두 가능
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection);
 bool IsAABBVisible(const FFrustum& Frustum, const FAABB& Bound);
 bool IsAABBIntersects(const FFrustum& Frustum, const FAABB& Bound);
 
@@ -297,6 +297,7 @@ UBodySetup* UBoxComponent::GetDefaultBodySetup() const
 	static UBodySetup* DefaultSetup = nullptr;
 	if (!DefaultSetup)
 	{
+		FScopedMemoryTag MemTag(EMemoryTag::Physics);
 		DefaultSetup = ObjectFactory::NewObject<UBodySetup>();
 		DefaultSetup->BodyType = EBodySetupType::Box;
 		DefaultSetup->BoxExtent = UBodySetup::DefaultBoxExtent;
@@ -66,6 +66,8 @@ public:
     {
         return ViewGizmo;
     }
+    // 에디터 전용 카메라 모양 메시 (PIE/게임 월드에서는 nullptr)
+    class UStaticMeshComponent* GetCameraGizmo() const { return CameraGizmo; }
     // Directions in world space
     FVector GetForward() const;
     FVector GetRight() const;
@@ -475,6 +475,7 @@ UBodySetup* UCapsuleComponent::GetDefaultBodySetup() const
 	static UBodySetup* DefaultSetup = nullptr;
 	if (!DefaultSetup)
 	{
+		FScopedMemoryTag MemTag(EMemoryTag::Physics);
 		DefaultSetup = ObjectFactory::NewObject<UBodySetup>();
 		DefaultSetup->BodyType = EBodySetupType::Capsule;
 		DefaultSetup->SphereRadius = UBodySetup::DefaultCapsuleRadius;
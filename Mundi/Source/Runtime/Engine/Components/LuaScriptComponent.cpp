@@ -8,6 +8,7 @@
 #include "CameraActor.h"
 #include "LuaManager.h"
 #include "GameObject.h"
+#include "PlatformTime.h"
 
 // for test
 #include "PlayerCameraManager.h"
@@ -17,6 +18,8 @@
 //	ADD_PROPERTY_SCRIPT(FString, ScriptFilePath, "Script", ".lua", true, "Lua Script 파일 경로")
 //END_PROPERTIES()
 
+DECLARE_CYCLE_STAT(LuaScriptTick, "Lua")
+
 ULuaScriptComponent::ULuaScriptComponent()
 {
 	bCanEverTick = true;	// tick 지원 여부
@@ -46,6 +49,7 @@ void ULuaScriptComponent::BeginPlay()
 
 	auto LuaVM = GetWorld()->GetLuaManager();
 	Lua  = &(LuaVM->GetState());
+	LuaManager = LuaVM;
 
 	// 독립된 환경 생성, Engine Object&Util 주입
 	Env = LuaVM->CreateEnvironment();
@@ -85,6 +89,9 @@ void ULuaScriptComponent::BeginPlay()
 	FuncOnEndOverlap = FLuaManager::GetFunc(Env, "OnEndOverlap");
 	FuncOnHit = FLuaManager::GetFunc(Env, "OnHit");
 	FuncEndPlay		  =	FLuaManager::GetFunc(Env, "EndPlay");
+
+	// Tick 시간 집계 + 배치 모드 디스패치 대상
+	TickSlot = LuaVM->RegisterScriptTick(this, FuncTick, ScriptFilePath);
 	
 	if (FuncBeginPlay.valid()) {
 		auto Result = FuncBeginPlay();
@@ -177,8 +184,23 @@ void ULuaScriptComponent::OnHit(UPrimitiveComponent* HitComp, AActor* OtherActor
 
 void ULuaScriptComponent::TickComponent(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(LuaScriptTick)
+
 	if (FuncTick.valid()) {
+		// 배치 모드: 이번 프레임 큐에만 넣고 FLuaManager::Tick에서 한 번에 호출
+		if (TickSlot >= 0 && FLuaManager::IsBatchedScriptTick())
+		{
+			LuaManager->QueueScriptTick(TickSlot, DeltaTime);
+			return;
+		}
+
+		FScopedMemoryTag MemTag(EMemoryTag::Lua);
+		const uint64 StartCycles = FPlatformTime::Cycles64();
 		auto Result = FuncTick(DeltaTime);
+		if (TickSlot >= 0)
+		{
+			LuaManager->RecordScriptTick(TickSlot, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles), !Result.valid());
+		}
 		if (!Result.valid()) { sol::error Err = Result; UE_LOG("[Lua][error] %s\n", Err.what()); }
 	}
 }
@@ -225,8 +247,12 @@ void ULuaScriptComponent::CleanupLuaResources()
 		{
 			// 1. 코루틴 정리 (가장 중요. Use-After-Free 방지)
 			LuaVM->GetScheduler().CancelByOwner(this);
+
+			// 배치 큐에 남은 Tick은 함수가 비워져 건너뜀
+			LuaVM->UnregisterScriptTick(TickSlot);
 		}
 	}
+	TickSlot = -1;
 
 	// 2. Lua 참조 해제
 	FuncBeginPlay = sol::nil;
@@ -237,6 +263,7 @@ void ULuaScriptComponent::CleanupLuaResources()
 	FuncEndPlay = sol::nil;
 	Env = sol::nil;
 	Lua = nullptr;
+	LuaManager = nullptr;
 
 	bIsLuaCleanedUp = true;
 }
@@ -11,6 +11,7 @@ using state = sol::state;
 class USceneComponent;
 class UPrimitiveComponent;
 class AActor;
+class FLuaManager;
 struct FHitResult;
 
 UCLASS(DisplayName="Lua 스크립트 컴포넌트", Description="Lua 스크립트를 실행하는 컴포넌트입니다")
@@ -48,6 +49,7 @@ protected:
 	// 이 컴포넌트가 실행할 .lua 스크립트 파일의 경로 (에디터에서 설정)
 
 	sol::state* Lua = nullptr;
+	FLuaManager* LuaManager = nullptr;
 	sol::environment Env{};
 
 	/* 함수 캐시 */
@@ -62,6 +64,9 @@ protected:
 	FDelegateHandle EndHandleLua{};
 	FDelegateHandle HitHandleLua{};
 
+	/** FLuaManager의 스크립트 Tick 슬롯 (Tick 함수가 없으면 -1) */
+	int32 TickSlot = -1;
+
 	/** 델리게이트가 등록된 PrimitiveComponent (해제 시 필요) */
 	UPrimitiveComponent* BoundPrimitiveComponent = nullptr;
 
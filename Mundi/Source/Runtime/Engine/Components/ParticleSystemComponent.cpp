@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "ParticleSystemComponent.h"
+#include "PlatformTime.h"
 #include "SceneView.h"
 #include "MeshBatchElement.h"
 #include "Material.h"
@@ -27,6 +28,8 @@
 #include "ObjectFactory.h"
 #include "ParticleEventManager.h"
 
+DECLARE_CYCLE_STAT(ParticleSystemTick, "Particles")
+
 // Quad 버텍스 구조체 (UV만 포함)
 struct FSpriteQuadVertex
 {
@@ -229,6 +232,8 @@ void UParticleSystemComponent::OnRegister(UWorld* InWorld)
 
 void UParticleSystemComponent::CreateDebugMeshParticleSystem()
 {
+	FScopedMemoryTag MemTag(EMemoryTag::Particles);
+
 	// 디버그/테스트용 메시 파티클 시스템 생성
 	// Editor 통합 완료 후에는 Editor에서 설정한 Template 사용
 	TestTemplate = NewObject<UParticleSystem>();
@@ -336,6 +341,8 @@ void UParticleSystemComponent::CreateDebugMeshParticleSystem()
 
 void UParticleSystemComponent::CreateDebugSpriteParticleSystem()
 {
+	FScopedMemoryTag MemTag(EMemoryTag::Particles);
+
 	// 디버그/테스트용 스프라이트 파티클 시스템 생성
 	TestTemplate = NewObject<UParticleSystem>();
 	Template = TestTemplate;  // Template도 같이 설정 (기존 로직 호환)
@@ -430,6 +437,8 @@ void UParticleSystemComponent::CreateDebugSpriteParticleSystem()
 
 void UParticleSystemComponent::CreateDebugBeamParticleSystem()
 {
+	FScopedMemoryTag MemTag(EMemoryTag::Particles);
+
 	// 디버그/테스트용 빔 파티클 시스템 생성
 	TestTemplate = NewObject<UParticleSystem>();
 	Template = TestTemplate;
@@ -493,6 +502,8 @@ void UParticleSystemComponent::CreateDebugBeamParticleSystem()
 
 void UParticleSystemComponent::CreateDebugRibbonParticleSystem()
 {
+	FScopedMemoryTag MemTag(EMemoryTag::Particles);
+
 	// 디버그/테스트용 리본 파티클 시스템 생성
 	TestTemplate = NewObject<UParticleSystem>();
 	Template = TestTemplate;
@@ -620,6 +631,8 @@ void UParticleSystemComponent::OnUnregister()
 
 void UParticleSystemComponent::TickComponent(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(ParticleSystemTick)
+
 	USceneComponent::TickComponent(DeltaTime);
 
 	// === 테스트: 디버그 파티클 자동 이동 ===
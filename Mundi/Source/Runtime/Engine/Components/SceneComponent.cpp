@@ -365,12 +365,16 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
 	if (bInIsLoading)
 	{
-        // 나중에 자식의 Serialize 호출될 때 부모인 이 객체를 찾기 위해 Map에 추가
-        FJsonSerializer::ReadUint32(InOutHandle, "Id", SceneId);
-        SceneIdMap.Add(SceneId, this);
+        // 쿠킹 레벨은 Id/부모를 레코드에서 미리 해석해 두므로 JSON에서 읽지 않음
+        if (!IsLoadingCooked())
+        {
+            // 나중에 자식의 Serialize 호출될 때 부모인 이 객체를 찾기 위해 Map에 추가
+            FJsonSerializer::ReadUint32(InOutHandle, "Id", SceneId);
+            SceneIdMap.Add(SceneId, this);
 
-        // 부모 찾기
-        FJsonSerializer::ReadUint32(InOutHandle, "ParentId", ParentId);
+            // 부모 찾기
+            FJsonSerializer::ReadUint32(InOutHandle, "ParentId", ParentId);
+        }
 
         RelativeRotation = FQuat::MakeFromEulerZYX(RelativeRotationEuler).GetNormalized();
 
@@ -277,6 +277,7 @@ void UShapeComponent::DuplicateSubObjects()
     if (!bUseArchetypeBodySetup)
     {
         // 커스텀 파라미터 → 자체 BodySetup 생성
+        FScopedMemoryTag MemTag(EMemoryTag::Physics);
         ShapeBodySetup = ObjectFactory::NewObject<UBodySetup>();
         UpdateBodySetup();
     }
@@ -319,6 +320,7 @@ void UShapeComponent::EnsureBodySetupIsValid()
         if (bUseArchetypeBodySetup || !ShapeBodySetup)
         {
             bUseArchetypeBodySetup = false;
+            FScopedMemoryTag MemTag(EMemoryTag::Physics);
             ShapeBodySetup = ObjectFactory::NewObject<UBodySetup>();
         }
     }
@@ -7,6 +7,12 @@
 #include "AnimSingleNodeInstance.h"
 #include "AnimStateMachineInstance.h"
 #include "AnimBlendSpaceInstance.h"
+#include "AnimUpdateRate.h"
+#include "MathBatch.h"
+
+DECLARE_CYCLE_STAT(SkeletalMeshTick, "Animation")
+
+bool USkeletalMeshComponent::bUpdateRateOptimizationsAllowed = true;
 
 USkeletalMeshComponent::USkeletalMeshComponent()
 {
@@ -23,23 +29,74 @@ USkeletalMeshComponent::USkeletalMeshComponent()
 
 void USkeletalMeshComponent::TickComponent(float DeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(SkeletalMeshTick)
+
     Super::TickComponent(DeltaTime);
 
     if (!SkeletalMesh) { return; }
     // Drive animation instance if present
     if (bUseAnimation && AnimInstance && SkeletalMesh && SkeletalMesh->GetSkeleton())
     {
-        AnimInstance->NativeUpdateAnimation(DeltaTime);
+        FAnimUpdateRateStats& RateStats = FAnimUpdateRateStatManager::GetInstance().GetMutableStats();
+        RateStats.TickedComponents++;
+
+        // 프리뷰(뷰어) 월드나 최적화 비활성(컴포넌트 또는 전역) 시에는 항상 LOD 0, 매 프레임 평가
+        UWorld* World = GetWorld();
+        const bool bAllowOptimization = bUpdateRateOptimizationsAllowed && bEnableUpdateRateOptimizations && World && !World->IsPreviewWorld();
+
+        UpdateRateParams.bInterpolateSkippedFrames = bInterpolateSkippedFrames;
+        UpdateRateParams.Tick(DeltaTime,
+            bAllowOptimization ? LastRenderViewDistance : 0.f,
+            bAllowOptimization ? FramesSinceLastRender : 0);
+
+        ActiveMaxBoneDepth = UpdateRateParams.GetMaxBoneDepth();
+
+        if (!UpdateRateParams.ShouldEvaluate())
+        {
+            // 건너뛴 프레임: 시간은 누적만 하고, 보간이 가능하면 포즈만 보간
+            if (UpdateRateParams.ShouldInterpolate() && InterpTargetComponentPose.Num() == CurrentComponentSpacePose.Num())
+            {
+                InterpolateSkippedFramePose(UpdateRateParams.GetInterpolationAlpha());
+                RateStats.InterpolatedComponents++;
+            }
+            return;
+        }
+
+        // 누적된 시간을 한 번에 전달 -> 건너뛴 구간의 노티파이도 이번 Update에서 발생
+        const float EvalDeltaTime = UpdateRateParams.GetAccumulatedDeltaTime();
+        UpdateRateParams.OnEvaluated();
+        AnimInstance->NativeUpdateAnimation(EvalDeltaTime);
+
+        // 완전히 보이지 않는 경우 시간/노티파이만 진행하고 포즈 평가는 생략
+        if (UpdateRateParams.IsFrozen())
+        {
+            RateStats.FrozenComponents++;
+            return;
+        }
 
         FPoseContext OutputPose;
-        OutputPose.Initialize(this, SkeletalMesh->GetSkeleton(), DeltaTime);
+        OutputPose.Initialize(this, SkeletalMesh->GetSkeleton(), EvalDeltaTime);
         AnimInstance->EvaluateAnimation(OutputPose);
+        RateStats.EvaluatedComponents++;
 
         // Apply local-space pose to component and rebuild skinning
         // 애니메이션 포즈를 BaseAnimationPose에 저장 (additive 적용 전 리셋용)
         BaseAnimationPose = OutputPose.LocalSpacePose;
         CurrentLocalSpacePose = OutputPose.LocalSpacePose;
-        ForceRecomputePose();
+
+        if (UpdateRateParams.ShouldInterpolate())
+        {
+            // 보간 구간 갱신: 현재 화면에 보이는 포즈 -> 새로 평가한 포즈
+            InterpStartComponentPose = CurrentComponentSpacePose;
+            UpdateComponentSpaceTransforms();
+            InterpTargetComponentPose = CurrentComponentSpacePose;
+            InterpolateSkippedFramePose(UpdateRateParams.GetInterpolationAlpha());
+        }
+        else
+        {
+            InterpTargetComponentPose.Empty();
+            ForceRecomputePose();
+        }
         return; // skip test code when animation is active
     }
 }
@@ -56,6 +113,9 @@ void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
         CurrentLocalSpacePose.SetNum(NumBones);
         CurrentComponentSpacePose.SetNum(NumBones);
         TempFinalSkinningMatrices.SetNum(NumBones);
+        BoneDepths.SetNum(NumBones);
+        InterpStartComponentPose.Empty();
+        InterpTargetComponentPose.Empty();
 
         for (int32 i = 0; i < NumBones; ++i)
         {
@@ -63,6 +123,9 @@ void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
             const int32 ParentIndex = ThisBone.ParentIndex;
             FMatrix LocalBindMatrix;
 
+            // 본은 부모가 항상 먼저 나오도록 정렬되어 있음
+            BoneDepths[i] = (ParentIndex == -1) ? 0 : BoneDepths[ParentIndex] + 1;
+
             if (ParentIndex == -1) // 루트 본
             {
                 LocalBindMatrix = ThisBone.BindPose;
@@ -90,6 +153,9 @@ void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
         CurrentLocalSpacePose.Empty();
         CurrentComponentSpacePose.Empty();
         TempFinalSkinningMatrices.Empty();
+        BoneDepths.Empty();
+        InterpStartComponentPose.Empty();
+        InterpTargetComponentPose.Empty();
     }
 }
 
@@ -104,6 +170,8 @@ void USkeletalMeshComponent::SetAnimInstance(UAnimInstance* InInstance)
 
 void USkeletalMeshComponent::PlayAnimation(UAnimationAsset* Asset, bool bLooping, float InPlayRate)
 {
+    FScopedMemoryTag MemTag(EMemoryTag::Animation);
+
     UAnimSingleNodeInstance* Single = nullptr;
     if (!AnimInstance)
     {
@@ -136,6 +204,8 @@ void USkeletalMeshComponent::PlayAnimation(UAnimationAsset* Asset, bool bLooping
 // ==== Lua-friendly State Machine helper: switch this component to a state machine anim instance ====
 void USkeletalMeshComponent::UseStateMachine()
 {
+    FScopedMemoryTag MemTag(EMemoryTag::Animation);
+
     UAnimStateMachineInstance* StateMachine = Cast<UAnimStateMachineInstance>(AnimInstance);
     if (!StateMachine)
     {
@@ -151,6 +221,8 @@ void USkeletalMeshComponent::UseStateMachine()
 
 UAnimStateMachineInstance* USkeletalMeshComponent::GetOrCreateStateMachine()
 {
+    FScopedMemoryTag MemTag(EMemoryTag::Animation);
+
     UAnimStateMachineInstance* StateMachine = Cast<UAnimStateMachineInstance>(AnimInstance);
     if (!StateMachine)
     {
@@ -164,6 +236,8 @@ UAnimStateMachineInstance* USkeletalMeshComponent::GetOrCreateStateMachine()
 // ==== Lua-friendly Blend Space helper: switch this component to a blend space 2D anim instance ====
 void USkeletalMeshComponent::UseBlendSpace2D()
 {
+    FScopedMemoryTag MemTag(EMemoryTag::Animation);
+
     UAnimBlendSpaceInstance* BS = Cast<UAnimBlendSpaceInstance>(AnimInstance);
     if (!BS)
     {
@@ -179,6 +253,8 @@ void USkeletalMeshComponent::UseBlendSpace2D()
 
 UAnimBlendSpaceInstance* USkeletalMeshComponent::GetOrCreateBlendSpace2D()
 {
+    FScopedMemoryTag MemTag(EMemoryTag::Animation);
+
     UAnimBlendSpaceInstance* BS = Cast<UAnimBlendSpaceInstance>(AnimInstance);
     if (!BS)
     {
@@ -280,7 +356,8 @@ void USkeletalMeshComponent::UpdateComponentSpaceTransforms()
 
     for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
     {
-        const FTransform& LocalTransform = CurrentLocalSpacePose[BoneIndex];
+        // 마스크된 본은 애니메이션을 무시하고 레퍼런스 포즈로 부모를 따라감
+        const FTransform& LocalTransform = IsBoneMasked(BoneIndex) ? RefPose[BoneIndex] : CurrentLocalSpacePose[BoneIndex];
         const int32 ParentIndex = Skeleton.Bones[BoneIndex].ParentIndex;
 
         if (ParentIndex == -1) // 루트 본
@@ -303,13 +380,26 @@ void USkeletalMeshComponent::UpdateFinalSkinningMatrices()
     // 본 행렬 계산 시간 측정 시작
     uint64 BoneMatrixCalcStart = FWindowsPlatformTime::Cycles64();
 
+    // 컴포넌트 공간 포즈 행렬을 한 번에 변환해 두고, 같은 배열에서 InvBind를 곱해 최종 행렬로 덮어씀
+    // (부모가 자식보다 앞에 있으므로 마스크된 본이 복사하는 부모 행렬은 이미 최종 값)
+    FMathBatch::TransformsToMatrices(CurrentComponentSpacePose.GetData(), TempFinalSkinningMatrices.GetData(), NumBones);
+
+    uint32 MaskedBoneCount = 0;
     for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
     {
-        const FMatrix& InvBindPose = Skeleton.Bones[BoneIndex].InverseBindPose;
-        const FMatrix ComponentPoseMatrix = CurrentComponentSpacePose[BoneIndex].ToMatrix();
+        // 마스크된 본은 로컬이 바인드 포즈이므로 InvBind * Component가 부모의 스키닝 행렬과 같음
+        const int32 ParentIndex = Skeleton.Bones[BoneIndex].ParentIndex;
+        if (ParentIndex != -1 && IsBoneMasked(BoneIndex))
+        {
+            TempFinalSkinningMatrices[BoneIndex] = TempFinalSkinningMatrices[ParentIndex];
+            ++MaskedBoneCount;
+            continue;
+        }
 
-        TempFinalSkinningMatrices[BoneIndex] = InvBindPose * ComponentPoseMatrix;
+        const FMatrix& InvBindPose = Skeleton.Bones[BoneIndex].InverseBindPose;
+        TempFinalSkinningMatrices[BoneIndex] = InvBindPose * TempFinalSkinningMatrices[BoneIndex];
     }
+    FAnimUpdateRateStatManager::GetInstance().GetMutableStats().MaskedBones += MaskedBoneCount;
 
     // 본 행렬 계산 시간 측정 종료
     uint64 BoneMatrixCalcEnd = FWindowsPlatformTime::Cycles64();
@@ -320,6 +410,24 @@ void USkeletalMeshComponent::UpdateFinalSkinningMatrices()
     UpdateSkinningMatrices(TempFinalSkinningMatrices, BoneMatrixCalcTimeMS);
 }
 
+void USkeletalMeshComponent::InterpolateSkippedFramePose(float Alpha)
+{
+    if (!SkeletalMesh) { return; }
+
+    const int32 NumBones = CurrentComponentSpacePose.Num();
+    if (InterpStartComponentPose.Num() != NumBones)
+    {
+        InterpStartComponentPose = InterpTargetComponentPose;
+    }
+
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        CurrentComponentSpacePose[BoneIndex] = FTransform::Lerp(InterpStartComponentPose[BoneIndex], InterpTargetComponentPose[BoneIndex], Alpha);
+    }
+
+    UpdateFinalSkinningMatrices();
+}
+
 void USkeletalMeshComponent::ApplyAdditiveTransforms(const TMap<int32, FTransform>& AdditiveTransforms)
 {
     if (AdditiveTransforms.IsEmpty()) return;
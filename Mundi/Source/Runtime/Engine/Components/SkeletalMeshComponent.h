@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "SkinnedMeshComponent.h"
+#include "AnimUpdateRate.h"
 #include "USkeletalMeshComponent.generated.h"
 
 class UAnimInstance;
@@ -46,6 +47,21 @@ public:
     UFUNCTION(LuaBind, DisplayName="GetOrCreateBlendSpace2D")
     UAnimBlendSpaceInstance* GetOrCreateBlendSpace2D();
 
+    // Update Rate Optimization
+public:
+    UPROPERTY(EditAnywhere, Category="Animation", Tooltip="거리/가시성에 따라 애니메이션 평가 빈도를 낮춥니다")
+    bool bEnableUpdateRateOptimizations = true;
+
+    UPROPERTY(EditAnywhere, Category="Animation", Tooltip="평가를 건너뛴 프레임에서 포즈를 보간합니다")
+    bool bInterpolateSkippedFrames = true;
+
+    FAnimUpdateRateParameters& GetUpdateRateParameters() { return UpdateRateParams; }
+    const FAnimUpdateRateParameters& GetUpdateRateParameters() const { return UpdateRateParams; }
+
+    // 전역 스위치: 끄면 모든 컴포넌트가 LOD 0, 매 프레임 평가 (렌더링 없는 헤드리스 실행은 가시성을 알 수 없으므로 끔)
+    static void SetUpdateRateOptimizationsAllowed(bool bAllow) { bUpdateRateOptimizationsAllowed = bAllow; }
+    static bool AreUpdateRateOptimizationsAllowed() { return bUpdateRateOptimizationsAllowed; }
+
 // Editor Section
 public:
     /**
@@ -107,6 +123,19 @@ protected:
      */
     void UpdateFinalSkinningMatrices();
 
+    /**
+     * @brief 건너뛴 프레임: 이전 표시 포즈와 최신 평가 포즈를 컴포넌트 공간에서 보간하여 스키닝 행렬 갱신
+     */
+    void InterpolateSkippedFramePose(float Alpha);
+
+    /**
+     * @brief 본 마스크 대상 여부 (현재 LOD의 최대 깊이를 넘는 본)
+     */
+    bool IsBoneMasked(int32 BoneIndex) const
+    {
+        return ActiveMaxBoneDepth >= 0 && BoneDepths[BoneIndex] > ActiveMaxBoneDepth;
+    }
+
 protected:
     /**
      * @brief 각 뼈의 부모 기준 로컬 트랜스폼
@@ -123,6 +152,22 @@ protected:
      */
     TArray<FMatrix> TempFinalSkinningMatrices;
 
+    /**
+     * @brief 루트로부터의 본 깊이 (본 마스크 판정용, SetSkeletalMesh에서 계산)
+     */
+    TArray<int32> BoneDepths;
+
+    /**
+     * @brief 보간 구간의 시작(이전 표시) / 끝(최신 평가) 컴포넌트 공간 포즈
+     */
+    TArray<FTransform> InterpStartComponentPose;
+    TArray<FTransform> InterpTargetComponentPose;
+
+    FAnimUpdateRateParameters UpdateRateParams;
+    int32 ActiveMaxBoneDepth = -1;
+
+    static bool bUpdateRateOptimizationsAllowed;
+
 // FOR TEST!!!
 private:
     float TestTime = 0;
@@ -5,6 +5,13 @@
 #include "SkinningStats.h"
 #include "PlatformTime.h"
 
+// 스키닝 단계별 시간 (구간을 직접 측정해 누적)
+DECLARE_CYCLE_STAT(GPU_BoneCalc, "Skinning")
+DECLARE_CYCLE_STAT(GPU_BoneUpload, "Skinning")
+DECLARE_CYCLE_STAT(CPU_BoneCalc, "Skinning")
+DECLARE_CYCLE_STAT(CPU_VertexSkinning, "Skinning")
+DECLARE_CYCLE_STAT(CPU_BufferUpload, "Skinning")
+
 USkinnedMeshComponent::USkinnedMeshComponent() : SkeletalMesh(nullptr)
 {
    bCanEverTick = true;
@@ -63,6 +70,9 @@ void USkinnedMeshComponent::BeginPlay()
 void USkinnedMeshComponent::TickComponent(float DeltaTime)
 {
    UMeshComponent::TickComponent(DeltaTime);
+
+   // 렌더링되면 CollectMeshBatches에서 0으로 리셋됨
+   ++FramesSinceLastRender;
 }
 
 void USkinnedMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -94,6 +104,11 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
 {
     if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData()) { return; }
 
+   // 가시성/거리 기록 (같은 프레임에 여러 뷰가 수집하면 가장 가까운 거리를 사용)
+   const float ViewDistance = FVector::Distance(GetWorldLocation(), View->ViewLocation);
+   LastRenderViewDistance = (FramesSinceLastRender > 0) ? ViewDistance : std::min(LastRenderViewDistance, ViewDistance);
+   FramesSinceLastRender = 0;
+
    // 전역 스키닝 모드 체크 (언리얼 엔진 방식)
    ESkinningMode GlobalMode = View->RenderSettings->GetGlobalSkinningMode();
    const bool bUseGPU = (GlobalMode == ESkinningMode::ForceGPU);
@@ -207,8 +222,8 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
        if (bUseGPU)
        {
           FShaderMacro GPUSkinningMacro;
-          GPUSkinningMacro.Name = FName("GPU_SKINNING");
-          GPUSkinningMacro.Definition = FName("1");
+          GPUSkinningMacro.Name = FNAME_LITERAL("GPU_SKINNING");
+          GPUSkinningMacro.Definition = FNAME_LITERAL("1");
           ShaderMacros.Add(GPUSkinningMacro);
        }
 
@@ -361,6 +376,7 @@ void USkinnedMeshComponent::PerformSkinning(bool bUseGPU)
 
    FSkinningStatManager& StatManager = FSkinningStatManager::GetInstance();
    const TArray<FSkinnedVertex>& SrcVertices = SkeletalMesh->GetSkeletalMeshData()->Vertices;
+   const TArray<FQuantizedSkinnedVertex>& QuantizedVertices = SkeletalMesh->GetSkeletalMeshData()->QuantizedVertices;
    const int32 NumVertices = SrcVertices.Num();
    const int32 NumBones = FinalSkinningMatrices.Num();
 
@@ -388,8 +404,8 @@ void USkinnedMeshComponent::PerformSkinning(bool bUseGPU)
       StatManager.AddMesh(NumVertices, NumBones, BoneBufferSize);
 
       // TimeProfile 시스템에 GPU 스키닝 시간 추가
-      FScopeCycleCounter::AddTimeProfile(TStatId("GPU_BoneCalc"), LastBoneMatrixCalcTimeMS);
-      FScopeCycleCounter::AddTimeProfile(TStatId("GPU_BoneUpload"), BoneUploadTimeMS);
+      FProfiler::AddTime(STAT_GPU_BoneCalc, LastBoneMatrixCalcTimeMS);
+      FProfiler::AddTime(STAT_GPU_BoneUpload, BoneUploadTimeMS);
 
       StatManager.AddBoneMatrixCalcTime(LastBoneMatrixCalcTimeMS); // 본 행렬 계산 시간 추가
       StatManager.AddBufferUploadTime(BoneUploadTimeMS); // 본 버퍼 업로드 시간
@@ -411,15 +427,27 @@ void USkinnedMeshComponent::PerformSkinning(bool bUseGPU)
       // CPU 버텍스 스키닝 계산 시간 측정
       uint64 VertexSkinningStart = FWindowsPlatformTime::Cycles64();
 
-      for (int32 Idx = 0; Idx < NumVertices; ++Idx)
+      // 압축 정점 스트림이 있으면 그쪽을 읽음 (정점당 96 -> 36 bytes)
+      const bool bUseQuantized = QuantizedVertices.Num() == NumVertices;
+      if (bUseQuantized)
       {
-         const FSkinnedVertex& SrcVert = SrcVertices[Idx];
-         FNormalVertex& DstVert = SkinnedVertices[Idx];
+         for (int32 Idx = 0; Idx < NumVertices; ++Idx)
+         {
+            SkinQuantizedVertex(QuantizedVertices[Idx], SkinnedVertices[Idx]);
+         }
+      }
+      else
+      {
+         for (int32 Idx = 0; Idx < NumVertices; ++Idx)
+         {
+            const FSkinnedVertex& SrcVert = SrcVertices[Idx];
+            FNormalVertex& DstVert = SkinnedVertices[Idx];
 
-         DstVert.pos = SkinVertexPosition(SrcVert);
-         DstVert.normal = SkinVertexNormal(SrcVert);
-         DstVert.Tangent = SkinVertexTangent(SrcVert);
-         DstVert.tex = SrcVert.UV;
+            DstVert.pos = SkinVertexPosition(SrcVert);
+            DstVert.normal = SkinVertexNormal(SrcVert);
+            DstVert.Tangent = SkinVertexTangent(SrcVert);
+            DstVert.tex = SrcVert.UV;
+         }
       }
 
       uint64 VertexSkinningEnd = FWindowsPlatformTime::Cycles64();
@@ -439,11 +467,12 @@ void USkinnedMeshComponent::PerformSkinning(bool bUseGPU)
       // 통계에 추가 (버텍스 버퍼 크기 사용)
       const uint64 VertexBufferSize = sizeof(FNormalVertex) * NumVertices;
       StatManager.AddMesh(NumVertices, NumBones, VertexBufferSize);
+      StatManager.AddSourceVertexRead(static_cast<uint64>(bUseQuantized ? sizeof(FQuantizedSkinnedVertex) : sizeof(FSkinnedVertex)) * NumVertices);
 
       // TimeProfile 시스템에 CPU 스키닝 시간 추가
-      FScopeCycleCounter::AddTimeProfile(TStatId("CPU_BoneCalc"), LastBoneMatrixCalcTimeMS);
-      FScopeCycleCounter::AddTimeProfile(TStatId("CPU_VertexSkinning"), VertexSkinningTimeMS);
-      FScopeCycleCounter::AddTimeProfile(TStatId("CPU_BufferUpload"), BufferUploadTimeMS);
+      FProfiler::AddTime(STAT_CPU_BoneCalc, LastBoneMatrixCalcTimeMS);
+      FProfiler::AddTime(STAT_CPU_VertexSkinning, VertexSkinningTimeMS);
+      FProfiler::AddTime(STAT_CPU_BufferUpload, BufferUploadTimeMS);
 
       StatManager.AddBoneMatrixCalcTime(LastBoneMatrixCalcTimeMS); // 본 행렬 계산 시간 추가
       StatManager.AddVertexSkinningTime(VertexSkinningTimeMS); // 버텍스 스키닝 시간 (CPU만)
@@ -526,6 +555,38 @@ FVector4 USkinnedMeshComponent::SkinVertexTangent(const FSkinnedVertex& InVertex
    return { FinalTangentDir.X, FinalTangentDir.Y, FinalTangentDir.Z, OriginalSignW };
 }
 
+void USkinnedMeshComponent::SkinQuantizedVertex(const FQuantizedSkinnedVertex& InVertex, FNormalVertex& OutVertex) const
+{
+   const FVector Normal = VertexQuantization::UnpackSNorm1010102(InVertex.Normal);
+   const FVector TangentDir = VertexQuantization::UnpackSNorm1010102(InVertex.Tangent);
+
+   FVector BlendedPosition(0.f, 0.f, 0.f);
+   FVector BlendedNormal(0.f, 0.f, 0.f);
+   FVector BlendedTangentDir(0.f, 0.f, 0.f);
+
+   for (int32 Idx = 0; Idx < 4; ++Idx)
+   {
+      const uint8 QuantizedWeight = InVertex.BoneWeights[Idx];
+      if (QuantizedWeight == 0)
+      {
+         continue;
+      }
+
+      const float Weight = VertexQuantization::UnpackUNorm8(QuantizedWeight);
+      const FMatrix& SkinMatrix = FinalSkinningMatrices[InVertex.BoneIndices[Idx]];
+      BlendedPosition += SkinMatrix.TransformPosition(InVertex.Position) * Weight;
+      // 노멀/탄젠트도 일반 스키닝 행렬로 변환 (비균등 스케일 무시)
+      BlendedNormal += SkinMatrix.TransformVector(Normal) * Weight;
+      BlendedTangentDir += SkinMatrix.TransformVector(TangentDir) * Weight;
+   }
+
+   const FVector FinalTangentDir = BlendedTangentDir.GetSafeNormal();
+   OutVertex.pos = BlendedPosition;
+   OutVertex.normal = BlendedNormal.GetSafeNormal();
+   OutVertex.Tangent = { FinalTangentDir.X, FinalTangentDir.Y, FinalTangentDir.Z, VertexQuantization::UnpackSNorm1010102W(InVertex.Tangent) };
+   OutVertex.tex = FVector2D(VertexQuantization::HalfToFloat(InVertex.UV[0]), VertexQuantization::HalfToFloat(InVertex.UV[1]));
+}
+
 void USkinnedMeshComponent::UpdateBoneMatrixBuffer()
 {
    // 실제 본 개수 계산
@@ -66,11 +66,26 @@ protected:
      */
     TArray<FNormalVertex> SkinnedVertices;
 
+    /**
+     * @brief 마지막으로 CollectMeshBatches가 호출된 이후 지난 Tick 수 (애니메이션 업데이트 빈도 결정용)
+     */
+    int32 FramesSinceLastRender = 0;
+
+    /**
+     * @brief 마지막 렌더링 프레임에서 가장 가까운 뷰까지의 거리
+     */
+    float LastRenderViewDistance = 0.f;
+
 private:
     FVector SkinVertexPosition(const FSkinnedVertex& InVertex) const;
     FVector SkinVertexNormal(const FSkinnedVertex& InVertex) const;
     FVector4 SkinVertexTangent(const FSkinnedVertex& InVertex) const;
 
+    /**
+     * @brief 압축 정점 하나를 스키닝 (본 루프 한 번에 위치/법선/탄젠트를 함께 블렌딩)
+     */
+    void SkinQuantizedVertex(const FQuantizedSkinnedVertex& InVertex, FNormalVertex& OutVertex) const;
+
     /**
      * @brief 자식이 계산해 준, 현재 프레임의 최종 스키닝 행렬
     */
@@ -258,6 +258,7 @@ UBodySetup* USphereComponent::GetDefaultBodySetup() const
 	static UBodySetup* DefaultSetup = nullptr;
 	if (!DefaultSetup)
 	{
+		FScopedMemoryTag MemTag(EMemoryTag::Physics);
 		DefaultSetup = ObjectFactory::NewObject<UBodySetup>();
 		DefaultSetup->BodyType = EBodySetupType::Sphere;
 		DefaultSetup->SphereRadius = UBodySetup::DefaultSphereRadius;
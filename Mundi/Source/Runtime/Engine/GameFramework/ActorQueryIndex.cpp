@@ -0,0 +1,174 @@
+#include "pch.h"
+#include "ActorQueryIndex.h"
+#include "World.h"
+
+FActorQueryIndex* FActorQueryIndex::Get(const AActor* Actor)
+{
+    if (!Actor)
+    {
+        return nullptr;
+    }
+
+    UWorld* World = Actor->GetWorld();
+    ULevel* Level = World ? World->GetLevel() : nullptr;
+    if (!Level || !Level->GetQueryIndex().Contains(Actor))
+    {
+        return nullptr;
+    }
+    return &Level->GetQueryIndex();
+}
+
+FActorQueryIndex& FActorQueryIndex::operator=(const FActorQueryIndex& Other)
+{
+    if (this != &Other)
+    {
+        Empty();
+        for (const auto& Pair : Other.ActorRecords)
+        {
+            AddActor(Pair.first);
+        }
+    }
+    return *this;
+}
+
+void FActorQueryIndex::AddActor(AActor* Actor)
+{
+    if (!Actor || ActorRecords.Contains(Actor))
+    {
+        return;
+    }
+
+    FActorRecord& Record = ActorRecords[Actor];
+    Record.Class = Actor->GetClass();
+    if (ActorClasses.Add(Record.Class, Actor))
+    {
+        ActorDerivedCache.Empty();
+    }
+    IndexActorKeys(Actor, Record);
+
+    for (UActorComponent* Component : Actor->GetOwnedComponents())
+    {
+        AddComponent(Actor, Component);
+    }
+}
+
+void FActorQueryIndex::RemoveActor(AActor* Actor)
+{
+    FActorRecord* Record = ActorRecords.Find(Actor);
+    if (!Record)
+    {
+        return;
+    }
+
+    // 컴포넌트는 이미 파괴되었을 수 있으므로 기록된 키로만 제거 (역참조 금지)
+    for (UActorComponent* Component : Record->Components)
+    {
+        if (const FComponentRecord* ComponentRecord = ComponentRecords.Find(Component))
+        {
+            ComponentClasses.Remove(ComponentRecord->Class, Component);
+            ComponentNames.Remove(ComponentRecord->Name, Component);
+            ComponentRecords.Remove(Component);
+        }
+    }
+
+    ActorClasses.Remove(Record->Class, Actor);
+    UnindexActorKeys(Actor, *Record);
+    ActorRecords.Remove(Actor);
+}
+
+void FActorQueryIndex::RefreshActor(AActor* Actor)
+{
+    FActorRecord* Record = ActorRecords.Find(Actor);
+    if (!Record)
+    {
+        return;
+    }
+
+    if (Record->Name != Actor->ObjectName || Record->Tag != Actor->Tag)
+    {
+        UnindexActorKeys(Actor, *Record);
+        IndexActorKeys(Actor, *Record);
+    }
+
+    // 월드가 없던 동안(직렬화 중) 붙은 컴포넌트 반영
+    for (UActorComponent* Component : Actor->GetOwnedComponents())
+    {
+        AddComponent(Actor, Component);
+    }
+}
+
+void FActorQueryIndex::AddComponent(AActor* Owner, UActorComponent* Component)
+{
+    FActorRecord* OwnerRecord = ActorRecords.Find(Owner);
+    if (!OwnerRecord || !Component || ComponentRecords.Contains(Component))
+    {
+        return;
+    }
+
+    FComponentRecord& Record = ComponentRecords[Component];
+    Record.Owner = Owner;
+    Record.Class = Component->GetClass();
+    Record.Name = Component->ObjectName;
+    OwnerRecord->Components.Add(Component);
+
+    if (ComponentClasses.Add(Record.Class, Component))
+    {
+        ComponentDerivedCache.Empty();
+    }
+    ComponentNames.Add(Record.Name, Component);
+}
+
+void FActorQueryIndex::RemoveComponent(UActorComponent* Component)
+{
+    FComponentRecord* Record = ComponentRecords.Find(Component);
+    if (!Record)
+    {
+        return;
+    }
+
+    if (FActorRecord* OwnerRecord = ActorRecords.Find(Record->Owner))
+    {
+        TArray<UActorComponent*>& Components = OwnerRecord->Components;
+        auto It = std::find(Components.begin(), Components.end(), Component);
+        if (It != Components.end())
+        {
+            Components.RemoveAtSwap(static_cast<int32>(It - Components.begin()));
+        }
+    }
+    ComponentClasses.Remove(Record->Class, Component);
+    ComponentNames.Remove(Record->Name, Component);
+    ComponentRecords.Remove(Component);
+}
+
+void FActorQueryIndex::Empty()
+{
+    ActorRecords.Empty();
+    ComponentRecords.Empty();
+    ActorClasses.Empty();
+    ActorNames.Empty();
+    ActorTags.Empty();
+    ComponentClasses.Empty();
+    ComponentNames.Empty();
+    ActorDerivedCache.Empty();
+    ComponentDerivedCache.Empty();
+}
+
+void FActorQueryIndex::IndexActorKeys(AActor* Actor, FActorRecord& Record)
+{
+    Record.Name = Actor->ObjectName;
+    Record.Tag = Actor->Tag;
+    ActorNames.Add(Record.Name, Actor);
+    if (!Record.Tag.empty())
+    {
+        ActorTags.Add(Record.Tag, Actor);
+    }
+}
+
+void FActorQueryIndex::UnindexActorKeys(AActor* Actor, const FActorRecord& Record)
+{
+    ActorNames.Remove(Record.Name, Actor);
+    if (!Record.Tag.empty())
+    {
+        ActorTags.Remove(Record.Tag, Actor);
+    }
+}
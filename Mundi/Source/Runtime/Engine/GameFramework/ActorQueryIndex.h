@@ -0,0 +1,339 @@
+#pragma once
+#include "Object.h"
+#include "UEContainer.h"
+#include "Actor.h"
+
+/**
+ * @brief 같은 키를 가진 객체들을 추가 순서대로 담는 버킷
+ *
+ * - 제거된 칸은 nullptr로 비워 두고, 빈 칸이 살아있는 수보다 많아지면 한 번에 압축
+ * - 덕분에 제거가 O(1)이면서도 순회 순서(= 레벨에 추가된 순서)가 유지됨
+ */
+template<typename ElementType>
+struct TQueryBucket
+{
+    TArray<ElementType*> Elements;
+    int32 NumLive = 0;
+};
+
+/**
+ * @brief 키 → 버킷 해시 맵 (객체 하나는 맵마다 정확히 하나의 키에만 속함)
+ *
+ * 버킷은 개별 할당되어 맵이 커져도 주소가 바뀌지 않으므로 뷰가 버킷 포인터를 들고 있을 수 있음.
+ */
+template<typename KeyType, typename ElementType>
+class TQueryBucketMap
+{
+public:
+    using FBucket = TQueryBucket<ElementType>;
+
+    /** @return 이 호출로 버킷이 새로 만들어졌으면 true */
+    bool Add(const KeyType& Key, ElementType* Element)
+    {
+        bool bNewBucket = false;
+        TUniquePtr<FBucket>& Bucket = Buckets[Key];
+        if (!Bucket)
+        {
+            Bucket = std::make_unique<FBucket>();
+            bNewBucket = true;
+        }
+
+        Slots.Add(Element, Bucket->Elements.Add(Element));
+        ++Bucket->NumLive;
+        return bNewBucket;
+    }
+
+    void Remove(const KeyType& Key, ElementType* Element)
+    {
+        const int32* Slot = Slots.Find(Element);
+        TUniquePtr<FBucket>* Bucket = Buckets.Find(Key);
+        if (!Slot || !Bucket)
+        {
+            return;
+        }
+
+        FBucket& Target = **Bucket;
+        Target.Elements[*Slot] = nullptr;
+        --Target.NumLive;
+        Slots.Remove(Element);
+
+        const int32 NumHoles = Target.Elements.Num() - Target.NumLive;
+        if (NumHoles > 16 && NumHoles > Target.NumLive)
+        {
+            Compact(Target);
+        }
+    }
+
+    FBucket* Find(const KeyType& Key) const
+    {
+        const TUniquePtr<FBucket>* Bucket = Buckets.Find(Key);
+        return Bucket ? Bucket->get() : nullptr;
+    }
+
+    template<typename FuncType>
+    void ForEachBucket(FuncType&& Func) const
+    {
+        for (const auto& Pair : Buckets)
+        {
+            Func(Pair.first, Pair.second.get());
+        }
+    }
+
+    void Empty()
+    {
+        Buckets.Empty();
+        Slots.Empty();
+    }
+
+private:
+    void Compact(FBucket& Target)
+    {
+        int32 WriteIndex = 0;
+        for (ElementType* Element : Target.Elements)
+        {
+            if (Element)
+            {
+                Target.Elements[WriteIndex] = Element;
+                Slots[Element] = WriteIndex;
+                ++WriteIndex;
+            }
+        }
+        Target.Elements.resize(WriteIndex);
+    }
+
+    TMap<KeyType, TUniquePtr<FBucket>> Buckets;
+    TMap<ElementType*, int32> Slots;
+};
+
+/**
+ * @brief 인덱스 버킷들을 순회하는 읽기 전용 뷰 (새 배열을 만들지 않음)
+ *
+ * - 제거된 칸과 파괴 대기 중인 객체(컴포넌트는 소유 액터 포함)는 건너뜀
+ * - 인덱스가 바뀌는(스폰/파괴/이름 변경) 동안에는 사용하지 말 것. 순회 중 파괴는 지연 파괴(Destroy)로만.
+ */
+template<typename T>
+class TQueryView
+{
+public:
+    using ElementType = std::conditional_t<std::is_base_of_v<AActor, T>, AActor, UActorComponent>;
+    using FBucket = TQueryBucket<ElementType>;
+
+    class FIterator
+    {
+    public:
+        FIterator(const FBucket* const* InBuckets, int32 InNumBuckets, int32 InBucketIndex)
+            : Buckets(InBuckets), NumBuckets(InNumBuckets), BucketIndex(InBucketIndex)
+        {
+            SkipInvalid();
+        }
+
+        T* operator*() const { return static_cast<T*>(Buckets[BucketIndex]->Elements[ElementIndex]); }
+        FIterator& operator++() { ++ElementIndex; SkipInvalid(); return *this; }
+        bool operator==(const FIterator& Other) const { return BucketIndex == Other.BucketIndex && ElementIndex == Other.ElementIndex; }
+        bool operator!=(const FIterator& Other) const { return !(*this == Other); }
+
+    private:
+        void SkipInvalid()
+        {
+            while (BucketIndex < NumBuckets)
+            {
+                const TArray<ElementType*>& Elements = Buckets[BucketIndex]->Elements;
+                while (ElementIndex < Elements.Num())
+                {
+                    if (IsVisible(Elements[ElementIndex]))
+                    {
+                        return;
+                    }
+                    ++ElementIndex;
+                }
+                ++BucketIndex;
+                ElementIndex = 0;
+            }
+        }
+
+        const FBucket* const* Buckets;
+        int32 NumBuckets;
+        int32 BucketIndex;
+        int32 ElementIndex = 0;
+    };
+
+    TQueryView() = default;
+    explicit TQueryView(const FBucket* InBucket) : SingleBucket(InBucket), NumBuckets(InBucket ? 1 : 0) {}
+    explicit TQueryView(const TArray<FBucket*>& InBuckets)
+        : BucketList(InBuckets.data()), NumBuckets(InBuckets.Num()) {}
+
+    FIterator begin() const { return FIterator(GetBuckets(), NumBuckets, 0); }
+    FIterator end() const { return FIterator(GetBuckets(), NumBuckets, NumBuckets); }
+
+    bool IsEmpty() const { return begin() == end(); }
+    T* First() const { FIterator It = begin(); return It != end() ? *It : nullptr; }
+
+    /** 살아있는 객체 수 (파괴 대기 중인 객체까지 확인하므로 O(결과 수)) */
+    int32 Num() const
+    {
+        int32 Count = 0;
+        for (FIterator It = begin(), End = end(); It != End; ++It)
+        {
+            ++Count;
+        }
+        return Count;
+    }
+
+    /** 결과를 보관해야 하는 호출자용 복사 */
+    TArray<T*> ToArray() const
+    {
+        TArray<T*> Result;
+        for (T* Element : *this)
+        {
+            Result.Add(Element);
+        }
+        return Result;
+    }
+
+private:
+    static bool IsVisible(const AActor* Actor)
+    {
+        return Actor && !Actor->IsPendingDestroy();
+    }
+
+    static bool IsVisible(const UActorComponent* Component)
+    {
+        if (!Component || Component->IsPendingDestroy())
+        {
+            return false;
+        }
+        const AActor* Owner = Component->GetOwner();
+        return !Owner || !Owner->IsPendingDestroy();
+    }
+
+    const FBucket* const* GetBuckets() const
+    {
+        return BucketList ? BucketList : &SingleBucket;
+    }
+
+    const FBucket* SingleBucket = nullptr;
+    const FBucket* const* BucketList = nullptr;
+    int32 NumBuckets = 0;
+};
+
+/**
+ * @brief 레벨에 배치된 액터/컴포넌트를 클래스·이름·태그로 바로 찾기 위한 인덱스
+ *
+ * 정확한 클래스별 버킷만 유지하고, 상위 클래스 질의는 그 클래스를 상속하는 버킷 목록(캐시)만 순회하므로
+ * 비용이 월드 크기가 아니라 결과 수에 비례합니다.
+ *
+ * 유지 시점
+ * - ULevel::AddActor/RemoveActor/Clear            : 액터와 그 컴포넌트 전체
+ * - AActor::AddOwnedComponent / DestroyComponent   : 레벨에 있는 액터의 컴포넌트
+ * - AActor::SetName/SetTag/RefreshQueryIndex       : 이름/태그 변경 (ObjectName/Tag 직접 대입은 인덱스에 반영되지 않음)
+ */
+class FActorQueryIndex
+{
+public:
+    using FActorBucket = TQueryBucket<AActor>;
+    using FComponentBucket = TQueryBucket<UActorComponent>;
+
+    FActorQueryIndex() = default;
+    // ULevel 복제(얕은 복사)용: 같은 액터들로 인덱스를 새로 구성
+    FActorQueryIndex(const FActorQueryIndex& Other) { *this = Other; }
+    FActorQueryIndex& operator=(const FActorQueryIndex& Other);
+
+    void AddActor(AActor* Actor);
+    void RemoveActor(AActor* Actor);
+    /** 액터의 이름/태그/컴포넌트 목록을 다시 읽어 인덱스를 맞춤 (직렬화나 에디터 편집 이후) */
+    void RefreshActor(AActor* Actor);
+
+    void AddComponent(AActor* Owner, UActorComponent* Component);
+    void RemoveComponent(UActorComponent* Component);
+
+    void Empty();
+
+    bool Contains(const AActor* Actor) const { return ActorRecords.Contains(const_cast<AActor*>(Actor)); }
+
+    /** 액터가 속한 월드의 레벨 인덱스 (그 레벨에 등록된 액터일 때만, 아니면 nullptr) */
+    static FActorQueryIndex* Get(const AActor* Actor);
+
+    template<typename T>
+    TQueryView<T> GetActorsOfClass() const
+    {
+        static_assert(std::is_base_of_v<AActor, T>, "T must be derived from AActor.");
+        return TQueryView<T>(GetDerivedBuckets(ActorClasses, ActorDerivedCache, T::StaticClass()));
+    }
+
+    template<typename T>
+    TQueryView<T> GetComponentsOfClass() const
+    {
+        static_assert(std::is_base_of_v<UActorComponent, T>, "T must be derived from UActorComponent.");
+        return TQueryView<T>(GetDerivedBuckets(ComponentClasses, ComponentDerivedCache, T::StaticClass()));
+    }
+
+    TQueryView<AActor> GetActorsOfClass(const UClass* Class) const
+    {
+        return TQueryView<AActor>(GetDerivedBuckets(ActorClasses, ActorDerivedCache, Class));
+    }
+
+    TQueryView<AActor> GetActorsWithName(const FName& Name) const { return TQueryView<AActor>(ActorNames.Find(Name)); }
+    TQueryView<AActor> GetActorsWithTag(const FString& Tag) const { return TQueryView<AActor>(ActorTags.Find(Tag)); }
+    TQueryView<UActorComponent> GetComponentsWithName(const FName& Name) const { return TQueryView<UActorComponent>(ComponentNames.Find(Name)); }
+
+private:
+    struct FActorRecord
+    {
+        UClass* Class = nullptr;
+        FName Name;
+        FString Tag;
+        TArray<UActorComponent*> Components;
+    };
+
+    struct FComponentRecord
+    {
+        AActor* Owner = nullptr;
+        UClass* Class = nullptr;
+        FName Name;
+    };
+
+    template<typename ElementType>
+    using TClassBuckets = TQueryBucketMap<const UClass*, ElementType>;
+
+    template<typename ElementType>
+    using TDerivedCache = TMap<const UClass*, TArray<TQueryBucket<ElementType>*>>;
+
+    /** Base를 상속하는 모든 클래스 버킷 목록. 새 클래스 버킷이 생길 때만 캐시가 무효화됨 */
+    template<typename ElementType>
+    static const TArray<TQueryBucket<ElementType>*>& GetDerivedBuckets(const TClassBuckets<ElementType>& Classes, TDerivedCache<ElementType>& Cache, const UClass* Base)
+    {
+        if (const TArray<TQueryBucket<ElementType>*>* Cached = Cache.Find(Base))
+        {
+            return *Cached;
+        }
+
+        TArray<TQueryBucket<ElementType>*>& Result = Cache[Base];
+        if (Base)
+        {
+            Classes.ForEachBucket([&](const UClass* Class, TQueryBucket<ElementType>* Bucket)
+            {
+                if (Class->IsChildOf(Base))
+                {
+                    Result.Add(Bucket);
+                }
+            });
+        }
+        return Result;
+    }
+
+    void IndexActorKeys(AActor* Actor, FActorRecord& Record);
+    void UnindexActorKeys(AActor* Actor, const FActorRecord& Record);
+
+    TMap<AActor*, FActorRecord> ActorRecords;
+    TMap<UActorComponent*, FComponentRecord> ComponentRecords;
+
+    TClassBuckets<AActor> ActorClasses;
+    TQueryBucketMap<FName, AActor> ActorNames;
+    TQueryBucketMap<FString, AActor> ActorTags;
+
+    TClassBuckets<UActorComponent> ComponentClasses;
+    TQueryBucketMap<FName, UActorComponent> ComponentNames;
+
+    mutable TDerivedCache<AActor> ActorDerivedCache;
+    mutable TDerivedCache<UActorComponent> ComponentDerivedCache;
+};
@@ -7,6 +7,8 @@
 #include "PlatformCrashHandler.h"
 #include <ObjManager.h>
 #include "PhysicsCore.h"
+#include "AnimUpdateRate.h"
+#include "PlatformTime.h"
 
 float UEditorEngine::ClientWidth = 1024.0f;
 float UEditorEngine::ClientHeight = 1024.0f;
@@ -177,6 +179,9 @@ bool UEditorEngine::CreateMainWindow(HINSTANCE hInstance)
 
 bool UEditorEngine::Startup(HINSTANCE hInstance)
 {
+    // 로그 컨슈머 스레드와 파일 싱크 (이전에 남긴 로그는 큐에 보관되어 있음)
+    UGlobalConsole::Initialize();
+
     LoadIniFile();
 
     if (!CreateMainWindow(hInstance))
@@ -202,14 +207,20 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
     FPhysicsCore::Get().Init();
 
     ///////////////////////////////////
-    WorldContexts.Add(FWorldContext(NewObject<UWorld>(), EWorldType::Editor));
-    GWorld = WorldContexts[0].World;
-    WorldContexts[0].World->Initialize();
+    {
+        FScopedMemoryTag MemTag(EMemoryTag::World);
+        WorldContexts.Add(FWorldContext(NewObject<UWorld>(), EWorldType::Editor));
+        GWorld = WorldContexts[0].World;
+        WorldContexts[0].World->Initialize();
+    }
     ///////////////////////////////////
 
     // 슬레이트 매니저 (singleton)
-    FRect ScreenRect(0, 0, ClientWidth, ClientHeight);
-    SLATE.Initialize(RHIDevice.GetDevice(), GWorld, ScreenRect);
+    {
+        FScopedMemoryTag MemTag(EMemoryTag::Editor);
+        FRect ScreenRect(0, 0, ClientWidth, ClientHeight);
+        SLATE.Initialize(RHIDevice.GetDevice(), GWorld, ScreenRect);
+    }
 
     bRunning = true;
     return true;
@@ -217,8 +228,20 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
 
 void UEditorEngine::Tick(float DeltaSeconds)
 {
+    // 입력 기록/재생 중에는 기록된 고정 델타를 사용
+    DeltaSeconds = INPUT.BeginFrame(DeltaSeconds);
+
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
+
+    // 애니메이션 업데이트 빈도 통계는 월드 Tick 단위로 집계
+    FAnimUpdateRateStatManager::GetInstance().ResetFrameStats();
+    FMemoryManager::BeginFrame();
+    FProfiler::MarkFrame();
+
+    // 워커 스레드가 끝낸 비동기 로드를 마무리 (GPU 리소스 생성, 프레임당 시간 예산 적용)
+    UResourceManager::GetInstance().ProcessAsyncLoads();
+    UGlobalConsole::FlushPendingLogs();
     
     //@TODO: Delta Time 계산 + EditorActor Tick은 어떻게 할 것인가 
     for (auto& WorldContext : WorldContexts)
@@ -318,6 +341,9 @@ void UEditorEngine::MainLoop()
             bPIEActive = false;
             UE_LOG("[info] END PIE");
 
+            // PIE와 함께 시작한 입력 기록/재생 종료
+            INPUT.OnPlayEnd();
+
             bChangedPieToEditor = false;
         }
         // 크래시 모드가 활성화되면 매 프레임마다 랜덤 객체 삭제
@@ -333,6 +359,9 @@ void UEditorEngine::MainLoop()
 
 void UEditorEngine::Shutdown()
 {
+    // 진행 중인 입력 기록은 파일로 저장
+    INPUT.StopCapture();
+
     // 월드부터 삭제해야 DeleteAll 때 문제가 없음
     for (FWorldContext WorldContext : WorldContexts)
     {
@@ -344,6 +373,9 @@ void UEditorEngine::Shutdown()
     UUIManager::GetInstance().Release();
 
     USlateManager::GetInstance().Shutdown();
+    // 로드 중인 리소스를 워커가 참조하지 않도록 비동기 로더부터 정지
+    UResourceManager::GetInstance().ShutdownAsyncLoads();
+
     // Delete all UObjects (Components, Actors, Resources)
     // Resource destructors will properly release D3D resources
     ObjectFactory::DeleteAll(true);
@@ -368,6 +400,9 @@ void UEditorEngine::Shutdown()
     RHIDevice.Release();
 
     SaveIniFile();
+
+    // 남은 로그를 파일까지 내보낸 뒤 컨슈머 종료
+    UGlobalConsole::Shutdown();
 }
 
 
@@ -393,6 +428,9 @@ void UEditorEngine::StartPIE()
 
     // NOTE: BeginPlay 중에 삭제된 액터 삭제 후 Tick 시작
     GWorld->ProcessPendingKillActors();
+
+    // 대기 중인 입력 기록/재생은 PIE 첫 프레임부터 시작
+    INPUT.OnPlayBegin();
 }
 
 void UEditorEngine::EndPIE()
@@ -8,6 +8,12 @@
 #include "FAudioDevice.h"
 #include <sol/sol.hpp>
 #include "PhysicsCore.h"
+#include "AnimUpdateRate.h"
+#include "SkeletalMeshComponent.h"
+#include "PlatformTime.h"
+#include "HeadlessBenchmark.h"
+#include "BenchmarkRegistry.h"
+#include "LuaManager.h"
 
 float UGameEngine::ClientWidth = 1024.0f;
 float UGameEngine::ClientHeight = 1024.0f;
@@ -172,6 +178,9 @@ bool UGameEngine::CreateMainWindow(HINSTANCE hInstance)
 
 bool UGameEngine::Startup(HINSTANCE hInstance)
 {
+    // 로그 컨슈머 스레드와 파일 싱크 (이전에 남긴 로그는 큐에 보관되어 있음)
+    UGlobalConsole::Initialize();
+
     LoadIniFile();
 
     if (!CreateMainWindow(hInstance))
@@ -230,11 +239,161 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     return true;
 }
 
+// -<flag>로 고른 벤치마크가 이 준비 단계를 요구하면 실행 @return 실행했으면 true (월드 Tick 생략)
+static bool RunHeadlessBenchmark(const FHeadlessOptions& Options, EBenchmarkStage Stage)
+{
+    if (!Options.Benchmark || Options.Benchmark->Stage != Stage)
+    {
+        return false;
+    }
+
+    UE_LOG("Headless: running %s", Options.Benchmark->Description);
+    Options.Benchmark->Run(Options.OutputPath);
+    UGlobalConsole::FlushPendingLogs();
+    return true;
+}
+
+int32 UGameEngine::RunHeadless(const FHeadlessOptions& Options)
+{
+    bHeadless = true;
+    UGlobalConsole::Initialize();
+
+    // 헤드리스는 CollectMeshBatches가 불리지 않아 FramesSinceLastRender가 줄지 않음
+    // 그대로 두면 모든 스켈레탈 메시가 '보이지 않음'으로 얼어 Skinned 기준 씬이 애니메이션 비용을 재지 못함
+    USkeletalMeshComponent::SetUpdateRateOptimizationsAllowed(false);
+
+    if (RunHeadlessBenchmark(Options, EBenchmarkStage::None))
+    {
+        return 0;
+    }
+
+    // 렌더링/오디오/입력 장치는 만들지 않음 (Renderer == nullptr, FAudioDevice 미초기화, 입력 창 없음)
+    // 메시/파티클 컴포넌트가 버퍼를 만들 수 있도록 리소스 생성용 디바이스만 준비
+    RHIDevice.InitializeHeadless();
+    if (!RHIDevice.GetDevice())
+    {
+        return 1;
+    }
+
+    if (RunHeadlessBenchmark(Options, EBenchmarkStage::Device))
+    {
+        return 0;
+    }
+
+    FObjManager::Preload();
+
+    if (RunHeadlessBenchmark(Options, EBenchmarkStage::Preload))
+    {
+        return 0;
+    }
+
+    FPhysicsCore::Get().Init();
+    FLuaManager::SetBatchedScriptTick(Options.bBatchedScriptTick);
+
+    const uint64 LoadStart = FPlatformTime::Cycles64();
+
+    WorldContexts.Add(FWorldContext(NewObject<UWorld>(), EWorldType::Game));
+    GWorld = WorldContexts[0].World;
+    GWorld->Initialize();
+
+    if (RunHeadlessBenchmark(Options, EBenchmarkStage::World))
+    {
+        return 0;
+    }
+
+    FString SceneName;
+    if (!Options.ScenePath.empty())
+    {
+        SceneName = Options.ScenePath;
+        if (!GWorld->LoadLevelFromFile(UTF8ToWide(Options.ScenePath)))
+        {
+            UE_LOG("[error] Headless: failed to load scene: %s", Options.ScenePath.c_str());
+            return 2;
+        }
+    }
+    else
+    {
+        SceneName = Options.ReferenceScene;
+        if (!FHeadlessBenchmark::PopulateReferenceScene(GWorld, Options.ReferenceScene, Options.Scale))
+        {
+            UE_LOG("[error] Headless: unknown reference scene '%s'", Options.ReferenceScene.c_str());
+            return 2;
+        }
+    }
+
+    // 게임 모드와 같은 순서: 액터 배치 후 BeginPlay, 이후 추가되는 컴포넌트는 즉시 시작
+    TArray<AActor*> LevelActors = GWorld->GetLevel()->GetActors();
+    for (AActor* Actor : LevelActors)
+    {
+        Actor->BeginPlay();
+    }
+    GWorld->bPie = true;
+    bPlayActive = true;
+
+    if (RunHeadlessBenchmark(Options, EBenchmarkStage::PlayingWorld))
+    {
+        return 0;
+    }
+
+    const double LoadMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LoadStart);
+    const int32 NumActors = GWorld->GetLevel()->GetActors().Num();
+    UE_LOG("Headless: %s ready (%d actors, %.2f ms), ticking %d + %d frames at %.4f s",
+        SceneName.c_str(), NumActors, LoadMS, Options.NumWarmupFrames, Options.NumFrames, Options.FixedDeltaSeconds);
+
+    // 입력 재생: 기록 길이만큼 기록된 델타로 Tick (워밍업 프레임도 재생 구간에 포함)
+    int32 TotalFrames = Options.NumWarmupFrames + Options.NumFrames;
+    if (!Options.ReplayInputPath.empty())
+    {
+        if (!INPUT.StartReplay(Options.ReplayInputPath, false))
+        {
+            return 2;
+        }
+        TotalFrames = INPUT.GetNumReplayFrames();
+    }
+
+    // 프레임 N의 스탯은 다음 Tick 시작의 MarkFrame에서 확정되므로 한 프레임 늦게 기록
+    FHeadlessBenchmark Benchmark;
+    double PreviousFrameMS = 0.0;
+    for (int32 Frame = 0; Frame < TotalFrames; ++Frame)
+    {
+        FScopeCycleCounter FrameCounter;
+        Tick(Options.FixedDeltaSeconds);
+        if (Frame > Options.NumWarmupFrames)
+        {
+            Benchmark.RecordFrame(PreviousFrameMS);
+        }
+        PreviousFrameMS = FrameCounter.Finish();
+    }
+    FProfiler::MarkFrame();
+    Benchmark.RecordFrame(PreviousFrameMS);
+    INPUT.StopCapture();
+
+    if (FLuaManager* LuaManager = GWorld->GetLuaManager(); LuaManager && !LuaManager->GetScriptTickStats().IsEmpty())
+    {
+        LuaManager->LogScriptTickStats(10);
+    }
+
+    UGlobalConsole::FlushPendingLogs();
+    return Benchmark.WriteReport(Options, SceneName, NumActors, LoadMS) ? 0 : 3;
+}
+
 void UGameEngine::Tick(float DeltaSeconds)
 {
+    // 입력 기록/재생 중에는 기록된 고정 델타를 사용
+    DeltaSeconds = INPUT.BeginFrame(DeltaSeconds);
+
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
 
+    // 애니메이션 업데이트 빈도 통계는 월드 Tick 단위로 집계
+    FAnimUpdateRateStatManager::GetInstance().ResetFrameStats();
+    FMemoryManager::BeginFrame();
+    FProfiler::MarkFrame();
+
+    // 워커 스레드가 끝낸 비동기 로드를 마무리 (GPU 리소스 생성, 프레임당 시간 예산 적용)
+    UResourceManager::GetInstance().ProcessAsyncLoads();
+    UGlobalConsole::FlushPendingLogs();
+
     for (auto& WorldContext : WorldContexts)
     {
         WorldContext.World->Tick(DeltaSeconds);
@@ -328,6 +487,9 @@ void UGameEngine::MainLoop()
 
 void UGameEngine::Shutdown()
 {
+    // 진행 중인 입력 기록은 파일로 저장
+    INPUT.StopCapture();
+
     // 월드부터 삭제해야 DeleteAll 때 문제가 없음
     for (FWorldContext WorldContext : WorldContexts)
     {
@@ -335,6 +497,9 @@ void UGameEngine::Shutdown()
     }
     WorldContexts.clear();
 
+    // 로드 중인 리소스를 워커가 참조하지 않도록 비동기 로더부터 정지
+    UResourceManager::GetInstance().ShutdownAsyncLoads();
+
     // Delete all UObjects (Components, Actors, Resources)
     // Resource destructors will properly release D3D resources
     ObjectFactory::DeleteAll(true);
@@ -358,5 +523,12 @@ void UGameEngine::Shutdown()
     // Explicitly release D3D11RHI resources before global destruction
     RHIDevice.Release();
 
-    SaveIniFile();
+    // 헤드리스 실행은 창 크기 등 에디터 설정을 건드리지 않음
+    if (!bHeadless)
+    {
+        SaveIniFile();
+    }
+
+    // 남은 로그를 파일까지 내보낸 뒤 컨슈머 종료
+    UGlobalConsole::Shutdown();
 }
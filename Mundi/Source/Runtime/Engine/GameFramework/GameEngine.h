@@ -5,6 +5,7 @@ class URenderer;
 class D3D11RHI;
 class UWorld;
 class FViewport;
+struct FHeadlessOptions;
 
 class UGameEngine final
 {
@@ -16,6 +17,13 @@ public:
     void MainLoop();
     void Shutdown();
 
+    /**
+     * @brief 창/렌더러/오디오/입력 장치 없이 씬을 고정 시간 간격으로 Tick하고 타이밍을 JSON으로 저장
+     * @return 프로세스 종료 코드 (0 = 성공). 반환 후 Shutdown()을 호출해야 함
+     */
+    int32 RunHeadless(const FHeadlessOptions& Options);
+    bool IsHeadless() const { return bHeadless; }
+
     bool IsPlayActive() const { return bPlayActive; }
 
     HWND GetHWND() const { return HWnd; }
@@ -58,6 +66,7 @@ private:
     bool bRunning = false;
     bool bUVScrollPaused = true;
     bool bPlayActive = false;
+    bool bHeadless = false;
     float UVScrollTime = 0.0f;
     FVector2D UVScrollSpeed = FVector2D(0.5f, 0.5f);
 
@@ -0,0 +1,437 @@
+#include "pch.h"
+#include "HeadlessBenchmark.h"
+#include "Level.h"
+#include "EmptyActor.h"
+#include "StaticMeshActor.h"
+#include "StaticMeshComponent.h"
+#include "RotatingMovementComponent.h"
+#include "PhysBoxActor.h"
+#include "PhysGroundActor.h"
+#include "ParticleSystemComponent.h"
+#include "ParticleSystem.h"
+#include "SkeletalMeshActor.h"
+#include "SkeletalMesh.h"
+#include "AnimSequence.h"
+#include "LuaScriptComponent.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+
+namespace
+{
+    // 기준 씬의 기본(Scale = 1) 액터 수
+    constexpr int32 NumStaticMeshActors = 10000;
+    constexpr int32 NumPhysicsBoxes = 1500;
+    constexpr int32 NumParticleSystems = 200;
+    constexpr int32 NumSkinnedCharacters = 200;
+    constexpr int32 NumLuaActors = 2000;
+
+    int32 ScaleCount(int32 Count, float Scale)
+    {
+        return std::max(1, static_cast<int32>(static_cast<float>(Count) * Scale + 0.5f));
+    }
+
+    /** Count개를 바둑판으로 배치할 때 Index번째 위치 (원점 중심) */
+    FVector GetGridLocation(int32 Index, int32 Count, float Spacing, float Z)
+    {
+        const int32 Side = std::max(1, static_cast<int32>(std::ceil(std::sqrt(static_cast<float>(Count)))));
+        const float HalfExtent = static_cast<float>(Side - 1) * Spacing * 0.5f;
+        return FVector(
+            static_cast<float>(Index % Side) * Spacing - HalfExtent,
+            static_cast<float>(Index / Side) * Spacing - HalfExtent,
+            Z);
+    }
+
+    void PopulateActors(UWorld* World, float Scale)
+    {
+        // 회전 이동 컴포넌트로 매 프레임 트랜스폼/바운드 갱신 (Tick + 파티션 갱신 비용)
+        const int32 Count = ScaleCount(NumStaticMeshActors, Scale);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>();
+            Actor->SetActorLocation(GetGridLocation(Index, Count, 3.0f, 0.0f));
+            Actor->GetStaticMeshComponent()->SetStaticMesh(GDataDir + "/cube-tex.obj");
+
+            URotatingMovementComponent* Rotating = Cast<URotatingMovementComponent>(
+                Actor->AddNewComponent(URotatingMovementComponent::StaticClass()));
+            Rotating->SetRotationRate(FVector(0.0f, 0.0f, 30.0f + static_cast<float>(Index % 7) * 10.0f));
+        }
+    }
+
+    void PopulatePhysics(UWorld* World, float Scale)
+    {
+        // 바닥 위 10 x 10 기둥으로 쌓아 떨어뜨림 (접촉이 계속 생기도록)
+        World->SpawnActor<APhysGroundActor>();
+
+        const int32 Count = ScaleCount(NumPhysicsBoxes, Scale);
+        const int32 BoxesPerLayer = 100;
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const int32 Layer = Index / BoxesPerLayer;
+            FVector Location = GetGridLocation(Index % BoxesPerLayer, BoxesPerLayer, 1.1f, 2.0f + static_cast<float>(Layer) * 1.5f);
+            // 층마다 조금씩 어긋나게 쌓아 무너지도록
+            Location.X += (Layer & 1) ? 0.3f : -0.3f;
+
+            APhysBoxActor* Box = World->SpawnActor<APhysBoxActor>();
+            Box->SetActorLocation(Location);
+        }
+    }
+
+    void PopulateParticles(UWorld* World, float Scale)
+    {
+        const char* const Templates[] = { "fire", "explosion", "ice", "electric", "Magic", "fireworks" };
+
+        const int32 Count = ScaleCount(NumParticleSystems, Scale);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            AEmptyActor* Actor = World->SpawnActor<AEmptyActor>();
+            Actor->SetActorLocation(GetGridLocation(Index, Count, 10.0f, 0.0f));
+
+            UParticleSystemComponent* Particles = Cast<UParticleSystemComponent>(
+                Actor->AddNewComponent(UParticleSystemComponent::StaticClass()));
+            const FString TemplatePath = GDataDir + "/Particles/" + Templates[Index % 6] + ".particle";
+            if (UParticleSystem* Template = UResourceManager::GetInstance().Load<UParticleSystem>(TemplatePath))
+            {
+                Particles->SetTemplate(Template);
+            }
+        }
+    }
+
+    void PopulateSkinned(UWorld* World, float Scale)
+    {
+        const int32 Count = ScaleCount(NumSkinnedCharacters, Scale);
+        UAnimSequence* Animation = nullptr;
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            ASkeletalMeshActor* Actor = World->SpawnActor<ASkeletalMeshActor>();
+            Actor->SetActorLocation(GetGridLocation(Index, Count, 2.0f, 0.0f));
+
+            USkeletalMeshComponent* Mesh = Actor->GetSkeletalMeshComponent();
+            if (!Mesh || !Mesh->GetSkeletalMesh())
+            {
+                continue;
+            }
+
+            // FBX에서 함께 로드된 애니메이션은 "<메시 경로(확장자 제외)>_<테이크 이름>"으로 등록됨
+            if (!Animation)
+            {
+                const FString& MeshPath = Mesh->GetSkeletalMesh()->GetFilePath();
+                const FString Prefix = MeshPath.substr(0, MeshPath.find_last_of('.')) + "_";
+                for (UAnimSequence* Candidate : UResourceManager::GetInstance().GetAll<UAnimSequence>())
+                {
+                    if (Candidate->GetFilePath().rfind(Prefix, 0) == 0)
+                    {
+                        Animation = Candidate;
+                        break;
+                    }
+                }
+                if (!Animation)
+                {
+                    UE_LOG("[warning] Headless: no animation found for %s, characters stay in reference pose", MeshPath.c_str());
+                }
+            }
+
+            if (Animation)
+            {
+                // 모두 같은 포즈가 되지 않도록 재생 속도를 조금씩 다르게
+                Mesh->PlayAnimation(Animation, true, 0.8f + static_cast<float>(Index % 5) * 0.1f);
+            }
+        }
+    }
+
+    void PopulateLua(UWorld* World, float Scale)
+    {
+        const int32 Count = ScaleCount(NumLuaActors, Scale);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>();
+            Actor->SetActorLocation(GetGridLocation(Index, Count, 3.0f, 0.0f));
+            Actor->GetStaticMeshComponent()->SetStaticMesh(GDataDir + "/cube-tex.obj");
+
+            ULuaScriptComponent* Script = Cast<ULuaScriptComponent>(
+                Actor->AddNewComponent(ULuaScriptComponent::StaticClass()));
+            Script->ScriptFilePath = GDataDir + "/Scripts/HeadlessBenchmark.lua";
+        }
+    }
+
+    double Average(const TArray<float>& Samples)
+    {
+        double Sum = 0.0;
+        for (float Sample : Samples)
+        {
+            Sum += Sample;
+        }
+        return Samples.IsEmpty() ? 0.0 : Sum / static_cast<double>(Samples.size());
+    }
+
+    /** "-key=value" 토큰 (값은 큰따옴표로 감쌀 수 있음) */
+    bool MatchOption(const FString& Token, const char* Key, FString& OutValue)
+    {
+        const size_t KeyLength = strlen(Key);
+        if (Token.size() <= KeyLength + 1 || _strnicmp(Token.c_str(), Key, KeyLength) != 0 || Token[KeyLength] != '=')
+        {
+            return false;
+        }
+        OutValue = Token.substr(KeyLength + 1);
+        return true;
+    }
+}
+
+bool FHeadlessOptions::Parse(const char* CommandLine)
+{
+    // 공백으로 나누되 큰따옴표 안의 공백은 유지 (따옴표는 제거)
+    TArray<FString> Tokens;
+    FString Current;
+    bool bInQuotes = false;
+    for (const char* It = CommandLine ? CommandLine : ""; ; ++It)
+    {
+        if (*It == '"')
+        {
+            bInQuotes = !bInQuotes;
+        }
+        else if (*It == '\0' || (*It == ' ' && !bInQuotes))
+        {
+            if (!Current.empty())
+            {
+                Tokens.Add(Current);
+                Current.clear();
+            }
+            if (*It == '\0')
+            {
+                break;
+            }
+        }
+        else
+        {
+            Current += *It;
+        }
+    }
+
+    bool bHeadless = false;
+    for (const FString& Token : Tokens)
+    {
+        FString Value;
+        if (_stricmp(Token.c_str(), "-headless") == 0)
+        {
+            bHeadless = true;
+        }
+        else if (const FBenchmarkEntry* Entry = FBenchmarkRegistry::FindByHeadlessFlag(Token.c_str()))
+        {
+            Benchmark = Entry;
+        }
+        else if (_stricmp(Token.c_str(), "-luabatchtick") == 0)
+        {
+            bBatchedScriptTick = true;
+        }
+        else if (MatchOption(Token, "-scene", Value))
+        {
+            ScenePath = Value;
+        }
+        else if (MatchOption(Token, "-bench", Value))
+        {
+            ReferenceScene = Value;
+        }
+        else if (MatchOption(Token, "-out", Value))
+        {
+            OutputPath = Value;
+        }
+        else if (MatchOption(Token, "-frames", Value))
+        {
+            NumFrames = std::max(1, atoi(Value.c_str()));
+        }
+        else if (MatchOption(Token, "-warmup", Value))
+        {
+            NumWarmupFrames = std::max(0, atoi(Value.c_str()));
+        }
+        else if (MatchOption(Token, "-fixeddt", Value))
+        {
+            const float Seconds = static_cast<float>(atof(Value.c_str()));
+            if (Seconds > 0.0f)
+            {
+                FixedDeltaSeconds = Seconds;
+            }
+        }
+        else if (MatchOption(Token, "-recordinput", Value))
+        {
+            RecordInputPath = Value;
+        }
+        else if (MatchOption(Token, "-replayinput", Value))
+        {
+            ReplayInputPath = Value;
+        }
+        else if (MatchOption(Token, "-scale", Value))
+        {
+            const float ParsedScale = static_cast<float>(atof(Value.c_str()));
+            if (ParsedScale > 0.0f)
+            {
+                Scale = ParsedScale;
+            }
+        }
+    }
+
+    // 씬을 지정하지 않으면 가장 일반적인 기준 씬 사용
+    if (bHeadless && ScenePath.empty() && ReferenceScene.empty())
+    {
+        ReferenceScene = "Actors";
+    }
+    return bHeadless;
+}
+
+const TArray<FString>& FHeadlessBenchmark::GetReferenceSceneNames()
+{
+    static const TArray<FString> Names = { "Actors", "Physics", "Particles", "Skinned", "Lua" };
+    return Names;
+}
+
+bool FHeadlessBenchmark::PopulateReferenceScene(UWorld* World, const FString& Name, float Scale)
+{
+    if (_stricmp(Name.c_str(), "Actors") == 0)
+    {
+        PopulateActors(World, Scale);
+    }
+    else if (_stricmp(Name.c_str(), "Physics") == 0)
+    {
+        PopulatePhysics(World, Scale);
+    }
+    else if (_stricmp(Name.c_str(), "Particles") == 0)
+    {
+        PopulateParticles(World, Scale);
+    }
+    else if (_stricmp(Name.c_str(), "Skinned") == 0)
+    {
+        PopulateSkinned(World, Scale);
+    }
+    else if (_stricmp(Name.c_str(), "Lua") == 0)
+    {
+        PopulateLua(World, Scale);
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+void FHeadlessBenchmark::RecordFrame(double FrameMS)
+{
+    const uint32 NumStats = FProfiler::GetNumStats();
+    if (Stats.Num() < static_cast<int32>(NumStats))
+    {
+        Stats.SetNum(NumStats);
+    }
+
+    const int32 FrameIndex = FrameTimes.Num();
+    FrameTimes.Add(static_cast<float>(FrameMS));
+
+    // 애니메이션 빈도 통계는 방금 끝난 월드 Tick 기준 (Tick 시작에서 리셋됨)
+    const FAnimUpdateRateStats& AnimStats = FAnimUpdateRateStatManager::GetInstance().GetStats();
+    AnimTotals.TickedComponents += AnimStats.TickedComponents;
+    AnimTotals.EvaluatedComponents += AnimStats.EvaluatedComponents;
+    AnimTotals.InterpolatedComponents += AnimStats.InterpolatedComponents;
+    AnimTotals.FrozenComponents += AnimStats.FrozenComponents;
+    AnimTotals.MaskedBones += AnimStats.MaskedBones;
+
+    for (uint32 Index = 1; Index < NumStats; ++Index)
+    {
+        const FStatFrameData& Data = FProfiler::GetLastFrameData(TStatId{ Index });
+        FStatSamples& Samples = Stats[Index];
+
+        // 중간에 등록된 스탯은 앞 프레임을 0으로 채움
+        Samples.InclusiveMS.SetNum(FrameIndex + 1);
+        Samples.InclusiveMS[FrameIndex] = static_cast<float>(Data.InclusiveMS);
+        Samples.TotalExclusiveMS += Data.ExclusiveMS;
+        Samples.TotalCalls += Data.CallCount;
+        Samples.TotalCounter += Data.CounterValue;
+        Samples.MaxCounter = std::max(Samples.MaxCounter, Data.CounterValue);
+    }
+}
+
+bool FHeadlessBenchmark::WriteReport(const FHeadlessOptions& Options, const FString& SceneName, int32 NumActors, double LoadMS) const
+{
+    std::ofstream File(Options.OutputPath);
+    if (!File.is_open())
+    {
+        UE_LOG("[error] Headless: failed to open %s", Options.OutputPath.c_str());
+        return false;
+    }
+    File.setf(std::ios::fixed);
+    File.precision(4);
+
+    const double NumFrames = std::max<double>(1.0, static_cast<double>(FrameTimes.Num()));
+    double TotalMS = 0.0;
+    for (float FrameMS : FrameTimes)
+    {
+        TotalMS += FrameMS;
+    }
+
+    File << "{\n  \"scene\": ";
+    WriteJsonString(File, SceneName);
+    File << ",\n  \"scale\": " << Options.Scale;
+    File << ",\n  \"actors\": " << NumActors;
+    File << ",\n  \"frames\": " << FrameTimes.Num();
+    File << ",\n  \"warmupFrames\": " << Options.NumWarmupFrames;
+    File << ",\n  \"fixedDeltaSeconds\": " << Options.FixedDeltaSeconds;
+    File << ",\n  \"batchedScriptTick\": " << (Options.bBatchedScriptTick ? "true" : "false");
+    File << ",\n  \"animUpdateRate\": { \"optimizations\": " << (USkeletalMeshComponent::AreUpdateRateOptimizationsAllowed() ? "true" : "false")
+        << ", \"tickedPerFrame\": " << AnimTotals.TickedComponents / NumFrames
+        << ", \"evaluatedPerFrame\": " << AnimTotals.EvaluatedComponents / NumFrames
+        << ", \"interpolatedPerFrame\": " << AnimTotals.InterpolatedComponents / NumFrames
+        << ", \"frozenPerFrame\": " << AnimTotals.FrozenComponents / NumFrames << " }";
+    if (!Options.ReplayInputPath.empty())
+    {
+        File << ",\n  \"inputReplay\": ";
+        WriteJsonString(File, Options.ReplayInputPath);
+    }
+    File << ",\n  \"loadMs\": " << LoadMS;
+    File << ",\n  \"totalMs\": " << TotalMS;
+    File << ",\n  \"frameMs\": { \"avg\": " << TotalMS / NumFrames
+        << ", \"p50\": " << Percentile(FrameTimes, 0.5f)
+        << ", \"p95\": " << Percentile(FrameTimes, 0.95f)
+        << ", \"p99\": " << Percentile(FrameTimes, 0.99f)
+        << ", \"max\": " << Percentile(FrameTimes, 1.0f) << " }";
+
+    // 측정 구간에서 한 번이라도 호출된 스탯만 (포함 시간 평균, 자기 시간 평균, 프레임당 호출 수)
+    File << ",\n  \"stats\": [";
+    bool bFirst = true;
+    for (int32 Index = 1; Index < Stats.Num(); ++Index)
+    {
+        const FStatSamples& Samples = Stats[Index];
+        const FStatDescriptor& Desc = FProfiler::GetStatDescriptor(TStatId{ static_cast<uint32>(Index) });
+        if (Desc.Type != EStatType::Cycle || Samples.TotalCalls == 0)
+        {
+            continue;
+        }
+        File << (bFirst ? "\n    " : ",\n    ") << "{ \"name\": ";
+        WriteJsonString(File, Desc.Name);
+        File << ", \"group\": ";
+        WriteJsonString(File, Desc.Group);
+        File << ", \"avgMs\": " << Average(Samples.InclusiveMS)
+            << ", \"avgExclusiveMs\": " << Samples.TotalExclusiveMS / NumFrames
+            << ", \"p95Ms\": " << Percentile(Samples.InclusiveMS, 0.95f)
+            << ", \"maxMs\": " << Percentile(Samples.InclusiveMS, 1.0f)
+            << ", \"callsPerFrame\": " << static_cast<double>(Samples.TotalCalls) / NumFrames << " }";
+        bFirst = false;
+    }
+    File << "\n  ],\n  \"counters\": [";
+    bFirst = true;
+    for (int32 Index = 1; Index < Stats.Num(); ++Index)
+    {
+        const FStatSamples& Samples = Stats[Index];
+        const FStatDescriptor& Desc = FProfiler::GetStatDescriptor(TStatId{ static_cast<uint32>(Index) });
+        if (Desc.Type != EStatType::Counter || (Samples.TotalCounter == 0 && Samples.MaxCounter == 0))
+        {
+            continue;
+        }
+        File << (bFirst ? "\n    " : ",\n    ") << "{ \"name\": ";
+        WriteJsonString(File, Desc.Name);
+        File << ", \"group\": ";
+        WriteJsonString(File, Desc.Group);
+        File << ", \"avg\": " << static_cast<double>(Samples.TotalCounter) / NumFrames
+            << ", \"max\": " << Samples.MaxCounter << " }";
+        bFirst = false;
+    }
+    File << "\n  ]\n}\n";
+
+    UE_LOG("Headless: %s, %d frames, avg %.3f ms/frame (p95 %.3f ms) -> %s",
+        SceneName.c_str(), FrameTimes.Num(), TotalMS / NumFrames, Percentile(FrameTimes, 0.95f), Options.OutputPath.c_str());
+    return true;
+}
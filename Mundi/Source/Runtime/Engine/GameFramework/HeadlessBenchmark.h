@@ -0,0 +1,77 @@
+#pragma once
+#include "UEContainer.h"
+#include "AnimUpdateRate.h"
+
+class UWorld;
+struct FBenchmarkEntry;
+
+/**
+ * @brief 헤드리스 실행 옵션 (명령줄)
+ *
+ *   Mundi.exe -headless -bench=Particles -frames=600 -out=Particles.json
+ *   Mundi.exe -headless -scene=Data/Scenes/PhysicsTest.scene -fixeddt=0.0166667
+ *   Mundi.exe -headless -scene=Data/Scenes/PlayScene.scene -replayinput=Fly.inputrec
+ *   Mundi.exe -headless -memorybench
+ *   Mundi.exe -headless -lightcullbench -out=LightCulling.json
+ *   Mundi.exe -headless -frustumbench -out=FrustumCulling.json
+ *   Mundi.exe -headless -bench=Actors -occlusionbench -out=Occlusion.json
+ *   Mundi.exe -headless -levelloadbench -out=LevelLoad.json
+ *   Mundi.exe -headless -asyncloadstress -out=AsyncLoadStress.json
+ *   Mundi.exe -headless -meshcachebench -out=MeshCache.json
+ *
+ * 창, 스왑체인, 렌더러, ImGui, 오디오 장치, 입력 장치 없이 월드만 고정 시간 간격으로 Tick합니다.
+ * -recordinput / -replayinput은 창 모드 게임 실행에도 적용됩니다 (PlayScene 시작부터 기록/재생).
+ * 벤치마크 플래그는 FBenchmarkRegistry에 등록된 항목이며 콘솔 명령과 같은 함수를 실행합니다.
+ */
+struct FHeadlessOptions
+{
+    FString ScenePath;                              // -scene=<path>  레벨 파일 로드
+    FString ReferenceScene;                         // -bench=<name>  코드로 생성하는 기준 씬 (GetReferenceSceneNames)
+    FString OutputPath = "HeadlessBenchmark.json";  // -out=<path>
+    int32 NumFrames = 600;                          // -frames=N     측정 프레임 수
+    int32 NumWarmupFrames = 60;                     // -warmup=N     측정 전에 버리는 프레임 수
+    float FixedDeltaSeconds = 1.0f / 60.0f;         // -fixeddt=<seconds>
+    float Scale = 1.0f;                             // -scale=<x>    기준 씬 액터 수 배율
+    FString RecordInputPath;                        // -recordinput=<path>  창 모드 전용, -fixeddt 간격으로 기록
+    FString ReplayInputPath;                        // -replayinput=<path>  기록 길이만큼 재생 (헤드리스는 -frames 무시)
+    bool bBatchedScriptTick = false;                // -luabatchtick  Lua 스크립트 Tick을 FLuaManager 배치 디스패치로 실행
+    const FBenchmarkEntry* Benchmark = nullptr;     // -<flag>  월드 Tick 대신 등록된 벤치마크를 Stage 준비 후 실행
+
+    /** @return 명령줄에 -headless가 있으면 true */
+    bool Parse(const char* CommandLine);
+};
+
+/**
+ * @brief 헤드리스 실행의 기준 씬 생성과 프레임별 스탯 수집
+ *
+ * 서브시스템 시간은 FProfiler 스탯(World/Physics/Animation/Particles/Lua 그룹)을 프레임마다 읽어 모읍니다.
+ */
+class FHeadlessBenchmark
+{
+public:
+    /** Actors, Physics, Particles, Skinned, Lua */
+    static const TArray<FString>& GetReferenceSceneNames();
+
+    /** 빈 월드에 기준 씬 액터를 배치 (BeginPlay 전) @return 알 수 없는 이름이면 false */
+    static bool PopulateReferenceScene(UWorld* World, const FString& Name, float Scale);
+
+    /** FProfiler::MarkFrame 직후 호출: 방금 끝난 프레임의 스탯 값을 기록 */
+    void RecordFrame(double FrameMS);
+
+    /** 기록한 프레임의 요약(평균/최대/백분위)을 JSON으로 저장 */
+    bool WriteReport(const FHeadlessOptions& Options, const FString& SceneName, int32 NumActors, double LoadMS) const;
+
+private:
+    struct FStatSamples
+    {
+        TArray<float> InclusiveMS;      // 프레임별 (스탯이 호출되지 않은 프레임은 0)
+        double TotalExclusiveMS = 0.0;
+        uint64 TotalCalls = 0;
+        int64 TotalCounter = 0;
+        int64 MaxCounter = 0;
+    };
+
+    TArray<float> FrameTimes;
+    TArray<FStatSamples> Stats;         // 인덱스 = TStatId::Index
+    FAnimUpdateRateStats AnimTotals;    // 기록한 프레임의 애니메이션 업데이트 빈도 통계 합계
+};
@@ -12,6 +12,7 @@
 #include "World.h"
 #include "JsonSerializer.h"
 #include "SceneComponent.h"
+#include "LevelCooker.h"
 
 static inline FString RemoveObjExtension(const FString& FileName)
 {
@@ -135,6 +136,8 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
                 if (NewActor)
                 {
                     NewActor->Serialize(bInIsLoading, ActorDataJson);
+                    // 역직렬화로 바뀐 이름/태그/컴포넌트를 인덱스에 반영
+                    QueryIndex.RefreshActor(NewActor);
                 }
             }
         }
@@ -183,3 +186,101 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         InOutHandle["Actors"] = ActorListJson;
     }
 }
+
+void ULevel::LoadCooked(FCookedLevel& InCookedLevel)
+{
+    // 헤더에는 비어있는 Actors가 들어있으므로 카메라 등 레벨 정보만 로드됨
+    Serialize(true, InCookedLevel.Header);
+
+    // 컴포넌트 프로퍼티는 에셋 테이블 인덱스로 참조하므로 먼저 한 번씩 로드
+    FLevelCooker::PreloadAssets(InCookedLevel);
+
+    // 클래스별 인스턴스를 한 번에 생성 (레지스트리 조회/GUObjectArray 확장은 클래스당 한 번)
+    TArray<TArray<UObject*>> ClassPools(InCookedLevel.Classes.Num());
+    TArray<int32> PoolCursors(InCookedLevel.Classes.Num(), 0);
+    for (int32 i = 0; i < InCookedLevel.Classes.Num(); ++i)
+    {
+        const FCookedClass& CookedClass = InCookedLevel.Classes[i];
+        ObjectFactory::NewObjects(CookedClass.Class, static_cast<int32>(CookedClass.NumInstances), ClassPools[i]);
+    }
+    auto TakeObject = [&](uint32 ClassIndex) -> UObject*
+    {
+        TArray<UObject*>& Pool = ClassPools[ClassIndex];
+        return PoolCursors[ClassIndex] < Pool.Num() ? Pool[PoolCursors[ClassIndex]++] : nullptr;
+    };
+
+    Actors.reserve(Actors.size() + InCookedLevel.Actors.size());
+
+    // 고정 레이아웃 값은 ApplyProperties가 기록하고, Serialize는 나머지 키와 클래스별 후처리만 수행
+    FCookedLoadScope CookedScope;
+    JSON EmptyExtra = JSON::Make(JSON::Class::Object);
+    auto GetExtra = [&](const FCookedObjectRecord& Record) -> JSON&
+    {
+        return Record.ExtraIndex >= 0 ? InCookedLevel.Extras[Record.ExtraIndex] : EmptyExtra;
+    };
+
+    TArray<UActorComponent*> Components;
+    for (const FCookedActorRecord& Record : InCookedLevel.Actors)
+    {
+        AActor* NewActor = static_cast<AActor*>(TakeObject(Record.Object.ClassIndex));
+        if (!NewActor)
+        {
+            UE_LOG("SpawnActor failed: ObjectFactory could not create an instance of %s", InCookedLevel.Classes[Record.Object.ClassIndex].Class->Name);
+            continue;
+        }
+
+        // 액터 생성자에서 만들어진 컴포넌트를 무시하고 저장된 컴포넌트만 다시 붙인다
+        NewActor->DestroyAllComponents();
+        FLevelCooker::ApplyProperties(InCookedLevel, Record.Object, NewActor);
+
+        Components.Empty();
+        for (uint32 i = 0; i < Record.NumComponents; ++i)
+        {
+            const FCookedObjectRecord& ComponentRecord = InCookedLevel.Components[Record.FirstComponent + i];
+            UActorComponent* NewComponent = static_cast<UActorComponent*>(TakeObject(ComponentRecord.ClassIndex));
+            Components.Add(NewComponent);
+            if (!NewComponent)
+            {
+                continue;
+            }
+
+            FLevelCooker::ApplyProperties(InCookedLevel, ComponentRecord, NewComponent);
+            USceneComponent* NewSceneComponent = Cast<USceneComponent>(NewComponent);
+            if (NewSceneComponent)
+            {
+                const bool bHasParent = ComponentRecord.ParentIndex != UINT32_MAX;
+                NewSceneComponent->SetSceneId(ComponentRecord.SceneId);
+                NewSceneComponent->SetParentId(bHasParent ? InCookedLevel.Components[Record.FirstComponent + ComponentRecord.ParentIndex].SceneId : 0);
+            }
+            NewComponent->Serialize(true, GetExtra(ComponentRecord));
+
+            if (NewSceneComponent && i == Record.RootComponent)
+            {
+                NewActor->SetRootComponent(NewSceneComponent);
+            }
+            NewActor->AddOwnedComponent(NewComponent);
+        }
+
+        // 부모 자식 관계 (쿠킹 시 액터 내부 인덱스로 해석됨)
+        for (uint32 i = 0; i < Record.NumComponents; ++i)
+        {
+            const FCookedObjectRecord& ComponentRecord = InCookedLevel.Components[Record.FirstComponent + i];
+            if (ComponentRecord.ParentIndex == UINT32_MAX)
+            {
+                continue;
+            }
+            USceneComponent* SceneComp = Cast<USceneComponent>(Components[i]);
+            USceneComponent* Parent = Cast<USceneComponent>(Components[ComponentRecord.ParentIndex]);
+            if (SceneComp && Parent)
+            {
+                SceneComp->SetupAttachment(Parent, EAttachmentRule::KeepRelative);
+            }
+        }
+
+        // 파생 액터의 후처리 (컴포넌트 포인터 캐싱 등)
+        NewActor->Serialize(true, GetExtra(Record.Object));
+
+        AddActor(NewActor);
+        QueryIndex.RefreshActor(NewActor);
+    }
+}
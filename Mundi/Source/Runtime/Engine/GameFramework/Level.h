@@ -2,8 +2,11 @@
 #include "Object.h"
 #include "UEContainer.h"
 #include "Actor.h"
+#include "ActorQueryIndex.h"
 #include <algorithm>
 
+struct FCookedLevel;
+
 class ULevel : public UObject
 {
 public:
@@ -12,19 +15,29 @@ public:
     ~ULevel() override = default;
 
     const TArray<AActor*>& GetActors() const { return Actors; }
-    void AddActor(AActor* Actor) { if (Actor) Actors.Add(Actor); }
+    void AddActor(AActor* Actor) { if (Actor) { Actors.Add(Actor); QueryIndex.AddActor(Actor); } }
     void SpawnDefaultActors();
     bool RemoveActor(AActor* Actor)
     {
         auto it = std::find(Actors.begin(), Actors.end(), Actor);
-        if (it != Actors.end()) { Actors.erase(it); return true; }
+        if (it != Actors.end()) { Actors.erase(it); QueryIndex.RemoveActor(Actor); return true; }
         return false;
     }
-    void Clear() { Actors.Empty(); }
+    void Clear() { Actors.Empty(); QueryIndex.Empty(); }
+
+    // 클래스/이름/태그 검색용 인덱스 (UWorld::Find* 가 사용)
+    FActorQueryIndex& GetQueryIndex() { return QueryIndex; }
+    const FActorQueryIndex& GetQueryIndex() const { return QueryIndex; }
 
     void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+
+    /**
+     * @brief 쿠킹된 레벨로부터 액터를 생성 (클래스/에셋 조회는 쿠킹 데이터에서 이미 해석됨)
+     */
+    void LoadCooked(FCookedLevel& InCookedLevel);
 private:
     TArray<AActor*> Actors;
+    FActorQueryIndex QueryIndex;
 };
 
 class ULevelService
@@ -0,0 +1,926 @@
+#include "pch.h"
+#include "LevelCooker.h"
+#include "Level.h"
+#include "Actor.h"
+#include "ActorComponent.h"
+#include "StaticMesh.h"
+#include "SkeletalMesh.h"
+#include "Texture.h"
+#include "Material.h"
+#include "ParticleSystem.h"
+#include "SceneComponent.h"
+#include "MappedFileReader.h"
+#include "CacheFileHeader.h"
+
+namespace
+{
+    // 바이너리 인코딩된 JSON 값의 타입 태그
+    enum class ECookedValueTag : uint8
+    {
+        Null,
+        Object,
+        Array,
+        String,
+        Floating,
+        Integral,
+        Boolean
+    };
+
+    // SimpleJSON의 ToString()은 이스케이프된 문자열을 돌려주므로 원문으로 되돌린다
+    FString UnescapeJsonString(const FString& InEscaped)
+    {
+        FString Result;
+        Result.reserve(InEscaped.size());
+        for (size_t i = 0; i < InEscaped.size(); ++i)
+        {
+            const char C = InEscaped[i];
+            if (C != '\\' || i + 1 >= InEscaped.size())
+            {
+                Result.push_back(C);
+                continue;
+            }
+
+            switch (InEscaped[++i])
+            {
+            case '\"': Result.push_back('\"'); break;
+            case '\\': Result.push_back('\\'); break;
+            case 'b':  Result.push_back('\b'); break;
+            case 'f':  Result.push_back('\f'); break;
+            case 'n':  Result.push_back('\n'); break;
+            case 'r':  Result.push_back('\r'); break;
+            case 't':  Result.push_back('\t'); break;
+            default:   Result.push_back('\\'); Result.push_back(InEscaped[i]); break;
+            }
+        }
+        return Result;
+    }
+
+    class FCookStringTable
+    {
+    public:
+        uint32 GetIndex(const FString& InString)
+        {
+            auto It = Indices.find(InString);
+            if (It != Indices.end())
+            {
+                return It->second;
+            }
+            const uint32 NewIndex = static_cast<uint32>(Strings.Num());
+            Strings.Add(InString);
+            Indices.Add(InString, NewIndex);
+            return NewIndex;
+        }
+
+        const TArray<FString>& GetStrings() const { return Strings; }
+
+    private:
+        TArray<FString> Strings;
+        TMap<FString, uint32> Indices;
+    };
+
+    void EncodeValue(FArchive& Ar, FCookStringTable& StringTable, const JSON& Value)
+    {
+        switch (Value.JSONType())
+        {
+        case JSON::Class::Object:
+        {
+            uint8 Tag = static_cast<uint8>(ECookedValueTag::Object);
+            uint32 Count = static_cast<uint32>(Value.size());
+            Ar << Tag << Count;
+            for (const auto& Pair : Value.ObjectRange())
+            {
+                uint32 KeyIndex = StringTable.GetIndex(Pair.first);
+                Ar << KeyIndex;
+                EncodeValue(Ar, StringTable, Pair.second);
+            }
+            break;
+        }
+        case JSON::Class::Array:
+        {
+            uint8 Tag = static_cast<uint8>(ECookedValueTag::Array);
+            uint32 Count = static_cast<uint32>(Value.size());
+            Ar << Tag << Count;
+            for (const JSON& Element : Value.ArrayRange())
+            {
+                EncodeValue(Ar, StringTable, Element);
+            }
+            break;
+        }
+        case JSON::Class::String:
+        {
+            uint8 Tag = static_cast<uint8>(ECookedValueTag::String);
+            uint32 StringIndex = StringTable.GetIndex(UnescapeJsonString(Value.ToString()));
+            Ar << Tag << StringIndex;
+            break;
+        }
+        case JSON::Class::Floating:
+        {
+            uint8 Tag = static_cast<uint8>(ECookedValueTag::Floating);
+            double Float = Value.ToFloat();
+            Ar << Tag << Float;
+            break;
+        }
+        case JSON::Class::Integral:
+        {
+            uint8 Tag = static_cast<uint8>(ECookedValueTag::Integral);
+            int64 Int = static_cast<int64>(Value.ToInt());
+            Ar << Tag << Int;
+            break;
+        }
+        case JSON::Class::Boolean:
+        {
+            uint8 Tag = static_cast<uint8>(ECookedValueTag::Boolean);
+            uint8 Bool = Value.ToBool() ? 1 : 0;
+            Ar << Tag << Bool;
+            break;
+        }
+        default:
+        {
+            uint8 Tag = static_cast<uint8>(ECookedValueTag::Null);
+            Ar << Tag;
+            break;
+        }
+        }
+    }
+
+    JSON DecodeValue(FArchive& Ar, const TArray<FString>& Strings)
+    {
+        auto ReadStringIndex = [&]() -> const FString&
+        {
+            uint32 Index;
+            Ar << Index;
+            if (Index >= static_cast<uint32>(Strings.Num()))
+            {
+                throw std::runtime_error("Cooked level corrupt: string index out of range.");
+            }
+            return Strings[Index];
+        };
+
+        uint8 Tag;
+        Ar << Tag;
+        switch (static_cast<ECookedValueTag>(Tag))
+        {
+        case ECookedValueTag::Object:
+        {
+            uint32 Count;
+            Ar << Count;
+            JSON Object = JSON::Make(JSON::Class::Object);
+            for (uint32 i = 0; i < Count; ++i)
+            {
+                const FString& Key = ReadStringIndex();
+                Object[Key] = DecodeValue(Ar, Strings);
+            }
+            return Object;
+        }
+        case ECookedValueTag::Array:
+        {
+            uint32 Count;
+            Ar << Count;
+            if (Count > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+            {
+                throw std::runtime_error("Cooked level corrupt: array size is unreasonable.");
+            }
+            JSON Array = JSON::Make(JSON::Class::Array);
+            for (uint32 i = 0; i < Count; ++i)
+            {
+                Array[i] = DecodeValue(Ar, Strings);
+            }
+            return Array;
+        }
+        case ECookedValueTag::String:
+        {
+            JSON String;
+            String = ReadStringIndex();
+            return String;
+        }
+        case ECookedValueTag::Floating:
+        {
+            double Float;
+            Ar << Float;
+            return JSON(Float);
+        }
+        case ECookedValueTag::Integral:
+        {
+            int64 Int;
+            Ar << Int;
+            return JSON(static_cast<long>(Int));
+        }
+        case ECookedValueTag::Boolean:
+        {
+            uint8 Bool;
+            Ar << Bool;
+            return JSON(Bool != 0);
+        }
+        case ECookedValueTag::Null:
+            return JSON();
+        default:
+            throw std::runtime_error("Cooked level corrupt: unknown value tag.");
+        }
+    }
+
+    // 고정 레이아웃 값 하나의 크기 (문자열/에셋은 테이블 인덱스)
+    uint32 GetFixedLayoutSize(EPropertyType Type)
+    {
+        switch (Type)
+        {
+        case EPropertyType::Bool:
+            return 1;
+        case EPropertyType::FVector:
+            return sizeof(float) * 3;
+        case EPropertyType::FLinearColor:
+        case EPropertyType::Curve:
+            return sizeof(float) * 4;
+        default:
+            return 4;   // int32, float, 문자열 인덱스, 에셋 인덱스
+        }
+    }
+
+    uint32 GetPresenceMaskSize(int32 NumSlots)
+    {
+        return static_cast<uint32>((NumSlots + 7) / 8);
+    }
+
+    struct FCookClassEntry
+    {
+        UClass* Class = nullptr;
+        uint32 NameIndex = 0;
+        TArray<const FProperty*> Layout;
+        TSet<FString> LayoutNames;          // Extras에서 제외할 키
+        uint32 RecordSize = 0;
+    };
+
+    class FLevelCookContext
+    {
+    public:
+        FCookStringTable Strings;
+        TArray<FCookClassEntry> Classes;
+        TArray<FCookedAssetRef> AssetRefs;
+        uint32 PropertyDataSize = 0;
+
+        /** @return Base의 파생 클래스가 아니면 false */
+        bool FindOrAddClass(const FString& ClassName, UClass* Base, uint32& OutIndex)
+        {
+            if (uint32* Found = ClassIndexByName.Find(ClassName))
+            {
+                OutIndex = *Found;
+                return Classes[OutIndex].Class->IsChildOf(Base);
+            }
+
+            UClass* Class = UClass::FindClass(ClassName);
+            if (!Class || !Class->IsChildOf(Base))
+            {
+                return false;
+            }
+
+            FCookClassEntry Entry;
+            Entry.Class = Class;
+            Entry.NameIndex = Strings.GetIndex(ClassName);
+            for (const FProperty& Prop : Class->GetAllProperties())
+            {
+                if (IsFixedLayoutPropertyType(Prop.Type))
+                {
+                    Entry.Layout.Add(&Prop);
+                    Entry.LayoutNames.Add(Prop.Name);
+                    Entry.RecordSize += GetFixedLayoutSize(Prop.Type);
+                }
+            }
+            Entry.RecordSize += GetPresenceMaskSize(Entry.Layout.Num());
+
+            OutIndex = static_cast<uint32>(Classes.Num());
+            Classes.Add(std::move(Entry));
+            ClassIndexByName.Add(ClassName, OutIndex);
+            return true;
+        }
+
+        // 레코드 = 클래스 인덱스, 씬 Id, 부모 인덱스, 존재 비트마스크 + 고정 크기 값, 나머지 키
+        void WriteObject(FArchive& Ar, uint32 ClassIndex, uint32 SceneId, uint32 ParentIndex, const JSON& ObjectJson,
+            std::initializer_list<const char*> StructuralKeys)
+        {
+            const FCookClassEntry& Entry = Classes[ClassIndex];
+            Ar << ClassIndex << SceneId << ParentIndex;
+
+            TArray<uint8> Record(Entry.RecordSize, 0);
+            const uint32 MaskSize = GetPresenceMaskSize(Entry.Layout.Num());
+            uint8* Cursor = Record.data() + MaskSize;
+            for (int32 i = 0; i < Entry.Layout.Num(); ++i)
+            {
+                const FProperty& Prop = *Entry.Layout[i];
+                if (WriteValue(Cursor, Prop, ObjectJson))
+                {
+                    Record[i >> 3] |= static_cast<uint8>(1u << (i & 7));
+                }
+                Cursor += GetFixedLayoutSize(Prop.Type);
+            }
+            Ar.Serialize(Record.data(), static_cast<int64>(Record.size()));
+            PropertyDataSize += Entry.RecordSize;
+
+            // 클래스별 Serialize가 직접 읽는 키 (머티리얼 슬롯, 바디 인스턴스 등)와 가변 길이 프로퍼티
+            JSON Extra = JSON::Make(JSON::Class::Object);
+            for (const auto& Pair : ObjectJson.ObjectRange())
+            {
+                const bool bStructural = std::any_of(StructuralKeys.begin(), StructuralKeys.end(),
+                    [&](const char* Key) { return Pair.first == Key; });
+                if (!bStructural && !Entry.LayoutNames.Contains(Pair.first))
+                {
+                    Extra[Pair.first] = Pair.second;
+                }
+            }
+            uint8 bHasExtra = Extra.size() > 0 ? 1 : 0;
+            Ar << bHasExtra;
+            if (bHasExtra)
+            {
+                EncodeValue(Ar, Strings, Extra);
+            }
+        }
+
+    private:
+        TMap<FString, uint32> ClassIndexByName;
+        TMap<FString, uint32> AssetIndexByKey;
+
+        uint32 GetAssetIndex(EPropertyType Type, const FString& Path)
+        {
+            const FString Key = std::to_string(static_cast<int32>(Type)) + ":" + Path;
+            if (uint32* Found = AssetIndexByKey.Find(Key))
+            {
+                return *Found;
+            }
+            const uint32 NewIndex = static_cast<uint32>(AssetRefs.Num());
+            AssetRefs.Add({ Type, Path });
+            AssetIndexByKey.Add(Key, NewIndex);
+            return NewIndex;
+        }
+
+        // UObject::Serialize와 같은 FJsonSerializer 읽기로 값을 해석 (키가 없으면 false, 자리는 0으로 유지)
+        bool WriteValue(uint8* Dest, const FProperty& Prop, const JSON& ObjectJson)
+        {
+            const FString Key = Prop.Name;
+            switch (Prop.Type)
+            {
+            case EPropertyType::Bool:
+            {
+                bool Value;
+                if (!FJsonSerializer::ReadBool(ObjectJson, Key, Value, false, false)) return false;
+                *Dest = Value ? 1 : 0;
+                return true;
+            }
+            case EPropertyType::Int32:
+            case EPropertyType::Enum:
+            {
+                int32 Value;
+                if (!FJsonSerializer::ReadInt32(ObjectJson, Key, Value, 0, false)) return false;
+                memcpy(Dest, &Value, sizeof(Value));
+                return true;
+            }
+            case EPropertyType::Float:
+            {
+                float Value;
+                if (!FJsonSerializer::ReadFloat(ObjectJson, Key, Value, 0.0f, false)) return false;
+                memcpy(Dest, &Value, sizeof(Value));
+                return true;
+            }
+            case EPropertyType::FVector:
+            {
+                FVector Value;
+                if (!FJsonSerializer::ReadVector(ObjectJson, Key, Value, FVector::Zero(), false)) return false;
+                const float Components[3] = { Value.X, Value.Y, Value.Z };
+                memcpy(Dest, Components, sizeof(Components));
+                return true;
+            }
+            case EPropertyType::FLinearColor:
+            case EPropertyType::Curve:
+            {
+                FVector4 Value;
+                if (!FJsonSerializer::ReadVector4(ObjectJson, Key, Value, FVector4(0, 0, 0, 0), false)) return false;
+                const float Components[4] = { Value.X, Value.Y, Value.Z, Value.W };
+                memcpy(Dest, Components, sizeof(Components));
+                return true;
+            }
+            case EPropertyType::FString:
+            case EPropertyType::ScriptFile:
+            case EPropertyType::FName:
+            {
+                // ReadString 결과를 그대로 저장 (JSON 경로에서 프로퍼티에 들어가는 값과 동일)
+                FString Value;
+                if (!FJsonSerializer::ReadString(ObjectJson, Key, Value, "", false)) return false;
+                const uint32 StringIndex = Strings.GetIndex(Value);
+                memcpy(Dest, &StringIndex, sizeof(StringIndex));
+                return true;
+            }
+            default:
+            {
+                // 에셋: JSON 경로는 키가 없거나 비어 있으면 nullptr을 기록하므로 항상 존재로 처리
+                FString Path;
+                FJsonSerializer::ReadString(ObjectJson, Key, Path, "", false);
+                const uint32 AssetIndex = Path.empty() ? UINT32_MAX : GetAssetIndex(Prop.Type, Path);
+                memcpy(Dest, &AssetIndex, sizeof(AssetIndex));
+                return true;
+            }
+            }
+        }
+    };
+
+    void ReadObjectRecord(FArchive& Ar, FCookedLevel& OutLevel, FCookedObjectRecord& OutRecord, UClass* Base)
+    {
+        Ar << OutRecord.ClassIndex << OutRecord.SceneId << OutRecord.ParentIndex;
+        if (OutRecord.ClassIndex >= static_cast<uint32>(OutLevel.Classes.Num()))
+        {
+            throw std::runtime_error("Cooked level corrupt: class index out of range.");
+        }
+
+        FCookedClass& Class = OutLevel.Classes[OutRecord.ClassIndex];
+        if (!Class.Class->IsChildOf(Base))
+        {
+            throw std::runtime_error("Cooked level corrupt: record class does not match its slot.");
+        }
+        ++Class.NumInstances;
+
+        OutRecord.DataOffset = static_cast<uint32>(OutLevel.PropertyData.Num());
+        OutLevel.PropertyData.SetNum(OutRecord.DataOffset + Class.RecordSize);
+        Ar.Serialize(OutLevel.PropertyData.data() + OutRecord.DataOffset, Class.RecordSize);
+
+        uint8 bHasExtra;
+        Ar << bHasExtra;
+        if (bHasExtra)
+        {
+            OutRecord.ExtraIndex = OutLevel.Extras.Num();
+            OutLevel.Extras.Add(DecodeValue(Ar, OutLevel.Strings));
+        }
+    }
+}
+
+FString FLevelCooker::GetCookedLevelPath(const FWideString& LevelPath)
+{
+    return ConvertDataPathToCachePath(NormalizePath(WideToUTF8(LevelPath))) + ".bin";
+}
+
+bool FLevelCooker::IsCookedLevelUpToDate(const FWideString& LevelPath, const FString& CookedPath)
+{
+    try
+    {
+        const FWideString CookedPathW = UTF8ToWide(CookedPath);
+        if (!fs::exists(CookedPathW) || !fs::exists(LevelPath))
+        {
+            return false;
+        }
+        return fs::last_write_time(LevelPath) <= fs::last_write_time(CookedPathW);
+    }
+    catch (const fs::filesystem_error& e)
+    {
+        UE_LOG("[LevelCooker] Filesystem error during cooked level validation: %s", e.what());
+        return false;
+    }
+}
+
+bool FLevelCooker::CookLevel(const JSON& LevelJson, const FString& CookedPath)
+{
+    FLevelCookContext Context;
+    TArray<uint8> BodyBuffer;
+    FMemoryWriter Body(BodyBuffer);
+
+    static const JSON EmptyObject = JSON::Make(JSON::Class::Object);
+    const JSON& ActorsJson = LevelJson.hasKey("Actors") ? LevelJson.at("Actors") : EmptyObject;
+
+    // 1) 헤더 (Actors 제외)
+    JSON Header = JSON::Make(JSON::Class::Object);
+    for (const auto& Pair : LevelJson.ObjectRange())
+    {
+        if (Pair.first != "Actors")
+        {
+            Header[Pair.first] = Pair.second;
+        }
+    }
+    Header["Actors"] = JSON::Make(JSON::Class::Object);
+    EncodeValue(Body, Context.Strings, Header);
+
+    // 2) 액터 레코드 (컴포넌트 부모/루트는 액터 내부 인덱스로 미리 해석)
+    uint32 ActorCount = static_cast<uint32>(ActorsJson.size());
+    uint32 NumComponentsTotal = 0;
+    Body << ActorCount;
+    for (const auto& Pair : ActorsJson.ObjectRange())
+    {
+        const JSON& ActorJson = Pair.second;
+
+        FString TypeString;
+        FJsonSerializer::ReadString(ActorJson, "Type", TypeString, "", false);
+        uint32 ActorClassIndex;
+        if (!Context.FindOrAddClass(TypeString, AActor::StaticClass(), ActorClassIndex))
+        {
+            UE_LOG("[warning] LevelCooker: Unknown actor class '%s', level is not cooked", TypeString.c_str());
+            return false;
+        }
+        Context.WriteObject(Body, ActorClassIndex, 0, UINT32_MAX, ActorJson, { "Type", "RootComponentId", "OwnedComponents" });
+
+        JSON ComponentsJson = JSON::Make(JSON::Class::Array);
+        FJsonSerializer::ReadArray(ActorJson, "OwnedComponents", ComponentsJson, JSON::Make(JSON::Class::Array), false);
+        uint32 NumComponents = static_cast<uint32>(std::max(0, ComponentsJson.size()));
+
+        uint32 RootUUID = 0;
+        FJsonSerializer::ReadUint32(ActorJson, "RootComponentId", RootUUID, 0, false);
+
+        TArray<uint32> ClassIndices;
+        TArray<uint32> SceneIds;
+        TArray<bool> SceneFlags;
+        uint32 RootIndex = UINT32_MAX;
+        for (uint32 i = 0; i < NumComponents; ++i)
+        {
+            const JSON& ComponentJson = ComponentsJson.at(i);
+            FString ComponentType;
+            FJsonSerializer::ReadString(ComponentJson, "Type", ComponentType, "", false);
+            uint32 ComponentClassIndex;
+            if (!Context.FindOrAddClass(ComponentType, UActorComponent::StaticClass(), ComponentClassIndex))
+            {
+                UE_LOG("[warning] LevelCooker: Unknown component class '%s', level is not cooked", ComponentType.c_str());
+                return false;
+            }
+
+            uint32 SceneId = 0;
+            FJsonSerializer::ReadUint32(ComponentJson, "Id", SceneId, 0, false);
+            const bool bSceneComponent = Context.Classes[ComponentClassIndex].Class->IsChildOf(USceneComponent::StaticClass());
+            if (bSceneComponent && SceneId == RootUUID)
+            {
+                RootIndex = i;
+            }
+            ClassIndices.Add(ComponentClassIndex);
+            SceneIds.Add(SceneId);
+            SceneFlags.Add(bSceneComponent);
+        }
+
+        Body << NumComponents << RootIndex;
+        for (uint32 i = 0; i < NumComponents; ++i)
+        {
+            const JSON& ComponentJson = ComponentsJson.at(i);
+            uint32 ParentIndex = UINT32_MAX;
+            uint32 ParentId = 0;
+            if (SceneFlags[i] && FJsonSerializer::ReadUint32(ComponentJson, "ParentId", ParentId, 0, false) && ParentId != 0)
+            {
+                for (uint32 j = 0; j < NumComponents; ++j)
+                {
+                    if (SceneFlags[j] && SceneIds[j] == ParentId)
+                    {
+                        ParentIndex = j;
+                    }
+                }
+                if (ParentIndex == UINT32_MAX)
+                {
+                    UE_LOG("[warning] LevelCooker: Component parent %u is outside its actor, level is not cooked", ParentId);
+                    return false;
+                }
+            }
+            Context.WriteObject(Body, ClassIndices[i], SceneIds[i], ParentIndex, ComponentJson, { "Type", "Id", "ParentId" });
+        }
+        NumComponentsTotal += NumComponents;
+    }
+
+    // 3) 파일 기록: 캐시 헤더 -> 문자열 테이블 -> 클래스/에셋 테이블 -> 본문
+    try
+    {
+        fs::path CookedDir(UTF8ToWide(CookedPath));
+        if (CookedDir.has_parent_path())
+        {
+            fs::create_directories(CookedDir.parent_path());
+        }
+
+        // 프로퍼티 이름은 클래스 테이블을 쓰기 전에 문자열 테이블에 등록
+        TArray<TArray<TPair<uint32, uint8>>> ClassLayouts;
+        for (const FCookClassEntry& Entry : Context.Classes)
+        {
+            TArray<TPair<uint32, uint8>>& Slots = ClassLayouts.emplace_back();
+            for (const FProperty* Prop : Entry.Layout)
+            {
+                Slots.Add({ Context.Strings.GetIndex(Prop->Name), static_cast<uint8>(Prop->Type) });
+            }
+        }
+        TArray<TPair<uint8, uint32>> AssetEntries;
+        for (const FCookedAssetRef& Ref : Context.AssetRefs)
+        {
+            AssetEntries.Add({ static_cast<uint8>(Ref.Type), Context.Strings.GetIndex(Ref.Path) });
+        }
+
+        // 파일 헤더(버전/체크섬)는 CacheFile::Save에서 기록
+        CacheFile::Save(CookedPath, CookedLevelVersion, [&](FArchive& Writer)
+        {
+            const TArray<FString>& Strings = Context.Strings.GetStrings();
+            uint32 StringCount = static_cast<uint32>(Strings.Num());
+            Writer << StringCount;
+            for (const FString& String : Strings)
+            {
+                Serialization::WriteString(Writer, String);
+            }
+
+            uint32 ClassCount = static_cast<uint32>(Context.Classes.Num());
+            Writer << ClassCount;
+            for (uint32 i = 0; i < ClassCount; ++i)
+            {
+                uint32 NameIndex = Context.Classes[i].NameIndex;
+                uint32 SlotCount = static_cast<uint32>(ClassLayouts[i].Num());
+                Writer << NameIndex << SlotCount;
+                for (auto& Slot : ClassLayouts[i])
+                {
+                    Writer << Slot.first << Slot.second;
+                }
+            }
+
+            uint32 AssetCount = static_cast<uint32>(AssetEntries.Num());
+            Writer << AssetCount;
+            for (auto& Entry : AssetEntries)
+            {
+                Writer << Entry.first << Entry.second;
+            }
+
+            Writer << NumComponentsTotal << Context.PropertyDataSize;
+
+            Writer.Serialize(BodyBuffer.data(), static_cast<int64>(BodyBuffer.size()));
+        });
+    }
+    catch (const std::exception& e)
+    {
+        UE_LOG("[error] LevelCooker: Failed to write cooked level %s (%s)", CookedPath.c_str(), e.what());
+        return false;
+    }
+
+    UE_LOG("LevelCooker: Cooked %u actors, %u components, %u classes, %u strings -> %s",
+        ActorCount, NumComponentsTotal, static_cast<uint32>(Context.Classes.Num()),
+        static_cast<uint32>(Context.Strings.GetStrings().Num()), CookedPath.c_str());
+    return true;
+}
+
+bool FLevelCooker::LoadCookedLevel(const FString& CookedPath, FCookedLevel& OutLevel)
+{
+    try
+    {
+        FMappedFileReader Reader(CookedPath);
+        if (!Reader.IsOpen())
+        {
+            return false;
+        }
+        CacheFile::ReadHeader(Reader, CookedLevelVersion);
+
+        uint32 StringCount;
+        Reader << StringCount;
+        if (StringCount > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+        {
+            throw std::runtime_error("Cooked level corrupt: string table size is unreasonable.");
+        }
+        OutLevel.Strings.Empty();
+        OutLevel.Strings.resize(StringCount);
+        for (FString& String : OutLevel.Strings)
+        {
+            Serialization::ReadString(Reader, String);
+        }
+        auto GetString = [&](uint32 Index) -> const FString&
+        {
+            if (Index >= StringCount)
+            {
+                throw std::runtime_error("Cooked level corrupt: string index out of range.");
+            }
+            return OutLevel.Strings[Index];
+        };
+
+        // 클래스 테이블: 클래스와 프로퍼티 레이아웃을 클래스당 한 번만 이름으로 해석
+        uint32 ClassCount;
+        Reader << ClassCount;
+        if (ClassCount > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+        {
+            throw std::runtime_error("Cooked level corrupt: class table size is unreasonable.");
+        }
+        OutLevel.Classes.Empty();
+        OutLevel.Classes.resize(ClassCount);
+        for (FCookedClass& CookedClass : OutLevel.Classes)
+        {
+            uint32 NameIndex, SlotCount;
+            Reader << NameIndex << SlotCount;
+            const FString& ClassName = GetString(NameIndex);
+            CookedClass.Class = UClass::FindClass(ClassName);
+            if (!CookedClass.Class)
+            {
+                // 쿠킹 이후 클래스가 사라졌으면 JSON에서 다시 쿠킹
+                throw std::runtime_error("Cooked level references unknown class " + ClassName);
+            }
+            if (SlotCount > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+            {
+                throw std::runtime_error("Cooked level corrupt: class layout size is unreasonable.");
+            }
+
+            const TArray<FProperty>& Properties = CookedClass.Class->GetAllProperties();
+            int32 SearchStart = 0;
+            CookedClass.Layout.resize(SlotCount);
+            for (FCookedPropertySlot& Slot : CookedClass.Layout)
+            {
+                uint32 PropertyNameIndex;
+                uint8 Type;
+                Reader << PropertyNameIndex << Type;
+                Slot.Type = static_cast<EPropertyType>(Type);
+                if (!IsFixedLayoutPropertyType(Slot.Type))
+                {
+                    throw std::runtime_error("Cooked level corrupt: invalid property type in class layout.");
+                }
+
+                // 레이아웃은 GetAllProperties 순서이므로 직전 위치부터 찾음 (부모/자식 동명 프로퍼티 구분)
+                const FString& PropertyName = GetString(PropertyNameIndex);
+                for (int32 Step = 0; Step < Properties.Num(); ++Step)
+                {
+                    const int32 Index = (SearchStart + Step) % Properties.Num();
+                    const FProperty& Prop = Properties[Index];
+                    if (Prop.Type == Slot.Type && PropertyName == Prop.Name)
+                    {
+                        Slot.Property = &Prop;
+                        SearchStart = Index + 1;
+                        break;
+                    }
+                }
+                CookedClass.RecordSize += GetFixedLayoutSize(Slot.Type);
+            }
+            CookedClass.RecordSize += GetPresenceMaskSize(CookedClass.Layout.Num());
+        }
+
+        uint32 AssetCount;
+        Reader << AssetCount;
+        if (AssetCount > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+        {
+            throw std::runtime_error("Cooked level corrupt: asset table size is unreasonable.");
+        }
+        OutLevel.AssetRefs.Empty();
+        OutLevel.AssetRefs.reserve(AssetCount);
+        for (uint32 i = 0; i < AssetCount; ++i)
+        {
+            uint8 Type;
+            uint32 PathIndex;
+            Reader << Type << PathIndex;
+            OutLevel.AssetRefs.Add({ static_cast<EPropertyType>(Type), GetString(PathIndex) });
+        }
+
+        uint32 NumComponentsTotal, PropertyDataSize;
+        Reader << NumComponentsTotal << PropertyDataSize;
+        if (NumComponentsTotal > Serialization::MAX_REASONABLE_ARRAY_SIZE || static_cast<int64>(PropertyDataSize) > Reader.TotalSize())
+        {
+            throw std::runtime_error("Cooked level corrupt: record sizes are unreasonable.");
+        }
+
+        OutLevel.Header = DecodeValue(Reader, OutLevel.Strings);
+
+        uint32 ActorCount;
+        Reader << ActorCount;
+        if (ActorCount > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+        {
+            throw std::runtime_error("Cooked level corrupt: actor count is unreasonable.");
+        }
+
+        // 레코드 값은 하나의 블롭으로 모음 (크기를 미리 알고 있으므로 재할당 없음)
+        OutLevel.PropertyData.Empty();
+        OutLevel.PropertyData.Reserve(PropertyDataSize);
+        OutLevel.Extras.Empty();
+        OutLevel.Components.Empty();
+        OutLevel.Components.Reserve(NumComponentsTotal);
+        OutLevel.Actors.Empty();
+        OutLevel.Actors.resize(ActorCount);
+        for (FCookedActorRecord& Actor : OutLevel.Actors)
+        {
+            ReadObjectRecord(Reader, OutLevel, Actor.Object, AActor::StaticClass());
+
+            Reader << Actor.NumComponents << Actor.RootComponent;
+            if (Actor.NumComponents > NumComponentsTotal ||
+                (Actor.RootComponent != UINT32_MAX && Actor.RootComponent >= Actor.NumComponents))
+            {
+                throw std::runtime_error("Cooked level corrupt: component range is invalid.");
+            }
+
+            Actor.FirstComponent = static_cast<uint32>(OutLevel.Components.Num());
+            for (uint32 i = 0; i < Actor.NumComponents; ++i)
+            {
+                FCookedObjectRecord& Component = OutLevel.Components.emplace_back();
+                ReadObjectRecord(Reader, OutLevel, Component, UActorComponent::StaticClass());
+                if (Component.ParentIndex != UINT32_MAX && Component.ParentIndex >= Actor.NumComponents)
+                {
+                    throw std::runtime_error("Cooked level corrupt: parent index out of range.");
+                }
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        UE_LOG("[error] LevelCooker: Error loading cooked level: %s. Deleting %s", e.what(), CookedPath.c_str());
+        fs::remove(UTF8ToWide(CookedPath));
+        return false;
+    }
+
+    return true;
+}
+
+void FLevelCooker::PreloadAssets(FCookedLevel& InOutLevel)
+{
+    UResourceManager& ResourceManager = UResourceManager::GetInstance();
+    InOutLevel.Assets.Empty();
+    InOutLevel.Assets.reserve(InOutLevel.AssetRefs.size());
+    for (const FCookedAssetRef& Ref : InOutLevel.AssetRefs)
+    {
+        UResourceBase* Asset = nullptr;
+        switch (Ref.Type)
+        {
+        case EPropertyType::StaticMesh:
+            Asset = ResourceManager.Load<UStaticMesh>(Ref.Path);
+            break;
+        case EPropertyType::SkeletalMesh:
+            Asset = ResourceManager.Load<USkeletalMesh>(Ref.Path);
+            break;
+        case EPropertyType::Texture:
+            Asset = ResourceManager.Load<UTexture>(Ref.Path);
+            break;
+        case EPropertyType::Material:
+            Asset = ResourceManager.Load<UMaterial>(Ref.Path);
+            break;
+        case EPropertyType::ParticleSystem:
+            Asset = ResourceManager.Load<UParticleSystem>(Ref.Path);
+            break;
+        default:
+            break;
+        }
+        InOutLevel.Assets.Add(Asset);
+    }
+}
+
+void FLevelCooker::ApplyProperties(const FCookedLevel& InLevel, const FCookedObjectRecord& Record, UObject* Object)
+{
+    const FCookedClass& CookedClass = InLevel.Classes[Record.ClassIndex];
+    const uint8* Mask = InLevel.PropertyData.data() + Record.DataOffset;
+    const uint8* Cursor = Mask + GetPresenceMaskSize(CookedClass.Layout.Num());
+
+    for (int32 i = 0; i < CookedClass.Layout.Num(); ++i)
+    {
+        const FCookedPropertySlot& Slot = CookedClass.Layout[i];
+        const uint8* Value = Cursor;
+        Cursor += GetFixedLayoutSize(Slot.Type);
+
+        const FProperty* Prop = Slot.Property;
+        if (!Prop || (Mask[i >> 3] & (1u << (i & 7))) == 0)
+        {
+            continue;
+        }
+
+        switch (Slot.Type)
+        {
+        case EPropertyType::Bool:
+            *Prop->GetValuePtr<bool>(Object) = *Value != 0;
+            break;
+        case EPropertyType::Int32:
+        case EPropertyType::Enum:
+            memcpy(Prop->GetValuePtr<int32>(Object), Value, sizeof(int32));
+            break;
+        case EPropertyType::Float:
+            memcpy(Prop->GetValuePtr<float>(Object), Value, sizeof(float));
+            break;
+        case EPropertyType::FVector:
+        {
+            float Components[3];
+            memcpy(Components, Value, sizeof(Components));
+            *Prop->GetValuePtr<FVector>(Object) = FVector(Components[0], Components[1], Components[2]);
+            break;
+        }
+        case EPropertyType::FLinearColor:
+        {
+            float Components[4];
+            memcpy(Components, Value, sizeof(Components));
+            *Prop->GetValuePtr<FLinearColor>(Object) = FLinearColor(FVector4(Components[0], Components[1], Components[2], Components[3]));
+            break;
+        }
+        case EPropertyType::Curve:
+            memcpy(Prop->GetValuePtr<float>(Object), Value, sizeof(float) * 4);
+            break;
+        case EPropertyType::FString:
+        case EPropertyType::ScriptFile:
+        case EPropertyType::FName:
+        {
+            uint32 StringIndex;
+            memcpy(&StringIndex, Value, sizeof(StringIndex));
+            if (StringIndex >= static_cast<uint32>(InLevel.Strings.Num()))
+            {
+                break;
+            }
+            if (Slot.Type == EPropertyType::FName)
+            {
+                *Prop->GetValuePtr<FName>(Object) = FName(InLevel.Strings[StringIndex]);
+            }
+            else
+            {
+                *Prop->GetValuePtr<FString>(Object) = InLevel.Strings[StringIndex];
+            }
+            break;
+        }
+        default:
+        {
+            uint32 AssetIndex;
+            memcpy(&AssetIndex, Value, sizeof(AssetIndex));
+            UResourceBase* Asset = AssetIndex < static_cast<uint32>(InLevel.Assets.Num()) ? InLevel.Assets[AssetIndex] : nullptr;
+            switch (Slot.Type)
+            {
+            case EPropertyType::Texture:        *Prop->GetValuePtr<UTexture*>(Object) = static_cast<UTexture*>(Asset); break;
+            case EPropertyType::StaticMesh:     *Prop->GetValuePtr<UStaticMesh*>(Object) = static_cast<UStaticMesh*>(Asset); break;
+            case EPropertyType::SkeletalMesh:   *Prop->GetValuePtr<USkeletalMesh*>(Object) = static_cast<USkeletalMesh*>(Asset); break;
+            case EPropertyType::Material:       *Prop->GetValuePtr<UMaterial*>(Object) = static_cast<UMaterial*>(Asset); break;
+            case EPropertyType::ParticleSystem: *Prop->GetValuePtr<UParticleSystem*>(Object) = static_cast<UParticleSystem*>(Asset); break;
+            default: break;
+            }
+            break;
+        }
+        }
+    }
+}
@@ -0,0 +1,138 @@
+#pragma once
+#include "Property.h"
+#include "JsonSerializer.h"
+
+class UObject;
+class UResourceBase;
+struct UClass;
+
+/**
+ * @brief 쿠킹된 레벨에서 미리 해석해 둔 에셋 참조
+ */
+struct FCookedAssetRef
+{
+    EPropertyType Type = EPropertyType::Unknown;
+    FString Path;
+};
+
+/**
+ * @brief 고정 레이아웃의 프로퍼티 한 칸 (쿠킹 시점 클래스의 고정 크기 프로퍼티 순서)
+ */
+struct FCookedPropertySlot
+{
+    const FProperty* Property = nullptr;    // 로드 시 이름으로 한 번만 해석 (클래스에서 사라졌으면 nullptr -> 값 건너뜀)
+    EPropertyType Type = EPropertyType::Unknown;
+};
+
+/**
+ * @brief 클래스 테이블 항목 (액터/컴포넌트 공용)
+ */
+struct FCookedClass
+{
+    UClass* Class = nullptr;
+    TArray<FCookedPropertySlot> Layout;
+    uint32 RecordSize = 0;                  // 존재 비트마스크 + 값 (같은 클래스의 모든 레코드가 같은 크기)
+    uint32 NumInstances = 0;                // 레벨 전체 인스턴스 수 (일괄 생성용)
+};
+
+/**
+ * @brief 액터 또는 컴포넌트 하나의 레코드
+ */
+struct FCookedObjectRecord
+{
+    uint32 ClassIndex = 0;
+    uint32 SceneId = 0;                     // 씬 컴포넌트의 저장된 Id
+    uint32 ParentIndex = UINT32_MAX;        // 같은 액터 안의 부모 컴포넌트 인덱스 (없으면 UINT32_MAX)
+    uint32 DataOffset = 0;                  // FCookedLevel::PropertyData 안의 고정 레이아웃 값 위치
+    int32 ExtraIndex = -1;                  // 고정 레이아웃에 담기지 않은 키 (FCookedLevel::Extras), 없으면 -1
+};
+
+/**
+ * @brief 액터 레코드 (컴포넌트 레코드는 FCookedLevel::Components의 연속 구간)
+ */
+struct FCookedActorRecord
+{
+    FCookedObjectRecord Object;
+    uint32 FirstComponent = 0;
+    uint32 NumComponents = 0;
+    uint32 RootComponent = UINT32_MAX;      // 액터 내부 컴포넌트 인덱스
+};
+
+/**
+ * @brief 바이너리 쿠킹 레벨을 메모리로 읽어들인 결과
+ */
+struct FCookedLevel
+{
+    JSON Header;                            // Actors를 제외한 레벨 데이터 (카메라 등)
+    TArray<FString> Strings;                // 문자열 프로퍼티 값
+    TArray<FCookedClass> Classes;           // 로드 시 한 번만 해석된 클래스와 프로퍼티 레이아웃
+    TArray<FCookedAssetRef> AssetRefs;      // 중복 제거된 에셋 경로
+    TArray<UResourceBase*> Assets;          // PreloadAssets 결과 (AssetRefs와 같은 순서)
+    TArray<uint8> PropertyData;             // 모든 레코드의 고정 레이아웃 값 (하나의 연속 블롭)
+    TArray<JSON> Extras;                    // 클래스별 Serialize가 직접 읽는 나머지 키 (머티리얼 슬롯 등)
+    TArray<FCookedObjectRecord> Components;
+    TArray<FCookedActorRecord> Actors;
+};
+
+/**
+ * @brief 쿠킹 레벨 로드 구간 표시 (UObject::IsLoadingCooked)
+ */
+struct FCookedLoadScope
+{
+    FCookedLoadScope() { UObject::SetLoadingCooked(true); }
+    ~FCookedLoadScope() { UObject::SetLoadingCooked(false); }
+};
+
+/**
+ * @brief JSON 레벨(.scene)을 바이너리 캐시로 쿠킹하고 다시 읽어들이는 유틸리티
+ *
+ * 파일 구성:
+ *  Cache Header  (FCacheFileHeader: 버전, 페이로드 크기, 체크섬)
+ *  String Table  (프로퍼티 이름, 클래스 이름, 문자열 값, 에셋 경로)
+ *  Class Table   (클래스 이름 + 고정 크기 프로퍼티 레이아웃: 이름/타입)
+ *  Asset Table   (프로퍼티 타입 + 경로 문자열 인덱스)
+ *  Header        (Actors를 제외한 레벨 JSON, 바이너리 인코딩)
+ *  Actor Records (클래스 인덱스, 존재 비트마스크 + 고정 크기 값, 컴포넌트 레코드)
+ *
+ * 고정 크기 프로퍼티는 레이아웃 순서대로 값만 저장되므로 로드 시 키 문자열 조회 없이
+ * 프로퍼티 오프셋에 바로 기록됩니다. 문자열/에셋 값은 테이블 인덱스로 저장됩니다.
+ * 가변 길이 프로퍼티와 클래스별 Serialize가 직접 읽는 키만 레코드별 JSON(Extras)으로 남습니다.
+ */
+class FLevelCooker
+{
+public:
+    static constexpr uint32 CookedLevelVersion = 3;
+
+    /**
+     * @brief 레벨 경로에 대응하는 쿠킹 캐시 경로를 반환 (Data/ -> Cache/, 확장자 뒤에 .bin)
+     */
+    static FString GetCookedLevelPath(const FWideString& LevelPath);
+
+    /**
+     * @brief 쿠킹 캐시가 존재하고 원본 레벨 파일보다 최신인지 검사
+     */
+    static bool IsCookedLevelUpToDate(const FWideString& LevelPath, const FString& CookedPath);
+
+    /**
+     * @brief JSON 레벨을 쿠킹하여 저장
+     * @param LevelJson 원본 레벨 JSON
+     * @param CookedPath 저장할 경로
+     * @return 알 수 없는 클래스나 액터 밖의 부모를 참조하는 컴포넌트가 있으면 false (JSON 경로로 계속 로드)
+     */
+    static bool CookLevel(const JSON& LevelJson, const FString& CookedPath);
+
+    /**
+     * @brief 쿠킹된 레벨을 읽어 클래스/프로퍼티 레이아웃까지 해석된 상태로 반환
+     */
+    static bool LoadCookedLevel(const FString& CookedPath, FCookedLevel& OutLevel);
+
+    /**
+     * @brief 에셋 테이블의 리소스를 한 번씩 로드하여 OutLevel.Assets를 채움
+     */
+    static void PreloadAssets(FCookedLevel& InOutLevel);
+
+    /**
+     * @brief 레코드의 고정 레이아웃 값을 객체의 프로퍼티에 직접 기록
+     */
+    static void ApplyProperties(const FCookedLevel& InLevel, const FCookedObjectRecord& Record, UObject* Object);
+};
@@ -0,0 +1,241 @@
+#include "pch.h"
+#include "LevelLoadBenchmark.h"
+#include "Level.h"
+#include "LevelCooker.h"
+#include "StaticMeshActor.h"
+#include "StaticMeshComponent.h"
+#include "PointLightActor.h"
+#include "SceneComponent.h"
+#include "JsonSerializer.h"
+#include "ObjectFactory.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+#include <fstream>
+
+namespace
+{
+	constexpr int32 LightStride = 10;   // 10%는 포인트 라이트
+
+	struct FScenarioResult
+	{
+		int32 NumActors = 0;
+		double JsonMS = 0.0;
+		double CookMS = 0.0;
+		double CookedMS = 0.0;
+		uint64 JsonBytes = 0;
+		uint64 CookedBytes = 0;
+		uint32 NumMismatches = 0;
+	};
+
+	// 에디터 저장과 같은 형식의 레벨 JSON (카메라 정보 없음)
+	JSON BuildLevelJson(int32 NumActors)
+	{
+		JSON LevelJson = JSON::Make(JSON::Class::Object);
+		LevelJson["Version"] = 1;
+		JSON ActorListJson = JSON::Make(JSON::Class::Object);
+
+		FBenchmarkRandom Random;
+		const FString MeshPath = GDataDir + "/cube-tex.obj";
+		for (int32 i = 0; i < NumActors; ++i)
+		{
+			AActor* Actor;
+			if ((i % LightStride) == LightStride - 1)
+			{
+				Actor = NewObject<APointLightActor>();
+			}
+			else
+			{
+				AStaticMeshActor* MeshActor = NewObject<AStaticMeshActor>();
+				MeshActor->GetStaticMeshComponent()->SetStaticMesh(MeshPath);
+				Actor = MeshActor;
+			}
+			Actor->SetActorLocation(FVector(Random.Range(-500.0f, 500.0f), Random.Range(-500.0f, 500.0f), Random.Range(0.0f, 50.0f)));
+
+			JSON ActorJson = JSON::Make(JSON::Class::Object);
+			ActorJson["Type"] = Actor->GetClass()->Name;
+			Actor->Serialize(false, ActorJson);
+			ActorListJson[std::to_string(Actor->UUID)] = ActorJson;
+
+			ObjectFactory::DeleteObject(Actor);
+		}
+		LevelJson["Actors"] = ActorListJson;
+		LevelJson["NextUUID"] = UObject::PeekNextUUID();
+		return LevelJson;
+	}
+
+	bool IsSameVector(const FVector& A, const FVector& B)
+	{
+		return A.X == B.X && A.Y == B.Y && A.Z == B.Z;
+	}
+
+	bool IsSameComponent(USceneComponent* A, USceneComponent* B)
+	{
+		if (!A || !B)
+		{
+			return A == B;
+		}
+		if (A->GetClass() != B->GetClass()
+			|| !IsSameVector(A->GetRelativeLocation(), B->GetRelativeLocation())
+			|| !IsSameVector(A->GetRelativeRotationEuler(), B->GetRelativeRotationEuler())
+			|| !IsSameVector(A->GetRelativeScale(), B->GetRelativeScale()))
+		{
+			return false;
+		}
+		UStaticMeshComponent* MeshA = Cast<UStaticMeshComponent>(A);
+		return !MeshA || MeshA->GetStaticMesh() == Cast<UStaticMeshComponent>(B)->GetStaticMesh();
+	}
+
+	// 두 경로로 만든 레벨이 같은지 (액터 순서는 둘 다 Actors 키 순서, 컴포넌트는 루트 + 씬 컴포넌트 부착 순서)
+	uint32 CountMismatches(const ULevel& JsonLevel, const ULevel& CookedLevel)
+	{
+		const TArray<AActor*>& JsonActors = JsonLevel.GetActors();
+		const TArray<AActor*>& CookedActors = CookedLevel.GetActors();
+		uint32 Mismatches = static_cast<uint32>(std::abs(JsonActors.Num() - CookedActors.Num()));
+
+		const int32 Count = std::min(JsonActors.Num(), CookedActors.Num());
+		for (int32 i = 0; i < Count; ++i)
+		{
+			AActor* A = JsonActors[i];
+			AActor* B = CookedActors[i];
+			const TArray<USceneComponent*>& SceneA = A->GetSceneComponents();
+			const TArray<USceneComponent*>& SceneB = B->GetSceneComponents();
+			bool bSame = A->GetClass() == B->GetClass()
+				&& A->GetOwnedComponents().Num() == B->GetOwnedComponents().Num()
+				&& SceneA.Num() == SceneB.Num()
+				&& IsSameComponent(A->GetRootComponent(), B->GetRootComponent());
+			for (int32 c = 0; bSame && c < SceneA.Num(); ++c)
+			{
+				bSame = IsSameComponent(SceneA[c], SceneB[c]);
+			}
+			Mismatches += bSame ? 0 : 1;
+		}
+		return Mismatches;
+	}
+
+	void DestroyLevel(std::unique_ptr<ULevel>& Level)
+	{
+		for (AActor* Actor : Level->GetActors())
+		{
+			ObjectFactory::DeleteObject(Actor);
+		}
+		Level->Clear();
+		Level.reset();
+	}
+
+	uint64 GetFileSize(const FString& Path)
+	{
+		std::error_code Error;
+		const uintmax_t Size = fs::file_size(UTF8ToWide(Path), Error);
+		return Error ? 0 : static_cast<uint64>(Size);
+	}
+
+	bool RunScenario(int32 NumActors, FScenarioResult& OutResult)
+	{
+		OutResult.NumActors = NumActors;
+
+		const FString JsonPath = GCacheDir + "/Benchmark/LevelLoad_" + std::to_string(NumActors) + ".scene";
+		const FString CookedPath = JsonPath + ".bin";
+		fs::create_directories(fs::path(UTF8ToWide(JsonPath)).parent_path());
+		if (!FJsonSerializer::SaveJsonToFile(BuildLevelJson(NumActors), UTF8ToWide(JsonPath)))
+		{
+			UE_LOG("[error] LevelLoadBenchmark: failed to write %s", JsonPath.c_str());
+			return false;
+		}
+
+		// JSON 경로: 텍스트 파싱 + 문자열 키 Serialize
+		JSON LevelJson;
+		std::unique_ptr<ULevel> JsonLevel = std::make_unique<ULevel>();
+		OutResult.JsonMS = MeasureMS([&]()
+		{
+			FJsonSerializer::LoadJsonFromFile(LevelJson, UTF8ToWide(JsonPath));
+			JsonLevel->Serialize(true, LevelJson);
+		});
+
+		// 쿠킹은 한 번만 (측정 대상 아님, 참고용)
+		bool bCooked = false;
+		OutResult.CookMS = MeasureMS([&]() { bCooked = FLevelCooker::CookLevel(LevelJson, CookedPath); });
+		if (!bCooked)
+		{
+			UE_LOG("[error] LevelLoadBenchmark: failed to cook %s", JsonPath.c_str());
+			DestroyLevel(JsonLevel);
+			return false;
+		}
+
+		// 쿠킹 경로: 파일 매핑 + 고정 레이아웃 레코드 + 클래스별 일괄 생성
+		std::unique_ptr<ULevel> CookedLevel = std::make_unique<ULevel>();
+		bool bLoaded = false;
+		OutResult.CookedMS = MeasureMS([&]()
+		{
+			FCookedLevel Cooked;
+			bLoaded = FLevelCooker::LoadCookedLevel(CookedPath, Cooked);
+			if (bLoaded)
+			{
+				CookedLevel->LoadCooked(Cooked);
+			}
+		});
+
+		OutResult.JsonBytes = GetFileSize(JsonPath);
+		OutResult.CookedBytes = GetFileSize(CookedPath);
+		OutResult.NumMismatches = bLoaded ? CountMismatches(*JsonLevel, *CookedLevel) : static_cast<uint32>(NumActors);
+
+		DestroyLevel(JsonLevel);
+		DestroyLevel(CookedLevel);
+		return bLoaded;
+	}
+
+	void WriteReport(const FString& ReportPath, const TArray<FScenarioResult>& Results)
+	{
+		std::ofstream File(UTF8ToWide(ReportPath));
+		if (!File.is_open())
+		{
+			UE_LOG("[error] LevelLoadBenchmark: failed to open %s", ReportPath.c_str());
+			return;
+		}
+		File.setf(std::ios::fixed);
+		File.precision(4);
+
+		File << "{\n  \"scenarios\": [";
+		for (int32 Index = 0; Index < Results.Num(); ++Index)
+		{
+			const FScenarioResult& Result = Results[Index];
+			File << (Index == 0 ? "\n" : ",\n")
+				<< "    { \"actors\": " << Result.NumActors
+				<< ", \"jsonMS\": " << Result.JsonMS
+				<< ", \"cookedMS\": " << Result.CookedMS
+				<< ", \"cookMS\": " << Result.CookMS
+				<< ", \"jsonBytes\": " << Result.JsonBytes
+				<< ", \"cookedBytes\": " << Result.CookedBytes
+				<< ", \"mismatches\": " << Result.NumMismatches << " }";
+		}
+		File << "\n  ]\n}\n";
+		UE_LOG("[LevelLoadBenchmark] report -> %s", ReportPath.c_str());
+	}
+}
+
+void FLevelLoadBenchmark::RunAndLog(const FString& ReportPath)
+{
+	UE_LOG("[LevelLoadBenchmark] %8s %10s %10s %8s %10s %12s %12s %s", "Actors", "json(ms)", "cooked(ms)", "Speedup", "cook(ms)", "json(bytes)", "cooked(bytes)", "Result");
+
+	TArray<FScenarioResult> Results;
+	const int32 ActorCounts[] = { 10000, 100000 };
+	for (int32 NumActors : ActorCounts)
+	{
+		FScenarioResult& Result = Results.emplace_back();
+		const bool bLoaded = RunScenario(NumActors, Result);
+
+		const double Speedup = Result.CookedMS > 0.0 ? Result.JsonMS / Result.CookedMS : 0.0;
+		UE_LOG("[LevelLoadBenchmark] %8d %10.2f %10.2f %7.2fx %10.2f %12llu %12llu %s (%u mismatches)",
+			NumActors, Result.JsonMS, Result.CookedMS, Speedup, Result.CookMS, Result.JsonBytes, Result.CookedBytes,
+			(bLoaded && Result.NumMismatches == 0) ? "PASS" : "FAIL", Result.NumMismatches);
+	}
+
+	if (!ReportPath.empty())
+	{
+		WriteReport(ReportPath, Results);
+	}
+}
+
+// 레벨 로드 벤치마크는 메시 로드용 디바이스와 빈 월드만 필요
+static const bool bLevelLoadBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"LEVELLOAD BENCH", "-levelloadbench", "level load benchmark (JSON vs cooked, 10k/100k actors)", EBenchmarkStage::World,
+	[](const FString& ReportPath) { FLevelLoadBenchmark::RunAndLog(ReportPath); } });
@@ -0,0 +1,16 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 레벨 로드 벤치마크 (콘솔 LEVELLOAD BENCH 명령, 헤드리스 -levelloadbench)
+ *
+ * 스태틱 메시 액터 90% + 포인트 라이트 10%로 된 10k/100k 액터 레벨을 JSON으로 저장한 뒤
+ * JSON 경로(파일 파싱 + ULevel::Serialize)와 쿠킹 경로(FLevelCooker 로드 + ULevel::LoadCooked)의 로드 시간을 비교합니다.
+ * 두 경로로 만든 액터/컴포넌트의 클래스, 트랜스폼, 메시가 같은지도 검사합니다.
+ */
+class FLevelLoadBenchmark
+{
+public:
+	/** @param ReportPath 비어 있지 않으면 시나리오별 결과를 JSON으로도 저장 */
+	static void RunAndLog(const FString& ReportPath = "");
+};
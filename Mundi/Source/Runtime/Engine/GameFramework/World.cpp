@@ -34,6 +34,15 @@
 #include "PlayerCameraManager.h"
 #include "Hash.h"
 #include "ParticleEventManager.h"
+#include "LevelCooker.h"
+#include "PlatformTime.h"
+
+DECLARE_CYCLE_STAT(WorldTick, "World")
+DECLARE_CYCLE_STAT(WorldPartitionUpdate, "World")
+DECLARE_CYCLE_STAT(WorldPhysics, "Physics")
+DECLARE_CYCLE_STAT(WorldActorTick, "World")
+DECLARE_CYCLE_STAT(WorldLuaScheduler, "Lua")
+DECLARE_CYCLE_STAT(WorldCollisionUpdate, "Physics")
 
 IMPLEMENT_CLASS(UWorld)
 
@@ -174,6 +183,26 @@ bool UWorld::TryLoadLastUsedLevel()
 bool UWorld::LoadLevelFromFile(const FWideString& Path)
 {
 	std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
+	const uint64 LoadStartCycles = FPlatformTime::Cycles64();
+
+#ifdef USE_LEVEL_CACHE
+	// 1) 쿠킹된 바이너리 레벨이 최신이면 JSON 파싱 없이 로드
+	const FString CookedPath = FLevelCooker::GetCookedLevelPath(Path);
+	if (FLevelCooker::IsCookedLevelUpToDate(Path, CookedPath))
+	{
+		FCookedLevel CookedLevel;
+		if (FLevelCooker::LoadCookedLevel(CookedPath, CookedLevel))
+		{
+			NewLevel->LoadCooked(CookedLevel);
+			SetLevel(std::move(NewLevel));
+
+			UE_LOG("UWorld: Cooked scene loaded successfully: %s (%.2f ms)", CookedPath.c_str(),
+				FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LoadStartCycles));
+			return true;
+		}
+	}
+#endif
+
 	JSON LevelJsonData;
 
 	if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, Path))
@@ -186,15 +215,24 @@ bool UWorld::LoadLevelFromFile(const FWideString& Path)
 		return false;
 	}
 
+	const double JsonLoadMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LoadStartCycles);
+
+#ifdef USE_LEVEL_CACHE
+	// 2) 다음 로드를 위해 쿠킹
+	FLevelCooker::CookLevel(LevelJsonData, CookedPath);
+#endif
+
 	SetLevel(std::move(NewLevel));
 
-	UE_LOG("UWorld: Scene loaded successfully: %s", Path.c_str());
+	UE_LOG("UWorld: Scene loaded successfully: %s (%.2f ms)", Path.c_str(), JsonLoadMS);
 	return true;
 }
 
 // 함수 내부 코드 순서 유지 필요
 void UWorld::Tick(float DeltaSeconds)
 {
+	SCOPE_CYCLE_COUNTER(WorldTick)
+
 	// GameDelat: Unscaled * finalScale
 	float UnscaledDeltaSeconds = DeltaSeconds;
 
@@ -258,12 +296,14 @@ void UWorld::Tick(float DeltaSeconds)
     // Skip partition update for preview worlds (no spatial partitioning needed)
     if (Partition)
     {
+        SCOPE_CYCLE_COUNTER(WorldPartitionUpdate)
         Partition->Update(DeltaSeconds, /*budget*/256);
     }
 
 	// 물리 시뮬레이션 (Actor Tick 전에 실행)
 	if (PhysScene && PhysScene->IsInitialized())
 	{
+		SCOPE_CYCLE_COUNTER(WorldPhysics)
 		PhysScene->StartFrame();
 		PhysScene->Tick(GetDeltaTime(EDeltaTime::Game));
 		PhysScene->EndFrame();
@@ -271,6 +311,8 @@ void UWorld::Tick(float DeltaSeconds)
 
 	if (Level)
 	{
+		SCOPE_CYCLE_COUNTER(WorldActorTick)
+
 		// Tick 중에 새로운 actor가 추가될 수도 있어서 복사 후 호출
 		TArray<AActor*> LevelActors = Level->GetActors();
 
@@ -297,9 +339,10 @@ void UWorld::Tick(float DeltaSeconds)
 		}
     }
 
-	// Lua 코루틴 전용 Tick
+	// Lua 배치 스크립트 Tick + 코루틴 Tick
 	if (LuaManager && bPie)
 	{
+		SCOPE_CYCLE_COUNTER(WorldLuaScheduler)
 		LuaManager->Tick(GetDeltaTime(EDeltaTime::Game));
 	}
 
@@ -309,6 +352,7 @@ void UWorld::Tick(float DeltaSeconds)
 	// 충돌 BVH 업데이트 (에디터/PIE 모두에서 호출 - Partition과 동일)
 	if (CollisionManager)
 	{
+		SCOPE_CYCLE_COUNTER(WorldCollisionUpdate)
 		CollisionManager->UpdateCollisions(GetDeltaTime(EDeltaTime::Game));
 	}
 }
@@ -644,15 +688,8 @@ AActor* UWorld::FindActorByName(const FName& ActorName)
 		return nullptr;
 	}
 
-	for (AActor* Actor : Level->GetActors())
-	{
-		if (Actor && !Actor->IsPendingDestroy() && Actor->ObjectName == ActorName)
-		{
-			return Actor; // 첫 번째 일치하는 액터 반환
-		}
-	}
-
-	return nullptr; // 찾지 못함
+	// 같은 이름 중 레벨에 먼저 추가된 액터 반환
+	return Level->GetQueryIndex().GetActorsWithName(ActorName).First();
 }
 
 UActorComponent* UWorld::FindComponentByName(const FName& ComponentName)
@@ -662,21 +699,12 @@ UActorComponent* UWorld::FindComponentByName(const FName& ComponentName)
 		return nullptr;
 	}
 
-	for (AActor* Actor : Level->GetActors())
-	{
-		if (Actor && !Actor->IsPendingDestroy())
-		{
-			for (UActorComponent* Component : Actor->GetOwnedComponents())
-			{
-				if (Component && !Component->IsPendingDestroy() && Component->ObjectName == ComponentName)
-				{
-					return Component; // 첫 번째 일치하는 컴포넌트 반환
-				}
-			}
-		}
-	}
+	return Level->GetQueryIndex().GetComponentsWithName(ComponentName).First();
+}
 
-	return nullptr; // 찾지 못함
+TQueryView<AActor> UWorld::GetActorsWithTag(const FString& Tag) const
+{
+	return Level ? Level->GetQueryIndex().GetActorsWithTag(Tag) : TQueryView<AActor>();
 }
 
 AActor* UWorld::SpawnActor(UClass* Class, const FTransform& Transform)
@@ -77,11 +77,19 @@ public:
     T* FindComponent();
     template<typename T>
     TArray<T*> FindActors();
-    // ObjectName으로 '첫 번째' 액터를 찾아 반환합니다.
+    // ObjectName으로 '첫 번째' 액터를 찾아 반환합니다. (해시 조회)
     AActor* FindActorByName(const FName& ActorName);
-    // 모든 액터의 모든 컴포넌트를 순회하여 ObjectName으로 '첫 번째' 컴포넌트를 찾아 반환합니다 (비용이 매우 크므로 매 프레임 호출을 권장하지 않습니다.)
+    // ObjectName으로 '첫 번째' 컴포넌트를 찾아 반환합니다. (해시 조회)
     UActorComponent* FindComponentByName(const FName& ComponentName);
 
+    // 배열을 만들지 않는 검색 뷰 (비용이 결과 수에 비례, 뷰를 들고 있는 동안 스폰/즉시 삭제 금지)
+    //   for (AEnemy* Enemy : GWorld->GetActorsOfClass<AEnemy>()) { ... }
+    template<typename T>
+    TQueryView<T> GetActorsOfClass() const;
+    template<typename T>
+    TQueryView<T> GetComponentsOfClass() const;
+    TQueryView<AActor> GetActorsWithTag(const FString& Tag) const;
+
     AActor* SpawnActor(UClass* Class, const FTransform& Transform);
     AActor* SpawnActor(UClass* Class);
     AActor* SpawnPrefabActor(const FWideString& PrefabPath);
@@ -229,79 +237,35 @@ inline T* UWorld::SpawnActor(const FTransform& Transform)
 }
 
 // 월드에서 특정 클래스(T)의 '첫 번째' 액터를 찾아 반환합니다. 없으면 nullptr.
+// (같은 클래스 안에서는 레벨에 추가된 순서, 클래스 간 순서는 보장하지 않음)
 template<typename T>
 inline T* UWorld::FindActor()
 {
-    static_assert(std::is_base_of_v<AActor, T>, "T must be derived from AActor.");
-
-    UClass* TypeClass = T::StaticClass();
-    if (!TypeClass)
-    {
-        return nullptr;
-    }
-
-    for (AActor* Actor : Level->GetActors())
-    {
-        if (Actor && !Actor->IsPendingDestroy() &&Actor->IsA(TypeClass))
-        {
-            // 찾은 액터를 T* 타입으로 캐스팅하여 반환합니다.
-            // (IsA를 통과했으므로 Cast는 안전함)
-            return Cast<T>(Actor);
-        }
-    }
-    return nullptr;
+    return GetActorsOfClass<T>().First();
 }
 
-// 월드에서 특정 클래스(T)의 '모든' 액터를 찾아 반환합니다. 없으면 nullptr.
+// 월드에서 특정 클래스(T)의 '모든' 액터를 배열로 복사해 반환합니다. 순회만 한다면 GetActorsOfClass<T>() 사용.
 template<typename T>
 inline TArray<T*> UWorld::FindActors()
 {
-    static_assert(std::is_base_of_v<AActor, T>, "T must be derived from AActor.");
-
-    TArray<T*> FoundActors;
-
-    UClass* TypeClass = T::StaticClass();
-    if (!TypeClass)
-    {
-        return FoundActors; // 빈 배열 반환
-    }
-
-    for (AActor* Actor : Level->GetActors())
-    {
-        if (Actor && !Actor->IsPendingDestroy() && Actor->IsA(TypeClass))
-        {
-            // 일치하는 모든 액터를 캐스팅하여 배열에 추가
-            FoundActors.Add(Cast<T>(Actor));
-        }
-    }
-    return FoundActors;
+    return GetActorsOfClass<T>().ToArray();
 }
 
-// 모든 액터의 컴포넌트를 순회해서 클래스(T)의 '첫 번째' 컴포넌트를 찾아 반환합니다. 없으면 nullptr. (비용이 크기 때문에 매 프레임 호출 비권장)
+// 클래스(T)의 '첫 번째' 컴포넌트를 찾아 반환합니다. 없으면 nullptr.
 template<typename T>
 inline T* UWorld::FindComponent()
 {
-    static_assert(std::is_base_of_v<UActorComponent, T>, "T must be derived from UActorComponent.");
-
-    UClass* TypeClass = T::StaticClass();
-    if (!TypeClass)
-    {
-        return nullptr;
-    }
-
-    for (AActor* Actor : Level->GetActors())
-    {
-        if (Actor && !Actor->IsPendingDestroy())
-        {
-            for (UActorComponent* Component : Actor->GetOwnedComponents())
-            {
-                if (Component && !Component->IsPendingDestroy() && Component->IsA(TypeClass))
-                {
-                    return Cast<T>(Component);
-                }
-            }
-        }
-    }
-
-    return nullptr;
+    return GetComponentsOfClass<T>().First();
+}
+
+template<typename T>
+inline TQueryView<T> UWorld::GetActorsOfClass() const
+{
+    return Level ? Level->GetQueryIndex().GetActorsOfClass<T>() : TQueryView<T>();
+}
+
+template<typename T>
+inline TQueryView<T> UWorld::GetComponentsOfClass() const
+{
+    return Level ? Level->GetQueryIndex().GetComponentsOfClass<T>() : TQueryView<T>();
 }
@@ -6,6 +6,7 @@
 #include "World.h"
 #include "Octree.h"
 #include "BVHierarchy.h"
+#include "PrimitiveBoundsSoA.h"
 #include "StaticMeshActor.h"
 #include "StaticMeshComponent.h"
 #include "Frustum.h"
@@ -22,6 +23,7 @@ UWorldPartitionManager::UWorldPartitionManager()
 	//BVH = new FBVHierachy(FBound(), 0, 5, 1); 
 	BVH = new FBVHierarchy(FAABB(), 0, 8, 1); 
 	//BVH = new FBVHierachy(FBound(), 0, 10, 3);
+	PrimitiveBounds = new FPrimitiveBoundsSoA();
 }
 
 UWorldPartitionManager::~UWorldPartitionManager()
@@ -36,12 +38,18 @@ UWorldPartitionManager::~UWorldPartitionManager()
 		delete BVH;
 		BVH = nullptr;
 	}
+	if (PrimitiveBounds)
+	{
+		delete PrimitiveBounds;
+		PrimitiveBounds = nullptr;
+	}
 }
 
 void UWorldPartitionManager::Clear()
 {
 	//ClearSceneOctree();
 	ClearBVHierarchy();
+	if (PrimitiveBounds) PrimitiveBounds->Clear();
 
 	ComponentDirtyQueue.Empty();
 	ComponentDirtySet.Empty();
@@ -75,6 +83,8 @@ void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 			{
 				StaticMeshComponents.push_back(Smc);
 				ComponentDirtySet.erase(Smc);
+				// 절두체 컬링 SoA는 MarkDirty와 같이 편집 가능한(에디터 보조가 아닌) 프리미티브만
+				if (PrimitiveBounds && Smc->IsEditable()) PrimitiveBounds->MarkDirty(Smc);
 			}
 		}
 	}
@@ -87,6 +97,7 @@ void UWorldPartitionManager::Unregister(UPrimitiveComponent* Component)
 	if (UPrimitiveComponent* Smc = Cast<UPrimitiveComponent>(Component))
 	{
 		if (BVH) BVH->Remove(Smc);
+		if (PrimitiveBounds) PrimitiveBounds->Remove(Smc);
 
 		ComponentDirtySet.erase(Smc);
 	}
@@ -127,6 +138,9 @@ void UWorldPartitionManager::MarkDirty(UPrimitiveComponent* Smc)
 		return;
 	}
 
+	// 절두체 컬링 바운드는 BVH와 달리 틱 예산 없이 매번 예약 (지난 바운드로 컬링하면 움직이는 물체가 사라짐)
+	if (PrimitiveBounds) PrimitiveBounds->MarkDirty(Smc);
+
 	// second: 새로운 요소가 성공적으로 삽입되었으면 true, 이미 요소가 존재하여 삽입에 실패했으면 false
 	// DirtyQueue 중복 삽입 방지 로직
 	if (ComponentDirtySet.insert(Smc).second)
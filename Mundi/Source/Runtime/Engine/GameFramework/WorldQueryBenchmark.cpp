@@ -0,0 +1,242 @@
+#include "pch.h"
+#include "WorldQueryBenchmark.h"
+#include "Level.h"
+#include "EmptyActor.h"
+#include "SceneComponent.h"
+#include "CameraComponent.h"
+#include "ObjectFactory.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+
+namespace
+{
+	// 이전 UWorld::FindActors/FindActorByName/FindComponent 와 같은 선형 순회
+	template<typename T>
+	TArray<T*> LegacyFindActors(const TArray<AActor*>& Actors)
+	{
+		TArray<T*> Found;
+		for (AActor* Actor : Actors)
+		{
+			if (Actor && !Actor->IsPendingDestroy() && Actor->IsA(T::StaticClass()))
+			{
+				Found.Add(Cast<T>(Actor));
+			}
+		}
+		return Found;
+	}
+
+	TArray<AActor*> LegacyFindActorsWithTag(const TArray<AActor*>& Actors, const FString& Tag)
+	{
+		TArray<AActor*> Found;
+		for (AActor* Actor : Actors)
+		{
+			if (Actor && !Actor->IsPendingDestroy() && Actor->Tag == Tag)
+			{
+				Found.Add(Actor);
+			}
+		}
+		return Found;
+	}
+
+	AActor* LegacyFindActorByName(const TArray<AActor*>& Actors, const FName& Name)
+	{
+		for (AActor* Actor : Actors)
+		{
+			if (Actor && !Actor->IsPendingDestroy() && Actor->ObjectName == Name)
+			{
+				return Actor;
+			}
+		}
+		return nullptr;
+	}
+
+	template<typename T>
+	int32 LegacyCountComponents(const TArray<AActor*>& Actors)
+	{
+		int32 Count = 0;
+		for (AActor* Actor : Actors)
+		{
+			if (Actor && !Actor->IsPendingDestroy())
+			{
+				for (UActorComponent* Component : Actor->GetOwnedComponents())
+				{
+					if (Component && !Component->IsPendingDestroy() && Component->IsA(T::StaticClass()))
+					{
+						++Count;
+					}
+				}
+			}
+		}
+		return Count;
+	}
+
+	void LogScenario(const char* Name, uint64 Operations, double LegacyMS, double NewMS)
+	{
+		const double Speedup = NewMS > 0.0 ? LegacyMS / NewMS : 0.0;
+		const double Mops = NewMS > 0.0 ? static_cast<double>(Operations) / (NewMS * 1000.0) : 0.0;
+		UE_LOG("[WorldQueryBenchmark] %-26s %10.2f %10.2f %7.2fx %9.1f", Name, LegacyMS, NewMS, Speedup, Mops);
+	}
+
+	void RunScenario(int32 NumActors)
+	{
+		constexpr int32 EnemyStride = 100;   // 1%가 "적"
+		constexpr int32 NumQueries = 200;
+		const FString EnemyTag = "Enemy";
+
+		TArray<AActor*> Actors;
+		Actors.Reserve(NumActors);
+		for (int32 i = 0; i < NumActors; ++i)
+		{
+			const bool bEnemy = (i % EnemyStride) == EnemyStride - 1;
+			AActor* Actor = bEnemy ? NewObject<AEmptyActor>() : NewObject<AActor>();
+			Actor->AddOwnedComponent(NewObject<USceneComponent>());
+			if (bEnemy)
+			{
+				Actor->Tag = EnemyTag;
+				Actor->AddOwnedComponent(NewObject<UCameraComponent>());
+			}
+			Actors.Add(Actor);
+		}
+
+		std::unique_ptr<ULevel> Level = std::make_unique<ULevel>();
+		const double AddMS = MeasureMS([&]()
+		{
+			for (AActor* Actor : Actors)
+			{
+				Level->AddActor(Actor);
+			}
+		});
+		const FActorQueryIndex& Index = Level->GetQueryIndex();
+		const TArray<AActor*>& LevelActors = Level->GetActors();
+
+		UE_LOG("[WorldQueryBenchmark] --- %d actors (%d enemies), index build %.2f ms ---", NumActors, NumActors / EnemyStride, AddMS);
+
+		// 클래스 질의: 배열 생성 + 전체 순회 vs 뷰 순회
+		{
+			uint64 LegacyCount = 0, NewCount = 0;
+			const double LegacyMS = MeasureMS([&]()
+			{
+				for (int32 q = 0; q < NumQueries; ++q)
+					LegacyCount += LegacyFindActors<AEmptyActor>(LevelActors).Num();
+			});
+			const double NewMS = MeasureMS([&]()
+			{
+				for (int32 q = 0; q < NumQueries; ++q)
+					for (AEmptyActor* Enemy : Index.GetActorsOfClass<AEmptyActor>())
+						NewCount += Enemy ? 1 : 0;
+			});
+			LogScenario("ActorsOfClass<AEmptyActor>", NewCount, LegacyMS, NewMS);
+			if (LegacyCount != NewCount)
+			{
+				UE_LOG("[WorldQueryBenchmark] ActorsOfClass mismatch: %llu vs %llu", LegacyCount, NewCount);
+			}
+		}
+
+		// 태그 질의
+		{
+			uint64 LegacyCount = 0, NewCount = 0;
+			const double LegacyMS = MeasureMS([&]()
+			{
+				for (int32 q = 0; q < NumQueries; ++q)
+					LegacyCount += LegacyFindActorsWithTag(LevelActors, EnemyTag).Num();
+			});
+			const double NewMS = MeasureMS([&]()
+			{
+				for (int32 q = 0; q < NumQueries; ++q)
+					for (AActor* Enemy : Index.GetActorsWithTag(EnemyTag))
+						NewCount += Enemy ? 1 : 0;
+			});
+			LogScenario("ActorsWithTag", NewCount, LegacyMS, NewMS);
+			if (LegacyCount != NewCount)
+			{
+				UE_LOG("[WorldQueryBenchmark] ActorsWithTag mismatch: %llu vs %llu", LegacyCount, NewCount);
+			}
+		}
+
+		// 이름 질의: 무작위 액터 이름
+		{
+			FBenchmarkRandom Random;
+			TArray<FName> Names;
+			Names.Reserve(NumQueries);
+			for (int32 q = 0; q < NumQueries; ++q)
+			{
+				Names.Add(Actors[Random.Next() % NumActors]->ObjectName);
+			}
+
+			uint32 Mismatches = 0;
+			uintptr_t Sink = 0;
+			const double LegacyMS = MeasureMS([&]()
+			{
+				for (const FName& Name : Names)
+					Sink += reinterpret_cast<uintptr_t>(LegacyFindActorByName(LevelActors, Name));
+			});
+			const double NewMS = MeasureMS([&]()
+			{
+				for (const FName& Name : Names)
+					Sink -= reinterpret_cast<uintptr_t>(Index.GetActorsWithName(Name).First());
+			});
+			for (const FName& Name : Names)
+			{
+				Mismatches += (LegacyFindActorByName(LevelActors, Name) != Index.GetActorsWithName(Name).First()) ? 1 : 0;
+			}
+			LogScenario("ActorByName", Names.Num(), LegacyMS, NewMS);
+			if (Mismatches != 0 || Sink != 0)
+			{
+				UE_LOG("[WorldQueryBenchmark] ActorByName mismatch: %u", Mismatches);
+			}
+		}
+
+		// 컴포넌트 질의: 모든 액터의 컴포넌트 순회 vs 클래스 뷰
+		{
+			uint64 LegacyCount = 0, NewCount = 0;
+			const double LegacyMS = MeasureMS([&]()
+			{
+				for (int32 q = 0; q < NumQueries; ++q)
+					LegacyCount += LegacyCountComponents<UCameraComponent>(LevelActors);
+			});
+			const double NewMS = MeasureMS([&]()
+			{
+				for (int32 q = 0; q < NumQueries; ++q)
+					for (UCameraComponent* Camera : Index.GetComponentsOfClass<UCameraComponent>())
+						NewCount += Camera ? 1 : 0;
+			});
+			LogScenario("ComponentsOfClass<Camera>", NewCount, LegacyMS, NewMS);
+			if (LegacyCount != NewCount)
+			{
+				UE_LOG("[WorldQueryBenchmark] ComponentsOfClass mismatch: %llu vs %llu", LegacyCount, NewCount);
+			}
+		}
+
+		// 유지 비용: 인덱스 제거 (레벨 배열 제거 비용은 제외하기 위해 인덱스를 직접 사용)
+		FActorQueryIndex& MutableIndex = Level->GetQueryIndex();
+		const double RemoveMS = MeasureMS([&]()
+		{
+			for (AActor* Actor : Actors)
+			{
+				MutableIndex.RemoveActor(Actor);
+			}
+		});
+		UE_LOG("[WorldQueryBenchmark] index remove %d actors: %.2f ms", NumActors, RemoveMS);
+
+		Level->Clear();
+		for (AActor* Actor : Actors)
+		{
+			ObjectFactory::DeleteObject(Actor);
+		}
+	}
+}
+
+void FWorldQueryBenchmark::RunAndLog()
+{
+	UE_LOG("[WorldQueryBenchmark] %-26s %10s %10s %8s %9s", "Scenario", "old(ms)", "new(ms)", "Speedup", "Mops/s");
+
+	const int32 ActorCounts[] = { 1000, 10000, 50000 };
+	for (int32 NumActors : ActorCounts)
+	{
+		RunScenario(NumActors);
+	}
+}
+
+static const bool bWorldQueryBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"WORLD BENCH", "-worldbench", "world query benchmark (1k/10k/50k actors)", EBenchmarkStage::None,
+	[](const FString&) { FWorldQueryBenchmark::RunAndLog(); } });
@@ -0,0 +1,15 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 월드 액터/컴포넌트 검색 벤치마크 (콘솔 WORLD BENCH 명령)
+ *
+ * 액터 1k/10k/50k개(1%는 AEmptyActor + "Enemy" 태그 + 카메라 컴포넌트)의 임시 레벨을 만들어
+ * 이전 선형 순회 방식과 FActorQueryIndex 조회(클래스/태그/이름/컴포넌트)를 비교합니다.
+ * 인덱스 유지 비용(레벨 추가/제거)도 함께 출력합니다.
+ */
+class FWorldQueryBenchmark
+{
+public:
+	static void RunAndLog();
+};
@@ -56,6 +56,7 @@ void UParticleSystem::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		if (FJsonSerializer::ReadArray(InOutHandle, "Emitters", EmittersJson))
 		{
 			Emitters.Empty();
+			FScopedMemoryTag MemTag(EMemoryTag::Particles);
 			for (size_t i = 0; i < EmittersJson.size(); ++i)
 			{
 				JSON& EmitterData = EmittersJson.at(i);
@@ -12,6 +12,44 @@ TMap<UClass*, FBoundClassDesc> GBoundClasses;
 // External function from LuaManager.cpp
 extern sol::object MakeCompProxy(sol::state_view SolState, UObject* Instance, UClass* Class);
 
+// ===== Dispatch Table =====
+
+struct FLuaDispatchEntry;
+
+using FLuaPropertyGetter = sol::object(*)(sol::state_view Lua, UObject* Instance, const FLuaDispatchEntry& Entry);
+using FLuaPropertySetter = void(*)(UObject* Instance, const FLuaDispatchEntry& Entry, const sol::object& Obj);
+
+/**
+ * One Lua-visible name of a class, with everything Index/NewIndex need already resolved.
+ * A name can carry both a registry binding and a reflected property; the registry binding wins
+ * for reads, and for writes unless it is a method.
+ */
+struct FLuaDispatchEntry
+{
+    // Registry binding (LuaBindHelpers), nearest class in the Super chain wins
+    sol::object Method;                     // Cached function object (AddMethod, AddMethodR, ...)
+    bool bBoundProperty = false;            // AddProperty-style descriptor
+    bool bReadOnly = false;
+    sol::protected_function Getter;
+    sol::function Setter;
+
+    // Reflection (GBoundClasses) with thunks chosen by property type
+    const FProperty* Property = nullptr;
+    UStruct* StructType = nullptr;          // EPropertyType::Struct only (FindStruct is a linear scan)
+    FLuaPropertyGetter GetThunk = nullptr;
+    FLuaPropertySetter SetThunk = nullptr;
+};
+
+/** Flattened per-class dispatch: Lua table of name -> slot in Entries (keyed by the interned Lua string) */
+struct FLuaClassDispatch
+{
+    sol::table Lookup;
+    TArray<FLuaDispatchEntry> Entries;
+};
+
+// Built on first access per class, dropped with the bind registry tables
+TMap<UClass*, FLuaClassDispatch> GClassDispatch;
+
 // ===== Core Functions =====
 
 void BuildBoundClass(UClass* Class)
@@ -37,206 +75,86 @@ void BuildBoundClass(UClass* Class)
     GBoundClasses.emplace(Class, std::move(Desc));
 }
 
-bool LuaComponentProxy::IsValid() const
+namespace
 {
-    return IsValidUObject(Instance);
-}
+    // ----- Getter thunks -----
 
-// ===== Index (Property/Method Access) =====
-
-sol::object LuaComponentProxy::Index(sol::this_state LuaState, LuaComponentProxy& Self, const char* Key)
-{
-    if (!Self.Instance)
+    template<typename T>
+    sol::object GetValue(sol::state_view Lua, UObject* Instance, const FLuaDispatchEntry& Entry)
     {
-        UE_LOG("[LuaProxy] Index: Instance is null for key '%s'", Key);
-        return sol::nil;
+        return sol::make_object(Lua, *Entry.Property->GetValuePtr<T>(Instance));
     }
 
-    sol::state_view LuaView(LuaState);
-
-    // Build bound class for reflection fallback
-    BuildBoundClass(Self.Class);
-
-    // ===== 1. Registry-based lookup (LuaBindHelpers bindings) =====
-    // Search inheritance chain for methods
-    for (const UClass* CurrentClass = Self.Class; CurrentClass != nullptr; CurrentClass = CurrentClass->Super)
+    sol::object GetName(sol::state_view Lua, UObject* Instance, const FLuaDispatchEntry& Entry)
     {
-        sol::table& BindTable = FLuaBindRegistry::Get().EnsureTable(LuaView, CurrentClass);
-        if (!BindTable.valid()) continue;
-
-        sol::object Result = BindTable[Key];
-        if (!Result.valid()) continue;
-
-        // Check if it's a property descriptor
-        if (Result.is<sol::table>())
-        {
-            sol::table propDesc = Result.as<sol::table>();
-            sol::optional<bool> isProperty = propDesc["is_property"];
-
-            if (isProperty && *isProperty)
-            {
-                // Property - call getter
-                sol::object getterObj = propDesc["get"];
-                if (getterObj.valid())
-                {
-                    sol::protected_function getter = getterObj.as<sol::protected_function>();
-                    auto pfr = getter(Self);
-                    if (pfr.valid())
-                        return pfr.get<sol::object>();
-                }
-                return sol::nil;
-            }
-        }
-
-        // Function - return directly
-        if (Result.get_type() == sol::type::function)
-            return Result;
+        return sol::make_object(Lua, Entry.Property->GetValuePtr<FName>(Instance)->ToString());
     }
 
-    // ===== 2. Reflection-based fallback (LuaReadWrite metadata) =====
-    auto It = GBoundClasses.find(Self.Class);
-    if (It == GBoundClasses.end()) return sol::nil;
-
-    auto ItProp = It->second.PropsByName.find(Key);
-    if (ItProp == It->second.PropsByName.end()) return sol::nil;
-
-    const FProperty* Property = ItProp->second.Property;
-
-    switch (Property->Type)
-    {
-    case EPropertyType::Bool:
-        return sol::make_object(LuaView, *Property->GetValuePtr<bool>(Self.Instance));
-    case EPropertyType::Float:
-        return sol::make_object(LuaView, *Property->GetValuePtr<float>(Self.Instance));
-    case EPropertyType::Int32:
-        return sol::make_object(LuaView, *Property->GetValuePtr<int>(Self.Instance));
-    case EPropertyType::FString:
-    case EPropertyType::ScriptFile:
-        return sol::make_object(LuaView, *Property->GetValuePtr<FString>(Self.Instance));
-    case EPropertyType::FVector:
-        return sol::make_object(LuaView, *Property->GetValuePtr<FVector>(Self.Instance));
-    case EPropertyType::FLinearColor:
-        return sol::make_object(LuaView, *Property->GetValuePtr<FLinearColor>(Self.Instance));
-    case EPropertyType::FName:
-        return sol::make_object(LuaView, Property->GetValuePtr<FName>(Self.Instance)->ToString());
-
     // UObject pointer types (supports recursive access)
-    case EPropertyType::ObjectPtr:
-    case EPropertyType::Texture:
-    case EPropertyType::SkeletalMesh:
-    case EPropertyType::StaticMesh:
-    case EPropertyType::Material:
-    case EPropertyType::Sound:
+    sol::object GetObjectPtr(sol::state_view Lua, UObject* Instance, const FLuaDispatchEntry& Entry)
     {
-        UObject** ObjPtr = Property->GetValuePtr<UObject*>(Self.Instance);
+        UObject** ObjPtr = Entry.Property->GetValuePtr<UObject*>(Instance);
         if (!ObjPtr || !IsValidUObject(*ObjPtr))
             return sol::nil;
 
         UObject* TargetObj = *ObjPtr;
-        return MakeCompProxy(LuaView, TargetObj, TargetObj->GetClass());
+        return MakeCompProxy(Lua, TargetObj, TargetObj->GetClass());
     }
 
-    // Array types - return LuaArrayProxy
-    case EPropertyType::Array:
-        return sol::make_object(LuaView, LuaArrayProxy(Self.Instance, Property));
+    sol::object GetArray(sol::state_view Lua, UObject* Instance, const FLuaDispatchEntry& Entry)
+    {
+        return sol::make_object(Lua, LuaArrayProxy(Instance, Entry.Property));
+    }
 
-    // Map types - return LuaMapProxy
-    case EPropertyType::Map:
-        return sol::make_object(LuaView, LuaMapProxy(Self.Instance, Property));
+    sol::object GetMap(sol::state_view Lua, UObject* Instance, const FLuaDispatchEntry& Entry)
+    {
+        return sol::make_object(Lua, LuaMapProxy(Instance, Entry.Property));
+    }
 
-    // Struct types - return LuaStructProxy for recursive access
-    case EPropertyType::Struct:
+    // Struct types - LuaStructProxy for recursive access
+    sol::object GetStruct(sol::state_view Lua, UObject* Instance, const FLuaDispatchEntry& Entry)
     {
-        UStruct* StructType = UStruct::FindStruct(Property->TypeName);
-        if (!StructType)
+        if (!Entry.StructType)
         {
-            UE_LOG("[Lua][error] Unknown struct type: %s", Property->TypeName);
+            UE_LOG("[Lua][error] Unknown struct type: %s", Entry.Property->TypeName);
             return sol::nil;
         }
 
-        void* StructInstance = (char*)Self.Instance + Property->Offset;
-        return sol::make_object(LuaView, LuaStructProxy(StructInstance, StructType));
-    }
-
-    default:
-        return sol::nil;
+        void* StructInstance = (char*)Instance + Entry.Property->Offset;
+        return sol::make_object(Lua, LuaStructProxy(StructInstance, Entry.StructType));
     }
-}
-
-// ===== NewIndex (Property Assignment) =====
-
-void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::object Obj)
-{
-    if (!Self.Instance || !Self.Class) return;
-
-    sol::state_view LuaView = Obj.lua_state();
 
-    // Build bound class for reflection fallback
-    BuildBoundClass(Self.Class);
+    // ----- Setter thunks -----
 
-    // ===== 1. Registry-based lookup first =====
-    sol::table& BindTable = FLuaBindRegistry::Get().EnsureTable(LuaView, Self.Class);
-    if (BindTable.valid())
+    void SetBool(UObject* Instance, const FLuaDispatchEntry& Entry, const sol::object& Obj)
     {
-        sol::object Property = BindTable[Key];
-        if (Property.valid() && Property.is<sol::table>())
-        {
-            sol::table propDesc = Property.as<sol::table>();
-            sol::optional<bool> isProperty = propDesc["is_property"];
-
-            if (isProperty && *isProperty)
-            {
-                // Check read-only
-                sol::optional<bool> readOnly = propDesc["read_only"];
-                if (readOnly && *readOnly)
-                {
-                    UE_LOG("[LuaProxy] Attempted to set read-only property: %s", Key);
-                    return;
-                }
-
-                // Call setter
-                sol::optional<sol::function> setter = propDesc["set"];
-                if (setter)
-                {
-                    (*setter)(Self, Obj);
-                }
-                return;
-            }
-        }
+        if (Obj.get_type() == sol::type::boolean)
+            *Entry.Property->GetValuePtr<bool>(Instance) = Obj.as<bool>();
     }
 
-    // ===== 2. Reflection-based fallback =====
-    auto IterateClass = GBoundClasses.find(Self.Class);
-    if (IterateClass == GBoundClasses.end()) return;
-
-    auto It = IterateClass->second.PropsByName.find(Key);
-    if (It == IterateClass->second.PropsByName.end()) return;
-
-    const FProperty* Property = It->second.Property;
-
-    switch (Property->Type)
+    void SetFloat(UObject* Instance, const FLuaDispatchEntry& Entry, const sol::object& Obj)
     {
-    case EPropertyType::Bool:
-        if (Obj.get_type() == sol::type::boolean)
-            *Property->GetValuePtr<bool>(Self.Instance) = Obj.as<bool>();
-        break;
-    case EPropertyType::Float:
         if (Obj.get_type() == sol::type::number)
-            *Property->GetValuePtr<float>(Self.Instance) = static_cast<float>(Obj.as<double>());
-        break;
-    case EPropertyType::Int32:
+            *Entry.Property->GetValuePtr<float>(Instance) = static_cast<float>(Obj.as<double>());
+    }
+
+    void SetInt32(UObject* Instance, const FLuaDispatchEntry& Entry, const sol::object& Obj)
+    {
         if (Obj.get_type() == sol::type::number)
-            *Property->GetValuePtr<int>(Self.Instance) = static_cast<int>(Obj.as<double>());
-        break;
-    case EPropertyType::FString:
-    case EPropertyType::ScriptFile:
+            *Entry.Property->GetValuePtr<int>(Instance) = static_cast<int>(Obj.as<double>());
+    }
+
+    void SetString(UObject* Instance, const FLuaDispatchEntry& Entry, const sol::object& Obj)
+    {
         if (Obj.get_type() == sol::type::string)
-            *Property->GetValuePtr<FString>(Self.Instance) = Obj.as<FString>();
-        break;
-    case EPropertyType::FVector:
+            *Entry.Property->GetValuePtr<FString>(Instance) = Obj.as<FString>();
+    }
+
+    void SetVector(UObject* Instance, const FLuaDispatchEntry& Entry, const sol::object& Obj)
+    {
         if (Obj.is<FVector>())
         {
-            *Property->GetValuePtr<FVector>(Self.Instance) = Obj.as<FVector>();
+            *Entry.Property->GetValuePtr<FVector>(Instance) = Obj.as<FVector>();
         }
         else if (Obj.get_type() == sol::type::table)
         {
@@ -246,13 +164,15 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
                 static_cast<float>(t.get_or("Y", 0.0)),
                 static_cast<float>(t.get_or("Z", 0.0))
             };
-            *Property->GetValuePtr<FVector>(Self.Instance) = tmp;
+            *Entry.Property->GetValuePtr<FVector>(Instance) = tmp;
         }
-        break;
-    case EPropertyType::FLinearColor:
+    }
+
+    void SetLinearColor(UObject* Instance, const FLuaDispatchEntry& Entry, const sol::object& Obj)
+    {
         if (Obj.is<FLinearColor>())
         {
-            *Property->GetValuePtr<FLinearColor>(Self.Instance) = Obj.as<FLinearColor>();
+            *Entry.Property->GetValuePtr<FLinearColor>(Instance) = Obj.as<FLinearColor>();
         }
         else if (Obj.get_type() == sol::type::table)
         {
@@ -263,37 +183,35 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
                 static_cast<float>(t.get_or("B", 1.0)),
                 static_cast<float>(t.get_or("A", 1.0))
             };
-            *Property->GetValuePtr<FLinearColor>(Self.Instance) = tmp;
+            *Entry.Property->GetValuePtr<FLinearColor>(Instance) = tmp;
         }
-        break;
-    case EPropertyType::FName:
+    }
+
+    void SetName(UObject* Instance, const FLuaDispatchEntry& Entry, const sol::object& Obj)
+    {
         if (Obj.get_type() == sol::type::string)
-            *Property->GetValuePtr<FName>(Self.Instance) = FName(Obj.as<FString>());
-        break;
+            *Entry.Property->GetValuePtr<FName>(Instance) = FName(Obj.as<FString>());
+    }
 
     // UObject pointer types
-    case EPropertyType::ObjectPtr:
-    case EPropertyType::Texture:
-    case EPropertyType::SkeletalMesh:
-    case EPropertyType::StaticMesh:
-    case EPropertyType::Material:
-    case EPropertyType::Sound:
+    void SetObjectPtr(UObject* Instance, const FLuaDispatchEntry& Entry, const sol::object& Obj)
     {
-        UObject** ObjPtr = Property->GetValuePtr<UObject*>(Self.Instance);
-        if (!ObjPtr) break;
+        const FProperty* Property = Entry.Property;
+        UObject** ObjPtr = Property->GetValuePtr<UObject*>(Instance);
+        if (!ObjPtr) return;
 
         // nil assignment
         if (Obj.get_type() == sol::type::nil || Obj.get_type() == sol::type::none)
         {
             *ObjPtr = nullptr;
-            break;
+            return;
         }
 
         // Must be a proxy
         if (!Obj.is<LuaComponentProxy>())
         {
             UE_LOG("[Lua][warning] Cannot assign non-UObject to property '%s'", Property->Name);
-            break;
+            return;
         }
 
         LuaComponentProxy& SourceProxy = Obj.as<LuaComponentProxy&>();
@@ -302,13 +220,13 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
         if (!SourceObj)
         {
             *ObjPtr = nullptr;
-            break;
+            return;
         }
 
         if (!IsValidUObject(SourceObj))
         {
             UE_LOG("[Lua][warning] Cannot assign deleted UObject to property '%s'", Property->Name);
-            break;
+            return;
         }
 
         // Type validation
@@ -319,35 +237,32 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
             {
                 UE_LOG("[Lua][warning] Type mismatch: cannot assign %s to %s property '%s'",
                        SourceObj->GetClass()->Name, ExpectedClass->Name, Property->Name);
-                break;
+                return;
             }
         }
 
         *ObjPtr = SourceObj;
-        break;
     }
 
-    // Array types
-    case EPropertyType::Array:
+    // Array types (UObject pointer elements only)
+    void SetObjectArray(UObject* Instance, const FLuaDispatchEntry& Entry, const sol::object& Obj)
     {
-        if (!IsObjectPointerType(Property->InnerType))
-            break;
-
-        TArray<UObject*>* ArrayPtr = Property->GetValuePtr<TArray<UObject*>>(Self.Instance);
-        if (!ArrayPtr) break;
+        const FProperty* Property = Entry.Property;
+        TArray<UObject*>* ArrayPtr = Property->GetValuePtr<TArray<UObject*>>(Instance);
+        if (!ArrayPtr) return;
 
         // nil → clear
         if (Obj.get_type() == sol::type::nil || Obj.get_type() == sol::type::none)
         {
             ArrayPtr->clear();
-            break;
+            return;
         }
 
         // Must be table
         if (Obj.get_type() != sol::type::table)
         {
             UE_LOG("[Lua][warning] Cannot assign non-table to array property '%s'", Property->Name);
-            break;
+            return;
         }
 
         sol::table SourceTable = Obj.as<sol::table>();
@@ -382,15 +297,245 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
         }
 
         *ArrayPtr = std::move(NewArray);
-        break;
     }
 
     // Struct - cannot replace directly
-    case EPropertyType::Struct:
-        UE_LOG("[Lua][warning] Cannot assign to struct property '%s' directly. Modify its fields instead.", Key);
-        break;
+    void SetStruct(UObject* Instance, const FLuaDispatchEntry& Entry, const sol::object& Obj)
+    {
+        UE_LOG("[Lua][warning] Cannot assign to struct property '%s' directly. Modify its fields instead.", Entry.Property->Name);
+    }
+
+    /** Picks the getter/setter thunks once per property instead of switching on the type every access */
+    void BindReflectedProperty(FLuaDispatchEntry& Entry, const FProperty* Property)
+    {
+        Entry.Property = Property;
+
+        switch (Property->Type)
+        {
+        case EPropertyType::Bool:
+            Entry.GetThunk = &GetValue<bool>;
+            Entry.SetThunk = &SetBool;
+            break;
+        case EPropertyType::Float:
+            Entry.GetThunk = &GetValue<float>;
+            Entry.SetThunk = &SetFloat;
+            break;
+        case EPropertyType::Int32:
+            Entry.GetThunk = &GetValue<int>;
+            Entry.SetThunk = &SetInt32;
+            break;
+        case EPropertyType::FString:
+        case EPropertyType::ScriptFile:
+            Entry.GetThunk = &GetValue<FString>;
+            Entry.SetThunk = &SetString;
+            break;
+        case EPropertyType::FVector:
+            Entry.GetThunk = &GetValue<FVector>;
+            Entry.SetThunk = &SetVector;
+            break;
+        case EPropertyType::FLinearColor:
+            Entry.GetThunk = &GetValue<FLinearColor>;
+            Entry.SetThunk = &SetLinearColor;
+            break;
+        case EPropertyType::FName:
+            Entry.GetThunk = &GetName;
+            Entry.SetThunk = &SetName;
+            break;
+
+        case EPropertyType::ObjectPtr:
+        case EPropertyType::Texture:
+        case EPropertyType::SkeletalMesh:
+        case EPropertyType::StaticMesh:
+        case EPropertyType::Material:
+        case EPropertyType::Sound:
+            Entry.GetThunk = &GetObjectPtr;
+            Entry.SetThunk = &SetObjectPtr;
+            break;
+
+        case EPropertyType::Array:
+            Entry.GetThunk = &GetArray;
+            if (IsObjectPointerType(Property->InnerType))
+                Entry.SetThunk = &SetObjectArray;
+            break;
+
+        case EPropertyType::Map:
+            Entry.GetThunk = &GetMap;
+            break;
+
+        case EPropertyType::Struct:
+            Entry.StructType = UStruct::FindStruct(Property->TypeName);
+            Entry.GetThunk = &GetStruct;
+            Entry.SetThunk = &SetStruct;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    FLuaDispatchEntry& FindOrAddEntry(FLuaClassDispatch& Dispatch, const FString& Name)
+    {
+        if (sol::optional<int32> Slot = Dispatch.Lookup.raw_get<sol::optional<int32>>(Name))
+            return Dispatch.Entries[*Slot];
+
+        Dispatch.Lookup.raw_set(Name, Dispatch.Entries.Num());
+        Dispatch.Entries.emplace_back();
+        return Dispatch.Entries.back();
+    }
+
+    /** Resolves every registry binding (whole Super chain) and reflected property of Class once */
+    FLuaClassDispatch& EnsureClassDispatch(sol::state_view Lua, UClass* Class)
+    {
+        if (FLuaClassDispatch* Found = GClassDispatch.Find(Class))
+            return *Found;
+
+        BuildBoundClass(Class);
 
-    default:
-        break;
+        FLuaClassDispatch Dispatch;
+        Dispatch.Lookup = Lua.create_table();
+
+        // ===== 1. Registry-based bindings (LuaBindHelpers), most derived class first =====
+        for (const UClass* CurrentClass = Class; CurrentClass != nullptr; CurrentClass = CurrentClass->Super)
+        {
+            sol::table& BindTable = FLuaBindRegistry::Get().EnsureTable(Lua, CurrentClass);
+            if (!BindTable.valid()) continue;
+
+            // for_each is a raw traversal: only this class's own entries, not the parent via __index
+            BindTable.for_each([&](const sol::object& Key, const sol::object& Value)
+            {
+                if (Key.get_type() != sol::type::string) return;
+
+                const bool bFunction = Value.get_type() == sol::type::function;
+                sol::table PropDesc;
+                if (!bFunction)
+                {
+                    if (Value.get_type() != sol::type::table) return;
+                    PropDesc = Value.as<sol::table>();
+                    sol::optional<bool> isProperty = PropDesc["is_property"];
+                    if (!isProperty || !*isProperty) return;
+                }
+
+                FLuaDispatchEntry& Entry = FindOrAddEntry(Dispatch, Key.as<FString>());
+                if (Entry.Method.valid() || Entry.bBoundProperty) return;  // Shadowed by a derived class
+
+                if (bFunction)
+                {
+                    Entry.Method = Value;
+                    return;
+                }
+
+                Entry.bBoundProperty = true;
+                Entry.bReadOnly = PropDesc.get_or("read_only", false);
+                sol::object GetterObj = PropDesc["get"];
+                if (GetterObj.get_type() == sol::type::function)
+                    Entry.Getter = GetterObj.as<sol::protected_function>();
+                sol::object SetterObj = PropDesc["set"];
+                if (SetterObj.get_type() == sol::type::function)
+                    Entry.Setter = SetterObj.as<sol::function>();
+            });
+        }
+
+        // ===== 2. Reflection-based properties (LuaReadWrite metadata) =====
+        if (auto It = GBoundClasses.find(Class); It != GBoundClasses.end())
+        {
+            for (auto& [Name, BoundProp] : It->second.PropsByName)
+            {
+                BindReflectedProperty(FindOrAddEntry(Dispatch, Name), BoundProp.Property);
+            }
+        }
+
+        auto [Inserted, _] = GClassDispatch.emplace(Class, std::move(Dispatch));
+        return Inserted->second;
+    }
+
+    const FLuaDispatchEntry* FindDispatchEntry(sol::state_view Lua, UClass* Class, const sol::stack_object& Key)
+    {
+        FLuaClassDispatch& Dispatch = EnsureClassDispatch(Lua, Class);
+        sol::optional<int32> Slot = Dispatch.Lookup.raw_get<sol::optional<int32>>(Key);
+        return Slot ? &Dispatch.Entries[*Slot] : nullptr;
+    }
+
+    const char* KeyToString(const sol::stack_object& Key)
+    {
+        return Key.get_type() == sol::type::string ? Key.as<const char*>() : "?";
+    }
+}
+
+void ResetLuaClassDispatch()
+{
+    GClassDispatch.Empty();
+}
+
+bool LuaComponentProxy::IsValid() const
+{
+    return Instance && WeakInstance.Get() == Instance;
+}
+
+// ===== Index (Property/Method Access) =====
+
+sol::object LuaComponentProxy::Index(sol::this_state LuaState, LuaComponentProxy& Self, sol::stack_object Key)
+{
+    if (!Self.IsValid())
+    {
+        UE_LOG("[LuaProxy] Index: Instance is null or destroyed for key '%s'", KeyToString(Key));
+        return sol::nil;
+    }
+
+    sol::state_view LuaView(LuaState);
+
+    const FLuaDispatchEntry* Entry = FindDispatchEntry(LuaView, Self.Class, Key);
+    if (!Entry) return sol::nil;
+
+    // ===== 1. Registry binding =====
+    if (Entry->Method.valid())
+        return Entry->Method;
+
+    if (Entry->bBoundProperty)
+    {
+        if (Entry->Getter.valid())
+        {
+            auto pfr = Entry->Getter(Self);
+            if (pfr.valid())
+                return pfr.get<sol::object>();
+        }
+        return sol::nil;
+    }
+
+    // ===== 2. Reflection =====
+    if (!Entry->GetThunk) return sol::nil;
+    return Entry->GetThunk(LuaView, Self.Instance, *Entry);
+}
+
+// ===== NewIndex (Property Assignment) =====
+
+void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, sol::stack_object Key, sol::object Obj)
+{
+    if (!Self.IsValid() || !Self.Class) return;
+
+    sol::state_view LuaView = Obj.lua_state();
+
+    const FLuaDispatchEntry* Entry = FindDispatchEntry(LuaView, Self.Class, Key);
+    if (!Entry) return;
+
+    // ===== 1. Registry binding first =====
+    if (Entry->bBoundProperty)
+    {
+        if (Entry->bReadOnly)
+        {
+            UE_LOG("[LuaProxy] Attempted to set read-only property: %s", KeyToString(Key));
+            return;
+        }
+
+        if (Entry->Setter.valid())
+        {
+            Entry->Setter(Self, Obj);
+        }
+        return;
+    }
+
+    // ===== 2. Reflection fallback =====
+    if (Entry->SetThunk)
+    {
+        Entry->SetThunk(Self.Instance, *Entry, Obj);
     }
 }
@@ -22,6 +22,9 @@ extern TMap<UClass*, FBoundClassDesc> GBoundClasses;
 
 void BuildBoundClass(UClass* Class);
 
+// Drops the per-class dispatch tables (call with FLuaBindRegistry::Reset, before the Lua state closes)
+void ResetLuaClassDispatch();
+
 // ===== Main Proxy Class =====
 
 /**
@@ -33,6 +36,7 @@ void BuildBoundClass(UClass* Class);
 struct LuaComponentProxy
 {
     UObject* Instance = nullptr;  // Type-safe UObject pointer
+    TWeakObjectPtr<UObject> WeakInstance;  // Detects deletion / slot reuse of Instance
     UClass* Class = nullptr;
 
     // Validate if the UObject instance is still valid
@@ -41,6 +45,7 @@ struct LuaComponentProxy
     // Get raw UObject pointer
     UObject* Get() const { return Instance; }
 
-    static sol::object Index(sol::this_state LuaState, LuaComponentProxy& Self, const char* Key);
-    static void        NewIndex(LuaComponentProxy& Self, const char* Key, sol::object Obj);
+    // Key stays on the Lua stack so the lookup reuses the interned Lua string (no C string hashing)
+    static sol::object Index(sol::this_state LuaState, LuaComponentProxy& Self, sol::stack_object Key);
+    static void        NewIndex(LuaComponentProxy& Self, sol::stack_object Key, sol::object Obj);
 };
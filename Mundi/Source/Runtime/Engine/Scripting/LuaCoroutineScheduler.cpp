@@ -1,6 +1,15 @@
 ﻿#include "pch.h"
 #include "LuaCoroutineScheduler.h"
 
+namespace
+{
+	// std::push_heap/pop_heap은 최대 힙이므로 비교를 뒤집어 WakeTime 최소 힙으로 사용 (같으면 먼저 등록된 작업 우선)
+	constexpr auto WakesLater = [](const auto& A, const auto& B)
+	{
+		return A.WakeTime != B.WakeTime ? A.WakeTime > B.WakeTime : A.Task.Id > B.Task.Id;
+	};
+}
+
 void FLuaCoroutineScheduler::ShutdownBeforeLuaClose()
 {
 	for (auto& Task : Tasks)
@@ -11,6 +20,13 @@ void FLuaCoroutineScheduler::ShutdownBeforeLuaClose()
 		}
 	}
 	Tasks.Empty(); 
+	FreeSlots.Empty();
+	TimerHeap.Empty();
+	EventWaiters.clear();
+	PredicateWaiters.Empty();
+	ReadyTasks.Empty();
+	PredicateCursor = 0;
+	NumActiveTasks = 0;
 }
 
 FLuaCoroutineScheduler::FLuaCoroutineScheduler()
@@ -20,13 +36,29 @@ FLuaCoroutineScheduler::FLuaCoroutineScheduler()
 
 FLuaCoroHandle FLuaCoroutineScheduler::Register(sol::thread&& Thread, sol::coroutine&& Co, void* Owner)
 {
-	FCoroTask Task;
+	int32 Slot;
+	if (!FreeSlots.IsEmpty())
+	{
+		Slot = FreeSlots.back();
+		FreeSlots.pop_back();
+	}
+	else
+	{
+		Slot = Tasks.Num();
+		Tasks.emplace_back();
+	}
+
+	FCoroTask& Task = Tasks[Slot];
 	Task.Thread = std::move(Thread); /* Thread Anchoring */
 	Task.Co     = std::move(Co);
 	Task.Owner  = Owner;
+	Task.WaitType = EWaitType::None;
+	Task.Finished = false;
 	Task.Id     = ++NextId;
-	Tasks.push_back(std::move(Task));
-	
+	++NumActiveTasks;
+
+	// 첫 재개는 다음 Tick
+	ReadyTasks.Add({ Slot, Task.Id });
 	return FLuaCoroHandle{ Task.Id };
 }
 
@@ -38,113 +70,215 @@ void FLuaCoroutineScheduler::Tick(double DeltaTime)
 
 	Process(NowSeconds);
 }
+
 void FLuaCoroutineScheduler::Process(double Now)
 {
-	for (auto& task : Tasks)
+	// 재개 중에 새 작업이 등록되거나 다시 대기할 수 있으므로 이번 Tick에 재개할 작업을 먼저 모두 모음
+	DueTasks.clear();
+
+	// 시간 대기: 힙 꼭대기부터 깨어날 시간이 지난 작업만
+	while (!TimerHeap.IsEmpty() && TimerHeap.front().WakeTime <= Now)
 	{
-		if (task.Finished)
-			continue;
+		std::pop_heap(TimerHeap.begin(), TimerHeap.end(), WakesLater);
+		const FTaskRef Task = TimerHeap.back().Task;
+		TimerHeap.pop_back();
+		if (IsWaiting(Task, EWaitType::Time))
+		{
+			DueTasks.Add(Task);
+		}
+	}
+
+	// 새로 등록됐거나 조건 없이 yield한 작업
+	DueTasks.insert(DueTasks.end(), ReadyTasks.begin(), ReadyTasks.end());
+	ReadyTasks.clear();
+
+	// 조건 대기
+	PollPredicates(DueTasks);
 
-		// 조건 충족 여부
-		switch (task.WaitType)
+	for (const FTaskRef& Task : DueTasks)
+	{
+		// 앞서 재개한 작업이 이 작업의 Owner를 제거했을 수 있음
+		if (Tasks[Task.Slot].Id == Task.Id && !Tasks[Task.Slot].Finished)
 		{
-		case EWaitType::Time:
-			// UE_LOG("Now=%.3f Wake=%.3f", TotalTime, task.WakeTime);
-			if (task.WakeTime > Now) continue;
-			break;
-		case EWaitType::Predicate:
-			// 람다 함수가 있지만, 조건이 달성 안 됐을 때
-			if (task.Predicate && !task.Predicate()) continue; 
-			break;
-			// case EWaitType::Event: // Event "Trigger"는 Tick 함수 내에서 조건 확인하지 않음
+			Resume(Task, Now);
 		}
+	}
+}
+
+void FLuaCoroutineScheduler::PollPredicates(TArray<FTaskRef>& OutDue)
+{
+	int32 NumToPoll = PredicateWaiters.Num();
+	if (PredicatePollBudget > 0)
+	{
+		NumToPoll = std::min(NumToPoll, PredicatePollBudget);
+	}
 
-		// 조건 충족 시 resume 실행
-		sol::protected_function_result Result = task.Co();
-		if (!Result.valid())
+	// 목록을 돌아가며 검사 (제거는 마지막 원소와 교환하므로 커서를 옮기지 않음)
+	for (int32 Polled = 0; Polled < NumToPoll && !PredicateWaiters.IsEmpty(); ++Polled)
+	{
+		if (PredicateCursor >= PredicateWaiters.Num())
 		{
-			sol::error Err = Result;
-			UE_LOG("[Lua][error] Coroutine error: %s\n", Err.what());
-			task.Finished = true;
-			continue;
+			PredicateCursor = 0;
 		}
-		
-		// 이후 yield가 다시 올 경우, 다음 조건 실행 = 재세팅
-		if (Result.status() == sol::call_status::yielded)
+
+		const FTaskRef Task = PredicateWaiters[PredicateCursor];
+		bool bRemove = !IsWaiting(Task, EWaitType::Predicate);
+		if (!bRemove)
 		{
-			std::string Tag = Result.get<FString>(0); // 해당 Co의 첫번째 string 매개변수
-			if (Tag == "wait_time")
-			{
-				double Sec = Result.get<double>(1);
-				task.WaitType = EWaitType::Time;
-				task.WakeTime = Now + Sec;
-			}
-			else if (Tag == "wait_predicate")
+			sol::protected_function_result Result = Tasks[Task.Slot].Predicate();
+			// 조건 람다 함수가 실패하면 조건 미달로 취급
+			if (Result.valid() && Result.get<bool>())
 			{
-				sol::function Condition = Result.get<sol::function>(1); 
-				task.WaitType = EWaitType::Predicate;
-				task.Predicate = [Condition]()
-				{
-					sol::protected_function_result Result = Condition();
-					if (!Result.valid()) return false; 
-					return Result.get<bool>();
-				};
+				OutDue.Add(Task);
+				bRemove = true;
 			}
-			else if (Tag == "wait_event")
-			{
-				task.WaitType = EWaitType::Event;
-				task.EventName = Result.get<FString>(1);
-			}
-			else
-			{
-				task.WaitType = EWaitType::None;
-			}
-		}
-		else if (Result.status() == sol::call_status::runtime)
-		{
-			task.Finished = true;
-		}
-		else if (Result.status() == sol::call_status::ok)
-		{
-			task.Finished = true;
 		}
-		else if (Result.status() == sol::call_status::file)
+
+		if (bRemove)
 		{
-			task.Finished = true;
+			PredicateWaiters[PredicateCursor] = PredicateWaiters.back();
+			PredicateWaiters.pop_back();
 		}
-		else if (Result.status() == sol::call_status::memory)
+		else
 		{
-			task.Finished = true;
+			++PredicateCursor;
 		}
 	}
 }
 
+void FLuaCoroutineScheduler::Resume(const FTaskRef& TaskRef, double Now)
+{
+	const int32 Slot = TaskRef.Slot;
+	{
+		FCoroTask& Task = Tasks[Slot];
+		Task.WaitType = EWaitType::None;
+		Task.Predicate = sol::nil;
+		Task.bResuming = true;
+	}
+
+	// 재개 중 Register로 Tasks가 재할당될 수 있으므로 복사본으로 호출하고 이후에는 인덱스로만 접근
+	sol::coroutine Co = Tasks[Slot].Co;
+	sol::protected_function_result Result = Co();
+	Tasks[Slot].bResuming = false;
+
+	// 재개 도중 자신의 Owner가 제거됨 (CancelByOwner가 해제를 미룸)
+	if (Tasks[Slot].Finished)
+	{
+		ReleaseTask(Slot);
+		return;
+	}
+
+	if (!Result.valid())
+	{
+		sol::error Err = Result;
+		UE_LOG("[Lua][error] Coroutine error: %s\n", Err.what());
+		ReleaseTask(Slot);
+		return;
+	}
+
+	// ok, runtime, file, memory 등 yield 외의 상태는 모두 종료
+	if (Result.status() != sol::call_status::yielded)
+	{
+		ReleaseTask(Slot);
+		return;
+	}
+
+	// 이후 yield가 다시 올 경우, 다음 조건 실행 = 재세팅
+	FCoroTask& Task = Tasks[Slot];
+	const std::string Tag = Result.return_count() > 0 && Result.get_type(0) == sol::type::string
+		? Result.get<FString>(0) // 해당 Co의 첫번째 string 매개변수
+		: FString();
+	if (Tag == "wait_time")
+	{
+		double Sec = Result.get<double>(1);
+		Task.WaitType = EWaitType::Time;
+		Task.WakeTime = Now + Sec;
+		TimerHeap.Add({ Task.WakeTime, TaskRef });
+		std::push_heap(TimerHeap.begin(), TimerHeap.end(), WakesLater);
+	}
+	else if (Tag == "wait_predicate")
+	{
+		Task.WaitType = EWaitType::Predicate;
+		Task.Predicate = Result.get<sol::protected_function>(1);
+		PredicateWaiters.Add(TaskRef);
+	}
+	else if (Tag == "wait_event")
+	{
+		Task.WaitType = EWaitType::Event;
+		Task.EventName = FName(Result.get<FString>(1));
+		EventWaiters[Task.EventName].Add(TaskRef);
+	}
+	else
+	{
+		Task.WaitType = EWaitType::None;
+		ReadyTasks.Add(TaskRef);
+	}
+}
+
+void FLuaCoroutineScheduler::ReleaseTask(int32 Slot)
+{
+	FCoroTask& Task = Tasks[Slot];
+	Task.Co = sol::coroutine(); // 참조 해제
+	Task.Thread = sol::thread();
+	Task.Predicate = sol::nil;
+	Task.Owner = nullptr;
+	Task.WaitType = EWaitType::None;
+	Task.Finished = true;
+	FreeSlots.Add(Slot);
+	--NumActiveTasks;
+}
 
 void FLuaCoroutineScheduler::AddCoroutine(sol::coroutine&& Co)
 {
-	Tasks.push_back({std::move(Co)});
+	Register(sol::thread(), std::move(Co), nullptr);
 }
 
 void FLuaCoroutineScheduler::TriggerEvent(const FString& EventName)
 {
-	for (auto& task : Tasks)
+	// 한 번도 기다린 적 없는 이름은 이름 테이블에 추가하지 않음
+	const FName Name = FName::Find(EventName);
+	if (Name.IsNone())
+	{
+		return;
+	}
+
+	auto It = EventWaiters.find(Name);
+	if (It == EventWaiters.end())
+	{
+		return;
+	}
+
+	// 재개된 작업이 같은 이벤트를 다시 기다리면 새 목록에 들어가 다음 트리거를 기다림
+	TArray<FTaskRef> Waiters = std::move(It->second);
+	EventWaiters.erase(It);
+
+	for (const FTaskRef& Task : Waiters)
 	{
-		if (task.Finished) continue;
-		if (task.WaitType != EWaitType::Event) continue;
-		if (task.EventName == EventName)
+		if (IsWaiting(Task, EWaitType::Event))
 		{
-			task.WaitType = EWaitType::None;
-			task.Co(); // resume
+			Resume(Task, NowSeconds); // resume
 		}
 	}
 }
 
 void FLuaCoroutineScheduler::CancelByOwner(void* Owner)
 {
-	for (auto& Task : Tasks) {
-		if (Task.Owner == Owner && !Task.Finished) {
+	for (int32 Slot = 0; Slot < Tasks.Num(); ++Slot)
+	{
+		FCoroTask& Task = Tasks[Slot];
+		if (Task.Owner != Owner || Task.Finished)
+		{
+			continue;
+		}
+
+		if (Task.bResuming)
+		{
+			// 실행 중인 코루틴은 재개가 끝난 뒤 Resume에서 해제
 			Task.Finished = true;
-			Task.Co = sol::coroutine(); // 참조 해제
+		}
+		else
+		{
+			ReleaseTask(Slot);
 		}
 	}
 }
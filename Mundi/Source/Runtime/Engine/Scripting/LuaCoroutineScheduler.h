@@ -22,12 +22,22 @@ struct FCoroTask
     void* Owner = nullptr;          // ULuaScriptComponent*
     EWaitType WaitType  = EWaitType::None;
     double WakeTime = 0.0;			// wait_time(n초)
-    std::function<bool()> Predicate;// wait_until()
-    std::string EventName;			// wait_event("Test")
-    bool Finished = false;
+    sol::protected_function Predicate;// wait_predicate()
+    FName EventName;				// wait_event("Test")
+    bool Finished = true;           // 빈 슬롯이거나 끝난 작업
+    bool bResuming = false;         // 재개 중 (자기 자신이 취소되면 재개가 끝난 뒤 해제)
     uint32 Id = 0;
 };
 
+/**
+ * @brief 씬 단위 Lua 코루틴 스케줄러
+ *
+ * - 작업은 슬롯 배열에 두고 끝난 슬롯은 free list로 재사용 (Id로 재사용된 슬롯의 옛 참조를 걸러냄)
+ * - wait_time: WakeTime 최소 힙, 깨어날 시간이 지난 작업만 꺼냄
+ * - wait_event: 이벤트 이름(FName)별 대기 목록, TriggerEvent는 해당 목록만 재개
+ * - wait_predicate: 조건 대기 작업만 모은 목록을 Tick마다 최대 PredicatePollBudget개씩 돌아가며 검사
+ * - 취소된 작업이 힙/이벤트 목록에 남긴 항목은 꺼낼 때 버림
+ */
 class FLuaCoroutineScheduler
 {
 public:
@@ -42,13 +52,49 @@ public:
     
     void CancelByOwner(void* Owner);
     void ShutdownBeforeLuaClose();
+
+    int32 GetNumActiveTasks() const { return NumActiveTasks; }
+
+    /** 한 Tick에 검사할 wait_predicate 조건 수 (0 = 제한 없음). 넘치는 조건은 다음 Tick에 이어서 검사 */
+    void SetPredicatePollBudget(int32 InBudget) { PredicatePollBudget = InBudget; }
     
 private:
+    struct FTaskRef
+    {
+        int32 Slot = -1;
+        uint32 Id = 0;
+    };
+
+    struct FTimerEntry
+    {
+        double WakeTime = 0.0;
+        FTaskRef Task;
+    };
+
     void Process(double Now);
+    void Resume(const FTaskRef& Task, double Now);
+    void PollPredicates(TArray<FTaskRef>& OutDue);
+    void ReleaseTask(int32 Slot);
+
+    bool IsWaiting(const FTaskRef& Task, EWaitType WaitType) const
+    {
+        const FCoroTask& Entry = Tasks[Task.Slot];
+        return Entry.Id == Task.Id && !Entry.Finished && Entry.WaitType == WaitType;
+    }
 
 private:
-    TArray<FCoroTask> Tasks;
+    TArray<FCoroTask> Tasks;            // 슬롯 (인덱스 = FTaskRef::Slot)
+    TArray<int32> FreeSlots;
+    int32 NumActiveTasks = 0;
     uint32 NextId = 0;
+
+    TArray<FTimerEntry> TimerHeap;              // WakeTime 최소 힙
+    TMap<FName, TArray<FTaskRef>> EventWaiters;
+    TArray<FTaskRef> PredicateWaiters;
+    int32 PredicateCursor = 0;
+    int32 PredicatePollBudget = 2048;
+    TArray<FTaskRef> ReadyTasks;                // 새로 등록됐거나 다음 Tick에 바로 재개할 작업
+    TArray<FTaskRef> DueTasks;                  // Process 작업용 (매 Tick 재사용)
     
     double NowSeconds = 0.0;
     double MaxDeltaClamp = 0.1; // 한 프레임의 최대 반영시간, Debug으로 중단 시에도 시간이 가지 않게 방지
@@ -9,11 +9,46 @@
 #include "CameraActor.h"
 #include "CameraComponent.h"
 #include "PlayerCameraManager.h"
+#include "PlatformTime.h"
 #include <tuple>
 
+DEFINE_LOG_CATEGORY(LogLua)
+
+DECLARE_CYCLE_STAT(LuaScriptTickBatch, "Lua")
+
+bool FLuaManager::bBatchedScriptTick = false;
+
+namespace
+{
+    // 청크 인자로 Clock을 받아 디스패처를 반환
+    // 스크립트마다 pcall로 감싸 한 스크립트의 에러가 나머지 Tick을 막지 않음 (에러는 C++에서 로그)
+    const char* ScriptTickDispatcherSource = R"(
+local Clock = ...
+local pcall, tostring = pcall, tostring
+return function(Funcs, Pending, Count, Elapsed, Errors)
+    local NumErrors = 0
+    for i = 1, Count do
+        local Func = Funcs[Pending[2 * i - 1]]
+        local Start = Clock()
+        if Func then
+            local bOk, Err = pcall(Func, Pending[2 * i])
+            if not bOk then
+                NumErrors = NumErrors + 1
+                Errors[2 * NumErrors - 1] = i
+                Errors[2 * NumErrors] = tostring(Err)
+            end
+        end
+        Elapsed[i] = Clock() - Start
+    end
+    return NumErrors
+end
+)";
+}
+
 sol::object MakeCompProxy(sol::state_view SolState, UObject* Instance, UClass* Class) {
     LuaComponentProxy Proxy;
     Proxy.Instance = Instance;
+    Proxy.WeakInstance = TWeakObjectPtr<UObject>(Instance);
     Proxy.Class = Class;
     // Build bound class for reflection-based access
     BuildBoundClass(Class);
@@ -148,20 +183,20 @@ FLuaManager::FLuaManager()
     
     Lua->set_function("print", sol::overload(                             
         [](const FString& msg) {                                          
-            UE_LOG("[Lua-Str] %s\n", msg.c_str());                        
+            UE_LOG_CATEGORY(LogLua, Log, "[Lua-Str] %s\n", msg.c_str());                        
         },                                                                
                                                                           
         [](int num){                                                      
-            UE_LOG("[Lua] %d\n", num);                                    
+            UE_LOG_CATEGORY(LogLua, Log, "[Lua] %d\n", num);                                    
         },                                                                
                                                                           
         [](double num){                                                   
-            UE_LOG("[Lua] %f\n", num);                                    
+            UE_LOG_CATEGORY(LogLua, Log, "[Lua] %f\n", num);                                    
         },                                                                
                                                                           
         [](FVector Vector)                                                    
         {                                                                 
-            UE_LOG("[Lua] (%f, %f, %f)\n", Vector.X, Vector.Y, Vector.Z); 
+            UE_LOG_CATEGORY(LogLua, Log, "[Lua] (%f, %f, %f)\n", Vector.X, Vector.Y, Vector.Z); 
         }                                                                 
     ));
     
@@ -221,6 +256,27 @@ FLuaManager::FLuaManager()
             return nullptr; // 찾지 못함
         }
     );
+    SharedLib.set_function("FindObjectsByTag",
+        [this](const FString& Tag) -> sol::table
+        {
+            sol::table Result = Lua->create_table();
+            if (!GWorld)
+            {
+                return Result;
+            }
+
+            // 태그 인덱스에서 바로 조회 (월드 전체를 순회하지 않음)
+            int32 Index = 1;
+            for (AActor* Actor : GWorld->GetActorsWithTag(Tag))
+            {
+                if (FGameObject* GameObject = Actor->GetGameObject())
+                {
+                    Result[Index++] = GameObject;
+                }
+            }
+            return Result;
+        }
+    );
     SharedLib.set_function("FindComponentByName",
         [this](const FString& ComponentName) -> UActorComponent*
         {
@@ -362,6 +418,8 @@ FLuaManager::FLuaManager()
     sol::table MetaTableShared = Lua->create_table();
     MetaTableShared[sol::meta_function::index] = Lua->globals();
     SharedLib[sol::metatable_key]  = MetaTableShared;
+
+    CreateScriptTickDispatcher();
 }
 
 FLuaManager::~FLuaManager()
@@ -599,7 +657,7 @@ void FLuaManager::ExposeGlobalFunctions()
         "SetViewTarget", [](APlayerCameraManager* self, LuaComponentProxy& Proxy)
         {
             // 타입 안정성 확인
-            if (self && Proxy.Instance && Proxy.Class == UCameraComponent::StaticClass())
+            if (self && Proxy.IsValid() && Proxy.Class == UCameraComponent::StaticClass())
             {
                 // 프록시에서 실제 컴포넌트 포인터 추출
                 auto* CameraComp = static_cast<UCameraComponent*>(Proxy.Instance);
@@ -610,7 +668,7 @@ void FLuaManager::ExposeGlobalFunctions()
         "SetViewTargetWithBlend", [](APlayerCameraManager* self, LuaComponentProxy& Proxy, float InBlendTime)
         {
             // 타입 안정성 확인
-            if (self && Proxy.Instance && Proxy.Class == UCameraComponent::StaticClass())
+            if (self && Proxy.IsValid() && Proxy.Class == UCameraComponent::StaticClass())
             {
                 // 프록시에서 실제 컴포넌트 포인터 추출
                 auto* CameraComp = static_cast<UCameraComponent*>(Proxy.Instance);
@@ -631,6 +689,7 @@ void FLuaManager::ExposeGlobalFunctions()
 }
 
 bool FLuaManager::LoadScriptInto(sol::environment& Env, const FString& Path) {
+    FScopedMemoryTag MemTag(EMemoryTag::Lua);
     auto Chunk = Lua->load_file(Path);
     if (!Chunk.valid()) { sol::error Err = Chunk; UE_LOG("[Lua][error] %s", Err.what()); return false; }
     
@@ -643,14 +702,186 @@ bool FLuaManager::LoadScriptInto(sol::environment& Env, const FString& Path) {
 
 void FLuaManager::Tick(double DeltaSeconds)
 {
+    FScopedMemoryTag MemTag(EMemoryTag::Lua);
+    FlushScriptTicks();
     CoroutineSchedular.Tick(DeltaSeconds);
 }
 
+void FLuaManager::CreateScriptTickDispatcher()
+{
+    ScriptTickFuncs = Lua->create_table();
+    PendingTicks = Lua->create_table();
+    PendingTickElapsed = Lua->create_table();
+    PendingTickErrors = Lua->create_table();
+
+    sol::load_result Chunk = Lua->load(ScriptTickDispatcherSource, "ScriptTickDispatcher");
+    if (!Chunk.valid()) { sol::error Err = Chunk; UE_LOG("[Lua][error] %s", Err.what()); return; }
+
+    sol::protected_function Factory = Chunk;
+    auto Result = Factory([]() { return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64()); });
+    if (!Result.valid()) { sol::error Err = Result; UE_LOG("[Lua][error] %s", Err.what()); return; }
+    ScriptTickDispatcher = Result.get<sol::protected_function>();
+}
+
+int32 FLuaManager::RegisterScriptTick(ULuaScriptComponent* Component, const sol::protected_function& TickFunc, const FString& ScriptPath)
+{
+    if (!TickFunc.valid() || !ScriptTickFuncs.valid())
+    {
+        return -1;
+    }
+
+    int32 Slot;
+    if (!FreeTickSlots.IsEmpty())
+    {
+        Slot = FreeTickSlots.back();
+        FreeTickSlots.pop_back();
+    }
+    else
+    {
+        Slot = ScriptTickStats.Num();
+        ScriptTickStats.emplace_back();
+    }
+
+    FScriptTickStats& Stats = ScriptTickStats[Slot];
+    Stats = FScriptTickStats();
+    Stats.Component = Component;
+    Stats.ScriptPath = ScriptPath;
+    Stats.bActive = true;
+
+    ScriptTickFuncs.raw_set(Slot + 1, TickFunc);
+    return Slot;
+}
+
+void FLuaManager::UnregisterScriptTick(int32 Slot)
+{
+    if (Slot < 0 || Slot >= ScriptTickStats.Num() || !ScriptTickStats[Slot].bActive)
+    {
+        return;
+    }
+
+    // 통계는 슬롯이 재사용될 때까지 남겨 둠 (LogScriptTickStats에서 파괴된 스크립트도 확인 가능)
+    ScriptTickStats[Slot].bActive = false;
+    ScriptTickStats[Slot].Component = nullptr;
+    if (ScriptTickFuncs.valid())
+    {
+        ScriptTickFuncs.raw_set(Slot + 1, sol::lua_nil);
+    }
+    ReleasedTickSlots.Add(Slot);
+}
+
+void FLuaManager::QueueScriptTick(int32 Slot, float DeltaSeconds)
+{
+    PendingTickSlots.Add(Slot);
+    const int32 Index = PendingTickSlots.Num();
+    PendingTicks.raw_set(2 * Index - 1, Slot + 1, 2 * Index, DeltaSeconds);
+}
+
+void FLuaManager::RecordScriptTick(int32 Slot, double ElapsedMS, bool bFailed)
+{
+    FScriptTickStats& Stats = ScriptTickStats[Slot];
+    Stats.TotalMS += ElapsedMS;
+    Stats.LastMS = ElapsedMS;
+    Stats.MaxMS = std::max(Stats.MaxMS, ElapsedMS);
+    ++Stats.NumTicks;
+    if (bFailed)
+    {
+        ++Stats.NumErrors;
+    }
+}
+
+void FLuaManager::FlushScriptTicks()
+{
+    if (!PendingTickSlots.IsEmpty() && ScriptTickDispatcher.valid())
+    {
+        SCOPE_CYCLE_COUNTER(LuaScriptTickBatch)
+
+        const int32 Count = PendingTickSlots.Num();
+        auto Result = ScriptTickDispatcher(ScriptTickFuncs, PendingTicks, Count, PendingTickElapsed, PendingTickErrors);
+        if (!Result.valid())
+        {
+            sol::error Err = Result; UE_LOG("[Lua][error] %s\n", Err.what());
+        }
+        else
+        {
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                RecordScriptTick(PendingTickSlots[Index], PendingTickElapsed.raw_get<double>(Index + 1), false);
+            }
+
+            const int32 NumErrors = Result.get<int32>();
+            for (int32 Error = 1; Error <= NumErrors; ++Error)
+            {
+                const int32 Index = PendingTickErrors.raw_get<int32>(2 * Error - 1);
+                ++ScriptTickStats[PendingTickSlots[Index - 1]].NumErrors;
+                UE_LOG("[Lua][error] %s\n", PendingTickErrors.raw_get<FString>(2 * Error).c_str());
+            }
+        }
+    }
+    PendingTickSlots.Empty();
+
+    // 큐에 남아 있던 슬롯까지 처리했으므로 이제 재사용 가능
+    FreeTickSlots.insert(FreeTickSlots.end(), ReleasedTickSlots.begin(), ReleasedTickSlots.end());
+    ReleasedTickSlots.Empty();
+}
+
+void FLuaManager::LogScriptTickStats(int32 MaxScripts) const
+{
+    TArray<int32> Slots;
+    double FrameMS = 0.0;
+    for (int32 Slot = 0; Slot < ScriptTickStats.Num(); ++Slot)
+    {
+        const FScriptTickStats& Stats = ScriptTickStats[Slot];
+        if (Stats.NumTicks == 0)
+        {
+            continue;
+        }
+        Slots.Add(Slot);
+        if (Stats.bActive)
+        {
+            FrameMS += Stats.LastMS;
+        }
+    }
+
+    std::sort(Slots.begin(), Slots.end(), [this](int32 A, int32 B)
+    {
+        return ScriptTickStats[A].TotalMS > ScriptTickStats[B].TotalMS;
+    });
+
+    UE_LOG("Lua script tick (%s): %d scripts, %.3f ms last frame", bBatchedScriptTick ? "batched" : "direct", Slots.Num(), FrameMS);
+    UE_LOG("%-48s %9s %9s %9s %8s %6s", "Script", "Total(ms)", "Avg(ms)", "Max(ms)", "Ticks", "Errors");
+    for (int32 Index = 0; Index < Slots.Num() && Index < MaxScripts; ++Index)
+    {
+        const FScriptTickStats& Stats = ScriptTickStats[Slots[Index]];
+        UE_LOG("%-48s %9.3f %9.4f %9.4f %8u %6u%s", Stats.ScriptPath.c_str(), Stats.TotalMS,
+            Stats.TotalMS / Stats.NumTicks, Stats.MaxMS, Stats.NumTicks, Stats.NumErrors, Stats.bActive ? "" : " (ended)");
+    }
+}
+
+void FLuaManager::ResetScriptTickStats()
+{
+    for (FScriptTickStats& Stats : ScriptTickStats)
+    {
+        Stats.TotalMS = 0.0;
+        Stats.LastMS = 0.0;
+        Stats.MaxMS = 0.0;
+        Stats.NumTicks = 0;
+        Stats.NumErrors = 0;
+    }
+}
+
 void FLuaManager::ShutdownBeforeLuaClose()
 {
     CoroutineSchedular.ShutdownBeforeLuaClose();
+
+    PendingTickSlots.Empty();
+    ScriptTickDispatcher = sol::nil;
+    ScriptTickFuncs = sol::nil;
+    PendingTicks = sol::nil;
+    PendingTickElapsed = sol::nil;
+    PendingTickErrors = sol::nil;
     
     FLuaBindRegistry::Get().Reset();
+    ResetLuaClassDispatch();
     
     SharedLib = sol::nil;
 }
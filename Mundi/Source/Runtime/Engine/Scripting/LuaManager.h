@@ -5,6 +5,24 @@
 namespace sol { class state; }
 using state = sol::state;
 
+// 스크립트 print 출력 (LOG LEVEL Lua Warning 으로 끌 수 있음)
+DECLARE_LOG_CATEGORY(LogLua)
+
+class ULuaScriptComponent;
+
+/** 스크립트 하나(Tick 슬롯)의 누적 Tick 시간 */
+struct FScriptTickStats
+{
+    ULuaScriptComponent* Component = nullptr;   // 벤치마크처럼 컴포넌트 없이 등록하면 nullptr
+    FString ScriptPath;
+    double TotalMS = 0.0;
+    double LastMS = 0.0;
+    double MaxMS = 0.0;
+    uint32 NumTicks = 0;
+    uint32 NumErrors = 0;
+    bool bActive = false;
+};
+
 class FLuaManager
 {
 public:
@@ -28,10 +46,43 @@ public:
     
     class FLuaCoroutineScheduler& GetScheduler() { return CoroutineSchedular; }
 
+    // ===== 스크립트 Tick =====
+    // Direct: ULuaScriptComponent::TickComponent가 자기 Tick 함수를 바로 호출 (슬롯은 시간 집계용)
+    // Batched: TickComponent는 슬롯만 큐에 넣고, Tick()에서 Lua 디스패처 한 번이 큐 전체를 pcall로 순회
+    //          (C++ -> Lua 전환과 에러 핸들러 설정이 프레임당 한 번, 스크립트 Tick은 액터 Tick이 모두 끝난 뒤 실행)
+
+    static void SetBatchedScriptTick(bool bEnable) { bBatchedScriptTick = bEnable; }
+    static bool IsBatchedScriptTick() { return bBatchedScriptTick; }
+
+    int32 RegisterScriptTick(ULuaScriptComponent* Component, const sol::protected_function& TickFunc, const FString& ScriptPath);
+    void  UnregisterScriptTick(int32 Slot);
+    void  QueueScriptTick(int32 Slot, float DeltaSeconds);
+    void  RecordScriptTick(int32 Slot, double ElapsedMS, bool bFailed);
+    void  FlushScriptTicks();                  // Batched 큐 디스패치 (Tick에서 코루틴보다 먼저 호출)
+
+    const TArray<FScriptTickStats>& GetScriptTickStats() const { return ScriptTickStats; }
+    void  LogScriptTickStats(int32 MaxScripts) const;
+    void  ResetScriptTickStats();
+
 private:
+    void  CreateScriptTickDispatcher();
+
     sol::state* Lua = nullptr;
     sol::table SharedLib;                         // 공용 유틸 테이블
 
+    static bool bBatchedScriptTick;
+
+    sol::protected_function ScriptTickDispatcher;
+    sol::table ScriptTickFuncs;                   // [Slot + 1] = Tick 함수
+    sol::table PendingTicks;                      // [2i - 1] = Slot + 1, [2i] = DeltaSeconds
+    sol::table PendingTickElapsed;                // [i] = 스크립트 i의 Tick 시간 (ms)
+    sol::table PendingTickErrors;                 // [2k - 1] = i, [2k] = 에러 메시지
+    TArray<int32> PendingTickSlots;               // Lua 테이블을 다시 읽지 않도록 C++에도 같은 순서로 보관
+
+    TArray<FScriptTickStats> ScriptTickStats;     // 슬롯별
+    TArray<int32> FreeTickSlots;
+    TArray<int32> ReleasedTickSlots;              // 큐에 남아 있을 수 있으므로 Flush 후에 재사용
+
     FLuaCoroutineScheduler CoroutineSchedular;    // 씬 단위 Coroutine Manager
 };
 
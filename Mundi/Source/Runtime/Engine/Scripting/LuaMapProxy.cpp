@@ -96,7 +96,8 @@ sol::object LuaMapProxy::Index(sol::this_state LuaState, LuaMapProxy& Self, sol:
     else if (Self.Property->KeyType == EPropertyType::FName)
     {
         if (Key.get_type() != sol::type::string) return sol::nil;
-        FName LuaKey = FName(Key.as<FString>());
+        // 조회만 하므로 이름 테이블에 추가하지 않음 (없는 이름이면 None -> 맵에 없음)
+        FName LuaKey = FName::Find(Key.as<std::string_view>());
 
         switch (Self.Property->InnerType)
         {
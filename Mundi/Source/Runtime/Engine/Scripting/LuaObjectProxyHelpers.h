@@ -26,28 +26,13 @@ inline const TMap<EPropertyType, UClass*>& GetObjectPointerTypeMap()
     return ObjectPointerTypeMap;
 }
 
-// Validate UObject pointer using GUObjectArray
+// Validate UObject pointer against the live object set (Ptr is never dereferenced)
+// NOTE: Slots and addresses are reused, so a raw pointer cannot tell a deleted object from
+// a new one allocated at the same address. Hold a TWeakObjectPtr when the pointer outlives
+// the current call (see LuaComponentProxy).
 inline bool IsValidUObject(UObject* Ptr)
 {
-    if (!Ptr) return false;
-
-    // Step 1: Check InternalIndex range
-    uint32_t idx = Ptr->InternalIndex;
-    if (idx >= static_cast<uint32_t>(GUObjectArray.Num()))
-        return false;
-
-    // Step 2: Verify GUObjectArray slot points to the same object
-    UObject* RegisteredObj = GUObjectArray[idx];
-    if (RegisteredObj != Ptr)
-        return false;  // Deleted or different object
-
-    // Step 3: UUID validation (commented for now)
-    // TODO(SlotReuse): If ObjectFactory enables null slot reuse, uncomment below
-    // to prevent ABA problem (same address, different object):
-    // if (RegisteredObj->UUID != Ptr->UUID)
-    //     return false;
-
-    return true;
+    return ObjectFactory::IsLiveObject(Ptr);
 }
 
 // Check if EPropertyType represents a UObject pointer
@@ -0,0 +1,245 @@
+#include "pch.h"
+#include "LuaProxyBenchmark.h"
+#include "LuaBindHelpers.h"
+#include "LuaObjectProxyHelpers.h"
+#include "SceneComponent.h"
+#include "ObjectFactory.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+
+namespace
+{
+	constexpr int32 NumAccesses = 200000;
+
+	const char* BenchScript = R"(
+function ReadBool(Comp, Count)
+	local Value
+	for i = 1, Count do Value = Comp.bIsVisible end
+	return Value
+end
+function ReadVector(Comp, Count)
+	local Value
+	for i = 1, Count do Value = Comp.RelativeLocation end
+	return Value
+end
+function WriteBool(Comp, Count)
+	for i = 1, Count do Comp.bIsVisible = (i % 2 == 0) end
+end
+function CallMethod(Comp, Count)
+	for i = 1, Count do Comp:BenchSetVisibility(true) end
+end
+)";
+
+	struct FScenario
+	{
+		const char* Name;
+		const char* Function;
+	};
+
+	const FScenario Scenarios[] = {
+		{ "field read (bool)", "ReadBool" },
+		{ "field read (FVector)", "ReadVector" },
+		{ "field write (bool)", "WriteBool" },
+		{ "method call", "CallMethod" },
+	};
+	constexpr int32 NumScenarios = sizeof(Scenarios) / sizeof(Scenarios[0]);
+
+	// 이전 LuaComponentProxy::Index/NewIndex와 같은 구현 (벤치마크가 쓰는 프로퍼티 타입만 남김)
+	sol::object LegacyIndex(sol::this_state LuaState, LuaComponentProxy& Self, const char* Key)
+	{
+		if (!Self.IsValid())
+			return sol::nil;
+
+		sol::state_view LuaView(LuaState);
+		BuildBoundClass(Self.Class);
+
+		for (const UClass* CurrentClass = Self.Class; CurrentClass != nullptr; CurrentClass = CurrentClass->Super)
+		{
+			sol::table& BindTable = FLuaBindRegistry::Get().EnsureTable(LuaView, CurrentClass);
+			if (!BindTable.valid()) continue;
+
+			sol::object Result = BindTable[Key];
+			if (!Result.valid()) continue;
+
+			if (Result.is<sol::table>())
+			{
+				sol::table propDesc = Result.as<sol::table>();
+				sol::optional<bool> isProperty = propDesc["is_property"];
+
+				if (isProperty && *isProperty)
+				{
+					sol::object getterObj = propDesc["get"];
+					if (getterObj.valid())
+					{
+						sol::protected_function getter = getterObj.as<sol::protected_function>();
+						auto pfr = getter(Self);
+						if (pfr.valid())
+							return pfr.get<sol::object>();
+					}
+					return sol::nil;
+				}
+			}
+
+			if (Result.get_type() == sol::type::function)
+				return Result;
+		}
+
+		auto It = GBoundClasses.find(Self.Class);
+		if (It == GBoundClasses.end()) return sol::nil;
+
+		auto ItProp = It->second.PropsByName.find(Key);
+		if (ItProp == It->second.PropsByName.end()) return sol::nil;
+
+		const FProperty* Property = ItProp->second.Property;
+		switch (Property->Type)
+		{
+		case EPropertyType::Bool:
+			return sol::make_object(LuaView, *Property->GetValuePtr<bool>(Self.Instance));
+		case EPropertyType::Float:
+			return sol::make_object(LuaView, *Property->GetValuePtr<float>(Self.Instance));
+		case EPropertyType::Int32:
+			return sol::make_object(LuaView, *Property->GetValuePtr<int>(Self.Instance));
+		case EPropertyType::FVector:
+			return sol::make_object(LuaView, *Property->GetValuePtr<FVector>(Self.Instance));
+		default:
+			return sol::nil;
+		}
+	}
+
+	void LegacyNewIndex(LuaComponentProxy& Self, const char* Key, sol::object Obj)
+	{
+		if (!Self.IsValid() || !Self.Class) return;
+
+		sol::state_view LuaView = Obj.lua_state();
+		BuildBoundClass(Self.Class);
+
+		sol::table& BindTable = FLuaBindRegistry::Get().EnsureTable(LuaView, Self.Class);
+		if (BindTable.valid())
+		{
+			sol::object Property = BindTable[Key];
+			if (Property.valid() && Property.is<sol::table>())
+			{
+				sol::table propDesc = Property.as<sol::table>();
+				sol::optional<bool> isProperty = propDesc["is_property"];
+
+				if (isProperty && *isProperty)
+				{
+					sol::optional<bool> readOnly = propDesc["read_only"];
+					if (readOnly && *readOnly)
+						return;
+
+					sol::optional<sol::function> setter = propDesc["set"];
+					if (setter)
+					{
+						(*setter)(Self, Obj);
+					}
+					return;
+				}
+			}
+		}
+
+		auto IterateClass = GBoundClasses.find(Self.Class);
+		if (IterateClass == GBoundClasses.end()) return;
+
+		auto It = IterateClass->second.PropsByName.find(Key);
+		if (It == IterateClass->second.PropsByName.end()) return;
+
+		const FProperty* Property = It->second.Property;
+		switch (Property->Type)
+		{
+		case EPropertyType::Bool:
+			if (Obj.get_type() == sol::type::boolean)
+				*Property->GetValuePtr<bool>(Self.Instance) = Obj.as<bool>();
+			break;
+		case EPropertyType::Float:
+			if (Obj.get_type() == sol::type::number)
+				*Property->GetValuePtr<float>(Self.Instance) = static_cast<float>(Obj.as<double>());
+			break;
+		case EPropertyType::Int32:
+			if (Obj.get_type() == sol::type::number)
+				*Property->GetValuePtr<int>(Self.Instance) = static_cast<int>(Obj.as<double>());
+			break;
+		default:
+			break;
+		}
+	}
+
+	void LogScenario(const char* Name, uint64 Operations, double LegacyMS, double NewMS)
+	{
+		const double Speedup = NewMS > 0.0 ? LegacyMS / NewMS : 0.0;
+		const double Mops = NewMS > 0.0 ? static_cast<double>(Operations) / (NewMS * 1000.0) : 0.0;
+		UE_LOG("[LuaProxyBenchmark] %-26s %10.2f %10.2f %7.2fx %9.2f", Name, LegacyMS, NewMS, Speedup, Mops);
+	}
+
+	/** 첫 호출(바인드 테이블/디스패치 빌드)은 측정에서 제외 */
+	double RunScript(const sol::protected_function& Script, const sol::object& Proxy)
+	{
+		Script(Proxy, 1);
+		return MeasureMS([&]()
+		{
+			sol::protected_function_result Result = Script(Proxy, NumAccesses);
+			if (!Result.valid())
+			{
+				sol::error Error = Result;
+				UE_LOG("[LuaProxyBenchmark] script error: %s", Error.what());
+			}
+		});
+	}
+
+	/**
+	 * 새 Lua 상태에 Component usertype을 IndexFunc/NewIndexFunc로 등록하고 모든 시나리오 측정
+	 * 바인드 레지스트리/디스패치 캐시는 Lua 상태 하나를 전제로 하므로 상태 전후로 비움 (게임 쪽은 다음 접근 때 다시 빌드)
+	 */
+	template<typename IndexType, typename NewIndexType>
+	void RunAll(USceneComponent* Component, IndexType IndexFunc, NewIndexType NewIndexFunc, double (&OutMS)[NumScenarios])
+	{
+		FLuaBindRegistry::Get().Reset();
+		ResetLuaClassDispatch();
+		{
+			sol::state Lua;
+			Lua.open_libraries(sol::lib::base);
+			Lua.new_usertype<LuaComponentProxy>("Component",
+				sol::meta_function::index, IndexFunc,
+				sol::meta_function::new_index, NewIndexFunc
+			);
+			Lua.script(BenchScript);
+
+			// 메서드 호출 측정용 바인딩: 이 상태의 바인드 테이블에만 추가 (Reset과 함께 사라짐)
+			sol::table& BindTable = FLuaBindRegistry::Get().EnsureTable(Lua, USceneComponent::StaticClass());
+			AddMethod(BindTable, "BenchSetVisibility", &USceneComponent::SetVisibility);
+
+			const sol::object Proxy = MakeCompProxy(Lua, Component, Component->GetClass());
+			for (int32 Index = 0; Index < NumScenarios; ++Index)
+			{
+				const sol::protected_function Script = Lua[Scenarios[Index].Function];
+				OutMS[Index] = RunScript(Script, Proxy);
+			}
+
+			FLuaBindRegistry::Get().Reset();
+			ResetLuaClassDispatch();
+		}
+	}
+}
+
+void FLuaProxyBenchmark::RunAndLog()
+{
+	USceneComponent* Component = NewObject<USceneComponent>();
+
+	double LegacyMS[NumScenarios] = {};
+	double NewMS[NumScenarios] = {};
+	RunAll(Component, &LegacyIndex, &LegacyNewIndex, LegacyMS);
+	RunAll(Component, &LuaComponentProxy::Index, &LuaComponentProxy::NewIndex, NewMS);
+
+	UE_LOG("[LuaProxyBenchmark] %d accesses per scenario (%s)", NumAccesses, Component->GetClass()->Name);
+	UE_LOG("[LuaProxyBenchmark] %-26s %10s %10s %8s %9s", "Scenario", "Old(ms)", "New(ms)", "Speedup", "Mops/s");
+	for (int32 Index = 0; Index < NumScenarios; ++Index)
+	{
+		LogScenario(Scenarios[Index].Name, NumAccesses, LegacyMS[Index], NewMS[Index]);
+	}
+
+	ObjectFactory::DeleteObject(Component);
+}
+
+static const bool bLuaProxyBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"LUAPROXY BENCH", "-luaproxybench", "Lua component proxy benchmark (legacy chain walk vs per-class dispatch table)", EBenchmarkStage::None,
+	[](const FString&) { FLuaProxyBenchmark::RunAndLog(); } });
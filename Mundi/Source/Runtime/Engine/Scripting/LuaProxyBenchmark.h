@@ -0,0 +1,15 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief LuaComponentProxy 필드/메서드 접근 벤치마크 (콘솔 LUAPROXY BENCH 명령)
+ *
+ * 같은 USceneComponent를 이전 Index/NewIndex(접근마다 Super 체인의 바인드 테이블 탐색 + 타입 switch)와
+ * 현재 클래스별 디스패치 테이블 프록시로 감싸 Lua 루프에서 20만 번씩 접근합니다.
+ * - 필드 읽기(bool, FVector), 필드 쓰기(bool), 바인드 메서드 호출
+ */
+class FLuaProxyBenchmark
+{
+public:
+	static void RunAndLog();
+};
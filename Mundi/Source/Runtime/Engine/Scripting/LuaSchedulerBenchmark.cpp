@@ -0,0 +1,315 @@
+#include "pch.h"
+#include "LuaSchedulerBenchmark.h"
+#include "LuaCoroutineScheduler.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+
+namespace
+{
+	constexpr int32 NumCoroutines = 10000;
+	constexpr int32 NumTicks = 600;
+	constexpr double TickSeconds = 1.0 / 60.0;
+	constexpr int32 NumEventNames = 100;
+	constexpr int32 EventsPerTick = 2;
+	constexpr int32 PredicatesPerTick = 20;
+	constexpr int32 CoroutinesPerOwner = 10;
+	constexpr int32 OwnersPerTick = 10;
+
+	const char* BenchScript = R"(
+Resumes = 0
+Flags = {}
+function MakeTimer(Seconds)
+	return function() while true do Resumes = Resumes + 1; coroutine.yield("wait_time", Seconds) end end
+end
+function MakeEvent(Name)
+	return function() while true do Resumes = Resumes + 1; coroutine.yield("wait_event", Name) end end
+end
+function MakePredicate(Index)
+	local Condition = function() return Flags[Index] == true end
+	return function() while true do Resumes = Resumes + 1; coroutine.yield("wait_predicate", Condition); Flags[Index] = false end end
+end
+)";
+
+	// 이전 FLuaCoroutineScheduler와 같은 구현 (모든 작업을 매 Tick 순회, 끝난 작업은 플래그만, 이벤트는 문자열 비교)
+	struct FLegacyCoroTask
+	{
+		sol::thread Thread;
+		sol::coroutine Co;
+		void* Owner = nullptr;
+		EWaitType WaitType = EWaitType::None;
+		double WakeTime = 0.0;
+		std::function<bool()> Predicate;
+		std::string EventName;
+		bool Finished = false;
+		uint32 Id = 0;
+	};
+
+	class FLegacyCoroutineScheduler
+	{
+	public:
+		FLegacyCoroutineScheduler() { Tasks.Reserve(100); }
+
+		FLuaCoroHandle Register(sol::thread&& Thread, sol::coroutine&& Co, void* Owner)
+		{
+			FLegacyCoroTask Task;
+			Task.Thread = std::move(Thread);
+			Task.Co = std::move(Co);
+			Task.Owner = Owner;
+			Task.Id = ++NextId;
+			Tasks.push_back(std::move(Task));
+			return FLuaCoroHandle{ Task.Id };
+		}
+
+		void Tick(double DeltaTime)
+		{
+			NowSeconds += std::min(DeltaTime, 0.1);
+			for (auto& Task : Tasks)
+			{
+				if (Task.Finished)
+					continue;
+
+				switch (Task.WaitType)
+				{
+				case EWaitType::Time:
+					if (Task.WakeTime > NowSeconds) continue;
+					break;
+				case EWaitType::Predicate:
+					if (Task.Predicate && !Task.Predicate()) continue;
+					break;
+				}
+
+				sol::protected_function_result Result = Task.Co();
+				if (!Result.valid() || Result.status() != sol::call_status::yielded)
+				{
+					Task.Finished = true;
+					continue;
+				}
+
+				std::string Tag = Result.get<FString>(0);
+				if (Tag == "wait_time")
+				{
+					Task.WaitType = EWaitType::Time;
+					Task.WakeTime = NowSeconds + Result.get<double>(1);
+				}
+				else if (Tag == "wait_predicate")
+				{
+					sol::function Condition = Result.get<sol::function>(1);
+					Task.WaitType = EWaitType::Predicate;
+					Task.Predicate = [Condition]()
+					{
+						sol::protected_function_result Result = Condition();
+						if (!Result.valid()) return false;
+						return Result.get<bool>();
+					};
+				}
+				else if (Tag == "wait_event")
+				{
+					Task.WaitType = EWaitType::Event;
+					Task.EventName = Result.get<FString>(1);
+				}
+				else
+				{
+					Task.WaitType = EWaitType::None;
+				}
+			}
+		}
+
+		void TriggerEvent(const FString& EventName)
+		{
+			for (auto& Task : Tasks)
+			{
+				if (Task.Finished) continue;
+				if (Task.WaitType != EWaitType::Event) continue;
+				if (Task.EventName == EventName)
+				{
+					Task.WaitType = EWaitType::None;
+					Task.Co();
+				}
+			}
+		}
+
+		void CancelByOwner(void* Owner)
+		{
+			for (auto& Task : Tasks)
+			{
+				if (Task.Owner == Owner && !Task.Finished)
+				{
+					Task.Finished = true;
+					Task.Co = sol::coroutine();
+				}
+			}
+		}
+
+		void ShutdownBeforeLuaClose()
+		{
+			for (auto& Task : Tasks)
+			{
+				if (Task.Co.valid())
+				{
+					Task.Co.abandon();
+				}
+			}
+			Tasks.Empty();
+		}
+
+		int32 Num() const { return Tasks.Num(); }
+
+	private:
+		TArray<FLegacyCoroTask> Tasks;
+		uint32 NextId = 0;
+		double NowSeconds = 0.0;
+	};
+
+	void LogScenario(const char* Name, uint64 Operations, double LegacyMS, double NewMS)
+	{
+		const double Speedup = NewMS > 0.0 ? LegacyMS / NewMS : 0.0;
+		const double Mops = NewMS > 0.0 ? static_cast<double>(Operations) / (NewMS * 1000.0) : 0.0;
+		UE_LOG("[LuaSchedulerBenchmark] %-26s %10.2f %10.2f %7.2fx %9.2f", Name, LegacyMS, NewMS, Speedup, Mops);
+	}
+
+	/** ULuaScriptComponent의 StartCoroutine과 같은 방식으로 전용 스레드에 코루틴 생성 */
+	template<typename SchedulerType>
+	void Spawn(sol::state& Lua, SchedulerType& Scheduler, const sol::function& Body, void* Owner)
+	{
+		sol::thread Thread = sol::thread::create(Lua);
+		sol::state_view ThreadState = Thread.state();
+		sol::coroutine Coroutine(ThreadState.lua_state(), Body);
+		Scheduler.Register(std::move(Thread), std::move(Coroutine), Owner);
+	}
+
+	void* MakeOwner(int32 Index)
+	{
+		return reinterpret_cast<void*>(static_cast<uintptr_t>(Index + 1) * 16);
+	}
+
+	FString MakeEventName(int32 Index)
+	{
+		return "Event" + std::to_string(Index % NumEventNames);
+	}
+
+	/** 코루틴 생성 → 첫 Tick(모두 첫 yield까지 실행)은 측정에서 제외 → NumTicks Tick 측정 */
+	template<typename SchedulerType, typename SetupType, typename TickType>
+	double RunScenario(sol::state& Lua, SetupType&& Setup, TickType&& PerTick, int64& OutResumes)
+	{
+		SchedulerType Scheduler;
+		Setup(Scheduler);
+		Scheduler.Tick(TickSeconds);
+
+		Lua["Resumes"] = 0;
+		const double ElapsedMS = MeasureMS([&]()
+		{
+			for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+			{
+				PerTick(Scheduler, Tick);
+				Scheduler.Tick(TickSeconds);
+			}
+		});
+		OutResumes = Lua["Resumes"].get<int64>();
+
+		Scheduler.ShutdownBeforeLuaClose();
+		Lua.collect_garbage();
+		return ElapsedMS;
+	}
+
+	template<typename SetupType, typename TickType>
+	void CompareScenario(sol::state& Lua, const char* Name, SetupType&& Setup, TickType&& PerTick)
+	{
+		int64 LegacyResumes = 0;
+		int64 NewResumes = 0;
+		const double LegacyMS = RunScenario<FLegacyCoroutineScheduler>(Lua, Setup, PerTick, LegacyResumes);
+		const double NewMS = RunScenario<FLuaCoroutineScheduler>(Lua, Setup, PerTick, NewResumes);
+		LogScenario(Name, static_cast<uint64>(NumCoroutines) * NumTicks, LegacyMS, NewMS);
+		UE_LOG("[LuaSchedulerBenchmark]   resumes: old %lld, new %lld", LegacyResumes, NewResumes);
+	}
+}
+
+void FLuaSchedulerBenchmark::RunAndLog()
+{
+	sol::state Lua;
+	Lua.open_libraries(sol::lib::base, sol::lib::coroutine);
+	Lua.script(BenchScript);
+
+	const sol::function MakeTimer = Lua["MakeTimer"];
+	const sol::function MakeEvent = Lua["MakeEvent"];
+	const sol::function MakePredicate = Lua["MakePredicate"];
+
+	UE_LOG("[LuaSchedulerBenchmark] %d coroutines, %d ticks per scenario", NumCoroutines, NumTicks);
+	UE_LOG("[LuaSchedulerBenchmark] %-26s %10s %10s %8s %9s", "Scenario", "Old(ms)", "New(ms)", "Speedup", "Mticks/s");
+
+	CompareScenario(Lua, "wait_time",
+		[&](auto& Scheduler)
+		{
+			for (int32 Index = 0; Index < NumCoroutines; ++Index)
+			{
+				const sol::function Body = MakeTimer(0.25 + static_cast<double>(Index % 64) * 0.01);
+				Spawn(Lua, Scheduler, Body, MakeOwner(Index / CoroutinesPerOwner));
+			}
+		},
+		[](auto&, int32) {});
+
+	CompareScenario(Lua, "wait_event",
+		[&](auto& Scheduler)
+		{
+			for (int32 Index = 0; Index < NumCoroutines; ++Index)
+			{
+				const sol::function Body = MakeEvent(MakeEventName(Index));
+				Spawn(Lua, Scheduler, Body, MakeOwner(Index / CoroutinesPerOwner));
+			}
+		},
+		[](auto& Scheduler, int32 Tick)
+		{
+			for (int32 Event = 0; Event < EventsPerTick; ++Event)
+			{
+				Scheduler.TriggerEvent(MakeEventName(Tick * EventsPerTick + Event));
+			}
+		});
+
+	sol::table Flags = Lua["Flags"];
+	CompareScenario(Lua, "wait_predicate",
+		[&](auto& Scheduler)
+		{
+			for (int32 Index = 0; Index < NumCoroutines; ++Index)
+			{
+				Flags[Index] = false;
+				const sol::function Body = MakePredicate(Index);
+				Spawn(Lua, Scheduler, Body, MakeOwner(Index / CoroutinesPerOwner));
+			}
+		},
+		[&](auto&, int32 Tick)
+		{
+			for (int32 Flag = 0; Flag < PredicatesPerTick; ++Flag)
+			{
+				Flags[(Tick * PredicatesPerTick + Flag) * 7 % NumCoroutines] = true;
+			}
+		});
+
+	// Owner(컴포넌트) 단위로 취소 후 다시 등록: 이전 스케줄러는 끝난 작업이 배열에 계속 쌓임
+	int32 NumSpawnedOwners = 0;
+	CompareScenario(Lua, "churn (cancel + spawn)",
+		[&](auto& Scheduler)
+		{
+			NumSpawnedOwners = NumCoroutines / CoroutinesPerOwner;
+			for (int32 Index = 0; Index < NumCoroutines; ++Index)
+			{
+				const sol::function Body = MakeTimer(0.25 + static_cast<double>(Index % 64) * 0.01);
+				Spawn(Lua, Scheduler, Body, MakeOwner(Index / CoroutinesPerOwner));
+			}
+		},
+		[&](auto& Scheduler, int32 Tick)
+		{
+			for (int32 Owner = 0; Owner < OwnersPerTick; ++Owner)
+			{
+				Scheduler.CancelByOwner(MakeOwner(Tick * OwnersPerTick + Owner));
+				for (int32 Index = 0; Index < CoroutinesPerOwner; ++Index)
+				{
+					const sol::function Body = MakeTimer(0.25 + static_cast<double>(Index) * 0.05);
+					Spawn(Lua, Scheduler, Body, MakeOwner(NumSpawnedOwners));
+				}
+				++NumSpawnedOwners;
+			}
+		});
+}
+
+static const bool bLuaSchedulerBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"COROUTINE BENCH", "-coroutinebench", "Lua coroutine scheduler benchmark (10k coroutines, legacy scan vs heap/event map)", EBenchmarkStage::None,
+	[](const FString&) { FLuaSchedulerBenchmark::RunAndLog(); } });
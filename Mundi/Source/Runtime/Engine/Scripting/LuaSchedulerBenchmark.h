@@ -0,0 +1,17 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief Lua 코루틴 스케줄러 벤치마크 (콘솔 COROUTINE BENCH 명령)
+ *
+ * 코루틴 1만 개를 같은 Lua 스크립트로 만들어 이전 스케줄러(배열 전체 순회)와 현재 FLuaCoroutineScheduler에서 600 Tick 돌립니다.
+ * - wait_time: 0.25~0.88초 간격 타이머
+ * - wait_event: 이벤트 이름 100개에 나눠 대기, Tick마다 2개 트리거
+ * - wait_predicate: Tick마다 조건 20개를 참으로 설정
+ * - churn: Tick마다 Owner 10개(코루틴 100개)를 취소하고 새로 등록
+ */
+class FLuaSchedulerBenchmark
+{
+public:
+	static void RunAndLog();
+};
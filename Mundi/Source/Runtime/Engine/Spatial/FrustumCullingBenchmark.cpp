@@ -0,0 +1,259 @@
+#include "pch.h"
+#include "FrustumCullingBenchmark.h"
+#include "PrimitiveBoundsSoA.h"
+#include "Frustum.h"
+#include "AABB.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+#include <thread>
+
+namespace
+{
+	constexpr int32 NumPrimitives = 100000;
+	constexpr float WorldHalfSize = 500.0f;
+	constexpr int32 NumViews = 4;
+	constexpr float NearPlane = 0.1f;
+	constexpr float FarPlane = 400.0f;
+	constexpr int32 NumIterations = 50;
+
+	/** 재현 가능한 난수 (실행마다 같은 배치) */
+
+	struct FScenarioResult
+	{
+		FString Name;
+		double MS = 0.0;            // 뷰 하나 기준 (여러 뷰를 한 번에 도는 시나리오는 뷰 수로 나눔)
+		int32 NumVisible = 0;       // 뷰 평균
+		int32 NumMismatches = 0;    // 기준 구현과 인덱스 목록이 다른 뷰 수
+	};
+
+	/** 원점 카메라가 수평으로 NumViews 방향을 바라보는 절두체 (엔진 좌표: X=Forward, Z=Up) */
+	void MakeFrustums(TArray<FFrustum>& OutFrustums)
+	{
+		const FMatrix ProjMatrix = FMatrix::PerspectiveFovLH(DegreesToRadians(60.0f), 16.0f / 9.0f, NearPlane, FarPlane);
+		for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+		{
+			const float Angle = 2.0f * PI * static_cast<float>(ViewIndex) / static_cast<float>(NumViews);
+			const FVector Eye(0.0f, 0.0f, 0.0f);
+			const FVector At(std::cos(Angle), std::sin(Angle), 0.0f);
+			const FMatrix ViewMatrix = FMatrix::LookAtLH(Eye, At, FVector(0.0f, 0.0f, 1.0f));
+			OutFrustums.Add(CreateFrustumFromViewProjection(ViewMatrix * ProjMatrix));
+		}
+	}
+
+	/** Func(청크 Begin, End, 출력 배열)을 스레드마다 NumIterations번 실행하고 한 번당 벽시계 시간 반환 */
+	template<typename FuncType>
+	double MeasureParallelMS(int32 NumThreads, TArray<TArray<int32>>& Outputs, FuncType&& Func)
+	{
+		TArray<std::thread> Threads;
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+		{
+			Threads.emplace_back([&, ThreadIndex]()
+			{
+				for (int32 i = 0; i < NumIterations; ++i)
+				{
+					Func(ThreadIndex, Outputs[ThreadIndex]);
+				}
+			});
+		}
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) / static_cast<double>(NumIterations);
+	}
+
+	void LogScenario(const FScenarioResult& Result, double BaselineMS)
+	{
+		const double Speedup = Result.MS > 0.0 ? BaselineMS / Result.MS : 0.0;
+		UE_LOG("[FrustumCullingBenchmark] %-34s %10.4f %8.2fx %9d %s", Result.Name.c_str(), Result.MS, Speedup, Result.NumVisible,
+			Result.NumMismatches == 0 ? "PASS" : "FAIL");
+	}
+
+	void WriteReport(const FString& ReportPath, const TArray<FScenarioResult>& Results)
+	{
+		std::ofstream File(UTF8ToWide(ReportPath));
+		if (!File.is_open())
+		{
+			UE_LOG("[error] FrustumCullingBenchmark: failed to open %s", ReportPath.c_str());
+			return;
+		}
+		File.setf(std::ios::fixed);
+		File.precision(4);
+
+		File << "{\n  \"primitives\": " << NumPrimitives
+			<< ",\n  \"views\": " << NumViews
+			<< ",\n  \"simdWidth\": " << FPrimitiveBoundsSoA::SimdWidth
+			<< ",\n  \"scenarios\": [";
+		for (int32 Index = 0; Index < Results.Num(); ++Index)
+		{
+			const FScenarioResult& Result = Results[Index];
+			File << (Index == 0 ? "\n" : ",\n")
+				<< "    { \"name\": \"" << Result.Name
+				<< "\", \"msPerView\": " << Result.MS
+				<< ", \"visible\": " << Result.NumVisible
+				<< ", \"mismatches\": " << Result.NumMismatches << " }";
+		}
+		File << "\n  ]\n}\n";
+		UE_LOG("[FrustumCullingBenchmark] report -> %s", ReportPath.c_str());
+	}
+}
+
+void FFrustumCullingBenchmark::RunAndLog(const FString& ReportPath)
+{
+	// 같은 박스를 AoS(이전 방식)와 SoA에 넣음
+	TArray<FAABB> Bounds;
+	Bounds.Reserve(NumPrimitives);
+	FPrimitiveBoundsSoA BoundsSoA;
+	FBenchmarkRandom Random(0xC0FFEEu);
+	for (int32 Index = 0; Index < NumPrimitives; ++Index)
+	{
+		const FVector Center(Random.Range(-WorldHalfSize, WorldHalfSize), Random.Range(-WorldHalfSize, WorldHalfSize), Random.Range(-50.0f, 50.0f));
+		const FVector Extent(Random.Range(0.5f, 8.0f), Random.Range(0.5f, 8.0f), Random.Range(0.5f, 8.0f));
+		Bounds.Add(FAABB(Center - Extent, Center + Extent));
+		BoundsSoA.Add(nullptr, Bounds[Index]);
+	}
+
+	TArray<FFrustum> Frustums;
+	MakeFrustums(Frustums);
+
+	// 모든 시나리오의 결과를 비교할 기준: 뷰마다 IsAABBVisible로 고른 인덱스 목록 (오름차순)
+	TArray<TArray<int32>> ReferenceIndices;
+	ReferenceIndices.SetNum(NumViews);
+	for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+	{
+		for (int32 Index = 0; Index < NumPrimitives; ++Index)
+		{
+			if (IsAABBVisible(Frustums[ViewIndex], Bounds[Index]))
+			{
+				ReferenceIndices[ViewIndex].Add(Index);
+			}
+		}
+	}
+
+	const int32 NumThreads = std::clamp(static_cast<int32>(std::thread::hardware_concurrency()), 1, 8);
+	UE_LOG("[FrustumCullingBenchmark] %d primitives, %d views, SoA SIMD x%d, %d threads",
+		NumPrimitives, NumViews, FPrimitiveBoundsSoA::SimdWidth, NumThreads);
+	UE_LOG("[FrustumCullingBenchmark] %-34s %10s %9s %9s %s", "Scenario", "ms/view", "Speedup", "Visible", "Indices");
+
+	TArray<FScenarioResult> Results;
+	TArray<int32> VisibleIndices;
+	TArray<int32> MergedIndices;
+	// 청크 출력은 스레드(청크) 순서로 이어 붙이면 전체 컬링 결과와 같은 순서가 됨
+	auto Merge = [&](const TArray<TArray<int32>>& Outputs) -> const TArray<int32>&
+	{
+		MergedIndices.Empty();
+		for (const TArray<int32>& Output : Outputs)
+		{
+			MergedIndices.insert(MergedIndices.end(), Output.begin(), Output.end());
+		}
+		return MergedIndices;
+	};
+
+	// 1) 이전 방식: 박스마다 IsAABBVisible (AoS, 6평면 스칼라 + 조기 탈락)
+	{
+		FScenarioResult Result;
+		Result.Name = "AoS IsAABBVisible";
+		int32 TotalVisible = 0;
+		for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+		{
+			const FFrustum& Frustum = Frustums[ViewIndex];
+			Result.MS += MeasureMS(NumIterations, [&]()
+			{
+				VisibleIndices.Empty();
+				for (int32 Index = 0; Index < NumPrimitives; ++Index)
+				{
+					if (IsAABBVisible(Frustum, Bounds[Index]))
+					{
+						VisibleIndices.Add(Index);
+					}
+				}
+			}) / NumViews;
+			TotalVisible += VisibleIndices.Num();
+			Result.NumMismatches += VisibleIndices != ReferenceIndices[ViewIndex] ? 1 : 0;
+		}
+		Result.NumVisible = TotalVisible / NumViews;
+		Results.Add(Result);
+	}
+
+	// 2) SoA SIMD, 한 스레드
+	{
+		FScenarioResult Result;
+		Result.Name = FPrimitiveBoundsSoA::SimdWidth == 8 ? "SoA SIMD x8 (AVX)" : "SoA SIMD x4 (SSE)";
+		int32 TotalVisible = 0;
+		for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+		{
+			const FFrustum& Frustum = Frustums[ViewIndex];
+			Result.MS += MeasureMS(NumIterations, [&]()
+			{
+				BoundsSoA.CullFrustum(Frustum, VisibleIndices);
+			}) / NumViews;
+			TotalVisible += VisibleIndices.Num();
+			Result.NumMismatches += VisibleIndices != ReferenceIndices[ViewIndex] ? 1 : 0;
+		}
+		Result.NumVisible = TotalVisible / NumViews;
+		Results.Add(Result);
+	}
+
+	// 3) SoA SIMD, 한 뷰를 청크로 나눠 스레드마다 (청크 경계는 SIMD 폭에 맞춤)
+	if (NumThreads > 1)
+	{
+		FScenarioResult Result;
+		Result.Name = "SoA SIMD, chunks x" + std::to_string(NumThreads);
+		const int32 ChunkSize = ((NumPrimitives + NumThreads - 1) / NumThreads + 7) & ~7;
+		TArray<TArray<int32>> Outputs;
+		Outputs.SetNum(NumThreads);
+		int32 TotalVisible = 0;
+		for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+		{
+			const FFrustum& Frustum = Frustums[ViewIndex];
+			Result.MS += MeasureParallelMS(NumThreads, Outputs, [&](int32 ThreadIndex, TArray<int32>& Output)
+			{
+				Output.Empty();
+				BoundsSoA.CullFrustum(Frustum, ThreadIndex * ChunkSize, (ThreadIndex + 1) * ChunkSize, Output);
+			}) / NumViews;
+			const TArray<int32>& Merged = Merge(Outputs);
+			TotalVisible += Merged.Num();
+			Result.NumMismatches += Merged != ReferenceIndices[ViewIndex] ? 1 : 0;
+		}
+		Result.NumVisible = TotalVisible / NumViews;
+		Results.Add(Result);
+	}
+
+	// 4) SoA SIMD, 뷰마다 스레드 하나 (분할 화면/그림자 뷰처럼 뷰 여러 개를 동시에)
+	if (NumThreads > 1)
+	{
+		FScenarioResult Result;
+		Result.Name = "SoA SIMD, views in parallel";
+		TArray<TArray<int32>> Outputs;
+		Outputs.SetNum(NumViews);
+		Result.MS = MeasureParallelMS(NumViews, Outputs, [&](int32 ThreadIndex, TArray<int32>& Output)
+		{
+			BoundsSoA.CullFrustum(Frustums[ThreadIndex], Output);
+		}) / NumViews;
+		int32 TotalVisible = 0;
+		for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+		{
+			TotalVisible += Outputs[ViewIndex].Num();
+			Result.NumMismatches += Outputs[ViewIndex] != ReferenceIndices[ViewIndex] ? 1 : 0;
+		}
+		Result.NumVisible = TotalVisible / NumViews;
+		Results.Add(Result);
+	}
+
+	const double BaselineMS = Results[0].MS;
+	for (const FScenarioResult& Result : Results)
+	{
+		LogScenario(Result, BaselineMS);
+	}
+
+	if (!ReportPath.empty())
+	{
+		WriteReport(ReportPath, Results);
+	}
+}
+
+// 절두체 컬링 벤치마크는 무작위 바운드만 사용하므로 디바이스/월드 없이 실행
+static const bool bFrustumCullingBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"FRUSTUM BENCH", "-frustumbench", "frustum culling benchmark (AoS per-box test vs SoA SIMD, 100k primitives)", EBenchmarkStage::None,
+	[](const FString& ReportPath) { FFrustumCullingBenchmark::RunAndLog(ReportPath); } });
@@ -0,0 +1,16 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 뷰 절두체 컬링 벤치마크 (콘솔 FRUSTUM BENCH 명령, 헤드리스 -frustumbench)
+ *
+ * 무작위 AABB 100k개를 이전 방식(FAABB 배열을 하나씩 IsAABBVisible)과 FPrimitiveBoundsSoA(SIMD 묶음 판정,
+ * 보이는 인덱스 압축 목록)로 컬링해서 뷰마다 시간을 비교하고, 같은 SoA를 청크/뷰 단위로 여러 스레드에 나눈 처리량도 측정합니다.
+ * 시나리오마다(스레드 결과 포함) 보이는 인덱스 목록을 기준 구현과 비교합니다. 월드/렌더러 없이 실행됩니다.
+ */
+class FFrustumCullingBenchmark
+{
+public:
+	/** @param ReportPath 비어 있지 않으면 시나리오별 결과를 JSON으로도 저장 */
+	static void RunAndLog(const FString& ReportPath = "");
+};
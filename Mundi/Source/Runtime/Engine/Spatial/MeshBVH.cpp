@@ -5,6 +5,7 @@ void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>
 {
 	TriIndices.Empty();
 	Nodes.Empty();
+	TriPositions.Empty();
 	uint32 TriCount = Indices.Num() / 3;
 	if (TriCount == 0) return;
 
@@ -13,14 +14,21 @@ void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>
 		TriIndices.Add(t);
 
 	BuildRecursive(0, TriCount, Vertices, Indices);
+
+	// 리프 순서대로 삼각형 좌표를 펼쳐 둔다 (노드의 Start/Count가 그대로 TriPositions 구간이 됨)
+	TriPositions.SetNum(static_cast<int32>(TriCount * 3));
+	for (uint32 Slot = 0; Slot < TriCount; ++Slot)
+	{
+		const uint32 TriangleID = TriIndices[Slot];
+		TriPositions[3 * Slot + 0] = Vertices[Indices[3 * TriangleID + 0]].pos;
+		TriPositions[3 * Slot + 1] = Vertices[Indices[3 * TriangleID + 1]].pos;
+		TriPositions[3 * Slot + 2] = Vertices[Indices[3 * TriangleID + 2]].pos;
+	}
 }
 
 // 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다. 
 // Möller–Trumbore로 교차 체크 ! 
-bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
-	const TArray<FNormalVertex>& InVertices,
-	const TArray<uint32>& InIndices,
-	float& OutHitDistance)
+bool FMeshBVH::IntersectRay(const FRay& InLocalRay, float& OutHitDistance)
 {
 	if (Nodes.Num() == 0)
 	{
@@ -57,14 +65,10 @@ bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
 		{
 			for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
 			{
-				const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
-				const uint32 V0 = InIndices[3 * TriangleID + 0];
-				const uint32 V1 = InIndices[3 * TriangleID + 1];
-				const uint32 V2 = InIndices[3 * TriangleID + 2];
-
-				const FVector& A = InVertices[V0].pos;
-				const FVector& B = InVertices[V1].pos;
-				const FVector& C = InVertices[V2].pos;
+				const uint32 Slot = Node.Start + TriOffset;
+				const FVector& A = TriPositions[3 * Slot + 0];
+				const FVector& B = TriPositions[3 * Slot + 1];
+				const FVector& C = TriPositions[3 * Slot + 2];
 
 				float HitT = 0.0f;
 				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT))
@@ -23,7 +23,8 @@ public:
 
 	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
-	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
+	// 빌드 시 만든 TriPositions만 읽으므로 원본 정점/인덱스 배열이 필요 없음
+	bool IntersectRay(const FRay& InLocalRay, float& OutHitDistance);
 
 
 private:
@@ -42,6 +43,9 @@ private:
 	//삼각형 ID(번호) 목록 , 삼각형의 인덱스를 의미한다. 
 	//삼각형 순서만 재배치  , 정점 좌표와 인덱스 버퍼를 직접적으로 건들면 안되기 때문이다.
 	TArray<uint32> TriIndices;
+	// 삼각형 정점 좌표만 TriIndices 순서대로 모은 압축 스트림 (삼각형당 FVector 3개)
+	// 리프 검사 시 64바이트 FNormalVertex 대신 연속된 위치만 읽도록 함
+	TArray<FVector> TriPositions;
 	const uint32 LeafSize = 4;
 };
 
@@ -1,228 +1,523 @@
 ﻿#include "pch.h"
 #include "Occlusion.h"
-#include "Frustum.h"
+#include "MeshComponent.h"
+#include "StaticMeshComponent.h"
+#include "StaticMesh.h"
+#include "PlatformTime.h"
 
-// NDC Z가 [-1..1]인 프로젝션이면 아래 변환을 켜세요.
-// static inline float To01(float z_ndc) { return z_ndc * 0.5f + 0.5f; }
-static inline void Clamp01(float& v) { v = std::max(0.0f, std::min(1.0f, v)); }
+//====================================================================================
+// FOcclusionGrid
+//====================================================================================
 
-// 헬퍼: 뷰공간 Z → [0..1] 선형
-static inline float LinearizeZ01(float zView, float zNear, float zFar) {
-	// LH 기준, 카메라 앞 z가 + 방향일 때
-	float z = (zView - zNear) / (zFar - zNear);
-	return std::max(0.f, std::min(1.f, z));
+bool FOcclusionGrid::RasterizeTriangle(const float X[3], const float Y[3], float MaxZ)
+{
+	// 감기 순서를 반시계로 맞춰서 삼각형 안쪽의 에지 함수가 양수가 되도록
+	const float Area = (X[1] - X[0]) * (Y[2] - Y[0]) - (X[2] - X[0]) * (Y[1] - Y[0]);
+	if (std::fabs(Area) < 1e-6f)
+	{
+		return false;
+	}
+	const int I1 = Area > 0.0f ? 1 : 2;
+	const int I2 = Area > 0.0f ? 2 : 1;
+	const float VX[3] = { X[0], X[I1], X[I2] };
+	const float VY[3] = { Y[0], Y[I1], Y[I2] };
+
+	// 화면 경계로 자른 픽셀 범위 (화면 밖 큰 좌표가 int로 넘치지 않도록 float에서 먼저 클램프)
+	const float MinXF = std::max(0.0f, std::min({ VX[0], VX[1], VX[2] }));
+	const float MinYF = std::max(0.0f, std::min({ VY[0], VY[1], VY[2] }));
+	const float MaxXF = std::min(float(Width), std::max({ VX[0], VX[1], VX[2] }));
+	const float MaxYF = std::min(float(Height), std::max({ VY[0], VY[1], VY[2] }));
+	const int MinPX = int(MinXF);
+	const int MinPY = int(MinYF);
+	const int MaxPX = std::min(Width - 1, int(std::ceil(MaxXF)) - 1);
+	const int MaxPY = std::min(Height - 1, int(std::ceil(MaxYF)) - 1);
+	if (MinPX > MaxPX || MinPY > MaxPY)
+	{
+		return false;
+	}
+
+	// 에지 함수 E(p) = A * p.x + B * p.y + C, 픽셀 중심에서 세 에지 모두 E >= 0이면 덮인 픽셀
+	__m128 EdgeA[3], EdgeStep[3];
+	float EdgeB[3], EdgeC[3];
+	for (int Edge = 0; Edge < 3; ++Edge)
+	{
+		const int Va = Edge;
+		const int Vb = (Edge + 1) % 3;
+		const float A = VY[Va] - VY[Vb];
+		const float B = VX[Vb] - VX[Va];
+		EdgeA[Edge] = _mm_set1_ps(A);
+		EdgeStep[Edge] = _mm_set1_ps(A * 4.0f);
+		EdgeB[Edge] = B;
+		EdgeC[Edge] = -(A * VX[Va] + B * VY[Va]);
+	}
+
+	// 4픽셀 단위로 정렬된 시작 열 (범위 밖 픽셀은 삼각형 밖이므로 에지 테스트에서 걸러짐)
+	const int StartX = MinPX & ~3;
+	const __m128 PixelCenters = _mm_add_ps(_mm_set1_ps(float(StartX)), _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f));
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 DepthZ = _mm_set1_ps(MaxZ);
+
+	TArray<float>& Depth = Levels[0];
+	bool bWritten = false;
+	for (int PY = MinPY; PY <= MaxPY; ++PY)
+	{
+		const float CenterY = float(PY) + 0.5f;
+		__m128 E0 = _mm_add_ps(_mm_mul_ps(EdgeA[0], PixelCenters), _mm_set1_ps(EdgeB[0] * CenterY + EdgeC[0]));
+		__m128 E1 = _mm_add_ps(_mm_mul_ps(EdgeA[1], PixelCenters), _mm_set1_ps(EdgeB[1] * CenterY + EdgeC[1]));
+		__m128 E2 = _mm_add_ps(_mm_mul_ps(EdgeA[2], PixelCenters), _mm_set1_ps(EdgeB[2] * CenterY + EdgeC[2]));
+
+		float* Row = &Depth[size_t(PY) * Width];
+		for (int PX = StartX; PX <= MaxPX; PX += 4)
+		{
+			const __m128 Inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(E0, Zero), _mm_cmpge_ps(E1, Zero)), _mm_cmpge_ps(E2, Zero));
+			if (_mm_movemask_ps(Inside))
+			{
+				const __m128 Old = _mm_loadu_ps(Row + PX);
+				const __m128 New = _mm_or_ps(_mm_and_ps(Inside, DepthZ), _mm_andnot_ps(Inside, Old)); // SSE2 select
+				_mm_storeu_ps(Row + PX, _mm_min_ps(Old, New)); // 가장 가까운 깊이로 갱신
+				bWritten = true;
+			}
+			E0 = _mm_add_ps(E0, EdgeStep[0]);
+			E1 = _mm_add_ps(E1, EdgeStep[1]);
+			E2 = _mm_add_ps(E2, EdgeStep[2]);
+		}
+	}
+	return bWritten;
 }
 
-// FBound(Min/Max) → 8코너
-static inline void MakeAabbCornersMinMax(const FAABB& B, FVector Corners[8])
+void FOcclusionGrid::BuildHZB()
 {
-	const FVector& mn = B.Min;
-	const FVector& mx = B.Max;
-	Corners[0] = { mn.X, mn.Y, mn.Z };
-	Corners[1] = { mx.X, mn.Y, mn.Z };
-	Corners[2] = { mn.X, mx.Y, mn.Z };
-	Corners[3] = { mx.X, mx.Y, mn.Z };
-	Corners[4] = { mn.X, mn.Y, mx.Z };
-	Corners[5] = { mx.X, mn.Y, mx.Z };
-	Corners[6] = { mn.X, mx.Y, mx.Z };
-	Corners[7] = { mx.X, mx.Y, mx.Z };
+	for (int Level = 1; Level < GetNumLevels(); ++Level)
+	{
+		const TArray<float>& Src = Levels[Level - 1];
+		TArray<float>& Dst = Levels[Level];
+		const int SW = LevelWidths[Level - 1], SH = LevelHeights[Level - 1];
+		const int DW = LevelWidths[Level], DH = LevelHeights[Level];
+
+		for (int y = 0; y < DH; ++y)
+		{
+			// 홀수 크기의 마지막 행/열은 자기 자신과 비교 (클램프)
+			const float* Row0 = &Src[size_t(std::min(y * 2, SH - 1)) * SW];
+			const float* Row1 = &Src[size_t(std::min(y * 2 + 1, SH - 1)) * SW];
+			float* Out = &Dst[size_t(y) * DW];
+
+			// 출력 4텍셀 = 입력 8열 x 2행
+			int x = 0;
+			for (; x * 2 + 7 < SW; x += 4)
+			{
+				const __m128 Max0 = _mm_max_ps(_mm_loadu_ps(Row0 + x * 2), _mm_loadu_ps(Row1 + x * 2));
+				const __m128 Max1 = _mm_max_ps(_mm_loadu_ps(Row0 + x * 2 + 4), _mm_loadu_ps(Row1 + x * 2 + 4));
+				const __m128 Even = _mm_shuffle_ps(Max0, Max1, _MM_SHUFFLE(2, 0, 2, 0));
+				const __m128 Odd = _mm_shuffle_ps(Max0, Max1, _MM_SHUFFLE(3, 1, 3, 1));
+				_mm_storeu_ps(Out + x, _mm_max_ps(Even, Odd));
+			}
+			for (; x < DW; ++x)
+			{
+				const int sx0 = std::min(x * 2, SW - 1);
+				const int sx1 = std::min(x * 2 + 1, SW - 1);
+				Out[x] = std::max(std::max(Row0[sx0], Row0[sx1]), std::max(Row1[sx0], Row1[sx1]));
+			}
+		}
+	}
 }
 
-bool FOcclusionCullingManagerCPU::ComputeRectAndMinZ(
-	const FCandidateDrawable& D, int /*ViewW*/, int /*ViewH*/, FOcclusionRect& OutR)
+float FOcclusionGrid::SampleMaxRect(int X0, int Y0, int X1, int Y1) const
 {
-	FVector C[8];
-	MakeAabbCornersMinMax(D.Bound, C);
+	// 범위가 4x4 텍셀 이하가 될 때까지 상위 레벨로 (MAX 피라미드라 상위 텍셀은 덮는 영역 전체의 최댓값)
+	int Level = 0;
+	while (Level + 1 < GetNumLevels() && (X1 - X0 >= 4 || Y1 - Y0 >= 4))
+	{
+		X0 >>= 1; Y0 >>= 1;
+		X1 >>= 1; Y1 >>= 1;
+		++Level;
+	}
 
-	float MinX = +1e9f, MinY = +1e9f, MaxX = -1e9f, MaxY = -1e9f;
-	float MinZLin = +1e9f, MaxZLin = -1e9f; // ★ 선형 깊이(0..1)
+	const TArray<float>& L = Levels[Level];
+	const int W = LevelWidths[Level];
+	float MaxDepth = 0.0f;
+	for (int y = Y0; y <= Y1; ++y)
+	{
+		const float* Row = &L[size_t(y) * W];
+		for (int x = X0; x <= X1; ++x)
+		{
+			MaxDepth = std::max(MaxDepth, Row[x]);
+		}
+	}
+	return MaxDepth;
+}
+
+//====================================================================================
+// FOcclusionCullingManagerCPU
+//====================================================================================
 
-	int used = 0;
-	for (int i = 0; i < 8; i++)
+namespace
+{
+	// FNV-1a (뷰/오클루더 변경 감지용)
+	inline void HashBytes(uint64& Hash, const void* Data, size_t Size)
 	{
-		const float p[4] = { C[i].X, C[i].Y, C[i].Z, 1.0f };
+		const uint8* Bytes = static_cast<const uint8*>(Data);
+		for (size_t i = 0; i < Size; ++i)
+		{
+			Hash ^= Bytes[i];
+			Hash *= 1099511628211ull;
+		}
+	}
+}
 
-		// 1) 화면 사각형용: WVP → NDC
-		float c[4];
-		MulPointRow(p, D.WorldViewProj, c);
-		if (c[3] <= 0.0f) continue;
+void FOcclusionCullingManagerCPU::SetView(const FMatrix& InViewMatrix, const FMatrix& InProjMatrix, float InNearClip, float InFarClip)
+{
+	ViewMatrix = InViewMatrix;
+	ProjMatrix = InProjMatrix;
+	ViewProjMatrix = InViewMatrix * InProjMatrix;
+	NearClip = InNearClip;
+	FarClip = std::max(InFarClip, InNearClip + KINDA_SMALL_NUMBER);
+}
 
-		const float invW = 1.0f / c[3];
-		const float ndcX = c[0] * invW;  // -1..1
-		const float ndcY = c[1] * invW;  // -1..1
-		// const float ndcZ = c[2] * invW; // 깊이는 쓰지 않음
+void FOcclusionCullingManagerCPU::EnsureSlot(uint32 ActorIndex, uint32 Generation)
+{
+	if (SlotGeneration.Num() <= static_cast<int32>(ActorIndex))
+	{
+		const int32 NewSize = static_cast<int32>(ActorIndex) + 1;
+		SlotGeneration.SetNum(NewSize, 0); // 세대는 1부터 시작하므로 0은 '기록 없음'
+		OccludedStreak.SetNum(NewSize, 0);
+		LastState.SetNum(NewSize, 1);
+		WasOccluder.SetNum(NewSize, 0);
+	}
 
-		const float u = 0.5f * (ndcX + 1.0f);
-		const float v = 0.5f * (ndcY + 1.0f);
+	// 삭제된 오브젝트의 슬롯을 다른 오브젝트가 재사용하면(세대 증가) 이전 상태를 버림
+	// UUID는 씬 로드 시 파일 값으로 다시 맞춰질 수 있어 재사용 판정에 쓰지 않음
+	if (SlotGeneration[ActorIndex] != Generation)
+	{
+		SlotGeneration[ActorIndex] = Generation;
+		OccludedStreak[ActorIndex] = 0;
+		LastState[ActorIndex] = 1; // 초기=보임
+		WasOccluder[ActorIndex] = 0;
+	}
+}
 
-		MinX = std::min(MinX, u); MinY = std::min(MinY, v);
-		MaxX = std::max(MaxX, u); MaxY = std::max(MaxY, v);
+void FOcclusionCullingManagerCPU::CullMeshes(TArray<UMeshComponent*>& InOutMeshes)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	Stats.Reset();
 
-		// 2) 깊이: WorldView로 뷰 공간 z → 선형 0..1
-		float v4[4];
-		MulPointRow(p, D.WorldView, v4);     // p_world * (World*View) == p_world * View (월드좌표니까 View만 와도 OK)
-		const float zView = v4[2];          // LH: +Z 앞
-		const float zLin01 = LinearizeZ01(zView, D.NearClip, D.FarClip);
+	// 화면 크기 추정: 경계 구 반지름 / 깊이 * 투영 Y 스케일 (= 화면 절반 높이 대비 비율)
+	const bool bOrthographic = ProjMatrix.M[3][3] == 1.0f;
+	const float ProjScaleY = ProjMatrix.M[1][1];
 
-		MinZLin = std::min(MinZLin, zLin01);
-		MaxZLin = std::max(MaxZLin, zLin01);
+	Candidates.Empty();
+	OccluderCandidates.Empty();
+	for (UMeshComponent* MeshComponent : InOutMeshes)
+	{
+		FCandidateDrawable& Candidate = Candidates.emplace_back();
+		Candidate.ActorIndex = MeshComponent->InternalIndex;
+		Candidate.Generation = Candidate.ActorIndex != UINT32_MAX ? GUObjectGenerations[Candidate.ActorIndex] : 0;
+		Candidate.Bound = MeshComponent->GetWorldAABB();
+		if (Candidate.ActorIndex != UINT32_MAX)
+		{
+			EnsureSlot(Candidate.ActorIndex, Candidate.Generation);
+		}
 
-		used++;
-	}
+		// 오클루더 후보: CPU 메시 데이터가 있고 삼각형 수가 적은 스태틱 메시
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshComponent);
+		UStaticMesh* StaticMesh = StaticMeshComponent ? StaticMeshComponent->GetStaticMesh() : nullptr;
+		const FStaticMesh* MeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+		if (!MeshAsset || MeshAsset->Indices.IsEmpty() || MeshAsset->Indices.Num() / 3 > static_cast<int32>(MaxOccluderTriangles) ||
+			Candidate.ActorIndex == UINT32_MAX)
+		{
+			continue;
+		}
 
-	if (used == 0) return false;
-	if (MaxX < 0 || MaxY < 0 || MinX > 1 || MinY > 1) return false;
+		const FVector Center = Candidate.Bound.GetCenter();
+		const float Radius = Candidate.Bound.GetHalfExtent().Size();
+		const float ViewZ = Center.X * ViewMatrix.M[0][2] + Center.Y * ViewMatrix.M[1][2] + Center.Z * ViewMatrix.M[2][2] + ViewMatrix.M[3][2];
+		if (ViewZ + Radius < NearClip)
+		{
+			continue; // 카메라 뒤
+		}
 
-	Clamp01(MinX); Clamp01(MinY); Clamp01(MaxX); Clamp01(MaxY);
-	Clamp01(MinZLin); Clamp01(MaxZLin);
+		const float ScreenSize = bOrthographic ? Radius * ProjScaleY : Radius * ProjScaleY / std::max(ViewZ, NearClip);
+		if (ScreenSize < MinOccluderScreenSize)
+		{
+			continue;
+		}
 
-	OutR.MinX = MinX; OutR.MinY = MinY; OutR.MaxX = MaxX; OutR.MaxY = MaxY;
-	OutR.MinZ = MinZLin;   // ★ 선형 깊이
-	OutR.MaxZ = MaxZLin;
-	OutR.ActorIndex = D.ActorIndex;
-	return true;
-}
-void FOcclusionCullingManagerCPU::BuildOccluderDepth(
-	const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH)
-{
-	Grid.Clear();
+		FOccluderDrawable& Occluder = OccluderCandidates.emplace_back();
+		Occluder.ActorIndex = Candidate.ActorIndex;
+		Occluder.Mesh = MeshAsset;
+		Occluder.WorldMatrix = StaticMeshComponent->GetWorldMatrix();
+		Occluder.Score = ScreenSize * (WasOccluder[Candidate.ActorIndex] ? PreviousOccluderBonus : 1.0f);
+	}
 
-	const int GW = Grid.GetWidth();
-	const int GH = Grid.GetHeight();
+	// 1) 오클루더 깊이
+	const uint64 RasterStart = FPlatformTime::Cycles64();
+	const bool bRebuiltDepth = BuildOccluderDepth(OccluderCandidates);
+	const uint64 HZBStart = FPlatformTime::Cycles64();
 
-	// --- 튜닝 파라미터 ---
-	const float ErodeScale = 0.5f;     // 0.5배 축소
-	const int   Dilate = 1;        // 경계 1px 팽창
-	const int   MinPxEdge = 8;        // 너무 작은 사각형은 erosion 스킵
-	const float MaxCover = 0.6f;     // 화면의 60% 이상 덮으면 erosion 스킵
+	// 2) HZB (깊이를 재사용하면 피라미드도 그대로)
+	if (bRebuiltDepth)
+	{
+		BuildHZB();
+	}
+	const uint64 TestStart = FPlatformTime::Cycles64();
 
-	for (const auto& D : Occluders)
+	// 3) 판정 후 보이는 메시만 남김
+	TestOcclusion(Candidates, VisibleFlags);
+
+	int32 NumVisible = 0;
+	for (int32 i = 0; i < InOutMeshes.Num(); ++i)
 	{
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
-			continue;
+		if (VisibleFlags[i])
+		{
+			InOutMeshes[NumVisible++] = InOutMeshes[i];
+		}
+	}
+	InOutMeshes.SetNum(NumVisible);
 
-		int minPX = (int)std::floor(R.MinX * GW);
-		int minPY = (int)std::floor(R.MinY * GH);
-		int maxPX = (int)std::ceil(R.MaxX * GW) - 1;
-		int maxPY = (int)std::ceil(R.MaxY * GH) - 1;
+	const uint64 EndCycles = FPlatformTime::Cycles64();
+	Stats.RasterTimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(HZBStart - RasterStart));
+	Stats.HZBTimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(TestStart - HZBStart));
+	Stats.TestTimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(EndCycles - TestStart));
+	Stats.TotalTimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(EndCycles - StartCycles));
+}
 
-		// --- 화면 사각형 erosion(오클루더 영향 완화) ---
-		int w = std::max(0, maxPX - minPX + 1);
-		int h = std::max(0, maxPY - minPY + 1);
-		const bool bigCover =
-			(w >= int(MaxCover * GW)) || (h >= int(MaxCover * GH));
-		if (ErodeScale < 1.0f && w >= MinPxEdge && h >= MinPxEdge && !bigCover)
+bool FOcclusionCullingManagerCPU::BuildOccluderDepth(TArray<FOccluderDrawable>& Occluders)
+{
+	// --- 오클루더 선택: 화면에서 큰 것부터, 개수/삼각형 예산 안에서 ---
+	std::sort(Occluders.begin(), Occluders.end(),
+		[](const FOccluderDrawable& A, const FOccluderDrawable& B) { return A.Score > B.Score; });
+
+	int32 NumSelected = 0;
+	uint32 TriangleBudget = OccluderTriangleBudget;
+	for (int32 i = 0; i < Occluders.Num() && NumSelected < MaxOccluders; ++i)
+	{
+		const uint32 NumTriangles = static_cast<uint32>(Occluders[i].Mesh->Indices.Num() / 3);
+		if (NumTriangles > TriangleBudget)
 		{
-			const float cx = 0.5f * float(minPX + maxPX);
-			const float cy = 0.5f * float(minPY + maxPY);
-			const float hw = 0.5f * float(w) * ErodeScale;
-			const float hh = 0.5f * float(h) * ErodeScale;
+			continue;
+		}
+		TriangleBudget -= NumTriangles;
+		Occluders[NumSelected++] = Occluders[i];
+	}
+	Occluders.SetNum(NumSelected);
 
-			minPX = int(std::floor(cx - hw));
-			maxPX = int(std::ceil(cx + hw));
-			minPY = int(std::floor(cy - hh));
-			maxPY = int(std::ceil(cy + hh));
+	// 다음 프레임 선택 가중치
+	for (uint32 Slot : OccluderSlots)
+	{
+		if (Slot < static_cast<uint32>(WasOccluder.Num()))
+		{
+			WasOccluder[Slot] = 0;
 		}
+	}
+	OccluderSlots.Empty();
+	for (const FOccluderDrawable& Occluder : Occluders)
+	{
+		WasOccluder[Occluder.ActorIndex] = 1;
+		OccluderSlots.Add(Occluder.ActorIndex);
+	}
 
+	// --- 시간 재사용: 뷰와 선택된 오클루더(메시, 트랜스폼)가 직전과 같으면 깊이 그리드가 같음 ---
+	uint64 Key = 14695981039346656037ull;
+	HashBytes(Key, ViewMatrix.M, sizeof(ViewMatrix.M));
+	HashBytes(Key, ProjMatrix.M, sizeof(ProjMatrix.M));
+	for (const FOccluderDrawable& Occluder : Occluders)
+	{
+		HashBytes(Key, &Occluder.Mesh, sizeof(Occluder.Mesh));
+		HashBytes(Key, Occluder.WorldMatrix.M, sizeof(Occluder.WorldMatrix.M));
+	}
 
-		// 화면 경계 클램프
-		minPX = std::max(0, std::min(GW - 1, minPX));
-		minPY = std::max(0, std::min(GH - 1, minPY));
-		maxPX = std::max(0, std::min(GW - 1, maxPX));
-		maxPY = std::max(0, std::min(GH - 1, maxPY));
-		if (minPX > maxPX || minPY > maxPY) continue;
+	Stats.NumOccluders = static_cast<uint32>(NumSelected);
+	if (bDepthValid && Key == DepthKey)
+	{
+		Stats.bReusedDepth = true;
+		Stats.NumOccluderTriangles = LastOccluderTriangles;
+		return false;
+	}
 
-		Grid.RasterizeRectDepthMin(minPX, minPY, maxPX, maxPY, R.MaxZ);
+	Grid.Clear();
+	LastOccluderTriangles = 0;
+	for (const FOccluderDrawable& Occluder : Occluders)
+	{
+		LastOccluderTriangles += RasterizeOccluder(Occluder);
 	}
+	Stats.NumOccluderTriangles = LastOccluderTriangles;
+
+	DepthKey = Key;
+	bDepthValid = true;
+	return true;
 }
 
-// 2) 후보 가시성 판정(HZB 샘플)
-void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>& Candidates, int ViewW, int ViewH, TArray<uint8_t>& OutVisibleFlags)
+uint32 FOcclusionCullingManagerCPU::RasterizeOccluder(const FOccluderDrawable& Occluder)
 {
-	const float eps = 2e-3f;  // 1차 바이어스
-	const float eps2 = 2 * eps;  // 레벨0 재검증 바이어스(조금 더 큼)
-	// --- 크기 보장 ---
-	uint32_t maxId = 0;
-	for (auto& c : Candidates) maxId = std::max(maxId, c.ActorIndex);
-
-	if (OutVisibleFlags.size() <= maxId) OutVisibleFlags.resize(maxId + 1, 1);
-	if (VisibleStreak.size() <= maxId) VisibleStreak.resize(maxId + 1, 0);
-	if (OccludedStreak.size() <= maxId) OccludedStreak.resize(maxId + 1, 0);
-	if (LastState.size() <= maxId) LastState.resize(maxId + 1, 1); // 초기=보임
-
-	for (const auto& D : Candidates)
-	{
-		uint32_t id = D.ActorIndex;
-
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
-		{
-			// 화면 밖(또는 w<=0 코너만) → 가려짐으로 처리
-			OutVisibleFlags[id] = 0;
-			// streak 업데이트 (선택): occluded 누적
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
-			LastState[id] = 0;
+	const FMatrix WorldView = Occluder.WorldMatrix * ViewMatrix;
+	const FMatrix WorldViewProj = WorldView * ProjMatrix;
+	const float GridW = float(Grid.GetWidth());
+	const float GridH = float(Grid.GetHeight());
+	const float InvDepthRange = 1.0f / (FarClip - NearClip);
+
+	// 정점마다 한 번만 변환: 그리드 픽셀 좌표 + 선형 깊이 (근평면 뒤 정점은 깊이 -1로 표시)
+	const TArray<FNormalVertex>& Vertices = Occluder.Mesh->Vertices;
+	const TArray<uint32>& Indices = Occluder.Mesh->Indices;
+	const int32 NumVertices = Vertices.Num();
+	ScreenX.SetNum(NumVertices);
+	ScreenY.SetNum(NumVertices);
+	LinearZ.SetNum(NumVertices);
+
+	alignas(16) float ViewPos[4];
+	alignas(16) float ClipPos[4];
+	for (int32 v = 0; v < NumVertices; ++v)
+	{
+		const FVector& P = Vertices[v].pos;
+		_mm_store_ps(ViewPos, TransformPointRow(P.X, P.Y, P.Z, WorldView));
+		if (ViewPos[2] < NearClip)
+		{
+			LinearZ[v] = -1.0f;
 			continue;
 		}
 
-		const float rw = std::max(0.0f, R.MaxX - R.MinX);
-		const float rh = std::max(0.0f, R.MaxY - R.MinY);
-		const float pxW = rw * GetGrid().GetWidth();
-		const float pxH = rh * GetGrid().GetHeight();
+		_mm_store_ps(ClipPos, TransformPointRow(P.X, P.Y, P.Z, WorldViewProj));
+		const float InvW = 1.0f / ClipPos[3];
+		ScreenX[v] = (ClipPos[0] * InvW * 0.5f + 0.5f) * GridW;
+		ScreenY[v] = (ClipPos[1] * InvW * 0.5f + 0.5f) * GridH;
+		LinearZ[v] = std::min(1.0f, (ViewPos[2] - NearClip) * InvDepthRange);
+	}
 
-		// --- 작은 사각형 가드: 한 변이라도 2px 미만이면 컬링하지 않음 ---
-		if (std::min(pxW, pxH) < 2.0f)
+	uint32 NumRasterized = 0;
+	for (int32 i = 0; i + 2 < Indices.Num(); i += 3)
+	{
+		const uint32 I0 = Indices[i], I1 = Indices[i + 1], I2 = Indices[i + 2];
+		// 근평면에 걸친 삼각형은 건너뜀 (덜 가리는 쪽이므로 보수적)
+		if (LinearZ[I0] < 0.0f || LinearZ[I1] < 0.0f || LinearZ[I2] < 0.0f)
 		{
-			OutVisibleFlags[id] = 1;
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
-			LastState[id] = 1;
 			continue;
 		}
 
-		// --- 보수적 mip 선택 ---
-		int mip = std::max(0, Grid.ChooseMip(rw, rh) - 1);
-		if (pxW < 48.0f || pxH < 48.0f)
-			mip = std::max(0, mip - 1);
+		const float X[3] = { ScreenX[I0], ScreenX[I1], ScreenX[I2] };
+		const float Y[3] = { ScreenY[I0], ScreenY[I1], ScreenY[I2] };
+		const float MaxZ = std::max(LinearZ[I0], std::max(LinearZ[I1], LinearZ[I2]));
+		if (Grid.RasterizeTriangle(X, Y, MaxZ))
+		{
+			++NumRasterized;
+		}
+	}
+	return NumRasterized;
+}
+
+// 후보 가시성 판정 (HZB 샘플)
+void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>& InCandidates, TArray<uint8_t>& OutVisibleFlags)
+{
+	const float Bias = 1e-4f;
+	const float InvDepthRange = 1.0f / (FarClip - NearClip);
+	const int GW = Grid.GetWidth();
+	const int GH = Grid.GetHeight();
+	const __m128 Half = _mm_set1_ps(0.5f);
 
+	OutVisibleFlags.SetNum(InCandidates.Num());
+	Stats.NumTested = static_cast<uint32>(InCandidates.Num());
 
-		// --- MAX HZB 적응형 샘플 ---
-		const float hzbMax = Grid.SampleMaxRectAdaptive(R.MinX, R.MinY, R.MaxX, R.MaxY, mip);
+	for (int32 i = 0; i < InCandidates.Num(); ++i)
+	{
+		const FCandidateDrawable& D = InCandidates[i];
+		const FVector& BMin = D.Bound.Min;
+		const FVector& BMax = D.Bound.Max;
 
-		bool occluded = ((hzbMax + eps) <= R.MinZ);
+		// 경계가 없는 메시 (예: 스키닝 메시는 아직 빈 AABB를 반환) → 판정하지 않고 보임
+		if (BMin.X == BMax.X && BMin.Y == BMax.Y && BMin.Z == BMax.Z)
+		{
+			OutVisibleFlags[i] = 1;
+			++Stats.NumVisible;
+			continue;
+		}
 
-		// --- 레벨0 정밀 재검증(occluded일 때만) ---
-		if (occluded)
+		// --- 뷰 공간 깊이 범위 (AABB 코너 중 최소/최대, 축별로 독립) ---
+		float MinViewZ = ViewMatrix.M[3][2], MaxViewZ = ViewMatrix.M[3][2];
+		for (int Axis = 0; Axis < 3; ++Axis)
 		{
-			if (!Grid.FullyOccludedAtLevel0(R.MinX, R.MinY, R.MaxX, R.MaxY, R.MinZ, eps2))
-				occluded = false;
+			const float A = BMin[Axis] * ViewMatrix.M[Axis][2];
+			const float B = BMax[Axis] * ViewMatrix.M[Axis][2];
+			MinViewZ += std::min(A, B);
+			MaxViewZ += std::max(A, B);
 		}
 
-		// --- 양방향 히스테리시스(2~3프레임 연속일 때만 상태 전환) ---
-		const int thresh = 2; // 2~3 추천
+		bool bOccluded = false;
+		if (MaxViewZ < NearClip)
+		{
+			// 근평면 뒤 → 화면 밖
+			OutVisibleFlags[i] = 0;
+			++Stats.NumOffscreen;
+			continue;
+		}
+		else if (MinViewZ >= NearClip)
+		{
+			// --- 화면 사각형: 8코너를 SIMD로 투영 (축별 항을 미리 곱해서 코너마다 덧셈 2번) ---
+			const __m128 X0 = _mm_mul_ps(_mm_set1_ps(BMin.X), ViewProjMatrix.Rows[0]);
+			const __m128 X1 = _mm_mul_ps(_mm_set1_ps(BMax.X), ViewProjMatrix.Rows[0]);
+			const __m128 Y0 = _mm_mul_ps(_mm_set1_ps(BMin.Y), ViewProjMatrix.Rows[1]);
+			const __m128 Y1 = _mm_mul_ps(_mm_set1_ps(BMax.Y), ViewProjMatrix.Rows[1]);
+			const __m128 Z0 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(BMin.Z), ViewProjMatrix.Rows[2]), ViewProjMatrix.Rows[3]);
+			const __m128 Z1 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(BMax.Z), ViewProjMatrix.Rows[2]), ViewProjMatrix.Rows[3]);
+			const __m128 XY[4] = { _mm_add_ps(X0, Y0), _mm_add_ps(X1, Y0), _mm_add_ps(X0, Y1), _mm_add_ps(X1, Y1) };
+
+			__m128 MinNDC = _mm_set1_ps(FLT_MAX);
+			__m128 MaxNDC = _mm_set1_ps(-FLT_MAX);
+			for (int c = 0; c < 8; ++c)
+			{
+				const __m128 Clip = _mm_add_ps(XY[c & 3], (c & 4) ? Z1 : Z0);
+				const __m128 NDC = _mm_div_ps(Clip, _mm_shuffle_ps(Clip, Clip, _MM_SHUFFLE(3, 3, 3, 3)));
+				MinNDC = _mm_min_ps(MinNDC, NDC);
+				MaxNDC = _mm_max_ps(MaxNDC, NDC);
+			}
+
+			// NDC → [0..1] UV
+			alignas(16) float MinUV[4];
+			alignas(16) float MaxUV[4];
+			_mm_store_ps(MinUV, _mm_add_ps(_mm_mul_ps(MinNDC, Half), Half));
+			_mm_store_ps(MaxUV, _mm_add_ps(_mm_mul_ps(MaxNDC, Half), Half));
+
+			if (MaxUV[0] < 0.0f || MaxUV[1] < 0.0f || MinUV[0] > 1.0f || MinUV[1] > 1.0f)
+			{
+				OutVisibleFlags[i] = 0;
+				++Stats.NumOffscreen;
+				continue;
+			}
+
+			// 사각형이 걸치는 레벨0 픽셀 전체
+			const int PX0 = std::clamp(int(std::floor(MinUV[0] * GW)), 0, GW - 1);
+			const int PY0 = std::clamp(int(std::floor(MinUV[1] * GH)), 0, GH - 1);
+			const int PX1 = std::clamp(int(std::ceil(MaxUV[0] * GW)) - 1, PX0, GW - 1);
+			const int PY1 = std::clamp(int(std::ceil(MaxUV[1] * GH)) - 1, PY0, GH - 1);
+
+			const float MinZ = (MinViewZ - NearClip) * InvDepthRange;
+			bOccluded = Grid.SampleMaxRect(PX0, PY0, PX1, PY1) + Bias < MinZ;
+		}
+		// else: 근평면에 걸침 → 투영 사각형을 믿을 수 없으므로 보임
 
-		if (occluded)
+		// --- 히스테리시스: 연속 N프레임 가려져야 컬링, 보이면 즉시 복귀 ---
+		if (D.ActorIndex != UINT32_MAX)
 		{
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
+			const uint32 Id = D.ActorIndex;
+			if (bOccluded)
+			{
+				OccludedStreak[Id] = static_cast<uint8_t>(std::min(255, OccludedStreak[Id] + 1));
+				if (LastState[Id] == 1 && OccludedStreak[Id] < OccludedFramesToCull)
+				{
+					bOccluded = false;
+				}
+			}
+			else
+			{
+				OccludedStreak[Id] = 0;
+			}
+			LastState[Id] = bOccluded ? 0 : 1;
+		}
 
-			// 직전이 보임이면, thresh 미만 동안은 보임 유지
-			if (LastState[id] == 1 && OccludedStreak[id] < thresh)
-				occluded = false;
+		OutVisibleFlags[i] = bOccluded ? 0 : 1;
+		if (bOccluded)
+		{
+			++Stats.NumOccluded;
 		}
 		else
 		{
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
-
-			// 직전이 가려짐이면, thresh 미만 동안은 가려짐 유지
-			if (LastState[id] == 0 && VisibleStreak[id] < thresh)
-				occluded = true;
+			++Stats.NumVisible;
 		}
-
-		LastState[id] = occluded ? 0 : 1;
-		OutVisibleFlags[id] = occluded ? 0 : 1;
 	}
-}
\ No newline at end of file
+}
@@ -1,257 +1,182 @@
 ﻿#pragma once
+#include "AABB.h"
+#include "OcclusionStats.h"
 
 struct FVector;
 struct FVector4;
 struct FMatrix; // row-major, p' = p * M 가정(네 컨벤션대로)
-struct FAABB; // AABB
+struct FStaticMesh;
+class UMeshComponent;
 
+// 오클루디 (가시성 판정 대상)
 struct FCandidateDrawable
 {
-    uint32_t ActorIndex;   // VisibleFlags 인덱스
-    FAABB   Bound;        // 월드 AABB (Min/Max)
-    FMatrix  WorldViewProj;// 행벡터 기준 WVP
-    FMatrix  WorldView;    // ★ 추가: World-space * View  (여기서는 View만 주면 됨)
-    float    NearClip;        // ★ 추가
-    float    FarClip;         // ★ 추가
+    uint32_t ActorIndex;   // 시간 상태/VisibleFlags 인덱스 (UObject::InternalIndex)
+    uint32_t Generation;   // 슬롯 재사용 감지용 (GUObjectGenerations[ActorIndex])
+    FAABB    Bound;        // 월드 AABB (Min/Max)
 };
 
-// 교체 (MaxZ 추가)
-struct FOcclusionRect
+// 오클루더 (깊이 그리드에 삼각형을 래스터라이즈하는 대상)
+struct FOccluderDrawable
 {
-    float MinX, MinY, MaxX, MaxY; // [0..1]
-    float MinZ;                   // 가장 가까운
-    float MaxZ;                   // 가장 먼      <<--- 추가
     uint32_t ActorIndex;
+    const FStaticMesh* Mesh; // CPU 정점/인덱스
+    FMatrix  WorldMatrix;
+    float    Score;          // 화면 크기 추정치 (클수록 먼저 선택)
 };
 
-// 저해상도 깊이맵 + HZB(min) - CPU 전용
+// 저해상도 깊이맵 + HZB(max) - CPU 전용
+// 깊이는 뷰 공간 선형 깊이 [0..1] (Near=0, Far=1), 좌표는 NDC를 [0..1]로 옮긴 UV (V는 위쪽이 1)
 class FOcclusionGrid
 {
 public:
     void Initialize(int InWidth, int InHeight)
     {
-        Width = InWidth; Height = InHeight;
-        // 교체: 1.0f (Far)
-        Depth.assign(size_t(Width * Height), 1.0f);
-        BuildLevels.clear();
-    }
-    void Clear()
-    {
-        // Clear 도 동일하게 1.0f로
-        std::fill(Depth.begin(), Depth.end(), 1.0f);
-        BuildLevels.clear();
-    }
-
-    /*
-        왜 R.MaxZ를 쓰는데 min 누적을 하나?
-
-        오클루더 AABB가 두껍거나 경계 근사 때문에 일부 픽셀이 원래보다 더 멀게 잡힐 수 있다.
-
-        레벨0은 per-pixel 가장 가까운 오클루더가 들어가야 하므로, 여러 오클루더가 겹칠 때 **min(current, MaxZ)**로 더 가까운 값으로만 낮춘다.
-
-        이렇게 해야 상위 레벨의 MAX 피라미드가 보수적이 됨(=오버컬링 방지).
-    */
-
-    void RasterizeRectDepthMin(int MinPX, int MinPY, int MaxPX, int MaxPY, float MaxZ)
-    {
-        MinPX = std::max(0, MinPX); MinPY = std::max(0, MinPY);
-        MaxPX = std::min(Width - 1, MaxPX); MaxPY = std::min(Height - 1, MaxPY);
-        for (int y = MinPY; y <= MaxPY; ++y)
+        // SIMD 래스터라이즈가 한 번에 4픽셀씩 쓰므로 너비는 4의 배수로 맞춤
+        Width = (std::max(InWidth, 4) + 3) & ~3;
+        Height = std::max(InHeight, 1);
+
+        // 레벨마다 (W+1)/2로 줄여서 홀수 크기에서도 가장자리 텍셀이 상위 레벨에 포함되도록 (보수성 유지)
+        Levels.clear();
+        LevelWidths.clear();
+        LevelHeights.clear();
+        int W = Width, H = Height;
+        while (true)
         {
-            float* Row = &Depth[size_t(y) * Width];
-            for (int x = MinPX; x <= MaxPX; ++x)
+            Levels.emplace_back(size_t(W) * H, 1.0f);
+            LevelWidths.push_back(W);
+            LevelHeights.push_back(H);
+            if (W == 1 && H == 1)
             {
-                Row[x] = std::min(Row[x], MaxZ); // 가장 가까운 깊이로 갱신
+                break;
             }
+            W = std::max(1, (W + 1) >> 1);
+            H = std::max(1, (H + 1) >> 1);
         }
     }
-
-    void BuildHZB()
-    {
-        BuildLevels.clear();
-        BuildLevels.push_back(Depth); // level 0
-
-        int W = Width, H = Height;
-        while (W > 1 || H > 1)
-        {
-            int NW = std::max(1, W >> 1);
-            int NH = std::max(1, H >> 1);
-            TArray<float> Next(size_t(NW * NH), +FLT_MAX);
-
-            for (int y = 0; y < NH; ++y)
-                for (int x = 0; x < NW; ++x)
-                {
-                    int sx = x * 2, sy = y * 2;
-                    float a = SampleSafe(BuildLevels.back(), W, H, sx + 0, sy + 0);
-                    float b = SampleSafe(BuildLevels.back(), W, H, sx + 1, sy + 0);
-                    float c = SampleSafe(BuildLevels.back(), W, H, sx + 0, sy + 1);
-                    float d = SampleSafe(BuildLevels.back(), W, H, sx + 1, sy + 1);
-                    Next[size_t(y) * NW + x] = std::max(std::max(a, b), std::max(c, d));
-                }
-            BuildLevels.push_back(std::move(Next));
-            W = NW; H = NH;
-        }
-    }
-
-    int ChooseMip(float RectW01, float RectH01) const
-    {
-        float pxW = RectW01 * Width;
-        float pxH = RectH01 * Height;
-        float s = std::max(pxW, pxH);
-        int mip = int(std::floor(std::log2(std::max(1.0f, s))));
-        mip = std::max(0, std::min(mip, int(BuildLevels.size() - 1)));
-        return mip;
-    }
-
-    float SampleMaxRect(float MinX01, float MinY01, float MaxX01, float MaxY01, int Mip) const
+    void Clear()
     {
-        const TArray<float>& L = BuildLevels[size_t(Mip)];
-        int W = std::max(1, Width >> Mip);
-        int H = std::max(1, Height >> Mip);
-
-        auto ToPx = [&](float u, float v)->std::pair<int, int> {
-            int x = int(u * W + 0.5f);
-            int y = int(v * H + 0.5f);
-            x = std::max(0, std::min(W - 1, x));
-            y = std::max(0, std::min(H - 1, y));
-            return { x,y };
-            };
-        auto Smp = [&](float u, float v)->float {
-            auto [x, y] = ToPx(u, v);
-            return L[size_t(y) * W + x];
-            };
-
-        float cx = 0.5f * (MinX01 + MaxX01);
-        float cy = 0.5f * (MinY01 + MaxY01);
-
-        float s0 = Smp(cx, cy);
-        float s1 = Smp(MinX01, MinY01);
-        float s2 = Smp(MaxX01, MinY01);
-        float s3 = Smp(MinX01, MaxY01);
-        float s4 = Smp(MaxX01, MaxY01);
-
-        return std::max(s0, std::max(s1, std::max(s2, std::max(s3, s4)))); // ★ MAX
+        // Far(1.0f)로 채움: 아무것도 가리지 않음
+        std::fill(Levels[0].begin(), Levels[0].end(), 1.0f);
     }
-    // FOcclusionGrid 내부에 추가
-    float SampleMaxRectAdaptive(float MinX01, float MinY01, float MaxX01, float MaxY01, int Mip) const
-    {
-        const TArray<float>& L = BuildLevels[size_t(Mip)];
-        const int W = std::max(1, Width >> Mip);
-        const int H = std::max(1, Height >> Mip);
-
-        auto ToPx = [&](float u, float v)->std::pair<int, int> {
-            int x = int(u * W + 0.5f);
-            int y = int(v * H + 0.5f);
-            x = std::max(0, std::min(W - 1, x));
-            y = std::max(0, std::min(H - 1, y));
-            return { x,y };
-            };
-        auto Smp = [&](float u, float v)->float {
-            auto [x, y] = ToPx(u, v);
-            return L[size_t(y) * W + x];
-            };
 
-        // 샘플 밀도: 화면 픽셀 크기에 비례 (최대 5x5)
-        const int grid = ((MaxX01 - MinX01) * Width + (MaxY01 - MinY01) * Height > 80) ? 5 :
-            ((MaxX01 - MinX01) * Width + (MaxY01 - MinY01) * Height > 30) ? 4 : 3;
+    /*
+        왜 삼각형의 가장 먼 깊이를 쓰고, 커버리지는 픽셀 중심으로 판정하나?
+
+        삼각형 안의 모든 점은 가장 먼 정점보다 가까우므로 MaxZ를 기록하면 깊이는 항상 보수적이다.
+        커버리지를 "픽셀을 완전히 덮을 때만"으로 잡으면 같은 오클루더의 두 삼각형이 공유하는 에지(사각형 대각선,
+        박스 면 사이)에 걸친 픽셀이 어느 쪽에서도 기록되지 않아 Far 균열이 생기고, MAX 피라미드가 그 균열을
+        모든 레벨로 올려서 벽/박스가 거의 아무것도 가리지 못한다. 그래서 표준 래스터라이저처럼 픽셀 중심으로 판정한다.
+        (실루엣 가장자리 반 픽셀은 저해상도 그리드 오차 범위로 허용)
+        여러 오클루더가 겹치면 min으로 더 가까운 값으로만 낮춘다.
+    */
 
-        float best = 0.0f; // MAX 피라미드이므로 최댓값을 모음
-        for (int j = 0; j < grid; j++)
-        {
-            float v = std::lerp(MinY01, MaxY01, (grid == 1) ? 0.5f : float(j) / (grid - 1));
-            for (int i = 0; i < grid; i++)
-            {
-                float u = std::lerp(MinX01, MaxX01, (grid == 1) ? 0.5f : float(i) / (grid - 1));
-                best = std::max(best, Smp(u, v));
-            }
-        }
-        return best;
-    }
-    // FOcclusionGrid 내부에 추가 (레벨0 정밀 검사)
-    bool FullyOccludedAtLevel0(float MinX01, float MinY01, float MaxX01, float MaxY01, float MinZ, float eps2) const
-    {
-        const TArray<float>& L0 = BuildLevels[0];
-        const int W = Width, H = Height;
+    // X/Y: 레벨0 픽셀 좌표의 삼각형 정점 (감기 순서 무관), MaxZ: 세 정점 중 가장 먼 선형 깊이
+    // @return 한 픽셀이라도 기록했으면 true
+    bool RasterizeTriangle(const float X[3], const float Y[3], float MaxZ);
 
-        int x0 = std::max(0, std::min(W - 1, int(MinX01 * W)));
-        int y0 = std::max(0, std::min(H - 1, int(MinY01 * H)));
-        int x1 = std::max(0, std::min(W - 1, int(MaxX01 * W)));
-        int y1 = std::max(0, std::min(H - 1, int(MaxY01 * H)));
+    // 레벨0에서 MAX 피라미드 생성 (레벨 버퍼는 Initialize에서 한 번만 할당)
+    void BuildHZB();
 
-        // 너무 큰 박스는 샘플링 간격을 둠 (성능)
-        const int maxScan = 128 * 128; // 임계 픽셀수
-        int w = std::max(1, x1 - x0 + 1);
-        int h = std::max(1, y1 - y0 + 1);
-        int step = (w * h > maxScan) ? 2 : 1;
+    // 레벨0 픽셀 범위 [X0..X1] x [Y0..Y1]를 덮는 텍셀의 최대 깊이
+    // 범위가 4x4 텍셀 이하가 되는 가장 낮은 레벨을 골라 검사하므로 비용이 물체 크기와 무관
+    float SampleMaxRect(int X0, int Y0, int X1, int Y1) const;
 
-        for (int y = y0; y <= y1; y += step)
-        {
-            const float* row = &L0[size_t(y) * W];
-            for (int x = x0; x <= x1; x += step)
-            {
-                float z = row[x];           // 레벨0의 MAX-기반 값(=멀리 기록한 것들의 min 축약 결과 아님!)
-                // 주의: 우리는 base에 'MaxZ를 min으로 누적'시켰고, HZB는 최대화했음.
-                // 레벨0에서도 보수성 유지: z + eps2 <= MinZ 일 때만 occluded 픽셀로 간주.
-                if (z + eps2 > MinZ)
-                    return false; // 한 픽셀이라도 덮여있지 않음 → 전체 가림 실패
-            }
-        }
-        return true; // 전부 덮임
-    }
     int GetWidth()  const { return Width; }
     int GetHeight() const { return Height; }
-
-
-private:
-    static float SampleSafe(const TArray<float>& L, int W, int H, int X, int Y)
-    {
-        X = std::max(0, std::min(W - 1, X));
-        Y = std::max(0, std::min(H - 1, Y));
-        return L[size_t(Y) * W + X];
-    }
+    int GetNumLevels() const { return static_cast<int>(Levels.size()); }
 
 private:
     int Width = 0, Height = 0;
-    TArray<float> Depth;                     // level 0
-    TArray<TArray<float>> BuildLevels;  // [0..N-1], min chain
-
-
+    TArray<TArray<float>> Levels;  // [0] = 래스터라이즈 결과, [1..N-1] = 2x2 max chain
+    TArray<int> LevelWidths;
+    TArray<int> LevelHeights;
 };
 
 // CPU 오클루전 매니저
+// FSceneRenderer는 뷰마다 새로 만들어지므로 URenderer가 뷰포트별로 소유해서 프레임 간 상태를 유지한다
 class FOcclusionCullingManagerCPU
 {
 public:
-    void Initialize(int GridW, int GridH) { Grid.Initialize(GridW, GridH); }
+    // 그리드 해상도 (16:9, 너비는 4의 배수)
+    static constexpr int DefaultGridWidth = 256;
+    static constexpr int DefaultGridHeight = 144;
+
+    // 오클루더 선택 기준
+    static constexpr int MaxOccluders = 32;                // 프레임당 오클루더 수
+    static constexpr uint32 MaxOccluderTriangles = 4096;   // 오클루더 하나의 삼각형 상한 (넘으면 후보에서 제외)
+    static constexpr uint32 OccluderTriangleBudget = 32768; // 프레임당 래스터라이즈 삼각형 예산
+    static constexpr float MinOccluderScreenSize = 0.08f;  // 경계 구 반지름 / 깊이 (작으면 가리는 면적이 작음)
+    static constexpr float PreviousOccluderBonus = 1.5f;   // 직전 프레임 오클루더 가중치 (선택이 프레임마다 흔들리지 않도록)
+
+    // 연속 N프레임 가려져야 실제로 컬링 (보임 전환은 즉시)
+    static constexpr uint8 OccludedFramesToCull = 2;
+
+    void Initialize(int GridW = DefaultGridWidth, int GridH = DefaultGridHeight) { Grid.Initialize(GridW, GridH); bDepthValid = false; }
     void Shutdown() {}
 
-    // 1) 오클루더로 저해상도 Depth 채우기
-    void BuildOccluderDepth(const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH);
+    // 0) 뷰 설정 (CullMeshes 전에 매 프레임 호출)
+    void SetView(const FMatrix& InViewMatrix, const FMatrix& InProjMatrix, float InNearClip, float InFarClip);
+
+    // 메시 목록에서 가려진 메시를 제거 (1~3단계를 모두 수행하고 통계 갱신)
+    void CullMeshes(TArray<UMeshComponent*>& InOutMeshes);
+
+    // 1) 오클루더 선택 후 저해상도 Depth 채우기 (Occluders는 선택된 것만 남김)
+    // @return 깊이를 새로 채웠으면 true, 뷰와 오클루더가 직전 프레임과 같아서 이전 결과를 재사용하면 false
+    bool BuildOccluderDepth(TArray<FOccluderDrawable>& Occluders);
 
     // 2) CPU HZB
     void BuildHZB() { Grid.BuildHZB(); }
 
-    // 3) 후보 가시성 판정
-    void TestOcclusion(const TArray<FCandidateDrawable>& Candidates, int ViewW, int ViewH, TArray<uint8_t>& OutVisibleFlags);
+    // 3) 후보 가시성 판정 (OutVisibleFlags[i] = InCandidates[i]의 가시성, 0 = 컬링)
+    void TestOcclusion(const TArray<FCandidateDrawable>& InCandidates, TArray<uint8_t>& OutVisibleFlags);
 
     const FOcclusionGrid& GetGrid() const { return Grid; }
+    const FOcclusionStats& GetStats() const { return Stats; }
 
 private:
-    // AABB(Min/Max) → 화면 사각형 + MinZ (★이제 MinZ는 '선형 깊이 0..1')
-    static bool ComputeRectAndMinZ(const FCandidateDrawable& D, int ViewW, int ViewH, FOcclusionRect& OutRect);
+    // 오클루더 하나의 삼각형을 그리드에 래스터라이즈 @return 기록한 삼각형 수
+    uint32 RasterizeOccluder(const FOccluderDrawable& Occluder);
+
+    // 슬롯의 시간 상태를 준비 (다른 오브젝트가 슬롯을 재사용했으면 초기화)
+    void EnsureSlot(uint32 ActorIndex, uint32 Generation);
 
-    // 행벡터: Out = In(1x4) * M(4x4)
-    static inline void MulPointRow(const float In[4], const FMatrix& M, float Out[4])
+    // 행벡터: Out = (X, Y, Z, 1) * M
+    static inline __m128 TransformPointRow(float X, float Y, float Z, const FMatrix& M)
     {
-        Out[0] = In[0] * M.M[0][0] + In[1] * M.M[1][0] + In[2] * M.M[2][0] + In[3] * M.M[3][0];
-        Out[1] = In[0] * M.M[0][1] + In[1] * M.M[1][1] + In[2] * M.M[2][1] + In[3] * M.M[3][1];
-        Out[2] = In[0] * M.M[0][2] + In[1] * M.M[1][2] + In[2] * M.M[2][2] + In[3] * M.M[3][2];
-        Out[3] = In[0] * M.M[0][3] + In[1] * M.M[1][3] + In[2] * M.M[2][3] + In[3] * M.M[3][3];
+        __m128 R = _mm_mul_ps(_mm_set1_ps(X), M.Rows[0]);
+        R = _mm_add_ps(R, _mm_mul_ps(_mm_set1_ps(Y), M.Rows[1]));
+        R = _mm_add_ps(R, _mm_mul_ps(_mm_set1_ps(Z), M.Rows[2]));
+        return _mm_add_ps(R, M.Rows[3]);
     }
 
 private:
     FOcclusionGrid Grid;
-    TArray<uint8_t> VisibleStreak;   // 연속 보임 프레임 수
+
+    // 현재 뷰
+    FMatrix ViewMatrix;
+    FMatrix ProjMatrix;
+    FMatrix ViewProjMatrix;
+    float NearClip = 0.1f;
+    float FarClip = 1000.0f;
+
+    // 뷰/오클루더가 그대로면 깊이 그리드를 다시 만들지 않음
+    uint64 DepthKey = 0;
+    bool bDepthValid = false;
+    uint32 LastOccluderTriangles = 0;
+
+    // 슬롯(InternalIndex)별 시간 상태
+    TArray<uint32> SlotGeneration;   // 상태를 기록한 오브젝트의 슬롯 세대 (슬롯이 재사용되면 달라짐)
     TArray<uint8_t> OccludedStreak;  // 연속 가림 프레임 수
     TArray<uint8_t> LastState;       // 0=occluded, 1=visible
-};
\ No newline at end of file
+    TArray<uint8_t> WasOccluder;     // 직전 프레임 오클루더 여부
+    TArray<uint32> OccluderSlots;    // 직전 프레임 오클루더 슬롯 (WasOccluder 초기화용)
+
+    // 프레임 임시 버퍼 (재할당 방지)
+    TArray<FCandidateDrawable> Candidates;
+    TArray<FOccluderDrawable> OccluderCandidates;
+    TArray<uint8_t> VisibleFlags;
+    TArray<float> ScreenX, ScreenY, LinearZ;  // 오클루더 정점 변환 결과
+
+    FOcclusionStats Stats;
+};
@@ -0,0 +1,307 @@
+#include "pch.h"
+#include "PrimitiveBoundsSoA.h"
+#include "PrimitiveComponent.h"
+#include "AABB.h"
+#include "Frustum.h"
+#include <bit>
+
+namespace
+{
+	// FFrustum 평면을 레인에 브로드캐스트하기 좋은 형태로 (dot(N, C) - D + dot(|N|, E) >= 0 이면 평면 안쪽과 겹침)
+	struct FCullPlane
+	{
+		float NX, NY, NZ;
+		float AbsX, AbsY, AbsZ;
+		float D;
+	};
+
+	void BuildCullPlanes(const FFrustum& Frustum, FCullPlane OutPlanes[6])
+	{
+		// 화면 밖 물체가 가장 많이 걸리는 측면부터 검사
+		const FPlane* Planes[6] = { &Frustum.LeftFace, &Frustum.RightFace, &Frustum.TopFace, &Frustum.BottomFace, &Frustum.NearFace, &Frustum.FarFace };
+		for (int32 i = 0; i < 6; ++i)
+		{
+			const FPlane& Plane = *Planes[i];
+			OutPlanes[i] = { Plane.Normal.X, Plane.Normal.Y, Plane.Normal.Z,
+				std::abs(Plane.Normal.X), std::abs(Plane.Normal.Y), std::abs(Plane.Normal.Z), Plane.Distance };
+		}
+	}
+
+	inline bool IsBoxVisible(const FCullPlane Planes[6], float CX, float CY, float CZ, float EX, float EY, float EZ)
+	{
+		for (int32 i = 0; i < 6; ++i)
+		{
+			const FCullPlane& P = Planes[i];
+			const float Distance = P.NX * CX + P.NY * CY + P.NZ * CZ - P.D;
+			const float Radius = P.AbsX * EX + P.AbsY * EY + P.AbsZ * EZ;
+			if (Distance + Radius < 0.0f)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// 레인 마스크의 비트 순서대로 보이는 인덱스를 추가
+	inline int32 AppendVisible(uint32 Mask, int32 BaseIndex, TArray<int32>& OutVisibleIndices)
+	{
+		const int32 Count = std::popcount(Mask);
+		while (Mask)
+		{
+			OutVisibleIndices.Add(BaseIndex + std::countr_zero(Mask));
+			Mask &= Mask - 1;
+		}
+		return Count;
+	}
+}
+
+int32 FPrimitiveBoundsSoA::Add(UPrimitiveComponent* Primitive, const FAABB& Bound)
+{
+	const int32 Index = Primitives.Num();
+	Primitives.Add(Primitive);
+	CenterX.Add(0.0f);
+	CenterY.Add(0.0f);
+	CenterZ.Add(0.0f);
+	ExtentX.Add(0.0f);
+	ExtentY.Add(0.0f);
+	ExtentZ.Add(0.0f);
+	DirtyFlags.Add(0);
+	WriteBound(Index, Bound);
+
+	if (Primitive)
+	{
+		IndexOfPrimitive.Add(Primitive, Index);
+	}
+	return Index;
+}
+
+void FPrimitiveBoundsSoA::MarkDirty(UPrimitiveComponent* Primitive)
+{
+	if (!Primitive)
+	{
+		return;
+	}
+
+	int32 Index = FindIndex(Primitive);
+	if (Index < 0)
+	{
+		// 바운드는 FlushDirty에서 읽음 (등록 직후에는 메시/트랜스폼이 아직 준비되지 않았을 수 있음)
+		Index = Add(Primitive, FAABB());
+	}
+
+	if (!DirtyFlags[Index])
+	{
+		DirtyFlags[Index] = 1;
+		DirtyIndices.Add(Index);
+	}
+}
+
+void FPrimitiveBoundsSoA::Remove(UPrimitiveComponent* Primitive)
+{
+	const int32 Index = FindIndex(Primitive);
+	if (Index < 0)
+	{
+		return;
+	}
+
+	IndexOfPrimitive.Remove(Primitive);
+
+	// 마지막 슬롯을 빈 자리로 옮김
+	// 더티 목록은 인덱스를 담으므로 옮겨진 슬롯이 더티였다면 새 인덱스로 다시 예약 (이전 인덱스는 FlushDirty에서 범위 밖으로 걸러짐)
+	const int32 LastIndex = Primitives.Num() - 1;
+	if (Index != LastIndex)
+	{
+		if (UPrimitiveComponent* Moved = Primitives[LastIndex])
+		{
+			IndexOfPrimitive[Moved] = Index;
+		}
+		if (DirtyFlags[LastIndex])
+		{
+			DirtyIndices.Add(Index);
+		}
+	}
+
+	Primitives.RemoveAtSwap(Index);
+	CenterX.RemoveAtSwap(Index);
+	CenterY.RemoveAtSwap(Index);
+	CenterZ.RemoveAtSwap(Index);
+	ExtentX.RemoveAtSwap(Index);
+	ExtentY.RemoveAtSwap(Index);
+	ExtentZ.RemoveAtSwap(Index);
+	DirtyFlags.RemoveAtSwap(Index);
+}
+
+void FPrimitiveBoundsSoA::Clear()
+{
+	CenterX.Empty();
+	CenterY.Empty();
+	CenterZ.Empty();
+	ExtentX.Empty();
+	ExtentY.Empty();
+	ExtentZ.Empty();
+	Primitives.Empty();
+	DirtyFlags.Empty();
+	DirtyIndices.Empty();
+	IndexOfPrimitive.Empty();
+}
+
+int32 FPrimitiveBoundsSoA::FlushDirty()
+{
+	int32 NumUpdated = 0;
+	for (int32 Index : DirtyIndices)
+	{
+		// Remove로 범위를 벗어났거나 이미 처리한 인덱스는 건너뜀
+		if (Index >= Primitives.Num() || !DirtyFlags[Index])
+		{
+			continue;
+		}
+		DirtyFlags[Index] = 0;
+
+		if (UPrimitiveComponent* Primitive = Primitives[Index])
+		{
+			WriteBound(Index, Primitive->GetWorldAABB());
+			++NumUpdated;
+		}
+	}
+	DirtyIndices.Empty();
+	return NumUpdated;
+}
+
+void FPrimitiveBoundsSoA::SetBound(int32 Index, const FAABB& Bound)
+{
+	WriteBound(Index, Bound);
+}
+
+void FPrimitiveBoundsSoA::WriteBound(int32 Index, const FAABB& Bound)
+{
+	// 바운드가 없는 프리미티브(스키닝 메시 등 GetWorldAABB가 빈 박스)는 항상 보이도록 무한 박스로 취급
+	if (Bound.Min.X == Bound.Max.X && Bound.Min.Y == Bound.Max.Y && Bound.Min.Z == Bound.Max.Z)
+	{
+		CenterX[Index] = CenterY[Index] = CenterZ[Index] = 0.0f;
+		ExtentX[Index] = ExtentY[Index] = ExtentZ[Index] = FLT_MAX;
+		return;
+	}
+
+	CenterX[Index] = (Bound.Min.X + Bound.Max.X) * 0.5f;
+	CenterY[Index] = (Bound.Min.Y + Bound.Max.Y) * 0.5f;
+	CenterZ[Index] = (Bound.Min.Z + Bound.Max.Z) * 0.5f;
+	ExtentX[Index] = (Bound.Max.X - Bound.Min.X) * 0.5f;
+	ExtentY[Index] = (Bound.Max.Y - Bound.Min.Y) * 0.5f;
+	ExtentZ[Index] = (Bound.Max.Z - Bound.Min.Z) * 0.5f;
+}
+
+int32 FPrimitiveBoundsSoA::FindIndex(const UPrimitiveComponent* Primitive) const
+{
+	const int32* Index = IndexOfPrimitive.Find(Primitive);
+	return Index ? *Index : -1;
+}
+
+int32 FPrimitiveBoundsSoA::CullFrustum(const FFrustum& Frustum, int32 Begin, int32 End, TArray<int32>& OutVisibleIndices) const
+{
+	End = std::min(End, Num());
+	if (Begin >= End)
+	{
+		return 0;
+	}
+
+	FCullPlane Planes[6];
+	BuildCullPlanes(Frustum, Planes);
+
+	// 최악의 경우(전부 보임)에도 재할당이 없도록
+	OutVisibleIndices.Reserve(OutVisibleIndices.Num() + (End - Begin));
+
+	const float* CX = CenterX.GetData();
+	const float* CY = CenterY.GetData();
+	const float* CZ = CenterZ.GetData();
+	const float* EX = ExtentX.GetData();
+	const float* EY = ExtentY.GetData();
+	const float* EZ = ExtentZ.GetData();
+
+	int32 NumVisible = 0;
+	int32 Index = Begin;
+
+#if defined(__AVX__)
+	// 8개씩: 평면 6개를 차례로 적용하고 레인이 모두 탈락하면 다음 묶음으로
+	__m256 PlaneNX[6], PlaneNY[6], PlaneNZ[6], PlaneAX[6], PlaneAY[6], PlaneAZ[6], PlaneD[6];
+	for (int32 i = 0; i < 6; ++i)
+	{
+		PlaneNX[i] = _mm256_set1_ps(Planes[i].NX);
+		PlaneNY[i] = _mm256_set1_ps(Planes[i].NY);
+		PlaneNZ[i] = _mm256_set1_ps(Planes[i].NZ);
+		PlaneAX[i] = _mm256_set1_ps(Planes[i].AbsX);
+		PlaneAY[i] = _mm256_set1_ps(Planes[i].AbsY);
+		PlaneAZ[i] = _mm256_set1_ps(Planes[i].AbsZ);
+		PlaneD[i] = _mm256_set1_ps(Planes[i].D);
+	}
+
+	for (; Index + 8 <= End; Index += 8)
+	{
+		const __m256 X = _mm256_loadu_ps(CX + Index);
+		const __m256 Y = _mm256_loadu_ps(CY + Index);
+		const __m256 Z = _mm256_loadu_ps(CZ + Index);
+		const __m256 HX = _mm256_loadu_ps(EX + Index);
+		const __m256 HY = _mm256_loadu_ps(EY + Index);
+		const __m256 HZ = _mm256_loadu_ps(EZ + Index);
+
+		uint32 Mask = 0xFF;
+		for (int32 i = 0; i < 6 && Mask; ++i)
+		{
+			__m256 Distance = _mm256_sub_ps(_mm256_mul_ps(X, PlaneNX[i]), PlaneD[i]);
+			Distance = _mm256_add_ps(Distance, _mm256_mul_ps(Y, PlaneNY[i]));
+			Distance = _mm256_add_ps(Distance, _mm256_mul_ps(Z, PlaneNZ[i]));
+			__m256 Radius = _mm256_mul_ps(HX, PlaneAX[i]);
+			Radius = _mm256_add_ps(Radius, _mm256_mul_ps(HY, PlaneAY[i]));
+			Radius = _mm256_add_ps(Radius, _mm256_mul_ps(HZ, PlaneAZ[i]));
+			Mask &= static_cast<uint32>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_add_ps(Distance, Radius), _mm256_setzero_ps(), _CMP_GE_OQ)));
+		}
+		NumVisible += AppendVisible(Mask, Index, OutVisibleIndices);
+	}
+#else
+	// 4개씩 (SSE)
+	__m128 PlaneNX[6], PlaneNY[6], PlaneNZ[6], PlaneAX[6], PlaneAY[6], PlaneAZ[6], PlaneD[6];
+	for (int32 i = 0; i < 6; ++i)
+	{
+		PlaneNX[i] = _mm_set1_ps(Planes[i].NX);
+		PlaneNY[i] = _mm_set1_ps(Planes[i].NY);
+		PlaneNZ[i] = _mm_set1_ps(Planes[i].NZ);
+		PlaneAX[i] = _mm_set1_ps(Planes[i].AbsX);
+		PlaneAY[i] = _mm_set1_ps(Planes[i].AbsY);
+		PlaneAZ[i] = _mm_set1_ps(Planes[i].AbsZ);
+		PlaneD[i] = _mm_set1_ps(Planes[i].D);
+	}
+
+	for (; Index + 4 <= End; Index += 4)
+	{
+		const __m128 X = _mm_loadu_ps(CX + Index);
+		const __m128 Y = _mm_loadu_ps(CY + Index);
+		const __m128 Z = _mm_loadu_ps(CZ + Index);
+		const __m128 HX = _mm_loadu_ps(EX + Index);
+		const __m128 HY = _mm_loadu_ps(EY + Index);
+		const __m128 HZ = _mm_loadu_ps(EZ + Index);
+
+		uint32 Mask = 0xF;
+		for (int32 i = 0; i < 6 && Mask; ++i)
+		{
+			__m128 Distance = _mm_sub_ps(_mm_mul_ps(X, PlaneNX[i]), PlaneD[i]);
+			Distance = _mm_add_ps(Distance, _mm_mul_ps(Y, PlaneNY[i]));
+			Distance = _mm_add_ps(Distance, _mm_mul_ps(Z, PlaneNZ[i]));
+			__m128 Radius = _mm_mul_ps(HX, PlaneAX[i]);
+			Radius = _mm_add_ps(Radius, _mm_mul_ps(HY, PlaneAY[i]));
+			Radius = _mm_add_ps(Radius, _mm_mul_ps(HZ, PlaneAZ[i]));
+			Mask &= static_cast<uint32>(_mm_movemask_ps(_mm_cmpge_ps(_mm_add_ps(Distance, Radius), _mm_setzero_ps())));
+		}
+		NumVisible += AppendVisible(Mask, Index, OutVisibleIndices);
+	}
+#endif
+
+	// 나머지 (스칼라)
+	for (; Index < End; ++Index)
+	{
+		if (IsBoxVisible(Planes, CX[Index], CY[Index], CZ[Index], EX[Index], EY[Index], EZ[Index]))
+		{
+			OutVisibleIndices.Add(Index);
+			++NumVisible;
+		}
+	}
+	return NumVisible;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "UEContainer.h"
+
+class UPrimitiveComponent;
+struct FAABB;
+struct FFrustum;
+
+/**
+ * @brief 렌더 프록시 바운드의 평면(flat) SoA 배열 - 뷰 절두체 컬링 전용
+ *
+ * 프리미티브마다 월드 AABB를 중심/반길이 6개의 float 배열로 나눠 저장해서
+ * 절두체 판정을 SIMD 레인(SSE 4개, AVX 8개)에 그대로 올립니다.
+ * UWorldPartitionManager가 등록/해제/MarkDirty(트랜스폼 변경)를 받아 갱신하고,
+ * 바운드 재계산(GetWorldAABB)은 컬링 직전 FlushDirty에서 더티 슬롯만 수행합니다.
+ *
+ * 인덱스는 제거 시 마지막 슬롯을 당겨오므로(swap-remove) 프레임 간에 고정되지 않습니다.
+ */
+class FPrimitiveBoundsSoA
+{
+public:
+#if defined(__AVX__)
+	static constexpr int32 SimdWidth = 8;
+#else
+	static constexpr int32 SimdWidth = 4;
+#endif
+
+	/** 프리미티브 추가 (Primitive가 nullptr이면 바운드만 보관, 벤치마크용) @return 슬롯 인덱스 */
+	int32 Add(UPrimitiveComponent* Primitive, const FAABB& Bound);
+
+	/** 없으면 추가하고 바운드 재계산을 예약 */
+	void MarkDirty(UPrimitiveComponent* Primitive);
+
+	void Remove(UPrimitiveComponent* Primitive);
+	void Clear();
+
+	/** 더티 슬롯의 바운드를 GetWorldAABB로 다시 읽음 @return 갱신한 슬롯 수 */
+	int32 FlushDirty();
+
+	void SetBound(int32 Index, const FAABB& Bound);
+
+	/**
+	 * @brief [Begin, End) 슬롯을 절두체로 컬링해서 보이는 슬롯 인덱스를 OutVisibleIndices 뒤에 추가
+	 *
+	 * 배열을 읽기만 하므로 범위가 다른 청크나 다른 뷰를 여러 스레드에서 동시에 호출할 수 있습니다.
+	 * (FlushDirty/Add/Remove와는 동시에 호출하지 말 것)
+	 * @return 추가한 인덱스 수
+	 */
+	int32 CullFrustum(const FFrustum& Frustum, int32 Begin, int32 End, TArray<int32>& OutVisibleIndices) const;
+
+	/** 전체 슬롯 컬링 (OutVisibleIndices를 비우고 채움) */
+	int32 CullFrustum(const FFrustum& Frustum, TArray<int32>& OutVisibleIndices) const
+	{
+		OutVisibleIndices.Empty();
+		return CullFrustum(Frustum, 0, Num(), OutVisibleIndices);
+	}
+
+	/** @return 등록되지 않은 프리미티브면 -1 */
+	int32 FindIndex(const UPrimitiveComponent* Primitive) const;
+
+	int32 Num() const { return Primitives.Num(); }
+	int32 GetNumDirty() const { return DirtyIndices.Num(); }
+	UPrimitiveComponent* GetPrimitive(int32 Index) const { return Primitives[Index]; }
+
+private:
+	void WriteBound(int32 Index, const FAABB& Bound);
+
+private:
+	// SoA 바운드 (인덱스 = 슬롯)
+	TArray<float> CenterX, CenterY, CenterZ;
+	TArray<float> ExtentX, ExtentY, ExtentZ;
+
+	TArray<UPrimitiveComponent*> Primitives;
+	TArray<uint8> DirtyFlags;
+	TArray<int32> DirtyIndices;
+	TMap<const UPrimitiveComponent*, int32> IndexOfPrimitive;
+};
@@ -8,6 +8,7 @@ class UStaticMeshComponent;
 
 class FOctree;
 class FBVHierarchy;
+class FPrimitiveBoundsSoA;
 
 struct FRay;
 struct FAABB;
@@ -43,6 +44,8 @@ public:
 	FOctree* GetSceneOctree() const { return SceneOctree; }
 	/** BVH 게터 */
 	FBVHierarchy* GetBVH() const { return BVH; }
+	/** 절두체 컬링용 SoA 바운드 게터 (MarkDirty는 예산 없이 즉시 반영, 바운드 재계산은 컬링 직전 FlushDirty) */
+	FPrimitiveBoundsSoA* GetPrimitiveBounds() const { return PrimitiveBounds; }
 
 private:
 
@@ -58,4 +61,5 @@ private:
 	TSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
 	FOctree* SceneOctree = nullptr;
 	FBVHierarchy* BVH = nullptr;
+	FPrimitiveBoundsSoA* PrimitiveBounds = nullptr;
 };
@@ -1,4 +1,5 @@
 ﻿#include "pch.h"
+#include "PlatformTime.h"
 #include <windowsx.h> // GET_X_LPARAM / GET_Y_LPARAM
 
 #ifndef GET_X_LPARAM
@@ -70,11 +71,11 @@ void UInputManager::Update()
     // 마우스 휠 델타 초기화 (프레임마다 리셋)
     MouseWheelDelta = 0.0f;
 
-    // 매 프레임마다 실시간 마우스 위치 업데이트
+    // 매 프레임마다 실시간 마우스 위치 업데이트 (재생 중에는 다음 BeginFrame에서 기록된 위치를 적용)
     if (WindowHandle)
     {
         POINT CursorPos;
-        if (GetCursorPos(&CursorPos))
+        if (!IsReplaying() && GetCursorPos(&CursorPos))
         {
             ScreenToClient(WindowHandle, &CursorPos);
 
@@ -115,6 +116,12 @@ void UInputManager::Update()
 
 void UInputManager::ProcessMessage(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
+    // 재생 중에는 실제 마우스/키보드 입력을 무시 (창 크기 변경만 반영)
+    if (IsReplaying() && message != WM_SIZE)
+    {
+        return;
+    }
+
     bool IsUIHover = false;
     bool IsKeyBoardCapture = false;
     
@@ -439,9 +446,13 @@ void UInputManager::LockCursor()
 {
     if (!WindowHandle) return;
 
-    // 현재 커서 위치를 기준점으로 저장
+    // 현재 커서 위치를 기준점으로 저장 (재생 중에는 기록된 마우스 위치)
     POINT currentCursor;
-    if (GetCursorPos(&currentCursor))
+    if (IsReplaying())
+    {
+        LockedCursorPosition = MousePosition;
+    }
+    else if (GetCursorPos(&currentCursor))
     {
         ScreenToClient(WindowHandle, &currentCursor);
         LockedCursorPosition = FVector2D(static_cast<float>(currentCursor.x), static_cast<float>(currentCursor.y));
@@ -463,11 +474,233 @@ void UInputManager::ReleaseCursor()
     bIsCursorLocked = false;
 
     // 원래 커서 위치로 복원
-    POINT lockedPoint = { static_cast<int>(LockedCursorPosition.X), static_cast<int>(LockedCursorPosition.Y) };
-    ClientToScreen(WindowHandle, &lockedPoint);
-    SetCursorPos(lockedPoint.x, lockedPoint.y);
+    if (!IsReplaying())
+    {
+        POINT lockedPoint = { static_cast<int>(LockedCursorPosition.X), static_cast<int>(LockedCursorPosition.Y) };
+        ClientToScreen(WindowHandle, &lockedPoint);
+        SetCursorPos(lockedPoint.x, lockedPoint.y);
+    }
 
     // 마우스 위치 동기화
     MousePosition = LockedCursorPosition;
     PreviousMousePosition = LockedCursorPosition;
 }
+
+float UInputManager::BeginFrame(float DeltaSeconds)
+{
+    if (CaptureState == EInputCaptureState::None || bCaptureWaitingForPlay)
+    {
+        return DeltaSeconds;
+    }
+
+    if (CaptureState == EInputCaptureState::Recording)
+    {
+        // 첫 프레임의 Pressed/Released 판정 기준이 되는 직전 키/버튼 상태
+        if (Recording.Frames.IsEmpty())
+        {
+            for (int32 KeyCode = 0; KeyCode < 256; ++KeyCode)
+            {
+                Recording.Initial.SetKeyDown(KeyCode, PreviousKeyStates[KeyCode]);
+            }
+            for (int32 Button = 0; Button < MaxMouseButtons; ++Button)
+            {
+                Recording.Initial.MouseButtons |= PreviousMouseButtons[Button] ? static_cast<uint8>(1 << Button) : 0;
+            }
+        }
+
+        FInputSnapshot Snapshot = CaptureSnapshot();
+        Snapshot.DeltaSeconds = RecordFixedDeltaSeconds > 0.0f ? RecordFixedDeltaSeconds : DeltaSeconds;
+        Recording.Frames.Add(Snapshot);
+        return Snapshot.DeltaSeconds;
+    }
+
+    if (ReplayFrameIndex >= Recording.Num())
+    {
+        StopCapture();
+        return DeltaSeconds;
+    }
+
+    // 직전 BeginFrame부터 지금까지가 직전 재생 프레임의 시간 (Tick + Render)
+    const uint64 Now = FPlatformTime::Cycles64();
+    if (ReplayFrameIndex > 0)
+    {
+        ReplayReport.FrameTimes.Add(static_cast<float>(FPlatformTime::ToMilliseconds(Now - ReplayFrameStartCycles)));
+    }
+    else
+    {
+        for (int32 KeyCode = 0; KeyCode < 256; ++KeyCode)
+        {
+            PreviousKeyStates[KeyCode] = Recording.Initial.IsKeyDown(KeyCode);
+        }
+        for (int32 Button = 0; Button < MaxMouseButtons; ++Button)
+        {
+            PreviousMouseButtons[Button] = (Recording.Initial.MouseButtons >> Button) & 1;
+        }
+    }
+    ReplayFrameStartCycles = Now;
+
+    const FInputSnapshot& Snapshot = Recording.Frames[ReplayFrameIndex++];
+    ApplySnapshot(Snapshot);
+    return Snapshot.DeltaSeconds;
+}
+
+bool UInputManager::StartRecording(const FString& Path, float FixedDeltaSeconds, bool bWaitForPlay)
+{
+    StopCapture();
+
+    CaptureState = EInputCaptureState::Recording;
+    CapturePath = Path;
+    RecordFixedDeltaSeconds = FixedDeltaSeconds;
+    Recording = FInputRecording();
+    bCaptureWaitingForPlay = bWaitForPlay;
+    bCaptureEndsWithPlay = bWaitForPlay;
+
+    if (bWaitForPlay)
+    {
+        UE_LOG("Input: recording to %s starts with the next play session", Path.c_str());
+    }
+    else
+    {
+        BeginCapture();
+    }
+    return true;
+}
+
+bool UInputManager::StartReplay(const FString& Path, bool bWaitForPlay)
+{
+    StopCapture();
+
+    if (!Recording.LoadFromFile(Path) || Recording.Num() == 0)
+    {
+        UE_LOG("[error] Input: nothing to replay in %s", Path.c_str());
+        return false;
+    }
+
+    CaptureState = EInputCaptureState::Replaying;
+    CapturePath = Path;
+    bCaptureWaitingForPlay = bWaitForPlay;
+    bCaptureEndsWithPlay = bWaitForPlay;
+
+    if (bWaitForPlay)
+    {
+        UE_LOG("Input: replay of %s (%d frames) starts with the next play session", Path.c_str(), Recording.Num());
+    }
+    else
+    {
+        BeginCapture();
+    }
+    return true;
+}
+
+void UInputManager::StopCapture()
+{
+    if (CaptureState == EInputCaptureState::None)
+    {
+        return;
+    }
+
+    if (bCaptureWaitingForPlay)
+    {
+        UE_LOG("Input: pending %s of %s cancelled",
+            CaptureState == EInputCaptureState::Recording ? "recording" : "replay", CapturePath.c_str());
+    }
+    else if (CaptureState == EInputCaptureState::Recording)
+    {
+        if (Recording.SaveToFile(CapturePath))
+        {
+            UE_LOG("Input: recorded %d frames -> %s", Recording.Num(), CapturePath.c_str());
+        }
+    }
+    else
+    {
+        // 마지막으로 적용한 프레임의 시간 (재생이 끝나기 전에 멈춘 경우 포함)
+        if (ReplayFrameIndex > ReplayReport.FrameTimes.Num())
+        {
+            ReplayReport.FrameTimes.Add(static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ReplayFrameStartCycles)));
+        }
+        ReplayReport.Write();
+
+        // 재생된 키가 눌린 채로 남지 않도록 실제 입력 상태에서 다시 시작
+        ResetInputState();
+    }
+
+    CaptureState = EInputCaptureState::None;
+    bCaptureWaitingForPlay = false;
+    bCaptureEndsWithPlay = false;
+    Recording = FInputRecording();
+    ReplayReport = FInputReplayReport();
+}
+
+void UInputManager::OnPlayBegin()
+{
+    if (bCaptureWaitingForPlay)
+    {
+        bCaptureWaitingForPlay = false;
+        BeginCapture();
+    }
+}
+
+void UInputManager::OnPlayEnd()
+{
+    if (bCaptureEndsWithPlay && !bCaptureWaitingForPlay)
+    {
+        StopCapture();
+    }
+}
+
+FInputSnapshot UInputManager::CaptureSnapshot() const
+{
+    FInputSnapshot Snapshot;
+    Snapshot.MousePosition = MousePosition;
+    Snapshot.PreviousMousePosition = PreviousMousePosition;
+    Snapshot.MouseWheelDelta = MouseWheelDelta;
+    for (int32 Button = 0; Button < MaxMouseButtons; ++Button)
+    {
+        Snapshot.MouseButtons |= MouseButtons[Button] ? static_cast<uint8>(1 << Button) : 0;
+    }
+    for (int32 KeyCode = 0; KeyCode < 256; ++KeyCode)
+    {
+        Snapshot.SetKeyDown(KeyCode, KeyStates[KeyCode]);
+    }
+    return Snapshot;
+}
+
+void UInputManager::ApplySnapshot(const FInputSnapshot& Snapshot)
+{
+    MousePosition = Snapshot.MousePosition;
+    PreviousMousePosition = Snapshot.PreviousMousePosition;
+    MouseWheelDelta = Snapshot.MouseWheelDelta;
+    for (int32 Button = 0; Button < MaxMouseButtons; ++Button)
+    {
+        MouseButtons[Button] = (Snapshot.MouseButtons >> Button) & 1;
+    }
+    for (int32 KeyCode = 0; KeyCode < 256; ++KeyCode)
+    {
+        KeyStates[KeyCode] = Snapshot.IsKeyDown(KeyCode);
+    }
+}
+
+void UInputManager::BeginCapture()
+{
+    ReplayFrameIndex = 0;
+    ReplayReport = FInputReplayReport();
+    ReplayReport.RecordingPath = CapturePath;
+
+    if (CaptureState == EInputCaptureState::Recording)
+    {
+        UE_LOG("Input: recording to %s (fixed delta %.4f s)", CapturePath.c_str(), RecordFixedDeltaSeconds);
+    }
+    else
+    {
+        UE_LOG("Input: replaying %s (%d frames)", CapturePath.c_str(), Recording.Num());
+    }
+}
+
+void UInputManager::ResetInputState()
+{
+    memset(MouseButtons, false, sizeof(MouseButtons));
+    memset(PreviousMouseButtons, false, sizeof(PreviousMouseButtons));
+    memset(KeyStates, false, sizeof(KeyStates));
+    memset(PreviousKeyStates, false, sizeof(PreviousKeyStates));
+    MouseWheelDelta = 0.0f;
+}
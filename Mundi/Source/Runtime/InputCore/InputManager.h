@@ -5,6 +5,7 @@
 
 #include "Object.h"
 #include "Vector.h"
+#include "InputRecording.h"
 #include "ImGui/imgui.h"
 
 // 마우스 버튼 상수
@@ -18,6 +19,14 @@ enum EMouseButton
     MaxMouseButtons = 5
 };
 
+// 입력 기록/재생 상태
+enum class EInputCaptureState : uint8
+{
+    None,
+    Recording,
+    Replaying
+};
+
 class UInputManager : public UObject
 {
 public:
@@ -41,6 +50,30 @@ public:
     void Update(); // 매 프레임 호출
     void ProcessMessage(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
 
+    /**
+     * @brief 엔진 Tick 맨 앞에서 호출: 기록 중이면 현재 입력을 저장, 재생 중이면 기록된 입력을 적용
+     * @return 이번 프레임에 사용할 델타 타임 (기록 중에는 고정 델타, 재생 중에는 기록된 델타)
+     */
+    float BeginFrame(float DeltaSeconds);
+
+    /**
+     * @brief 입력 기록/재생 시작
+     * @param bWaitForPlay true면 OnPlayBegin(PIE 시작)까지 대기했다가 시작하고 OnPlayEnd에서 끝냄
+     *                     (같은 월드 초기 상태에서 시작해야 재생 결과가 같음)
+     */
+    bool StartRecording(const FString& Path, float FixedDeltaSeconds, bool bWaitForPlay);
+    bool StartReplay(const FString& Path, bool bWaitForPlay);
+    /** 기록은 파일로 저장, 재생은 프레임 시간 보고서를 남기고 종료 */
+    void StopCapture();
+
+    void OnPlayBegin();
+    void OnPlayEnd();
+
+    EInputCaptureState GetCaptureState() const { return CaptureState; }
+    bool IsCapturePending() const { return bCaptureWaitingForPlay; }
+    bool IsReplaying() const { return CaptureState == EInputCaptureState::Replaying && !bCaptureWaitingForPlay; }
+    int32 GetNumReplayFrames() const { return Recording.Num(); }
+
     // 마우스 함수들
     FVector2D GetMousePosition() const { return MousePosition; }
     FVector2D GetMouseDelta() const { return MousePosition - PreviousMousePosition; }
@@ -82,6 +115,11 @@ private:
     void UpdateMouseButton(EMouseButton Button, bool bPressed);
     void UpdateKeyState(int KeyCode, bool bPressed);
 
+    FInputSnapshot CaptureSnapshot() const;
+    void ApplySnapshot(const FInputSnapshot& Snapshot);
+    void BeginCapture();
+    void ResetInputState();
+
     // 윈도우 핸들
     HWND WindowHandle;
 
@@ -109,4 +147,15 @@ private:
     // 커서 잠금 상태
     bool bIsCursorLocked = false;
     FVector2D LockedCursorPosition; // 우클릭한 위치 (기준점)
+
+    // 입력 기록/재생
+    EInputCaptureState CaptureState = EInputCaptureState::None;
+    bool bCaptureWaitingForPlay = false;
+    bool bCaptureEndsWithPlay = false;
+    FString CapturePath;
+    float RecordFixedDeltaSeconds = 0.0f;
+    FInputRecording Recording;
+    int32 ReplayFrameIndex = 0;
+    uint64 ReplayFrameStartCycles = 0;
+    FInputReplayReport ReplayReport;
 };
@@ -0,0 +1,234 @@
+#include "pch.h"
+#include "InputRecording.h"
+#include "WindowsBinReader.h"
+#include "WindowsBinWriter.h"
+#include "BenchmarkUtils.h"
+
+namespace
+{
+    constexpr uint32 InputRecordingMagic = 0x4345524D;  // "MREC"
+    constexpr uint32 InputRecordingVersion = 1;
+
+    // 프레임 플래그: 설정된 항목만 뒤따라 저장됨
+    enum EInputFrameFlags : uint8
+    {
+        DeltaChanged = 1 << 0,      // float
+        MouseChanged = 1 << 1,      // FVector2D x 2
+        WheelNonZero = 1 << 2,      // float
+        ButtonsChanged = 1 << 3,    // uint8
+        KeysChanged = 1 << 4,       // uint8 워드 마스크 + 바뀐 uint64 워드
+    };
+
+    // 프레임 하나가 차지하는 최소 바이트 (플래그만 있는 프레임)
+    constexpr uint64 MinEncodedFrameSize = sizeof(uint8);
+
+    bool IsSameVector(const FVector2D& A, const FVector2D& B)
+    {
+        return A.X == B.X && A.Y == B.Y;
+    }
+}
+
+bool FInputRecording::SaveToFile(const FString& Path) const
+{
+    FWindowsBinWriter Writer(Path);
+    if (!Writer.IsOpen())
+    {
+        UE_LOG("[error] Input: failed to open %s for writing", Path.c_str());
+        return false;
+    }
+
+    uint32 Magic = InputRecordingMagic;
+    uint32 Version = InputRecordingVersion;
+    uint32 NumFrames = static_cast<uint32>(Frames.Num());
+    uint8 InitialButtons = Initial.MouseButtons;
+    Writer << Magic << Version << NumFrames << InitialButtons;
+    Writer.Serialize((void*)Initial.KeyBits, sizeof(Initial.KeyBits));
+
+    const FInputSnapshot* Previous = &Initial;
+    for (const FInputSnapshot& Frame : Frames)
+    {
+        uint8 KeyWordMask = 0;
+        for (int32 Word = 0; Word < 4; ++Word)
+        {
+            if (Frame.KeyBits[Word] != Previous->KeyBits[Word])
+            {
+                KeyWordMask |= static_cast<uint8>(1 << Word);
+            }
+        }
+
+        // 첫 프레임은 Initial과 비교하므로 델타/마우스는 항상 기록됨 (Initial의 값은 0)
+        uint8 Flags = 0;
+        if (Frame.DeltaSeconds != Previous->DeltaSeconds) Flags |= DeltaChanged;
+        if (!IsSameVector(Frame.MousePosition, Previous->MousePosition)
+            || !IsSameVector(Frame.PreviousMousePosition, Previous->PreviousMousePosition)) Flags |= MouseChanged;
+        if (Frame.MouseWheelDelta != 0.0f) Flags |= WheelNonZero;
+        if (Frame.MouseButtons != Previous->MouseButtons) Flags |= ButtonsChanged;
+        if (KeyWordMask != 0) Flags |= KeysChanged;
+
+        Writer << Flags;
+        if (Flags & DeltaChanged)
+        {
+            float DeltaSeconds = Frame.DeltaSeconds;
+            Writer << DeltaSeconds;
+        }
+        if (Flags & MouseChanged)
+        {
+            FVector2D MousePosition = Frame.MousePosition;
+            FVector2D PreviousMousePosition = Frame.PreviousMousePosition;
+            Writer << MousePosition << PreviousMousePosition;
+        }
+        if (Flags & WheelNonZero)
+        {
+            float Wheel = Frame.MouseWheelDelta;
+            Writer << Wheel;
+        }
+        if (Flags & ButtonsChanged)
+        {
+            uint8 Buttons = Frame.MouseButtons;
+            Writer << Buttons;
+        }
+        if (Flags & KeysChanged)
+        {
+            Writer << KeyWordMask;
+            for (int32 Word = 0; Word < 4; ++Word)
+            {
+                if (KeyWordMask & (1 << Word))
+                {
+                    uint64 Bits = Frame.KeyBits[Word];
+                    Writer << Bits;
+                }
+            }
+        }
+        Previous = &Frame;
+    }
+
+    return Writer.Tell() >= 0;
+}
+
+bool FInputRecording::LoadFromFile(const FString& Path)
+{
+    Frames.Empty();
+    Initial = FInputSnapshot();
+
+    FWindowsBinReader Reader(Path);
+    if (!Reader.IsOpen())
+    {
+        UE_LOG("[error] Input: failed to open recording %s", Path.c_str());
+        return false;
+    }
+
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    uint32 NumFrames = 0;
+    Reader << Magic << Version << NumFrames;
+    if (Magic != InputRecordingMagic || Version != InputRecordingVersion || NumFrames > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+    {
+        UE_LOG("[error] Input: %s is not a version %u input recording", Path.c_str(), InputRecordingVersion);
+        return false;
+    }
+    Reader << Initial.MouseButtons;
+    Reader.Serialize(Initial.KeyBits, sizeof(Initial.KeyBits));
+
+    // 헤더의 프레임 수를 믿고 할당하기 전에 남은 파일 크기로 상한을 확인 (손상/잘린 파일이 큰 할당을 만들지 않도록)
+    std::error_code SizeError;
+    const uint64 FileSize = static_cast<uint64>(fs::file_size(UTF8ToWide(Path), SizeError));
+    const int64 HeaderEnd = Reader.Tell();
+    if (SizeError || HeaderEnd < 0 || static_cast<uint64>(HeaderEnd) > FileSize
+        || static_cast<uint64>(NumFrames) * MinEncodedFrameSize > FileSize - static_cast<uint64>(HeaderEnd))
+    {
+        UE_LOG("[error] Input: recording %s is truncated (%u frames in header)", Path.c_str(), NumFrames);
+        return false;
+    }
+
+    Frames.SetNum(NumFrames);
+    const FInputSnapshot* Previous = &Initial;
+    for (FInputSnapshot& Frame : Frames)
+    {
+        // 플래그가 없는 항목은 직전 프레임 값을 이어받음 (휠은 매 프레임 0에서 시작)
+        Frame = *Previous;
+        Frame.MouseWheelDelta = 0.0f;
+
+        uint8 Flags = 0;
+        Reader << Flags;
+        if (Flags & DeltaChanged)
+        {
+            Reader << Frame.DeltaSeconds;
+        }
+        if (Flags & MouseChanged)
+        {
+            Reader << Frame.MousePosition << Frame.PreviousMousePosition;
+        }
+        if (Flags & WheelNonZero)
+        {
+            Reader << Frame.MouseWheelDelta;
+        }
+        if (Flags & ButtonsChanged)
+        {
+            Reader << Frame.MouseButtons;
+        }
+        if (Flags & KeysChanged)
+        {
+            uint8 KeyWordMask = 0;
+            Reader << KeyWordMask;
+            for (int32 Word = 0; Word < 4; ++Word)
+            {
+                if (KeyWordMask & (1 << Word))
+                {
+                    Reader << Frame.KeyBits[Word];
+                }
+            }
+        }
+        Previous = &Frame;
+    }
+
+    // 파일이 중간에 끊기면 스트림이 실패 상태가 되어 Tell이 -1을 반환
+    if (Reader.Tell() < 0)
+    {
+        UE_LOG("[error] Input: recording %s is truncated", Path.c_str());
+        Frames.Empty();
+        return false;
+    }
+    return true;
+}
+
+bool FInputReplayReport::Write() const
+{
+    const FString ReportPath = RecordingPath + ".report.json";
+    std::ofstream File(UTF8ToWide(ReportPath));
+    if (!File.is_open())
+    {
+        UE_LOG("[error] Input: failed to open %s", ReportPath.c_str());
+        return false;
+    }
+    File.setf(std::ios::fixed);
+    File.precision(4);
+
+    double TotalMS = 0.0;
+    for (float FrameMS : FrameTimes)
+    {
+        TotalMS += FrameMS;
+    }
+    const double AverageMS = TotalMS / std::max<double>(1.0, static_cast<double>(FrameTimes.Num()));
+    const float P95 = Percentile(FrameTimes, 0.95f);
+
+    // 빌드 간 비교용 요약 + 프레임별 시간 (그래프용)
+    File << "{\n  \"recording\": ";
+    WriteJsonString(File, RecordingPath);
+    File << ",\n  \"frames\": " << FrameTimes.Num();
+    File << ",\n  \"totalMs\": " << TotalMS;
+    File << ",\n  \"frameMs\": { \"avg\": " << AverageMS
+        << ", \"p50\": " << Percentile(FrameTimes, 0.5f)
+        << ", \"p95\": " << P95
+        << ", \"p99\": " << Percentile(FrameTimes, 0.99f)
+        << ", \"max\": " << Percentile(FrameTimes, 1.0f) << " }";
+    File << ",\n  \"frameTimesMs\": [";
+    for (int32 Index = 0; Index < FrameTimes.Num(); ++Index)
+    {
+        File << (Index == 0 ? "" : ", ") << FrameTimes[Index];
+    }
+    File << "]\n}\n";
+
+    UE_LOG("Input replay: %d frames, avg %.3f ms/frame (p95 %.3f ms) -> %s",
+        FrameTimes.Num(), AverageMS, P95, ReportPath.c_str());
+    return true;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+
+/**
+ * @brief 한 프레임의 입력 상태 (엔진 Tick 시작 시점)
+ *
+ * 이전 프레임 키/버튼 상태는 저장하지 않음: 재생 중에도 UInputManager::Update가 직전 프레임 값을 그대로 복사함
+ */
+struct FInputSnapshot
+{
+    float DeltaSeconds = 0.0f;
+    FVector2D MousePosition = FVector2D(0.0f, 0.0f);
+    FVector2D PreviousMousePosition = FVector2D(0.0f, 0.0f);   // 커서 잠금 중에는 잠금 위치 (델타 계산 기준)
+    float MouseWheelDelta = 0.0f;
+    uint8 MouseButtons = 0;                                     // EMouseButton 비트
+    uint64 KeyBits[4] = {};                                     // Virtual Key Code 256개 비트
+
+    bool IsKeyDown(int32 KeyCode) const { return (KeyBits[KeyCode >> 6] >> (KeyCode & 63)) & 1; }
+    void SetKeyDown(int32 KeyCode, bool bDown)
+    {
+        const uint64 Bit = 1ull << (KeyCode & 63);
+        KeyBits[KeyCode >> 6] = bDown ? (KeyBits[KeyCode >> 6] | Bit) : (KeyBits[KeyCode >> 6] & ~Bit);
+    }
+};
+
+/**
+ * @brief 프레임별 입력 스냅샷 + 델타 타임 기록 (.inputrec 바이너리)
+ *
+ * 프레임마다 직전 프레임과 달라진 항목만 플래그 바이트 뒤에 저장하므로
+ * 입력이 없는 프레임은 1바이트, 마우스만 움직이는 프레임은 17바이트 정도
+ */
+class FInputRecording
+{
+public:
+    bool SaveToFile(const FString& Path) const;
+    bool LoadFromFile(const FString& Path);
+
+    int32 Num() const { return Frames.Num(); }
+
+    FInputSnapshot Initial;         // 기록 시작 직전 상태 (첫 프레임의 Pressed/Released 판정용 키/버튼 비트만 사용)
+    TArray<FInputSnapshot> Frames;
+};
+
+/**
+ * @brief 입력 재생 한 번의 프레임 시간 요약 (평균/백분위)을 로그와 JSON으로 남김
+ */
+struct FInputReplayReport
+{
+    FString RecordingPath;
+    TArray<float> FrameTimes;       // 재생 프레임마다 BeginFrame 간격 (ms, 렌더 포함)
+
+    /** RecordingPath + ".report.json" */
+    bool Write() const;
+};
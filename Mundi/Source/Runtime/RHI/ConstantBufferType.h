@@ -195,7 +195,7 @@ struct CameraBufferType // b7
     float Padding;
 };
 
-// b11: 타일 기반 라이트 컬링 상수 버퍼
+// b11: 클러스터(타일 x 깊이 슬라이스) 기반 라이트 컬링 상수 버퍼
 struct FTileCullingBufferType
 {
     uint32 TileSize;          // 타일 크기 (픽셀, 기본 16)
@@ -204,8 +204,12 @@ struct FTileCullingBufferType
     uint32 bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint32 ViewportStartX;    // 뷰포트 시작 X 좌표
     uint32 ViewportStartY;    // 뷰포트 시작 Y 좌표
-    uint32 Padding[2];
+    uint32 NumDepthSlices;    // 깊이 슬라이스 개수
+    float DepthSliceScale;    // Slice = log(ViewZ) * DepthSliceScale + DepthSliceBias
+    float DepthSliceBias;
+    uint32 Padding[3];
 };
+static_assert(sizeof(FTileCullingBufferType) % 16 == 0, "CB must be 16-byte aligned");
 
 struct FPointLightShadowBufferType
 {
@@ -20,12 +20,41 @@ void D3D11RHI::Initialize(HWND hWindow)
     UStatsOverlayD2D::Get().Initialize(Device, DeviceContext, SwapChain);
 }
 
+void D3D11RHI::InitializeHeadless()
+{
+    // 렌더링은 하지 않으므로 GPU가 없는 머신에서도 만들 수 있는 WARP 디바이스 사용
+    D3D_FEATURE_LEVEL featurelevels[] = { D3D_FEATURE_LEVEL_11_0 };
+    UINT createDeviceFlags = D3D11_CREATE_DEVICE_BGRA_SUPPORT;
+
+    HRESULT hr = D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_WARP, nullptr,
+        createDeviceFlags,
+        featurelevels, ARRAYSIZE(featurelevels), D3D11_SDK_VERSION,
+        &Device, nullptr, &DeviceContext);
+    if (FAILED(hr))
+    {
+        UE_LOG("[error] D3D11RHI: Failed to create headless device (0x%08x)", static_cast<uint32>(hr));
+        return;
+    }
+
+    // 프레임/ID 버퍼와 D2D 오버레이는 스왑체인이 필요하므로 생략
+    CreateRasterizerState();
+    CreateBlendState();
+    CONSTANT_BUFFER_LIST(CREATE_CONSTANT_BUFFER);
+
+    CreateDepthStencilState();
+    CreateSamplerState();
+    UResourceManager::GetInstance().Initialize(Device, DeviceContext);
+}
+
 void D3D11RHI::Release()
 {
     // Prevent double Release() calls
     if (bReleased) return;
     bReleased = true;
 
+    // 디바이스 생성 전(또는 실패)이면 해제할 것이 없음
+    if (!Device) return;
+
     // Direct2D 오버레이를 먼저 정리하여 D3D 리소스에 대한 참조를 제거
     UStatsOverlayD2D::Get().Shutdown();
 
@@ -54,6 +54,8 @@ public:
 
 public:
 	void Initialize(HWND hWindow);
+	/** 창/스왑체인 없이 리소스 생성용 디바이스와 상태 객체만 만듦 (헤드리스 실행, WARP 소프트웨어 디바이스) */
+	void InitializeHeadless();
 
 	void Release();
 
@@ -0,0 +1,602 @@
+#include "pch.h"
+#include "ClusteredLightCuller.h"
+#include "PlatformTime.h"
+#include <algorithm>
+
+DECLARE_CYCLE_STAT(ClusteredLightCulling, "Renderer")
+
+namespace
+{
+	constexpr uint32 SpotLightTypeBit = 1u << 16;
+
+	// FVector4 * FMatrix (row-vector)로 점/방향을 뷰 공간으로 변환
+	FVector TransformToView(const FVector4& V, const FMatrix& ViewMatrix)
+	{
+		const FVector4 Result = V * ViewMatrix;
+		return FVector(Result.X, Result.Y, Result.Z);
+	}
+
+	/**
+	 * 원뿔(꼭지점 Apex, 높이 Range, 반각 Angle)을 감싸는 가장 작은 구
+	 * 반각 45도 미만은 꼭지점과 밑면 원을 지나는 구, 이상은 밑면 원의 외접 구
+	 */
+	void ComputeConeBoundingSphere(const FVector& Apex, const FVector& Direction, float Range, float CosAngle, float SinAngle, FVector& OutCenter, float& OutRadius)
+	{
+		if (CosAngle > 0.70710678f)
+		{
+			OutRadius = Range * 0.5f / CosAngle;
+			OutCenter = Apex + Direction * OutRadius;
+		}
+		else
+		{
+			OutRadius = Range * SinAngle;
+			OutCenter = Apex + Direction * (Range * CosAngle);
+		}
+	}
+}
+
+FClusteredLightCuller::FClusteredLightCuller()
+	: RHI(nullptr)
+	, TileSize(16)
+	, TileCountX(0)
+	, TileCountY(0)
+	, TotalClusterCount(0)
+	, ViewportSizeX(1.0f)
+	, ViewportSizeY(1.0f)
+	, DepthSliceScale(0.0f)
+	, DepthSliceBias(0.0f)
+	, SliceDepths{}
+	, LightIndexBuffer(nullptr)
+	, LightIndexBufferSRV(nullptr)
+	, LightIndexBufferCapacity(0)
+{
+}
+
+FClusteredLightCuller::~FClusteredLightCuller()
+{
+	Release();
+}
+
+void FClusteredLightCuller::Initialize(D3D11RHI* InRHI, UINT InTileSize)
+{
+	RHI = InRHI;
+	SetTileSize(InTileSize);
+
+	if (!Workers.IsEmpty())
+	{
+		return;
+	}
+
+	// 렌더 스레드가 슬라이스를 같이 처리하므로 워커는 하드웨어 스레드 - 1개 (최대 7개)
+	const int32 HardwareThreads = static_cast<int32>(std::thread::hardware_concurrency());
+	const int32 NumWorkers = std::clamp(HardwareThreads - 1, 0, 7);
+	bStopping = false;
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		Workers.emplace_back(&FClusteredLightCuller::WorkerLoop, this);
+	}
+}
+
+void FClusteredLightCuller::CullLights(
+	const TArray<FPointLightInfo>& PointLights,
+	const TArray<FSpotLightInfo>& SpotLights,
+	const FMatrix& ViewMatrix,
+	const FMatrix& ProjMatrix,
+	float NearPlane,
+	float FarPlane,
+	UINT ViewportWidth,
+	UINT ViewportHeight)
+{
+	BuildClusters(PointLights, SpotLights, ViewMatrix, ProjMatrix, NearPlane, FarPlane, ViewportWidth, ViewportHeight);
+	UploadToGPU();
+}
+
+void FClusteredLightCuller::BuildClusters(
+	const TArray<FPointLightInfo>& PointLights,
+	const TArray<FSpotLightInfo>& SpotLights,
+	const FMatrix& ViewMatrix,
+	const FMatrix& ProjMatrix,
+	float NearPlane,
+	float FarPlane,
+	UINT ViewportWidth,
+	UINT ViewportHeight)
+{
+	SCOPE_CYCLE_COUNTER(ClusteredLightCulling);
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// 클러스터 그리드 계산
+	ViewportWidth = std::max(ViewportWidth, 1u);
+	ViewportHeight = std::max(ViewportHeight, 1u);
+	TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
+	TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
+	TotalClusterCount = TileCountX * TileCountY * NumDepthSlices;
+	ViewportSizeX = static_cast<float>(ViewportWidth);
+	ViewportSizeY = static_cast<float>(ViewportHeight);
+
+	// 로그 깊이 분할: Slice k = [Near * (Far/Near)^(k/N), Near * (Far/Near)^((k+1)/N)]
+	const float Near = std::max(NearPlane, 1e-3f);
+	const float Far = std::max(FarPlane, Near * 1.001f);
+	const float LogDepthRange = std::log(Far / Near);
+	DepthSliceScale = static_cast<float>(NumDepthSlices) / LogDepthRange;
+	DepthSliceBias = -static_cast<float>(NumDepthSlices) * std::log(Near) / LogDepthRange;
+	for (uint32 Slice = 0; Slice <= NumDepthSlices; ++Slice)
+	{
+		SliceDepths[Slice] = Near * std::exp(LogDepthRange * static_cast<float>(Slice) / static_cast<float>(NumDepthSlices));
+	}
+
+	// 타일 경계 NDC를 뷰 공간 좌표로 (ndc = (x*P00 + z*P20 + P30) / (z*P23 + P33)를 x에 대해 풀면 z의 일차식)
+	const float P00 = ProjMatrix.M[0][0], P20 = ProjMatrix.M[2][0], P30 = ProjMatrix.M[3][0];
+	const float P11 = ProjMatrix.M[1][1], P21 = ProjMatrix.M[2][1], P31 = ProjMatrix.M[3][1];
+	const float P23 = ProjMatrix.M[2][3], P33 = ProjMatrix.M[3][3];
+
+	ColumnEdgeA.SetNum(TileCountX + 1);
+	ColumnEdgeB.SetNum(TileCountX + 1);
+	for (UINT X = 0; X <= TileCountX; ++X)
+	{
+		const float NdcX = static_cast<float>(std::min(X * TileSize, ViewportWidth)) / ViewportSizeX * 2.0f - 1.0f;
+		ColumnEdgeA[X] = (NdcX * P33 - P30) / P00;
+		ColumnEdgeB[X] = (NdcX * P23 - P20) / P00;
+	}
+
+	// 화면 Y는 아래로 증가 (행 Y의 위쪽 경계 = Edge[Y], 아래쪽 경계 = Edge[Y + 1])
+	RowEdgeA.SetNum(TileCountY + 1);
+	RowEdgeB.SetNum(TileCountY + 1);
+	for (UINT Y = 0; Y <= TileCountY; ++Y)
+	{
+		const float NdcY = 1.0f - static_cast<float>(std::min(Y * TileSize, ViewportHeight)) / ViewportSizeY * 2.0f;
+		RowEdgeA[Y] = (NdcY * P33 - P31) / P11;
+		RowEdgeB[Y] = (NdcY * P23 - P21) / P11;
+	}
+
+	// 라이트를 뷰 공간 경계로 변환하고 겹치는 슬라이스 목록에 추가
+	for (FSliceWork& Work : SliceWork)
+	{
+		Work.Lights.Empty();
+	}
+	ClusterLights.Empty();
+	ClusterLights.Reserve(PointLights.Num() + SpotLights.Num());
+
+	auto AddLight = [this, &ProjMatrix](FClusterLight& Light)
+	{
+		uint32 MinSlice = 0;
+		uint32 MaxSlice = 0;
+		if (!ComputeClusterRange(Light, ProjMatrix, MinSlice, MaxSlice))
+		{
+			return;
+		}
+
+		const int32 LightIndex = ClusterLights.Add(Light);
+		for (uint32 Slice = MinSlice; Slice <= MaxSlice; ++Slice)
+		{
+			SliceWork[Slice].Lights.Add(LightIndex);
+		}
+	};
+
+	for (int32 i = 0; i < PointLights.Num(); ++i)
+	{
+		FClusterLight Light;
+		Light.Center = TransformToView(FVector4::FromPoint(PointLights[i].Position), ViewMatrix);
+		Light.Radius = PointLights[i].AttenuationRadius;
+		Light.PackedIndex = static_cast<uint32>(i);
+		AddLight(Light);
+	}
+
+	for (int32 i = 0; i < SpotLights.Num(); ++i)
+	{
+		const FSpotLightInfo& Spot = SpotLights[i];
+
+		FClusterLight Light;
+		Light.Apex = TransformToView(FVector4::FromPoint(Spot.Position), ViewMatrix);
+		Light.Direction = TransformToView(FVector4::FromDirection(Spot.Direction), ViewMatrix).GetSafeNormal();
+		Light.Range = Spot.AttenuationRadius;
+		Light.PackedIndex = SpotLightTypeBit | static_cast<uint32>(i);
+
+		// OuterConeAngle은 반각 (도 단위, LightingCommon.hlsl의 CalculateSpotLight와 같음)
+		const float HalfAngle = DegreesToRadians(std::clamp(Spot.OuterConeAngle, 0.0f, 180.0f));
+		Light.bCone = HalfAngle < PI * 0.5f;
+		if (Light.bCone)
+		{
+			Light.CosAngle = std::cos(HalfAngle);
+			Light.SinAngle = std::sin(HalfAngle);
+			ComputeConeBoundingSphere(Light.Apex, Light.Direction, Light.Range, Light.CosAngle, Light.SinAngle, Light.Center, Light.Radius);
+		}
+		else
+		{
+			Light.Center = Light.Apex;
+			Light.Radius = Light.Range;
+		}
+		AddLight(Light);
+	}
+
+	// 슬라이스별 교차 테스트 + 압축 (병렬)
+	RunSliceTasks(&FClusteredLightCuller::CullSlice);
+
+	// 슬라이스 순서대로 인덱스 목록을 이어 붙일 위치 결정 (헤더 바로 뒤부터)
+	const uint32 HeaderSize = TotalClusterCount * 2;
+	uint32 TotalIndices = 0;
+	for (FSliceWork& Work : SliceWork)
+	{
+		Work.BaseOffset = HeaderSize + TotalIndices;
+		TotalIndices += static_cast<uint32>(Work.Indices.Num());
+	}
+	ClusterData.SetNum(HeaderSize + TotalIndices);
+
+	// 헤더 작성 + 인덱스 복사 (병렬)
+	RunSliceTasks(&FClusteredLightCuller::WriteSlice);
+
+	// 통계
+	Stats.Reset();
+	Stats.TileCountX = TileCountX;
+	Stats.TileCountY = TileCountY;
+	Stats.DepthSliceCount = NumDepthSlices;
+	Stats.TotalPointLights = PointLights.Num();
+	Stats.TotalSpotLights = SpotLights.Num();
+	Stats.TotalLightsPassed = TotalIndices;
+	Stats.MinLightsPerCluster = UINT_MAX;
+	for (const FSliceWork& Work : SliceWork)
+	{
+		Stats.TotalLightTests += Work.NumTests;
+		Stats.MinLightsPerCluster = FMath::Min(Stats.MinLightsPerCluster, Work.MinCount);
+		Stats.MaxLightsPerCluster = FMath::Max(Stats.MaxLightsPerCluster, Work.MaxCount);
+	}
+	Stats.CalculateStats();
+	Stats.CullingTimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+	Stats.LightIndexBufferSizeBytes = LightIndexBufferCapacity * sizeof(uint32);
+}
+
+bool FClusteredLightCuller::ComputeClusterRange(FClusterLight& Light, const FMatrix& ProjMatrix, uint32& OutMinSlice, uint32& OutMaxSlice) const
+{
+	const float NearZ = std::max(Light.Center.Z - Light.Radius, SliceDepths[0]);
+	const float FarZ = std::min(Light.Center.Z + Light.Radius, SliceDepths[NumDepthSlices]);
+	if (NearZ > FarZ)
+	{
+		return false;
+	}
+
+	// 경계 구를 감싸는 뷰 공간 상자의 모서리 8개를 투영 (Near 앞쪽은 Near로 잘라서 보수적으로)
+	// 고정된 z에서 NDC는 x/y에 단조, 고정된 x/y에서는 z에 단조이므로 모서리의 최소/최대가 곧 범위
+	float MinNdcX = FLT_MAX, MaxNdcX = -FLT_MAX;
+	float MinNdcY = FLT_MAX, MaxNdcY = -FLT_MAX;
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		const FVector4 ViewCorner(
+			Light.Center.X + ((Corner & 1) ? Light.Radius : -Light.Radius),
+			Light.Center.Y + ((Corner & 2) ? Light.Radius : -Light.Radius),
+			(Corner & 4) ? FarZ : NearZ,
+			1.0f);
+		const FVector4 Clip = ViewCorner * ProjMatrix;
+		const float InvW = 1.0f / std::max(Clip.W, KINDA_SMALL_NUMBER);
+		MinNdcX = std::min(MinNdcX, Clip.X * InvW);
+		MaxNdcX = std::max(MaxNdcX, Clip.X * InvW);
+		MinNdcY = std::min(MinNdcY, Clip.Y * InvW);
+		MaxNdcY = std::max(MaxNdcY, Clip.Y * InvW);
+	}
+
+	if (MaxNdcX < -1.0f || MinNdcX > 1.0f || MaxNdcY < -1.0f || MinNdcY > 1.0f)
+	{
+		return false;
+	}
+
+	auto ToTile = [this](float Pixel, UINT TileCount)
+	{
+		return static_cast<uint32>(std::clamp(Pixel / static_cast<float>(TileSize), 0.0f, static_cast<float>(TileCount - 1)));
+	};
+	Light.MinTileX = ToTile((MinNdcX * 0.5f + 0.5f) * ViewportSizeX, TileCountX);
+	Light.MaxTileX = ToTile((MaxNdcX * 0.5f + 0.5f) * ViewportSizeX, TileCountX);
+	Light.MinTileY = ToTile((0.5f - MaxNdcY * 0.5f) * ViewportSizeY, TileCountY);
+	Light.MaxTileY = ToTile((0.5f - MinNdcY * 0.5f) * ViewportSizeY, TileCountY);
+
+	OutMinSlice = ComputeDepthSlice(NearZ);
+	OutMaxSlice = ComputeDepthSlice(FarZ);
+	return true;
+}
+
+uint32 FClusteredLightCuller::ComputeDepthSlice(float ViewZ) const
+{
+	// 셰이더의 CalculateDepthSlice와 같은 식
+	const float Slice = std::log(std::max(ViewZ, 1e-4f)) * DepthSliceScale + DepthSliceBias;
+	return static_cast<uint32>(std::clamp(Slice, 0.0f, static_cast<float>(NumDepthSlices - 1)));
+}
+
+void FClusteredLightCuller::CullSlice(uint32 Slice)
+{
+	FSliceWork& Work = SliceWork[Slice];
+	const uint32 TilesPerSlice = TileCountX * TileCountY;
+	const uint32 PaddedCountX = (TileCountX + 3) & ~3u;
+	const float SliceNear = SliceDepths[Slice];
+	const float SliceFar = SliceDepths[Slice + 1];
+
+	// 이 슬라이스 깊이 범위에서 열/행별 클러스터 AABB (경계가 z의 일차식이므로 Near/Far 값 중 최소/최대)
+	Work.ColumnMinX.SetNum(PaddedCountX);
+	Work.ColumnMaxX.SetNum(PaddedCountX);
+	for (uint32 X = 0; X < PaddedCountX; ++X)
+	{
+		if (X < TileCountX)
+		{
+			Work.ColumnMinX[X] = std::min(ColumnEdgeA[X] + ColumnEdgeB[X] * SliceNear, ColumnEdgeA[X] + ColumnEdgeB[X] * SliceFar);
+			Work.ColumnMaxX[X] = std::max(ColumnEdgeA[X + 1] + ColumnEdgeB[X + 1] * SliceNear, ColumnEdgeA[X + 1] + ColumnEdgeB[X + 1] * SliceFar);
+		}
+		else
+		{
+			// 패딩 열은 어떤 라이트와도 교차하지 않음
+			Work.ColumnMinX[X] = FLT_MAX;
+			Work.ColumnMaxX[X] = FLT_MAX;
+		}
+	}
+
+	Work.RowMinY.SetNum(TileCountY);
+	Work.RowMaxY.SetNum(TileCountY);
+	for (uint32 Y = 0; Y < TileCountY; ++Y)
+	{
+		Work.RowMinY[Y] = std::min(RowEdgeA[Y + 1] + RowEdgeB[Y + 1] * SliceNear, RowEdgeA[Y + 1] + RowEdgeB[Y + 1] * SliceFar);
+		Work.RowMaxY[Y] = std::max(RowEdgeA[Y] + RowEdgeB[Y] * SliceNear, RowEdgeA[Y] + RowEdgeB[Y] * SliceFar);
+	}
+
+	Work.ClusterCounts.SetNum(TilesPerSlice);
+	std::fill(Work.ClusterCounts.begin(), Work.ClusterCounts.end(), 0u);
+	Work.HitClusters.Empty();
+	Work.HitLights.Empty();
+	Work.NumTests = 0;
+
+	const float ClusterCenterZ = (SliceNear + SliceFar) * 0.5f;
+	const float ClusterHalfZ = (SliceFar - SliceNear) * 0.5f;
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 Half = _mm_set1_ps(0.5f);
+
+	for (int32 LightIndex : Work.Lights)
+	{
+		const FClusterLight& Light = ClusterLights[LightIndex];
+		const float DistZ = std::max(SliceNear - Light.Center.Z, 0.0f) + std::max(Light.Center.Z - SliceFar, 0.0f);
+		const float RadiusSqMinusZ = Light.Radius * Light.Radius - DistZ * DistZ;
+		const __m128 LightX = _mm_set1_ps(Light.Center.X);
+
+		// 원뿔 테스트 상수 (클러스터 경계 구 vs 원뿔, "Cull that Cone!" 방식)
+		const __m128 ApexX = _mm_set1_ps(Light.Apex.X);
+		const __m128 DirX = _mm_set1_ps(Light.Direction.X);
+		const __m128 ConeCos = _mm_set1_ps(Light.CosAngle);
+		const __m128 ConeSin = _mm_set1_ps(Light.SinAngle);
+		const float VZ = ClusterCenterZ - Light.Apex.Z;
+
+		Work.NumTests += (Light.MaxTileX - Light.MinTileX + 1) * (Light.MaxTileY - Light.MinTileY + 1);
+
+		for (uint32 Y = Light.MinTileY; Y <= Light.MaxTileY; ++Y)
+		{
+			// 구-AABB 거리: 행/슬라이스 축은 스칼라, 열 축은 4개씩 SIMD
+			const float DistY = std::max(Work.RowMinY[Y] - Light.Center.Y, 0.0f) + std::max(Light.Center.Y - Work.RowMaxY[Y], 0.0f);
+			const float RemainingSq = RadiusSqMinusZ - DistY * DistY;
+			if (RemainingSq < 0.0f)
+			{
+				continue;
+			}
+			const __m128 Remaining = _mm_set1_ps(RemainingSq);
+
+			const float ClusterCenterY = (Work.RowMinY[Y] + Work.RowMaxY[Y]) * 0.5f;
+			const float ClusterHalfY = (Work.RowMaxY[Y] - Work.RowMinY[Y]) * 0.5f;
+			const float VY = ClusterCenterY - Light.Apex.Y;
+			const __m128 HalfYZSq = _mm_set1_ps(ClusterHalfY * ClusterHalfY + ClusterHalfZ * ClusterHalfZ);
+			const __m128 VYZLenSq = _mm_set1_ps(VY * VY + VZ * VZ);
+			const __m128 VYZDotDir = _mm_set1_ps(VY * Light.Direction.Y + VZ * Light.Direction.Z);
+
+			const uint32 RowBase = Y * TileCountX;
+			for (uint32 X = Light.MinTileX & ~3u; X <= Light.MaxTileX; X += 4)
+			{
+				const __m128 MinX = _mm_loadu_ps(&Work.ColumnMinX[X]);
+				const __m128 MaxX = _mm_loadu_ps(&Work.ColumnMaxX[X]);
+				const __m128 DistX = _mm_add_ps(_mm_max_ps(_mm_sub_ps(MinX, LightX), Zero), _mm_max_ps(_mm_sub_ps(LightX, MaxX), Zero));
+				uint32 HitMask = static_cast<uint32>(_mm_movemask_ps(_mm_cmple_ps(_mm_mul_ps(DistX, DistX), Remaining)));
+
+				// 라이트의 타일 범위 밖 레인 제외
+				if (X < Light.MinTileX)
+				{
+					HitMask &= 0xFu << (Light.MinTileX - X);
+				}
+				if (X + 3 > Light.MaxTileX)
+				{
+					HitMask &= 0xFu >> (X + 3 - Light.MaxTileX);
+				}
+
+				if (HitMask != 0 && Light.bCone)
+				{
+					const __m128 HalfX = _mm_mul_ps(_mm_sub_ps(MaxX, MinX), Half);
+					const __m128 ClusterRadius = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(HalfX, HalfX), HalfYZSq));
+					const __m128 VX = _mm_sub_ps(_mm_mul_ps(_mm_add_ps(MinX, MaxX), Half), ApexX);
+					const __m128 VLenSq = _mm_add_ps(_mm_mul_ps(VX, VX), VYZLenSq);
+					const __m128 V1Len = _mm_add_ps(_mm_mul_ps(VX, DirX), VYZDotDir);
+					const __m128 PerpLen = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(VLenSq, _mm_mul_ps(V1Len, V1Len)), Zero));
+					const __m128 DistClosest = _mm_sub_ps(_mm_mul_ps(ConeCos, PerpLen), _mm_mul_ps(V1Len, ConeSin));
+
+					// 원뿔 옆면 바깥 / 원뿔 끝 너머 / 꼭지점 뒤쪽이면 컬링
+					__m128 Inside = _mm_cmple_ps(DistClosest, ClusterRadius);
+					Inside = _mm_and_ps(Inside, _mm_cmple_ps(V1Len, _mm_add_ps(ClusterRadius, _mm_set1_ps(Light.Range))));
+					Inside = _mm_and_ps(Inside, _mm_cmpge_ps(V1Len, _mm_sub_ps(Zero, ClusterRadius)));
+					HitMask &= static_cast<uint32>(_mm_movemask_ps(Inside));
+				}
+
+				for (uint32 Lane = 0; HitMask != 0; ++Lane, HitMask >>= 1)
+				{
+					if (HitMask & 1)
+					{
+						const uint32 LocalCluster = RowBase + X + Lane;
+						Work.HitClusters.Add(LocalCluster);
+						Work.HitLights.Add(Light.PackedIndex);
+						++Work.ClusterCounts[LocalCluster];
+					}
+				}
+			}
+		}
+	}
+
+	// 클러스터 순서로 정렬 (카운팅 정렬, 라이트 순서 유지)
+	Work.ClusterOffsets.SetNum(TilesPerSlice);
+	Work.MinCount = UINT_MAX;
+	Work.MaxCount = 0;
+	uint32 Running = 0;
+	for (uint32 Cluster = 0; Cluster < TilesPerSlice; ++Cluster)
+	{
+		const uint32 Count = Work.ClusterCounts[Cluster];
+		Work.ClusterOffsets[Cluster] = Running;
+		Running += Count;
+		Work.MinCount = std::min(Work.MinCount, Count);
+		Work.MaxCount = std::max(Work.MaxCount, Count);
+	}
+
+	// ClusterOffsets를 커서로 쓰면서 채우므로 끝나면 각 클러스터의 끝 위치가 됨 (WriteSlice에서 Count를 빼서 복원)
+	Work.Indices.SetNum(Running);
+	for (int32 Hit = 0; Hit < Work.HitClusters.Num(); ++Hit)
+	{
+		Work.Indices[Work.ClusterOffsets[Work.HitClusters[Hit]]++] = Work.HitLights[Hit];
+	}
+}
+
+void FClusteredLightCuller::WriteSlice(uint32 Slice)
+{
+	const FSliceWork& Work = SliceWork[Slice];
+	const uint32 TilesPerSlice = TileCountX * TileCountY;
+	uint32* Header = ClusterData.GetData() + Slice * TilesPerSlice * 2;
+
+	for (uint32 Cluster = 0; Cluster < TilesPerSlice; ++Cluster)
+	{
+		const uint32 Count = Work.ClusterCounts[Cluster];
+		Header[Cluster * 2] = Work.BaseOffset + Work.ClusterOffsets[Cluster] - Count;
+		Header[Cluster * 2 + 1] = Count;
+	}
+
+	if (!Work.Indices.IsEmpty())
+	{
+		memcpy(ClusterData.GetData() + Work.BaseOffset, Work.Indices.GetData(), Work.Indices.Num() * sizeof(uint32));
+	}
+}
+
+void FClusteredLightCuller::RunSliceTasks(void (FClusteredLightCuller::*Task)(uint32))
+{
+	{
+		std::lock_guard<std::mutex> Lock(WorkMutex);
+		CurrentTask = Task;
+		NextSlice = 0;
+		NumBusyWorkers = Workers.Num();
+		++WorkGeneration;
+	}
+	WorkCondition.notify_all();
+
+	// 호출 스레드도 슬라이스를 가져가서 처리
+	ProcessSlices();
+
+	std::unique_lock<std::mutex> Lock(WorkMutex);
+	DoneCondition.wait(Lock, [this]() { return NumBusyWorkers == 0; });
+	CurrentTask = nullptr;
+}
+
+void FClusteredLightCuller::ProcessSlices()
+{
+	for (uint32 Slice = NextSlice.fetch_add(1); Slice < NumDepthSlices; Slice = NextSlice.fetch_add(1))
+	{
+		(this->*CurrentTask)(Slice);
+	}
+}
+
+void FClusteredLightCuller::WorkerLoop()
+{
+	FProfiler::SetThreadName("LightCulling");
+
+	uint64 SeenGeneration = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> Lock(WorkMutex);
+			WorkCondition.wait(Lock, [this, SeenGeneration]() { return bStopping || WorkGeneration != SeenGeneration; });
+			if (bStopping)
+			{
+				break;
+			}
+			SeenGeneration = WorkGeneration;
+		}
+
+		ProcessSlices();
+
+		std::lock_guard<std::mutex> Lock(WorkMutex);
+		if (--NumBusyWorkers == 0)
+		{
+			DoneCondition.notify_one();
+		}
+	}
+}
+
+void FClusteredLightCuller::UploadToGPU()
+{
+	if (!RHI || ClusterData.IsEmpty())
+	{
+		return;
+	}
+
+	// 모자랄 때만 25% 여유를 두고 다시 생성 (라이트 수가 조금씩 바뀌어도 매 프레임 재생성하지 않음)
+	const uint32 RequiredCount = static_cast<uint32>(ClusterData.Num());
+	if (LightIndexBuffer && LightIndexBufferCapacity < RequiredCount)
+	{
+		LightIndexBufferSRV->Release();
+		LightIndexBufferSRV = nullptr;
+		LightIndexBuffer->Release();
+		LightIndexBuffer = nullptr;
+	}
+
+	if (!LightIndexBuffer)
+	{
+		const uint32 Capacity = RequiredCount + RequiredCount / 4;
+		HRESULT hr = RHI->CreateStructuredBuffer(sizeof(uint32), Capacity, nullptr, &LightIndexBuffer);
+		if (FAILED(hr))
+		{
+			LightIndexBufferCapacity = 0;
+			return;
+		}
+
+		hr = RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
+		if (FAILED(hr))
+		{
+			LightIndexBuffer->Release();
+			LightIndexBuffer = nullptr;
+			LightIndexBufferCapacity = 0;
+			return;
+		}
+		LightIndexBufferCapacity = Capacity;
+	}
+
+	RHI->UpdateStructuredBuffer(LightIndexBuffer, ClusterData.GetData(), RequiredCount * sizeof(uint32));
+	Stats.LightIndexBufferSizeBytes = LightIndexBufferCapacity * sizeof(uint32);
+}
+
+ID3D11ShaderResourceView* FClusteredLightCuller::GetLightIndexBufferSRV()
+{
+	return LightIndexBufferSRV;
+}
+
+void FClusteredLightCuller::Release()
+{
+	{
+		std::lock_guard<std::mutex> Lock(WorkMutex);
+		bStopping = true;
+	}
+	WorkCondition.notify_all();
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.Empty();
+
+	if (LightIndexBufferSRV)
+	{
+		LightIndexBufferSRV->Release();
+		LightIndexBufferSRV = nullptr;
+	}
+
+	if (LightIndexBuffer)
+	{
+		LightIndexBuffer->Release();
+		LightIndexBuffer = nullptr;
+	}
+	LightIndexBufferCapacity = 0;
+
+	ClusterData.Empty();
+	ClusterLights.Empty();
+}
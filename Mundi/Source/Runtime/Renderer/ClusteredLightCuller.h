@@ -0,0 +1,167 @@
+#pragma once
+#include "LightManager.h"
+#include "TileCullingStats.h"
+#include "D3D11RHI.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+// 클러스터(화면 타일 x 깊이 슬라이스) 기반 라이트 컬링을 CPU에서 수행하는 클래스
+// 라이트마다 화면 타일 범위와 깊이 슬라이스 범위를 투영해서 덮는 클러스터만 검사하고,
+// 결과는 클러스터별 (오프셋, 개수) 헤더 + 가변 길이 라이트 인덱스 목록으로 압축해서 올린다
+//
+// GPU 버퍼 구조 (StructuredBuffer<uint>, t2)
+//   [ClusterIndex * 2]      = 라이트 인덱스 목록 시작 위치 (버퍼 처음 기준)
+//   [ClusterIndex * 2 + 1]  = 라이트 개수
+//   [TotalClusterCount * 2 ~] = 라이트 인덱스 (상위 16비트: 타입(0=Point, 1=Spot), 하위 16비트: 인덱스)
+// ClusterIndex = (Slice * TileCountY + TileY) * TileCountX + TileX
+class FClusteredLightCuller
+{
+public:
+	// 깊이 슬라이스 개수 (Near~Far를 로그 간격으로 분할)
+	static constexpr uint32 NumDepthSlices = 24;
+
+	FClusteredLightCuller();
+	~FClusteredLightCuller();
+
+	// 초기화 (슬라이스 워커 스레드 생성, GPU 버퍼는 첫 업로드 때 생성)
+	// InRHI가 nullptr이면 컬링만 수행 (헤드리스 벤치마크)
+	void Initialize(D3D11RHI* InRHI, UINT InTileSize = 16);
+
+	// 타일 크기 변경 (다음 CullLights부터 적용)
+	void SetTileSize(UINT InTileSize) { TileSize = std::max(InTileSize, 1u); }
+
+	// 클러스터 컬링 수행 후 GPU 버퍼 업데이트 (매 프레임 호출)
+	void CullLights(
+		const TArray<FPointLightInfo>& PointLights,
+		const TArray<FSpotLightInfo>& SpotLights,
+		const FMatrix& ViewMatrix,
+		const FMatrix& ProjMatrix,
+		float NearPlane,
+		float FarPlane,
+		UINT ViewportWidth,
+		UINT ViewportHeight
+	);
+
+	// GPU 업로드 없이 클러스터 목록만 생성
+	void BuildClusters(
+		const TArray<FPointLightInfo>& PointLights,
+		const TArray<FSpotLightInfo>& SpotLights,
+		const FMatrix& ViewMatrix,
+		const FMatrix& ProjMatrix,
+		float NearPlane,
+		float FarPlane,
+		UINT ViewportWidth,
+		UINT ViewportHeight
+	);
+
+	ID3D11ShaderResourceView* GetLightIndexBufferSRV();
+
+	// 헤더 + 인덱스 목록 (GPU 버퍼와 같은 내용)
+	const TArray<uint32>& GetClusterData() const { return ClusterData; }
+
+	// 셰이더의 깊이 슬라이스 계산: Slice = log(ViewZ) * Scale + Bias
+	float GetDepthSliceScale() const { return DepthSliceScale; }
+	float GetDepthSliceBias() const { return DepthSliceBias; }
+
+	const FTileCullingStats& GetStats() const { return Stats; }
+
+	// 리소스 해제 (워커 스레드 포함)
+	void Release();
+
+private:
+	// 뷰 공간으로 변환한 라이트 경계와 덮는 클러스터 범위
+	struct FClusterLight
+	{
+		FVector Center;         // 경계 구 중심 (Spot은 원뿔을 감싸는 구)
+		float Radius = 0.0f;
+		FVector Apex;           // Spot 원뿔 꼭지점
+		FVector Direction;      // Spot 원뿔 방향 (정규화됨)
+		float Range = 0.0f;
+		float CosAngle = 0.0f;
+		float SinAngle = 0.0f;
+		uint32 PackedIndex = 0;
+		uint32 MinTileX = 0, MaxTileX = 0;
+		uint32 MinTileY = 0, MaxTileY = 0;
+		bool bCone = false;     // 원뿔 정밀 테스트 여부 (반각 90도 이상이면 구로만 테스트)
+	};
+
+	// 깊이 슬라이스 하나의 작업 데이터 (슬라이스끼리 공유하지 않으므로 병렬 처리 가능)
+	struct FSliceWork
+	{
+		TArray<int32> Lights;           // 이 슬라이스와 겹치는 라이트 (ClusterLights 인덱스)
+		TArray<uint32> ClusterCounts;   // 슬라이스 내 클러스터별 라이트 개수
+		TArray<uint32> ClusterOffsets;  // 슬라이스 내 클러스터별 Indices 시작 위치
+		TArray<uint32> HitClusters;     // 통과한 (클러스터, 라이트) 쌍
+		TArray<uint32> HitLights;
+		TArray<uint32> Indices;         // 클러스터 순서로 정렬한 라이트 인덱스
+		TArray<float> ColumnMinX, ColumnMaxX;  // 타일 열별 뷰 공간 X 범위 (SIMD 4개 단위로 패딩)
+		TArray<float> RowMinY, RowMaxY;        // 타일 행별 뷰 공간 Y 범위
+		uint32 BaseOffset = 0;          // ClusterData 안의 인덱스 목록 시작 위치
+		uint32 NumTests = 0;
+		uint32 MinCount = 0;
+		uint32 MaxCount = 0;
+	};
+
+	// 뷰 공간 경계 구를 투영해서 덮는 타일/슬라이스 범위 계산 @return 화면 밖이면 false
+	bool ComputeClusterRange(FClusterLight& Light, const FMatrix& ProjMatrix, uint32& OutMinSlice, uint32& OutMaxSlice) const;
+
+	uint32 ComputeDepthSlice(float ViewZ) const;
+
+	// 슬라이스의 클러스터와 라이트 교차 테스트 후 클러스터 순서로 압축
+	void CullSlice(uint32 Slice);
+
+	// 슬라이스 결과를 ClusterData로 복사
+	void WriteSlice(uint32 Slice);
+
+	// 슬라이스마다 Task를 실행 (호출 스레드도 참여, 모두 끝나면 반환)
+	void RunSliceTasks(void (FClusteredLightCuller::*Task)(uint32));
+	void ProcessSlices();
+	void WorkerLoop();
+
+	void UploadToGPU();
+
+private:
+	D3D11RHI* RHI;
+
+	// 클러스터 설정
+	UINT TileSize;
+	UINT TileCountX;
+	UINT TileCountY;
+	UINT TotalClusterCount;
+	float ViewportSizeX;
+	float ViewportSizeY;
+	float DepthSliceScale;
+	float DepthSliceBias;
+	float SliceDepths[NumDepthSlices + 1];
+
+	// 타일 경계의 뷰 공간 좌표: X(z) = A + B * z (원근/직교 투영 모두 선형)
+	TArray<float> ColumnEdgeA, ColumnEdgeB;  // TileCountX + 1개
+	TArray<float> RowEdgeA, RowEdgeB;        // TileCountY + 1개
+
+	TArray<FClusterLight> ClusterLights;
+	FSliceWork SliceWork[NumDepthSlices];
+
+	// 헤더 + 인덱스 목록
+	TArray<uint32> ClusterData;
+
+	// 슬라이스 워커
+	TArray<std::thread> Workers;
+	std::mutex WorkMutex;
+	std::condition_variable WorkCondition;
+	std::condition_variable DoneCondition;
+	void (FClusteredLightCuller::*CurrentTask)(uint32) = nullptr;
+	std::atomic<uint32> NextSlice{ 0 };
+	uint64 WorkGeneration = 0;
+	int32 NumBusyWorkers = 0;
+	bool bStopping = false;
+
+	// GPU 리소스 (크기가 모자랄 때만 다시 생성)
+	ID3D11Buffer* LightIndexBuffer;
+	ID3D11ShaderResourceView* LightIndexBufferSRV;
+	uint32 LightIndexBufferCapacity;
+
+	// 통계
+	FTileCullingStats Stats;
+};
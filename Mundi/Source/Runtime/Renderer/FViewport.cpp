@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "FViewport.h"
 #include "FViewportClient.h"
+#include "Occlusion.h"
 
 FViewport::FViewport()
 {
@@ -150,6 +151,16 @@ void FViewport::Cleanup()
 	D3DDevice = nullptr;
 }
 
+FOcclusionCullingManagerCPU* FViewport::GetOcclusionCuller()
+{
+	if (!OcclusionCuller)
+	{
+		OcclusionCuller = std::make_unique<FOcclusionCullingManagerCPU>();
+		OcclusionCuller->Initialize();
+	}
+	return OcclusionCuller.get();
+}
+
 void FViewport::BeginRenderFrame()
 {
 	// 뷰포트 설정
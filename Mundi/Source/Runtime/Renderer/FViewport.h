@@ -4,6 +4,7 @@
 #include <d3d11.h>
 
 class FViewportClient;
+class FOcclusionCullingManagerCPU;
 
 /**
  * @brief 뷰포트 클래스 - UE의 FViewport를 모방
@@ -55,6 +56,9 @@ public:
     // 뷰포트 hover 상태 (ImGui::Image용)
     void SetViewportHovered(bool bHovered) { bViewportHovered = bHovered; }
     bool IsViewportHovered() const { return bViewportHovered; }
+
+    // CPU 오클루전 컬러 (히스테리시스/깊이 재사용 상태를 뷰포트와 같은 수명으로 유지, 처음 요청할 때 생성)
+    FOcclusionCullingManagerCPU* GetOcclusionCuller();
     
     FVector2D GetViewportMousePosition() { return ViewportMousePosition; }
 
@@ -93,5 +97,7 @@ private:
 
     // 뷰포트 hover 상태 (ImGui::Image용)
     bool bViewportHovered = false;
+
+    std::unique_ptr<FOcclusionCullingManagerCPU> OcclusionCuller;
 };
 
@@ -0,0 +1,298 @@
+#include "pch.h"
+#include "LightCullingBenchmark.h"
+#include "ClusteredLightCuller.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+
+namespace
+{
+	constexpr int32 LightCounts[] = { 64, 256, 1024 };
+	constexpr uint32 Resolutions[][2] = { { 1280, 720 }, { 1920, 1080 }, { 3840, 2160 } };
+	constexpr uint32 TileSize = 16;
+	constexpr float NearPlane = 0.1f;
+	constexpr float FarPlane = 1000.0f;
+	constexpr int32 NumLegacyIterations = 3;
+	constexpr int32 NumIterations = 20;
+
+	// 이전 FTileLightCuller와 같은 구현 (타일마다 프러스텀 6평면을 만들고 모든 라이트를 경계 구로 테스트)
+	struct FLegacyPlane
+	{
+		FVector Normal;
+		float Distance = 0.0f;
+	};
+
+	class FLegacyTileLightCuller
+	{
+	public:
+		static constexpr uint32 MaxLightsPerTile = 256;
+
+		void CullLights(
+			const TArray<FPointLightInfo>& PointLights,
+			const TArray<FSpotLightInfo>& SpotLights,
+			const FMatrix& ViewMatrix,
+			const FMatrix& ProjMatrix,
+			uint32 ViewportWidth,
+			uint32 ViewportHeight)
+		{
+			TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
+			TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
+			const uint32 TotalTileCount = TileCountX * TileCountY;
+
+			const uint32 RequiredSize = TotalTileCount * MaxLightsPerTile;
+			if (TileLightIndices.Num() != static_cast<int32>(RequiredSize))
+			{
+				TileLightIndices.SetNum(RequiredSize);
+			}
+			memset(TileLightIndices.GetData(), 0, RequiredSize * sizeof(uint32));
+
+			const FMatrix InvViewProj = ProjMatrix.InversePerspectiveProjection() * ViewMatrix.InverseAffine();
+
+			TotalLightsPassed = 0;
+			for (uint32 TileY = 0; TileY < TileCountY; ++TileY)
+			{
+				for (uint32 TileX = 0; TileX < TileCountX; ++TileX)
+				{
+					const uint32 TileDataOffset = (TileY * TileCountX + TileX) * MaxLightsPerTile;
+					FLegacyPlane Planes[6];
+					CreateTileFrustum(TileX, TileY, InvViewProj, Planes);
+
+					uint32 LightCount = 0;
+					for (int32 i = 0; i < PointLights.Num() && LightCount < MaxLightsPerTile - 1; ++i)
+					{
+						if (SphereIntersectsFrustum(PointLights[i].Position, PointLights[i].AttenuationRadius, Planes))
+						{
+							TileLightIndices[TileDataOffset + 1 + LightCount] = i;
+							LightCount++;
+						}
+					}
+					for (int32 i = 0; i < SpotLights.Num() && LightCount < MaxLightsPerTile - 1; ++i)
+					{
+						if (SphereIntersectsFrustum(SpotLights[i].Position, SpotLights[i].AttenuationRadius, Planes))
+						{
+							TileLightIndices[TileDataOffset + 1 + LightCount] = (1 << 16) | i;
+							LightCount++;
+						}
+					}
+					TileLightIndices[TileDataOffset] = LightCount;
+					TotalLightsPassed += LightCount;
+				}
+			}
+		}
+
+		uint32 GetBufferSizeBytes() const { return static_cast<uint32>(TileLightIndices.Num()) * sizeof(uint32); }
+		uint32 GetTotalTileCount() const { return TileCountX * TileCountY; }
+		uint64 GetTotalLightsPassed() const { return TotalLightsPassed; }
+
+	private:
+		void CreateTileFrustum(uint32 TileX, uint32 TileY, const FMatrix& InvViewProj, FLegacyPlane OutPlanes[6]) const
+		{
+			const float ViewportWidth = static_cast<float>(TileCountX * TileSize);
+			const float ViewportHeight = static_cast<float>(TileCountY * TileSize);
+			const float NDC_MinX = (static_cast<float>(TileX * TileSize) / ViewportWidth) * 2.0f - 1.0f;
+			const float NDC_MaxX = (static_cast<float>((TileX + 1) * TileSize) / ViewportWidth) * 2.0f - 1.0f;
+			const float NDC_MinY = 1.0f - (static_cast<float>((TileY + 1) * TileSize) / ViewportHeight) * 2.0f;
+			const float NDC_MaxY = 1.0f - (static_cast<float>(TileY * TileSize) / ViewportHeight) * 2.0f;
+
+			const FVector4 FrustumCorners[8] = {
+				FVector4(NDC_MinX, NDC_MinY, 0.0f, 1.0f), FVector4(NDC_MaxX, NDC_MinY, 0.0f, 1.0f),
+				FVector4(NDC_MaxX, NDC_MaxY, 0.0f, 1.0f), FVector4(NDC_MinX, NDC_MaxY, 0.0f, 1.0f),
+				FVector4(NDC_MinX, NDC_MinY, 1.0f, 1.0f), FVector4(NDC_MaxX, NDC_MinY, 1.0f, 1.0f),
+				FVector4(NDC_MaxX, NDC_MaxY, 1.0f, 1.0f), FVector4(NDC_MinX, NDC_MaxY, 1.0f, 1.0f)
+			};
+
+			FVector WorldCorners[8];
+			for (int32 i = 0; i < 8; ++i)
+			{
+				FVector4 WorldPos = FrustumCorners[i] * InvViewProj;
+				WorldPos /= WorldPos.W;
+				WorldCorners[i] = FVector(WorldPos.X, WorldPos.Y, WorldPos.Z);
+			}
+
+			// Left, Right, Bottom, Top, Near, Far (점 인덱스는 이전 구현과 같음)
+			const int32 PlanePoints[6][3] = { { 0, 3, 7 }, { 1, 5, 6 }, { 0, 1, 5 }, { 2, 3, 7 }, { 0, 1, 2 }, { 4, 6, 5 } };
+			for (int32 Plane = 0; Plane < 6; ++Plane)
+			{
+				const FVector& Origin = WorldCorners[PlanePoints[Plane][0]];
+				const FVector Edge1 = WorldCorners[PlanePoints[Plane][1]] - Origin;
+				const FVector Edge2 = WorldCorners[PlanePoints[Plane][2]] - Origin;
+				OutPlanes[Plane].Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
+				OutPlanes[Plane].Distance = -FVector::Dot(OutPlanes[Plane].Normal, Origin);
+			}
+		}
+
+		static bool SphereIntersectsFrustum(const FVector& Center, float Radius, const FLegacyPlane Planes[6])
+		{
+			for (int32 i = 0; i < 6; ++i)
+			{
+				if (FVector::Dot(Planes[i].Normal, Center) + Planes[i].Distance < -Radius)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		uint32 TileCountX = 0;
+		uint32 TileCountY = 0;
+		uint64 TotalLightsPassed = 0;
+		TArray<uint32> TileLightIndices;
+	};
+
+	struct FScenarioResult
+	{
+		int32 NumLights = 0;
+		uint32 Width = 0;
+		uint32 Height = 0;
+		double LegacyMS = 0.0;
+		double NewMS = 0.0;
+		uint32 LegacyBufferBytes = 0;
+		uint32 NewBufferBytes = 0;
+		float LegacyLightsPerTile = 0.0f;
+		float NewLightsPerCluster = 0.0f;
+	};
+
+	/** 재현 가능한 난수 (시나리오마다 같은 배치) */
+
+	/**
+	 * 카메라(원점, +Z 방향) 시야 안팎에 라이트를 부피 기준으로 고르게 배치 (깊이 = 세제곱근 분포)
+	 * 뷰 행렬이 단위 행렬이므로 월드 좌표 = 뷰 공간 좌표
+	 */
+	void MakeLights(int32 NumLights, float Aspect, TArray<FPointLightInfo>& OutPointLights, TArray<FSpotLightInfo>& OutSpotLights)
+	{
+		FBenchmarkRandom Random(0x1234567u + static_cast<uint32>(NumLights));
+		const float TanHalfFov = std::tan(DegreesToRadians(60.0f) * 0.5f);
+
+		OutPointLights.Empty();
+		OutSpotLights.Empty();
+		for (int32 i = 0; i < NumLights; ++i)
+		{
+			const float Depth = 3.0f + 117.0f * std::cbrt(Random.NextFloat());
+			const FVector Position(
+				Random.Range(-1.2f, 1.2f) * Depth * TanHalfFov * Aspect,
+				Random.Range(-1.2f, 1.2f) * Depth * TanHalfFov,
+				Depth);
+			const float Radius = Random.Range(2.0f, 8.0f);
+
+			if (i % 4 != 3)
+			{
+				FPointLightInfo Light{};
+				Light.Position = Position;
+				Light.AttenuationRadius = Radius;
+				OutPointLights.Add(Light);
+			}
+			else
+			{
+				FSpotLightInfo Light{};
+				Light.Position = Position;
+				Light.Direction = FVector(Random.Range(-1.0f, 1.0f), Random.Range(-1.0f, 1.0f), Random.Range(-1.0f, 1.0f)).GetSafeNormal();
+				Light.OuterConeAngle = Random.Range(15.0f, 60.0f);
+				Light.InnerConeAngle = Light.OuterConeAngle * 0.5f;
+				Light.AttenuationRadius = Radius * 2.0f;
+				OutSpotLights.Add(Light);
+			}
+		}
+	}
+
+	void LogScenario(const FScenarioResult& Result)
+	{
+		char Name[64];
+		snprintf(Name, sizeof(Name), "%d lights %ux%u", Result.NumLights, Result.Width, Result.Height);
+		const double Speedup = Result.NewMS > 0.0 ? Result.LegacyMS / Result.NewMS : 0.0;
+		UE_LOG("[LightCullingBenchmark] %-26s %10.3f %10.3f %7.2fx %9u %9u %7.2f %7.2f", Name, Result.LegacyMS, Result.NewMS, Speedup,
+			Result.LegacyBufferBytes / 1024, Result.NewBufferBytes / 1024, Result.LegacyLightsPerTile, Result.NewLightsPerCluster);
+	}
+
+	void WriteReport(const FString& ReportPath, const TArray<FScenarioResult>& Results)
+	{
+		std::ofstream File(UTF8ToWide(ReportPath));
+		if (!File.is_open())
+		{
+			UE_LOG("[error] LightCullingBenchmark: failed to open %s", ReportPath.c_str());
+			return;
+		}
+		File.setf(std::ios::fixed);
+		File.precision(4);
+
+		File << "{\n  \"tileSize\": " << TileSize
+			<< ",\n  \"depthSlices\": " << FClusteredLightCuller::NumDepthSlices
+			<< ",\n  \"scenarios\": [";
+		for (int32 Index = 0; Index < Results.Num(); ++Index)
+		{
+			const FScenarioResult& Result = Results[Index];
+			File << (Index == 0 ? "\n" : ",\n")
+				<< "    { \"lights\": " << Result.NumLights
+				<< ", \"width\": " << Result.Width
+				<< ", \"height\": " << Result.Height
+				<< ", \"tileMs\": " << Result.LegacyMS
+				<< ", \"clusteredMs\": " << Result.NewMS
+				<< ", \"tileBufferBytes\": " << Result.LegacyBufferBytes
+				<< ", \"clusteredBufferBytes\": " << Result.NewBufferBytes
+				<< ", \"lightsPerTile\": " << Result.LegacyLightsPerTile
+				<< ", \"lightsPerCluster\": " << Result.NewLightsPerCluster << " }";
+		}
+		File << "\n  ]\n}\n";
+		UE_LOG("[LightCullingBenchmark] report -> %s", ReportPath.c_str());
+	}
+}
+
+void FLightCullingBenchmark::RunAndLog(const FString& ReportPath)
+{
+	FLegacyTileLightCuller LegacyCuller;
+	FClusteredLightCuller ClusteredCuller;
+	ClusteredCuller.Initialize(nullptr, TileSize);
+
+	TArray<FPointLightInfo> PointLights;
+	TArray<FSpotLightInfo> SpotLights;
+	TArray<FScenarioResult> Results;
+	const FMatrix ViewMatrix = FMatrix::Identity();
+
+	UE_LOG("[LightCullingBenchmark] tile %u px, %u depth slices, old = per-tile frustum x all lights, new = clustered", TileSize, FClusteredLightCuller::NumDepthSlices);
+	UE_LOG("[LightCullingBenchmark] %-26s %10s %10s %8s %9s %9s %7s %7s", "Scenario", "Old(ms)", "New(ms)", "Speedup", "OldKB", "NewKB", "L/Tile", "L/Clus");
+
+	for (const uint32* Resolution : Resolutions)
+	{
+		const float Aspect = static_cast<float>(Resolution[0]) / static_cast<float>(Resolution[1]);
+		const FMatrix ProjMatrix = FMatrix::PerspectiveFovLH(DegreesToRadians(60.0f), Aspect, NearPlane, FarPlane);
+
+		for (int32 NumLights : LightCounts)
+		{
+			MakeLights(NumLights, Aspect, PointLights, SpotLights);
+
+			FScenarioResult Result;
+			Result.NumLights = NumLights;
+			Result.Width = Resolution[0];
+			Result.Height = Resolution[1];
+
+			Result.LegacyMS = MeasureMS(NumLegacyIterations, [&]()
+			{
+				LegacyCuller.CullLights(PointLights, SpotLights, ViewMatrix, ProjMatrix, Resolution[0], Resolution[1]);
+			});
+
+			// 첫 실행은 슬라이스 작업 배열 할당이 섞이므로 측정에서 제외
+			ClusteredCuller.BuildClusters(PointLights, SpotLights, ViewMatrix, ProjMatrix, NearPlane, FarPlane, Resolution[0], Resolution[1]);
+			Result.NewMS = MeasureMS(NumIterations, [&]()
+			{
+				ClusteredCuller.BuildClusters(PointLights, SpotLights, ViewMatrix, ProjMatrix, NearPlane, FarPlane, Resolution[0], Resolution[1]);
+			});
+
+			const FTileCullingStats& Stats = ClusteredCuller.GetStats();
+			Result.LegacyBufferBytes = LegacyCuller.GetBufferSizeBytes();
+			Result.NewBufferBytes = static_cast<uint32>(ClusteredCuller.GetClusterData().Num()) * sizeof(uint32);
+			Result.LegacyLightsPerTile = static_cast<float>(LegacyCuller.GetTotalLightsPassed()) / static_cast<float>(std::max(1u, LegacyCuller.GetTotalTileCount()));
+			Result.NewLightsPerCluster = Stats.AvgLightsPerCluster;
+
+			LogScenario(Result);
+			Results.Add(Result);
+		}
+	}
+
+	if (!ReportPath.empty())
+	{
+		WriteReport(ReportPath, Results);
+	}
+}
+
+// 라이트 컬링 벤치마크는 CPU 컬링만 측정하므로 디바이스/월드 없이 실행
+static const bool bLightCullingBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"LIGHTCULL BENCH", "-lightcullbench", "light culling benchmark (legacy per-tile frustum test vs clustered culler)", EBenchmarkStage::None,
+	[](const FString& ReportPath) { FLightCullingBenchmark::RunAndLog(ReportPath); } });
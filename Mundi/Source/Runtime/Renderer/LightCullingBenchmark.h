@@ -0,0 +1,16 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 라이트 컬링 벤치마크 (콘솔 LIGHTCULL BENCH 명령, 헤드리스 -lightcullbench)
+ *
+ * 같은 라이트 배치(Point 3/4, Spot 1/4)를 이전 타일 컬러(타일마다 전체 라이트 x 6평면 테스트)와
+ * FClusteredLightCuller에 넣고 라이트 수(64/256/1024) x 해상도(720p/1080p/4K)별 CPU 컬링 시간과 인덱스 버퍼 크기를 비교합니다.
+ * GPU 업로드는 측정하지 않으므로 렌더러 없이 실행됩니다.
+ */
+class FLightCullingBenchmark
+{
+public:
+	/** @param ReportPath 비어 있지 않으면 시나리오별 결과를 JSON으로도 저장 */
+	static void RunAndLog(const FString& ReportPath = "");
+};
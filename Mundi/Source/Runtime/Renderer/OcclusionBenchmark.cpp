@@ -0,0 +1,187 @@
+#include "pch.h"
+#include "OcclusionBenchmark.h"
+#include "Occlusion.h"
+#include "World.h"
+#include "MeshComponent.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+
+namespace
+{
+	constexpr int32 NumViews = 8;
+	constexpr float FieldOfViewDegrees = 60.0f;
+	constexpr float AspectRatio = 16.0f / 9.0f;
+	constexpr float NearPlane = 0.1f;
+	constexpr int32 NumIterations = 10;
+
+	struct FViewResult
+	{
+		int32 ViewIndex = 0;
+		FOcclusionStats Stats;      // 깊이를 새로 만든 프레임 (히스테리시스 워밍업 이후)
+		double RebuildMS = 0.0;     // 오클루더 래스터라이즈 + HZB + 판정 평균
+		double ReuseMS = 0.0;       // 같은 뷰에서 깊이 재사용 시 평균
+	};
+
+	void LogView(const FViewResult& Result)
+	{
+		const FOcclusionStats& Stats = Result.Stats;
+		UE_LOG("[OcclusionBenchmark] view %d %9u %9u %7u %7u %7u %7.1f%% %8.3f %8.3f %8.3f %9.3f %9.3f", Result.ViewIndex,
+			Stats.NumOccluders, Stats.NumOccluderTriangles, Stats.NumTested, Stats.NumOffscreen, Stats.NumOccluded, Stats.GetCulledPercent(),
+			Stats.RasterTimeMS, Stats.HZBTimeMS, Stats.TestTimeMS, Result.RebuildMS, Result.ReuseMS);
+	}
+
+	void WriteReport(const FString& ReportPath, int32 NumMeshes, const TArray<FViewResult>& Results)
+	{
+		std::ofstream File(UTF8ToWide(ReportPath));
+		if (!File.is_open())
+		{
+			UE_LOG("[error] OcclusionBenchmark: failed to open %s", ReportPath.c_str());
+			return;
+		}
+		File.setf(std::ios::fixed);
+		File.precision(4);
+
+		File << "{\n  \"meshes\": " << NumMeshes
+			<< ",\n  \"gridWidth\": " << FOcclusionCullingManagerCPU::DefaultGridWidth
+			<< ",\n  \"gridHeight\": " << FOcclusionCullingManagerCPU::DefaultGridHeight
+			<< ",\n  \"views\": [";
+		for (int32 Index = 0; Index < Results.Num(); ++Index)
+		{
+			const FViewResult& Result = Results[Index];
+			const FOcclusionStats& Stats = Result.Stats;
+			File << (Index == 0 ? "\n" : ",\n")
+				<< "    { \"view\": " << Result.ViewIndex
+				<< ", \"occluders\": " << Stats.NumOccluders
+				<< ", \"occluderTriangles\": " << Stats.NumOccluderTriangles
+				<< ", \"tested\": " << Stats.NumTested
+				<< ", \"offscreen\": " << Stats.NumOffscreen
+				<< ", \"occluded\": " << Stats.NumOccluded
+				<< ", \"culledPercent\": " << Stats.GetCulledPercent()
+				<< ", \"rasterMs\": " << Stats.RasterTimeMS
+				<< ", \"hzbMs\": " << Stats.HZBTimeMS
+				<< ", \"testMs\": " << Stats.TestTimeMS
+				<< ", \"rebuildMs\": " << Result.RebuildMS
+				<< ", \"reuseMs\": " << Result.ReuseMS << " }";
+		}
+		File << "\n  ]\n}\n";
+		UE_LOG("[OcclusionBenchmark] report -> %s", ReportPath.c_str());
+	}
+}
+
+void FOcclusionBenchmark::RunAndLog(UWorld* World, const FString& ReportPath)
+{
+	if (!World)
+	{
+		UE_LOG("[error] OcclusionBenchmark: no world");
+		return;
+	}
+
+	// 렌더러가 Proxies.Meshes로 모으는 것과 같은 대상 (보이는 메시 컴포넌트)
+	TArray<UMeshComponent*> Meshes;
+	FVector LevelMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector LevelMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (UMeshComponent* MeshComponent : World->GetComponentsOfClass<UMeshComponent>())
+	{
+		if (!MeshComponent->IsVisible())
+		{
+			continue;
+		}
+		Meshes.Add(MeshComponent);
+
+		const FAABB Bound = MeshComponent->GetWorldAABB();
+		if (Bound.Min.X < Bound.Max.X || Bound.Min.Y < Bound.Max.Y || Bound.Min.Z < Bound.Max.Z)
+		{
+			LevelMin = FVector(std::min(LevelMin.X, Bound.Min.X), std::min(LevelMin.Y, Bound.Min.Y), std::min(LevelMin.Z, Bound.Min.Z));
+			LevelMax = FVector(std::max(LevelMax.X, Bound.Max.X), std::max(LevelMax.Y, Bound.Max.Y), std::max(LevelMax.Z, Bound.Max.Z));
+		}
+	}
+	if (Meshes.IsEmpty() || LevelMin.X > LevelMax.X)
+	{
+		UE_LOG("[error] OcclusionBenchmark: world has no mesh with bounds");
+		return;
+	}
+
+	// 레벨 바운드 가장자리, 물체 높이의 중간에서 중심을 바라보는 시점들 (앞줄이 뒷줄을 가리는 배치)
+	const FVector Center = (LevelMin + LevelMax) * 0.5f;
+	const FVector HalfExtent = (LevelMax - LevelMin) * 0.5f;
+	const float Radius = std::max(std::max(HalfExtent.X, HalfExtent.Y), 1.0f) * 1.05f;
+	const float FarPlane = std::max(1000.0f, Radius * 4.0f);
+	const FMatrix ProjMatrix = FMatrix::PerspectiveFovLH(DegreesToRadians(FieldOfViewDegrees), AspectRatio, NearPlane, FarPlane);
+
+	UE_LOG("[OcclusionBenchmark] %d meshes, grid %dx%d, %d views around level bounds", Meshes.Num(),
+		FOcclusionCullingManagerCPU::DefaultGridWidth, FOcclusionCullingManagerCPU::DefaultGridHeight, NumViews);
+	UE_LOG("[OcclusionBenchmark] %-6s %9s %9s %7s %7s %7s %8s %8s %8s %8s %9s %9s", "View", "Occluders", "OccTris", "Tested",
+		"Offscrn", "Occl", "Culled", "Raster", "HZB", "Test", "Full(ms)", "Reuse(ms)");
+
+	TArray<FViewResult> Results;
+	TArray<UMeshComponent*> WorkingMeshes;
+	FViewResult Total;
+	for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+	{
+		const float Angle = 2.0f * PI * static_cast<float>(ViewIndex) / static_cast<float>(NumViews);
+		const FVector Eye = Center + FVector(std::cos(Angle) * Radius, std::sin(Angle) * Radius, 0.0f);
+		const FMatrix ViewMatrix = FMatrix::LookAtLH(Eye, Center, FVector(0.0f, 0.0f, 1.0f));
+
+		// 시점마다 새 컬러 (이전 시점의 히스테리시스 상태가 섞이지 않도록)
+		std::unique_ptr<FOcclusionCullingManagerCPU> Culler = std::make_unique<FOcclusionCullingManagerCPU>();
+		Culler->Initialize();
+
+		auto RunFrame = [&](const FMatrix& InViewMatrix)
+		{
+			WorkingMeshes = Meshes;
+			Culler->SetView(InViewMatrix, ProjMatrix, NearPlane, FarPlane);
+			Culler->CullMeshes(WorkingMeshes);
+		};
+
+		// 워밍업: 연속 가림 프레임이 쌓여야 실제로 컬링됨
+		for (int32 Frame = 0; Frame < FOcclusionCullingManagerCPU::OccludedFramesToCull; ++Frame)
+		{
+			RunFrame(ViewMatrix);
+		}
+
+		// 깊이를 매번 새로 만들도록 뷰를 미세하게 흔들어 재사용 경로를 피함
+		FViewResult Result;
+		Result.ViewIndex = ViewIndex;
+		int32 NumJitters = 0;
+		Result.RebuildMS = MeasureMS(NumIterations, [&]()
+		{
+			const FVector JitteredEye = Eye + FVector(0.0f, 0.0f, 1e-3f * static_cast<float>(++NumJitters));
+			RunFrame(FMatrix::LookAtLH(JitteredEye, Center, FVector(0.0f, 0.0f, 1.0f)));
+		});
+		Result.Stats = Culler->GetStats();
+
+		// 같은 뷰를 반복하면 깊이 그리드/HZB를 재사용하고 판정만 수행
+		RunFrame(ViewMatrix);
+		Result.ReuseMS = MeasureMS(NumIterations, [&]() { RunFrame(ViewMatrix); });
+
+		LogView(Result);
+		Results.Add(Result);
+
+		Total.Stats.NumOccluders += Result.Stats.NumOccluders;
+		Total.Stats.NumOccluderTriangles += Result.Stats.NumOccluderTriangles;
+		Total.Stats.NumTested += Result.Stats.NumTested;
+		Total.Stats.NumOffscreen += Result.Stats.NumOffscreen;
+		Total.Stats.NumOccluded += Result.Stats.NumOccluded;
+		Total.Stats.RasterTimeMS += Result.Stats.RasterTimeMS / NumViews;
+		Total.Stats.HZBTimeMS += Result.Stats.HZBTimeMS / NumViews;
+		Total.Stats.TestTimeMS += Result.Stats.TestTimeMS / NumViews;
+		Total.RebuildMS += Result.RebuildMS / NumViews;
+		Total.ReuseMS += Result.ReuseMS / NumViews;
+	}
+
+	// 개수는 시점 합계, 시간은 시점 평균
+	UE_LOG("[OcclusionBenchmark] total  %9u %9u %7u %7u %7u %7.1f%% %8.3f %8.3f %8.3f %9.3f %9.3f",
+		Total.Stats.NumOccluders, Total.Stats.NumOccluderTriangles, Total.Stats.NumTested, Total.Stats.NumOffscreen,
+		Total.Stats.NumOccluded, Total.Stats.GetCulledPercent(), Total.Stats.RasterTimeMS, Total.Stats.HZBTimeMS,
+		Total.Stats.TestTimeMS, Total.RebuildMS, Total.ReuseMS);
+
+	if (!ReportPath.empty())
+	{
+		WriteReport(ReportPath, Meshes.Num(), Results);
+	}
+}
+
+// 오클루전 벤치마크는 Tick 없이 로드된 배치 그대로 측정
+static const bool bOcclusionBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"OCCLUSION BENCH", "-occlusionbench", "CPU occlusion culling benchmark on the current world", EBenchmarkStage::PlayingWorld,
+	[](const FString& ReportPath) { FOcclusionBenchmark::RunAndLog(GWorld, ReportPath); } });
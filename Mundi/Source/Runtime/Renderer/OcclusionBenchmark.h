@@ -0,0 +1,18 @@
+#pragma once
+#include "UEContainer.h"
+
+class UWorld;
+
+/**
+ * @brief CPU 오클루전 컬링 벤치마크 (콘솔 OCCLUSION BENCH 명령, 헤드리스 -occlusionbench)
+ *
+ * 월드의 메시 컴포넌트를 대상으로 레벨 바운드 둘레의 여러 시점에서 FOcclusionCullingManagerCPU를 돌리고
+ * 시점별 오클루더/삼각형 수, 컬링 비율과 래스터라이즈/HZB/판정 시간을 기록합니다.
+ * 캡처한 씬(-scene=)이나 기준 씬(-bench=)을 그대로 쓰며 GPU를 쓰지 않으므로 렌더러 없이 실행됩니다.
+ */
+class FOcclusionBenchmark
+{
+public:
+	/** @param ReportPath 비어 있지 않으면 시점별 결과를 JSON으로도 저장 */
+	static void RunAndLog(UWorld* World, const FString& ReportPath = "");
+};
@@ -0,0 +1,100 @@
+#pragma once
+#include "UEContainer.h"
+
+// CPU 소프트웨어 오클루전 컬링 통계 (FOcclusionCullingManagerCPU)
+struct FOcclusionStats
+{
+	// 오클루더
+	uint32 NumOccluders = 0;            // 래스터라이즈한 오클루더 수
+	uint32 NumOccluderTriangles = 0;    // 래스터라이즈한 삼각형 수 (근평면에 걸친 삼각형 제외)
+	bool bReusedDepth = false;          // 뷰/오클루더가 그대로여서 직전 프레임 깊이 그리드를 재사용했는지
+
+	// 오클루디
+	uint32 NumTested = 0;               // 판정한 메시 수
+	uint32 NumOffscreen = 0;            // 화면 밖 (근평면 뒤 포함)
+	uint32 NumOccluded = 0;             // HZB에 가려져서 컬링된 수 (히스테리시스 적용 후)
+	uint32 NumVisible = 0;
+
+	// 성능 메트릭
+	float RasterTimeMS = 0.0f;
+	float HZBTimeMS = 0.0f;
+	float TestTimeMS = 0.0f;
+	float TotalTimeMS = 0.0f;
+
+	uint32 GetNumCulled() const { return NumOffscreen + NumOccluded; }
+
+	float GetCulledPercent() const
+	{
+		return NumTested > 0 ? static_cast<float>(GetNumCulled()) * 100.0f / static_cast<float>(NumTested) : 0.0f;
+	}
+
+	void Reset()
+	{
+		*this = FOcclusionStats();
+	}
+};
+
+// 뷰 절두체 컬링 통계 (FPrimitiveBoundsSoA, 오클루전 컬링 전 단계)
+struct FFrustumCullingStats
+{
+	uint32 NumPrimitives = 0;           // SoA에 등록된 프리미티브 수
+	uint32 NumBoundsUpdated = 0;        // 이번 뷰에서 FlushDirty로 다시 읽은 바운드 수
+	uint32 NumVisible = 0;              // 절두체 안 프리미티브 수
+	uint32 NumMeshes = 0;               // 절두체를 통과해서 그릴 메시 수
+	uint32 NumShadowCasters = 0;        // 그림자 패스 캐스터 수 (화면 밖 포함)
+	float TimeMS = 0.0f;
+
+	void Reset()
+	{
+		*this = FFrustumCullingStats();
+	}
+};
+
+// 가시성 컬링(절두체 + 오클루전) 통계 전역 매니저 (싱글톤)
+// 뷰포트가 여러 개면 마지막으로 그린 뷰의 통계
+class FOcclusionStatManager
+{
+public:
+	static FOcclusionStatManager& GetInstance()
+	{
+		static FOcclusionStatManager Instance;
+		return Instance;
+	}
+
+	// 통계 업데이트
+	void UpdateStats(const FOcclusionStats& InStats)
+	{
+		CurrentStats = InStats;
+	}
+
+	void UpdateFrustumStats(const FFrustumCullingStats& InStats)
+	{
+		CurrentFrustumStats = InStats;
+	}
+
+	// 통계 조회
+	const FOcclusionStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	const FFrustumCullingStats& GetFrustumStats() const
+	{
+		return CurrentFrustumStats;
+	}
+
+	// 통계 리셋 (오클루전만, 절두체 통계는 매 뷰 UpdateFrustumStats로 덮어씀)
+	void ResetStats()
+	{
+		CurrentStats.Reset();
+	}
+
+private:
+	FOcclusionStatManager() = default;
+	~FOcclusionStatManager() = default;
+	FOcclusionStatManager(const FOcclusionStatManager&) = delete;
+	FOcclusionStatManager& operator=(const FOcclusionStatManager&) = delete;
+
+	FOcclusionStats CurrentStats;
+	FFrustumCullingStats CurrentFrustumStats;
+};
@@ -19,7 +19,6 @@
 #include "Grid/GridActor.h"
 #include "Octree.h"
 #include "BVHierarchy.h"
-#include "Occlusion.h"
 #include "Frustum.h"
 #include "ResourceManager.h"
 #include "RHIDevice.h"
@@ -33,15 +32,22 @@
 #include "SceneView.h"
 #include "SkinningStats.h"
 #include "PlatformTime.h"
+#include "ClusteredLightCuller.h"
 
 #include <Windows.h>
 #include "DirectionalLightComponent.h"
+
+DECLARE_CYCLE_STAT(GPUDrawTime, "GPU")
+
 URenderer::URenderer(D3D11RHI* InDevice) : RHIDevice(InDevice)
 {
 	InitializeLineBatch();
 
 	// GPU 타이머 초기화 (스키닝 성능 측정용)
 	FSkinningStatManager::GetInstance().InitializeGPUTimer(RHIDevice->GetDevice());
+
+	LightCuller = std::make_unique<FClusteredLightCuller>();
+	LightCuller->Initialize(RHIDevice);
 }
 
 URenderer::~URenderer()
@@ -80,7 +86,7 @@ void URenderer::BeginFrame()
 	// TimeProfile 시스템에 GPU Draw Time 추가 (프로파일링 통합)
 	if (LastGPUDrawTimeMS >= 0.0)
 	{
-		FScopeCycleCounter::AddTimeProfile(TStatId("GPUDrawTime"), LastGPUDrawTimeMS);
+		FProfiler::AddTime(STAT_GPUDrawTime, LastGPUDrawTimeMS);
 	}
 
 	// 프레임 단위 스키닝 통계 리셋
@@ -108,7 +114,7 @@ void URenderer::EndFrame()
 void URenderer::RenderSceneForView(UWorld* World, FSceneView* View, FViewport* Viewport)
 {
 	// 씬을 그리는 FSceneRenderer 를 생성합니다.
-	FSceneRenderer SceneRenderer(World, View, this);
+	FSceneRenderer SceneRenderer(World, View, this, Viewport);
 
 	// 실제로 렌더를 수행합니다.
 	SceneRenderer.Render();
@@ -12,6 +12,7 @@ class UBillboardComponent;
 class UPrimitiveComponent;
 class UCameraComponent;
 class FSceneView;
+class FClusteredLightCuller;
 
 struct FMaterialSlot;
 
@@ -52,6 +53,9 @@ public:
 	// Deferred buffer release system (GPU-safe resource management)
 	void DeferredReleaseBuffer(ID3D11Buffer* Buffer);
 
+	// 클러스터 라이트 컬러 (FSceneRenderer는 뷰마다 새로 만들어지므로 워커 스레드/GPU 버퍼를 여기서 유지)
+	FClusteredLightCuller* GetLightCuller() const { return LightCuller.get(); }
+
 private:
 	// Deferred release structure
 	struct FDeferredRelease
@@ -89,5 +93,7 @@ private:
 	ID3D11ShaderResourceView* PreSRV = nullptr;*/
 
 	ACameraActor* CurrentCamera = nullptr;
+
+	std::unique_ptr<FClusteredLightCuller> LightCuller;
 };
 
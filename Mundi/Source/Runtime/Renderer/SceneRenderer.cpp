@@ -4,6 +4,7 @@
 // FSceneRenderer가 사용하는 모든 헤더 포함
 #include "World.h"
 #include "CameraActor.h"
+#include "CameraComponent.h"
 #include "FViewport.h"
 #include "FViewportClient.h"
 #include "Renderer.h"
@@ -18,6 +19,7 @@
 #include "Frustum.h"
 #include "WorldPartitionManager.h"
 #include "BVHierarchy.h"
+#include "PrimitiveBoundsSoA.h"
 #include "SelectionManager.h"
 #include "StaticMeshComponent.h"
 #include "DecalStatManager.h"
@@ -41,10 +43,11 @@
 #include "ResourceManager.h"
 #include "../RHI/ConstantBufferType.h"
 #include <chrono>
-#include "TileLightCuller.h"
+#include "ClusteredLightCuller.h"
 #include "LineComponent.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
+#include "OcclusionStats.h"
 #include "PlatformTime.h"
 #include "PostProcessing/VignettePass.h"
 #include "FbxLoader.h"
@@ -59,18 +62,30 @@
 #include "Modules/ParticleModuleTypeDataBeam.h"
 #include "Modules/ParticleModuleTypeDataRibbon.h"
 
-FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer)
+DECLARE_CYCLE_STAT(SceneRender, "Renderer")
+DECLARE_CYCLE_STAT(GatherVisibleProxies, "Renderer")
+DECLARE_CYCLE_STAT(ShadowMapPass, "Renderer")
+DECLARE_CYCLE_STAT(FrustumCulling, "Renderer")
+DECLARE_CYCLE_STAT(OcclusionCulling, "Renderer")
+
+namespace
+{
+	// 소유 액터와 컴포넌트가 모두 보이는 상태인지 (레벨 컴포넌트 수집 공통 조건)
+	bool IsComponentRenderable(const USceneComponent* Component)
+	{
+		const AActor* Owner = Component->GetOwner();
+		return Component->IsVisible() && Owner && Owner->IsActorVisible() && Owner->IsActorActive();
+	}
+}
+
+FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer, FViewport* InViewport)
 	: World(InWorld)
 	, View(InView) // 전달받은 FSceneView 저장
 	, OwnerRenderer(InOwnerRenderer)
 	, RHIDevice(InOwnerRenderer->GetRHIDevice())
 {
-	//OcclusionCPU = std::make_unique<FOcclusionCullingManagerCPU>();
-
-	// 타일 라이트 컬러 초기화
-	TileLightCuller = std::make_unique<FTileLightCuller>();
-	uint32 TileSize = World->GetRenderSettings().GetTileSize();
-	TileLightCuller->Initialize(RHIDevice, TileSize);
+	// 프레임 간 상태는 뷰포트가 소유 (뷰포트 없이 그리는 뷰는 오클루전 컬링 안 함)
+	OcclusionCPU = InViewport ? InViewport->GetOcclusionCuller() : nullptr;
 
 	// 라인 수집 시작
 	OwnerRenderer->BeginLineBatch();
@@ -86,6 +101,7 @@ FSceneRenderer::~FSceneRenderer()
 void FSceneRenderer::Render()
 {
     if (!IsValid()) return;
+	SCOPE_CYCLE_COUNTER(SceneRender)
 
 	// 스키닝 통계 리셋 및 GPU 시간 조회는 Renderer::BeginFrame()으로 이동됨
 	// 각 뷰어는 통계를 누적만 함
@@ -100,11 +116,26 @@ void FSceneRenderer::Render()
     PrepareView();
     // (Background is cleared per-path when binding service color)
     // 렌더링할 대상 수집 (Cull + Gather)
-    GatherVisibleProxies();
+    {
+        SCOPE_CYCLE_COUNTER(GatherVisibleProxies)
+        GatherVisibleProxies();
+    }
 
-	TIME_PROFILE(ShadowMapPass)
-	RenderShadowMaps();
-	TIME_PROFILE_END(ShadowMapPass)
+	{
+		SCOPE_CYCLE_COUNTER(FrustumCulling)
+		PerformFrustumCulling();
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(ShadowMapPass)
+		RenderShadowMaps();
+	}
+
+	// 오클루전은 카메라 기준이므로 그림자 캐스터 목록(Proxies.ShadowCasters)과 무관하게 화면 메시만 줄임
+	{
+		SCOPE_CYCLE_COUNTER(OcclusionCulling)
+		PerformOcclusionCulling();
+	}
 	
 	// ViewMode에 따라 렌더링 경로 결정
 	if (View->RenderSettings->GetViewMode() == EViewMode::VMI_Lit_Phong ||
@@ -112,7 +143,7 @@ void FSceneRenderer::Render()
 		View->RenderSettings->GetViewMode() == EViewMode::VMI_Lit_Lambert)
 	{
 		World->GetLightManager()->UpdateLightBuffer(RHIDevice);
-		PerformTileLightCulling();	// 타일 기반 라이트 컬링 수행
+		PerformTileLightCulling();	// 클러스터 기반 라이트 컬링 수행
 		RenderLitPath();
 		RenderPostProcessingPasses();	// 후처리 체인 실행
 		RenderTileCullingDebug();	// 타일 컬링 디버그 시각화 draw
@@ -308,14 +339,11 @@ void FSceneRenderer::RenderShadowMaps()
     FLightManager* LightManager = World->GetLightManager();
 	if (!LightManager) return;
 
-	// 2. 그림자 캐스터(Caster) 메시 수집
+	// 2. 그림자 캐스터(Caster) 메시 수집 (GatherVisibleProxies에서 화면 밖까지 포함해 모은 목록)
 	TArray<FMeshBatchElement> ShadowMeshBatches;
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	for (UMeshComponent* MeshComponent : Proxies.ShadowCasters)
 	{
-		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
-		{
-			MeshComponent->CollectMeshBatches(ShadowMeshBatches, View);
-		}
+		MeshComponent->CollectMeshBatches(ShadowMeshBatches, View);
 	}
 
 	// NOTE: 카메라 오버라이드 기능을 항상 활성화 하기 위해서 그림자를 그릴 곳이 없어도 함수 실행
@@ -539,8 +567,8 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 	// GPU 스키닝용 셰이더 variant
 	TArray<FShaderMacro> GPUSkinningMacros;
 	FShaderMacro GPUSkinningMacro;
-	GPUSkinningMacro.Name = FName("GPU_SKINNING");
-	GPUSkinningMacro.Definition = FName("1");
+	GPUSkinningMacro.Name = FNAME_LITERAL("GPU_SKINNING");
+	GPUSkinningMacro.Definition = FNAME_LITERAL("1");
 	GPUSkinningMacros.Add(GPUSkinningMacro);
 	FShaderVariant* GPUSkinningShaderVariant = DepthVS->GetOrCompileShaderVariant(GPUSkinningMacros);
 
@@ -713,12 +741,9 @@ void FSceneRenderer::PrepareView()
 
 void FSceneRenderer::GatherVisibleProxies()
 {
-	// NOTE: 일단 컴포넌트 단위와 데칼 관련 이슈 해결까지 컬링 무시
-	//// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleActors에 저장됨
-	//PerformFrustumCulling();
+	// NOTE: 메시는 액터를 순회하지 않고 PerformFrustumCulling이 SoA 가시 인덱스로 모은다.
+	// 여기서는 레벨 클래스 인덱스(UWorld::GetComponentsOfClass)로 메시 외 대상과 그림자 캐스터만 모음
 
-	const bool bDrawStaticMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
-	const bool bDrawSkeletalMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_SkeletalMeshes);
 	const bool bDrawDecals = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Decals);
 	const bool bDrawFog = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Fog);
 	const bool bDrawLight = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Lighting);
@@ -726,127 +751,140 @@ void FSceneRenderer::GatherVisibleProxies()
 	const bool bUseBillboard = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Billboard);
 	const bool bUseIcon = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_EditorIcon);
 
-	// Helper lambda to collect components from an actor
-	auto CollectComponentsFromActor = [&](AActor* Actor, bool bIsEditorActor)
+	// 엔진 에디터 액터 (기즈모, 그리드 등)는 레벨 인덱스에 없으므로 직접 순회 (몇 개뿐)
+	for (AActor* EditorActor : World->GetEditorActors())
+	{
+		if (!EditorActor || !EditorActor->IsActorVisible() || !EditorActor->IsActorActive())
+		{
+			continue;
+		}
+
+		for (USceneComponent* Component : EditorActor->GetSceneComponents())
 		{
-			if (!Actor || !Actor->IsActorVisible() || !Actor->IsActorActive())
+			if (!Component || !Component->IsVisible())
 			{
-				return;
+				continue;
 			}
 
-			for (USceneComponent* Component : Actor->GetSceneComponents())
+			if (UGizmoArrowComponent* GizmoComponent = Cast<UGizmoArrowComponent>(Component))
 			{
-				if (!Component || !Component->IsVisible())
-				{
-					continue;
-				}
-
-				// 엔진 에디터 액터 컴포넌트
-				if (bIsEditorActor)
-				{
-					if (UGizmoArrowComponent* GizmoComponent = Cast<UGizmoArrowComponent>(Component))
-					{
-						Proxies.OverlayPrimitives.Add(GizmoComponent);
-					}
-					else if (ULineComponent* LineComponent = Cast<ULineComponent>(Component))
-					{
-						Proxies.EditorLines.Add(LineComponent);
-					}
-
-					continue;
-				}
+				Proxies.OverlayPrimitives.Add(GizmoComponent);
+			}
+			else if (ULineComponent* LineComponent = Cast<ULineComponent>(Component))
+			{
+				Proxies.EditorLines.Add(LineComponent);
+			}
+		}
+	}
 
-				if (UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component); PrimitiveComponent)
-				{
-					// 에디터 보조 컴포넌트 (빌보드 등)
-					if (!PrimitiveComponent->IsEditable())
-					{
-						if (bUseIcon)
-						{
-							Proxies.EditorPrimitives.Add(PrimitiveComponent);
-						}
-						continue;
-					}
+	// 에디터 보조 컴포넌트 (CREATE_EDITOR_COMPONENT로 만든 아이콘 빌보드, 라이트 방향 기즈모, 카메라 기즈모)
+	if (bUseIcon)
+	{
+		for (UBillboardComponent* BillboardComponent : World->GetComponentsOfClass<UBillboardComponent>())
+		{
+			if (!BillboardComponent->IsEditable() && IsComponentRenderable(BillboardComponent))
+			{
+				Proxies.EditorPrimitives.Add(BillboardComponent);
+			}
+		}
+		for (UGizmoArrowComponent* GizmoComponent : World->GetComponentsOfClass<UGizmoArrowComponent>())
+		{
+			if (!GizmoComponent->IsEditable() && IsComponentRenderable(GizmoComponent))
+			{
+				Proxies.EditorPrimitives.Add(GizmoComponent);
+			}
+		}
+		for (UCameraComponent* CameraComponent : World->GetComponentsOfClass<UCameraComponent>())
+		{
+			UStaticMeshComponent* CameraGizmo = CameraComponent->GetCameraGizmo();
+			if (CameraGizmo && IsComponentRenderable(CameraGizmo))
+			{
+				Proxies.EditorPrimitives.Add(CameraGizmo);
+			}
+		}
+	}
 
-					// 일반 컴포넌트
-					if (UMeshComponent* MeshComponent = Cast<UMeshComponent>(PrimitiveComponent))
-					{
-						bool bShouldAdd = true;
-
-						// 메시 타입이 '스태틱 메시'인 경우에만 ShowFlag를 검사하여 추가 여부를 결정
-						if (MeshComponent->IsA(UStaticMeshComponent::StaticClass()))
-						{
-							bShouldAdd = bDrawStaticMeshes;
-						}
-						else if (MeshComponent->IsA(USkinnedMeshComponent::StaticClass()))
-						{
-						    bShouldAdd = bDrawSkeletalMeshes;
-						}
-
-						if (bShouldAdd)
-						{
-							Proxies.Meshes.Add(MeshComponent);
-						}
-					}
-					else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent); BillboardComponent && bUseBillboard)
-					{
-						Proxies.Billboards.Add(BillboardComponent);
-					}
-					else if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(PrimitiveComponent); DecalComponent && bDrawDecals)
-					{
-						Proxies.Decals.Add(DecalComponent);
-					}
-					else if (UParticleSystemComponent* ParticleSystemComponent = Cast<UParticleSystemComponent>(PrimitiveComponent))
-					{
-						Proxies.ParticleSystems.Add(ParticleSystemComponent);
-					}
-					else if (ULineComponent* LineComponent = Cast<ULineComponent>(PrimitiveComponent))
-					{
-						Proxies.EditorLines.Add(LineComponent);
-					}
-				}
-				else
-				{
-					if (UHeightFogComponent* FogComponent = Cast<UHeightFogComponent>(Component); FogComponent && bDrawFog)
-					{
-						SceneGlobals.Fogs.Add(FogComponent);
-					}
+	if (bUseBillboard)
+	{
+		for (UBillboardComponent* BillboardComponent : World->GetComponentsOfClass<UBillboardComponent>())
+		{
+			if (BillboardComponent->IsEditable() && IsComponentRenderable(BillboardComponent))
+			{
+				Proxies.Billboards.Add(BillboardComponent);
+			}
+		}
+	}
 
-					else if (UDirectionalLightComponent* LightComponent = Cast<UDirectionalLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						SceneGlobals.DirectionalLights.Add(LightComponent);
-					}
+	if (bDrawDecals)
+	{
+		for (UDecalComponent* DecalComponent : World->GetComponentsOfClass<UDecalComponent>())
+		{
+			if (DecalComponent->IsEditable() && IsComponentRenderable(DecalComponent))
+			{
+				Proxies.Decals.Add(DecalComponent);
+			}
+		}
+	}
 
-					else if (UAmbientLightComponent* LightComponent = Cast<UAmbientLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						SceneGlobals.AmbientLights.Add(LightComponent);
-					}
+	for (UParticleSystemComponent* ParticleSystemComponent : World->GetComponentsOfClass<UParticleSystemComponent>())
+	{
+		if (ParticleSystemComponent->IsEditable() && IsComponentRenderable(ParticleSystemComponent))
+		{
+			Proxies.ParticleSystems.Add(ParticleSystemComponent);
+		}
+	}
 
-					else if (UPointLightComponent* LightComponent = Cast<UPointLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						if (USpotLightComponent* SpotLightComponent = Cast<USpotLightComponent>(LightComponent); SpotLightComponent)
-						{
-							SceneLocals.SpotLights.Add(SpotLightComponent);
-						}
-						else
-						{
-							SceneLocals.PointLights.Add(LightComponent);
-						}
-					}
-				}
-			}
-		};
+	for (ULineComponent* LineComponent : World->GetComponentsOfClass<ULineComponent>())
+	{
+		if (LineComponent->IsEditable() && IsComponentRenderable(LineComponent))
+		{
+			Proxies.EditorLines.Add(LineComponent);
+		}
+	}
 
-	// Collect from Editor Actors (Gizmo, Grid, etc.)
-	for (AActor* EditorActor : World->GetEditorActors())
+	if (bDrawFog)
 	{
-		CollectComponentsFromActor(EditorActor, true);
+		for (UHeightFogComponent* FogComponent : World->GetComponentsOfClass<UHeightFogComponent>())
+		{
+			if (IsComponentRenderable(FogComponent))
+			{
+				SceneGlobals.Fogs.Add(FogComponent);
+			}
+		}
 	}
 
-	// Collect from Level Actors (including their Gizmo components)
-	for (AActor* Actor : World->GetActors())
+	if (bDrawLight)
 	{
-		CollectComponentsFromActor(Actor, false);
+		for (UDirectionalLightComponent* LightComponent : World->GetComponentsOfClass<UDirectionalLightComponent>())
+		{
+			if (IsComponentRenderable(LightComponent))
+			{
+				SceneGlobals.DirectionalLights.Add(LightComponent);
+			}
+		}
+		for (UAmbientLightComponent* LightComponent : World->GetComponentsOfClass<UAmbientLightComponent>())
+		{
+			if (IsComponentRenderable(LightComponent))
+			{
+				SceneGlobals.AmbientLights.Add(LightComponent);
+			}
+		}
+		// 스팟 라이트도 포인트 라이트 클래스 쿼리에 포함되므로 한 번만 순회해서 나눔
+		for (UPointLightComponent* LightComponent : World->GetComponentsOfClass<UPointLightComponent>())
+		{
+			if (!IsComponentRenderable(LightComponent))
+			{
+				continue;
+			}
+			if (USpotLightComponent* SpotLightComponent = Cast<USpotLightComponent>(LightComponent))
+			{
+				SceneLocals.SpotLights.Add(SpotLightComponent);
+			}
+			else
+			{
+				SceneLocals.PointLights.Add(LightComponent);
+			}
+		}
 	}
 
 	// 라이트 통계 업데이트
@@ -895,16 +933,48 @@ void FSceneRenderer::GatherVisibleProxies()
 
 	ShadowStats.CalculateTotal();
 	FShadowStatManager::GetInstance().UpdateStats(ShadowStats);
+
+	// 그림자 캐스터는 화면 밖 메시도 포함해야 하므로 절두체 결과와 별도 목록 (그림자를 드리우는 라이트가 있을 때만)
+	if (ShadowStats.TotalShadowCastingLights > 0)
+	{
+		for (UMeshComponent* MeshComponent : World->GetComponentsOfClass<UMeshComponent>())
+		{
+			if (MeshComponent->IsCastShadows() && MeshComponent->IsEditable() && IsComponentRenderable(MeshComponent) && ShouldDrawMesh(MeshComponent))
+			{
+				Proxies.ShadowCasters.Add(MeshComponent);
+			}
+		}
+	}
+}
+
+void FSceneRenderer::PerformOcclusionCulling()
+{
+	// 오클루더 화면 크기 추정과 선형 깊이가 원근 투영 기준이므로 직교 뷰에서는 건너뜀
+	if (!OcclusionCPU ||
+		!World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_OcclusionCulling) ||
+		View->ProjectionMode != ECameraProjectionMode::Perspective)
+	{
+		FOcclusionStatManager::GetInstance().ResetStats();
+		return;
+	}
+
+	OcclusionCPU->SetView(View->ViewMatrix, View->ProjectionMatrix, View->NearClip, View->FarClip);
+	OcclusionCPU->CullMeshes(Proxies.Meshes);
+
+	FOcclusionStatManager::GetInstance().UpdateStats(OcclusionCPU->GetStats());
 }
 
 void FSceneRenderer::PerformTileLightCulling()
 {
-	if (!TileLightCuller)
+	FClusteredLightCuller* LightCuller = OwnerRenderer->GetLightCuller();
+	if (!LightCuller)
 		return;
 
 	// ShowFlag 확인
 	URenderSettings& RenderSettings = World->GetRenderSettings();
 	bool bTileCullingEnabled = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_TileCulling);
+	uint32 TileSize = RenderSettings.GetTileSize();
+	LightCuller->SetTileSize(TileSize);
 
 	// 뷰포트 크기 가져오기
 	UINT ViewportWidth = static_cast<UINT>(View->ViewRect.Width());
@@ -917,8 +987,8 @@ void FSceneRenderer::PerformTileLightCulling()
 		TArray<FPointLightInfo>& PointLights = World->GetLightManager()->GetPointLightInfoList();
 		TArray<FSpotLightInfo>& SpotLights = World->GetLightManager()->GetSpotLightInfoList();
 
-		// 타일 컬링 수행
-		TileLightCuller->CullLights(
+		// 클러스터 컬링 수행
+		LightCuller->CullLights(
 			PointLights,
 			SpotLights,
 			View->ViewMatrix,
@@ -930,11 +1000,10 @@ void FSceneRenderer::PerformTileLightCulling()
 		);
 
 		// 통계를 전역 매니저에 업데이트
-		FTileCullingStatManager::GetInstance().UpdateStats(TileLightCuller->GetStats());
+		FTileCullingStatManager::GetInstance().UpdateStats(LightCuller->GetStats());
 	}
 
 	// 타일 컬링 상수 버퍼 업데이트
-	uint32 TileSize = RenderSettings.GetTileSize();
 	FTileCullingBufferType TileCullingBuffer;
 	TileCullingBuffer.TileSize = TileSize;
 	TileCullingBuffer.TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
@@ -942,38 +1011,86 @@ void FSceneRenderer::PerformTileLightCulling()
 	TileCullingBuffer.bUseTileCulling = bTileCullingEnabled ? 1 : 0;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartX = View->ViewRect.MinX;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartY = View->ViewRect.MinY;  // ShowFlag에 따라 설정
+	TileCullingBuffer.NumDepthSlices = FClusteredLightCuller::NumDepthSlices;
+	TileCullingBuffer.DepthSliceScale = LightCuller->GetDepthSliceScale();
+	TileCullingBuffer.DepthSliceBias = LightCuller->GetDepthSliceBias();
 
 	RHIDevice->SetAndUpdateConstantBuffer(TileCullingBuffer);
 
 	// Structured Buffer SRV를 t2 슬롯에 바인딩 (타일 컬링 활성화 시에만)
 	if (bTileCullingEnabled)
 	{
-		ID3D11ShaderResourceView* TileLightIndexSRV = TileLightCuller->GetLightIndexBufferSRV();
-		if (TileLightIndexSRV)
+		ID3D11ShaderResourceView* ClusterLightSRV = LightCuller->GetLightIndexBufferSRV();
+		if (ClusterLightSRV)
 		{
-			RHIDevice->GetDeviceContext()->PSSetShaderResources(2, 1, &TileLightIndexSRV);
+			RHIDevice->GetDeviceContext()->PSSetShaderResources(2, 1, &ClusterLightSRV);
 		}
 	}
 }
 
+bool FSceneRenderer::ShouldDrawMesh(const UMeshComponent* MeshComponent) const
+{
+	// 메시 타입별 ShowFlag (스태틱/스켈레탈)
+	if (MeshComponent->IsA(UStaticMeshComponent::StaticClass()))
+	{
+		return World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
+	}
+	if (MeshComponent->IsA(USkinnedMeshComponent::StaticClass()))
+	{
+		return World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_SkeletalMeshes);
+	}
+	return true;
+}
+
 void FSceneRenderer::PerformFrustumCulling()
 {
-	PotentiallyVisibleComponents.clear();	// 할 필요 없는데 명목적으로 초기화
+	VisiblePrimitiveIndices.Empty();
+
+	auto TryAddMesh = [this](UPrimitiveComponent* PrimitiveComponent)
+		{
+			UMeshComponent* MeshComponent = Cast<UMeshComponent>(PrimitiveComponent);
+			if (MeshComponent && MeshComponent->IsEditable() && IsComponentRenderable(MeshComponent) && ShouldDrawMesh(MeshComponent))
+			{
+				Proxies.Meshes.Add(MeshComponent);
+			}
+		};
 
-	// Todo: 프로스텀 컬링 수행, 추후 프로스텀 컬링이 컴포넌트 단위로 변경되면 적용
+	FFrustumCullingStats FrustumStats;
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	FPrimitiveBoundsSoA* PrimitiveBounds = Partition ? Partition->GetPrimitiveBounds() : nullptr;
+	if (!PrimitiveBounds || !World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Culling))
+	{
+		// 컬링 없이 레벨의 모든 메시
+		for (UMeshComponent* MeshComponent : World->GetComponentsOfClass<UMeshComponent>())
+		{
+			TryAddMesh(MeshComponent);
+		}
+		FrustumStats.NumMeshes = static_cast<uint32>(Proxies.Meshes.Num());
+		FrustumStats.NumShadowCasters = static_cast<uint32>(Proxies.ShadowCasters.Num());
+		FOcclusionStatManager::GetInstance().UpdateFrustumStats(FrustumStats);
+		return;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// 트랜스폼이 바뀐 프리미티브의 바운드만 다시 읽고 전체 SoA를 SIMD로 컬링
+	FrustumStats.NumBoundsUpdated = static_cast<uint32>(PrimitiveBounds->FlushDirty());
+	FrustumStats.NumPrimitives = static_cast<uint32>(PrimitiveBounds->Num());
 
-	//World->GetPartitionManager()->FrustumQuery(ViewFrustum)
+	const FFrustum Frustum = CreateFrustumFromViewProjection(View->ViewMatrix * View->ProjectionMatrix);
+	FrustumStats.NumVisible = static_cast<uint32>(PrimitiveBounds->CullFrustum(Frustum, VisiblePrimitiveIndices));
 
-	//for (AActor* Actor : World->GetActors())
-	//{
-	//	if (!Actor || Actor->GetActorHiddenInEditor()) continue;
+	// 메시 목록은 절두체를 통과한 슬롯에서만 만듦 (SoA에는 메시 외 프리미티브도 있으므로 Cast로 거름)
+	Proxies.Meshes.Reserve(VisiblePrimitiveIndices.Num());
+	for (int32 Index : VisiblePrimitiveIndices)
+	{
+		TryAddMesh(PrimitiveBounds->GetPrimitive(Index));
+	}
+	FrustumStats.NumMeshes = static_cast<uint32>(Proxies.Meshes.Num());
+	FrustumStats.NumShadowCasters = static_cast<uint32>(Proxies.ShadowCasters.Num());
 
-	//	// 절두체 컬링을 통과한 액터만 목록에 추가
-	//	if (ViewFrustum.Intersects(Actor->GetBounds()))
-	//	{
-	//		PotentiallyVisibleActors.Add(Actor);
-	//	}
-	//}
+	FrustumStats.TimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+	FOcclusionStatManager::GetInstance().UpdateFrustumStats(FrustumStats);
 }
 
 void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
@@ -1404,7 +1521,7 @@ void FSceneRenderer::RenderTileCullingDebug()
 	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, &SceneSRV);
 	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 1, &SamplerState);
 
-	// t2: 타일 라이트 인덱스 버퍼 (이미 PerformTileLightCulling에서 바인딩됨)
+	// t2: 클러스터 라이트 인덱스 버퍼 (이미 PerformTileLightCulling에서 바인딩됨)
 	// 별도 바인딩 불필요, 유지됨
 
 	// b11: 타일 컬링 상수 버퍼 (이미 PerformTileLightCulling에서 설정됨)
@@ -26,9 +26,9 @@ class UBillboardComponent;
 class UTextRenderComponent;
 class UGizmoArrowComponent;
 class FSceneView;
-class FTileLightCuller;
 class ULineComponent;
 class UParticleSystemComponent;
+class FOcclusionCullingManagerCPU;
 
 struct FCandidateDrawable;
 
@@ -36,7 +36,8 @@ struct FCandidateDrawable;
 struct FVisibleRenderProxySet
 {
 	// --- Type 1: Main Scene (PP O, Depth-Test O) ---
-	TArray<UMeshComponent*> Meshes;
+	TArray<UMeshComponent*> Meshes;			// 절두체(+오클루전)를 통과한 메시
+	TArray<UMeshComponent*> ShadowCasters;	// 그림자 패스 전용, 화면 밖 메시 포함
 	TArray<UBillboardComponent*> Billboards; // 인게임 빌보드 (파티클, 잔디 등)
 	TArray<UDecalComponent*> Decals;
 	TArray<UTextRenderComponent*> Texts;
@@ -72,7 +73,7 @@ struct FSceneGlobals
 class FSceneRenderer
 {
 public:
-	FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer);
+	FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer, FViewport* InViewport = nullptr);
 	~FSceneRenderer();
 
 	/** @brief 이 씬 렌더러의 모든 렌더링 파이프라인을 실행합니다. */
@@ -93,13 +94,19 @@ private:
 	/** @brief 렌더링에 필요한 뷰 행렬, 절두체 등 프레임 데이터를 준비합니다. */
 	void PrepareView();
 
-	/** @brief 월드의 모든 액터를 대상으로 절두체 컬링을 수행합니다. */
+	/** @brief 파티션의 SoA 바운드를 뷰 절두체로 SIMD 컬링하고, 보이는 슬롯의 메시로 Proxies.Meshes를 채웁니다. */
 	void PerformFrustumCulling();
 
-	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
+	/** @brief 레벨 클래스 인덱스로 메시 외 렌더링 대상, 라이트, 그림자 캐스터를 수집합니다. (메시는 PerformFrustumCulling) */
 	void GatherVisibleProxies();
 
-	/** @brief 타일 기반 라이트 컬링을 수행하고 Structured Buffer를 업데이트합니다. */
+	/** @brief 메시 타입별 ShowFlag(스태틱/스켈레탈)가 켜져 있는지 */
+	bool ShouldDrawMesh(const UMeshComponent* MeshComponent) const;
+
+	/** @brief 큰 오클루더로 만든 CPU 깊이 그리드(HZB)에 가려진 메시를 Proxies.Meshes에서 제거합니다. */
+	void PerformOcclusionCulling();
+
+	/** @brief 클러스터(타일 x 깊이 슬라이스) 기반 라이트 컬링을 수행하고 Structured Buffer를 업데이트합니다. */
 	void PerformTileLightCulling();
 
 	/** @brief 불투명(Opaque) 객체들을 렌더링하는 패스입니다. */
@@ -137,6 +144,9 @@ private:
 	URenderer* OwnerRenderer;
 	D3D11RHI* RHIDevice;
 
+	// 뷰포트별 CPU 오클루전 컬러 (FViewport 소유, 프레임 간 상태 유지)
+	FOcclusionCullingManagerCPU* OcclusionCPU = nullptr;
+
 	// 수집된 렌더링 대상 목록
 	FVisibleRenderProxySet Proxies;
 
@@ -146,15 +156,12 @@ private:
 	// 씬 전역 설정
 	FSceneGlobals SceneGlobals;
 
-	// 컬링을 거친 가시성 목록, NOTE: 추후 컴포넌트 단위로 수정
-	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
+	// 절두체 컬링을 통과한 프리미티브의 SoA 슬롯 인덱스 (FPrimitiveBoundsSoA::GetPrimitive로 조회)
+	TArray<int32> VisiblePrimitiveIndices;
 
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
 	TArray<FMeshBatchElement> MeshBatchElements;
 
-	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
-	std::unique_ptr<FTileLightCuller> TileLightCuller;
-
 	// TODO : 자동으로 등록되게 바꾸기!, bloom 빼고 다 stateless해서 걔네는 static(etc..) 등 하이브리도 구조로 바꾸기
 	// PostProcessing
 	FHeightFogPass HeightFogPass;
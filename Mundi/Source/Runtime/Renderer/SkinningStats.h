@@ -27,6 +27,7 @@ struct FSkinningStats
 
 	// 메모리 사용량 (바이트)
 	uint64_t BufferMemory = 0;              // 버퍼 메모리 (CPU: 버텍스 버퍼, GPU: 본 버퍼)
+	uint64_t SourceVertexRead = 0;          // CPU 스키닝이 읽은 원본 정점 바이트 (압축 스트림이면 36B/정점)
 
 	/**
 	 * 모든 통계를 0으로 리셋
@@ -42,6 +43,7 @@ struct FSkinningStats
 		TotalBones = 0;
 		BufferUpdateCount = 0;
 		BufferMemory = 0;
+		SourceVertexRead = 0;
 	}
 
 	/**
@@ -111,6 +113,11 @@ public:
 		CurrentStats.BufferMemory += BufferSize;
 	}
 
+	void AddSourceVertexRead(uint64_t Bytes)
+	{
+		CurrentStats.SourceVertexRead += Bytes;
+	}
+
 	void AddBoneMatrixCalcTime(double TimeMS)
 	{
 		CurrentStats.BoneMatrixCalcTimeMS += TimeMS;
@@ -1,18 +1,77 @@
 ﻿#include "pch.h"
 #include "Widgets/ConsoleWidget.h"
+#include <mutex>
 
 IMPLEMENT_CLASS(UGlobalConsole)
 
 UConsoleWidget* UGlobalConsole::ConsoleWidget = nullptr;
 
+namespace
+{
+    struct FConsoleLogLine
+    {
+        ELogVerbosity Verbosity;
+        FString Text;
+    };
+
+    /**
+     * @brief 컨슈머 스레드에서 받은 로그를 메인 스레드(콘솔 위젯)로 넘기는 싱크
+     * 위젯이 한동안 비우지 않아도 메모리가 계속 늘지 않도록 보관 줄 수를 제한하고, 버린 줄 수는 다음 TakeLines에서 알림
+     */
+    class FConsoleLogSink : public FLogSink
+    {
+    public:
+        static constexpr int32 MaxPendingLines = 8192;
+
+        void Write(const FLogRecord& Record) override
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            if (PendingLines.Num() < MaxPendingLines)
+            {
+                PendingLines.Add({ Record.Verbosity, FString(Record.Message, Record.Length) });
+            }
+            else
+            {
+                ++NumDroppedLines;
+            }
+        }
+
+        void TakeLines(TArray<FConsoleLogLine>& OutLines)
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            OutLines.swap(PendingLines);
+            if (NumDroppedLines > 0)
+            {
+                char Message[96];
+                snprintf(Message, sizeof(Message), "[Log] %llu lines dropped (console backlog full)",
+                    static_cast<unsigned long long>(NumDroppedLines));
+                OutLines.Add({ ELogVerbosity::Warning, Message });
+                NumDroppedLines = 0;
+            }
+        }
+
+    private:
+        std::mutex Mutex;
+        TArray<FConsoleLogLine> PendingLines;
+        uint64 NumDroppedLines = 0;
+    };
+
+    FConsoleLogSink GConsoleLogSink;
+}
+
 void UGlobalConsole::Initialize()
 {
-    // Nothing special to initialize
+    FLogSystem::Initialize();
+#ifdef _EDITOR
+    FLogSystem::AddSink(&GConsoleLogSink);
+#endif
 }
 
 void UGlobalConsole::Shutdown()
 {
+    FLogSystem::RemoveSink(&GConsoleLogSink);
     ConsoleWidget = nullptr;
+    FLogSystem::Shutdown();
 }
 
 void UGlobalConsole::SetConsoleWidget(UConsoleWidget* InConsoleWidget)
@@ -35,29 +94,30 @@ UConsoleWidget* UGlobalConsole::GetConsoleWidget()
 
 void UGlobalConsole::Log(const char* fmt, ...)
 {
-#ifdef _EDITOR
     va_list args;
     va_start(args, fmt);
     LogV(fmt, args);
     va_end(args);
-#endif
 }
 
 void UGlobalConsole::LogV(const char* fmt, va_list args)
+{
+    FLogSystem::LogV(LogTemp, FLogSystem::ClassifyLegacyTag(fmt), fmt, args);
+}
+
+void UGlobalConsole::FlushPendingLogs()
 {
 #ifdef _EDITOR
-    if (ConsoleWidget)
+    TArray<FConsoleLogLine> Lines;
+    GConsoleLogSink.TakeLines(Lines);
+    if (!ConsoleWidget)
     {
-        ConsoleWidget->VAddLog(fmt, args);
+        return;
     }
-    else
+
+    for (const FConsoleLogLine& Line : Lines)
     {
-        // Fallback to OutputDebugString if console widget not available
-        char tmp[1024];
-        vsnprintf_s(tmp, _countof(tmp), fmt, args);
-        OutputDebugStringA("[No Console] ");
-        OutputDebugStringA(tmp);
-        OutputDebugStringA("\n");
+        ConsoleWidget->AddLogEntry(Line.Verbosity, Line.Text);
     }
 #endif
 }
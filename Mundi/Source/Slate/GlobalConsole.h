@@ -2,6 +2,7 @@
 #include <cstdarg>
 #include <iostream>
 #include "Object.h"
+#include "LogSystem.h"
 
 class UConsoleWidget;
 
@@ -14,6 +15,7 @@ class UGlobalConsole : public UObject
 public:
     DECLARE_CLASS(UGlobalConsole, UObject)
 
+    // 로그 백엔드(FLogSystem) 시작/종료 및 콘솔 싱크 등록
     static void Initialize();
     static void Shutdown();
     
@@ -22,9 +24,13 @@ public:
     static UConsoleWidget* GetConsoleWidget();
     
     // Global logging functions (replaces ImGuiConsole functions)
+    // LogTemp 카테고리로 FLogSystem에 기록. 심각도는 "[error]" 같은 앞쪽 태그로 정함
     static void Log(const char* fmt, ...);
     static void LogV(const char* fmt, va_list args);
 
+    // 컨슈머 스레드가 완성한 로그를 콘솔 위젯으로 옮김 (메인 스레드에서 매 프레임 호출)
+    static void FlushPendingLogs();
+
 private:
     static UConsoleWidget* ConsoleWidget;
 };
@@ -7,6 +7,7 @@
 #include "StatsOverlayD2D.h"
 #include "UIManager.h"
 #include "MemoryManager.h"
+#include "PooledAllocator.h"
 #include "Picking.h"
 #include "PlatformTime.h"
 #include "DecalStatManager.h"
@@ -14,8 +15,13 @@
 #include "LightStats.h"
 #include "ShadowStats.h"
 #include "SkinningStats.h"
+#include "AnimUpdateRate.h"
 #include "SkinnedMeshComponent.h"
 #include "ParticleStats.h"
+#include "OcclusionStats.h"
+
+// SceneRenderer.cpp와 같은 이름이므로 같은 스탯 ID로 등록됨
+DECLARE_CYCLE_STAT(ShadowMapPass, "Renderer")
 
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dwrite")
@@ -166,7 +172,7 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning && !bShowParticles) || !SwapChain)
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning && !bShowParticles && !bShowOcclusion) || !SwapChain)
 		return;
 
 	// D2D 리소스 초기화 (최초 1회만 실행)
@@ -244,18 +250,40 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
+		double Mb = static_cast<double>(FMemoryManager::GetTotalAllocationBytes()) / (1024.0 * 1024.0);
+		double PeakMb = static_cast<double>(FMemoryManager::GetPeakAllocationBytes()) / (1024.0 * 1024.0);
+
+		// 현재 가장 많이 잡고 있는 태그
+		TArray<FMemoryTagStats> TagStats;
+		FMemoryManager::GetTagStats(TagStats);
+		const FMemoryTagStats* TopTag = nullptr;
+		for (const FMemoryTagStats& Tag : TagStats)
+		{
+			if (!TopTag || Tag.CurrentBytes > TopTag->CurrentBytes)
+			{
+				TopTag = &Tag;
+			}
+		}
 
-		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, FMemoryManager::TotalAllocationCount);
+		// 풀 할당기: 슬랩으로 예약한 메모리와 OS 힙으로 넘어간 큰 할당
+		const FPooledAllocator& Pool = FPooledAllocator::Get();
+		const double PoolReservedMb = static_cast<double>(Pool.GetTotalReservedBytes()) / (1024.0 * 1024.0);
+		const double LargeMb = static_cast<double>(Pool.GetLargeAllocationBytes()) / (1024.0 * 1024.0);
+
+		wchar_t Buf[256];
+		swprintf_s(Buf, L"Memory: %.1f MB (Peak %.1f MB)\nAllocs: %llu (Frame %llu)\nTop Tag: %hs %.1f MB\nPool Reserved: %.1f MB\nLarge: %llu (%.1f MB)",
+			Mb, PeakMb, FMemoryManager::GetTotalAllocationCount(), FMemoryManager::GetLastFrameAllocationCount(),
+			FMemoryManager::GetTagName(TopTag->Tag), static_cast<double>(TopTag->CurrentBytes) / (1024.0 * 1024.0),
+			PoolReservedMb, Pool.GetLargeAllocationCount(), LargeMb);
 
-		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
+		const float MemoryPanelHeight = 104.0f;
+		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + MemoryPanelHeight);
 		DrawTextBlock(
 			D2dCtx, CachedBrush, TextFormat, Buf, Rc,
 			D2D1::ColorF(0, 0, 0, 0.6f),
 			D2D1::ColorF(D2D1::ColorF::LightGreen));
 
-		NextY += PanelHeight + Space;
+		NextY += MemoryPanelHeight + Space;
 	}
 
 	if (bShowDecal)
@@ -297,21 +325,23 @@ void UStatsOverlayD2D::Draw()
 
 		// 2. 출력할 문자열 버퍼를 만듭니다.
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Tile Culling Stats]\nTiles: %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.1f / %u\nCulling Eff: %.1f%%\nBuffer: %u KB",
+		swprintf_s(Buf, L"[Tile Culling Stats]\nClusters: %u x %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.2f / %u\nCulling Eff: %.1f%%\nCPU: %.2f ms\nBuffer: %u KB",
 			TileStats.TileCountX,
 			TileStats.TileCountY,
-			TileStats.TotalTileCount,
+			TileStats.DepthSliceCount,
+			TileStats.TotalClusterCount,
 			TileStats.TotalLights,
 			TileStats.TotalPointLights,
 			TileStats.TotalSpotLights,
-			TileStats.MinLightsPerTile,
-			TileStats.AvgLightsPerTile,
-			TileStats.MaxLightsPerTile,
+			TileStats.MinLightsPerCluster,
+			TileStats.AvgLightsPerCluster,
+			TileStats.MaxLightsPerCluster,
 			TileStats.CullingEfficiency,
+			TileStats.CullingTimeMS,
 			TileStats.LightIndexBufferSizeBytes / 1024);
 
 		// 3. 텍스트를 여러 줄 표시해야 하므로 패널 높이를 늘립니다.
-		const float tilePanelHeight = 160.0f;
+		const float tilePanelHeight = 180.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + tilePanelHeight);
 
 		// 4. DrawTextBlock 함수를 호출하여 화면에 그립니다. 색상은 구분을 위해 cyan으로 설정합니다.
@@ -387,9 +417,14 @@ void UStatsOverlayD2D::Draw()
 		const float shadowMapPassHeight = 40.0f;
 		rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + shadowMapPassHeight);
 
+		// 직전 프레임 프로파일러 값 (SceneRenderer의 ShadowMapPass 스탯)
+		const FStatFrameData& ShadowPassData = FProfiler::GetLastFrameData(STAT_ShadowMapPass);
+		wchar_t ShadowPassBuf[128];
+		swprintf_s(ShadowPassBuf, L"ShadowMapPass: %.3f ms (%u calls)", ShadowPassData.InclusiveMS, ShadowPassData.CallCount);
+
 		// 4. DrawTextBlock 함수를 호출하여 화면에 그립니다. 색상은 구분을 위해 한색(Magenta)으로 설정합니다.
 		DrawTextBlock(
-			D2dCtx, CachedBrush, TextFormat, FScopeCycleCounter::GetTimeProfile("ShadowMapPass").GetConstWChar_tWithKey("ShadowMapPass"), rc,
+			D2dCtx, CachedBrush, TextFormat, ShadowPassBuf, rc,
 			D2D1::ColorF(0, 0, 0, 0.6f),
 			D2D1::ColorF(D2D1::ColorF::DeepPink));
 
@@ -400,6 +435,7 @@ void UStatsOverlayD2D::Draw()
 	{
 		// 스키닝 통계 매니저에서 데이터 가져오기
 		const FSkinningStats& Stats = FSkinningStatManager::GetInstance().GetStats();
+		const FAnimUpdateRateStats& AnimStats = FAnimUpdateRateStatManager::GetInstance().GetStats();
 
 		// 전역 스키닝 모드 확인
 		UWorld* World = GEngine.GetDefaultWorld();
@@ -435,7 +471,9 @@ void UStatsOverlayD2D::Draw()
 				L"\n"
 				L"Vertices: %d | Bones: %d\n"
 				L"Bone Buffer: %.2f KB\n"
-				L"Buffer Updates: %d",
+				L"Buffer Updates: %d\n"
+				L"Anim Eval: %d / %d (Interp %d, Frozen %d)\n"
+				L"Masked Bones: %d",
 				Stats.BoneMatrixCalcTimeMS,
 				Stats.VertexSkinningTimeMS, // GPU 모드에서는 0
 				Stats.BufferUploadTimeMS,   // 본 버퍼 업로드 시간
@@ -444,7 +482,12 @@ void UStatsOverlayD2D::Draw()
 				Stats.TotalVertices,
 				Stats.TotalBones,
 				Stats.BufferMemory / 1024.0, // 본 버퍼 메모리
-				Stats.BufferUpdateCount);
+				Stats.BufferUpdateCount,
+				AnimStats.EvaluatedComponents,
+				AnimStats.TickedComponents,
+				AnimStats.InterpolatedComponents,
+				AnimStats.FrozenComponents,
+				AnimStats.MaskedBones);
 		}
 		else
 		{
@@ -460,7 +503,10 @@ void UStatsOverlayD2D::Draw()
 				L"\n"
 				L"Vertices: %d | Bones: %d\n"
 				L"Vertex Buffer: %.2f KB\n"
-				L"Buffer Updates: %d",
+				L"Source Vertex Read: %.2f KB\n"
+				L"Buffer Updates: %d\n"
+				L"Anim Eval: %d / %d (Interp %d, Frozen %d)\n"
+				L"Masked Bones: %d",
 				Stats.BoneMatrixCalcTimeMS,
 				Stats.VertexSkinningTimeMS, // CPU 모드에서만 값이 있음
 				Stats.BufferUploadTimeMS,   // 버텍스 버퍼 업로드 시간
@@ -469,10 +515,16 @@ void UStatsOverlayD2D::Draw()
 				Stats.TotalVertices,
 				Stats.TotalBones,
 				Stats.BufferMemory / 1024.0, // 버텍스 버퍼 메모리
-				Stats.BufferUpdateCount);
+				Stats.SourceVertexRead / 1024.0, // 스키닝 입력 정점 읽기량 (압축 스트림 여부 반영)
+				Stats.BufferUpdateCount,
+				AnimStats.EvaluatedComponents,
+				AnimStats.TickedComponents,
+				AnimStats.InterpolatedComponents,
+				AnimStats.FrozenComponents,
+				AnimStats.MaskedBones);
 		}
 
-		const float skinningPanelHeight = 250.0f;
+		const float skinningPanelHeight = 308.0f;
 		D2D1_RECT_F skinningRc = D2D1::RectF(Margin, NextY, Margin + SkinningPanelWidth, NextY + skinningPanelHeight);
 
 		// 현재 모드에 따라 색상 변경 (CPU: 파란색, GPU: 연두색)
@@ -540,11 +592,60 @@ void UStatsOverlayD2D::Draw()
 		NextY += particlePanelHeight + Space;
 	}
 
+	if (bShowOcclusion)
+	{
+		const FOcclusionStats& Stats = FOcclusionStatManager::GetInstance().GetStats();
+		const FFrustumCullingStats& FrustumStats = FOcclusionStatManager::GetInstance().GetFrustumStats();
+
+		wchar_t OcclusionBuf[768];
+		swprintf_s(OcclusionBuf,
+			L"[Frustum]\n"
+			L"Primitives: %u (%u updated)\n"
+			L"Visible: %u\n"
+			L"Meshes: %u (shadow casters %u)\n"
+			L"Time: %.3f ms\n"
+			L"[Occlusion]\n"
+			L"Occluders: %u (%u tris)%s\n"
+			L"Tested: %u\n"
+			L"Offscreen: %u\n"
+			L"Occluded: %u\n"
+			L"Culled: %.1f%%\n"
+			L"Raster: %.3f ms\n"
+			L"HZB: %.3f ms\n"
+			L"Test: %.3f ms\n"
+			L"Total: %.3f ms",
+			FrustumStats.NumPrimitives,
+			FrustumStats.NumBoundsUpdated,
+			FrustumStats.NumVisible,
+			FrustumStats.NumMeshes,
+			FrustumStats.NumShadowCasters,
+			FrustumStats.TimeMS,
+			Stats.NumOccluders,
+			Stats.NumOccluderTriangles,
+			Stats.bReusedDepth ? L" [reused]" : L"",
+			Stats.NumTested,
+			Stats.NumOffscreen,
+			Stats.NumOccluded,
+			Stats.GetCulledPercent(),
+			Stats.RasterTimeMS,
+			Stats.HZBTimeMS,
+			Stats.TestTimeMS,
+			Stats.TotalTimeMS);
+
+		const float occlusionPanelHeight = 320.0f;
+		D2D1_RECT_F occlusionRc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + occlusionPanelHeight);
+
+		DrawTextBlock(
+			D2dCtx, CachedBrush, TextFormat, OcclusionBuf, occlusionRc,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::LightGreen));
+
+		NextY += occlusionPanelHeight + Space;
+	}
+
 	D2dCtx->EndDraw();
 	D2dCtx->SetTarget(nullptr);
 
-	FScopeCycleCounter::TimeProfileInit();
-
 	// 매 프레임 생성한 리소스만 해제 (캐싱된 D2D 리소스는 유지)
 	SafeRelease(TargetBmp);
 	SafeRelease(Surface);
@@ -639,3 +740,13 @@ void UStatsOverlayD2D::ToggleParticles()
 {
 	bShowParticles = !bShowParticles;
 }
+
+void UStatsOverlayD2D::SetShowOcclusion(bool b)
+{
+	bShowOcclusion = b;
+}
+
+void UStatsOverlayD2D::ToggleOcclusion()
+{
+	bShowOcclusion = !bShowOcclusion;
+}
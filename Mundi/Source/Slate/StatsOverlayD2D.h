@@ -21,6 +21,7 @@ public:
     void SetShowShadow(bool b);
     void SetShowSkinning(bool b);
     void SetShowParticles(bool b);
+    void SetShowOcclusion(bool b);
     void ToggleFPS();
     void ToggleMemory();
     void TogglePicking();
@@ -30,6 +31,7 @@ public:
     void ToggleShadow();
     void ToggleSkinning();
     void ToggleParticles();
+    void ToggleOcclusion();
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
@@ -39,6 +41,7 @@ public:
     bool IsShadowVisible() const { return bShowShadow; }
     bool IsSkinningVisible() const { return bShowSkinning; }
     bool IsParticlesVisible() const { return bShowParticles; }
+    bool IsOcclusionVisible() const { return bShowOcclusion; }
 
 private:
     UStatsOverlayD2D() = default;
@@ -60,6 +63,7 @@ private:
     bool bShowLights = false;
     bool bShowSkinning = false;
     bool bShowParticles = false;
+    bool bShowOcclusion = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
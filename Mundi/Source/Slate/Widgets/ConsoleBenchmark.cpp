@@ -0,0 +1,178 @@
+#include "pch.h"
+#include "ConsoleBenchmark.h"
+#include "ConsoleLogBuffer.h"
+#include "BenchmarkUtils.h"
+#include "BenchmarkRegistry.h"
+
+namespace
+{
+	constexpr int32 NumEntries = 1 << 20;
+	constexpr int32 NumFrames = 20;
+	constexpr int32 VisibleRows = 50;
+
+	const char* const BenchLines[] = {
+		"Spawned actor StaticMeshActor_%d at (%d, 0, 0)",
+		"[warning] Texture %d missing mip chain, using level %d",
+		"[info] Streaming level chunk %d (%d KB)",
+		"[error] Failed to load asset %d: code %d",
+		"[Lua] Enemy_Grunt_%d tick %d",
+	};
+
+	void LogScenario(const char* Name, uint64 Operations, double LegacyMS, double NewMS)
+	{
+		const double Speedup = NewMS > 0.0 ? LegacyMS / NewMS : 0.0;
+		const double Mops = NewMS > 0.0 ? static_cast<double>(Operations) / (NewMS * 1000.0) : 0.0;
+		UE_LOG("[ConsoleBenchmark] %-26s %10.2f %10.2f %7.2fx %9.2f", Name, LegacyMS, NewMS, Speedup, Mops);
+	}
+
+	FString MakeLine(int32 Index)
+	{
+		char Buffer[128];
+		snprintf(Buffer, sizeof(Buffer), BenchLines[Index % 5], Index, Index & 1023);
+		return Buffer;
+	}
+
+	/** 이전 RenderLogOutput의 줄마다 하는 일 (그리기 대신 색상/글자 수만 누적) */
+	uint64 LegacyFrame(const TArray<FString>& Items, const ImGuiTextFilter& Filter)
+	{
+		uint64 Checksum = 0;
+		for (const FString& Item : Items)
+		{
+			if (!Filter.PassFilter(Item.c_str()))
+				continue;
+
+			int32 Color = 0;
+			if (Item.find("[error]") != std::string::npos)
+				Color = 1;
+			else if (Item.find("[warning]") != std::string::npos)
+				Color = 2;
+			else if (Item.find("[info]") != std::string::npos)
+				Color = 3;
+			Checksum += Color + Item.size();
+		}
+		return Checksum;
+	}
+
+	/** 새 경로: 캐시된 필터 결과 갱신 후 맨 아래(자동 스크롤) 보이는 줄만 접근 */
+	uint64 ViewFrame(FConsoleLogView& View, const FConsoleLogBuffer& Logs, const ImGuiTextFilter& Filter, bool bFilterChanged)
+	{
+		View.Update(Logs, Filter, FConsoleLogView::AllVerbosities, bFilterChanged);
+
+		uint64 Checksum = 0;
+		const int32 Last = View.Num();
+		for (int32 Row = Last > VisibleRows ? Last - VisibleRows : 0; Row < Last; ++Row)
+		{
+			const FConsoleLogEntry& Entry = Logs.GetBySequence(View.GetSequence(Row));
+			Checksum += static_cast<uint32>(Entry.Verbosity) + Entry.Text.size();
+		}
+		return Checksum;
+	}
+
+	void SetFilter(ImGuiTextFilter& Filter, const char* Text)
+	{
+		strncpy_s(Filter.InputBuf, sizeof(Filter.InputBuf), Text, _TRUNCATE);
+		Filter.Build();
+	}
+}
+
+void FConsoleBenchmark::RunAndLog()
+{
+	TArray<FString> Items;
+	Items.Reserve(NumEntries);
+	FConsoleLogBuffer Logs(NumEntries);
+	for (int32 Index = 0; Index < NumEntries; ++Index)
+	{
+		FString Line = MakeLine(Index);
+		Logs.Add(FLogSystem::ClassifyLegacyTag(Line.c_str()), Line);
+		Items.Add(std::move(Line));
+	}
+
+	UE_LOG("[ConsoleBenchmark] %d entries, %d frames per scenario, %d visible rows", NumEntries, NumFrames, VisibleRows);
+	UE_LOG("[ConsoleBenchmark] %-26s %10s %10s %8s %9s", "Scenario", "old(ms)", "new(ms)", "Speedup", "Mops/s");
+
+	const uint64 FrameEntries = static_cast<uint64>(NumEntries) * NumFrames;
+	volatile uint64 Sink = 0;
+	ImGuiTextFilter Filter;
+	FConsoleLogView View;
+
+	// 필터 없음: 이전 경로는 매 프레임 모든 줄에 find 세 번
+	{
+		const double LegacyMS = MeasureMS([&]() { for (int32 Frame = 0; Frame < NumFrames; ++Frame) Sink = Sink + LegacyFrame(Items, Filter); });
+		const double NewMS = MeasureMS([&]() { for (int32 Frame = 0; Frame < NumFrames; ++Frame) Sink = Sink + ViewFrame(View, Logs, Filter, false); });
+		LogScenario("no filter", FrameEntries, LegacyMS, NewMS);
+	}
+
+	// 필터 입력 직후 한 번: 새 경로도 전체를 다시 검사
+	SetFilter(Filter, "Enemy");
+	{
+		const double LegacyMS = MeasureMS([&]() { Sink = Sink + LegacyFrame(Items, Filter); });
+		const double NewMS = MeasureMS([&]() { Sink = Sink + ViewFrame(View, Logs, Filter, true); });
+		LogScenario("filter changed (1 frame)", NumEntries, LegacyMS, NewMS);
+	}
+
+	// 필터 유지: 새 경로는 캐시된 결과 재사용
+	{
+		const double LegacyMS = MeasureMS([&]() { for (int32 Frame = 0; Frame < NumFrames; ++Frame) Sink = Sink + LegacyFrame(Items, Filter); });
+		const double NewMS = MeasureMS([&]() { for (int32 Frame = 0; Frame < NumFrames; ++Frame) Sink = Sink + ViewFrame(View, Logs, Filter, false); });
+		LogScenario("filter unchanged", FrameEntries, LegacyMS, NewMS);
+	}
+
+	// 필터 유지 + 프레임마다 1000줄 추가: 이전 배열은 계속 커지고, 링 버퍼는 오래된 줄을 덮어씀
+	{
+		const int32 LinesPerFrame = 1000;
+		TArray<FString> NewLines;
+		for (int32 Index = 0; Index < LinesPerFrame * NumFrames; ++Index)
+		{
+			NewLines.Add(MakeLine(NumEntries + Index));
+		}
+
+		const double LegacyMS = MeasureMS([&]()
+		{
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				for (int32 Index = 0; Index < LinesPerFrame; ++Index)
+				{
+					Items.Add(NewLines[Frame * LinesPerFrame + Index]);
+				}
+				Sink = Sink + LegacyFrame(Items, Filter);
+			}
+		});
+		const double NewMS = MeasureMS([&]()
+		{
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				for (int32 Index = 0; Index < LinesPerFrame; ++Index)
+				{
+					const FString& Line = NewLines[Frame * LinesPerFrame + Index];
+					Logs.Add(FLogSystem::ClassifyLegacyTag(Line.c_str()), Line);
+				}
+				Sink = Sink + ViewFrame(View, Logs, Filter, false);
+			}
+		});
+		LogScenario("append 1k/frame + filter", FrameEntries, LegacyMS, NewMS);
+		UE_LOG("[ConsoleBenchmark]   entries kept: old %d (unbounded), new %d (capacity %d, %llu evicted)",
+			Items.Num(), Logs.Num(), Logs.GetCapacity(), Logs.GetNumEvicted());
+	}
+
+	// 결과 검증: 같은 필터에서 두 경로의 통과 줄 수가 같아야 함
+	{
+		int32 LegacyMatches = 0;
+		for (int32 Index = Items.Num() - Logs.Num(); Index < Items.Num(); ++Index)
+		{
+			if (Filter.PassFilter(Items[Index].c_str()))
+			{
+				++LegacyMatches;
+			}
+		}
+		FConsoleLogView Fresh;
+		Fresh.Update(Logs, Filter, FConsoleLogView::AllVerbosities, true);
+		if (LegacyMatches != View.Num() || Fresh.Num() != View.Num())
+		{
+			UE_LOG("[ConsoleBenchmark] filter mismatch: legacy %d, cached %d, rebuilt %d", LegacyMatches, View.Num(), Fresh.Num());
+		}
+	}
+}
+
+static const bool bConsoleBenchmarkRegistered = FBenchmarkRegistry::Register({
+	"CONSOLE BENCH", "-consolebench", "console log view benchmark (1M entries, legacy scan vs clipped view)", EBenchmarkStage::None,
+	[](const FString&) { FConsoleBenchmark::RunAndLog(); } });
@@ -0,0 +1,16 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @brief 콘솔 로그 출력 비용 벤치마크 (콘솔 CONSOLE BENCH 명령)
+ *
+ * 로그 100만 줄이 쌓인 상태에서 한 프레임에 로그 창이 하는 일을 비교합니다.
+ * - old: 이전 RenderLogOutput (모든 줄에 PassFilter + 심각도 태그 find 세 번)
+ * - new: FConsoleLogView::Update + 화면에 보이는 줄만 접근 (ImGuiListClipper 가정)
+ * ImGui 제출 비용은 두 경로 모두 보이는 줄 수에 비례하므로 제외합니다.
+ */
+class FConsoleBenchmark
+{
+public:
+	static void RunAndLog();
+};
@@ -0,0 +1,100 @@
+#include "pch.h"
+#include "ConsoleLogBuffer.h"
+
+FConsoleLogBuffer::FConsoleLogBuffer(int32 InCapacity)
+	: Capacity(InCapacity > 0 ? InCapacity : 1)
+{
+}
+
+void FConsoleLogBuffer::Add(ELogVerbosity Verbosity, const FString& Message)
+{
+	// 끝 개행은 버리고, 중간 개행은 줄마다 항목으로 나눔
+	const char* Begin = Message.c_str();
+	const char* End = Begin + Message.size();
+	while (End > Begin && (End[-1] == '\n' || End[-1] == '\r'))
+	{
+		--End;
+	}
+
+	const char* LineBegin = Begin;
+	for (const char* P = Begin; P < End; ++P)
+	{
+		if (*P == '\n')
+		{
+			const char* LineEnd = (P > LineBegin && P[-1] == '\r') ? P - 1 : P;
+			AddLine(Verbosity, LineBegin, LineEnd);
+			LineBegin = P + 1;
+		}
+	}
+	AddLine(Verbosity, LineBegin, End);
+}
+
+void FConsoleLogBuffer::AddLine(ELogVerbosity Verbosity, const char* Begin, const char* End)
+{
+	const int32 Index = static_cast<int32>(EndSequence % Capacity);
+	if (Index >= Entries.Num())
+	{
+		Entries.SetNum(Index + 1);
+	}
+
+	FConsoleLogEntry& Entry = Entries[Index];
+	Entry.Text.assign(Begin, End);
+	Entry.Verbosity = Verbosity;
+	++EndSequence;
+}
+
+void FConsoleLogBuffer::Clear()
+{
+	// 시퀀스는 이어서 증가시켜 뷰가 이전 항목을 참조하지 않게 함 (배열은 다음 Add에서 필요한 만큼 다시 늘어남)
+	ClearedSequence = EndSequence;
+	Entries.Empty();
+}
+
+void FConsoleLogView::Update(const FConsoleLogBuffer& Buffer, const ImGuiTextFilter& Filter, uint8 VerbosityMask, bool bFilterChanged)
+{
+	const uint64 First = Buffer.GetFirstSequence();
+	const uint64 End = Buffer.GetEndSequence();
+
+	if (!Filter.IsActive() && VerbosityMask == AllVerbosities)
+	{
+		bPassAll = true;
+		PassAllFirst = First;
+		PassAllCount = Buffer.Num();
+		Matches.Empty();
+		FirstMatch = 0;
+		ScannedEnd = First;
+		return;
+	}
+
+	// 필터가 바뀌었거나 방금 활성화됨 → 보관 중인 항목 전체를 한 번 다시 검사
+	if (bPassAll || bFilterChanged || VerbosityMask != CachedMask)
+	{
+		Matches.Empty();
+		FirstMatch = 0;
+		ScannedEnd = First;
+		CachedMask = VerbosityMask;
+	}
+	bPassAll = false;
+
+	for (uint64 Sequence = ScannedEnd > First ? ScannedEnd : First; Sequence < End; ++Sequence)
+	{
+		const FConsoleLogEntry& Entry = Buffer.GetBySequence(Sequence);
+		if ((VerbosityMask & GetVerbosityBit(Entry.Verbosity))
+			&& Filter.PassFilter(Entry.Text.c_str(), Entry.Text.c_str() + Entry.Text.size()))
+		{
+			Matches.Add(Sequence);
+		}
+	}
+	ScannedEnd = End;
+
+	// 밀려나거나 지워진 항목 제거 (앞쪽 오프셋만 옮기고 가끔 압축)
+	while (FirstMatch < Matches.Num() && Matches[FirstMatch] < First)
+	{
+		++FirstMatch;
+	}
+	if (FirstMatch > 4096 && FirstMatch * 2 > Matches.Num())
+	{
+		Matches.erase(Matches.begin(), Matches.begin() + FirstMatch);
+		FirstMatch = 0;
+	}
+}
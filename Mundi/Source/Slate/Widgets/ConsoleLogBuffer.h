@@ -0,0 +1,80 @@
+#pragma once
+#include "UEContainer.h"
+#include "LogSystem.h"
+#include "ImGui/imgui.h"
+
+struct FConsoleLogEntry
+{
+	FString Text;
+	ELogVerbosity Verbosity = ELogVerbosity::Log;
+};
+
+/**
+ * @brief 콘솔 위젯의 고정 용량 로그 링 버퍼
+ *
+ * - 항목마다 단조 증가하는 시퀀스 번호를 가지며, 용량을 넘으면 가장 오래된 항목을 덮어씀
+ * - 여러 줄 메시지는 줄 단위 항목으로 나눠 저장 (ImGuiListClipper는 모든 행의 높이가 같다고 가정)
+ * - 심각도는 추가 시점에 한 번만 정해짐
+ */
+class FConsoleLogBuffer
+{
+public:
+	explicit FConsoleLogBuffer(int32 InCapacity);
+
+	void Add(ELogVerbosity Verbosity, const FString& Message);
+	void Clear();
+
+	int32 Num() const { return static_cast<int32>(EndSequence - GetFirstSequence()); }
+	int32 GetCapacity() const { return Capacity; }
+
+	/** [GetFirstSequence(), GetEndSequence()) 범위가 현재 보관 중인 항목 */
+	uint64 GetFirstSequence() const
+	{
+		const uint64 OldestKept = EndSequence > static_cast<uint64>(Capacity) ? EndSequence - Capacity : 0;
+		return OldestKept > ClearedSequence ? OldestKept : ClearedSequence;
+	}
+	uint64 GetEndSequence() const { return EndSequence; }
+
+	const FConsoleLogEntry& GetBySequence(uint64 Sequence) const { return Entries[static_cast<int32>(Sequence % Capacity)]; }
+
+	/** 용량 초과로 밀려난 항목 수 */
+	uint64 GetNumEvicted() const { return EndSequence > static_cast<uint64>(Capacity) ? EndSequence - Capacity : 0; }
+
+private:
+	void AddLine(ELogVerbosity Verbosity, const char* Begin, const char* End);
+
+	TArray<FConsoleLogEntry> Entries;   // 인덱스 = 시퀀스 % 용량. 처음 한 바퀴 동안만 늘어나고 이후에는 덮어씀
+	int32 Capacity;
+	uint64 EndSequence = 0;
+	uint64 ClearedSequence = 0;
+};
+
+/**
+ * @brief 필터(텍스트 + 심각도)를 통과한 항목의 시퀀스 목록 캐시
+ *
+ * - 필터가 바뀌지 않으면 새로 추가된 항목만 검사하고, 밀려난 항목은 앞에서 잘라냄
+ * - 필터가 비활성이면 목록 없이 버퍼 범위를 그대로 사용
+ */
+class FConsoleLogView
+{
+public:
+	static constexpr uint8 AllVerbosities = 0xFF;
+
+	static uint8 GetVerbosityBit(ELogVerbosity Verbosity) { return static_cast<uint8>(1u << static_cast<uint8>(Verbosity)); }
+
+	/** @param bFilterChanged 필터 텍스트가 이번 프레임에 바뀌었으면 true */
+	void Update(const FConsoleLogBuffer& Buffer, const ImGuiTextFilter& Filter, uint8 VerbosityMask, bool bFilterChanged);
+
+	int32 Num() const { return bPassAll ? PassAllCount : Matches.Num() - FirstMatch; }
+	uint64 GetSequence(int32 Row) const { return bPassAll ? PassAllFirst + Row : Matches[FirstMatch + Row]; }
+
+private:
+	bool bPassAll = true;
+	uint64 PassAllFirst = 0;
+	int32 PassAllCount = 0;
+
+	TArray<uint64> Matches;
+	int32 FirstMatch = 0;
+	uint64 ScannedEnd = 0;
+	uint8 CachedMask = AllVerbosities;
+};
@@ -6,6 +6,11 @@
 #include "SlateManager.h"
 #include "SkinnedMeshComponent.h"
 #include "PlatformCrashHandler.h"
+#include "MemoryManager.h"
+#include "PooledAllocator.h"
+#include "Profiler.h"
+#include "BenchmarkRegistry.h"
+#include "LuaManager.h"
 #include <windows.h>
 #include <cstdarg>
 #include <cctype>
@@ -20,9 +25,12 @@ IMPLEMENT_CLASS(UConsoleWidget)
 
 UConsoleWidget::UConsoleWidget()
 	: UWidget("Console Widget")
+	, Logs(LogCapacity)
 	, HistoryPos(-1)
 	, AutoScroll(true)
 	, ScrollToBottom(false)
+	, bFilterDirty(true)
+	, VerbosityMask(FConsoleLogView::AllVerbosities)
 	, bIsWindowPinned(false)
 {
 	memset(InputBuf, 0, sizeof(InputBuf));
@@ -59,11 +67,30 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
 	HelpCommandList.Add("STAT PARTICLES");
+	HelpCommandList.Add("STAT OCCLUSION");
+	HelpCommandList.Add("MEMORY POOLS");
+	HelpCommandList.Add("MEMORY TAGS");
+	HelpCommandList.Add("MEMORY CSV <path>");
+	HelpCommandList.Add("PROFILE STATS");
+	HelpCommandList.Add("PROFILE CAPTURE <frames> [path]");
+	HelpCommandList.Add("INPUT RECORD <path> [fixeddt]");
+	HelpCommandList.Add("INPUT REPLAY <path>");
+	HelpCommandList.Add("INPUT STOP");
+	HelpCommandList.Add("LOG STATS");
+	HelpCommandList.Add("LOG RATELIMIT <per second>");
+	HelpCommandList.Add("LOG LEVEL <category> <verbosity>");
+	HelpCommandList.Add("LUA TICK BATCHED");
+	HelpCommandList.Add("LUA TICK DIRECT");
+	HelpCommandList.Add("LUA TICK STATS");
 	HelpCommandList.Add("MINIDUMP");
 	HelpCommandList.Add("CAUSECRASH");
 	HelpCommandList.Add("CRASHIN <seconds>");
 	HelpCommandList.Add("CANCELCRASH");
 	HelpCommandList.Add("THROWEXCEPTION");
+	for (const FBenchmarkEntry& Benchmark : FBenchmarkRegistry::GetEntries())
+	{
+		HelpCommandList.Add(Benchmark.Command);
+	}
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -83,7 +110,7 @@ void UConsoleWidget::Update()
 void UConsoleWidget::RenderWidget()
 {
 	// Show basic info at top
-	ImGui::Text("Console - %d messages", Items.Num());
+	ImGui::Text("Console - %d messages", Logs.Num());
 	ImGui::Separator();
 
 	// Main console area
@@ -98,7 +125,7 @@ void UConsoleWidget::RenderToolbar()
 {
 	if (ImGui::SmallButton("Add Debug Text"))
 	{
-		AddLog("%d some text", Items.Num());
+		AddLog("%d some text", Logs.Num());
 		AddLog("some more text");
 		AddLog("display very important message here!");
 	}
@@ -121,9 +148,9 @@ void UConsoleWidget::RenderToolbar()
 	{
 		// 모든 로그 아이템을 하나의 문자열로 결합
 		FString combined_text;
-		for (const FString& item : Items)
+		for (uint64 seq = Logs.GetFirstSequence(); seq < Logs.GetEndSequence(); ++seq)
 		{
-			combined_text += item;
+			combined_text += Logs.GetBySequence(seq).Text;
 			combined_text += "\n";
 		}
 
@@ -147,7 +174,7 @@ void UConsoleWidget::RenderToolbar()
 
 					// 클립보드에 데이터 설정
 					SetClipboardData(CF_TEXT, h_global);
-					AddLog("[info] %d messages copied to clipboard", Items.Num());
+					AddLog("[info] %d messages copied to clipboard", Logs.Num());
 				}
 			}
 
@@ -192,11 +219,24 @@ void UConsoleWidget::RenderToolbar()
 	if (ImGui::BeginPopup("Options"))
 	{
 		ImGui::Checkbox("Auto-scroll", &AutoScroll);
+		ImGui::Separator();
+
+		// 심각도별 표시 여부 (Verbose/Log는 함께 묶음)
+		unsigned int mask = VerbosityMask;
+		const unsigned int log_bits = FConsoleLogView::GetVerbosityBit(ELogVerbosity::Verbose) | FConsoleLogView::GetVerbosityBit(ELogVerbosity::Log);
+		ImGui::CheckboxFlags("Log", &mask, log_bits);
+		ImGui::CheckboxFlags("Info", &mask, FConsoleLogView::GetVerbosityBit(ELogVerbosity::Display));
+		ImGui::CheckboxFlags("Warnings", &mask, FConsoleLogView::GetVerbosityBit(ELogVerbosity::Warning));
+		ImGui::CheckboxFlags("Errors", &mask, FConsoleLogView::GetVerbosityBit(ELogVerbosity::Error));
+		VerbosityMask = static_cast<uint8>(mask);
 		ImGui::EndPopup();
 	}
 
 	ImGui::SameLine();
-	Filter.Draw("Filter", 180);
+	if (Filter.Draw("Filter", 180))
+	{
+		bFilterDirty = true;
+	}
 }
 
 void UConsoleWidget::RenderLogOutput()
@@ -215,37 +255,47 @@ void UConsoleWidget::RenderLogOutput()
 
 		ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4, 1)); // Tighten spacing
 
-		for (const FString& item : Items)
+		// 필터 결과는 캐시해 두고 새로 들어온 줄만 검사
+		LogView.Update(Logs, Filter, VerbosityMask, bFilterDirty);
+		bFilterDirty = false;
+
+		// 화면에 보이는 줄만 제출 (한 줄 = 한 항목이라 높이가 일정)
+		ImGuiListClipper clipper;
+		clipper.Begin(LogView.Num());
+		while (clipper.Step())
 		{
-			if (!Filter.PassFilter(item.c_str()))
-				continue;
+			for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+			{
+				const FConsoleLogEntry& item = Logs.GetBySequence(LogView.GetSequence(row));
 
-			// Color coding for different log levels
-			ImVec4 color;
-			bool has_color = false;
+				// Color coding for different log levels
+				ImVec4 color;
+				bool has_color = false;
 
-			if (item.find("[error]") != std::string::npos)
-			{
-				color = ImVec4(1.0f, 0.4f, 0.4f, 1.0f);
-				has_color = true;
-			}
-			else if (item.find("[warning]") != std::string::npos)
-			{
-				color = ImVec4(1.0f, 0.8f, 0.0f, 1.0f);
-				has_color = true;
-			}
-			else if (item.find("[info]") != std::string::npos)
-			{
-				color = ImVec4(0.0f, 0.8f, 1.0f, 1.0f);
-				has_color = true;
-			}
+				if (item.Verbosity == ELogVerbosity::Error)
+				{
+					color = ImVec4(1.0f, 0.4f, 0.4f, 1.0f);
+					has_color = true;
+				}
+				else if (item.Verbosity == ELogVerbosity::Warning)
+				{
+					color = ImVec4(1.0f, 0.8f, 0.0f, 1.0f);
+					has_color = true;
+				}
+				else if (item.Verbosity == ELogVerbosity::Display)
+				{
+					color = ImVec4(0.0f, 0.8f, 1.0f, 1.0f);
+					has_color = true;
+				}
 
-			if (has_color)
-				ImGui::PushStyleColor(ImGuiCol_Text, color);
-			ImGui::TextUnformatted(item.c_str());
-			if (has_color)
-				ImGui::PopStyleColor();
+				if (has_color)
+					ImGui::PushStyleColor(ImGuiCol_Text, color);
+				ImGui::TextUnformatted(item.Text.c_str(), item.Text.c_str() + item.Text.size());
+				if (has_color)
+					ImGui::PopStyleColor();
+			}
 		}
+		clipper.End();
 
 		// Auto scroll to bottom
 		if (ScrollToBottom || (AutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY()))
@@ -284,20 +334,10 @@ void UConsoleWidget::RenderCommandInput()
 
 void UConsoleWidget::AddLog(const char* fmt, ...)
 {
-	char buf[1024];
 	va_list args;
 	va_start(args, fmt);
-	vsnprintf_s(buf, sizeof(buf), fmt, args);
-	buf[sizeof(buf) - 1] = 0;
+	VAddLog(fmt, args);
 	va_end(args);
-
-	if (strstr(buf, "[error]") != nullptr)
-	{
-		USlateManager::GetInstance().ForceOpenConsole();
-	}
-
-	Items.Add(FString(buf));
-	ScrollToBottom = true;
 }
 
 void UConsoleWidget::VAddLog(const char* fmt, va_list args)
@@ -306,18 +346,24 @@ void UConsoleWidget::VAddLog(const char* fmt, va_list args)
 	vsnprintf_s(buf, sizeof(buf), fmt, args);
 	buf[sizeof(buf) - 1] = 0;
 
-	if (strstr(buf, "[error]") != nullptr)
+	// 콘솔 명령 출력은 로그 백엔드를 거치지 않으므로 앞쪽 태그로 심각도 결정
+	AddLogEntry(FLogSystem::ClassifyLegacyTag(buf), FString(buf));
+}
+
+void UConsoleWidget::AddLogEntry(ELogVerbosity Verbosity, const FString& Message)
+{
+	if (Verbosity == ELogVerbosity::Error)
 	{
 		USlateManager::GetInstance().ForceOpenConsole();
 	}
 
-	Items.Add(FString(buf));
+	Logs.Add(Verbosity, Message);
 	ScrollToBottom = true;
 }
 
 void UConsoleWidget::ClearLog()
 {
-	Items.Empty();
+	Logs.Clear();
 }
 
 void UConsoleWidget::ExecCommand(const char* command_line)
@@ -368,6 +414,7 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT LIGHT");
 		AddLog("- STAT SHADOW");
 		AddLog("- STAT PARTICLES");
+		AddLog("- STAT OCCLUSION");
 		AddLog("- STAT ALL");
 		AddLog("- STAT NONE");
 	}
@@ -406,6 +453,7 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowSkinning(true);
 		UStatsOverlayD2D::Get().SetShowShadow(true);
 		UStatsOverlayD2D::Get().SetShowParticles(true);
+		UStatsOverlayD2D::Get().SetShowOcclusion(true);
 		AddLog("STAT: ON");
 	}
 	else if (Stricmp(command_line, "STAT SKINNING") == 0)
@@ -423,6 +471,11 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleParticles();
 		AddLog("STAT PARTICLES TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT OCCLUSION") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleOcclusion();
+		AddLog("STAT OCCLUSION TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT NONE") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(false);
@@ -433,6 +486,7 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowSkinning(false);
 		UStatsOverlayD2D::Get().SetShowShadow(false);
 		UStatsOverlayD2D::Get().SetShowParticles(false);
+		UStatsOverlayD2D::Get().SetShowOcclusion(false);
 		AddLog("STAT: OFF");
 	}
 	else if (Strnicmp(command_line, "SKINNING GPU", 12) == 0)
@@ -471,6 +525,123 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 
 		AddLog("CPU Skinning enabled globally (all worlds)");
 	}
+	else if (Stricmp(command_line, "MEMORY POOLS") == 0)
+	{
+		// 크기 클래스별 풀 통계 (로그로 출력)
+		FPooledAllocator::Get().DumpStats();
+	}
+	else if (Stricmp(command_line, "MEMORY TAGS") == 0)
+	{
+		// 서브시스템 태그별 현재/최고/프레임 할당 통계
+		FMemoryManager::DumpTagStats();
+	}
+	else if (Strnicmp(command_line, "MEMORY CSV", 10) == 0)
+	{
+		const char* PathArg = command_line + 10;
+		while (*PathArg == ' ')
+		{
+			++PathArg;
+		}
+		FMemoryManager::ExportCSV(*PathArg ? FString(PathArg) : FString("MemoryReport.csv"));
+	}
+	else if (Stricmp(command_line, "PROFILE STATS") == 0)
+	{
+		FProfiler::LogLastFrame();
+	}
+	else if (Strnicmp(command_line, "PROFILE CAPTURE", 15) == 0)
+	{
+		char* Arg = const_cast<char*>(command_line) + 15;
+		const unsigned long NumFrames = strtoul(Arg, &Arg, 10);
+		while (*Arg == ' ')
+		{
+			++Arg;
+		}
+
+		if (NumFrames == 0)
+		{
+			AddLog("Usage: PROFILE CAPTURE <frames> [path]");
+		}
+		else
+		{
+			const FString Path = *Arg ? FString(Arg) : FString("ProfileTrace.json");
+			FProfiler::BeginCapture(static_cast<uint32>(NumFrames), Path);
+			AddLog("Capturing %lu frames to %s", NumFrames, Path.c_str());
+		}
+	}
+	else if (Strnicmp(command_line, "INPUT RECORD", 12) == 0 || Strnicmp(command_line, "INPUT REPLAY", 12) == 0)
+	{
+		const bool bRecord = Strnicmp(command_line, "INPUT RECORD", 12) == 0;
+		char Path[MAX_PATH] = {};
+		float FixedDeltaSeconds = 1.0f / 60.0f;
+		if (sscanf_s(command_line + 12, "%259s %f", Path, static_cast<unsigned>(sizeof(Path)), &FixedDeltaSeconds) < 1 || FixedDeltaSeconds <= 0.0f)
+		{
+			AddLog(bRecord ? "Usage: INPUT RECORD <path> [fixeddt]" : "Usage: INPUT REPLAY <path>");
+		}
+		else
+		{
+			// 플레이 중이 아니면 다음 PIE 시작과 함께 시작해 같은 초기 상태에서 기록/재생되도록 함
+			const bool bWaitForPlay = !(GWorld && GWorld->bPie);
+			if (bRecord)
+			{
+				INPUT.StartRecording(Path, FixedDeltaSeconds, bWaitForPlay);
+			}
+			else if (!INPUT.StartReplay(Path, bWaitForPlay))
+			{
+				AddLog("Failed to load input recording %s", Path);
+			}
+		}
+	}
+	else if (Stricmp(command_line, "INPUT STOP") == 0)
+	{
+		INPUT.StopCapture();
+	}
+	else if (Stricmp(command_line, "LOG STATS") == 0)
+	{
+		const FLogStats Stats = FLogSystem::GetStats();
+		AddLog("Log: %llu written, %llu dropped (queue full), %llu suppressed (rate limit %u/s per site)",
+			Stats.NumWritten, Stats.NumDropped, Stats.NumSuppressed, FLogSystem::GetRateLimit());
+	}
+	else if (Strnicmp(command_line, "LOG RATELIMIT", 13) == 0)
+	{
+		const unsigned long Limit = strtoul(command_line + 13, nullptr, 10);
+		FLogSystem::SetRateLimit(static_cast<uint32>(Limit));
+		AddLog("Log rate limit: %lu per second per call site (0 = unlimited)", Limit);
+	}
+	else if (Strnicmp(command_line, "LOG LEVEL", 9) == 0)
+	{
+		char CategoryName[64] = {};
+		char VerbosityName[32] = {};
+		ELogVerbosity Verbosity;
+		FLogCategory* Category = nullptr;
+		if (sscanf_s(command_line + 9, "%63s %31s", CategoryName, static_cast<unsigned>(sizeof(CategoryName)), VerbosityName, static_cast<unsigned>(sizeof(VerbosityName))) == 2
+			&& (Category = FLogCategory::Find(CategoryName)) != nullptr
+			&& ParseLogVerbosity(VerbosityName, Verbosity))
+		{
+			Category->MinVerbosity.store(Verbosity);
+			AddLog("%s now logs %s and above", Category->Name, GetLogVerbosityName(Verbosity));
+		}
+		else
+		{
+			AddLog("Usage: LOG LEVEL <category> <Verbose|Log|Display|Warning|Error>");
+		}
+	}
+	else if (Stricmp(command_line, "LUA TICK BATCHED") == 0 || Stricmp(command_line, "LUA TICK DIRECT") == 0)
+	{
+		const bool bBatched = Stricmp(command_line, "LUA TICK BATCHED") == 0;
+		FLuaManager::SetBatchedScriptTick(bBatched);
+		AddLog("Lua script tick: %s", bBatched ? "batched (one Lua dispatcher call per frame)" : "direct (one call per component)");
+	}
+	else if (Stricmp(command_line, "LUA TICK STATS") == 0)
+	{
+		if (GWorld && GWorld->GetLuaManager())
+		{
+			GWorld->GetLuaManager()->LogScriptTickStats(20);
+		}
+		else
+		{
+			AddLog("No active world");
+		}
+	}
 	else if (Stricmp(command_line, "MINIDUMP") == 0)
 	{
 		AddLog("Generating MiniDump...");
@@ -499,6 +670,19 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		// C++ 예외 던지기 (std::runtime_error)
 		throw std::runtime_error("Intentional C++ exception thrown from console command!");
 	}
+	else if (const FBenchmarkEntry* Benchmark = FBenchmarkRegistry::FindByCommand(command_line))
+	{
+		// 헤드리스에서 씬 로드 후 실행하는 벤치마크는 현재 월드를 그대로 측정
+		if (Benchmark->Stage >= EBenchmarkStage::World && !GWorld)
+		{
+			AddLog("No active world");
+		}
+		else
+		{
+			AddLog("Running %s...", Benchmark->Description);
+			Benchmark->Run("");
+		}
+	}
 	else
 	{
 		AddLog("Unknown command: '%s'", command_line);
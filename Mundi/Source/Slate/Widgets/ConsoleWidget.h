@@ -2,6 +2,7 @@
 #include "Widget.h"
 #include "Vector.h"
 #include "ImGui/imgui.h"
+#include "ConsoleLogBuffer.h"
 
 /**
  * @brief Console Widget for displaying log messages and executing commands
@@ -19,6 +20,8 @@ public:
 	// Console specific methods
 	void AddLog(const char* fmt, ...);
 	void VAddLog(const char* fmt, va_list args);
+	/** 로그 백엔드가 완성한 줄 (심각도는 레코드 필드) */
+	void AddLogEntry(ELogVerbosity Verbosity, const FString& Message);
 	void ClearLog();
 	void ExecCommand(const char* command_line);
 
@@ -30,8 +33,11 @@ public:
 
 private:
 	// Console data
+	static constexpr int32 LogCapacity = 1 << 17;   // 보관하는 최대 줄 수 (넘으면 오래된 줄부터 덮어씀)
+
 	char InputBuf[256];
-	TArray<FString> Items;           // Log items
+	FConsoleLogBuffer Logs;          // Log items
+	FConsoleLogView LogView;         // 필터를 통과한 줄 목록 (필터가 바뀔 때만 전체 재검사)
 	TArray<FString> HelpCommandList;        // Available commands
 	TArray<FString> History;         // Command history
 	int32 HistoryPos;                // -1: new line, 0..History.Size-1 browsing history
@@ -40,6 +46,8 @@ private:
 	bool AutoScroll;
 	bool ScrollToBottom;
 	ImGuiTextFilter Filter;
+	bool bFilterDirty;
+	uint8 VerbosityMask;
 
 	bool bIsWindowPinned;    // 콘솔 창 고정(핀) 상태
 
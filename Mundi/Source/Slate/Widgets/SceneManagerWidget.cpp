@@ -521,7 +521,7 @@ void USceneManagerWidget::CommitActorRename(AActor* Actor)
 		return;
 	}
 
-	Actor->ObjectName = FName(NewName);
+	Actor->SetName(FName(NewName));
 	UE_LOG("SceneManager: Renamed actor to %s", NewName.c_str());
 	CancelActorRename();
 	RequestDelayedRefresh();
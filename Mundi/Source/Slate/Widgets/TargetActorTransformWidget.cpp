@@ -491,8 +491,11 @@ void UTargetActorTransformWidget::RenderSelectedActorDetails(AActor* SelectedAct
 		return;
 	}
 
-	// 액터 프로퍼티 표시
-	UPropertyRenderer::RenderAllPropertiesWithInheritance(SelectedActor);
+	// 액터 프로퍼티 표시 (이름/태그가 바뀌었을 수 있으므로 검색 인덱스 갱신)
+	if (UPropertyRenderer::RenderAllPropertiesWithInheritance(SelectedActor))
+	{
+		SelectedActor->RefreshQueryIndex();
+	}
 
 	ImGui::Spacing();
 	ImGui::Separator();
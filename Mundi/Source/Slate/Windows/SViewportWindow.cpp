@@ -1943,7 +1943,7 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				if (tempTileSize >= 4 && tempTileSize <= 64)
 				{
 					RenderSettings.SetTileSize(tempTileSize);
-					// TileLightCuller는 매 프레임 생성되므로 다음 프레임에 자동 적용됨
+					// 라이트 컬러가 매 프레임 RenderSettings의 타일 크기를 읽으므로 다음 프레임에 자동 적용됨
 				}
 			}
 			if (ImGui::IsItemHovered())
@@ -1961,6 +1961,42 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			ImGui::SetTooltip("타일 기반 라이트 컬링 설정");
 		}
 
+		// View Frustum Culling
+		bool bFrustumCulling = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Culling);
+		if (ImGui::Checkbox("##FrustumCulling", &bFrustumCulling))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_Culling);
+		}
+		ImGui::SameLine();
+		if (IconTile && IconTile->GetShaderResourceView())
+		{
+			ImGui::Image((void*)IconTile->GetShaderResourceView(), IconSize);
+			ImGui::SameLine(0, 4);
+		}
+		ImGui::Text(" 절두체 컬링");
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("뷰 절두체 밖의 메시를 그리지 않습니다. (SoA 바운드 SIMD 판정, STAT OCCLUSION)");
+		}
+
+		// CPU Occlusion Culling
+		bool bOcclusionCulling = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_OcclusionCulling);
+		if (ImGui::Checkbox("##OcclusionCulling", &bOcclusionCulling))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_OcclusionCulling);
+		}
+		ImGui::SameLine();
+		if (IconTile && IconTile->GetShaderResourceView())
+		{
+			ImGui::Image((void*)IconTile->GetShaderResourceView(), IconSize);
+			ImGui::SameLine(0, 4);
+		}
+		ImGui::Text(" 오클루전 컬링 (CPU)");
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("큰 스태틱 메시를 CPU 깊이 그리드에 그려서 가려진 메시를 그리지 않습니다. (STAT OCCLUSION)");
+		}
+
 		// ===== 그림자 안티 에일리어싱 =====
 		bool bShadowAA = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_ShadowAntiAliasing);
 		if (ImGui::Checkbox("##ShadowAA", &bShadowAA))
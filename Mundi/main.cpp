@@ -2,6 +2,7 @@
 #include "EditorEngine.h"
 #include "PlatformCrashHandler.h"
 #include "DebugUtils.h"
+#include "HeadlessBenchmark.h"
 #include <exception>
 
 #if defined(_MSC_VER) && defined(_DEBUG)
@@ -27,11 +28,40 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     _CrtSetBreakAlloc(0);
 #endif
 
+#ifdef _GAME
+    // -headless: 창/렌더러 없이 고정 프레임 시뮬레이션 후 타이밍 JSON 저장 (CI 벤치마크용)
+    FHeadlessOptions HeadlessOptions;
+    const bool bHeadless = HeadlessOptions.Parse(lpCmdLine);
+#else
+    const bool bHeadless = false;
+#endif
+
     try
     {
+#ifdef _GAME
+        if (bHeadless)
+        {
+            const int32 ExitCode = GEngine.RunHeadless(HeadlessOptions);
+            GEngine.Shutdown();
+            return ExitCode;
+        }
+#endif
+
         if (!GEngine.Startup(hInstance))
             return -1;
 
+#ifdef _GAME
+        // 입력 기록/재생은 시작 씬의 첫 프레임부터
+        if (!HeadlessOptions.ReplayInputPath.empty())
+        {
+            INPUT.StartReplay(HeadlessOptions.ReplayInputPath, false);
+        }
+        else if (!HeadlessOptions.RecordInputPath.empty())
+        {
+            INPUT.StartRecording(HeadlessOptions.RecordInputPath, HeadlessOptions.FixedDeltaSeconds, false);
+        }
+#endif
+
         GEngine.MainLoop();
         GEngine.Shutdown();
     }
@@ -43,7 +73,11 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
         MultiByteToWideChar(CP_UTF8, 0, e.what(), -1, msg, 256);
         wchar_t fullMsg[512];
         swprintf_s(fullMsg, 512, L"C++ Exception caught:\n\n%s\n\nGenerating MiniDump...", msg);
-        MessageBoxW(nullptr, fullMsg, L"C++ Exception", MB_OK | MB_ICONERROR);
+        // 헤드리스 실행은 대화상자로 멈추지 않도록 디버그 출력만
+        if (bHeadless)
+            OutputDebugStringW(fullMsg);
+        else
+            MessageBoxW(nullptr, fullMsg, L"C++ Exception", MB_OK | MB_ICONERROR);
 
         // MiniDump 생성
         FPlatformCrashHandler::GenerateMiniDump();
@@ -52,10 +86,13 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     catch (...)
     {
         // 알 수 없는 예외 처리 (throw int, throw custom_type 등)
-        MessageBoxW(nullptr,
-            L"Unknown C++ exception caught!\n\nGenerating MiniDump...",
-            L"Unknown Exception",
-            MB_OK | MB_ICONERROR);
+        if (!bHeadless)
+        {
+            MessageBoxW(nullptr,
+                L"Unknown C++ exception caught!\n\nGenerating MiniDump...",
+                L"Unknown Exception",
+                MB_OK | MB_ICONERROR);
+        }
 
         // MiniDump 생성
         FPlatformCrashHandler::GenerateMiniDump();
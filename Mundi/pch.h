@@ -4,6 +4,8 @@
 // Uncomment to enable DDS texture caching (faster loading, uses Data/TextureCache/)
 #define USE_DDS_CACHE
 #define USE_OBJ_CACHE
+#define USE_LEVEL_CACHE   // .scene을 바이너리로 쿠킹하여 Data/Cache/에 저장
+#define USE_QUANTIZED_VERTEX   // 메시 캐시 정점을 손실 압축 포맷(half UV, 10비트 노멀)으로 저장, CPU 스키닝은 압축 정점 스트림 사용. 캐시를 만든 실행도 디코딩한 정점을 사용
 
 #define IMGUI_DEFINE_MATH_OPERATORS	// Imgui에서 곡선 표시를 위한 전용 벡터 연산자 활성화
 